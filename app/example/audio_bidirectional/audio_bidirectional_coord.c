@@ -1106,6 +1106,7 @@ static void app_audio_core_packing_interface_init(sac_processing_interface_t *if
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = sac_fallback_gate_is_process_active;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the audio compressing processing stage interface.
@@ -1166,6 +1167,7 @@ static void app_audio_core_unpacking_interface_init(sac_processing_interface_t *
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the digital volume control audio processing stage interface.
@@ -1178,6 +1180,7 @@ static void app_audio_core_volume_interface_init(sac_processing_interface_t *ifa
     iface->ctrl = sac_volume_ctrl;
     iface->process = sac_volume_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_volume_is_in_place;
 }
 
 /** @brief Initialize the mute on underflow audio processing stage interface.
@@ -1190,6 +1193,7 @@ static void app_audio_core_mute_on_underflow_interface_init(sac_processing_inter
     iface->ctrl = NULL;
     iface->process = sac_mute_on_underflow_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_mute_on_underflow_is_in_place;
 }
 
 /** @brief Update the fallback LED indicator.
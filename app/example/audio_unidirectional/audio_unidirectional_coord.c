@@ -20,6 +20,7 @@
 #include "sac_endpoint_swc.h"
 #include "sac_fallback.h"
 #include "sac_fallback_gate.h"
+#include "sac_footprint.h"
 #include "sac_hal_facade.h"
 #include "sac_packing.h"
 #include "sac_stats.h"
@@ -52,6 +53,19 @@
 /* Fallback channel index. */
 #define FALLBACK_INDEX_0 0
 
+/* **** Audio Pipeline **** */
+/* The audio producer payload holds 24-bit samples from USB and 32-bit samples from I2S. */
+#define PRODUCER_PAYLOAD_SIZE (USB_AUDIO_ENABLED ? MAIN_CHANNEL_SWC_PAYLOAD_SIZE : MAIN_CHANNEL_I2S_PAYLOAD_SIZE)
+#define PRODUCER_QUEUE_SIZE \
+    (SAC_MIN_PRODUCER_QUEUE_SIZE + (USB_AUDIO_ENABLED ? MAIN_CHANNEL_USB_FS_PRODUCER_BUFFERING : 0))
+/* Memory pool bytes taken by the endpoints, processing stages and pipeline of app_audio_core_init(), the fallback
+ * modes excluded.
+ */
+#define SAC_MEM_POOL_NEEDED                                                                                      \
+    (2 * SAC_FOOTPRINT_ENDPOINT + 3 * SAC_FOOTPRINT_PROCESSING + SAC_FOOTPRINT_PIPELINE(PRODUCER_PAYLOAD_SIZE) + \
+     SAC_FOOTPRINT_PRODUCER_QUEUES(1, PRODUCER_PAYLOAD_SIZE, PRODUCER_QUEUE_SIZE) +                              \
+     SAC_FOOTPRINT_CONSUMER_QUEUES(1, MAIN_CHANNEL_SWC_PAYLOAD_SIZE, MAIN_CHANNEL_LATENCY_QUEUE_SIZE, false))
+
 /* TYPES **********************************************************************/
 /** @brief Enumeration representing device pairing states.
  */
@@ -85,6 +99,7 @@ typedef struct user_data {
 /* PRIVATE GLOBALS ************************************************************/
 /* **** Audio Core **** */
 static uint8_t audio_memory_pool[SAC_MEM_POOL_SIZE];
+SAC_FOOTPRINT_CHECK(sizeof(audio_memory_pool), SAC_MEM_POOL_NEEDED);
 static sac_pipeline_t *sac_pipeline;
 
 /* **** Processing Stages **** */
@@ -580,8 +595,8 @@ static void app_audio_core_init(void)
         .use_encapsulation = false,
         .delayed_action = !USB_AUDIO_ENABLED,
         .channel_count = MAIN_CHANNEL_CHANNEL_COUNT,
-        .audio_payload_size = USB_AUDIO_ENABLED ? MAIN_CHANNEL_SWC_PAYLOAD_SIZE : MAIN_CHANNEL_I2S_PAYLOAD_SIZE,
-        .queue_size = SAC_MIN_PRODUCER_QUEUE_SIZE + (USB_AUDIO_ENABLED ? MAIN_CHANNEL_USB_FS_PRODUCER_BUFFERING : 0),
+        .audio_payload_size = PRODUCER_PAYLOAD_SIZE,
+        .queue_size = PRODUCER_QUEUE_SIZE,
     };
     audio_producer = sac_endpoint_init(NULL, "Audio EP (Producer)", producer_iface, producer_cfg, &sac_status);
     ASSERT_SAC_STATUS(sac_status);
@@ -681,6 +696,7 @@ static void app_audio_core_packing_interface_init(sac_processing_interface_t *if
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = sac_fallback_gate_is_process_active;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the audio fallback packing processing stage interface.
@@ -693,6 +709,7 @@ static void app_audio_core_packing_fallback_interface_init(sac_processing_interf
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = sac_fallback_gate_is_process_active;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Update the fallback LED indicator.
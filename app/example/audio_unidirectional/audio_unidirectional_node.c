@@ -801,6 +801,7 @@ static void app_audio_core_volume_interface_init(sac_processing_interface_t *ifa
     iface->ctrl = sac_volume_ctrl;
     iface->process = sac_volume_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_volume_is_in_place;
 }
 
 /** @brief Initialize the audio packing processing stage interface for deactivated fallback.
@@ -813,6 +814,7 @@ static void app_audio_core_packing_interface_init(sac_processing_interface_t *if
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = sac_fallback_gate_is_process_active;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the audio packing processing stage interface for activated fallback.
@@ -825,6 +827,7 @@ static void app_audio_core_packing_fallback_interface_init(sac_processing_interf
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = sac_fallback_gate_is_process_active;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the mute on underflow audio processing stage interface.
@@ -837,6 +840,7 @@ static void app_audio_core_mute_on_underflow_interface_init(sac_processing_inter
     iface->ctrl = NULL;
     iface->process = sac_mute_on_underflow_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_mute_on_underflow_is_in_place;
 }
 
 /** @brief Increase the audio output volume level.
@@ -16,6 +16,7 @@
 #include "swc_cfg.h"
 #include "swc_cfg_coord.h"
 #include "swc_error.h"
+#include "swc_footprint.h"
 #include "swc_stats.h"
 
 /* CONSTANTS ******************************************************************/
@@ -27,6 +28,18 @@
 /* Size of the buffer used to print errors. */
 #define ERROR_MESSAGE_BUFFER_SIZE 50
 
+/* Memory pool bytes taken by the Wireless Core configuration of app_swc_core_init(). */
+#define CONNECTION_NAME_LENGTH  (sizeof("TX Connection") - 1)
+#define CONNECTION_PAYLOAD_SIZE (MAX_PAYLOAD_SIZE_BYTE + ENDING_NULL_CHARACTER_SIZE)
+#define CONNECTION_HEADER_SIZE  SWC_FOOTPRINT_MAX_HEADER_SIZE(CONNECTION_PAYLOAD_SIZE)
+#define SWC_MEM_POOL_NEEDED                                                                                            \
+    (SWC_FOOTPRINT_NODE(ARRAY_SIZE(timeslot_us), ARRAY_SIZE(channel_sequence)) + SWC_FOOTPRINT_RADIO(false) +          \
+     2 * SWC_FOOTPRINT_CONNECTION(CONNECTION_NAME_LENGTH, ARRAY_SIZE(tx_timeslots), ARRAY_SIZE(channel_sequence), 1) + \
+     SWC_FOOTPRINT_TX_DATA(SWC_QUEUE_SIZE, CONNECTION_HEADER_SIZE, CONNECTION_PAYLOAD_SIZE) +                          \
+     SWC_FOOTPRINT_RX_DATA(SWC_QUEUE_SIZE, CONNECTION_PAYLOAD_SIZE) +                                                  \
+     SWC_FOOTPRINT_XLAYER_QUEUES(SWC_QUEUE_SIZE, SWC_QUEUE_SIZE, CONNECTION_HEADER_SIZE) +                             \
+     SWC_FOOTPRINT_CALLBACK_QUEUE(3 * SWC_QUEUE_SIZE))
+
 /* TYPES **********************************************************************/
 /** @brief Enumeration representing device pairing states.
  */
@@ -50,6 +63,7 @@ static uint32_t channel_sequence[] = CHANNEL_SEQUENCE;
 static uint32_t channel_frequency[] = CHANNEL_FREQ;
 static int32_t tx_timeslots[] = COORD_TIMESLOTS;
 static int32_t rx_timeslots[] = NODE_TIMESLOTS;
+SWC_FOOTPRINT_CHECK(sizeof(swc_memory_pool), SWC_MEM_POOL_NEEDED);
 
 /* ** Application Specific ** */
 static char rx_payload[MAX_PAYLOAD_SIZE_BYTE];
@@ -1710,6 +1710,7 @@ static void app_audio_core_packing_interface_init(sac_processing_interface_t *if
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = sac_fallback_gate_is_process_active;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the audio mute packet processing stage interface.
@@ -1722,6 +1723,7 @@ static void app_audio_core_mute_packet_interface_init(sac_processing_interface_t
     iface->ctrl = NULL;
     iface->process = sac_mute_packet_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_mute_packet_is_in_place;
 }
 
 /** @brief Initialize the audio compressing processing stage interface.
@@ -1794,6 +1796,7 @@ static void app_audio_core_unpacking_interface_init(sac_processing_interface_t *
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the digital volume control audio processing stage interface.
@@ -1806,6 +1809,7 @@ static void app_audio_core_volume_interface_init(sac_processing_interface_t *ifa
     iface->ctrl = sac_volume_ctrl;
     iface->process = sac_volume_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_volume_is_in_place;
 }
 
 /** @brief Increase the audio output volume level.
@@ -21,6 +21,7 @@
 #include "sac_api.h"
 #include "sac_cfg.h"
 #include "sac_compression.h"
+#include "sac_decoder.h"
 #include "sac_dummy_endpoint.h"
 #include "sac_endpoint_swc.h"
 #include "sac_fallback.h"
@@ -94,6 +95,14 @@
 #define PRINT_STATS_ENABLED 0
 #endif
 
+/* Decode the ADPCM fallback mode with the fused decoder stage, which decompresses the samples and writes them in the
+ * consumer format in a single pass, instead of the decompression stage. The upsampling stage is kept after it since
+ * its history is shared with the other 48kHz modes. Set to 0 to use the decompression stage.
+ */
+#ifndef MAIN_CHANNEL_FUSED_DECODER_ENABLED
+#define MAIN_CHANNEL_FUSED_DECODER_ENABLED 1
+#endif
+
 /* **** Latch-recovery test hooks (dual-radio wedge investigation) ****
  * When the radio wedges, the main loop stays alive (the periodic crash-dump keeps
  * printing) so the polled buttons are still serviced — as long as you DON'T press the
@@ -271,8 +280,13 @@ static sac_fallback_instance_t main_channel_fallback_instance;
 static sac_processing_t *main_channel_fallback_processing;
 static sac_packing_instance_t main_channel_unpacking_instance;
 static sac_processing_t *main_channel_unpacking_processing;
+#if MAIN_CHANNEL_FUSED_DECODER_ENABLED
+static sac_decoder_instance_t main_channel_decoder_instance;
+static sac_processing_t *main_channel_decoder_processing;
+#else
 static sac_compression_instance_t main_channel_decompression_instance;
 static sac_processing_t *main_channel_decompression_processing;
+#endif
 static sac_processing_t *main_channel_cdc_processing;
 static sac_mute_on_underflow_instance_t main_channel_mute_on_underflow_instance;
 static sac_processing_t *main_channel_mute_on_underflow_processing;
@@ -403,6 +417,7 @@ static void app_audio_core_upsampling_interface_init(sac_processing_interface_t
 static void app_audio_core_mute_packet_interface_init(sac_processing_interface_t *iface);
 static void app_audio_core_unpacking_interface_init(sac_processing_interface_t *iface);
 static void app_audio_core_decompressing_interface_init(sac_processing_interface_t *iface);
+static void app_audio_core_decoder_interface_init(sac_processing_interface_t *iface);
 static void app_audio_core_volume_interface_init(sac_processing_interface_t *iface);
 static void app_audio_core_mute_on_underflow_interface_init(sac_processing_interface_t *iface);
 /* Processing stages that are used for the back channel. */
@@ -1051,6 +1066,7 @@ static void app_audio_core_init(void)
     sac_processing_interface_t main_channel_mute_packet_iface = {0};
     sac_processing_interface_t main_channel_unpacking_iface = {0};
     sac_processing_interface_t main_channel_decompression_iface = {0};
+    sac_processing_interface_t main_channel_decoder_iface = {0};
     sac_processing_interface_t main_channel_volume_iface = {0};
     sac_processing_interface_t main_channel_mute_on_underflow_iface = {0};
     sac_processing_interface_t back_channel_packing_iface = {0};
@@ -1068,6 +1084,7 @@ static void app_audio_core_init(void)
     app_audio_core_mute_packet_interface_init(&main_channel_mute_packet_iface);
     app_audio_core_unpacking_interface_init(&main_channel_unpacking_iface);
     app_audio_core_decompressing_interface_init(&main_channel_decompression_iface);
+    app_audio_core_decoder_interface_init(&main_channel_decoder_iface);
     app_audio_core_volume_interface_init(&main_channel_volume_iface);
     app_audio_core_mute_on_underflow_interface_init(&main_channel_mute_on_underflow_iface);
 
@@ -1259,6 +1276,17 @@ static void app_audio_core_init(void)
                                                                       &sac_status);
     ASSERT_SAC_STATUS(sac_status);
 
+#if MAIN_CHANNEL_FUSED_DECODER_ENABLED
+    /* Processing stage that decompresses audio samples if fallback is activated, the upsampling stage follows. */
+    main_channel_decoder_instance.channel_count = MAIN_CHANNEL_CHANNEL_COUNT;
+    main_channel_decoder_instance.multiply_ratio = SAC_SRC_ONE;
+    main_channel_decoder_instance.sample_format = MAIN_CHANNEL_CONSUMER_SAC_SAMPLE_FORMAT;
+    main_channel_decoder_instance.initial_volume_level = 100;
+    main_channel_decoder_processing = sac_processing_stage_init((void *)&main_channel_decoder_instance,
+                                                                "Audio Decoder", main_channel_decoder_iface,
+                                                                &sac_status);
+    ASSERT_SAC_STATUS(sac_status);
+#else
     /* Processing stage that decompresses audio samples if fallback is activated. */
     main_channel_decompression_instance.compression_mode = SAC_COMPRESSION_UNPACK_STEREO;
     main_channel_decompression_instance.sample_format = MAIN_CHANNEL_CONSUMER_SAC_SAMPLE_FORMAT;
@@ -1266,6 +1294,7 @@ static void app_audio_core_init(void)
                                                                       "Audio Decompressing",
                                                                       main_channel_decompression_iface, &sac_status);
     ASSERT_SAC_STATUS(sac_status);
+#endif
 
     /* Audio sample accumulator processing stage initialization. */
     sac_processing_interface_t main_channel_sample_accumulator_iface = {
@@ -1334,9 +1363,15 @@ static void app_audio_core_init(void)
     ASSERT_SAC_STATUS(sac_status);
     sac_pipeline_add_processing(main_channel_sac_pipeline, main_channel_fallback_processing, &sac_status);
     ASSERT_SAC_STATUS(sac_status);
+#if MAIN_CHANNEL_FUSED_DECODER_ENABLED
+    /* Decompress. */
+    sac_pipeline_add_processing(main_channel_sac_pipeline, main_channel_decoder_processing, &sac_status);
+    ASSERT_SAC_STATUS(sac_status);
+#else
     /* Decompress. */
     sac_pipeline_add_processing(main_channel_sac_pipeline, main_channel_decompression_processing, &sac_status);
     ASSERT_SAC_STATUS(sac_status);
+#endif
     /* Unpack to 24-bit */
     sac_pipeline_add_processing(main_channel_sac_pipeline, main_channel_fbk_unpacking_processing, &sac_status);
     ASSERT_SAC_STATUS(sac_status);
@@ -1398,9 +1433,15 @@ static void app_audio_core_init(void)
     sac_fallback_mode_assign_process(&main_channel_fallback_instance, mode_index, main_channel_upsampling_processing,
                                      &sac_status);
     ASSERT_SAC_STATUS(sac_status);
+#if MAIN_CHANNEL_FUSED_DECODER_ENABLED
+    sac_fallback_mode_assign_process(&main_channel_fallback_instance, mode_index, main_channel_decoder_processing,
+                                     &sac_status);
+    ASSERT_SAC_STATUS(sac_status);
+#else
     sac_fallback_mode_assign_process(&main_channel_fallback_instance, mode_index, main_channel_decompression_processing,
                                      &sac_status);
     ASSERT_SAC_STATUS(sac_status);
+#endif
 
     /** Start fallback in best quality.
      *
@@ -1712,6 +1753,7 @@ static void app_audio_core_mute_packet_interface_init(sac_processing_interface_t
     iface->ctrl = NULL;
     iface->process = sac_mute_packet_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_mute_packet_is_in_place;
 }
 
 /** @brief Initialize the audio unpacking processing stage interface.
@@ -1724,6 +1766,7 @@ static void app_audio_core_unpacking_interface_init(sac_processing_interface_t *
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = sac_fallback_gate_is_process_active;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the audio decompressing processing stage interface.
@@ -1738,6 +1781,18 @@ static void app_audio_core_decompressing_interface_init(sac_processing_interface
     iface->gate = sac_fallback_gate_is_process_active;
 }
 
+/** @brief Initialize the audio fused decoder processing stage interface.
+ *
+ *  @param[out] iface  Processing interface.
+ */
+static void app_audio_core_decoder_interface_init(sac_processing_interface_t *iface)
+{
+    iface->init = sac_decoder_init;
+    iface->ctrl = sac_decoder_ctrl;
+    iface->process = sac_decoder_process;
+    iface->gate = sac_fallback_gate_is_process_active;
+}
+
 /** @brief Initialize the digital volume control audio processing stage interface.
  *
  *  @param[out] iface  Processing interface.
@@ -1748,6 +1803,7 @@ static void app_audio_core_volume_interface_init(sac_processing_interface_t *ifa
     iface->ctrl = sac_volume_ctrl;
     iface->process = sac_volume_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_volume_is_in_place;
 }
 
 /** @brief Initialize the mute on underflow audio processing stage interface.
@@ -1760,6 +1816,7 @@ static void app_audio_core_mute_on_underflow_interface_init(sac_processing_inter
     iface->ctrl = NULL;
     iface->process = sac_mute_on_underflow_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_mute_on_underflow_is_in_place;
 }
 
 /** @brief Initialize the audio packing processing stage interface.
@@ -1772,6 +1829,7 @@ static void app_audio_core_packing_interface_init(sac_processing_interface_t *if
     iface->ctrl = sac_packing_ctrl;
     iface->process = sac_packing_process;
     iface->gate = NULL;
+    iface->is_in_place = sac_packing_is_in_place;
 }
 
 /** @brief Initialize the sampling rate converter audio processing stage interface.
@@ -0,0 +1,320 @@
+/** @file  adpcm_check.c
+ *  @brief This tool checks that the block ADPCM functions are bit-exact with the per-sample ones on the host.
+ *
+ *  Every stream is processed as a few consecutive blocks of random frame counts, from random channel states, with
+ *  adpcm_encode_block() and adpcm_decode_block() on one side and with adpcm_encode() and adpcm_decode() on every
+ *  sample, packed as documented in adpcm.h, on the other side. The encoded bytes, the decoded samples and the channel
+ *  states after every block must be identical.
+ *
+ *  The encoder is fed full scale noise, quiet noise and full scale square waves, which saturate the predictor and the
+ *  step index. The decoder is fed random bytes, so every code is decoded from every step index.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "adpcm.h"
+
+/* CONSTANTS ******************************************************************/
+#define MAX_CHANNEL_COUNT 2
+/* Frame counts go beyond 255 frames, the limit of the compression stage loops before the block functions. */
+#define MAX_FRAME_COUNT 300
+#define MAX_SAMPLE_COUNT (MAX_FRAME_COUNT * MAX_CHANNEL_COUNT)
+/* Each frame takes one byte in stereo and half a byte in mono. */
+#define MAX_ADPCM_SIZE MAX_FRAME_COUNT
+
+/* Number of streams per check and number of consecutive blocks per stream. */
+#define STREAM_COUNT 200
+#define BLOCK_COUNT  4
+#define RANDOM_SEED  0x1357BDF1U
+
+/* Number of entries of the step size table, the step index ranges from 0 to STEP_INDEX_COUNT - 1. */
+#define STEP_INDEX_COUNT 89
+/* Number of samples per half period of the square waves. */
+#define SQUARE_HALF_PERIOD 7
+
+/* MACROS *********************************************************************/
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+
+/* TYPES **********************************************************************/
+/** @brief Input signal of the encoder.
+ */
+typedef enum signal_kind {
+    SIGNAL_NOISE,
+    SIGNAL_QUIET_NOISE,
+    SIGNAL_SQUARE,
+    SIGNAL_KIND_COUNT,
+} signal_kind_t;
+
+/* PRIVATE GLOBALS ************************************************************/
+static const char *const channel_name[MAX_CHANNEL_COUNT] = {"mono", "stereo"};
+
+static int16_t pcm[MAX_SAMPLE_COUNT];
+static int16_t block_pcm[MAX_SAMPLE_COUNT];
+static int16_t scalar_pcm[MAX_SAMPLE_COUNT];
+static uint8_t adpcm[MAX_ADPCM_SIZE];
+static uint8_t block_adpcm[MAX_ADPCM_SIZE];
+static uint8_t scalar_adpcm[MAX_ADPCM_SIZE];
+static uint32_t random_state = RANDOM_SEED;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static bool check_encode(uint8_t channel_count);
+static bool check_decode(uint8_t channel_count);
+static bool check_unsupported_channel_count(void);
+static uint16_t encode_scalar(const int16_t *samples, uint16_t frame_count, uint8_t channel_count,
+                              adpcm_state_t *state, uint8_t *out);
+static void decode_scalar(const uint8_t *in, uint16_t frame_count, uint8_t channel_count, adpcm_state_t *state,
+                          int16_t *samples);
+static void generate_signal(int16_t *samples, uint16_t sample_count);
+static void init_random_states(adpcm_state_t *block_state, adpcm_state_t *scalar_state);
+static uint16_t get_random_frame_count(void);
+static uint32_t get_random(void);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(void)
+{
+    bool passed = true;
+
+    for (uint8_t channel_count = 1; channel_count <= MAX_CHANNEL_COUNT; channel_count++) {
+        passed &= check_encode(channel_count);
+        passed &= check_decode(channel_count);
+    }
+    passed &= check_unsupported_channel_count();
+
+    printf("%s\n", passed ? "PASSED" : "FAILED");
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Compare adpcm_encode_block() with adpcm_encode() over random streams.
+ *
+ *  @param[in] channel_count  Number of interleaved channels.
+ *  @retval true   The bytes and the states are identical for every block.
+ *  @retval false  A block differs.
+ */
+static bool check_encode(uint8_t channel_count)
+{
+    adpcm_state_t block_state[MAX_CHANNEL_COUNT];
+    adpcm_state_t scalar_state[MAX_CHANNEL_COUNT];
+    uint32_t mismatch_count = 0;
+
+    printf("%-6s encode: ", channel_name[channel_count - 1]);
+
+    for (uint16_t stream = 0; stream < STREAM_COUNT; stream++) {
+        init_random_states(block_state, scalar_state);
+        for (uint8_t block = 0; block < BLOCK_COUNT; block++) {
+            uint16_t frame_count = get_random_frame_count();
+            uint16_t block_size;
+            uint16_t scalar_size;
+
+            generate_signal(pcm, frame_count * channel_count);
+            block_size = adpcm_encode_block(pcm, frame_count, channel_count, block_state, block_adpcm);
+            scalar_size = encode_scalar(pcm, frame_count, channel_count, scalar_state, scalar_adpcm);
+
+            if ((block_size != scalar_size) || (memcmp(block_adpcm, scalar_adpcm, scalar_size) != 0) ||
+                (memcmp(block_state, scalar_state, channel_count * sizeof(adpcm_state_t)) != 0)) {
+                mismatch_count++;
+            }
+        }
+    }
+
+    if (mismatch_count != 0) {
+        printf("FAILED, %lu of %u blocks differ\n", (unsigned long)mismatch_count, STREAM_COUNT * BLOCK_COUNT);
+        return false;
+    }
+    printf("ok\n");
+
+    return true;
+}
+
+/** @brief Compare adpcm_decode_block() with adpcm_decode() over random streams.
+ *
+ *  @param[in] channel_count  Number of interleaved channels.
+ *  @retval true   The samples and the states are identical for every block.
+ *  @retval false  A block differs.
+ */
+static bool check_decode(uint8_t channel_count)
+{
+    adpcm_state_t block_state[MAX_CHANNEL_COUNT];
+    adpcm_state_t scalar_state[MAX_CHANNEL_COUNT];
+    uint32_t mismatch_count = 0;
+
+    printf("%-6s decode: ", channel_name[channel_count - 1]);
+
+    for (uint16_t stream = 0; stream < STREAM_COUNT; stream++) {
+        init_random_states(block_state, scalar_state);
+        for (uint8_t block = 0; block < BLOCK_COUNT; block++) {
+            uint16_t frame_count = get_random_frame_count();
+            uint16_t sample_count = frame_count * channel_count;
+            uint16_t written_count;
+
+            for (uint16_t i = 0; i < MAX_ADPCM_SIZE; i++) {
+                adpcm[i] = (uint8_t)get_random();
+            }
+            written_count = adpcm_decode_block(adpcm, frame_count, channel_count, block_state, block_pcm);
+            decode_scalar(adpcm, frame_count, channel_count, scalar_state, scalar_pcm);
+
+            if ((written_count != sample_count) ||
+                (memcmp(block_pcm, scalar_pcm, sample_count * sizeof(int16_t)) != 0) ||
+                (memcmp(block_state, scalar_state, channel_count * sizeof(adpcm_state_t)) != 0)) {
+                mismatch_count++;
+            }
+        }
+    }
+
+    if (mismatch_count != 0) {
+        printf("FAILED, %lu of %u blocks differ\n", (unsigned long)mismatch_count, STREAM_COUNT * BLOCK_COUNT);
+        return false;
+    }
+    printf("ok\n");
+
+    return true;
+}
+
+/** @brief Check that the block functions reject more than two channels.
+ *
+ *  @retval true   Nothing is written.
+ *  @retval false  The channel count is accepted.
+ */
+static bool check_unsupported_channel_count(void)
+{
+    adpcm_state_t state[MAX_CHANNEL_COUNT + 1];
+    bool passed;
+
+    memset(state, 0, sizeof(state));
+    generate_signal(pcm, MAX_CHANNEL_COUNT + 1);
+    passed = (adpcm_encode_block(pcm, 1, MAX_CHANNEL_COUNT + 1, state, block_adpcm) == 0) &&
+             (adpcm_decode_block(adpcm, 1, MAX_CHANNEL_COUNT + 1, state, block_pcm) == 0);
+
+    printf("%-14s %s\n", "3 channels:", passed ? "ok" : "FAILED");
+
+    return passed;
+}
+
+/** @brief Encode a block with adpcm_encode(), packed like adpcm_encode_block().
+ *
+ *  @param[in]     samples        Interleaved 16-bit PCM samples.
+ *  @param[in]     frame_count    Number of samples per channel.
+ *  @param[in]     channel_count  Number of interleaved channels, 1 or 2.
+ *  @param[in,out] state          ADPCM encoder state of each channel.
+ *  @param[out]    out            Packed 4-bit ADPCM samples.
+ *  @return Number of bytes written.
+ */
+static uint16_t encode_scalar(const int16_t *samples, uint16_t frame_count, uint8_t channel_count,
+                              adpcm_state_t *state, uint8_t *out)
+{
+    if (channel_count == 2) {
+        for (uint16_t i = 0; i < frame_count; i++) {
+            uint8_t left = adpcm_encode(samples[2 * i], &state[0]) & 0x0F;
+            uint8_t right = adpcm_encode(samples[(2 * i) + 1], &state[1]) & 0x0F;
+
+            out[i] = left | (uint8_t)(right << 4);
+        }
+        return frame_count;
+    }
+
+    for (uint16_t i = 0; i < frame_count; i++) {
+        uint8_t code = adpcm_encode(samples[i], &state[0]) & 0x0F;
+
+        if ((i % 2) == 0) {
+            out[i / 2] = code;
+        } else {
+            out[i / 2] |= (uint8_t)(code << 4);
+        }
+    }
+    return (frame_count + 1) / 2;
+}
+
+/** @brief Decode a block with adpcm_decode(), packed like adpcm_encode_block().
+ *
+ *  @param[in]     in             Packed 4-bit ADPCM samples.
+ *  @param[in]     frame_count    Number of samples per channel.
+ *  @param[in]     channel_count  Number of interleaved channels, 1 or 2.
+ *  @param[in,out] state          ADPCM decoder state of each channel.
+ *  @param[out]    samples        Interleaved 16-bit PCM samples.
+ */
+static void decode_scalar(const uint8_t *in, uint16_t frame_count, uint8_t channel_count, adpcm_state_t *state,
+                          int16_t *samples)
+{
+    if (channel_count == 2) {
+        for (uint16_t i = 0; i < frame_count; i++) {
+            samples[2 * i] = adpcm_decode(in[i] & 0x0F, &state[0]);
+            samples[(2 * i) + 1] = adpcm_decode(in[i] >> 4, &state[1]);
+        }
+        return;
+    }
+
+    for (uint16_t i = 0; i < frame_count; i++) {
+        samples[i] = adpcm_decode(((i % 2) == 0) ? (in[i / 2] & 0x0F) : (in[i / 2] >> 4), &state[0]);
+    }
+}
+
+/** @brief Generate the encoder input of a block, of a random signal kind.
+ *
+ *  @param[out] samples       Interleaved 16-bit PCM samples.
+ *  @param[in]  sample_count  Number of samples.
+ */
+static void generate_signal(int16_t *samples, uint16_t sample_count)
+{
+    signal_kind_t kind = (signal_kind_t)(get_random() % SIGNAL_KIND_COUNT);
+
+    for (uint16_t i = 0; i < sample_count; i++) {
+        switch (kind) {
+        case SIGNAL_QUIET_NOISE:
+            samples[i] = (int16_t)((int32_t)(get_random() % 257) - 128);
+            break;
+        case SIGNAL_SQUARE:
+            samples[i] = (((i / SQUARE_HALF_PERIOD) % 2) == 0) ? INT16_MAX : INT16_MIN;
+            break;
+        case SIGNAL_NOISE:
+        default:
+            samples[i] = (int16_t)get_random();
+            break;
+        }
+    }
+}
+
+/** @brief Set the same random channel states for the block and the per-sample functions.
+ *
+ *  @param[out] block_state   Channel states of the block functions.
+ *  @param[out] scalar_state  Channel states of the per-sample functions.
+ */
+static void init_random_states(adpcm_state_t *block_state, adpcm_state_t *scalar_state)
+{
+    for (uint8_t i = 0; i < MAX_CHANNEL_COUNT; i++) {
+        adpcm_init_state(&block_state[i]);
+        block_state[i].state.predicted_sample = (int16_t)get_random();
+        block_state[i].state.index = (uint8_t)(get_random() % STEP_INDEX_COUNT);
+        scalar_state[i] = block_state[i];
+    }
+}
+
+/** @brief Get the frame count of a block, odd or even.
+ *
+ *  @return Frame count, from 1 to MAX_FRAME_COUNT.
+ */
+static uint16_t get_random_frame_count(void)
+{
+    return (uint16_t)(1 + (get_random() % MAX_FRAME_COUNT));
+}
+
+/** @brief Get the next value of a xorshift pseudo-random sequence.
+ *
+ *  @return Pseudo-random value.
+ */
+static uint32_t get_random(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state;
+}
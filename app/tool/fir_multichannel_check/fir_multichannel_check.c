@@ -0,0 +1,330 @@
+/** @file  fir_multichannel_check.c
+ *  @brief This tool compares the channel-fused FIR kernels with the per-channel ones on the host.
+ *
+ *  Every case filters a few consecutive blocks of pseudo-random interleaved samples, so the history carried between
+ *  calls is checked as well. fir_decimate() and fir_interpolate(), run once per channel, give the reference outputs.
+ *  The 32-bit fused kernels use the same arithmetic and must match them exactly, for 16-bit and 24-bit samples. The
+ *  Q15 kernels are only checked on 16-bit samples and may differ by one LSB.
+ *
+ *  The coefficients are drawn in 1.15 format and widened to 1.31, so fir_coeffs_q31_to_q15() gives them back
+ *  unchanged and the Q15 kernels filter with the exact same response as the references.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "filtering_functions.h"
+
+/* CONSTANTS ******************************************************************/
+#define MAX_CHANNEL_COUNT 4
+#define MAX_RATIO         4
+#define MAX_NUM_TAPS      32
+#define MAX_BLOCK_SIZE    48
+#define MAX_SAMPLE_SIZE   4
+/* The kernels read every input sample as a 32-bit word, the last one reads past the end of the block. */
+#define SRC_PADDING       4
+
+/* Number of consecutive blocks filtered per case. */
+#define BLOCK_COUNT 4
+/* Sum of the absolute values of the coefficients, in 1.15 format, kept below 1.0 so no output saturates. */
+#define COEFF_SUM_MAX_Q15 29491
+#define RANDOM_SEED       0x12345678U
+
+#define FUSED_TOLERANCE 0
+#define Q15_TOLERANCE   1
+
+/* MACROS *********************************************************************/
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+
+/* TYPES **********************************************************************/
+/** @brief Filter configuration of a test case.
+ */
+typedef struct fir_check_case {
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! Decimation or interpolation factor. */
+    uint8_t ratio;
+    /*! Number of filter taps. */
+    uint16_t num_taps;
+    /*! Number of input frames per block. */
+    uint32_t block_size;
+} fir_check_case_t;
+
+/* PRIVATE GLOBALS ************************************************************/
+static const fir_sample_format_t format_16bits = {FIR_16BITS, FIR_2_BYTES, FIR_MASK_16BITS, FIR_BITSHIFT_16BITS};
+static const fir_sample_format_t format_24bits = {FIR_24BITS, FIR_4_BYTES, FIR_MASK_24BITS, FIR_BITSHIFT_24BITS};
+
+/* Tap counts that are not a multiple of 2 or 4 exercise the tail of the unrolled loops. */
+static const fir_check_case_t decimate_cases[] = {
+    {1, 2, 16, 32},
+    {2, 3, 31, 24},
+    {3, 2, 32, 16},
+    {4, 4, 7, 48},
+};
+/* Block sizes that are not a multiple of 4 exercise the tail of the reference interpolator. */
+static const fir_check_case_t interpolate_cases[] = {
+    {1, 2, 16, 12},
+    {2, 3, 30, 7},
+    {3, 2, 6, 5},
+    {4, 4, 32, 16},
+};
+
+static uint32_t random_state = RANDOM_SEED;
+
+static int32_t coeffs_q31[MAX_NUM_TAPS];
+static int16_t coeffs_q15[MAX_NUM_TAPS];
+static int16_t phase_coeffs_q15[MAX_NUM_TAPS];
+
+static int32_t reference_state[MAX_CHANNEL_COUNT][MAX_NUM_TAPS + MAX_BLOCK_SIZE - 1];
+static int32_t fused_state[FIR_MULTI_STATE_SIZE(MAX_NUM_TAPS, MAX_BLOCK_SIZE, MAX_CHANNEL_COUNT)];
+static int16_t q15_state[FIR_MULTI_STATE_SIZE(MAX_NUM_TAPS, MAX_BLOCK_SIZE, MAX_CHANNEL_COUNT)];
+
+static uint8_t src[(MAX_CHANNEL_COUNT * MAX_BLOCK_SIZE * MAX_SAMPLE_SIZE) + SRC_PADDING];
+static uint8_t reference_dst[MAX_CHANNEL_COUNT * MAX_BLOCK_SIZE * MAX_RATIO * MAX_SAMPLE_SIZE];
+static uint8_t fused_dst[MAX_CHANNEL_COUNT * MAX_BLOCK_SIZE * MAX_RATIO * MAX_SAMPLE_SIZE];
+static uint8_t q15_dst[MAX_CHANNEL_COUNT * MAX_BLOCK_SIZE * MAX_RATIO * MAX_SAMPLE_SIZE];
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static bool check_decimate(const fir_check_case_t *test_case, const fir_sample_format_t *format);
+static bool check_interpolate(const fir_check_case_t *test_case, const fir_sample_format_t *format);
+static void generate_coeffs(uint16_t num_taps);
+static void generate_input(uint32_t sample_count, const fir_sample_format_t *format);
+static uint32_t compare_outputs(const char *name, const uint8_t *actual, uint32_t sample_count,
+                                const fir_sample_format_t *format, int32_t tolerance);
+static int32_t read_output(const uint8_t *buffer, uint32_t index, const fir_sample_format_t *format);
+static uint32_t get_random(void);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(void)
+{
+    bool passed = true;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(decimate_cases); i++) {
+        passed &= check_decimate(&decimate_cases[i], &format_16bits);
+        passed &= check_decimate(&decimate_cases[i], &format_24bits);
+    }
+    for (uint8_t i = 0; i < ARRAY_SIZE(interpolate_cases); i++) {
+        passed &= check_interpolate(&interpolate_cases[i], &format_16bits);
+        passed &= check_interpolate(&interpolate_cases[i], &format_24bits);
+    }
+
+    printf("%s\n", passed ? "PASSED" : "FAILED");
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Compare the fused decimators with the per-channel one.
+ *
+ *  @param[in] test_case  Filter configuration.
+ *  @param[in] format     Input and output sample format.
+ *  @retval true   The fused outputs match the reference.
+ *  @retval false  An output differs or an init function failed.
+ */
+static bool check_decimate(const fir_check_case_t *test_case, const fir_sample_format_t *format)
+{
+    fir_decimate_instance_t reference[MAX_CHANNEL_COUNT];
+    fir_decimate_multi_instance_t fused;
+    fir_decimate_q15_multi_instance_t q15;
+    const bool check_q15 = (format->bit_depth == FIR_16BITS);
+    const uint32_t output_count = (test_case->block_size / test_case->ratio) * test_case->channel_count;
+    filtering_functions_error_t err = FILTERING_FUNCTION_ERR_NONE;
+    uint32_t mismatch_count = 0;
+
+    generate_coeffs(test_case->num_taps);
+
+    for (uint8_t ch = 0; ch < test_case->channel_count; ch++) {
+        err |= fir_decimate_init(&reference[ch], test_case->num_taps, test_case->ratio, coeffs_q31,
+                                 reference_state[ch], test_case->block_size);
+        reference[ch].input_sample_format = *format;
+        reference[ch].output_sample_format = *format;
+    }
+    err |= fir_decimate_multi_init(&fused, test_case->num_taps, test_case->ratio, test_case->channel_count, coeffs_q31,
+                                   fused_state, test_case->block_size);
+    fused.input_sample_format = *format;
+    fused.output_sample_format = *format;
+    err |= fir_decimate_q15_multi_init(&q15, test_case->num_taps, test_case->ratio, test_case->channel_count,
+                                       coeffs_q15, q15_state, test_case->block_size);
+    q15.input_sample_format = *format;
+    q15.output_sample_format = *format;
+
+    printf("decimate    %u channels, ratio %u, %2u taps, block %2lu, %u-bit: ", test_case->channel_count,
+           test_case->ratio, test_case->num_taps, (unsigned long)test_case->block_size, format->bit_depth);
+    if (err != FILTERING_FUNCTION_ERR_NONE) {
+        printf("init FAILED\n");
+        return false;
+    }
+
+    for (uint8_t block = 0; block < BLOCK_COUNT; block++) {
+        generate_input(test_case->block_size * test_case->channel_count, format);
+        for (uint8_t ch = 0; ch < test_case->channel_count; ch++) {
+            fir_decimate(&reference[ch], src, reference_dst, test_case->block_size, ch, test_case->channel_count);
+        }
+        fir_decimate_multi(&fused, src, fused_dst, test_case->block_size);
+        mismatch_count += compare_outputs("fused", fused_dst, output_count, format, FUSED_TOLERANCE);
+        if (check_q15) {
+            fir_decimate_q15_multi(&q15, src, q15_dst, test_case->block_size);
+            mismatch_count += compare_outputs("q15", q15_dst, output_count, format, Q15_TOLERANCE);
+        }
+    }
+    printf("%s\n", (mismatch_count == 0) ? "ok" : "FAILED");
+
+    return (mismatch_count == 0);
+}
+
+/** @brief Compare the fused interpolators with the per-channel one.
+ *
+ *  @param[in] test_case  Filter configuration.
+ *  @param[in] format     Input and output sample format.
+ *  @retval true   The fused outputs match the reference.
+ *  @retval false  An output differs or an init function failed.
+ */
+static bool check_interpolate(const fir_check_case_t *test_case, const fir_sample_format_t *format)
+{
+    fir_interpolate_instance_t reference[MAX_CHANNEL_COUNT];
+    fir_interpolate_multi_instance_t fused;
+    fir_interpolate_q15_multi_instance_t q15;
+    const bool check_q15 = (format->bit_depth == FIR_16BITS);
+    const uint32_t output_count = test_case->block_size * test_case->ratio * test_case->channel_count;
+    filtering_functions_error_t err = FILTERING_FUNCTION_ERR_NONE;
+    uint32_t mismatch_count = 0;
+
+    generate_coeffs(test_case->num_taps);
+
+    for (uint8_t ch = 0; ch < test_case->channel_count; ch++) {
+        err |= fir_interpolate_init(&reference[ch], test_case->ratio, test_case->num_taps, coeffs_q31,
+                                    reference_state[ch], test_case->block_size);
+        reference[ch].input_sample_format = *format;
+        reference[ch].output_sample_format = *format;
+    }
+    err |= fir_interpolate_multi_init(&fused, test_case->ratio, test_case->num_taps, test_case->channel_count,
+                                      coeffs_q31, fused_state, test_case->block_size);
+    fused.input_sample_format = *format;
+    fused.output_sample_format = *format;
+    err |= fir_interpolate_q15_multi_init(&q15, test_case->ratio, test_case->num_taps, test_case->channel_count,
+                                          coeffs_q15, phase_coeffs_q15, q15_state, test_case->block_size);
+    q15.input_sample_format = *format;
+    q15.output_sample_format = *format;
+
+    printf("interpolate %u channels, ratio %u, %2u taps, block %2lu, %u-bit: ", test_case->channel_count,
+           test_case->ratio, test_case->num_taps, (unsigned long)test_case->block_size, format->bit_depth);
+    if (err != FILTERING_FUNCTION_ERR_NONE) {
+        printf("init FAILED\n");
+        return false;
+    }
+
+    for (uint8_t block = 0; block < BLOCK_COUNT; block++) {
+        generate_input(test_case->block_size * test_case->channel_count, format);
+        for (uint8_t ch = 0; ch < test_case->channel_count; ch++) {
+            fir_interpolate(&reference[ch], src, reference_dst, test_case->block_size, ch, test_case->channel_count);
+        }
+        fir_interpolate_multi(&fused, src, fused_dst, test_case->block_size);
+        mismatch_count += compare_outputs("fused", fused_dst, output_count, format, FUSED_TOLERANCE);
+        if (check_q15) {
+            fir_interpolate_q15_multi(&q15, src, q15_dst, test_case->block_size);
+            mismatch_count += compare_outputs("q15", q15_dst, output_count, format, Q15_TOLERANCE);
+        }
+    }
+    printf("%s\n", (mismatch_count == 0) ? "ok" : "FAILED");
+
+    return (mismatch_count == 0);
+}
+
+/** @brief Draw the coefficients of a test case in 1.15 format and widen them to 1.31.
+ *
+ *  @param[in] num_taps  Number of filter taps.
+ */
+static void generate_coeffs(uint16_t num_taps)
+{
+    const int32_t limit = COEFF_SUM_MAX_Q15 / num_taps;
+
+    for (uint16_t i = 0; i < num_taps; i++) {
+        coeffs_q31[i] = (int32_t)((get_random() % (uint32_t)((2 * limit) + 1)) - (uint32_t)limit) * (1 << 16);
+    }
+    fir_coeffs_q31_to_q15(coeffs_q31, coeffs_q15, num_taps);
+}
+
+/** @brief Fill the source buffer with full scale pseudo-random samples.
+ *
+ *  @param[in] sample_count  Number of samples, all channels included.
+ *  @param[in] format        Sample format.
+ */
+static void generate_input(uint32_t sample_count, const fir_sample_format_t *format)
+{
+    const uint8_t unused_bits = 32 - format->bit_depth;
+    int32_t sample = 0;
+
+    for (uint32_t i = 0; i < sample_count; i++) {
+        /* Sign extend the drawn value like a sample of the given bit depth. */
+        sample = (int32_t)(get_random() << unused_bits) >> unused_bits;
+        memcpy(&src[i * format->sample_size_byte], &sample, format->sample_size_byte);
+    }
+}
+
+/** @brief Compare a block of outputs with the reference outputs.
+ *
+ *  @param[in] name          Name of the kernel, printed on a mismatch.
+ *  @param[in] actual        Outputs of the kernel.
+ *  @param[in] sample_count  Number of outputs, all channels included.
+ *  @param[in] format        Output sample format.
+ *  @param[in] tolerance     Largest difference allowed, in LSB.
+ *  @return Number of outputs differing by more than the tolerance.
+ */
+static uint32_t compare_outputs(const char *name, const uint8_t *actual, uint32_t sample_count,
+                                const fir_sample_format_t *format, int32_t tolerance)
+{
+    uint32_t mismatch_count = 0;
+    int32_t expected_sample = 0;
+    int32_t actual_sample = 0;
+
+    for (uint32_t i = 0; i < sample_count; i++) {
+        expected_sample = read_output(reference_dst, i, format);
+        actual_sample = read_output(actual, i, format);
+        if (abs(actual_sample - expected_sample) > tolerance) {
+            if (mismatch_count == 0) {
+                printf("%s output %lu is %ld instead of %ld, ", name, (unsigned long)i, (long)actual_sample,
+                       (long)expected_sample);
+            }
+            mismatch_count++;
+        }
+    }
+
+    return mismatch_count;
+}
+
+/** @brief Read and sign extend an output sample.
+ *
+ *  @param[in] buffer  Output buffer.
+ *  @param[in] index   Index of the sample, all channels included.
+ *  @param[in] format  Output sample format.
+ *  @return Output sample.
+ */
+static int32_t read_output(const uint8_t *buffer, uint32_t index, const fir_sample_format_t *format)
+{
+    const uint8_t unused_bits = 32 - format->bit_depth;
+    uint32_t sample = 0;
+
+    memcpy(&sample, &buffer[index * format->sample_size_byte], format->sample_size_byte);
+
+    return (int32_t)(sample << unused_bits) >> unused_bits;
+}
+
+/** @brief Get the next value of a xorshift pseudo-random sequence.
+ *
+ *  @return Pseudo-random value.
+ */
+static uint32_t get_random(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state;
+}
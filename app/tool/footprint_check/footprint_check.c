@@ -0,0 +1,494 @@
+/** @file  footprint_check.c
+ *  @brief This tool checks the SWC and SAC memory footprint macros against the actual memory pool usage.
+ *
+ *  Every footprint macro of swc_footprint.h and sac_footprint.h is compared to the number of bytes the matching
+ *  initialization call takes from the memory pool, read with swc_get_allocated_bytes() and sac_get_allocated_bytes()
+ *  before and after the call. The wireless core runs on the simulator facade backend bound to a port without a
+ *  transceiver, the radio being initialized without reset so that its absence is not reported.
+ *
+ *  Usage: footprint_check_host
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sac_api.h"
+#include "sac_cdc_pll.h"
+#include "sac_footprint.h"
+#include "sim_port.h"
+#include "swc_api.h"
+#include "swc_footprint.h"
+
+/* CONSTANTS ******************************************************************/
+#define SWC_POOL_SIZE 16384
+#define SAC_POOL_SIZE 16384
+
+#define TICK_FREQUENCY_HZ    1000000
+#define MS_PER_SECOND        1000
+#define TIMESLOT_DURATION_US 500
+#define QUEUE_SIZE           4
+#define MAX_PAYLOAD_SIZE     40
+#define FALLBACK_MODE_COUNT  2
+
+#define SAC_PAYLOAD_SIZE    120
+#define SAC_QUEUE_SIZE      3
+#define SAC_CHANNEL_COUNT   2
+#define SAC_MIXER_INPUTS    2
+#define SAC_MIXER_BIT_DEPTH 16
+
+#define CDC_PLL_FRACN_DEFAULT 4000
+#define CDC_PLL_FRACN_MIN     3000
+#define CDC_PLL_FRACN_MAX     5000
+/* Consumer queue extra set by the PLL based CDC. */
+#define CDC_PLL_EXTRA_QUEUE_SIZE 3
+
+/* MACROS *********************************************************************/
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+
+/* PRIVATE GLOBALS ************************************************************/
+static uint16_t fail_count;
+static uint64_t tick;
+
+/* ** Wireless Core ** */
+static uint8_t swc_memory_pool[SWC_POOL_SIZE];
+static const uint32_t timeslot_us[] = {TIMESLOT_DURATION_US, TIMESLOT_DURATION_US, TIMESLOT_DURATION_US};
+static const uint32_t channel_sequence[] = {0, 1, 2, 3, 4};
+static const uint32_t channel_frequency[] = {163, 171, 179, 187, 195};
+static int32_t tx_timeslots[] = {MAIN_TIMESLOT(0), MAIN_TIMESLOT(2)};
+static int32_t rx_timeslots[] = {MAIN_TIMESLOT(1)};
+static int32_t auto_timeslots[] = {AUTO_TIMESLOT(1)};
+static uint8_t fallback_thresholds[FALLBACK_MODE_COUNT] = {MAX_PAYLOAD_SIZE, MAX_PAYLOAD_SIZE / 2};
+static uint8_t fallback_cca_try_count[FALLBACK_MODE_COUNT] = {1, 2};
+
+/* ** Audio Core ** */
+static uint8_t sac_memory_pool[SAC_POOL_SIZE];
+static uint32_t cdc_pll_fracn = CDC_PLL_FRACN_DEFAULT;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void check_swc(void);
+static void check_sac(void);
+static uint32_t swc_pool_usage(void);
+static void add_channels(swc_connection_t *conn, swc_error_t *err);
+static void check(const char *name, uint32_t measured, uint32_t expected);
+static void port_no_op(void *ctx);
+static void port_spi_transfer(void *ctx, const uint8_t *tx_data, uint8_t *rx_data, uint16_t size, bool blocking);
+static bool port_false(void *ctx);
+static void port_set_callback(void *ctx, void (*callback)(void));
+static void port_enable_irq(void *ctx, bool enable);
+static uint64_t port_get_tick(void *ctx);
+static void context_switch_trigger(void);
+static void conn_callback(void *conn, void *arg);
+static uint16_t ep_action(void *instance, uint8_t *samples, uint16_t size);
+static void ep_no_op(void *instance);
+static void cdc_pll_set_fracn(uint32_t fracn);
+static uint32_t cdc_pll_get_fracn(void);
+
+/* The port binding function of the facade backend is looked up by name when the simulator loads a node. */
+void sim_node_bind(const sim_port_t *port);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(void)
+{
+    check_swc();
+    check_sac();
+
+    if (fail_count != 0) {
+        printf("FAILED: %u footprint mismatches\n", (unsigned int)fail_count);
+        return EXIT_FAILURE;
+    }
+    printf("PASSED\n");
+
+    return EXIT_SUCCESS;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Check the Wireless Core footprint macros.
+ *
+ *  The node holds a TX main connection, a RX main connection and a TX auto-reply connection on the RX time slot.
+ */
+static void check_swc(void)
+{
+    static const sim_port_t port = {
+        .spi_begin = port_no_op,
+        .spi_end = port_no_op,
+        .spi_transfer = port_spi_transfer,
+        .spi_is_busy = port_false,
+        .read_irq_pin = port_false,
+        .set_radio_irq_callback = port_set_callback,
+        .set_spi_callback = port_set_callback,
+        .enable_radio_irq = port_enable_irq,
+        .enable_spi_irq = port_enable_irq,
+        .context_switch = port_no_op,
+        .get_tick = port_get_tick,
+        .tick_frequency_hz = TICK_FREQUENCY_HZ,
+    };
+    swc_error_t err = SWC_ERR_NONE;
+    swc_connection_t *tx_conn = NULL;
+    swc_connection_t *rx_conn = NULL;
+    swc_connection_t *auto_conn = NULL;
+    uint32_t before = 0;
+
+    sim_node_bind(&port);
+
+    swc_cfg_t core_cfg = {
+        .timeslot_sequence = timeslot_us,
+        .timeslot_sequence_length = ARRAY_SIZE(timeslot_us),
+        .channel_sequence = channel_sequence,
+        .channel_sequence_length = ARRAY_SIZE(channel_sequence),
+        .concurrency_mode = SWC_CONCURRENCY_MODE_HIGH_PERFORMANCE,
+        .memory_pool = swc_memory_pool,
+        .memory_pool_size = SWC_POOL_SIZE,
+    };
+    swc_node_cfg_t node_cfg = {
+        .role = SWC_ROLE_COORDINATOR,
+        .pan_id = 0xABC,
+        .coordinator_address = 0x01,
+        .local_address = 0x01,
+    };
+    swc_connection_cfg_t tx_conn_cfg = {
+        .name = "TX Connection",
+        .source_address = 0x01,
+        .destination_address = 0x02,
+        .max_payload_size = MAX_PAYLOAD_SIZE,
+        .queue_size = QUEUE_SIZE,
+        .timeslot_id = tx_timeslots,
+        .timeslot_count = ARRAY_SIZE(tx_timeslots),
+    };
+    swc_connection_cfg_t rx_conn_cfg = {
+        .name = "RX Connection",
+        .source_address = 0x02,
+        .destination_address = 0x01,
+        .max_payload_size = MAX_PAYLOAD_SIZE,
+        .queue_size = QUEUE_SIZE,
+        .timeslot_id = rx_timeslots,
+        .timeslot_count = ARRAY_SIZE(rx_timeslots),
+    };
+    swc_connection_cfg_t auto_conn_cfg = {
+        .name = "Auto",
+        .source_address = 0x01,
+        .destination_address = 0x02,
+        .max_payload_size = MAX_PAYLOAD_SIZE / 2,
+        .queue_size = QUEUE_SIZE,
+        .timeslot_id = auto_timeslots,
+        .timeslot_count = ARRAY_SIZE(auto_timeslots),
+    };
+    swc_connection_fallback_cfg_t fallback_cfg = {
+        .enabled = true,
+        .fallback_mode_count = FALLBACK_MODE_COUNT,
+        .thresholds = fallback_thresholds,
+        .cca_try_count = fallback_cca_try_count,
+    };
+
+    swc_init(core_cfg, node_cfg, context_switch_trigger, &err);
+    check("SWC_FOOTPRINT_NODE", swc_pool_usage(),
+          SWC_FOOTPRINT_NODE(ARRAY_SIZE(timeslot_us), ARRAY_SIZE(channel_sequence)));
+    if (err != SWC_ERR_NONE) {
+        printf("swc_init failed with error %d\n", (int)err);
+        fail_count++;
+        return;
+    }
+
+    /* Without reset, the transceiver is not probed. */
+    before = swc_pool_usage();
+    swc_radio_module_init(SWC_RADIO_ID_1, false, &err);
+    check("SWC_FOOTPRINT_RADIO", swc_pool_usage() - before, SWC_FOOTPRINT_RADIO(false));
+
+    before = swc_pool_usage();
+    tx_conn = swc_connection_init(tx_conn_cfg, &err);
+    check("SWC_FOOTPRINT_CONNECTION main TX", swc_pool_usage() - before,
+          SWC_FOOTPRINT_CONNECTION(strlen(tx_conn_cfg.name), ARRAY_SIZE(tx_timeslots), ARRAY_SIZE(channel_sequence),
+                                   1));
+
+    before = swc_pool_usage();
+    rx_conn = swc_connection_init(rx_conn_cfg, &err);
+    check("SWC_FOOTPRINT_CONNECTION main RX", swc_pool_usage() - before,
+          SWC_FOOTPRINT_CONNECTION(strlen(rx_conn_cfg.name), ARRAY_SIZE(rx_timeslots), ARRAY_SIZE(channel_sequence),
+                                   1));
+
+    before = swc_pool_usage();
+    auto_conn = swc_connection_init(auto_conn_cfg, &err);
+    check("SWC_FOOTPRINT_CONNECTION auto-reply", swc_pool_usage() - before,
+          SWC_FOOTPRINT_CONNECTION(strlen(auto_conn_cfg.name), ARRAY_SIZE(auto_timeslots),
+                                   ARRAY_SIZE(channel_sequence), 0));
+    if ((tx_conn == NULL) || (rx_conn == NULL) || (auto_conn == NULL)) {
+        printf("swc_connection_init failed with error %d\n", (int)err);
+        fail_count++;
+        return;
+    }
+
+    before = swc_pool_usage();
+    swc_connection_set_fallback_cfg(tx_conn, &fallback_cfg, &err);
+    check("SWC_FOOTPRINT_FALLBACK TX", swc_pool_usage() - before,
+          SWC_FOOTPRINT_FALLBACK(FALLBACK_MODE_COUNT, true, ARRAY_SIZE(channel_sequence), 1));
+
+    before = swc_pool_usage();
+    swc_connection_set_fallback_cfg(rx_conn, &fallback_cfg, &err);
+    check("SWC_FOOTPRINT_FALLBACK RX", swc_pool_usage() - before,
+          SWC_FOOTPRINT_FALLBACK(FALLBACK_MODE_COUNT, true, ARRAY_SIZE(channel_sequence), 0));
+
+    before = swc_pool_usage();
+    swc_connection_set_throttling(tx_conn, &err);
+    check("SWC_FOOTPRINT_THROTTLING", swc_pool_usage() - before, SWC_FOOTPRINT_THROTTLING);
+
+    before = swc_pool_usage();
+    swc_connection_set_adaptive_cca(tx_conn, true, &err);
+    check("SWC_FOOTPRINT_ADAPTIVE_CCA", swc_pool_usage() - before,
+          SWC_FOOTPRINT_ADAPTIVE_CCA(ARRAY_SIZE(channel_sequence)));
+
+    before = swc_pool_usage();
+    swc_connection_set_fragmentation(tx_conn, &err);
+    check("SWC_FOOTPRINT_FRAGMENTATION", swc_pool_usage() - before, SWC_FOOTPRINT_FRAGMENTATION(QUEUE_SIZE));
+
+    add_channels(tx_conn, &err);
+    if (err == SWC_ERR_NONE) {
+        add_channels(rx_conn, &err);
+    }
+    if (err != SWC_ERR_NONE) {
+        printf("swc_connection_add_channel failed with error %d\n", (int)err);
+        fail_count++;
+        return;
+    }
+    swc_connection_set_tx_success_callback(tx_conn, conn_callback, NULL, &err);
+    swc_connection_set_tx_fail_callback(tx_conn, conn_callback, NULL, &err);
+    swc_connection_set_rx_success_callback(rx_conn, conn_callback, NULL, &err);
+
+    before = swc_pool_usage();
+    swc_setup(&err);
+    check("swc_setup", swc_pool_usage() - before,
+          SWC_FOOTPRINT_TX_DATA(QUEUE_SIZE, tx_conn->wps_conn_handle->cfg.header_size, MAX_PAYLOAD_SIZE) +
+              SWC_FOOTPRINT_RX_DATA(QUEUE_SIZE, MAX_PAYLOAD_SIZE) +
+              SWC_FOOTPRINT_TX_DATA(QUEUE_SIZE, auto_conn->wps_conn_handle->cfg.header_size, MAX_PAYLOAD_SIZE / 2) +
+              SWC_FOOTPRINT_XLAYER_QUEUES(2 * QUEUE_SIZE, QUEUE_SIZE,
+                                          tx_conn->wps_conn_handle->cfg.header_size >
+                                                  rx_conn->wps_conn_handle->cfg.header_size ?
+                                              tx_conn->wps_conn_handle->cfg.header_size :
+                                              rx_conn->wps_conn_handle->cfg.header_size) +
+              SWC_FOOTPRINT_CALLBACK_QUEUE(3 * QUEUE_SIZE));
+    if (err != SWC_ERR_NONE) {
+        printf("swc_setup failed with error %d\n", (int)err);
+        fail_count++;
+    }
+}
+
+/** @brief Check the Audio Core footprint macros.
+ *
+ *  The pipeline runs the PLL based clock drift compensation between a producer and a consumer.
+ */
+static void check_sac(void)
+{
+    sac_status_t status = SAC_OK;
+    sac_endpoint_t *producer = NULL;
+    sac_endpoint_t *consumer = NULL;
+    sac_processing_t *process = NULL;
+    sac_pipeline_t *pipeline = NULL;
+    uint32_t before = 0;
+
+    sac_cfg_t core_cfg = {
+        .memory_pool = sac_memory_pool,
+        .memory_pool_size = SAC_POOL_SIZE,
+    };
+    sac_endpoint_interface_t ep_iface = {
+        .action = ep_action,
+        .start = ep_no_op,
+        .stop = ep_no_op,
+    };
+    sac_endpoint_cfg_t ep_cfg = {
+        .use_encapsulation = false,
+        .delayed_action = false,
+        .channel_count = SAC_CHANNEL_COUNT,
+        .audio_payload_size = SAC_PAYLOAD_SIZE,
+        .queue_size = SAC_QUEUE_SIZE,
+    };
+    sac_pipeline_cfg_t pipeline_cfg = {0};
+    sac_mixer_module_cfg_t mixer_cfg = {
+        .nb_of_inputs = SAC_MIXER_INPUTS,
+        .payload_size = SAC_PAYLOAD_SIZE,
+        .bit_depth = SAC_MIXER_BIT_DEPTH,
+    };
+    static sac_cdc_pll_instance_t cdc_pll_instance = {
+        .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .cdc_pll_hal = {
+            .set_fracn = cdc_pll_set_fracn,
+            .get_fracn = cdc_pll_get_fracn,
+            .fracn_min_value = CDC_PLL_FRACN_MIN,
+            .fracn_max_value = CDC_PLL_FRACN_MAX,
+            .fracn_default_value = CDC_PLL_FRACN_DEFAULT,
+        },
+    };
+    sac_processing_interface_t cdc_pll_iface = {
+        .init = sac_cdc_pll_init,
+        .ctrl = sac_cdc_pll_ctrl,
+        .process = sac_cdc_pll_process,
+    };
+
+    sac_init(core_cfg, &status);
+    check("sac_init", sac_get_allocated_bytes(&status), 0);
+
+    before = sac_get_allocated_bytes(&status);
+    producer = sac_endpoint_init(NULL, "Producer", ep_iface, ep_cfg, &status);
+    consumer = sac_endpoint_init(NULL, "Consumer", ep_iface, ep_cfg, &status);
+    check("SAC_FOOTPRINT_ENDPOINT", sac_get_allocated_bytes(&status) - before, 2 * SAC_FOOTPRINT_ENDPOINT);
+
+    before = sac_get_allocated_bytes(&status);
+    process = sac_processing_stage_init(&cdc_pll_instance, "CDC PLL", cdc_pll_iface, &status);
+    check("SAC_FOOTPRINT_PROCESSING", sac_get_allocated_bytes(&status) - before, SAC_FOOTPRINT_PROCESSING);
+
+    /* The stages are initialized by the pipeline setup, which allocates the queues too. */
+    before = sac_get_allocated_bytes(&status);
+    pipeline = sac_pipeline_init("Pipeline", producer, pipeline_cfg, consumer, &status);
+    sac_pipeline_add_processing(pipeline, process, &status);
+    sac_pipeline_setup(pipeline, &status);
+    check("SAC_FOOTPRINT_PIPELINE and queues", sac_get_allocated_bytes(&status) - before,
+          SAC_FOOTPRINT_PIPELINE(SAC_PAYLOAD_SIZE) +
+              SAC_FOOTPRINT_PRODUCER_QUEUES(1, SAC_PAYLOAD_SIZE, SAC_QUEUE_SIZE) +
+              SAC_FOOTPRINT_CONSUMER_QUEUES(1, SAC_PAYLOAD_SIZE, SAC_QUEUE_SIZE + CDC_PLL_EXTRA_QUEUE_SIZE, false) +
+              SAC_CDC_PLL_FOOTPRINT);
+    if (status != SAC_OK) {
+        printf("sac_pipeline_setup failed with status %d\n", (int)status);
+        fail_count++;
+        return;
+    }
+
+    before = sac_get_allocated_bytes(&status);
+    sac_mixer_init(mixer_cfg, &status);
+    check("SAC_FOOTPRINT_MIXER", sac_get_allocated_bytes(&status) - before, SAC_FOOTPRINT_MIXER);
+}
+
+/** @brief Get the Wireless Core memory pool usage, rounded up to the block alignment.
+ *
+ *  The pool pads a block to align it, the padding being counted with the next allocation. Rounding the end of the
+ *  used area up attributes that padding to the block that needs it, as the footprint macros do.
+ *
+ *  @return Number of pool bytes used.
+ */
+static uint32_t swc_pool_usage(void)
+{
+    uintptr_t end = (uintptr_t)swc_memory_pool + swc_get_allocated_bytes();
+
+    return (uint32_t)(MEM_POOL_BLOCK_SIZE(end) - MEM_POOL_BLOCK_SIZE((uintptr_t)swc_memory_pool));
+}
+
+/** @brief Add every channel of the sequence to a main connection.
+ *
+ *  @param[in]  conn  Connection.
+ *  @param[out] err   Wireless Core error code.
+ */
+static void add_channels(swc_connection_t *conn, swc_error_t *err)
+{
+    swc_channel_cfg_t channel_cfg = {
+        .tx_pulse_count = 1,
+        .tx_pulse_width = 6,
+        .tx_pulse_gain = 0,
+        .rx_pulse_count = 1,
+    };
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(channel_frequency); i++) {
+        channel_cfg.frequency = channel_frequency[i];
+        swc_connection_add_channel(conn, channel_cfg, err);
+        if (*err != SWC_ERR_NONE) {
+            return;
+        }
+    }
+}
+
+/** @brief Compare a measured footprint to the value of its macro.
+ *
+ *  @param[in] name      Name of the check.
+ *  @param[in] measured  Number of bytes taken from the pool.
+ *  @param[in] expected  Value of the footprint macro.
+ */
+static void check(const char *name, uint32_t measured, uint32_t expected)
+{
+    bool match = (measured == expected);
+
+    printf("%-40s measured %6lu expected %6lu %s\n", name, (unsigned long)measured, (unsigned long)expected,
+           match ? "ok" : "MISMATCH");
+    if (!match) {
+        fail_count++;
+    }
+}
+
+/* ** Simulator Port ** */
+static void port_no_op(void *ctx)
+{
+    (void)ctx;
+}
+
+static void port_spi_transfer(void *ctx, const uint8_t *tx_data, uint8_t *rx_data, uint16_t size, bool blocking)
+{
+    (void)ctx;
+    (void)tx_data;
+    (void)blocking;
+
+    /* No transceiver drives the bus. */
+    memset(rx_data, 0, size);
+}
+
+static bool port_false(void *ctx)
+{
+    (void)ctx;
+
+    return false;
+}
+
+static void port_set_callback(void *ctx, void (*callback)(void))
+{
+    (void)ctx;
+    (void)callback;
+}
+
+static void port_enable_irq(void *ctx, bool enable)
+{
+    (void)ctx;
+    (void)enable;
+}
+
+static uint64_t port_get_tick(void *ctx)
+{
+    (void)ctx;
+
+    /* Time advances by one millisecond per read, so the power up and busy wait delays elapse. */
+    tick += TICK_FREQUENCY_HZ / MS_PER_SECOND;
+
+    return tick;
+}
+
+static void context_switch_trigger(void)
+{
+}
+
+static void conn_callback(void *conn, void *arg)
+{
+    (void)conn;
+    (void)arg;
+}
+
+/* ** Audio Core Stubs ** */
+static uint16_t ep_action(void *instance, uint8_t *samples, uint16_t size)
+{
+    (void)instance;
+    (void)samples;
+
+    return size;
+}
+
+static void ep_no_op(void *instance)
+{
+    (void)instance;
+}
+
+static void cdc_pll_set_fracn(uint32_t fracn)
+{
+    cdc_pll_fracn = fracn;
+}
+
+static uint32_t cdc_pll_get_fracn(void)
+{
+    return cdc_pll_fracn;
+}
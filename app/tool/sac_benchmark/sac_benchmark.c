@@ -0,0 +1,334 @@
+/** @file  sac_benchmark.c
+ *  @brief SPARK Audio Core processing stage benchmark.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "sac_benchmark.h"
+#include "sac_dummy_endpoint.h"
+
+/* CONSTANTS ******************************************************************/
+#define SAC_BENCHMARK_MEM_POOL_SIZE 16384
+/* Number of packets the consumer endpoint can hold. */
+#define CONSUMER_QUEUE_SIZE 4
+/* Number of timestamp reads used to measure the timestamp overhead. */
+#define OVERHEAD_SAMPLE_COUNT 32
+#define LOG_LINE_BUFFER_SIZE  256
+#define NS_PER_SECOND         1000000000.0
+#define PERCENT               100.0
+/* Number of ticks converted at once to get the duration of a tick without losing precision. */
+#define TICKS_TO_NS_SCALE 1000000
+/* Number of distinct values of the test tone. */
+#define TONE_PERIOD 48
+/* Peak value of the test tone relative to the full scale, as a power of two. */
+#define TONE_HEADROOM_BITS 2
+
+/* PRIVATE GLOBALS ************************************************************/
+static uint8_t sac_memory_pool[SAC_BENCHMARK_MEM_POOL_SIZE];
+/* Processing stages access the samples as 32-bit words. */
+static uint32_t input_buffer[SAC_BENCHMARK_MAX_INPUT_SIZE / sizeof(uint32_t)];
+static uint32_t output_buffer[SAC_BENCHMARK_MAX_OUTPUT_SIZE / sizeof(uint32_t)];
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static sac_pipeline_t *setup_pipeline(const sac_benchmark_case_t *bench_case, sac_status_t *status);
+static void fill_test_tone(const sac_benchmark_case_t *bench_case, uint8_t *data, uint16_t size);
+static uint32_t measure_timestamp_overhead(const sac_benchmark_platform_t *platform);
+static void write_header(const sac_benchmark_platform_t *platform, uint32_t iteration_count);
+static void write_result(const sac_benchmark_platform_t *platform, const sac_benchmark_case_t *bench_case,
+                         const sac_benchmark_result_t *result);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void sac_benchmark_run_case(const sac_benchmark_platform_t *platform, const sac_benchmark_case_t *bench_case,
+                            uint32_t iteration_count, sac_benchmark_result_t *result)
+{
+    sac_pipeline_t *pipeline = NULL;
+    sac_header_t header = {0};
+    uint32_t overhead = 0;
+    uint32_t start = 0;
+    uint32_t elapsed = 0;
+
+    memset(result, 0, sizeof(sac_benchmark_result_t));
+    result->min_ticks = UINT32_MAX;
+
+    if ((bench_case->input_size > SAC_BENCHMARK_MAX_INPUT_SIZE) ||
+        (bench_case->output_size > SAC_BENCHMARK_MAX_OUTPUT_SIZE)) {
+        result->status = SAC_ERR_INVALID_PACKET_SIZE;
+        return;
+    }
+
+    pipeline = setup_pipeline(bench_case, &result->status);
+    if (result->status < SAC_OK) {
+        return;
+    }
+
+    if (bench_case->fill_input != NULL) {
+        bench_case->fill_input(bench_case, (uint8_t *)input_buffer, bench_case->input_size);
+    } else {
+        fill_test_tone(bench_case, (uint8_t *)input_buffer, bench_case->input_size);
+    }
+    overhead = measure_timestamp_overhead(platform);
+
+    for (uint32_t i = 0; i < (SAC_BENCHMARK_WARMUP_COUNT + iteration_count); i++) {
+        memset(&header, 0, sizeof(header));
+        header.payload_size = (uint8_t)bench_case->input_size;
+
+        start = platform->get_timestamp();
+        result->output_size = bench_case->iface.process(bench_case->instance, pipeline, &header,
+                                                        (uint8_t *)input_buffer, bench_case->input_size,
+                                                        (uint8_t *)output_buffer, &result->status);
+        elapsed = platform->get_timestamp() - start;
+
+        if (result->status < SAC_OK) {
+            return;
+        }
+        if (result->output_size == 0) {
+            /* The stage left the packet untouched, the pipeline forwards the input packet as is. */
+            result->output_size = bench_case->input_size;
+        }
+        if (i < SAC_BENCHMARK_WARMUP_COUNT) {
+            continue;
+        }
+
+        elapsed = (elapsed > overhead) ? (elapsed - overhead) : 0;
+        if (elapsed < result->min_ticks) {
+            result->min_ticks = elapsed;
+        }
+        if (elapsed > result->max_ticks) {
+            result->max_ticks = elapsed;
+        }
+        result->total_ticks += elapsed;
+        result->iteration_count++;
+    }
+}
+
+uint16_t sac_benchmark_run(const sac_benchmark_platform_t *platform, uint32_t iteration_count,
+                           const char *stage_filter)
+{
+    const sac_benchmark_case_t *bench_case = NULL;
+    sac_benchmark_result_t result = {0};
+    char log_buffer[LOG_LINE_BUFFER_SIZE];
+    uint16_t case_count = 0;
+    uint16_t fail_count = 0;
+
+    bench_case = sac_benchmark_get_cases(&case_count);
+
+    write_header(platform, iteration_count);
+
+    for (uint16_t i = 0; i < case_count; i++, bench_case++) {
+        if ((stage_filter != NULL) && (strcmp(stage_filter, bench_case->stage) != 0)) {
+            continue;
+        }
+
+        sac_benchmark_run_case(platform, bench_case, iteration_count, &result);
+        if ((result.status < SAC_OK) || (result.iteration_count == 0)) {
+            snprintf(log_buffer, sizeof(log_buffer), "# %s,%s: failed with status %d\r\n", bench_case->stage,
+                     bench_case->variant, (int)result.status);
+            platform->write(log_buffer);
+            fail_count++;
+            continue;
+        }
+        write_result(platform, bench_case, &result);
+    }
+
+    return fail_count;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Create the Audio Core pipeline running the processing stage of a case.
+ *
+ *  The audio core is initialized again for every case so each one starts with the whole memory pool.
+ *
+ *  @param[in]  bench_case  Benchmark case.
+ *  @param[out] status      Status code.
+ *  @return Reference to the pipeline.
+ */
+static sac_pipeline_t *setup_pipeline(const sac_benchmark_case_t *bench_case, sac_status_t *status)
+{
+    sac_endpoint_t *producer = NULL;
+    sac_endpoint_t *consumer = NULL;
+    sac_pipeline_t *pipeline = NULL;
+    sac_processing_t *process = NULL;
+
+    sac_endpoint_interface_t producer_iface = {
+        .action = ep_dummy_produce,
+        .start = ep_dummy_start,
+        .stop = ep_dummy_stop,
+    };
+    sac_endpoint_interface_t consumer_iface = {
+        .action = ep_dummy_consume,
+        .start = ep_dummy_start,
+        .stop = ep_dummy_stop,
+    };
+    sac_cfg_t core_cfg = {
+        .memory_pool = sac_memory_pool,
+        .memory_pool_size = SAC_BENCHMARK_MEM_POOL_SIZE,
+    };
+    sac_endpoint_cfg_t producer_cfg = {
+        .use_encapsulation = false,
+        .delayed_action = false,
+        .channel_count = bench_case->channel_count,
+        .audio_payload_size = bench_case->input_size,
+        .queue_size = SAC_MIN_PRODUCER_QUEUE_SIZE,
+    };
+    sac_endpoint_cfg_t consumer_cfg = {
+        .use_encapsulation = false,
+        .delayed_action = false,
+        .channel_count = bench_case->channel_count,
+        .audio_payload_size = bench_case->output_size,
+        .queue_size = CONSUMER_QUEUE_SIZE,
+    };
+    sac_pipeline_cfg_t pipeline_cfg = {
+        .do_initial_buffering = false,
+    };
+
+    sac_init(core_cfg, status);
+    if (*status != SAC_OK) {
+        return NULL;
+    }
+
+    producer = sac_endpoint_init(NULL, "Benchmark producer", producer_iface, producer_cfg, status);
+    if (*status != SAC_OK) {
+        return NULL;
+    }
+    consumer = sac_endpoint_init(NULL, "Benchmark consumer", consumer_iface, consumer_cfg, status);
+    if (*status != SAC_OK) {
+        return NULL;
+    }
+    pipeline = sac_pipeline_init(bench_case->stage, producer, pipeline_cfg, consumer, status);
+    if (*status != SAC_OK) {
+        return NULL;
+    }
+    process = sac_processing_stage_init(bench_case->instance, bench_case->stage, bench_case->iface, status);
+    if (*status != SAC_OK) {
+        return NULL;
+    }
+    sac_pipeline_add_processing(pipeline, process, status);
+    if (*status != SAC_OK) {
+        return NULL;
+    }
+
+    if (bench_case->pre_setup != NULL) {
+        bench_case->pre_setup(bench_case, pipeline, status);
+        if (*status != SAC_OK) {
+            return NULL;
+        }
+    }
+    sac_pipeline_setup(pipeline, status);
+    if (*status != SAC_OK) {
+        return NULL;
+    }
+    if (bench_case->post_setup != NULL) {
+        bench_case->post_setup(bench_case, pipeline, status);
+        if (*status != SAC_OK) {
+            return NULL;
+        }
+    }
+
+    return pipeline;
+}
+
+/** @brief Fill a packet with a triangle test tone in the input sample format of a case.
+ *
+ *  The tone stays below full scale so gain and filter stages do not saturate.
+ *
+ *  @param[in]  bench_case  Benchmark case.
+ *  @param[out] data        Packet to fill.
+ *  @param[in]  size        Size of the packet in bytes.
+ */
+static void fill_test_tone(const sac_benchmark_case_t *bench_case, uint8_t *data, uint16_t size)
+{
+    const uint8_t bit_depth = bench_case->input_format.bit_depth;
+    const uint8_t sample_size = (bench_case->input_format.sample_encoding == SAC_SAMPLE_UNPACKED) ?
+                                    SAC_WORD_SIZE_BYTE :
+                                    (bit_depth / SAC_BYTE_SIZE_BITS);
+    const int32_t peak = (int32_t)(1UL << (bit_depth - 1 - TONE_HEADROOM_BITS));
+    const int32_t step = (4 * peak) / TONE_PERIOD;
+    int32_t sample = 0;
+    uint16_t phase = 0;
+
+    for (uint16_t i = 0; (i + sample_size) <= size; i += sample_size) {
+        /* Each channel of a frame gets the same phase. */
+        phase = (uint16_t)(((i / sample_size) / bench_case->channel_count) % TONE_PERIOD);
+        sample = (phase < (TONE_PERIOD / 2)) ? (-peak + (phase * step)) : (peak - ((phase - (TONE_PERIOD / 2)) * step));
+        for (uint8_t k = 0; k < sample_size; k++) {
+            data[i + k] = (uint8_t)((uint32_t)sample >> (k * SAC_BYTE_SIZE_BITS));
+        }
+    }
+}
+
+/** @brief Measure the number of ticks taken by two consecutive timestamp reads.
+ *
+ *  @param[in] platform  Platform services.
+ *  @return Smallest overhead measured in timestamp ticks.
+ */
+static uint32_t measure_timestamp_overhead(const sac_benchmark_platform_t *platform)
+{
+    uint32_t overhead = UINT32_MAX;
+    uint32_t start = 0;
+    uint32_t elapsed = 0;
+
+    for (uint8_t i = 0; i < OVERHEAD_SAMPLE_COUNT; i++) {
+        start = platform->get_timestamp();
+        elapsed = platform->get_timestamp() - start;
+        if (elapsed < overhead) {
+            overhead = elapsed;
+        }
+    }
+
+    return overhead;
+}
+
+/** @brief Write the comment and column header lines.
+ *
+ *  @param[in] platform         Platform services.
+ *  @param[in] iteration_count  Number of measured process calls per case.
+ */
+static void write_header(const sac_benchmark_platform_t *platform, uint32_t iteration_count)
+{
+    char log_buffer[LOG_LINE_BUFFER_SIZE];
+
+    snprintf(log_buffer, sizeof(log_buffer), "# sac_benchmark platform=%s iterations=%lu\r\n", platform->name,
+             (unsigned long)iteration_count);
+    platform->write(log_buffer);
+    platform->write("stage,variant,sample_rate_hz,bit_depth,encoding,channels,frames,input_bytes,output_bytes,"
+                    "iterations,min_ticks,avg_ticks,max_ticks,ticks_per_sample,ns_per_sample,bytes_per_s,"
+                    "load_percent\r\n");
+}
+
+/** @brief Write the result line of a case.
+ *
+ *  A sample is one channel of one frame. The load is the average processing time relative to the duration of the
+ *  packet at the sampling rate of the case.
+ *
+ *  @param[in] platform    Platform services.
+ *  @param[in] bench_case  Benchmark case.
+ *  @param[in] result      Measurement result.
+ */
+static void write_result(const sac_benchmark_platform_t *platform, const sac_benchmark_case_t *bench_case,
+                         const sac_benchmark_result_t *result)
+{
+    char log_buffer[LOG_LINE_BUFFER_SIZE];
+    const uint32_t sample_count = bench_case->frame_count * bench_case->channel_count;
+    const double avg_ticks = (double)result->total_ticks / result->iteration_count;
+    const double ns_per_tick = platform->ticks_to_ns(TICKS_TO_NS_SCALE) / TICKS_TO_NS_SCALE;
+    const double avg_ns = avg_ticks * ns_per_tick;
+    const double packet_ns = (NS_PER_SECOND * bench_case->frame_count) / bench_case->sample_rate_hz;
+    const double bytes_per_s = (avg_ns > 0) ? ((NS_PER_SECOND * bench_case->input_size) / avg_ns) : 0;
+
+    snprintf(log_buffer, sizeof(log_buffer), "%s,%s,%lu,%u,%s,%u,%u,%u,%u,%lu,%lu,%.1f,%lu,%.3f,%.3f,%.0f,%.3f\r\n",
+             bench_case->stage, bench_case->variant, (unsigned long)bench_case->sample_rate_hz,
+             (unsigned int)bench_case->input_format.bit_depth,
+             (bench_case->input_format.sample_encoding == SAC_SAMPLE_UNPACKED) ? "unpacked" : "packed",
+             (unsigned int)bench_case->channel_count, (unsigned int)bench_case->frame_count,
+             (unsigned int)bench_case->input_size, (unsigned int)result->output_size,
+             (unsigned long)result->iteration_count, (unsigned long)result->min_ticks, avg_ticks,
+             (unsigned long)result->max_ticks, avg_ticks / sample_count, avg_ns / sample_count, bytes_per_s,
+             (PERCENT * avg_ns) / packet_ns);
+    platform->write(log_buffer);
+}
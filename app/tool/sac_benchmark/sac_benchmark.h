@@ -0,0 +1,131 @@
+/** @file  sac_benchmark.h
+ *  @brief SPARK Audio Core processing stage benchmark.
+ *
+ *  Each benchmark case runs a single processing stage in a pipeline made of dummy endpoints and calls its process
+ *  function directly on a synthetic packet. The time source is provided by the platform so the same cases run on the
+ *  host, measured in nanoseconds, and on the target, measured in CPU cycles.
+ *
+ *  Results are written as CSV lines, one per case, preceded by a header line. Lines starting with '#' are comments.
+ *  The output of two runs can be compared with tools/sac_benchmark_compare.py to detect regressions.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SAC_BENCHMARK_H_
+#define SAC_BENCHMARK_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdint.h>
+#include "sac_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Largest packet given to a processing stage, in bytes. */
+#define SAC_BENCHMARK_MAX_INPUT_SIZE 512
+/*! Largest packet produced by a processing stage, in bytes. */
+#define SAC_BENCHMARK_MAX_OUTPUT_SIZE 1024
+/*! Number of process calls executed before measuring, to warm up caches and stage history. */
+#define SAC_BENCHMARK_WARMUP_COUNT 8
+
+/* TYPES **********************************************************************/
+typedef struct sac_benchmark_case sac_benchmark_case_t;
+
+/** @brief Platform specific services used by the benchmark.
+ */
+typedef struct sac_benchmark_platform {
+    /*! Name of the platform, written in the output. */
+    const char *name;
+    /*! Read a free running timestamp. Wrap around is supported as long as a process call is shorter than a period. */
+    uint32_t (*get_timestamp)(void);
+    /*! Convert a number of timestamp ticks to nanoseconds. */
+    double (*ticks_to_ns)(uint32_t ticks);
+    /*! Write a null terminated string to the output. */
+    void (*write)(const char *string);
+} sac_benchmark_platform_t;
+
+/** @brief Benchmark case.
+ */
+typedef struct sac_benchmark_case {
+    /*! Name of the processing stage. */
+    const char *stage;
+    /*! Short description of the stage configuration, unique for a given stage. */
+    const char *variant;
+    /*! Sampling rate of the stream, used to express the real time load. */
+    uint32_t sample_rate_hz;
+    /*! Format of the samples given to the stage. */
+    sac_sample_format_t input_format;
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! Number of samples per channel in one input packet. */
+    uint16_t frame_count;
+    /*! Size of one input packet in bytes. */
+    uint16_t input_size;
+    /*! Size of the consumer endpoint payload in bytes. */
+    uint16_t output_size;
+    /*! Processing stage interface. */
+    sac_processing_interface_t iface;
+    /*! Processing stage instance, configured by the case. */
+    void *instance;
+    /*! Optional function called before the pipeline setup to complete the instance configuration. */
+    void (*pre_setup)(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline, sac_status_t *status);
+    /*! Optional function called after the pipeline setup, once the stage is initialized. */
+    void (*post_setup)(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline, sac_status_t *status);
+    /*! Optional function filling the input packet. A test tone in the input format is used when NULL. */
+    void (*fill_input)(const sac_benchmark_case_t *bench_case, uint8_t *data, uint16_t size);
+} sac_benchmark_case_t;
+
+/** @brief Result of a benchmark case.
+ */
+typedef struct sac_benchmark_result {
+    /*! Number of measured process calls. */
+    uint32_t iteration_count;
+    /*! Shortest process call in timestamp ticks. */
+    uint32_t min_ticks;
+    /*! Longest process call in timestamp ticks. */
+    uint32_t max_ticks;
+    /*! Sum of all process calls in timestamp ticks. */
+    uint64_t total_ticks;
+    /*! Size of the last packet produced by the stage in bytes, the input size when the stage forwards it as is. */
+    uint16_t output_size;
+    /*! Status of the last process call. */
+    sac_status_t status;
+} sac_benchmark_result_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Get the list of benchmark cases.
+ *
+ *  @param[out] case_count  Number of cases in the list.
+ *  @return Pointer to the first case.
+ */
+const sac_benchmark_case_t *sac_benchmark_get_cases(uint16_t *case_count);
+
+/** @brief Run a single benchmark case.
+ *
+ *  @param[in]  platform         Platform services.
+ *  @param[in]  bench_case       Case to run.
+ *  @param[in]  iteration_count  Number of measured process calls.
+ *  @param[out] result           Measurement result.
+ */
+void sac_benchmark_run_case(const sac_benchmark_platform_t *platform, const sac_benchmark_case_t *bench_case,
+                            uint32_t iteration_count, sac_benchmark_result_t *result);
+
+/** @brief Run every benchmark case whose stage name matches the filter and write the results.
+ *
+ *  @param[in] platform         Platform services.
+ *  @param[in] iteration_count  Number of measured process calls per case.
+ *  @param[in] stage_filter     Name of the only stage to run, NULL to run all of them.
+ *  @return Number of cases that failed.
+ */
+uint16_t sac_benchmark_run(const sac_benchmark_platform_t *platform, uint32_t iteration_count,
+                           const char *stage_filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAC_BENCHMARK_H_ */
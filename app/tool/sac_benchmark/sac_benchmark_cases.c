@@ -0,0 +1,1127 @@
+/** @file  sac_benchmark_cases.c
+ *  @brief Benchmark cases of the SPARK Audio Core processing stages.
+ *
+ *  The cases use the sampling rates, bit depths and packet sizes of the audio examples: 48 kHz and 96 kHz stereo main
+ *  channels with 24-bit samples on 32-bit words from I2S, 32 kHz mono 16-bit back channels and their ADPCM compressed
+ *  version.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <string.h>
+#include "sac_benchmark.h"
+#include "sac_cdc.h"
+#include "sac_cdc_asrc.h"
+#include "sac_cdc_pll.h"
+#include "sac_compression.h"
+#include "sac_decoder.h"
+#include "sac_fallback.h"
+#include "sac_mixer_module.h"
+#include "sac_mute_on_underflow.h"
+#include "sac_mute_packet.h"
+#include "sac_packing.h"
+#include "sac_sample_accumulator.h"
+#include "sac_src_cmsis.h"
+#include "sac_volume.h"
+
+/* CONSTANTS ******************************************************************/
+#define SAMPLE_RATE_32K 32000
+#define SAMPLE_RATE_48K 48000
+#define SAMPLE_RATE_96K 96000
+
+/* Samples per channel in a packet. */
+#define FRAME_COUNT_32K 52
+#define FRAME_COUNT_48K 20
+#define FRAME_COUNT_96K 40
+/* Back channel packet upsampled from 32 kHz to 48 kHz. */
+#define FRAME_COUNT_32K_TO_48K ((FRAME_COUNT_32K * SAMPLE_RATE_48K) / SAMPLE_RATE_32K)
+
+#define MONO   1
+#define STEREO 2
+
+/* Size in bytes of a sample. */
+#define WORD_SIZE  SAC_WORD_SIZE_BYTE
+#define INT16_SIZE 2
+#define INT24_SIZE 3
+
+#define CDC_RESAMPLING_LENGTH 1440
+#define CDC_MAX_DRIFT_PPM     100
+
+#define CDC_PLL_FRACN_DEFAULT 4000
+#define CDC_PLL_FRACN_MIN     3000
+#define CDC_PLL_FRACN_MAX     5000
+
+/* Number of audio packets muted after an underflow. */
+#define MUTE_ON_UNDERFLOW_RELOAD_VALUE 10
+
+/* Gain of the mixer inputs other than the first one, -6 dB in Q1.31. */
+#define MIXER_GAIN_MINUS_6DB 0x40000000
+
+/* MACROS *********************************************************************/
+/*! Size in bytes of a packet. */
+#define PAYLOAD_SIZE(frame_count, channel_count, sample_size) ((frame_count) * (channel_count) * (sample_size))
+/*! Size in bytes of a packet compressed with ADPCM, which has one state header per channel. */
+#define ADPCM_PAYLOAD_SIZE(frame_count, channel_count) \
+    ((((frame_count) * (channel_count)) / 2) + ((channel_count) * sizeof(adpcm_state_t)))
+
+/* TYPES **********************************************************************/
+/** @brief Instance of the stages calling the ADPCM library directly on 16-bit packed samples.
+ */
+typedef struct adpcm_benchmark_instance {
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! ADPCM state of each channel. */
+    adpcm_state_t state[STEREO];
+} adpcm_benchmark_instance_t;
+
+/** @brief Instance of the stages calling the mixer module directly, every input receiving the input packet.
+ */
+typedef struct mixer_benchmark_instance {
+    /*! Mixer configuration. */
+    sac_mixer_module_cfg_t cfg;
+    /*! Gain of the inputs other than the first one, in Q1.31 format. */
+    int32_t gain_q31;
+    /*! Mixer module, initialized by the pre-setup. */
+    sac_mixer_module_t *mixer;
+} mixer_benchmark_instance_t;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static uint16_t adpcm_encode_scalar_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header,
+                                            uint8_t *data_in, uint16_t size, uint8_t *data_out, sac_status_t *status);
+static uint16_t adpcm_encode_block_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header,
+                                           uint8_t *data_in, uint16_t size, uint8_t *data_out, sac_status_t *status);
+static uint16_t adpcm_decode_scalar_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header,
+                                            uint8_t *data_in, uint16_t size, uint8_t *data_out, sac_status_t *status);
+static uint16_t adpcm_decode_block_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header,
+                                           uint8_t *data_in, uint16_t size, uint8_t *data_out, sac_status_t *status);
+static uint16_t mixer_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                              uint16_t size, uint8_t *data_out, sac_status_t *status);
+static void cdc_pre_setup(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline, sac_status_t *status);
+static void cdc_pll_post_setup(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline,
+                               sac_status_t *status);
+static void mixer_pre_setup(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline, sac_status_t *status);
+static void fallback_post_setup(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline,
+                                sac_status_t *status);
+static void fill_adpcm(const sac_benchmark_case_t *bench_case, uint8_t *data, uint16_t size);
+static void fill_muted_packet(const sac_benchmark_case_t *bench_case, uint8_t *data, uint16_t size);
+static void cdc_pll_set_fracn(uint32_t fracn);
+static uint32_t cdc_pll_get_fracn(void);
+
+/* PRIVATE GLOBALS ************************************************************/
+static uint32_t cdc_pll_fracn = CDC_PLL_FRACN_DEFAULT;
+/* The receiving fallback stage only needs a connection to be registered. */
+static swc_connection_t fallback_connection;
+/* The mixer module is allocated from its own pool, the cases being run one after the other. */
+static mem_pool_t mixer_mem_pool;
+static uint8_t mixer_pool_buffer[MEM_POOL_SIZE_NEEDED(sizeof(sac_mixer_module_t))];
+
+/* ** Processing Stage Interfaces ** */
+static const sac_processing_interface_t src_iface = {
+    .init = sac_src_cmsis_init,
+    .process = sac_src_cmsis_process,
+};
+static const sac_processing_interface_t cdc_iface = {
+    .init = sac_cdc_init,
+    .ctrl = sac_cdc_ctrl,
+    .process = sac_cdc_process,
+};
+static const sac_processing_interface_t cdc_asrc_iface = {
+    .init = sac_cdc_asrc_init,
+    .ctrl = sac_cdc_asrc_ctrl,
+    .process = sac_cdc_asrc_process,
+};
+static const sac_processing_interface_t cdc_pll_iface = {
+    .init = sac_cdc_pll_init,
+    .ctrl = sac_cdc_pll_ctrl,
+    .process = sac_cdc_pll_process,
+};
+static const sac_processing_interface_t compression_iface = {
+    .init = sac_compression_init,
+    .ctrl = sac_compression_ctrl,
+    .process = sac_compression_process,
+};
+static const sac_processing_interface_t adpcm_encode_scalar_iface = {
+    .process = adpcm_encode_scalar_process,
+};
+static const sac_processing_interface_t adpcm_encode_block_iface = {
+    .process = adpcm_encode_block_process,
+};
+static const sac_processing_interface_t adpcm_decode_scalar_iface = {
+    .process = adpcm_decode_scalar_process,
+};
+static const sac_processing_interface_t adpcm_decode_block_iface = {
+    .process = adpcm_decode_block_process,
+};
+static const sac_processing_interface_t decoder_iface = {
+    .init = sac_decoder_init,
+    .ctrl = sac_decoder_ctrl,
+    .process = sac_decoder_process,
+};
+static const sac_processing_interface_t mixer_iface = {
+    .process = mixer_process,
+};
+static const sac_processing_interface_t packing_iface = {
+    .init = sac_packing_init,
+    .ctrl = sac_packing_ctrl,
+    .process = sac_packing_process,
+    .is_in_place = sac_packing_is_in_place,
+};
+static const sac_processing_interface_t volume_iface = {
+    .init = sac_volume_init,
+    .ctrl = sac_volume_ctrl,
+    .process = sac_volume_process,
+    .is_in_place = sac_volume_is_in_place,
+};
+static const sac_processing_interface_t fallback_iface = {
+    .init = sac_fallback_init,
+    .process = sac_fallback_process,
+};
+static const sac_processing_interface_t mute_on_underflow_iface = {
+    .init = sac_mute_on_underflow_init,
+    .process = sac_mute_on_underflow_process,
+    .is_in_place = sac_mute_on_underflow_is_in_place,
+};
+static const sac_processing_interface_t mute_packet_iface = {
+    .process = sac_mute_packet_process,
+    .is_in_place = sac_mute_packet_is_in_place,
+};
+static const sac_processing_interface_t sample_accumulator_iface = {
+    .init = sac_sample_accumulator_init,
+    .ctrl = sac_sample_accumulator_ctrl,
+    .process = sac_sample_accumulator_process,
+};
+
+/* ** Processing Stage Instances ** */
+static src_cmsis_instance_t src_32k_to_48k_instance = {
+    .cfg = {
+        .multiply_ratio = SAC_SRC_THREE,
+        .divide_ratio = SAC_SRC_TWO,
+        .payload_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .input_sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .output_sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+    },
+};
+static src_cmsis_instance_t src_32k_to_48k_q15_instance = {
+    .cfg = {
+        .multiply_ratio = SAC_SRC_THREE,
+        .divide_ratio = SAC_SRC_TWO,
+        .payload_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .input_sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .output_sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+        .use_q15_filters = true,
+    },
+};
+static src_cmsis_instance_t src_48k_to_32k_instance = {
+    .cfg = {
+        .multiply_ratio = SAC_SRC_TWO,
+        .divide_ratio = SAC_SRC_THREE,
+        .payload_size = PAYLOAD_SIZE(FRAME_COUNT_32K_TO_48K, MONO, WORD_SIZE),
+        .input_sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .output_sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+    },
+};
+static src_cmsis_instance_t src_48k_to_96k_instance = {
+    .cfg = {
+        .multiply_ratio = SAC_SRC_TWO,
+        .divide_ratio = SAC_SRC_ONE,
+        .payload_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .input_sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .output_sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+    },
+};
+static src_cmsis_instance_t src_96k_to_48k_instance = {
+    .cfg = {
+        .multiply_ratio = SAC_SRC_ONE,
+        .divide_ratio = SAC_SRC_TWO,
+        .payload_size = PAYLOAD_SIZE(FRAME_COUNT_96K, STEREO, WORD_SIZE),
+        .input_sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .output_sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+    },
+};
+static sac_cdc_instance_t cdc_instance = {
+    .cdc_resampling_length = CDC_RESAMPLING_LENGTH,
+    .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+};
+static sac_cdc_asrc_instance_t cdc_asrc_instance = {
+    .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+    .proportional_gain = CDC_ASRC_DEFAULT_PROPORTIONAL_GAIN,
+    .integral_gain = CDC_ASRC_DEFAULT_INTEGRAL_GAIN,
+    .max_correction_ppm = CDC_ASRC_DEFAULT_MAX_CORRECTION_PPM,
+};
+static sac_cdc_pll_instance_t cdc_pll_instance = {
+    .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+    .cdc_pll_hal = {
+        .set_fracn = cdc_pll_set_fracn,
+        .get_fracn = cdc_pll_get_fracn,
+        .fracn_min_value = CDC_PLL_FRACN_MIN,
+        .fracn_max_value = CDC_PLL_FRACN_MAX,
+        .fracn_default_value = CDC_PLL_FRACN_DEFAULT,
+    },
+};
+static sac_compression_instance_t compression_pack_stereo_instance = {
+    .compression_mode = SAC_COMPRESSION_PACK_STEREO,
+    .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+};
+static sac_compression_instance_t compression_unpack_stereo_instance = {
+    .compression_mode = SAC_COMPRESSION_UNPACK_STEREO,
+    .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+};
+static sac_compression_instance_t compression_pack_stereo_16bits_instance = {
+    .compression_mode = SAC_COMPRESSION_PACK_STEREO,
+    .sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+};
+static sac_compression_instance_t compression_unpack_stereo_16bits_instance = {
+    .compression_mode = SAC_COMPRESSION_UNPACK_STEREO,
+    .sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+};
+static sac_compression_instance_t compression_pack_mono_instance = {
+    .compression_mode = SAC_COMPRESSION_PACK_MONO,
+    .sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+};
+static sac_compression_instance_t compression_unpack_mono_instance = {
+    .compression_mode = SAC_COMPRESSION_UNPACK_MONO,
+    .sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+};
+static adpcm_benchmark_instance_t adpcm_stereo_instance = {
+    .channel_count = STEREO,
+};
+static sac_decoder_instance_t decoder_x2_stereo_24bits_instance = {
+    .channel_count = STEREO,
+    .multiply_ratio = SAC_SRC_TWO,
+    .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+    .initial_volume_level = 50,
+};
+static mixer_benchmark_instance_t mixer_2_inputs_16bits_instance = {
+    .cfg = {.nb_of_inputs = 2, .payload_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE), .bit_depth = 16},
+    .gain_q31 = MIXER_GAIN_MINUS_6DB,
+};
+static mixer_benchmark_instance_t mixer_3_inputs_16bits_instance = {
+    .cfg = {.nb_of_inputs = 3, .payload_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE), .bit_depth = 16},
+    .gain_q31 = MIXER_GAIN_MINUS_6DB,
+};
+static mixer_benchmark_instance_t mixer_2_inputs_24bits_instance = {
+    .cfg = {.nb_of_inputs = 2, .payload_size = PAYLOAD_SIZE(FRAME_COUNT_48K, MONO, WORD_SIZE), .bit_depth = 24},
+    .gain_q31 = MIXER_GAIN_MINUS_6DB,
+};
+static sac_packing_instance_t pack_24bits_instance = {
+    .packing_mode = SAC_PACK_24BITS,
+};
+static sac_packing_instance_t pack_24bits_16bits_instance = {
+    .packing_mode = SAC_PACK_24BITS_16BITS,
+};
+static sac_packing_instance_t unpack_24bits_instance = {
+    .packing_mode = SAC_UNPACK_24BITS,
+};
+static sac_packing_instance_t unpack_24bits_16bits_instance = {
+    .packing_mode = SAC_UNPACK_24BITS_16BITS,
+};
+static sac_packing_instance_t scale_24bits_16bits_instance = {
+    .packing_mode = SAC_SCALE_24BITS_16BITS,
+};
+static sac_packing_instance_t extend_24bits_instance = {
+    .packing_mode = SAC_EXTEND_24BITS,
+};
+static sac_volume_instance_t volume_24bits_instance = {
+    .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+    .initial_volume_level = 80,
+};
+static sac_volume_instance_t volume_16bits_instance = {
+    .sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+    .initial_volume_level = 80,
+};
+static sac_volume_instance_t volume_fixed_point_24bits_instance = {
+    .sample_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+    .initial_volume_level = 80,
+    .mode = SAC_VOLUME_MODE_FIXED_POINT,
+    .channel_count = STEREO,
+};
+static sac_volume_instance_t volume_fixed_point_16bits_instance = {
+    .sample_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+    .initial_volume_level = 80,
+    .mode = SAC_VOLUME_MODE_FIXED_POINT,
+    .channel_count = MONO,
+};
+static sac_fallback_instance_t fallback_rx_instance = {
+    .connection = &fallback_connection,
+    .is_tx_device = false,
+};
+static sac_mute_on_underflow_instance_t mute_on_underflow_instance = {
+    .reload_value = MUTE_ON_UNDERFLOW_RELOAD_VALUE,
+};
+static sac_mute_packet_instance_t mute_packet_tx_instance = {
+    .is_tx = true,
+};
+static sac_mute_packet_instance_t mute_packet_rx_instance = {
+    .is_tx = false,
+};
+/* Two input packets are grouped in one output packet. */
+static sac_sample_accumulator_instance_t sample_accumulator_instance = {
+    .max_accumulator_size = PAYLOAD_SIZE(2 * FRAME_COUNT_48K, STEREO, WORD_SIZE),
+};
+
+/* ** Benchmark Cases ** */
+static const sac_benchmark_case_t benchmark_cases[] = {
+    {
+        .stage = "src_cmsis",
+        .variant = "32k_to_48k_mono_16b",
+        .sample_rate_hz = SAMPLE_RATE_32K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_32K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_32K_TO_48K, MONO, INT16_SIZE),
+        .iface = src_iface,
+        .instance = &src_32k_to_48k_instance,
+    },
+    {
+        .stage = "src_cmsis",
+        .variant = "32k_to_48k_mono_16b_q15",
+        .sample_rate_hz = SAMPLE_RATE_32K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_32K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_32K_TO_48K, MONO, INT16_SIZE),
+        .iface = src_iface,
+        .instance = &src_32k_to_48k_q15_instance,
+    },
+    {
+        .stage = "src_cmsis",
+        .variant = "48k_to_32k_mono_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_32K_TO_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_32K_TO_48K, MONO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .iface = src_iface,
+        .instance = &src_48k_to_32k_instance,
+    },
+    {
+        .stage = "src_cmsis",
+        .variant = "48k_to_96k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K * 2, STEREO, WORD_SIZE),
+        .iface = src_iface,
+        .instance = &src_48k_to_96k_instance,
+    },
+    {
+        .stage = "src_cmsis",
+        .variant = "96k_to_48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_96K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_96K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_96K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_96K / 2, STEREO, WORD_SIZE),
+        .iface = src_iface,
+        .instance = &src_96k_to_48k_instance,
+    },
+    {
+        .stage = "cdc",
+        .variant = "48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = cdc_iface,
+        .instance = &cdc_instance,
+        .pre_setup = cdc_pre_setup,
+    },
+    {
+        .stage = "cdc_asrc",
+        .variant = "48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = cdc_asrc_iface,
+        .instance = &cdc_asrc_instance,
+    },
+    {
+        .stage = "cdc_asrc",
+        .variant = "96k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_96K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_96K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_96K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_96K, STEREO, WORD_SIZE),
+        .iface = cdc_asrc_iface,
+        .instance = &cdc_asrc_instance,
+    },
+    {
+        .stage = "cdc_pll",
+        .variant = "48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = cdc_pll_iface,
+        .instance = &cdc_pll_instance,
+        .post_setup = cdc_pll_post_setup,
+    },
+    {
+        .stage = "compression",
+        .variant = "adpcm_pack_48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = ADPCM_PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO),
+        .iface = compression_iface,
+        .instance = &compression_pack_stereo_instance,
+    },
+    {
+        .stage = "compression",
+        .variant = "adpcm_unpack_48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = ADPCM_PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = compression_iface,
+        .instance = &compression_unpack_stereo_instance,
+        .fill_input = fill_adpcm,
+    },
+    {
+        .stage = "compression",
+        .variant = "adpcm_pack_48k_stereo_16b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .output_size = ADPCM_PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO),
+        .iface = compression_iface,
+        .instance = &compression_pack_stereo_16bits_instance,
+    },
+    {
+        .stage = "compression",
+        .variant = "adpcm_unpack_48k_stereo_16b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = ADPCM_PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = compression_iface,
+        .instance = &compression_unpack_stereo_16bits_instance,
+        .fill_input = fill_adpcm,
+    },
+    {
+        .stage = "compression",
+        .variant = "adpcm_pack_32k_mono_16b",
+        .sample_rate_hz = SAMPLE_RATE_32K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_32K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .output_size = ADPCM_PAYLOAD_SIZE(FRAME_COUNT_32K, MONO),
+        .iface = compression_iface,
+        .instance = &compression_pack_mono_instance,
+    },
+    {
+        .stage = "compression",
+        .variant = "adpcm_unpack_32k_mono_16b",
+        .sample_rate_hz = SAMPLE_RATE_32K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_32K,
+        .input_size = ADPCM_PAYLOAD_SIZE(FRAME_COUNT_32K, MONO),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .iface = compression_iface,
+        .instance = &compression_unpack_mono_instance,
+        .fill_input = fill_adpcm,
+    },
+    {
+        .stage = "adpcm",
+        .variant = "encode_scalar_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .output_size = FRAME_COUNT_48K,
+        .iface = adpcm_encode_scalar_iface,
+        .instance = &adpcm_stereo_instance,
+    },
+    {
+        .stage = "adpcm",
+        .variant = "encode_block_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .output_size = FRAME_COUNT_48K,
+        .iface = adpcm_encode_block_iface,
+        .instance = &adpcm_stereo_instance,
+    },
+    {
+        .stage = "adpcm",
+        .variant = "decode_scalar_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = FRAME_COUNT_48K,
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = adpcm_decode_scalar_iface,
+        .instance = &adpcm_stereo_instance,
+        .fill_input = fill_adpcm,
+    },
+    {
+        .stage = "adpcm",
+        .variant = "decode_block_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = FRAME_COUNT_48K,
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = adpcm_decode_block_iface,
+        .instance = &adpcm_stereo_instance,
+        .fill_input = fill_adpcm,
+    },
+    {
+        .stage = "decoder",
+        .variant = "adpcm_x2_48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = ADPCM_PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO),
+        .output_size = PAYLOAD_SIZE(2 * FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = decoder_iface,
+        .instance = &decoder_x2_stereo_24bits_instance,
+        .fill_input = fill_adpcm,
+    },
+    {
+        .stage = "mixer",
+        .variant = "2_inputs_gain_48k_stereo_16b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = mixer_iface,
+        .instance = &mixer_2_inputs_16bits_instance,
+        .pre_setup = mixer_pre_setup,
+    },
+    {
+        .stage = "mixer",
+        .variant = "3_inputs_gain_48k_stereo_16b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = mixer_iface,
+        .instance = &mixer_3_inputs_16bits_instance,
+        .pre_setup = mixer_pre_setup,
+    },
+    {
+        .stage = "mixer",
+        .variant = "2_inputs_gain_48k_mono_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, MONO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, MONO, WORD_SIZE),
+        .iface = mixer_iface,
+        .instance = &mixer_2_inputs_24bits_instance,
+        .pre_setup = mixer_pre_setup,
+    },
+    {
+        .stage = "packing",
+        .variant = "pack_24b_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT24_SIZE),
+        .iface = packing_iface,
+        .instance = &pack_24bits_instance,
+    },
+    {
+        .stage = "packing",
+        .variant = "pack_24b_to_16b_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = packing_iface,
+        .instance = &pack_24bits_16bits_instance,
+    },
+    {
+        .stage = "packing",
+        .variant = "unpack_24b_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT24_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = packing_iface,
+        .instance = &unpack_24bits_instance,
+    },
+    {
+        .stage = "packing",
+        .variant = "unpack_16b_to_24b_48k_mono",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_32K_TO_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_32K_TO_48K, MONO, INT16_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_32K_TO_48K, MONO, WORD_SIZE),
+        .iface = packing_iface,
+        .instance = &unpack_24bits_16bits_instance,
+    },
+    {
+        .stage = "packing",
+        .variant = "scale_24b_to_16b_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT24_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = packing_iface,
+        .instance = &scale_24bits_16bits_instance,
+    },
+    {
+        .stage = "packing",
+        .variant = "extend_24b_48k_stereo",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = packing_iface,
+        .instance = &extend_24bits_instance,
+    },
+    {
+        .stage = "volume",
+        .variant = "48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = volume_iface,
+        .instance = &volume_24bits_instance,
+    },
+    {
+        .stage = "volume",
+        .variant = "32k_mono_16b",
+        .sample_rate_hz = SAMPLE_RATE_32K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_32K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .iface = volume_iface,
+        .instance = &volume_16bits_instance,
+    },
+    {
+        .stage = "volume",
+        .variant = "fixed_point_48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = volume_iface,
+        .instance = &volume_fixed_point_24bits_instance,
+    },
+    {
+        .stage = "volume",
+        .variant = "fixed_point_32k_mono_16b",
+        .sample_rate_hz = SAMPLE_RATE_32K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = MONO,
+        .frame_count = FRAME_COUNT_32K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_32K, MONO, INT16_SIZE),
+        .iface = volume_iface,
+        .instance = &volume_fixed_point_16bits_instance,
+    },
+    {
+        .stage = "fallback",
+        .variant = "rx_48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT24_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT24_SIZE),
+        .iface = fallback_iface,
+        .instance = &fallback_rx_instance,
+        .post_setup = fallback_post_setup,
+    },
+    {
+        .stage = "mute_on_underflow",
+        .variant = "48k_stereo_24b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = mute_on_underflow_iface,
+        .instance = &mute_on_underflow_instance,
+    },
+    {
+        .stage = "mute_packet",
+        .variant = "tx_48k_stereo_16b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = mute_packet_iface,
+        .instance = &mute_packet_tx_instance,
+    },
+    {
+        .stage = "mute_packet",
+        .variant = "rx_48k_stereo_16b",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = 1,
+        .output_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, INT16_SIZE),
+        .iface = mute_packet_iface,
+        .instance = &mute_packet_rx_instance,
+        .fill_input = fill_muted_packet,
+    },
+    {
+        .stage = "sample_accumulator",
+        .variant = "48k_stereo_24b_x2",
+        .sample_rate_hz = SAMPLE_RATE_48K,
+        .input_format = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED},
+        .channel_count = STEREO,
+        .frame_count = FRAME_COUNT_48K,
+        .input_size = PAYLOAD_SIZE(FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .output_size = PAYLOAD_SIZE(2 * FRAME_COUNT_48K, STEREO, WORD_SIZE),
+        .iface = sample_accumulator_iface,
+        .instance = &sample_accumulator_instance,
+    },
+};
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+const sac_benchmark_case_t *sac_benchmark_get_cases(uint16_t *case_count)
+{
+    *case_count = sizeof(benchmark_cases) / sizeof(benchmark_cases[0]);
+
+    return benchmark_cases;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Give the input packet to every mixer input and mix them, as the mixer pipeline does.
+ *
+ *  @param[in]  instance  Mixer benchmark instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  header    SPARK Audio Core header.
+ *  @param[in]  data_in   Samples given to every input.
+ *  @param[in]  size      Size of the input in bytes, the mixer payload size.
+ *  @param[out] data_out  Mixed samples.
+ *  @param[out] status    Status code.
+ *  @return Number of bytes written.
+ */
+static uint16_t mixer_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                              uint16_t size, uint8_t *data_out, sac_status_t *status)
+{
+    (void)pipeline;
+    (void)header;
+
+    mixer_benchmark_instance_t *mixer = instance;
+
+    *status = SAC_OK;
+
+    for (uint8_t input = 0; input < mixer->cfg.nb_of_inputs; input++) {
+        sac_mixer_module_append_samples(&mixer->mixer->input_samples_queue[input], data_in, size);
+    }
+    sac_mixer_module_mix_packets(mixer->mixer);
+    memcpy(data_out, mixer->mixer->output_packet_buffer, mixer->cfg.payload_size);
+
+    return mixer->cfg.payload_size;
+}
+
+/** @brief Size the CDC queue averaging window for the case sampling rate.
+ *
+ *  @param[in]  bench_case  Benchmark case.
+ *  @param[in]  pipeline    Pipeline of the case.
+ *  @param[out] status      Status code.
+ */
+static void cdc_pre_setup(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline, sac_status_t *status)
+{
+    (void)pipeline;
+
+    sac_cdc_instance_t *cdc = bench_case->instance;
+
+    *status = SAC_OK;
+
+    cdc->cdc_queue_avg_size = sac_cdc_calculate_queue_average_size(CDC_MAX_DRIFT_PPM, bench_case->sample_rate_hz,
+                                                                    bench_case->frame_count,
+                                                                    cdc->cdc_resampling_length);
+}
+
+/** @brief Keep the consumer queue of the PLL based CDC at its target level.
+ *
+ *  The consumer queue of the benchmark pipeline stays empty, which makes the stage take its underflow exit on every
+ *  packet. Pending packets are accounted as queued audio, so the rolling average and the PLL adjustment are measured.
+ *
+ *  @param[in]  bench_case  Benchmark case.
+ *  @param[in]  pipeline    Pipeline of the case.
+ *  @param[out] status      Status code.
+ */
+static void cdc_pll_post_setup(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline,
+                               sac_status_t *status)
+{
+    (void)bench_case;
+
+    *status = SAC_OK;
+
+    pipeline->_internal.pending_packets = pipeline->consumer->cfg.queue_size;
+}
+
+/** @brief Initialize the mixer module of the case and set the gain of its inputs.
+ *
+ *  @param[in]  bench_case  Benchmark case.
+ *  @param[in]  pipeline    Pipeline of the case.
+ *  @param[out] status      Status code.
+ */
+static void mixer_pre_setup(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline, sac_status_t *status)
+{
+    (void)pipeline;
+
+    mixer_benchmark_instance_t *mixer = bench_case->instance;
+
+    mem_pool_init(&mixer_mem_pool, mixer_pool_buffer, sizeof(mixer_pool_buffer));
+    mixer->mixer = sac_mixer_module_init(mixer->cfg, &mixer_mem_pool, status);
+    if (*status != SAC_OK) {
+        return;
+    }
+
+    /* The first input is set to unity gain, which skips the multiply on 32-bit words, so that path is measured too. */
+    sac_mixer_module_set_input_gain(mixer->mixer, 0, SAC_MIXER_GAIN_UNITY, status);
+    for (uint8_t input = 1; (input < mixer->cfg.nb_of_inputs) && (*status == SAC_OK); input++) {
+        sac_mixer_module_set_input_gain(mixer->mixer, input, mixer->gain_q31, status);
+    }
+}
+
+/** @brief Add the fallback mode selected by the header of every packet.
+ *
+ *  @param[in]  bench_case  Benchmark case.
+ *  @param[in]  pipeline    Pipeline of the case.
+ *  @param[out] status      Status code.
+ */
+static void fallback_post_setup(const sac_benchmark_case_t *bench_case, sac_pipeline_t *pipeline,
+                                sac_status_t *status)
+{
+    (void)pipeline;
+
+    sac_fallback_mode_cfg_t mode_cfg = sac_fallback_mode_get_defaults();
+
+    sac_fallback_add_mode(bench_case->instance, bench_case->variant, mode_cfg, status);
+}
+
+/** @brief Encode interleaved 16-bit samples one sample at a time, as the compression stage used to.
+ *
+ *  @param[in]  instance  ADPCM benchmark instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  header    SPARK Audio Core header.
+ *  @param[in]  data_in   16-bit samples.
+ *  @param[in]  size      Size of the input in bytes.
+ *  @param[out] data_out  Packed 4-bit ADPCM samples.
+ *  @param[out] status    Status code.
+ *  @return Number of bytes written.
+ */
+static uint16_t adpcm_encode_scalar_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header,
+                                            uint8_t *data_in, uint16_t size, uint8_t *data_out, sac_status_t *status)
+{
+    (void)pipeline;
+    (void)header;
+
+    adpcm_benchmark_instance_t *adpcm = instance;
+    int16_t *pcm = (int16_t *)data_in;
+    uint16_t frame_count = size / (adpcm->channel_count * sizeof(int16_t));
+    uint8_t left_code = 0;
+    uint8_t right_code = 0;
+
+    *status = SAC_OK;
+
+    for (uint16_t i = 0; i < frame_count; i++) {
+        left_code = adpcm_encode(*pcm++, &adpcm->state[0]);
+        right_code = adpcm_encode(*pcm++, &adpcm->state[1]);
+        *data_out++ = (left_code & 0x0F) | ((right_code << 4) & 0xF0);
+    }
+
+    return frame_count;
+}
+
+/** @brief Encode interleaved 16-bit samples with the ADPCM block function.
+ *
+ *  @param[in]  instance  ADPCM benchmark instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  header    SPARK Audio Core header.
+ *  @param[in]  data_in   16-bit samples.
+ *  @param[in]  size      Size of the input in bytes.
+ *  @param[out] data_out  Packed 4-bit ADPCM samples.
+ *  @param[out] status    Status code.
+ *  @return Number of bytes written.
+ */
+static uint16_t adpcm_encode_block_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header,
+                                           uint8_t *data_in, uint16_t size, uint8_t *data_out, sac_status_t *status)
+{
+    (void)pipeline;
+    (void)header;
+
+    adpcm_benchmark_instance_t *adpcm = instance;
+
+    *status = SAC_OK;
+
+    return adpcm_encode_block((int16_t *)data_in, size / (adpcm->channel_count * sizeof(int16_t)),
+                              adpcm->channel_count, adpcm->state, data_out);
+}
+
+/** @brief Decode packed 4-bit ADPCM samples one sample at a time, as the compression stage used to.
+ *
+ *  @param[in]  instance  ADPCM benchmark instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  header    SPARK Audio Core header.
+ *  @param[in]  data_in   Packed 4-bit ADPCM samples.
+ *  @param[in]  size      Size of the input in bytes.
+ *  @param[out] data_out  16-bit samples.
+ *  @param[out] status    Status code.
+ *  @return Number of bytes written.
+ */
+static uint16_t adpcm_decode_scalar_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header,
+                                            uint8_t *data_in, uint16_t size, uint8_t *data_out, sac_status_t *status)
+{
+    (void)pipeline;
+    (void)header;
+
+    adpcm_benchmark_instance_t *adpcm = instance;
+    int16_t *pcm = (int16_t *)data_out;
+
+    *status = SAC_OK;
+
+    for (uint16_t i = 0; i < size; i++) {
+        *pcm++ = adpcm_decode(data_in[i] & 0x0F, &adpcm->state[0]);
+        *pcm++ = adpcm_decode((data_in[i] >> 4) & 0x0F, &adpcm->state[1]);
+    }
+
+    return size * STEREO * sizeof(int16_t);
+}
+
+/** @brief Decode packed 4-bit ADPCM samples with the ADPCM block function.
+ *
+ *  @param[in]  instance  ADPCM benchmark instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  header    SPARK Audio Core header.
+ *  @param[in]  data_in   Packed 4-bit ADPCM samples.
+ *  @param[in]  size      Size of the input in bytes.
+ *  @param[out] data_out  16-bit samples.
+ *  @param[out] status    Status code.
+ *  @return Number of bytes written.
+ */
+static uint16_t adpcm_decode_block_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header,
+                                           uint8_t *data_in, uint16_t size, uint8_t *data_out, sac_status_t *status)
+{
+    (void)pipeline;
+    (void)header;
+
+    adpcm_benchmark_instance_t *adpcm = instance;
+
+    *status = SAC_OK;
+
+    return adpcm_decode_block(data_in, (size * 2) / adpcm->channel_count, adpcm->channel_count, adpcm->state,
+                              (int16_t *)data_out) *
+           sizeof(int16_t);
+}
+
+/** @brief Fill a packet compressed with ADPCM.
+ *
+ *  Every channel state header starts from the initial decoder state, any 4-bit code is valid after it.
+ *
+ *  @param[in]  bench_case  Benchmark case.
+ *  @param[out] data        Packet to fill.
+ *  @param[in]  size        Size of the packet in bytes.
+ */
+static void fill_adpcm(const sac_benchmark_case_t *bench_case, uint8_t *data, uint16_t size)
+{
+    const uint16_t header_size = bench_case->channel_count * sizeof(adpcm_state_t);
+    uint8_t code = 0;
+
+    memset(data, 0, header_size);
+    for (uint16_t i = header_size; i < size; i++) {
+        /* Alternate rising and falling codes so the step size stays in its usual range. */
+        code = (uint8_t)(((i & 1) ? 0x3 : 0xB) + (i % 3));
+        data[i] = (uint8_t)(code | (code << 4));
+    }
+}
+
+/** @brief Fill the single byte packet sent for a muted packet, which holds the size of the muted payload.
+ *
+ *  @param[in]  bench_case  Benchmark case.
+ *  @param[out] data        Packet to fill.
+ *  @param[in]  size        Size of the packet in bytes.
+ */
+static void fill_muted_packet(const sac_benchmark_case_t *bench_case, uint8_t *data, uint16_t size)
+{
+    (void)size;
+
+    data[0] = (uint8_t)bench_case->output_size;
+}
+
+/** @brief Set the fractional part of the audio PLL multiplier.
+ *
+ *  @param[in] fracn  Fractional part of the multiplier.
+ */
+static void cdc_pll_set_fracn(uint32_t fracn)
+{
+    cdc_pll_fracn = fracn;
+}
+
+/** @brief Get the fractional part of the audio PLL multiplier.
+ *
+ *  @return Fractional part of the multiplier.
+ */
+static uint32_t cdc_pll_get_fracn(void)
+{
+    return cdc_pll_fracn;
+}
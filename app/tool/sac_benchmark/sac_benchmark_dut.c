@@ -0,0 +1,88 @@
+/** @file  sac_benchmark_dut.c
+ *  @brief This tool measures the processing time of every SPARK Audio Core processing stage on the target.
+ *
+ *  Each benchmark case is measured in CPU cycles with the cycle counter of the core. The results are written as CSV
+ *  lines on the log interface once all cases have run. Save the log and compare it with a reference run using
+ *  tools/sac_benchmark_compare.py.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdio.h>
+#include "profiler_facade.h"
+#include "sac_benchmark.h"
+
+/* CONSTANTS ******************************************************************/
+/* Number of measured process calls per case. */
+#define ITERATION_COUNT 1000
+/* Number of nanoseconds in a microsecond. */
+#define NS_PER_US 1000.0
+#define LOG_LINE_BUFFER_SIZE 64
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static uint32_t get_cycle_count(void);
+static double cycles_to_ns(uint32_t cycle_count);
+static void log_write(const char *string);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(void)
+{
+    char log_buffer[LOG_LINE_BUFFER_SIZE];
+    uint16_t fail_count = 0;
+    sac_benchmark_platform_t platform = {
+        .name = "target",
+        .get_timestamp = get_cycle_count,
+        .ticks_to_ns = cycles_to_ns,
+        .write = log_write,
+    };
+
+    facade_board_init();
+    facade_profiler_init();
+    facade_log_init();
+
+    facade_log_write("\r\n\n=== Running SAC Benchmark ===\r\n");
+
+    fail_count = sac_benchmark_run(&platform, ITERATION_COUNT, NULL);
+
+    snprintf(log_buffer, sizeof(log_buffer), "# Benchmark complete, %u case(s) failed\r\n", fail_count);
+    facade_log_write(log_buffer);
+
+    while (1);
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Read the CPU cycle counter.
+ *
+ *  @return Current cycle count.
+ */
+static uint32_t get_cycle_count(void)
+{
+    uint32_t cycle_count = 0;
+
+    facade_profiler_start(&cycle_count);
+
+    return cycle_count;
+}
+
+/** @brief Convert a number of CPU cycles to nanoseconds.
+ *
+ *  @param[in] cycle_count  Number of cycles.
+ *  @return Duration in nanoseconds.
+ */
+static double cycles_to_ns(uint32_t cycle_count)
+{
+    return facade_profiler_get_elapsed_us(cycle_count) * NS_PER_US;
+}
+
+/** @brief Write a string on the log interface.
+ *
+ *  @param[in] string  Null terminated string.
+ */
+static void log_write(const char *string)
+{
+    facade_log_write((char *)string);
+}
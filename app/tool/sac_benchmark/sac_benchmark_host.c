@@ -0,0 +1,84 @@
+/** @file  sac_benchmark_host.c
+ *  @brief This tool measures the processing time of every SPARK Audio Core processing stage on the host.
+ *
+ *  Each benchmark case is measured in nanoseconds with the monotonic clock. The results are written as CSV lines on
+ *  the standard output.
+ *
+ *  Usage: sac_benchmark_host [iteration_count] [stage]
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "sac_benchmark.h"
+
+/* CONSTANTS ******************************************************************/
+/* Default number of measured process calls per case. */
+#define ITERATION_COUNT 10000
+#define NS_PER_SECOND   1000000000ULL
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static uint32_t get_time_ns(void);
+static double ns_to_ns(uint32_t ticks);
+static void log_write(const char *string);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t iteration_count = ITERATION_COUNT;
+    const char *stage_filter = NULL;
+    sac_benchmark_platform_t platform = {
+        .name = "host",
+        .get_timestamp = get_time_ns,
+        .ticks_to_ns = ns_to_ns,
+        .write = log_write,
+    };
+
+    if (argc > 1) {
+        iteration_count = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+    if (argc > 2) {
+        stage_filter = argv[2];
+    }
+
+    return (sac_benchmark_run(&platform, iteration_count, stage_filter) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Read the monotonic clock.
+ *
+ *  @return Time in nanoseconds, modulo 2^32.
+ */
+static uint32_t get_time_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)(((uint64_t)now.tv_sec * NS_PER_SECOND) + (uint64_t)now.tv_nsec);
+}
+
+/** @brief Convert timestamp ticks to nanoseconds, the host timestamp is already in nanoseconds.
+ *
+ *  @param[in] ticks  Number of ticks.
+ *  @return Duration in nanoseconds.
+ */
+static double ns_to_ns(uint32_t ticks)
+{
+    return (double)ticks;
+}
+
+/** @brief Write a string on the standard output.
+ *
+ *  @param[in] string  Null terminated string.
+ */
+static void log_write(const char *string)
+{
+    fputs(string, stdout);
+}
@@ -0,0 +1,328 @@
+/** @file  sac_decoder_check.c
+ *  @brief This tool compares the fused decoder stage with the decompression and SRC CMSIS stages on the host.
+ *
+ *  Every case compresses a band-limited pseudo-random signal with the compression stage, then decodes each packet with
+ *  the fused decoder and with the decompression stage followed by the SRC CMSIS stage, which filters with 1.31
+ *  coefficients. The pipeline tracks the sample count like with fallback, and a transition packet carrying the extra
+ *  frames of a fallback mode switch is sent in the middle of the stream, so the size validation and the transition
+ *  handling of both paths are compared as well. A packet of an unexpected size must be rejected by both.
+ *
+ *  Without interpolation, the fused decoder must match the decompression stage exactly. With interpolation, it filters
+ *  with 1.15 coefficients and rounds its output to 16 bits before scaling it to the output bit depth, so the outputs
+ *  may differ by a few 16-bit LSB.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem_pool.h"
+#include "sac_compression.h"
+#include "sac_decoder.h"
+#include "sac_src_cmsis.h"
+
+/* CONSTANTS ******************************************************************/
+#define MEM_POOL_SIZE 8192
+
+/* Number of frames of a packet, at the input sampling rate. */
+#define FRAME_COUNT 40
+/* Largest number of frames of a packet, a transition packet included. */
+#define MAX_FRAME_COUNT   (FRAME_COUNT + SAC_SRC_CMSIS_FIR_NUM_TAPS)
+#define MAX_CHANNEL_COUNT 2
+#define MAX_RATIO         SAC_SRC_SIX
+/* Number of packets decoded per case, the transition packet is the one at TRANSITION_PACKET. */
+#define PACKET_COUNT      8
+#define TRANSITION_PACKET 4
+/* Frames a transition packet carries ahead of its samples, as sent by the SRC CMSIS discard process. */
+#define TRANSITION_FRAME_COUNT(ratio) ((SAC_SRC_CMSIS_FIR_NUM_TAPS / (ratio)) / 2)
+#define RANDOM_SEED                   0x13572468U
+
+/* Largest difference allowed with interpolation, in 16-bit LSB. */
+#define INTERPOLATION_TOLERANCE_16BITS 4
+
+/* MACROS *********************************************************************/
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+
+/* TYPES **********************************************************************/
+/** @brief Decoder configuration of a test case.
+ */
+typedef struct decoder_check_case {
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! Interpolation ratio. */
+    src_cmsis_ratio_t multiply_ratio;
+    /*! Output sample format. */
+    sac_sample_format_t sample_format;
+} decoder_check_case_t;
+
+/* PRIVATE GLOBALS ************************************************************/
+static const sac_sample_format_t format_16bits = {.bit_depth = SAC_16BITS, .sample_encoding = SAC_SAMPLE_PACKED};
+static const sac_sample_format_t format_24bits = {.bit_depth = SAC_24BITS, .sample_encoding = SAC_SAMPLE_UNPACKED};
+
+static const decoder_check_case_t check_cases[] = {
+    {1, SAC_SRC_ONE, format_16bits},   {2, SAC_SRC_ONE, format_24bits},   {1, SAC_SRC_TWO, format_16bits},
+    {2, SAC_SRC_TWO, format_16bits},   {2, SAC_SRC_TWO, format_24bits},   {1, SAC_SRC_THREE, format_24bits},
+    {2, SAC_SRC_FOUR, format_16bits},  {2, SAC_SRC_SIX, format_24bits},
+};
+
+static uint8_t pool[MEM_POOL_SIZE];
+static int16_t pcm[MAX_FRAME_COUNT * MAX_CHANNEL_COUNT];
+static uint8_t compressed[SAC_COMPRESSION_HEADER_SIZE(MAX_CHANNEL_COUNT) + (MAX_FRAME_COUNT * MAX_CHANNEL_COUNT)];
+static uint8_t decompressed[MAX_FRAME_COUNT * MAX_CHANNEL_COUNT * sizeof(int32_t)];
+static uint8_t reference_out[MAX_FRAME_COUNT * MAX_RATIO * MAX_CHANNEL_COUNT * sizeof(int32_t)];
+static uint8_t fused_out[MAX_FRAME_COUNT * MAX_RATIO * MAX_CHANNEL_COUNT * sizeof(int32_t)];
+static int32_t signal_state[MAX_CHANNEL_COUNT];
+static uint32_t random_state = RANDOM_SEED;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static bool check_decoder(const decoder_check_case_t *check_case);
+static bool check_invalid_size(const decoder_check_case_t *check_case, sac_pipeline_t *pipeline,
+                               sac_compression_instance_t *compression, sac_decoder_instance_t *decoder);
+static uint16_t compress_packet(sac_compression_instance_t *compression, uint8_t channel_count, uint16_t frame_count);
+static uint32_t compare_outputs(const decoder_check_case_t *check_case, uint16_t size, int32_t tolerance);
+static int32_t read_sample(const uint8_t *buffer, uint16_t index, const sac_sample_format_t *format);
+static uint8_t get_sample_size(const sac_sample_format_t *format);
+static uint32_t get_random(void);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(void)
+{
+    bool passed = true;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(check_cases); i++) {
+        passed &= check_decoder(&check_cases[i]);
+    }
+
+    printf("%s\n", passed ? "PASSED" : "FAILED");
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Compare the fused decoder with the decompression and SRC stages over a stream of packets.
+ *
+ *  @param[in] check_case  Decoder configuration.
+ *  @retval true   Every output matches within the tolerance and the invalid packet is rejected.
+ *  @retval false  An output differs or a stage failed.
+ */
+static bool check_decoder(const decoder_check_case_t *check_case)
+{
+    const bool interpolate = (check_case->multiply_ratio > SAC_SRC_ONE);
+    const int32_t tolerance = interpolate ? (INTERPOLATION_TOLERANCE_16BITS << (check_case->sample_format.bit_depth -
+                                                                                 SAC_16BITS)) :
+                                            0;
+    sac_compression_instance_t compression = {0};
+    sac_compression_instance_t decompression = {0};
+    src_cmsis_instance_t src = {0};
+    sac_decoder_instance_t decoder = {0};
+    sac_pipeline_t pipeline = {0};
+    sac_status_t status = SAC_OK;
+    sac_status_t src_status = SAC_OK;
+    mem_pool_t mem_pool;
+    uint16_t frame_count = 0;
+    uint16_t compressed_size = 0;
+    uint16_t decompressed_size = 0;
+    uint16_t reference_size = 0;
+    uint16_t fused_size = 0;
+    uint32_t mismatch_count = 0;
+
+    printf("%u channel(s), ratio %u, %u-bit: ", check_case->channel_count, check_case->multiply_ratio,
+           check_case->sample_format.bit_depth);
+
+    mem_pool_init(&mem_pool, pool, sizeof(pool));
+    memset(signal_state, 0, sizeof(signal_state));
+
+    compression.compression_mode = (check_case->channel_count == 1) ? SAC_COMPRESSION_PACK_MONO :
+                                                                      SAC_COMPRESSION_PACK_STEREO;
+    compression.sample_format = format_16bits;
+    sac_compression_init(&compression, "Compression", &pipeline, &mem_pool, &status);
+    if (status == SAC_OK) {
+        decompression.compression_mode = (check_case->channel_count == 1) ? SAC_COMPRESSION_UNPACK_MONO :
+                                                                            SAC_COMPRESSION_UNPACK_STEREO;
+        decompression.sample_format = check_case->sample_format;
+        sac_compression_init(&decompression, "Decompression", &pipeline, &mem_pool, &status);
+    }
+    if ((status == SAC_OK) && interpolate) {
+        src.cfg.multiply_ratio = check_case->multiply_ratio;
+        src.cfg.divide_ratio = SAC_SRC_ONE;
+        src.cfg.payload_size = FRAME_COUNT * check_case->channel_count * get_sample_size(&check_case->sample_format);
+        src.cfg.input_sample_format = check_case->sample_format;
+        src.cfg.output_sample_format = check_case->sample_format;
+        src.cfg.channel_count = check_case->channel_count;
+        sac_src_cmsis_init(&src, "SRC", &pipeline, &mem_pool, &status);
+    }
+    if (status == SAC_OK) {
+        decoder.channel_count = check_case->channel_count;
+        decoder.multiply_ratio = check_case->multiply_ratio;
+        decoder.sample_format = check_case->sample_format;
+        decoder.initial_volume_level = 100;
+        sac_decoder_init(&decoder, "Decoder", &pipeline, &mem_pool, &status);
+    }
+    if (status != SAC_OK) {
+        printf("init FAILED\n");
+        return false;
+    }
+
+    /* The fallback stage sets the number of frames of the current mode. */
+    pipeline._internal.current_sample_count = FRAME_COUNT;
+
+    for (uint8_t packet = 0; packet < PACKET_COUNT; packet++) {
+        frame_count = FRAME_COUNT;
+        if (interpolate && (packet == TRANSITION_PACKET)) {
+            frame_count += TRANSITION_FRAME_COUNT(check_case->multiply_ratio);
+        }
+        compressed_size = compress_packet(&compression, check_case->channel_count, frame_count);
+
+        decompressed_size = sac_compression_process(&decompression, &pipeline, NULL, compressed, compressed_size,
+                                                    decompressed, &status);
+        if (interpolate) {
+            reference_size = sac_src_cmsis_process(&src, &pipeline, NULL, decompressed, decompressed_size,
+                                                   reference_out, &src_status);
+        } else {
+            reference_size = decompressed_size;
+            memcpy(reference_out, decompressed, decompressed_size);
+        }
+        fused_size = sac_decoder_process(&decoder, &pipeline, NULL, compressed, compressed_size, fused_out, &status);
+
+        if ((status != SAC_OK) || (src_status != SAC_OK) || (fused_size != reference_size) || (fused_size == 0)) {
+            printf("packet %u is %u bytes instead of %u, ", packet, fused_size, reference_size);
+            mismatch_count++;
+            break;
+        }
+        mismatch_count += compare_outputs(check_case, fused_size, tolerance);
+    }
+
+    if (interpolate && !check_invalid_size(check_case, &pipeline, &compression, &decoder)) {
+        mismatch_count++;
+    }
+    printf("%s\n", (mismatch_count == 0) ? "ok" : "FAILED");
+
+    return (mismatch_count == 0);
+}
+
+/** @brief Check that the fused decoder rejects a packet that is neither a regular nor a transition packet.
+ *
+ *  @param[in] check_case   Decoder configuration.
+ *  @param[in] pipeline     Pipeline tracking the sample count.
+ *  @param[in] compression  Compression stage.
+ *  @param[in] decoder      Fused decoder stage.
+ *  @retval true   The packet is rejected.
+ *  @retval false  The packet is decoded.
+ */
+static bool check_invalid_size(const decoder_check_case_t *check_case, sac_pipeline_t *pipeline,
+                               sac_compression_instance_t *compression, sac_decoder_instance_t *decoder)
+{
+    sac_status_t status = SAC_OK;
+    uint16_t compressed_size = 0;
+    uint16_t fused_size = 0;
+
+    /* Eight frames more is not a transition packet for any ratio. */
+    compressed_size = compress_packet(compression, check_case->channel_count, FRAME_COUNT + 8);
+    fused_size = sac_decoder_process(decoder, pipeline, NULL, compressed, compressed_size, fused_out, &status);
+    if ((fused_size != 0) || (status != SAC_ERR_INVALID_PACKET_SIZE)) {
+        printf("invalid packet size not rejected, ");
+        return false;
+    }
+
+    return true;
+}
+
+/** @brief Generate a packet of the signal and compress it.
+ *
+ *  The signal is low-pass filtered white noise at about half the full scale, which the ADPCM encoder can track.
+ *
+ *  @param[in] compression    Compression stage.
+ *  @param[in] channel_count  Number of interleaved channels.
+ *  @param[in] frame_count    Number of frames of the packet.
+ *  @return Size of the compressed packet, in bytes.
+ */
+static uint16_t compress_packet(sac_compression_instance_t *compression, uint8_t channel_count, uint16_t frame_count)
+{
+    const uint16_t sample_count = frame_count * channel_count;
+    sac_status_t status = SAC_OK;
+    int32_t *state = NULL;
+
+    for (uint16_t i = 0; i < sample_count; i++) {
+        state = &signal_state[i % channel_count];
+        *state += (((int32_t)(get_random() >> 16) - INT16_MAX) - *state) / 4;
+        pcm[i] = (int16_t)(*state / 2);
+    }
+
+    return sac_compression_process(compression, NULL, NULL, (uint8_t *)pcm, sample_count * sizeof(int16_t), compressed,
+                                   &status);
+}
+
+/** @brief Compare the outputs of a packet.
+ *
+ *  @param[in] check_case  Decoder configuration.
+ *  @param[in] size        Size of the outputs, in bytes.
+ *  @param[in] tolerance   Largest difference allowed, in LSB of the output bit depth.
+ *  @return Number of outputs differing by more than the tolerance.
+ */
+static uint32_t compare_outputs(const decoder_check_case_t *check_case, uint16_t size, int32_t tolerance)
+{
+    const uint16_t sample_count = size / get_sample_size(&check_case->sample_format);
+    uint32_t mismatch_count = 0;
+    int32_t expected_sample = 0;
+    int32_t actual_sample = 0;
+
+    for (uint16_t i = 0; i < sample_count; i++) {
+        expected_sample = read_sample(reference_out, i, &check_case->sample_format);
+        actual_sample = read_sample(fused_out, i, &check_case->sample_format);
+        if (abs(actual_sample - expected_sample) > tolerance) {
+            if (mismatch_count == 0) {
+                printf("output %u is %ld instead of %ld, ", i, (long)actual_sample, (long)expected_sample);
+            }
+            mismatch_count++;
+        }
+    }
+
+    return mismatch_count;
+}
+
+/** @brief Read and sign extend an output sample.
+ *
+ *  @param[in] buffer  Output buffer.
+ *  @param[in] index   Index of the sample, all channels included.
+ *  @param[in] format  Output sample format.
+ *  @return Output sample.
+ */
+static int32_t read_sample(const uint8_t *buffer, uint16_t index, const sac_sample_format_t *format)
+{
+    const uint8_t sample_size = get_sample_size(format);
+    const uint8_t unused_bits = 32 - format->bit_depth;
+    uint32_t value = 0;
+
+    memcpy(&value, &buffer[index * sample_size], sample_size);
+
+    return (int32_t)(value << unused_bits) >> unused_bits;
+}
+
+/** @brief Get the size of a sample in a payload.
+ *
+ *  @param[in] format  Sample format.
+ *  @return Size of a sample in bytes.
+ */
+static uint8_t get_sample_size(const sac_sample_format_t *format)
+{
+    return (format->sample_encoding == SAC_SAMPLE_UNPACKED) ? sizeof(int32_t) : (format->bit_depth / 8);
+}
+
+/** @brief Get the next value of a xorshift pseudo-random sequence.
+ *
+ *  @return Pseudo-random value.
+ */
+static uint32_t get_random(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state;
+}
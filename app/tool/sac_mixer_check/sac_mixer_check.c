@@ -0,0 +1,269 @@
+/** @file  sac_mixer_check.c
+ *  @brief This tool compares the output of the SPARK Audio Core Mixer Module with a C reference on the host.
+ *
+ *  Every case mixes a few consecutive payloads of pseudo-random samples, with payload sizes that do not divide the
+ *  ring buffers so the inputs wrap around in the middle of a mix. The reference scales every sample by its Q1.31 gain
+ *  in 64-bit arithmetic, rounds the sum to the nearest integer and saturates it to the bit depth.
+ *
+ *  Unity gains are applied exactly, so those cases must match the reference exactly. Otherwise every input is rounded
+ *  on its own, with a gain rounded to Q2.14 for 16-bit samples, and the outputs may differ by one LSB per input plus
+ *  one. The loud cases saturate most outputs.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem_pool.h"
+#include "sac_mixer_module.h"
+
+/* CONSTANTS ******************************************************************/
+#define MEM_POOL_SIZE 2048
+
+/* Number of consecutive payloads mixed per case. */
+#define PAYLOAD_COUNT 8
+#define RANDOM_SEED   0x2468ACE1U
+
+/* -6 dB, in Q1.31 format. */
+#define GAIN_MINUS_6DB 0x40000000
+/* -12 dB with a low part that Q2.14 can not hold, in Q1.31 format. */
+#define GAIN_MINUS_12DB 0x2026F310
+
+/* MACROS *********************************************************************/
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+
+/* TYPES **********************************************************************/
+/** @brief Mixer configuration of a test case.
+ */
+typedef struct mixer_check_case {
+    /*! Name of the case. */
+    const char *name;
+    /*! Number of inputs. */
+    uint8_t nb_of_inputs;
+    /*! Bit depth of the samples. */
+    uint8_t bit_depth;
+    /*! Payload size, in bytes. */
+    uint8_t payload_size;
+    /*! Gain of every input, in Q1.31 format. */
+    int32_t gain_q31[MAX_NB_OF_INPUTS];
+    /*! Input samples are drawn at full scale instead of a third of it. */
+    bool loud;
+} mixer_check_case_t;
+
+/* PRIVATE GLOBALS ************************************************************/
+/* The payload sizes do not divide MAX_NB_OF_BYTES_PER_BUFFER, so the read indexes wrap around within a payload. */
+static const mixer_check_case_t check_cases[] = {
+    {"unity", 2, 16, 42, {SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY}, false},
+    {"unity", 3, 16, 42, {SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY}, false},
+    {"unity", 2, 24, 36, {SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY}, false},
+    {"unity", 3, 32, 36, {SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY}, false},
+    {"average", 2, 16, 42, {SAC_MIXER_GAIN_AVERAGE(2), SAC_MIXER_GAIN_AVERAGE(2)}, true},
+    {"average", 3, 24, 36, {SAC_MIXER_GAIN_AVERAGE(3), SAC_MIXER_GAIN_AVERAGE(3), SAC_MIXER_GAIN_AVERAGE(3)}, true},
+    {"average", 3, 32, 36, {SAC_MIXER_GAIN_AVERAGE(3), SAC_MIXER_GAIN_AVERAGE(3), SAC_MIXER_GAIN_AVERAGE(3)}, true},
+    {"mixed", 3, 16, 42, {SAC_MIXER_GAIN_UNITY, GAIN_MINUS_6DB, GAIN_MINUS_12DB}, false},
+    {"mixed", 3, 24, 36, {SAC_MIXER_GAIN_UNITY, GAIN_MINUS_6DB, GAIN_MINUS_12DB}, false},
+    {"mixed", 2, 32, 36, {GAIN_MINUS_12DB, 0}, false},
+    {"saturate", 3, 16, 42, {SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY, GAIN_MINUS_6DB}, true},
+    {"saturate", 2, 24, 36, {SAC_MIXER_GAIN_UNITY, GAIN_MINUS_12DB}, true},
+    {"saturate", 3, 32, 36, {SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY, SAC_MIXER_GAIN_UNITY}, true},
+};
+
+static uint8_t pool[MEM_POOL_SIZE];
+static uint8_t input_payload[MAX_NB_OF_INPUTS][MAX_NB_OF_BYTES_PER_PAYLOAD];
+static uint32_t random_state = RANDOM_SEED;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static bool check_mixer(const mixer_check_case_t *check_case);
+static void generate_input(const mixer_check_case_t *check_case);
+static int32_t reference_mix(const mixer_check_case_t *check_case, uint8_t sample);
+static int32_t read_sample(const uint8_t *buffer, uint8_t sample, uint8_t bit_depth);
+static uint8_t get_sample_size(uint8_t bit_depth);
+static uint32_t get_random(void);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(void)
+{
+    bool passed = true;
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(check_cases); i++) {
+        passed &= check_mixer(&check_cases[i]);
+    }
+
+    printf("%s\n", passed ? "PASSED" : "FAILED");
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Compare the mixer output with the reference over a few payloads.
+ *
+ *  @param[in] check_case  Mixer configuration.
+ *  @retval true   Every output matches the reference within the tolerance.
+ *  @retval false  An output differs or the mixer initialization failed.
+ */
+static bool check_mixer(const mixer_check_case_t *check_case)
+{
+    sac_mixer_module_cfg_t cfg = {
+        .nb_of_inputs = check_case->nb_of_inputs,
+        .payload_size = check_case->payload_size,
+        .bit_depth = check_case->bit_depth,
+    };
+    const uint8_t sample_count = check_case->payload_size / get_sample_size(check_case->bit_depth);
+    sac_status_t status = SAC_OK;
+    sac_mixer_module_t *mixer;
+    mem_pool_t mem_pool;
+    int32_t tolerance = 0;
+    uint32_t mismatch_count = 0;
+    int32_t expected_sample = 0;
+    int32_t actual_sample = 0;
+
+    printf("%-8s %u inputs, %u-bit: ", check_case->name, check_case->nb_of_inputs, check_case->bit_depth);
+
+    mem_pool_init(&mem_pool, pool, sizeof(pool));
+    mixer = sac_mixer_module_init(cfg, &mem_pool, &status);
+    for (uint8_t i = 0; (i < check_case->nb_of_inputs) && (status == SAC_OK); i++) {
+        /* The inputs are mixed at unity gain until their gain is set. */
+        if (mixer->gain_q31[i] != SAC_MIXER_GAIN_UNITY) {
+            printf("default gain FAILED\n");
+            return false;
+        }
+        sac_mixer_module_set_input_gain(mixer, i, check_case->gain_q31[i], &status);
+        if (check_case->gain_q31[i] != SAC_MIXER_GAIN_UNITY) {
+            tolerance = check_case->nb_of_inputs + 1;
+        }
+    }
+    if (status != SAC_OK) {
+        printf("init FAILED\n");
+        return false;
+    }
+
+    for (uint8_t payload = 0; payload < PAYLOAD_COUNT; payload++) {
+        generate_input(check_case);
+        for (uint8_t i = 0; i < check_case->nb_of_inputs; i++) {
+            sac_mixer_module_append_samples(&mixer->input_samples_queue[i], input_payload[i],
+                                            check_case->payload_size);
+        }
+        sac_mixer_module_mix_packets(mixer);
+
+        for (uint8_t sample = 0; sample < sample_count; sample++) {
+            expected_sample = reference_mix(check_case, sample);
+            actual_sample = read_sample(mixer->output_packet_buffer, sample, check_case->bit_depth);
+            if (abs(actual_sample - expected_sample) > tolerance) {
+                if (mismatch_count == 0) {
+                    printf("payload %u output %u is %ld instead of %ld, ", payload, sample, (long)actual_sample,
+                           (long)expected_sample);
+                }
+                mismatch_count++;
+            }
+        }
+    }
+    printf("%s\n", (mismatch_count == 0) ? "ok" : "FAILED");
+
+    return (mismatch_count == 0);
+}
+
+/** @brief Fill the input payloads with pseudo-random samples.
+ *
+ *  @param[in] check_case  Mixer configuration.
+ */
+static void generate_input(const mixer_check_case_t *check_case)
+{
+    const uint8_t sample_size = get_sample_size(check_case->bit_depth);
+    const uint8_t unused_bits = 32 - check_case->bit_depth;
+    int32_t sample = 0;
+
+    for (uint8_t i = 0; i < check_case->nb_of_inputs; i++) {
+        for (uint8_t offset = 0; offset < check_case->payload_size; offset += sample_size) {
+            /* Sign extend the drawn value like a sample of the given bit depth. */
+            sample = (int32_t)(get_random() << unused_bits) >> unused_bits;
+            if (!check_case->loud) {
+                sample /= 3;
+            }
+            memcpy(&input_payload[i][offset], &sample, sample_size);
+        }
+    }
+}
+
+/** @brief Mix a sample of every input payload.
+ *
+ *  @param[in] check_case  Mixer configuration.
+ *  @param[in] sample      Index of the sample in the payloads.
+ *  @return Mixed sample, saturated to the bit depth.
+ */
+static int32_t reference_mix(const mixer_check_case_t *check_case, uint8_t sample)
+{
+    const int64_t sample_max = (check_case->bit_depth == 32) ? INT32_MAX : ((1LL << (check_case->bit_depth - 1)) - 1);
+    const int64_t sample_min = -sample_max - 1;
+    const int64_t fraction_mask = (1LL << 31) - 1;
+    int64_t product = 0;
+    int64_t acc = 0;
+    int64_t fraction = 0;
+
+    /* The integer and fractional parts of the products are summed apart, so three 32-bit products can not overflow. */
+    for (uint8_t i = 0; i < check_case->nb_of_inputs; i++) {
+        product = read_sample(input_payload[i], sample, check_case->bit_depth);
+        if (check_case->gain_q31[i] != SAC_MIXER_GAIN_UNITY) {
+            product *= check_case->gain_q31[i];
+            acc += product >> 31;
+            fraction += product & fraction_mask;
+        } else {
+            acc += product;
+        }
+    }
+    acc += (fraction + (1LL << 30)) >> 31;
+
+    if (acc > sample_max) {
+        return (int32_t)sample_max;
+    } else if (acc < sample_min) {
+        return (int32_t)sample_min;
+    }
+
+    return (int32_t)acc;
+}
+
+/** @brief Read and sign extend a sample.
+ *
+ *  @param[in] buffer     Payload.
+ *  @param[in] sample     Index of the sample.
+ *  @param[in] bit_depth  Bit depth of the samples.
+ *  @return Sample.
+ */
+static int32_t read_sample(const uint8_t *buffer, uint8_t sample, uint8_t bit_depth)
+{
+    const uint8_t sample_size = get_sample_size(bit_depth);
+    const uint8_t unused_bits = 32 - bit_depth;
+    uint32_t value = 0;
+
+    memcpy(&value, &buffer[sample * sample_size], sample_size);
+
+    return (int32_t)(value << unused_bits) >> unused_bits;
+}
+
+/** @brief Get the size of a sample in the payload.
+ *
+ *  @param[in] bit_depth  Bit depth of a sample.
+ *  @return Size of a sample in bytes.
+ */
+static uint8_t get_sample_size(uint8_t bit_depth)
+{
+    return (bit_depth == 16) ? sizeof(int16_t) : sizeof(int32_t);
+}
+
+/** @brief Get the next value of a xorshift pseudo-random sequence.
+ *
+ *  @return Pseudo-random value.
+ */
+static uint32_t get_random(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+
+    return random_state;
+}
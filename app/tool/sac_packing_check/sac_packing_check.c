@@ -0,0 +1,340 @@
+/** @file  sac_packing_check.c
+ *  @brief This tool checks every SPARK Audio Core packing mode against a reference and measures its throughput.
+ *
+ *  The reference converts one sample at a time, reading and writing the packed samples bit by bit. Random packets of
+ *  every sample count up to a few blocks are converted by both, at every buffer alignment, and must match bit for
+ *  bit. The bytes following the packet must be left untouched. The sign extension modes are also checked in place.
+ *  The throughput of each mode is then measured on a packet of PACKET_SAMPLE_COUNT samples.
+ *
+ *  Usage: sac_packing_check_host [iteration_count]
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sac_packing.h"
+
+/* CONSTANTS ******************************************************************/
+/* Default number of measured process calls per mode. */
+#define ITERATION_COUNT     10000
+/* Largest number of samples of a checked packet, covers a few blocks and every remainder. */
+#define MAX_CHECKED_SAMPLES 37
+/* Number of random packets checked per sample count and alignment. */
+#define CHECK_REPEAT_COUNT  16
+/* Number of samples of a measured packet, 48 kHz stereo during 5 ms. */
+#define PACKET_SAMPLE_COUNT 480
+/* Size of the buffers, large enough for a measured packet of 32-bit samples. */
+#define BUFFER_SIZE         (PACKET_SAMPLE_COUNT * sizeof(uint32_t) + sizeof(uint32_t))
+/* Value of the bytes which must not be written. */
+#define GUARD_BYTE          0xA5
+/* Largest buffer misalignment checked. */
+#define MAX_ALIGNMENT       3
+#define NS_PER_SECOND       1000000000ULL
+
+/* TYPES **********************************************************************/
+/** @brief Reference description of a packing mode.
+ *
+ *  The output sample is the input sample shifted right, sign extended, then shifted left.
+ */
+typedef struct packing_reference {
+    /*! Packing mode. */
+    sac_packing_mode_t mode;
+    /*! Name of the mode. */
+    const char *name;
+    /*! Size of an input sample in bits, 32 for 32-bit words. */
+    uint8_t input_bits;
+    /*! Size of an output sample in bits, 32 for 32-bit words. */
+    uint8_t output_bits;
+    /*! Right shift applied first. */
+    uint8_t right_shift;
+    /*! Bit depth of the sign extension, 0 for none. */
+    uint8_t sign_bits;
+    /*! Left shift applied last. */
+    uint8_t left_shift;
+} packing_reference_t;
+
+/* PRIVATE GLOBALS ************************************************************/
+static const packing_reference_t references[] = {
+    {SAC_PACK_18BITS, "pack_18b", 32, 18, 2, 0, 0},
+    {SAC_PACK_20BITS, "pack_20b", 32, 20, 0, 0, 0},
+    {SAC_PACK_24BITS, "pack_24b", 32, 24, 0, 0, 0},
+    {SAC_PACK_32BITS_24BITS, "pack_32b_to_24b", 32, 24, 8, 0, 0},
+    {SAC_PACK_20BITS_16BITS, "pack_20b_to_16b", 32, 16, 4, 0, 0},
+    {SAC_PACK_24BITS_16BITS, "pack_24b_to_16b", 32, 16, 8, 0, 0},
+    {SAC_PACK_24BITS_20BITS, "pack_24b_to_20b", 32, 20, 4, 0, 0},
+    {SAC_SCALE_24BITS_16BITS, "scale_24b_to_16b", 24, 16, 8, 0, 0},
+    {SAC_SCALE_24BITS_20BITS, "scale_24b_to_20b", 24, 20, 4, 0, 0},
+    {SAC_SCALE_20BITS_24BITS, "scale_20b_to_24b", 20, 24, 0, 0, 4},
+    {SAC_SCALE_16BITS_24BITS, "scale_16b_to_24b", 16, 24, 0, 0, 8},
+    {SAC_UNPACK_18BITS, "unpack_18b", 18, 32, 0, 18, 2},
+    {SAC_UNPACK_20BITS, "unpack_20b", 20, 32, 0, 20, 0},
+    {SAC_UNPACK_24BITS, "unpack_24b", 24, 32, 0, 24, 0},
+    {SAC_UNPACK_20BITS_16BITS, "unpack_16b_to_20b", 16, 32, 0, 16, 4},
+    {SAC_UNPACK_24BITS_16BITS, "unpack_16b_to_24b", 16, 32, 0, 16, 8},
+    {SAC_UNPACK_24BITS_20BITS, "unpack_20b_to_24b", 20, 32, 0, 20, 4},
+    {SAC_EXTEND_18BITS, "extend_18b", 32, 32, 2, 18, 2},
+    {SAC_EXTEND_20BITS, "extend_20b", 32, 32, 0, 20, 0},
+    {SAC_EXTEND_24BITS, "extend_24b", 32, 32, 0, 24, 0},
+};
+
+static uint8_t input_buffer[BUFFER_SIZE];
+static uint8_t output_buffer[BUFFER_SIZE];
+static uint8_t expected_buffer[BUFFER_SIZE];
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static uint32_t check_mode(const packing_reference_t *reference);
+static uint32_t check_packet(const packing_reference_t *reference, uint16_t sample_count, uint8_t alignment,
+                             bool in_place);
+static uint16_t reference_process(const packing_reference_t *reference, const uint8_t *data_in, uint16_t size,
+                                  uint8_t *data_out);
+static uint32_t reference_convert(const packing_reference_t *reference, uint32_t sample);
+static uint32_t read_bits(const uint8_t *data, uint32_t bit_offset, uint8_t bit_count);
+static void write_bits(uint8_t *data, uint32_t bit_offset, uint8_t bit_count, uint32_t value);
+static double measure_mode(const packing_reference_t *reference, uint32_t iteration_count);
+static uint64_t get_time_ns(void);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t iteration_count = ITERATION_COUNT;
+    uint32_t error_count = 0;
+    uint32_t mode_error_count;
+
+    if (argc > 1) {
+        iteration_count = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    srand(1);
+
+    printf("mode,errors,ns_per_sample\n");
+    for (uint16_t i = 0; i < (sizeof(references) / sizeof(references[0])); i++) {
+        mode_error_count = check_mode(&references[i]);
+        printf("%s,%" PRIu32 ",%.3f\n", references[i].name, mode_error_count,
+               measure_mode(&references[i], iteration_count));
+        error_count += mode_error_count;
+    }
+
+    return (error_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Check a packing mode on packets of every sample count and alignment.
+ *
+ *  @param[in] reference  Reference description of the mode.
+ *  @return Number of packets not matching the reference.
+ */
+static uint32_t check_mode(const packing_reference_t *reference)
+{
+    bool in_place = (reference->input_bits == reference->output_bits);
+    uint32_t error_count = 0;
+
+    for (uint16_t sample_count = 0; sample_count <= MAX_CHECKED_SAMPLES; sample_count++) {
+        for (uint8_t alignment = 0; alignment <= MAX_ALIGNMENT; alignment++) {
+            for (uint8_t repeat = 0; repeat < CHECK_REPEAT_COUNT; repeat++) {
+                error_count += check_packet(reference, sample_count, alignment, false);
+                if (in_place) {
+                    error_count += check_packet(reference, sample_count, alignment, true);
+                }
+            }
+        }
+    }
+
+    return error_count;
+}
+
+/** @brief Convert a random packet with the processing stage and the reference, and compare them.
+ *
+ *  @param[in] reference     Reference description of the mode.
+ *  @param[in] sample_count  Number of samples in the packet.
+ *  @param[in] alignment     Offset of the buffers from a word boundary.
+ *  @param[in] in_place      True to convert the packet in place.
+ *  @return 1 if the output does not match the reference, 0 otherwise.
+ */
+static uint32_t check_packet(const packing_reference_t *reference, uint16_t sample_count, uint8_t alignment,
+                             bool in_place)
+{
+    sac_packing_instance_t instance = {.packing_mode = reference->mode};
+    sac_status_t status;
+    uint8_t *data_in = &input_buffer[alignment];
+    uint8_t *data_out = in_place ? data_in : &output_buffer[alignment];
+    uint16_t size = (uint16_t)(((uint32_t)sample_count * reference->input_bits + 7) / 8);
+    uint16_t expected_size;
+    uint16_t output_size;
+
+    for (uint16_t i = 0; i < size; i++) {
+        data_in[i] = (uint8_t)rand();
+    }
+    /* Padding bits of the last byte are zeros in a valid packet. */
+    if (((sample_count * reference->input_bits) % 8) != 0) {
+        data_in[size - 1] &= (uint8_t)((1U << ((sample_count * reference->input_bits) % 8)) - 1);
+    }
+    memset(&input_buffer[alignment + size], GUARD_BYTE, BUFFER_SIZE - alignment - size);
+    memset(output_buffer, GUARD_BYTE, BUFFER_SIZE);
+    memset(expected_buffer, GUARD_BYTE, BUFFER_SIZE);
+
+    expected_size = reference_process(reference, data_in, size, expected_buffer);
+
+    sac_packing_init(&instance, "packing", NULL, NULL, &status);
+    if (status != SAC_OK) {
+        printf("%s: initialization failed\n", reference->name);
+        return 1;
+    }
+    output_size = sac_packing_process(&instance, NULL, NULL, data_in, size, data_out, &status);
+
+    if ((status != SAC_OK) || (output_size != expected_size)) {
+        printf("%s: %u samples, %u bytes written instead of %u\n", reference->name, sample_count, output_size,
+               expected_size);
+        return 1;
+    }
+    if (memcmp(data_out, expected_buffer, output_size) != 0) {
+        printf("%s: %u samples, alignment %u%s, output mismatch\n", reference->name, sample_count, alignment,
+               in_place ? " in place" : "");
+        return 1;
+    }
+    for (uint16_t i = output_size; i < (BUFFER_SIZE - alignment); i++) {
+        if (data_out[i] != GUARD_BYTE) {
+            printf("%s: %u samples, byte %u written past the output\n", reference->name, sample_count, i);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/** @brief Convert a packet one sample at a time.
+ *
+ *  @param[in]  reference  Reference description of the mode.
+ *  @param[in]  data_in    Input packet.
+ *  @param[in]  size       Size of the input packet in bytes.
+ *  @param[out] data_out   Output packet.
+ *  @return Size of the output packet in bytes.
+ */
+static uint16_t reference_process(const packing_reference_t *reference, const uint8_t *data_in, uint16_t size,
+                                  uint8_t *data_out)
+{
+    uint16_t sample_count = (uint16_t)(((uint32_t)size * 8) / reference->input_bits);
+    uint16_t output_size = (uint16_t)(((uint32_t)sample_count * reference->output_bits + 7) / 8);
+    uint32_t sample;
+
+    memset(data_out, 0, output_size);
+    for (uint16_t i = 0; i < sample_count; i++) {
+        sample = read_bits(data_in, (uint32_t)i * reference->input_bits, reference->input_bits);
+        write_bits(data_out, (uint32_t)i * reference->output_bits, reference->output_bits,
+                   reference_convert(reference, sample));
+    }
+
+    return output_size;
+}
+
+/** @brief Convert a single sample.
+ *
+ *  @param[in] reference  Reference description of the mode.
+ *  @param[in] sample     Input sample.
+ *  @return Output sample.
+ */
+static uint32_t reference_convert(const packing_reference_t *reference, uint32_t sample)
+{
+    uint32_t sign_mask;
+
+    sample >>= reference->right_shift;
+    if (reference->sign_bits != 0) {
+        sign_mask = ~0U << reference->sign_bits;
+        if (sample & (1U << (reference->sign_bits - 1))) {
+            sample |= sign_mask;
+        } else {
+            sample &= ~sign_mask;
+        }
+    }
+
+    return sample << reference->left_shift;
+}
+
+/** @brief Read a little endian bit field.
+ *
+ *  @param[in] data        Buffer.
+ *  @param[in] bit_offset  Offset of the LSB of the field.
+ *  @param[in] bit_count   Number of bits, up to 32.
+ *  @return Field value.
+ */
+static uint32_t read_bits(const uint8_t *data, uint32_t bit_offset, uint8_t bit_count)
+{
+    uint32_t value = 0;
+
+    for (uint8_t i = 0; i < bit_count; i++) {
+        value |= (uint32_t)((data[(bit_offset + i) / 8] >> ((bit_offset + i) % 8)) & 1) << i;
+    }
+
+    return value;
+}
+
+/** @brief Write a little endian bit field.
+ *
+ *  @param[out] data        Buffer.
+ *  @param[in]  bit_offset  Offset of the LSB of the field.
+ *  @param[in]  bit_count   Number of bits, up to 32.
+ *  @param[in]  value       Field value, the bits above bit_count are ignored.
+ */
+static void write_bits(uint8_t *data, uint32_t bit_offset, uint8_t bit_count, uint32_t value)
+{
+    uint8_t mask;
+
+    for (uint8_t i = 0; i < bit_count; i++) {
+        mask = (uint8_t)(1U << ((bit_offset + i) % 8));
+        if ((value >> i) & 1) {
+            data[(bit_offset + i) / 8] |= mask;
+        } else {
+            data[(bit_offset + i) / 8] &= (uint8_t)~mask;
+        }
+    }
+}
+
+/** @brief Measure the processing time of a packing mode.
+ *
+ *  @param[in] reference        Reference description of the mode.
+ *  @param[in] iteration_count  Number of measured process calls.
+ *  @return Average processing time per sample in nanoseconds.
+ */
+static double measure_mode(const packing_reference_t *reference, uint32_t iteration_count)
+{
+    sac_packing_instance_t instance = {.packing_mode = reference->mode};
+    sac_status_t status;
+    uint16_t size = (PACKET_SAMPLE_COUNT * reference->input_bits) / 8;
+    uint64_t start;
+
+    if (iteration_count == 0) {
+        return 0;
+    }
+
+    for (uint16_t i = 0; i < size; i++) {
+        input_buffer[i] = (uint8_t)rand();
+    }
+    sac_packing_init(&instance, "packing", NULL, NULL, &status);
+
+    start = get_time_ns();
+    for (uint32_t i = 0; i < iteration_count; i++) {
+        sac_packing_process(&instance, NULL, NULL, input_buffer, size, output_buffer, &status);
+    }
+
+    return (double)(get_time_ns() - start) / ((double)iteration_count * PACKET_SAMPLE_COUNT);
+}
+
+/** @brief Read the monotonic clock.
+ *
+ *  @return Time in nanoseconds.
+ */
+static uint64_t get_time_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * NS_PER_SECOND) + (uint64_t)now.tv_nsec;
+}
@@ -0,0 +1,355 @@
+/** @file  sac_zero_copy_check.c
+ *  @brief This tool checks the SPARK Audio Core pipelines rendering into the buffers of a direct consumer.
+ *
+ *  A producer endpoint feeds numbered packets to a single processing stage, which renders them into the buffers of a
+ *  consumer providing get_buffer and commit. The consumer lends a single buffer at a time. Every case processes a
+ *  packet and checks that the buffer taken from the consumer, if any, has been committed back: with the packet when
+ *  the stage succeeds, empty when the stage fails. A failing gate must not take a buffer at all, and a consumer whose
+ *  buffer is too small must drop the packet and have it counted as an overflow.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sac_api.h"
+#include "sac_footprint.h"
+
+/* CONSTANTS ******************************************************************/
+#define SAC_POOL_SIZE 8192
+#define PAYLOAD_SIZE  16
+#define QUEUE_SIZE    2
+/* Size requested by the audio core for a consumer buffer, see render_to_consumer(). */
+#define REQUESTED_SIZE (PAYLOAD_SIZE + SAC_CDC_QUEUE_DATA_SIZE_INFLATION)
+
+/* TYPES **********************************************************************/
+/** @brief Consumer endpoint lending a single buffer.
+ */
+typedef struct direct_consumer {
+    /*! Number of bytes the buffer can hold. */
+    uint16_t capacity;
+    /*! Buffer lent to the audio core. */
+    uint8_t buffer[REQUESTED_SIZE];
+    /*! True while the buffer is lent to the audio core. */
+    bool lent;
+    /*! Number of buffers lent. */
+    uint32_t get_count;
+    /*! Number of buffers committed. */
+    uint32_t commit_count;
+    /*! Size of the last buffer committed. */
+    uint16_t commit_size;
+    /*! Number of buffers requested while the buffer was still lent. */
+    uint32_t leak_count;
+} direct_consumer_t;
+
+/** @brief Processing stage copying its input, which can be made to fail.
+ */
+typedef struct copy_stage {
+    /*! True to make the gate fail. */
+    bool fail_gate;
+    /*! True to make the process fail. */
+    bool fail_process;
+} copy_stage_t;
+
+/* PRIVATE GLOBALS ************************************************************/
+static uint8_t sac_memory_pool[SAC_POOL_SIZE];
+static direct_consumer_t consumer_instance;
+static copy_stage_t stage_instance;
+static uint8_t packet_number;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static bool check_case(sac_pipeline_t *pipeline, const char *name, bool expect_rendered);
+static uint16_t producer_action(void *instance, uint8_t *samples, uint16_t size);
+static uint16_t consumer_action(void *instance, uint8_t *samples, uint16_t size);
+static void ep_no_op(void *instance);
+static uint8_t *consumer_get_buffer(void *instance, uint16_t size);
+static uint16_t consumer_commit(void *instance, uint8_t *buffer, uint16_t size);
+static uint16_t copy_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                             uint16_t size, uint8_t *data_out, sac_status_t *status);
+static bool copy_gate(sac_processing_t *process, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                      uint16_t size, sac_status_t *status);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(void)
+{
+    sac_status_t status = SAC_OK;
+    sac_endpoint_t *producer = NULL;
+    sac_endpoint_t *consumer = NULL;
+    sac_processing_t *process = NULL;
+    sac_pipeline_t *pipeline = NULL;
+    bool passed = true;
+
+    sac_cfg_t core_cfg = {
+        .memory_pool = sac_memory_pool,
+        .memory_pool_size = SAC_POOL_SIZE,
+    };
+    sac_endpoint_interface_t producer_iface = {
+        .action = producer_action,
+        .start = ep_no_op,
+        .stop = ep_no_op,
+    };
+    sac_endpoint_interface_t consumer_iface = {
+        .action = consumer_action,
+        .start = ep_no_op,
+        .stop = ep_no_op,
+        .get_buffer = consumer_get_buffer,
+        .commit = consumer_commit,
+    };
+    sac_endpoint_cfg_t ep_cfg = {
+        .use_encapsulation = false,
+        .delayed_action = false,
+        .channel_count = 1,
+        .audio_payload_size = PAYLOAD_SIZE,
+        .queue_size = QUEUE_SIZE,
+    };
+    sac_processing_interface_t stage_iface = {
+        .process = copy_process,
+        .gate = copy_gate,
+    };
+    sac_pipeline_cfg_t pipeline_cfg = {0};
+
+    sac_init(core_cfg, &status);
+    if (status == SAC_OK) {
+        producer = sac_endpoint_init(NULL, "Producer", producer_iface, ep_cfg, &status);
+    }
+    if (status == SAC_OK) {
+        consumer = sac_endpoint_init(&consumer_instance, "Direct Consumer", consumer_iface, ep_cfg, &status);
+    }
+    if (status == SAC_OK) {
+        process = sac_processing_stage_init(&stage_instance, "Copy", stage_iface, &status);
+    }
+    if (status == SAC_OK) {
+        pipeline = sac_pipeline_init("Pipeline", producer, pipeline_cfg, consumer, &status);
+    }
+    if (status == SAC_OK) {
+        sac_pipeline_add_processing(pipeline, process, &status);
+    }
+    if (status == SAC_OK) {
+        sac_pipeline_setup(pipeline, &status);
+    }
+    if (status == SAC_OK) {
+        sac_pipeline_start(pipeline, &status);
+    }
+    if (status != SAC_OK) {
+        printf("Pipeline initialization failed with status %d\n", (int)status);
+        return EXIT_FAILURE;
+    }
+
+    consumer_instance.capacity = REQUESTED_SIZE;
+    passed &= check_case(pipeline, "rendered", true);
+
+    stage_instance.fail_process = true;
+    passed &= check_case(pipeline, "failing process", false);
+    stage_instance.fail_process = false;
+
+    stage_instance.fail_gate = true;
+    passed &= check_case(pipeline, "failing gate", false);
+    stage_instance.fail_gate = false;
+
+    consumer_instance.capacity = REQUESTED_SIZE - 1;
+    passed &= check_case(pipeline, "consumer buffer too small", false);
+    consumer_instance.capacity = REQUESTED_SIZE;
+
+    passed &= check_case(pipeline, "rendered after the failures", true);
+
+    printf("%s\n", passed ? "PASSED" : "FAILED");
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Produce and process a packet, then check what the consumer received.
+ *
+ *  @param[in] pipeline         Pipeline instance.
+ *  @param[in] name             Name of the case.
+ *  @param[in] expect_rendered  True if the packet must reach the consumer.
+ *  @retval true   The consumer buffers are accounted for and hold the expected packet.
+ *  @retval false  A buffer has been leaked or the consumer received an unexpected packet.
+ */
+static bool check_case(sac_pipeline_t *pipeline, const char *name, bool expect_rendered)
+{
+    sac_status_t status = SAC_OK;
+    uint32_t get_count = consumer_instance.get_count;
+    uint32_t commit_count = consumer_instance.commit_count;
+    uint32_t overflow_count = pipeline->_statistics.consumer_buffer_overflow_count;
+    uint8_t expected[PAYLOAD_SIZE];
+    bool passed = true;
+
+    sac_pipeline_produce(pipeline, &status);
+    if (status != SAC_OK) {
+        printf("%-28s produce failed with status %d\n", name, (int)status);
+        return false;
+    }
+    memset(expected, packet_number, sizeof(expected));
+    sac_pipeline_process(pipeline, &status);
+
+    /* Every buffer taken is given back, whatever the outcome of the processing. */
+    passed &= !consumer_instance.lent && (consumer_instance.leak_count == 0);
+    passed &= ((consumer_instance.get_count - get_count) == (consumer_instance.commit_count - commit_count));
+    if (expect_rendered) {
+        passed &= (status == SAC_OK) && ((consumer_instance.commit_count - commit_count) == 1) &&
+                  (consumer_instance.commit_size == PAYLOAD_SIZE) &&
+                  (memcmp(consumer_instance.buffer, expected, PAYLOAD_SIZE) == 0);
+    } else if (consumer_instance.commit_count != commit_count) {
+        /* A buffer taken for a packet which could not be rendered is committed empty. */
+        passed &= (consumer_instance.commit_size == 0);
+    }
+    if (stage_instance.fail_gate) {
+        passed &= (consumer_instance.get_count == get_count);
+    }
+    if (consumer_instance.capacity < REQUESTED_SIZE) {
+        passed &= (pipeline->_statistics.consumer_buffer_overflow_count == (overflow_count + 1));
+    }
+
+    printf("%-28s status %4d, buffers taken %lu, committed %lu (last %u bytes) %s\n", name, (int)status,
+           (unsigned long)(consumer_instance.get_count - get_count),
+           (unsigned long)(consumer_instance.commit_count - commit_count), consumer_instance.commit_size,
+           passed ? "ok" : "FAILED");
+
+    return passed;
+}
+
+/** @brief Produce a packet filled with its number.
+ *
+ *  @param[in]  instance  Unused.
+ *  @param[out] samples   Produced samples.
+ *  @param[in]  size      Size of samples to produce in bytes.
+ *  @return Number of bytes produced.
+ */
+static uint16_t producer_action(void *instance, uint8_t *samples, uint16_t size)
+{
+    (void)instance;
+
+    memset(samples, ++packet_number, size);
+
+    return size;
+}
+
+/** @brief Consume a packet, never called for a direct consumer.
+ *
+ *  @param[in] instance  Unused.
+ *  @param[in] samples   Unused.
+ *  @param[in] size      Size of samples to consume in bytes.
+ *  @return Number of bytes consumed.
+ */
+static uint16_t consumer_action(void *instance, uint8_t *samples, uint16_t size)
+{
+    (void)instance;
+    (void)samples;
+
+    return size;
+}
+
+/** @brief Start or stop an endpoint.
+ *
+ *  @param[in] instance  Unused.
+ */
+static void ep_no_op(void *instance)
+{
+    (void)instance;
+}
+
+/** @brief Lend the buffer of the consumer.
+ *
+ *  @param[in] instance  Consumer instance.
+ *  @param[in] size      Largest number of bytes the audio core may write.
+ *  @return The buffer, NULL if it can not hold size bytes.
+ */
+static uint8_t *consumer_get_buffer(void *instance, uint16_t size)
+{
+    direct_consumer_t *consumer = instance;
+
+    if (size > consumer->capacity) {
+        return NULL;
+    }
+    if (consumer->lent) {
+        /* The buffer of a previous packet has never been committed. */
+        consumer->leak_count++;
+    }
+    consumer->lent = true;
+    consumer->get_count++;
+    memset(consumer->buffer, 0, sizeof(consumer->buffer));
+
+    return consumer->buffer;
+}
+
+/** @brief Take back the buffer lent by consumer_get_buffer().
+ *
+ *  @param[in] instance  Consumer instance.
+ *  @param[in] buffer    Buffer.
+ *  @param[in] size      Size of the packet in bytes.
+ *  @return Number of bytes consumed.
+ */
+static uint16_t consumer_commit(void *instance, uint8_t *buffer, uint16_t size)
+{
+    direct_consumer_t *consumer = instance;
+
+    if (consumer->lent && (buffer == consumer->buffer)) {
+        consumer->lent = false;
+        consumer->commit_count++;
+        consumer->commit_size = size;
+    }
+
+    return size;
+}
+
+/** @brief Copy the packet, or fail.
+ *
+ *  @param[in]  instance  Stage instance.
+ *  @param[in]  pipeline  Unused.
+ *  @param[in]  header    Unused.
+ *  @param[in]  data_in   Input samples.
+ *  @param[in]  size      Size of the input samples in bytes.
+ *  @param[out] data_out  Output samples.
+ *  @param[out] status    Status code.
+ *  @return Number of bytes output.
+ */
+static uint16_t copy_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                             uint16_t size, uint8_t *data_out, sac_status_t *status)
+{
+    copy_stage_t *stage = instance;
+
+    (void)pipeline;
+    (void)header;
+
+    if (stage->fail_process) {
+        *status = SAC_ERR_INVALID_PACKET_SIZE;
+        return 0;
+    }
+    memcpy(data_out, data_in, size);
+
+    return size;
+}
+
+/** @brief Let the packet be processed, or fail.
+ *
+ *  @param[in]  process   Processing stage.
+ *  @param[in]  pipeline  Unused.
+ *  @param[in]  header    Unused.
+ *  @param[in]  data_in   Unused.
+ *  @param[in]  size      Unused.
+ *  @param[out] status    Status code.
+ *  @return True if the packet is processed.
+ */
+static bool copy_gate(sac_processing_t *process, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                      uint16_t size, sac_status_t *status)
+{
+    copy_stage_t *stage = process->instance;
+
+    (void)pipeline;
+    (void)header;
+    (void)data_in;
+    (void)size;
+
+    if (stage->fail_gate) {
+        *status = SAC_ERR_INVALID_ARG;
+        return false;
+    }
+
+    return true;
+}
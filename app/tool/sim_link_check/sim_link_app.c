@@ -0,0 +1,344 @@
+/** @file  sim_link_app.c
+ *  @brief Application of the simulated nodes of the sim_link_check scenario.
+ *
+ *  The same source is built as the Coordinator module and as the Node module, SIM_LINK_COORDINATOR selecting the
+ *  role. Each side sends a 16-bit sequence number in its own timeslot as fast as its queue allows and checks the
+ *  continuity of the sequence numbers it receives. The counters are read by the scenario through the exported
+ *  sim_link_get_stats(). A SIM_LINK_WINDOW_SIZE larger than 1 enables selective repeat with guaranteed delivery on
+ *  both connections, a non-zero SIM_LINK_TX_LIMIT stops the transmissions after that many frames and
+ *  SIM_LINK_ADAPTIVE_CCA enables the CCA with the adaptive backoff on the TX connection.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <string.h>
+#include "sim_link_app.h"
+#include "swc_api.h"
+
+/* CONSTANTS ******************************************************************/
+#define SWC_MEM_POOL_SIZE 8192
+#define QUEUE_SIZE        4
+#define PAYLOAD_SIZE      sizeof(uint16_t)
+
+#define PAN_ID              0xABC
+#define COORDINATOR_ADDRESS 0x01
+#define NODE_ADDRESS        0x02
+
+#define PULSE_COUNT 1
+#define PULSE_WIDTH 6
+#define PULSE_GAIN  0
+
+#ifndef SIM_LINK_WINDOW_SIZE
+#define SIM_LINK_WINDOW_SIZE 1
+#endif
+#ifndef SIM_LINK_TX_LIMIT
+#define SIM_LINK_TX_LIMIT 0
+#endif
+#ifndef SIM_LINK_ADAPTIVE_CCA
+#define SIM_LINK_ADAPTIVE_CCA 0
+#endif
+
+#define CCA_TRY_COUNT  4
+#define CCA_RETRY_TIME 204
+
+#if SIM_LINK_COORDINATOR
+#define LOCAL_ADDRESS  COORDINATOR_ADDRESS
+#define REMOTE_ADDRESS NODE_ADDRESS
+#define ROLE           SWC_ROLE_COORDINATOR
+#define TX_TIMESLOTS   {MAIN_TIMESLOT(0)}
+#define RX_TIMESLOTS   {MAIN_TIMESLOT(1)}
+#else
+#define LOCAL_ADDRESS  NODE_ADDRESS
+#define REMOTE_ADDRESS COORDINATOR_ADDRESS
+#define ROLE           SWC_ROLE_NODE
+#define TX_TIMESLOTS   {MAIN_TIMESLOT(1)}
+#define RX_TIMESLOTS   {MAIN_TIMESLOT(0)}
+#endif
+
+/* MACROS *********************************************************************/
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+#define EXPORT        __attribute__((visibility("default")))
+
+/* PRIVATE GLOBALS ************************************************************/
+static uint8_t swc_memory_pool[SWC_MEM_POOL_SIZE];
+static swc_connection_t *tx_conn;
+static swc_connection_t *rx_conn;
+
+static const uint32_t timeslot_us[] = {500, 500};
+static const uint32_t channel_sequence[] = {0, 1, 2, 3, 4};
+static const uint32_t channel_frequency[SIM_LINK_CHANNEL_COUNT] = SIM_LINK_CHANNEL_FREQUENCIES;
+static int32_t tx_timeslots[] = TX_TIMESLOTS;
+static int32_t rx_timeslots[] = RX_TIMESLOTS;
+
+static sim_link_stats_t stats;
+static uint16_t tx_sequence;
+static uint16_t rx_sequence;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void add_channels(swc_connection_t *conn, swc_error_t *err);
+static void set_retransmission_window(swc_connection_t *conn, swc_error_t *err);
+static void set_adaptive_cca(swc_connection_t *conn, swc_error_t *err);
+static void context_switch_trigger(void);
+static void conn_tx_success_callback(void *conn, void *arg);
+static void conn_tx_fail_callback(void *conn, void *arg);
+static void conn_rx_success_callback(void *conn, void *arg);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+EXPORT void sim_app_init(void)
+{
+    swc_error_t err = SWC_ERR_NONE;
+    swc_cfg_t core_cfg = {
+        .timeslot_sequence = timeslot_us,
+        .timeslot_sequence_length = ARRAY_SIZE(timeslot_us),
+        .channel_sequence = channel_sequence,
+        .channel_sequence_length = ARRAY_SIZE(channel_sequence),
+        .concurrency_mode = SWC_CONCURRENCY_MODE_HIGH_PERFORMANCE,
+        .memory_pool = swc_memory_pool,
+        .memory_pool_size = SWC_MEM_POOL_SIZE,
+    };
+    swc_node_cfg_t node_cfg = {
+        .role = ROLE,
+        .pan_id = PAN_ID,
+        .coordinator_address = COORDINATOR_ADDRESS,
+        .local_address = LOCAL_ADDRESS,
+    };
+    swc_connection_cfg_t tx_conn_cfg = {
+        .name = "TX Connection",
+        .source_address = LOCAL_ADDRESS,
+        .destination_address = REMOTE_ADDRESS,
+        .max_payload_size = PAYLOAD_SIZE,
+        .queue_size = QUEUE_SIZE,
+        .timeslot_id = tx_timeslots,
+        .timeslot_count = ARRAY_SIZE(tx_timeslots),
+    };
+    swc_connection_cfg_t rx_conn_cfg = {
+        .name = "RX Connection",
+        .source_address = REMOTE_ADDRESS,
+        .destination_address = LOCAL_ADDRESS,
+        .max_payload_size = PAYLOAD_SIZE,
+        .queue_size = QUEUE_SIZE,
+        .timeslot_id = rx_timeslots,
+        .timeslot_count = ARRAY_SIZE(rx_timeslots),
+    };
+
+    swc_init(core_cfg, node_cfg, context_switch_trigger, &err);
+    if (err == SWC_ERR_NONE) {
+        swc_radio_module_init(SWC_RADIO_ID_1, true, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        tx_conn = swc_connection_init(tx_conn_cfg, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        set_adaptive_cca(tx_conn, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        add_channels(tx_conn, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        set_retransmission_window(tx_conn, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        swc_connection_set_tx_success_callback(tx_conn, conn_tx_success_callback, NULL, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        swc_connection_set_tx_fail_callback(tx_conn, conn_tx_fail_callback, NULL, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        rx_conn = swc_connection_init(rx_conn_cfg, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        add_channels(rx_conn, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        set_retransmission_window(rx_conn, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        swc_connection_set_rx_success_callback(rx_conn, conn_rx_success_callback, NULL, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        swc_setup(&err);
+    }
+    if (err == SWC_ERR_NONE) {
+        swc_connect(&err);
+    }
+    stats.init_error = (int32_t)err;
+    stats.tx_limit = SIM_LINK_TX_LIMIT;
+    stats.adaptive_cca = SIM_LINK_ADAPTIVE_CCA;
+}
+
+EXPORT void sim_app_process(void)
+{
+    swc_error_t err = SWC_ERR_NONE;
+    uint8_t *payload = NULL;
+
+    /* The callbacks run in the main context, below the radio IRQ priority. */
+    swc_connection_callbacks_processing_handler();
+
+    if ((stats.init_error != (int32_t)SWC_ERR_NONE) || (swc_get_status() != SWC_STATUS_RUNNING)) {
+        return;
+    }
+    if ((stats.tx_limit != 0) && (stats.tx_count >= stats.tx_limit)) {
+        return;
+    }
+
+    swc_connection_get_payload_buffer(tx_conn, &payload, &err);
+    if (payload != NULL) {
+        memcpy(payload, &tx_sequence, sizeof(tx_sequence));
+        swc_connection_send(tx_conn, payload, PAYLOAD_SIZE, &err);
+        if (err == SWC_ERR_NONE) {
+            tx_sequence++;
+            stats.tx_count++;
+        }
+    }
+}
+
+EXPORT void sim_link_get_stats(sim_link_stats_t *link_stats)
+{
+    swc_error_t err = SWC_ERR_NONE;
+
+    for (uint8_t i = 0; (i < SIM_LINK_CHANNEL_COUNT) && stats.adaptive_cca; i++) {
+        stats.busy_ratio[i] = swc_connection_get_channel_busy_ratio(tx_conn, i, &err);
+    }
+    *link_stats = stats;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Add every channel of the sequence to a connection.
+ *
+ *  @param[in]  conn  Connection.
+ *  @param[out] err   Wireless Core error code.
+ */
+static void add_channels(swc_connection_t *conn, swc_error_t *err)
+{
+    swc_channel_cfg_t channel_cfg = {
+        .tx_pulse_count = PULSE_COUNT,
+        .tx_pulse_width = PULSE_WIDTH,
+        .tx_pulse_gain = PULSE_GAIN,
+        .rx_pulse_count = PULSE_COUNT,
+    };
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(channel_frequency); i++) {
+        channel_cfg.frequency = channel_frequency[i];
+        swc_connection_add_channel(conn, channel_cfg, err);
+        if (*err != SWC_ERR_NONE) {
+            return;
+        }
+    }
+}
+
+/** @brief Enable selective repeat on a connection when SIM_LINK_WINDOW_SIZE is larger than 1.
+ *
+ *  @param[in]  conn  Connection.
+ *  @param[out] err   Wireless Core error code.
+ */
+static void set_retransmission_window(swc_connection_t *conn, swc_error_t *err)
+{
+    if (SIM_LINK_WINDOW_SIZE <= 1) {
+        return;
+    }
+
+    swc_connection_set_acknowledgement(conn, true, err);
+    if (*err == SWC_ERR_NONE) {
+        swc_connection_set_retransmission(conn, true, 0, 0, err);
+    }
+    if (*err == SWC_ERR_NONE) {
+        swc_connection_set_retransmission_window(conn, SIM_LINK_WINDOW_SIZE, err);
+    }
+}
+
+/** @brief Enable the CCA with the adaptive backoff on a connection when SIM_LINK_ADAPTIVE_CCA is set.
+ *
+ *  @param[in]  conn  Connection.
+ *  @param[out] err   Wireless Core error code.
+ */
+static void set_adaptive_cca(swc_connection_t *conn, swc_error_t *err)
+{
+    swc_connection_concurrency_cfg_t concurrency_cfg = {
+        .enabled = true,
+        .try_count = CCA_TRY_COUNT,
+        .retry_time = CCA_RETRY_TIME,
+        .fail_action = SWC_CCA_ABORT_TX,
+    };
+
+    if (!SIM_LINK_ADAPTIVE_CCA) {
+        return;
+    }
+
+    swc_connection_set_concurrency_cfg(conn, &concurrency_cfg, err);
+    if (*err == SWC_ERR_NONE) {
+        swc_connection_set_adaptive_cca(conn, true, err);
+    }
+}
+
+/** @brief Trigger the callback processing.
+ *
+ *  The callbacks are processed by sim_app_process() instead of a low priority software interrupt.
+ */
+static void context_switch_trigger(void)
+{
+}
+
+/** @brief Callback function when a previously sent frame has been ACK'd.
+ *
+ *  @param[in] conn  Connection the callback function has been linked to.
+ *  @param[in] arg   Additional argument for the callback function.
+ */
+static void conn_tx_success_callback(void *conn, void *arg)
+{
+    (void)conn;
+    (void)arg;
+
+    stats.tx_success_count++;
+}
+
+/** @brief Callback function when a previously sent frame has not been ACK'd.
+ *
+ *  @param[in] conn  Connection the callback function has been linked to.
+ *  @param[in] arg   Additional argument for the callback function.
+ */
+static void conn_tx_fail_callback(void *conn, void *arg)
+{
+    (void)conn;
+    (void)arg;
+
+    stats.tx_fail_count++;
+}
+
+/** @brief Callback function when a frame has been successfully received.
+ *
+ *  @param[in] conn  Connection the callback function has been linked to.
+ *  @param[in] arg   Additional argument for the callback function.
+ */
+static void conn_rx_success_callback(void *conn, void *arg)
+{
+    (void)conn;
+    (void)arg;
+
+    swc_error_t err = SWC_ERR_NONE;
+    uint8_t *payload = NULL;
+    uint16_t size;
+    uint16_t sequence;
+
+    size = swc_connection_receive(rx_conn, &payload, &err);
+    if ((err != SWC_ERR_NONE) || (payload == NULL)) {
+        return;
+    }
+
+    if (size == PAYLOAD_SIZE) {
+        memcpy(&sequence, payload, sizeof(sequence));
+        /* The first frame received sets the reference, later frames must follow without gap. */
+        if ((stats.rx_count != 0) && (sequence != rx_sequence)) {
+            stats.rx_sequence_error_count++;
+        }
+        rx_sequence = sequence + 1;
+    } else {
+        stats.rx_sequence_error_count++;
+    }
+    stats.rx_count++;
+
+    swc_connection_receive_complete(rx_conn, &err);
+}
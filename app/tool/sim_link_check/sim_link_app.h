@@ -0,0 +1,62 @@
+/** @file  sim_link_app.h
+ *  @brief Interface between the sim_link_check scenario and its simulated node application.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SIM_LINK_APP_H_
+#define SIM_LINK_APP_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Name of the function a node module exports to report its link statistics. */
+#define SIM_LINK_GET_STATS_SYMBOL "sim_link_get_stats"
+
+/*! Number of channels of the link. */
+#define SIM_LINK_CHANNEL_COUNT 5
+/*! Frequency of every channel of the link. */
+#define SIM_LINK_CHANNEL_FREQUENCIES {163, 171, 179, 187, 195}
+/*! Time the interferer module occupies the channels once its radio is powered up, in milliseconds. */
+#define SIM_LINK_INTERFERENCE_MS 500
+
+/* TYPES **********************************************************************/
+/** @brief Link statistics of a simulated node.
+ */
+typedef struct sim_link_stats {
+    /*! Wireless Core error code of the initialization. */
+    int32_t init_error;
+    /*! Number of frames to send, 0 if the node sends until the end of the run. */
+    uint32_t tx_limit;
+    /*! Number of frames queued for transmission. */
+    uint32_t tx_count;
+    /*! Number of transmissions reported successful. */
+    uint32_t tx_success_count;
+    /*! Number of transmissions reported failed. */
+    uint32_t tx_fail_count;
+    /*! Number of frames received. */
+    uint32_t rx_count;
+    /*! Number of frames received with an unexpected size or sequence number. */
+    uint32_t rx_sequence_error_count;
+    /*! Adaptive CCA backoff is enabled on the TX connection. */
+    bool adaptive_cca;
+    /*! Busy ratio of every channel learned by the adaptive CCA backoff, in percent. */
+    uint8_t busy_ratio[SIM_LINK_CHANNEL_COUNT];
+} sim_link_stats_t;
+
+/*! Statistics function exported by a node module. */
+typedef void (*sim_link_get_stats_t)(sim_link_stats_t *link_stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_LINK_APP_H_ */
@@ -0,0 +1,292 @@
+/** @file  sim_link_check.c
+ *  @brief This tool runs a Coordinator and a Node on the WPS simulator and checks the link between them.
+ *
+ *  Both nodes load the sim_link_app module built for their role and exchange sequence numbers in their own timeslot
+ *  over a channel losing the given part of the frames, none by default. Once the simulated time has elapsed, every
+ *  node must have been initialized without error, have received most of the frames sent by the other one, have seen
+ *  no gap in their sequence numbers and have been notified at most once of the success of each frame sent. A node
+ *  sending a limited number of frames must have been notified of the success of every one of them.
+ *
+ *  An interferer module can be added to occupy the channels for SIM_LINK_INTERFERENCE_MS once the radios are powered
+ *  up. Nodes running the adaptive CCA backoff must have learned a busy ratio above the level where a persistently busy
+ *  channel is usable again by the end of the interference, and below it by the end of the run. The simulator maps
+ *  every channel of the link to the same RF channel, so the interference is seen on all of them.
+ *
+ *  Usage: sim_link_check_host <coordinator module> <node module> [duration in ms] [loss in percent]
+ *                             [interferer module]
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "sim_channel.h"
+#include "sim_kernel.h"
+#include "sim_link_app.h"
+#include "sim_node.h"
+
+/* CONSTANTS ******************************************************************/
+#define LINK_NODE_COUNT     2
+#define NODE_COUNT          3
+#define DEFAULT_DURATION_MS 3000
+#define NS_PER_MS           1000000ULL
+
+#define CHANNEL_BITRATE_BPS 20480000
+/* Default preamble (210 chips) and SFD (32 chips) of the Wireless Core at 20.48 Mchip/s. */
+#define CHANNEL_PREAMBLE_NS 11816
+#define CHANNEL_SEED        1
+#define CHANNEL_RSSI        200
+#define CHANNEL_RNSI        20
+
+#define PROCESS_PERIOD_NS 100000
+/* The Node starts after the Coordinator, so it has to synchronize on a running network. */
+#define NODE_START_DELAY_NS (10 * NS_PER_MS)
+
+/* The radio is only powered up once the system time reaches POWER_UP_TIME, in sr_pwr_up(). */
+#define RADIO_POWER_UP_NS (1000 * NS_PER_MS)
+
+/* Duration of the timeslot sequence, each node transmits once per sequence. */
+#define SCHEDULE_DURATION_NS (1 * NS_PER_MS)
+/* Part of the sequences of the run that must be received, in percent, leaving room for the synchronization. */
+#define MIN_RX_RATIO_PERCENT 80
+
+/* The busy ratios are checked a bit before the interference ends. */
+#define INTERFERENCE_CHECK_NS (RADIO_POWER_UP_NS + ((SIM_LINK_INTERFERENCE_MS - 100) * NS_PER_MS))
+/* Busy ratio, in percent, below which a persistently busy channel is usable again (LINK_CCA_ADAPTIVE_BUSY_EXIT_LEVEL).
+ * The CCA retries find the short gaps between the interferer frames, so the ratio does not reliably reach the enter
+ * level.
+ */
+#define BUSY_EXIT_RATIO_PERCENT 25
+
+/* PRIVATE GLOBALS ************************************************************/
+static sim_kernel_t kernel;
+static sim_channel_t channel;
+static sim_node_t nodes[NODE_COUNT];
+static const char *const node_names[NODE_COUNT] = {"Coordinator", "Node", "Interferer"};
+static uint8_t node_count = LINK_NODE_COUNT;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static bool check_node(uint8_t index, sim_time_t duration_ns, uint32_t loss_percent);
+static bool check_interferer(void);
+static bool check_busy_ratio(uint8_t index, bool busy);
+static bool get_node_stats(uint8_t index, sim_link_stats_t *stats);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(int argc, char **argv)
+{
+    sim_time_t duration_ns = DEFAULT_DURATION_MS * NS_PER_MS;
+    uint32_t loss_percent = 0;
+    sim_channel_cfg_t channel_cfg = {
+        .bitrate_bps = CHANNEL_BITRATE_BPS,
+        .preamble_ns = CHANNEL_PREAMBLE_NS,
+        .seed = CHANNEL_SEED,
+        .default_loss = 0,
+        .rssi = CHANNEL_RSSI,
+        .rnsi = CHANNEL_RNSI,
+    };
+    sim_node_cfg_t node_cfg = {
+        .process_period_ns = PROCESS_PERIOD_NS,
+    };
+    bool passed = true;
+
+    if (argc < 3) {
+        printf("Usage: %s <coordinator module> <node module> [duration in ms] [loss in percent] [interferer module]\n",
+               argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 3) {
+        duration_ns = strtoull(argv[3], NULL, 0) * NS_PER_MS;
+    }
+    if (argc > 4) {
+        loss_percent = strtoul(argv[4], NULL, 0);
+    }
+    if (argc > 5) {
+        node_count = NODE_COUNT;
+    }
+    if (duration_ns <= (NODE_START_DELAY_NS + RADIO_POWER_UP_NS)) {
+        printf("The duration must leave time for the Node to power up its radio\n");
+        return EXIT_FAILURE;
+    }
+    if ((node_count > LINK_NODE_COUNT) && (duration_ns <= (RADIO_POWER_UP_NS + SIM_LINK_INTERFERENCE_MS * NS_PER_MS))) {
+        printf("The duration must leave time for the link to recover from the interference\n");
+        return EXIT_FAILURE;
+    }
+    /* A sequence is lost with the frame or with its ACK. */
+    if (loss_percent >= 50) {
+        printf("The loss must be lower than 50 percent\n");
+        return EXIT_FAILURE;
+    }
+    channel_cfg.default_loss = (loss_percent * SIM_LOSS_SCALE) / 100;
+
+    sim_kernel_init(&kernel);
+    sim_channel_init(&channel, &kernel, &channel_cfg);
+    for (uint8_t i = 0; i < node_count; i++) {
+        node_cfg.module_path = (i < LINK_NODE_COUNT) ? argv[1 + i] : argv[5];
+        if (!sim_node_init(&nodes[i], &kernel, &channel, &node_cfg)) {
+            printf("%s: cannot load %s\n", node_names[i], node_cfg.module_path);
+            return EXIT_FAILURE;
+        }
+    }
+    sim_node_start(&nodes[0], 0);
+    sim_node_start(&nodes[1], NODE_START_DELAY_NS);
+    if (node_count > LINK_NODE_COUNT) {
+        sim_node_start(&nodes[LINK_NODE_COUNT], 0);
+        sim_kernel_run_until(&kernel, INTERFERENCE_CHECK_NS);
+        printf("During the interference:\n");
+        for (uint8_t i = 0; i < LINK_NODE_COUNT; i++) {
+            passed &= check_busy_ratio(i, true);
+        }
+        printf("At the end of the run:\n");
+    }
+
+    sim_kernel_run_until(&kernel, duration_ns);
+
+    printf("%lu frames on air, %lu collisions, %lu lost\n", (unsigned long)channel.frame_count,
+           (unsigned long)channel.collision_count, (unsigned long)channel.loss_count);
+    for (uint8_t i = 0; i < LINK_NODE_COUNT; i++) {
+        passed &= check_node(i, duration_ns - NODE_START_DELAY_NS - RADIO_POWER_UP_NS, loss_percent);
+        passed &= check_busy_ratio(i, false);
+    }
+    if (node_count > LINK_NODE_COUNT) {
+        passed &= check_interferer();
+    }
+    for (uint8_t i = 0; i < node_count; i++) {
+        sim_node_deinit(&nodes[i]);
+    }
+
+    printf("%s\n", passed ? "PASSED" : "FAILED");
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Print and check the link statistics of a node.
+ *
+ *  @param[in] index         Index of the node.
+ *  @param[in] duration_ns   Time both radios have been running.
+ *  @param[in] loss_percent  Part of the frames lost by the channel.
+ *  @retval true   The node received the frames of its peer.
+ *  @retval false  The node failed to initialize, missed frames, received out of sequence frames or was notified of
+ *                 another number of successful transmissions than expected.
+ */
+static bool check_node(uint8_t index, sim_time_t duration_ns, uint32_t loss_percent)
+{
+    sim_link_stats_t stats = {0};
+    /* Each lost frame or ACK costs one sequence. */
+    uint32_t min_rx_count = (uint32_t)(((duration_ns / SCHEDULE_DURATION_NS) * MIN_RX_RATIO_PERCENT *
+                                        (100 - 2 * loss_percent)) / (100 * 100));
+    bool tx_passed;
+    bool passed;
+
+    if (!get_node_stats(index, &stats)) {
+        return false;
+    }
+    /* No frame gets through the interference. */
+    if (node_count > LINK_NODE_COUNT) {
+        min_rx_count -= (uint32_t)((((SIM_LINK_INTERFERENCE_MS * NS_PER_MS) / SCHEDULE_DURATION_NS) *
+                                    MIN_RX_RATIO_PERCENT) / 100);
+    }
+    /* Both nodes send as many frames. */
+    if ((stats.tx_limit != 0) && (min_rx_count > stats.tx_limit)) {
+        min_rx_count = stats.tx_limit;
+    }
+    if (stats.tx_limit != 0) {
+        tx_passed = (stats.tx_count == stats.tx_limit) && (stats.tx_success_count == stats.tx_count);
+    } else {
+        tx_passed = (stats.tx_success_count <= stats.tx_count);
+    }
+
+    printf("%-12s radio: tx %lu, auto-replies %lu, rx good %lu, rx rejected %lu, rx timeouts %lu\n", node_names[index],
+           (unsigned long)nodes[index].radio.stats.tx_frames, (unsigned long)nodes[index].radio.stats.tx_auto_replies,
+           (unsigned long)nodes[index].radio.stats.rx_good, (unsigned long)nodes[index].radio.stats.rx_rejected,
+           (unsigned long)nodes[index].radio.stats.rx_timeouts);
+    passed = (stats.init_error == 0) && (stats.rx_count >= min_rx_count) && (stats.rx_sequence_error_count == 0) &&
+             tx_passed;
+    printf("%-12s init %ld, tx %lu (success %lu, fail %lu), rx %lu (min %lu, sequence errors %lu) %s\n",
+           node_names[index], (long)stats.init_error, (unsigned long)stats.tx_count,
+           (unsigned long)stats.tx_success_count, (unsigned long)stats.tx_fail_count, (unsigned long)stats.rx_count,
+           (unsigned long)min_rx_count, (unsigned long)stats.rx_sequence_error_count, passed ? "ok" : "FAILED");
+
+    return passed;
+}
+
+/** @brief Print and check the statistics of the interferer.
+ *
+ *  @retval true   The interferer has been transmitting.
+ *  @retval false  The interferer failed to initialize or did not transmit.
+ */
+static bool check_interferer(void)
+{
+    sim_link_stats_t stats = {0};
+    bool passed;
+
+    if (!get_node_stats(LINK_NODE_COUNT, &stats)) {
+        return false;
+    }
+
+    passed = (stats.init_error == 0) && (stats.tx_count != 0);
+    printf("%-12s init %ld, tx %lu %s\n", node_names[LINK_NODE_COUNT], (long)stats.init_error,
+           (unsigned long)stats.tx_count, passed ? "ok" : "FAILED");
+
+    return passed;
+}
+
+/** @brief Print and check the busy ratios learned by the adaptive CCA backoff of a node.
+ *
+ *  Nothing is checked if the node does not run the adaptive CCA backoff.
+ *
+ *  @param[in] index  Index of the node.
+ *  @param[in] busy   The channels are expected to be busy, else clear.
+ *  @retval true   Every channel is in the expected state.
+ *  @retval false  A channel is not in the expected state.
+ */
+static bool check_busy_ratio(uint8_t index, bool busy)
+{
+    sim_link_stats_t stats = {0};
+    bool passed = true;
+
+    if (!get_node_stats(index, &stats)) {
+        return false;
+    }
+    if (!stats.adaptive_cca) {
+        return true;
+    }
+
+    printf("%-12s busy ratio:", node_names[index]);
+    for (uint8_t i = 0; i < SIM_LINK_CHANNEL_COUNT; i++) {
+        printf(" %u%%", stats.busy_ratio[i]);
+        if (busy) {
+            passed &= (stats.busy_ratio[i] >= BUSY_EXIT_RATIO_PERCENT);
+        } else {
+            passed &= (stats.busy_ratio[i] < BUSY_EXIT_RATIO_PERCENT);
+        }
+    }
+    printf(" %s\n", passed ? "ok" : "FAILED");
+
+    return passed;
+}
+
+/** @brief Get the statistics of a node.
+ *
+ *  @param[in]  index  Index of the node.
+ *  @param[out] stats  Statistics of the node.
+ *  @retval true   The statistics have been read.
+ *  @retval false  The node module does not export its statistics.
+ */
+static bool get_node_stats(uint8_t index, sim_link_stats_t *stats)
+{
+    sim_link_get_stats_t get_stats = (sim_link_get_stats_t)dlsym(nodes[index].module, SIM_LINK_GET_STATS_SYMBOL);
+
+    if (get_stats == NULL) {
+        printf("%s: %s is not exported\n", node_names[index], SIM_LINK_GET_STATS_SYMBOL);
+        return false;
+    }
+    get_stats(stats);
+
+    return true;
+}
@@ -0,0 +1,166 @@
+/** @file  sim_link_jammer.c
+ *  @brief Interferer module of the sim_link_check scenario.
+ *
+ *  The module is the Coordinator of another network using the channels of the link. For SIM_LINK_INTERFERENCE_MS, it
+ *  sends large frames back to back without CCA nor acknowledgment, so that the channels are busy most of the time,
+ *  then it stops sending and the channels are clear again.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <string.h>
+#include "sim_link_app.h"
+#include "swc_api.h"
+
+/* CONSTANTS ******************************************************************/
+#define SWC_MEM_POOL_SIZE 8192
+#define QUEUE_SIZE        2
+#define PAYLOAD_SIZE      200
+
+#define PAN_ID              0xDEF
+#define COORDINATOR_ADDRESS 0x01
+#define NODE_ADDRESS        0x02
+
+#define PULSE_COUNT 1
+#define PULSE_WIDTH 6
+#define PULSE_GAIN  0
+
+#define TIMESLOT_US 100
+/* Each timeslot holds one frame. */
+#define FRAME_COUNT ((SIM_LINK_INTERFERENCE_MS * 1000) / TIMESLOT_US)
+
+/* MACROS *********************************************************************/
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+#define EXPORT        __attribute__((visibility("default")))
+
+/* PRIVATE GLOBALS ************************************************************/
+static uint8_t swc_memory_pool[SWC_MEM_POOL_SIZE];
+static swc_connection_t *tx_conn;
+
+/* Each timeslot is only slightly longer than the air time of a frame. */
+static const uint32_t timeslot_us[] = {TIMESLOT_US};
+static const uint32_t channel_sequence[] = {0, 1, 2, 3, 4};
+static const uint32_t channel_frequency[SIM_LINK_CHANNEL_COUNT] = SIM_LINK_CHANNEL_FREQUENCIES;
+static int32_t tx_timeslots[] = {MAIN_TIMESLOT(0)};
+
+static sim_link_stats_t stats;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void add_channels(swc_connection_t *conn, swc_error_t *err);
+static void context_switch_trigger(void);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+EXPORT void sim_app_init(void)
+{
+    swc_error_t err = SWC_ERR_NONE;
+    swc_cfg_t core_cfg = {
+        .timeslot_sequence = timeslot_us,
+        .timeslot_sequence_length = ARRAY_SIZE(timeslot_us),
+        .channel_sequence = channel_sequence,
+        .channel_sequence_length = ARRAY_SIZE(channel_sequence),
+        .concurrency_mode = SWC_CONCURRENCY_MODE_HIGH_PERFORMANCE,
+        .memory_pool = swc_memory_pool,
+        .memory_pool_size = SWC_MEM_POOL_SIZE,
+    };
+    swc_node_cfg_t node_cfg = {
+        .role = SWC_ROLE_COORDINATOR,
+        .pan_id = PAN_ID,
+        .coordinator_address = COORDINATOR_ADDRESS,
+        .local_address = COORDINATOR_ADDRESS,
+    };
+    swc_connection_cfg_t tx_conn_cfg = {
+        .name = "Jammer Connection",
+        .source_address = COORDINATOR_ADDRESS,
+        .destination_address = NODE_ADDRESS,
+        .max_payload_size = PAYLOAD_SIZE,
+        .queue_size = QUEUE_SIZE,
+        .timeslot_id = tx_timeslots,
+        .timeslot_count = ARRAY_SIZE(tx_timeslots),
+    };
+
+    swc_init(core_cfg, node_cfg, context_switch_trigger, &err);
+    if (err == SWC_ERR_NONE) {
+        swc_radio_module_init(SWC_RADIO_ID_1, true, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        tx_conn = swc_connection_init(tx_conn_cfg, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        swc_connection_set_acknowledgement(tx_conn, false, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        add_channels(tx_conn, &err);
+    }
+    if (err == SWC_ERR_NONE) {
+        swc_setup(&err);
+    }
+    if (err == SWC_ERR_NONE) {
+        swc_connect(&err);
+    }
+    stats.init_error = (int32_t)err;
+}
+
+EXPORT void sim_app_process(void)
+{
+    swc_error_t err = SWC_ERR_NONE;
+    uint8_t *payload = NULL;
+
+    swc_connection_callbacks_processing_handler();
+
+    if ((stats.init_error != (int32_t)SWC_ERR_NONE) || (swc_get_status() != SWC_STATUS_RUNNING)) {
+        return;
+    }
+    if (stats.tx_count >= FRAME_COUNT) {
+        return;
+    }
+
+    swc_connection_get_payload_buffer(tx_conn, &payload, &err);
+    if (payload != NULL) {
+        memset(payload, 0, PAYLOAD_SIZE);
+        swc_connection_send(tx_conn, payload, PAYLOAD_SIZE, &err);
+        if (err == SWC_ERR_NONE) {
+            stats.tx_count++;
+        }
+    }
+}
+
+EXPORT void sim_link_get_stats(sim_link_stats_t *link_stats)
+{
+    *link_stats = stats;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Add every channel of the sequence to a connection.
+ *
+ *  @param[in]  conn  Connection.
+ *  @param[out] err   Wireless Core error code.
+ */
+static void add_channels(swc_connection_t *conn, swc_error_t *err)
+{
+    swc_channel_cfg_t channel_cfg = {
+        .tx_pulse_count = PULSE_COUNT,
+        .tx_pulse_width = PULSE_WIDTH,
+        .tx_pulse_gain = PULSE_GAIN,
+        .rx_pulse_count = PULSE_COUNT,
+    };
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(channel_frequency); i++) {
+        channel_cfg.frequency = channel_frequency[i];
+        swc_connection_add_channel(conn, channel_cfg, err);
+        if (*err != SWC_ERR_NONE) {
+            return;
+        }
+    }
+}
+
+/** @brief Trigger the callback processing.
+ *
+ *  The callbacks are processed by sim_app_process() instead of a low priority software interrupt.
+ */
+static void context_switch_trigger(void)
+{
+}
@@ -0,0 +1,181 @@
+/** @file  spsc_queue_stress.c
+ *  @brief This tool stresses the lock-free SPSC queue from a producer thread and a consumer thread on the host.
+ *
+ *  The producer enqueues items holding a sequence number and a pattern derived from it, the consumer checks that every
+ *  item is received once, in order and intact. A small queue capacity keeps both threads colliding on full and empty
+ *  conditions. Build it with -fsanitize=thread to also check the memory ordering.
+ *
+ *  Usage: spsc_queue_stress_host [item_count]
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "spsc_queue.h"
+
+/* CONSTANTS ******************************************************************/
+/* Default number of items transferred from the producer to the consumer. */
+#define ITEM_COUNT     1000000
+/* Number of slots of the queue, kept small to wrap often. */
+#define QUEUE_CAPACITY 8
+/* Number of pattern words per item, so a torn item is detected. */
+#define PATTERN_COUNT  5
+
+/* TYPES **********************************************************************/
+/** @brief Item transferred through the queue.
+ */
+typedef struct stress_item {
+    /*! Sequence number of the item. */
+    uint32_t sequence;
+    /*! Values derived from the sequence number. */
+    uint32_t pattern[PATTERN_COUNT];
+} stress_item_t;
+
+/* PRIVATE GLOBALS ************************************************************/
+static spsc_queue_t queue;
+static stress_item_t queue_buffer[QUEUE_CAPACITY];
+static uint32_t item_count = ITEM_COUNT;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void *producer_thread(void *arg);
+static void *consumer_thread(void *arg);
+static uint32_t get_pattern(uint32_t sequence, uint32_t index);
+static int check_capacity_rounding(void);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(int argc, char *argv[])
+{
+    pthread_t producer;
+    pthread_t consumer;
+    void *consumer_errors = NULL;
+
+    if (argc > 1) {
+        item_count = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    if (check_capacity_rounding() != 0) {
+        return EXIT_FAILURE;
+    }
+
+    spsc_queue_init(&queue, queue_buffer, QUEUE_CAPACITY, sizeof(stress_item_t));
+
+    if (pthread_create(&consumer, NULL, consumer_thread, NULL) != 0 ||
+        pthread_create(&producer, NULL, producer_thread, NULL) != 0) {
+        printf("Unable to create the threads\n");
+        return EXIT_FAILURE;
+    }
+    pthread_join(producer, NULL);
+    pthread_join(consumer, &consumer_errors);
+
+    if (!spsc_queue_is_empty(&queue)) {
+        printf("Queue not empty at the end of the test\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("%" PRIu32 " items transferred, %" PRIuPTR " errors\n", item_count, (uintptr_t)consumer_errors);
+
+    return (consumer_errors == NULL) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Enqueue every item, yielding while the queue is full.
+ *
+ *  @param[in] arg  Unused.
+ *  @return NULL.
+ */
+static void *producer_thread(void *arg)
+{
+    stress_item_t *item;
+
+    (void)arg;
+
+    for (uint32_t sequence = 0; sequence < item_count; sequence++) {
+        while ((item = spsc_queue_get_free_slot(&queue)) == NULL) {
+            sched_yield();
+        }
+        item->sequence = sequence;
+        for (uint32_t i = 0; i < PATTERN_COUNT; i++) {
+            item->pattern[i] = get_pattern(sequence, i);
+        }
+        spsc_queue_enqueue(&queue);
+    }
+
+    return NULL;
+}
+
+/** @brief Dequeue every item, yielding while the queue is empty, and check it.
+ *
+ *  @param[in] arg  Unused.
+ *  @return Number of errors, cast as a pointer.
+ */
+static void *consumer_thread(void *arg)
+{
+    stress_item_t *item;
+    uintptr_t errors = 0;
+
+    (void)arg;
+
+    for (uint32_t sequence = 0; sequence < item_count; sequence++) {
+        while ((item = spsc_queue_front(&queue)) == NULL) {
+            sched_yield();
+        }
+        if (item->sequence != sequence) {
+            if (errors == 0) {
+                printf("Item %" PRIu32 " received instead of %" PRIu32 "\n", item->sequence, sequence);
+            }
+            errors++;
+        }
+        for (uint32_t i = 0; i < PATTERN_COUNT; i++) {
+            if (item->pattern[i] != get_pattern(item->sequence, i)) {
+                if (errors == 0) {
+                    printf("Item %" PRIu32 " corrupted\n", sequence);
+                }
+                errors++;
+                break;
+            }
+        }
+        if (spsc_queue_size(&queue) > QUEUE_CAPACITY) {
+            errors++;
+        }
+        spsc_queue_dequeue(&queue);
+    }
+
+    return (void *)errors;
+}
+
+/** @brief Get a pattern word of an item.
+ *
+ *  @param[in] sequence  Sequence number of the item.
+ *  @param[in] index     Pattern word index.
+ *  @return Pattern word.
+ */
+static uint32_t get_pattern(uint32_t sequence, uint32_t index)
+{
+    return (sequence * 2654435761U) ^ (index * 0x9E3779B9U);
+}
+
+/** @brief Check the capacity rounding of the queue.
+ *
+ *  @return 0 on success, -1 otherwise.
+ */
+static int check_capacity_rounding(void)
+{
+    spsc_queue_t rounded_queue;
+
+    spsc_queue_init(&rounded_queue, queue_buffer, 6, sizeof(stress_item_t));
+    if (spsc_queue_capacity(&rounded_queue) != 4 || spsc_queue_round_capacity(5) != 8 ||
+        spsc_queue_round_capacity(8) != 8 || spsc_queue_round_capacity(0) != 1) {
+        printf("Capacity rounding failed\n");
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,755 @@
+/** @file  telemetry_decoder.c
+ *  @brief This tool decodes the binary telemetry frames exported by the SPARK Wireless Core and SPARK Audio Core.
+ *
+ *  The frames are read from a file, or from the standard input when no file is given, so a serial port can be piped
+ *  in. The decoder resynchronizes on the sync word and the CRC, the CRC errors and the lost frames detected from the
+ *  sequence numbers are reported on the standard error. The records are rendered as text, or as CSV with one line per
+ *  field for spreadsheets and plotting scripts.
+ *
+ *  Usage: telemetry_decoder_host [-c] [file]
+ *         telemetry_decoder_host -t
+ *
+ *      -c  Render the records as CSV.
+ *      -t  Encode frames with the telemetry library, decode them and check the result.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "crc16_ccitt.h"
+#include "telemetry.h"
+
+/* CONSTANTS ******************************************************************/
+/* Largest frame the decoder accepts. */
+#define MAX_FRAME_SIZE (TELEMETRY_FRAME_HEADER_SIZE + UINT16_MAX + TELEMETRY_FRAME_CRC_SIZE)
+/* Size of the blocks read from the input. */
+#define READ_BLOCK_SIZE 4096
+/* Size of a generated field name. */
+#define FIELD_NAME_SIZE 48
+/* Number of fields of the latency record that do not depend on the histogram sizes. */
+#define LATENCY_HEADER_FIELD_COUNT 2
+/* Number of fields of a latency histogram that do not depend on its size. */
+#define LATENCY_HISTOGRAM_SUMMARY_FIELD_COUNT 3
+/* Version 1 description of a record with a fixed number of fields. */
+#define RECORD_DESC(type, name, fields) {(type), 1, (name), (fields), sizeof(fields) / sizeof((fields)[0])}
+
+/* TYPES **********************************************************************/
+/** @brief Field value types.
+ */
+typedef enum field_type {
+    FIELD_U32,
+    FIELD_I32,
+    FIELD_FLOAT,
+} field_type_t;
+
+/** @brief Field description.
+ */
+typedef struct field_desc {
+    /*! Field name. */
+    const char *name;
+    /*! Field value type. */
+    field_type_t type;
+} field_desc_t;
+
+/** @brief Record description.
+ */
+typedef struct record_desc {
+    /*! Record type. */
+    telemetry_record_type_t type;
+    /*! Record version the fields are described for. */
+    uint8_t version;
+    /*! Record name. */
+    const char *name;
+    /*! Fields, NULL when the record has a variable number of fields. */
+    const field_desc_t *fields;
+    /*! Number of fields. */
+    uint16_t field_count;
+} record_desc_t;
+
+/** @brief Output formats.
+ */
+typedef enum output_format {
+    OUTPUT_TEXT,
+    OUTPUT_CSV,
+} output_format_t;
+
+/** @brief Stream decoder.
+ */
+typedef struct decoder {
+    /*! Bytes received and not yet decoded. */
+    uint8_t buffer[MAX_FRAME_SIZE];
+    /*! Number of bytes in the buffer. */
+    size_t size;
+    /*! Output stream. */
+    FILE *out;
+    /*! Output format. */
+    output_format_t format;
+    /*! Whether a frame was decoded, so the next sequence number is known. */
+    bool synced;
+    /*! Sequence number of the next frame. */
+    uint16_t next_sequence;
+    /*! Number of frames decoded. */
+    uint32_t frame_count;
+    /*! Number of frames lost, from the sequence number gaps. */
+    uint32_t lost_frame_count;
+    /*! Number of frames with a CRC error. */
+    uint32_t crc_error_count;
+    /*! Number of bytes skipped while searching the sync word. */
+    uint32_t skipped_byte_count;
+} decoder_t;
+
+/* PRIVATE GLOBALS ************************************************************/
+static const field_desc_t swc_connection_stats_fields[] = {
+    {"packet_sent_and_acked_count", FIELD_U32},
+    {"packet_sent_and_not_acked_count", FIELD_U32},
+    {"no_packet_tranmission_count", FIELD_U32},
+    {"packet_dropped_count", FIELD_U32},
+    {"tx_timeslot_occurrence", FIELD_U32},
+    {"tx_used_capacity_pc", FIELD_FLOAT},
+    {"packet_successfully_received_count", FIELD_U32},
+    {"no_packet_reception_count", FIELD_U32},
+    {"rx_timeslot_occurrence", FIELD_U32},
+    {"packet_duplicated_count", FIELD_U32},
+    {"packet_invalid_data_size_count", FIELD_U32},
+    {"packet_invalid_header_size_count", FIELD_U32},
+    {"packet_rejected_count", FIELD_U32},
+    {"packet_overrun_count", FIELD_U32},
+    {"packet_ack_data_received_count", FIELD_U32},
+    {"packet_ack_data_send_count", FIELD_U32},
+    {"cca_pass_count", FIELD_U32},
+    {"cca_fail_count", FIELD_U32},
+    {"cca_try_fail_count", FIELD_U32},
+    {"rssi_avg_raw", FIELD_U32},
+    {"rnsi_avg_raw", FIELD_U32},
+    {"rssi_inst", FIELD_U32},
+    {"rnsi_inst", FIELD_U32},
+    {"rssi_avg", FIELD_U32},
+    {"rnsi_avg", FIELD_U32},
+    {"link_margin_avg", FIELD_U32},
+    {"rssi_block_avg_tenth_db", FIELD_U32},
+    {"rnsi_block_avg_tenth_db", FIELD_U32},
+    {"link_margin_block_avg_tenth_db", FIELD_U32},
+    {"bytes_sent", FIELD_U32},
+    {"bytes_received", FIELD_U32},
+    {"tx_data_rate_bps", FIELD_U32},
+    {"rx_data_rate_bps", FIELD_U32},
+    {"tick_since_reset", FIELD_U32},
+};
+
+static const field_desc_t sac_pipeline_stats_fields[] = {
+    {"producer_buffer_load", FIELD_U32},
+    {"producer_buffer_size", FIELD_U32},
+    {"producer_buffer_overflow_count", FIELD_U32},
+    {"producer_packets_corrupted_count", FIELD_U32},
+    {"consumer_buffer_load", FIELD_U32},
+    {"consumer_buffer_size", FIELD_U32},
+    {"consumer_buffer_overflow_count", FIELD_U32},
+    {"consumer_buffer_underflow_count", FIELD_U32},
+    {"consumer_queue_peak_buffer_load", FIELD_U32},
+};
+
+static const field_desc_t sac_cdc_stats_fields[] = {
+    {"normal_queue_size", FIELD_U32},
+    {"avg_queue_size", FIELD_U32},
+    {"inflated_packets_count", FIELD_U32},
+    {"deflated_packets_count", FIELD_U32},
+};
+
+static const field_desc_t sac_cdc_asrc_stats_fields[] = {
+    {"target_queue_level", FIELD_U32},
+    {"avg_queue_level", FIELD_U32},
+    {"queue_level_error", FIELD_I32},
+    {"correction_ppb", FIELD_I32},
+    {"inflated_packets_count", FIELD_U32},
+    {"deflated_packets_count", FIELD_U32},
+};
+
+static const field_desc_t sac_cdc_pll_stats_fields[] = {
+    {"target_queue_size", FIELD_U32},
+    {"avg_queue_size", FIELD_U32},
+    {"queue_size_error", FIELD_I32},
+    {"queue_size_avg_delta", FIELD_I32},
+    {"current_pll_value", FIELD_U32},
+    {"pll_fracn_offset", FIELD_I32},
+};
+
+static const record_desc_t record_descs[] = {
+    RECORD_DESC(TELEMETRY_RECORD_SWC_CONNECTION_STATS, "SWC connection stats", swc_connection_stats_fields),
+    {TELEMETRY_RECORD_SWC_CONNECTION_LATENCY, 1, "SWC connection latency", NULL, 0},
+    RECORD_DESC(TELEMETRY_RECORD_SAC_PIPELINE_STATS, "SAC pipeline stats", sac_pipeline_stats_fields),
+    RECORD_DESC(TELEMETRY_RECORD_SAC_CDC_STATS, "SAC CDC stats", sac_cdc_stats_fields),
+    RECORD_DESC(TELEMETRY_RECORD_SAC_CDC_ASRC_STATS, "SAC CDC ASRC stats", sac_cdc_asrc_stats_fields),
+    RECORD_DESC(TELEMETRY_RECORD_SAC_CDC_PLL_STATS, "SAC CDC PLL stats", sac_cdc_pll_stats_fields),
+};
+
+static decoder_t decoder;
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void decoder_init(decoder_t *dec, FILE *out, output_format_t format);
+static void decoder_push(decoder_t *dec, const uint8_t *data, size_t size);
+static bool decoder_parse(decoder_t *dec);
+static void decoder_skip(decoder_t *dec, size_t size);
+static void decode_frame(decoder_t *dec, const uint8_t *frame);
+static void decode_record(decoder_t *dec, uint16_t sequence, uint32_t timestamp, const uint8_t *record);
+static bool get_field(const record_desc_t *desc, const uint8_t *value, uint16_t field_count, uint16_t index,
+                      char *name, field_type_t *type);
+static bool get_latency_field(const uint8_t *value, uint16_t field_count, uint16_t index, char *name);
+static const record_desc_t *find_record_desc(uint8_t type, uint8_t version);
+static void print_field(decoder_t *dec, uint16_t sequence, uint32_t timestamp, const char *record_name,
+                        uint8_t instance, const char *field_name, field_type_t type, uint32_t raw);
+static uint16_t read_u16(const uint8_t *buffer);
+static uint32_t read_u32(const uint8_t *buffer);
+static int decode_stream(FILE *in, output_format_t format);
+static int run_self_test(void);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(int argc, char *argv[])
+{
+    output_format_t format = OUTPUT_TEXT;
+    const char *path = NULL;
+    FILE *in = stdin;
+    int ret;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-c") == 0) {
+            format = OUTPUT_CSV;
+        } else if (strcmp(argv[i], "-t") == 0) {
+            return run_self_test();
+        } else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [-c] [file] | -t\n", argv[0]);
+            return EXIT_FAILURE;
+        } else {
+            path = argv[i];
+        }
+    }
+
+    if (path != NULL) {
+        in = fopen(path, "rb");
+        if (in == NULL) {
+            perror(path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    ret = decode_stream(in, format);
+
+    if (in != stdin) {
+        fclose(in);
+    }
+
+    return ret;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Initialize a stream decoder.
+ *
+ *  @param[in] dec     Decoder instance.
+ *  @param[in] out     Output stream.
+ *  @param[in] format  Output format.
+ */
+static void decoder_init(decoder_t *dec, FILE *out, output_format_t format)
+{
+    memset(dec, 0, sizeof(*dec));
+    dec->out = out;
+    dec->format = format;
+    if (format == OUTPUT_CSV) {
+        fprintf(out, "sequence,timestamp,record,instance,field,value\n");
+    }
+}
+
+/** @brief Push received bytes to a stream decoder and decode the complete frames.
+ *
+ *  @param[in] dec   Decoder instance.
+ *  @param[in] data  Received bytes.
+ *  @param[in] size  Number of bytes.
+ */
+static void decoder_push(decoder_t *dec, const uint8_t *data, size_t size)
+{
+    while (size > 0) {
+        size_t chunk = sizeof(dec->buffer) - dec->size;
+
+        if (chunk > size) {
+            chunk = size;
+        }
+        memcpy(&dec->buffer[dec->size], data, chunk);
+        dec->size += chunk;
+        data += chunk;
+        size -= chunk;
+
+        while (decoder_parse(dec)) {
+        }
+    }
+}
+
+/** @brief Decode the frame at the start of the decoder buffer.
+ *
+ *  @param[in] dec  Decoder instance.
+ *  @retval true   Bytes were consumed, parsing must continue.
+ *  @retval false  More bytes are needed.
+ */
+static bool decoder_parse(decoder_t *dec)
+{
+    size_t frame_size;
+    uint16_t crc;
+
+    if (dec->size < sizeof(uint16_t)) {
+        return false;
+    }
+    if (read_u16(dec->buffer) != TELEMETRY_SYNC_WORD) {
+        decoder_skip(dec, 1);
+        dec->skipped_byte_count++;
+        return true;
+    }
+    if (dec->size < TELEMETRY_FRAME_HEADER_SIZE) {
+        return false;
+    }
+    frame_size = TELEMETRY_FRAME_HEADER_SIZE + read_u16(&dec->buffer[10]) + TELEMETRY_FRAME_CRC_SIZE;
+    if (dec->size < frame_size) {
+        return false;
+    }
+
+    crc = crc16_ccitt(CRC16_CCITT_INIT, &dec->buffer[2], (uint16_t)(frame_size - TELEMETRY_FRAME_CRC_SIZE - 2));
+    if ((crc != read_u16(&dec->buffer[frame_size - TELEMETRY_FRAME_CRC_SIZE])) ||
+        (dec->buffer[2] != TELEMETRY_PROTOCOL_VERSION)) {
+        /* False sync or corrupted frame, search the next sync word from the next byte */
+        dec->crc_error_count++;
+        fprintf(stderr, "CRC error, resynchronizing\n");
+        decoder_skip(dec, 1);
+        return true;
+    }
+
+    decode_frame(dec, dec->buffer);
+    decoder_skip(dec, frame_size);
+
+    return true;
+}
+
+/** @brief Discard bytes at the start of the decoder buffer.
+ *
+ *  @param[in] dec   Decoder instance.
+ *  @param[in] size  Number of bytes to discard.
+ */
+static void decoder_skip(decoder_t *dec, size_t size)
+{
+    memmove(dec->buffer, &dec->buffer[size], dec->size - size);
+    dec->size -= size;
+}
+
+/** @brief Decode a frame whose CRC is valid.
+ *
+ *  @param[in] dec    Decoder instance.
+ *  @param[in] frame  Frame bytes.
+ */
+static void decode_frame(decoder_t *dec, const uint8_t *frame)
+{
+    uint8_t record_count = frame[3];
+    uint16_t sequence = read_u16(&frame[4]);
+    uint32_t timestamp = read_u32(&frame[6]);
+    uint16_t records_size = read_u16(&frame[10]);
+    const uint8_t *record = &frame[TELEMETRY_FRAME_HEADER_SIZE];
+    const uint8_t *records_end = record + records_size;
+
+    if (dec->synced && (sequence != dec->next_sequence)) {
+        uint16_t lost = (uint16_t)(sequence - dec->next_sequence);
+
+        dec->lost_frame_count += lost;
+        fprintf(stderr, "%" PRIu16 " frame(s) lost before frame %" PRIu16 "\n", lost, sequence);
+    }
+    dec->synced = true;
+    dec->next_sequence = (uint16_t)(sequence + 1);
+    dec->frame_count++;
+
+    if (dec->format == OUTPUT_TEXT) {
+        fprintf(dec->out, "Frame %" PRIu16 ", timestamp %" PRIu32 "\n", sequence, timestamp);
+    }
+
+    for (uint8_t i = 0; i < record_count; i++) {
+        if ((record + TELEMETRY_RECORD_HEADER_SIZE > records_end) ||
+            (record + TELEMETRY_RECORD_HEADER_SIZE + read_u16(&record[3]) > records_end)) {
+            fprintf(stderr, "Frame %" PRIu16 ": truncated record\n", sequence);
+            return;
+        }
+        decode_record(dec, sequence, timestamp, record);
+        record += TELEMETRY_RECORD_HEADER_SIZE + read_u16(&record[3]);
+    }
+}
+
+/** @brief Decode a record.
+ *
+ *  Records of an unknown type or version are rendered as raw fields.
+ *
+ *  @param[in] dec        Decoder instance.
+ *  @param[in] sequence   Frame sequence number.
+ *  @param[in] timestamp  Frame timestamp.
+ *  @param[in] record     Record bytes.
+ */
+static void decode_record(decoder_t *dec, uint16_t sequence, uint32_t timestamp, const uint8_t *record)
+{
+    const record_desc_t *desc = find_record_desc(record[0], record[1]);
+    const uint8_t *value = &record[TELEMETRY_RECORD_HEADER_SIZE];
+    uint16_t field_count = read_u16(&record[3]) / TELEMETRY_FIELD_SIZE;
+    char record_name[FIELD_NAME_SIZE];
+    char field_name[FIELD_NAME_SIZE];
+    field_type_t type;
+
+    if (desc != NULL) {
+        snprintf(record_name, sizeof(record_name), "%s", desc->name);
+    } else {
+        snprintf(record_name, sizeof(record_name), "record 0x%02x v%u", record[0], record[1]);
+    }
+    if (dec->format == OUTPUT_TEXT) {
+        fprintf(dec->out, "  << %s #%u >>\n", record_name, record[2]);
+    }
+
+    for (uint16_t i = 0; i < field_count; i++) {
+        if (!get_field(desc, value, field_count, i, field_name, &type)) {
+            snprintf(field_name, sizeof(field_name), "field_%u", i);
+            type = FIELD_U32;
+        }
+        print_field(dec, sequence, timestamp, record_name, record[2], field_name, type,
+                    read_u32(&value[i * TELEMETRY_FIELD_SIZE]));
+    }
+}
+
+/** @brief Get the name and type of a record field.
+ *
+ *  @param[in]  desc         Record description, NULL when unknown.
+ *  @param[in]  value        Record value.
+ *  @param[in]  field_count  Number of fields of the record.
+ *  @param[in]  index        Field index.
+ *  @param[out] name         Field name, FIELD_NAME_SIZE bytes.
+ *  @param[out] type         Field type.
+ *  @retval true   The field is described.
+ *  @retval false  The field is unknown.
+ */
+static bool get_field(const record_desc_t *desc, const uint8_t *value, uint16_t field_count, uint16_t index,
+                      char *name, field_type_t *type)
+{
+    if (desc == NULL) {
+        return false;
+    }
+    if (desc->type == TELEMETRY_RECORD_SWC_CONNECTION_LATENCY) {
+        *type = FIELD_U32;
+        return get_latency_field(value, field_count, index, name);
+    }
+    if ((field_count != desc->field_count) || (index >= desc->field_count)) {
+        return false;
+    }
+    snprintf(name, FIELD_NAME_SIZE, "%s", desc->fields[index].name);
+    *type = desc->fields[index].type;
+
+    return true;
+}
+
+/** @brief Get the name of a connection latency record field.
+ *
+ *  The record starts with the number of latency bins and the number of retry bins, followed by the latency bin upper
+ *  bounds, the ACK latency histogram, the drop age histogram and the retry count histogram.
+ *
+ *  @param[in]  value        Record value.
+ *  @param[in]  field_count  Number of fields of the record.
+ *  @param[in]  index        Field index.
+ *  @param[out] name         Field name, FIELD_NAME_SIZE bytes.
+ *  @retval true   The field is described.
+ *  @retval false  The record layout is inconsistent.
+ */
+static bool get_latency_field(const uint8_t *value, uint16_t field_count, uint16_t index, char *name)
+{
+    static const char *const histogram_names[] = {"ack_latency", "drop_age"};
+    static const char *const summary_names[] = {"count", "avg_us", "max_us"};
+    uint32_t bin_count;
+    uint32_t retry_bin_count;
+    uint32_t histogram_field_count;
+
+    if (field_count < LATENCY_HEADER_FIELD_COUNT) {
+        return false;
+    }
+    bin_count = read_u32(&value[0]);
+    retry_bin_count = read_u32(&value[TELEMETRY_FIELD_SIZE]);
+    histogram_field_count = LATENCY_HISTOGRAM_SUMMARY_FIELD_COUNT + bin_count;
+    if ((bin_count > UINT16_MAX) || (retry_bin_count > UINT16_MAX) ||
+        (LATENCY_HEADER_FIELD_COUNT + bin_count + (2 * histogram_field_count) + retry_bin_count != field_count)) {
+        return false;
+    }
+
+    if (index == 0) {
+        snprintf(name, FIELD_NAME_SIZE, "bin_count");
+        return true;
+    }
+    if (index == 1) {
+        snprintf(name, FIELD_NAME_SIZE, "retry_bin_count");
+        return true;
+    }
+    index -= LATENCY_HEADER_FIELD_COUNT;
+    if (index < bin_count) {
+        snprintf(name, FIELD_NAME_SIZE, "bin_upper_bound_us_%u", index);
+        return true;
+    }
+    index -= bin_count;
+    for (uint8_t i = 0; i < 2; i++) {
+        if (index < LATENCY_HISTOGRAM_SUMMARY_FIELD_COUNT) {
+            snprintf(name, FIELD_NAME_SIZE, "%s_%s", histogram_names[i], summary_names[index]);
+            return true;
+        }
+        if (index < histogram_field_count) {
+            snprintf(name, FIELD_NAME_SIZE, "%s_bin_%u", histogram_names[i],
+                     index - LATENCY_HISTOGRAM_SUMMARY_FIELD_COUNT);
+            return true;
+        }
+        index -= histogram_field_count;
+    }
+    snprintf(name, FIELD_NAME_SIZE, "retry_count_%u", index);
+
+    return true;
+}
+
+/** @brief Find the description of a record.
+ *
+ *  @param[in] type     Record type.
+ *  @param[in] version  Record version.
+ *  @return The record description, NULL if unknown.
+ */
+static const record_desc_t *find_record_desc(uint8_t type, uint8_t version)
+{
+    for (size_t i = 0; i < sizeof(record_descs) / sizeof(record_descs[0]); i++) {
+        if ((record_descs[i].type == type) && (record_descs[i].version == version)) {
+            return &record_descs[i];
+        }
+    }
+
+    return NULL;
+}
+
+/** @brief Render a field.
+ *
+ *  @param[in] dec          Decoder instance.
+ *  @param[in] sequence     Frame sequence number.
+ *  @param[in] timestamp    Frame timestamp.
+ *  @param[in] record_name  Record name.
+ *  @param[in] instance     Record instance.
+ *  @param[in] field_name   Field name.
+ *  @param[in] type         Field type.
+ *  @param[in] raw          Raw field value.
+ */
+static void print_field(decoder_t *dec, uint16_t sequence, uint32_t timestamp, const char *record_name,
+                        uint8_t instance, const char *field_name, field_type_t type, uint32_t raw)
+{
+    char value[24];
+    float float_value;
+
+    switch (type) {
+    case FIELD_I32:
+        snprintf(value, sizeof(value), "%" PRIi32, (int32_t)raw);
+        break;
+    case FIELD_FLOAT:
+        memcpy(&float_value, &raw, sizeof(float_value));
+        snprintf(value, sizeof(value), "%g", float_value);
+        break;
+    case FIELD_U32:
+    default:
+        snprintf(value, sizeof(value), "%" PRIu32, raw);
+        break;
+    }
+
+    if (dec->format == OUTPUT_CSV) {
+        fprintf(dec->out, "%" PRIu16 ",%" PRIu32 ",%s,%u,%s,%s\n", sequence, timestamp, record_name, instance,
+                field_name, value);
+    } else {
+        fprintf(dec->out, "    %-36s %12s\n", field_name, value);
+    }
+}
+
+/** @brief Read a 16-bit little-endian value.
+ *
+ *  @param[in] buffer  Source.
+ *  @return Value.
+ */
+static uint16_t read_u16(const uint8_t *buffer)
+{
+    return (uint16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+/** @brief Read a 32-bit little-endian value.
+ *
+ *  @param[in] buffer  Source.
+ *  @return Value.
+ */
+static uint32_t read_u32(const uint8_t *buffer)
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) |
+           ((uint32_t)buffer[3] << 24);
+}
+
+/** @brief Decode a stream until its end.
+ *
+ *  @param[in] in      Input stream.
+ *  @param[in] format  Output format.
+ *  @return EXIT_SUCCESS, or EXIT_FAILURE on a read error.
+ */
+static int decode_stream(FILE *in, output_format_t format)
+{
+    uint8_t block[READ_BLOCK_SIZE];
+    size_t size;
+
+    decoder_init(&decoder, stdout, format);
+    while ((size = fread(block, 1, sizeof(block), in)) > 0) {
+        decoder_push(&decoder, block, size);
+        fflush(stdout);
+    }
+
+    fprintf(stderr, "%" PRIu32 " frame(s) decoded, %" PRIu32 " lost, %" PRIu32 " CRC error(s), %" PRIu32
+            " byte(s) skipped\n", decoder.frame_count, decoder.lost_frame_count, decoder.crc_error_count,
+            decoder.skipped_byte_count);
+
+    return ferror(in) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/** @brief Encode frames with the telemetry library, decode them and check the result.
+ *
+ *  The stream holds leading garbage, a valid frame, a corrupted frame and a valid frame, so the resynchronization,
+ *  the CRC check and the lost frame detection are covered along with the field rendering.
+ *
+ *  @return EXIT_SUCCESS if the decoded output is the expected one, EXIT_FAILURE otherwise.
+ */
+static int run_self_test(void)
+{
+    static const char expected[] = "sequence,timestamp,record,instance,field,value\n"
+                                   "0,1000,SAC pipeline stats,2,producer_buffer_load,0\n"
+                                   "0,1000,SAC pipeline stats,2,producer_buffer_size,1\n"
+                                   "0,1000,SAC pipeline stats,2,producer_buffer_overflow_count,2\n"
+                                   "0,1000,SAC pipeline stats,2,producer_packets_corrupted_count,3\n"
+                                   "0,1000,SAC pipeline stats,2,consumer_buffer_load,4\n"
+                                   "0,1000,SAC pipeline stats,2,consumer_buffer_size,5\n"
+                                   "0,1000,SAC pipeline stats,2,consumer_buffer_overflow_count,6\n"
+                                   "0,1000,SAC pipeline stats,2,consumer_buffer_underflow_count,7\n"
+                                   "0,1000,SAC pipeline stats,2,consumer_queue_peak_buffer_load,8\n"
+                                   "0,1000,SAC CDC ASRC stats,0,target_queue_level,480\n"
+                                   "0,1000,SAC CDC ASRC stats,0,avg_queue_level,470\n"
+                                   "0,1000,SAC CDC ASRC stats,0,queue_level_error,-10\n"
+                                   "0,1000,SAC CDC ASRC stats,0,correction_ppb,-2500\n"
+                                   "0,1000,SAC CDC ASRC stats,0,inflated_packets_count,3\n"
+                                   "0,1000,SAC CDC ASRC stats,0,deflated_packets_count,4\n"
+                                   "2,3000,record 0x7f v1,1,field_0,42\n"
+                                   "2,3000,SWC connection latency,0,bin_count,1\n"
+                                   "2,3000,SWC connection latency,0,retry_bin_count,1\n"
+                                   "2,3000,SWC connection latency,0,bin_upper_bound_us_0,1000\n"
+                                   "2,3000,SWC connection latency,0,ack_latency_count,7\n"
+                                   "2,3000,SWC connection latency,0,ack_latency_avg_us,8\n"
+                                   "2,3000,SWC connection latency,0,ack_latency_max_us,9\n"
+                                   "2,3000,SWC connection latency,0,ack_latency_bin_0,7\n"
+                                   "2,3000,SWC connection latency,0,drop_age_count,0\n"
+                                   "2,3000,SWC connection latency,0,drop_age_avg_us,0\n"
+                                   "2,3000,SWC connection latency,0,drop_age_max_us,0\n"
+                                   "2,3000,SWC connection latency,0,drop_age_bin_0,0\n"
+                                   "2,3000,SWC connection latency,0,retry_count_0,5\n";
+    static const uint32_t latency_fields[] = {1, 1, 1000, 7, 8, 9, 7, 0, 0, 0, 0, 5};
+    static const uint8_t garbage[] = {0x00, 0xA5, 0x13};
+    uint8_t frame_buffer[TELEMETRY_FRAME_SIZE(3, 32 * TELEMETRY_FIELD_SIZE)];
+    telemetry_t telemetry;
+    uint16_t frame_size;
+    char *output = NULL;
+    size_t output_size = 0;
+    FILE *out;
+    int ret = EXIT_SUCCESS;
+
+    out = open_memstream(&output, &output_size);
+    if (out == NULL) {
+        perror("open_memstream");
+        return EXIT_FAILURE;
+    }
+    decoder_init(&decoder, out, OUTPUT_CSV);
+    telemetry_init(&telemetry, frame_buffer, sizeof(frame_buffer));
+
+    decoder_push(&decoder, garbage, sizeof(garbage));
+
+    /* Frame 0, valid */
+    telemetry_start_frame(&telemetry, 1000);
+    telemetry_start_record(&telemetry, TELEMETRY_RECORD_SAC_PIPELINE_STATS, 1, 2, 9);
+    for (uint32_t i = 0; i < 9; i++) {
+        telemetry_put_u32(&telemetry, i);
+    }
+    telemetry_start_record(&telemetry, TELEMETRY_RECORD_SAC_CDC_ASRC_STATS, 1, 0, 6);
+    telemetry_put_u32(&telemetry, 480);
+    telemetry_put_u32(&telemetry, 470);
+    telemetry_put_i32(&telemetry, -10);
+    telemetry_put_i32(&telemetry, -2500);
+    telemetry_put_u32(&telemetry, 3);
+    telemetry_put_u32(&telemetry, 4);
+    frame_size = telemetry_end_frame(&telemetry);
+    decoder_push(&decoder, telemetry_get_frame(&telemetry), frame_size);
+
+    /* Frame 1, corrupted */
+    telemetry_start_frame(&telemetry, 2000);
+    telemetry_start_record(&telemetry, TELEMETRY_RECORD_SAC_CDC_STATS, 1, 0, 4);
+    for (uint32_t i = 0; i < 4; i++) {
+        telemetry_put_u32(&telemetry, i);
+    }
+    frame_size = telemetry_end_frame(&telemetry);
+    frame_buffer[TELEMETRY_FRAME_HEADER_SIZE + TELEMETRY_RECORD_HEADER_SIZE] ^= 0x01;
+    decoder_push(&decoder, telemetry_get_frame(&telemetry), frame_size);
+
+    /* Frame 2, valid, with an unknown record and a latency record, pushed one byte at a time */
+    telemetry_start_frame(&telemetry, 3000);
+    telemetry_start_record(&telemetry, (telemetry_record_type_t)0x7F, 1, 1, 1);
+    telemetry_put_u32(&telemetry, 42);
+    telemetry_start_record(&telemetry, TELEMETRY_RECORD_SWC_CONNECTION_LATENCY, 1, 0,
+                           sizeof(latency_fields) / sizeof(latency_fields[0]));
+    for (size_t i = 0; i < sizeof(latency_fields) / sizeof(latency_fields[0]); i++) {
+        telemetry_put_u32(&telemetry, latency_fields[i]);
+    }
+    frame_size = telemetry_end_frame(&telemetry);
+    for (uint16_t i = 0; i < frame_size; i++) {
+        decoder_push(&decoder, &telemetry_get_frame(&telemetry)[i], 1);
+    }
+
+    /* A record that does not fit is dropped */
+    telemetry_start_frame(&telemetry, 4000);
+    if (telemetry_start_record(&telemetry, TELEMETRY_RECORD_SWC_CONNECTION_STATS, 1, 0, UINT16_MAX) ||
+        (telemetry.dropped_record_count != 1)) {
+        fprintf(stderr, "FAIL: oversized record not dropped\n");
+        ret = EXIT_FAILURE;
+    }
+
+    /* An encoder without room for an empty frame never starts one */
+    if (telemetry_init(&telemetry, frame_buffer, TELEMETRY_FRAME_SIZE(0, 0) - 1) ||
+        telemetry_start_frame(&telemetry, 5000) ||
+        telemetry_start_record(&telemetry, TELEMETRY_RECORD_SWC_CONNECTION_STATS, 1, 0, 0) ||
+        (telemetry_end_frame(&telemetry) != 0)) {
+        fprintf(stderr, "FAIL: frame started in an undersized buffer\n");
+        ret = EXIT_FAILURE;
+    }
+    /* A frame is only completed once started */
+    if (!telemetry_init(&telemetry, frame_buffer, TELEMETRY_FRAME_SIZE(0, 0)) ||
+        (telemetry_end_frame(&telemetry) != 0) || !telemetry_start_frame(&telemetry, 6000) ||
+        (telemetry_end_frame(&telemetry) != TELEMETRY_FRAME_SIZE(0, 0))) {
+        fprintf(stderr, "FAIL: empty frame\n");
+        ret = EXIT_FAILURE;
+    }
+
+    fclose(out);
+
+    if ((decoder.frame_count != 2) || (decoder.crc_error_count != 1) || (decoder.lost_frame_count != 1)) {
+        fprintf(stderr, "FAIL: %" PRIu32 " frame(s), %" PRIu32 " CRC error(s), %" PRIu32 " lost\n",
+                decoder.frame_count, decoder.crc_error_count, decoder.lost_frame_count);
+        ret = EXIT_FAILURE;
+    }
+    if ((output == NULL) || (strcmp(output, expected) != 0)) {
+        fprintf(stderr, "FAIL: unexpected output\n%s", output != NULL ? output : "");
+        ret = EXIT_FAILURE;
+    }
+    free(output);
+
+    if (ret == EXIT_SUCCESS) {
+        printf("PASS\n");
+    }
+
+    return ret;
+}
@@ -0,0 +1,275 @@
+/** @file  uwb_log_check.c
+ *  @brief This tool checks the deferred mode formatter of the logger on the host.
+ *
+ *  Every log is output by a logger in immediate mode, formatted by vsnprintf, and recorded then dumped by a logger in
+ *  deferred mode, both with a timestamp and a new line. The two outputs must be identical, except for the logs having
+ *  more arguments than UWB_LOG_MAX_ARGS or an unsupported conversion, where the deferred output is compared with the
+ *  expected string. The tool also checks the truncation of uwb_log_format_entry() and the count of the logs dropped
+ *  when the deferred mode buffer is full.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "uwb_log.h"
+
+/* CONSTANTS ******************************************************************/
+/* Number of logs the deferred mode buffer holds. */
+#define LOG_ENTRY_COUNT 4
+/* Number of logs dropped by the overflow check. */
+#define DROPPED_LOG_COUNT 3
+/* Size of the buffer collecting the io function outputs. */
+#define OUTPUT_SIZE (2 * MAX_LOG_SIZE)
+
+#define TIMESTAMP      12345
+#define TIMESTAMP_FREQ 1000
+
+/* Size of the buffer given to uwb_log_format_entry() by the truncation check. */
+#define TRUNCATED_SIZE 16
+
+/* MACROS *********************************************************************/
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof(*(a)))
+
+/* Output of an INFO log with the timestamp and the new line. */
+#define INFO_LOG(str) "[12.345] INFO : " str "\n\r"
+
+/* PRIVATE GLOBALS ************************************************************/
+static uwb_log_entry_t log_entries[LOG_ENTRY_COUNT];
+static uwb_log_t immediate_log;
+static uwb_log_t deferred_log;
+static char output[OUTPUT_SIZE];
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static bool check_formatting(void);
+static bool check_log(const char *name, const char *expected, const char *fmt, ...);
+static bool check_truncation(void);
+static bool check_overflow(void);
+static bool check_output(const char *name, const char *expected);
+static void init_loggers(void);
+static uint32_t get_timestamp(void);
+static void collect_output(char *message);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+int main(void)
+{
+    bool passed = true;
+
+    init_loggers();
+
+    passed &= check_formatting();
+    passed &= check_truncation();
+    passed &= check_overflow();
+
+    printf("%s\n", passed ? "PASSED" : "FAILED");
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Check the deferred output of logs covering the supported conversions.
+ *
+ *  @retval true   Every log is formatted as expected.
+ *  @retval false  A log differs.
+ */
+static bool check_formatting(void)
+{
+    static const char text[] = "text";
+    bool passed = true;
+
+    passed &= check_log("no conversion", NULL, "no conversion");
+    passed &= check_log("percent", NULL, "100%% done, %d%%", 42);
+    passed &= check_log("flags", NULL, "%+05d %#x % d %-4u|", 42, 255U, 7, 3U);
+    passed &= check_log("star width", NULL, "[%*d] [%*d]", 6, -42, -6, 5);
+    passed &= check_log("star precision", NULL, "[%.*f] [%.*d]", 3, 3.14159265, -1, 7);
+    passed &= check_log("star width precision", NULL, "[%-*.*s] [%*.*e]", 10, 3, "abcdef", 12, 2, 1.5e-7);
+    passed &= check_log("hh h", NULL, "%hhd %hhx %hd %hu", 300, 0x1FF, -2, 65534);
+    passed &= check_log("l ll", NULL, "%ld %lu %lld %llx", -1234567L, 4000000000UL, -123456789012LL,
+                        0x123456789ABCULL);
+    passed &= check_log("j z t", NULL, "%jd %zu %td", (intmax_t)-5, (size_t)123, (ptrdiff_t)-7);
+    passed &= check_log("c s p", NULL, "%c %s %p", 'x', text, (const void *)text);
+    passed &= check_log("floating point", NULL, "%g %a %F %E", 2.5, 0.75, 1e10, -3.0);
+    passed &= check_log("too many args", INFO_LOG("1 2 3 4 5 6 %d"), "%d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7);
+    passed &= check_log("too many star args", INFO_LOG(" 1  2  3|%d"), "%*d %*d %*d|%d", 2, 1, 2, 2, 2, 3, 4);
+    passed &= check_log("unsupported", INFO_LOG("1 %Lf %d"), "%d %Lf %d", 1, (long double)2.0, 3);
+
+    return passed;
+}
+
+/** @brief Output a log in immediate and deferred modes and compare the outputs.
+ *
+ *  @param[in] name      Name of the check.
+ *  @param[in] expected  Expected output, NULL to expect the immediate mode output.
+ *  @param[in] fmt       Format string.
+ *  @param[in] ...       Arguments of the format string.
+ *  @retval true   The deferred output matches.
+ *  @retval false  The deferred output differs or the log is not recorded.
+ */
+static bool check_log(const char *name, const char *expected, const char *fmt, ...)
+{
+    char immediate_output[OUTPUT_SIZE];
+    log_error_t err = LOG_ERR_NONE;
+    va_list immediate_args;
+    va_list deferred_args;
+
+    va_start(immediate_args, fmt);
+    va_copy(deferred_args, immediate_args);
+
+    output[0] = '\0';
+    uwb_vlog(&immediate_log, &err, INFO, fmt, immediate_args);
+    strcpy(immediate_output, output);
+
+    output[0] = '\0';
+    uwb_vlog(&deferred_log, &err, INFO, fmt, deferred_args);
+    va_end(deferred_args);
+    va_end(immediate_args);
+    if ((err != LOG_ERR_NONE) || uwb_log_dump(&deferred_log, &err) || (err != LOG_ERR_NONE)) {
+        printf("%-24s FAILED, error %d\n", name, (int)err);
+        return false;
+    }
+
+    return check_output(name, (expected != NULL) ? expected : immediate_output);
+}
+
+/** @brief Check uwb_log_format_entry() with buffers too small for the log and entries missing arguments.
+ *
+ *  @retval true   The output is truncated to the buffer size and the missing arguments are output verbatim.
+ *  @retval false  An output differs.
+ */
+static bool check_truncation(void)
+{
+    uwb_log_entry_t entry = {
+        .fmt = "%s and %d more",
+        .ts = TIMESTAMP,
+        .level = INFO,
+        .arg_count = 2,
+        .args = {{.p = "a long string"}, {.i = 12}},
+    };
+    const char *full_output = INFO_LOG("a long string and 12 more");
+    char buffer[MAX_LOG_SIZE];
+    size_t length;
+    bool passed = true;
+
+    memset(buffer, '#', sizeof(buffer));
+    length = uwb_log_format_entry(&deferred_log, &entry, buffer, TRUNCATED_SIZE);
+    passed &= (length == TRUNCATED_SIZE - 1) && (strncmp(buffer, full_output, length) == 0) &&
+              (buffer[length] == '\0') && (buffer[TRUNCATED_SIZE] == '#');
+
+    buffer[0] = '#';
+    passed &= (uwb_log_format_entry(&deferred_log, &entry, buffer, 0) == 0) && (buffer[0] == '#');
+
+    printf("%-24s %s\n", "truncation", passed ? "ok" : "FAILED");
+
+    entry.arg_count = 1;
+    length = uwb_log_format_entry(&deferred_log, &entry, output, sizeof(output));
+    passed &= (length == strlen(output)) && check_output("missing args", INFO_LOG("a long string and %d more"));
+
+    return passed;
+}
+
+/** @brief Check the logs dropped when the deferred mode buffer is full.
+ *
+ *  @retval true   The dropped logs are counted and reported once, before the recorded logs.
+ *  @retval false  A log is not dropped or the report differs.
+ */
+static bool check_overflow(void)
+{
+    log_error_t err = LOG_ERR_NONE;
+    uint32_t dropped_count = 0;
+    bool passed = true;
+
+    for (uint8_t i = 0; i < LOG_ENTRY_COUNT + DROPPED_LOG_COUNT; i++) {
+        uwb_log(&deferred_log, &err, INFO, "log %u", i);
+        dropped_count += (err == LOG_ERR_BUFFER_FULL);
+    }
+    passed &= (dropped_count == DROPPED_LOG_COUNT) && (deferred_log.dropped_count == DROPPED_LOG_COUNT);
+
+    output[0] = '\0';
+    passed &= uwb_log_dump(&deferred_log, &err);
+    passed &= check_output("dropped report", "WARN : 3 log(s) dropped\n\r" INFO_LOG("log 0"));
+
+    for (uint8_t i = 1; i < LOG_ENTRY_COUNT; i++) {
+        output[0] = '\0';
+        passed &= (uwb_log_dump(&deferred_log, &err) == (i < LOG_ENTRY_COUNT - 1));
+    }
+    passed &= check_output("recorded logs", INFO_LOG("log 3"));
+
+    /* The dropped logs are only reported once. */
+    output[0] = '\0';
+    uwb_log(&deferred_log, &err, INFO, "log %u", LOG_ENTRY_COUNT);
+    passed &= !uwb_log_dump(&deferred_log, &err) && (err == LOG_ERR_NONE);
+    passed &= check_output("dropped reported once", INFO_LOG("log 4"));
+
+    return passed;
+}
+
+/** @brief Compare the collected io function output with the expected one.
+ *
+ *  @param[in] name      Name of the check.
+ *  @param[in] expected  Expected output.
+ *  @retval true   The output matches.
+ *  @retval false  The output differs.
+ */
+static bool check_output(const char *name, const char *expected)
+{
+    bool passed = (strcmp(output, expected) == 0);
+
+    printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    if (!passed) {
+        printf("    expected \"%s\"\n    got      \"%s\"\n", expected, output);
+    }
+
+    return passed;
+}
+
+/** @brief Initialize the immediate and deferred mode loggers.
+ */
+static void init_loggers(void)
+{
+    log_config_t config = {
+        .enabled = 1,
+        .timestamp = 1,
+        .new_line = 1,
+        .deferred = 0,
+        .level = TRACE,
+        .freq = TIMESTAMP_FREQ,
+    };
+
+    immediate_log.timestamp = get_timestamp;
+    immediate_log.io = collect_output;
+    uwb_log_init(&immediate_log, config);
+
+    config.deferred = 1;
+    deferred_log.buffer = log_entries;
+    deferred_log.buf_size = UWB_LOG_DEFERRED_BUFFER_SIZE(LOG_ENTRY_COUNT);
+    deferred_log.timestamp = get_timestamp;
+    deferred_log.io = collect_output;
+    uwb_log_init(&deferred_log, config);
+}
+
+/** @brief Get the timestamp of the logs.
+ *
+ *  @return A constant timestamp.
+ */
+static uint32_t get_timestamp(void)
+{
+    return TIMESTAMP;
+}
+
+/** @brief Collect the logs output by the io function.
+ *
+ *  @param[in] message  Formatted log.
+ */
+static void collect_output(char *message)
+{
+    size_t length = strlen(output);
+
+    snprintf(output + length, sizeof(output) - length, "%s", message);
+}
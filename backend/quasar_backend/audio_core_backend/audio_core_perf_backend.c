@@ -0,0 +1,29 @@
+/** @file  audio_core_perf_backend.c
+ *  @brief Implement sac_hal_facade facade performance statistics prototype functions.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "quasar_clock.h"
+#include "quasar_profiler.h"
+#include "sac_hal_facade.h"
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void sac_facade_perf_init(void)
+{
+    quasar_profiler_init();
+}
+
+uint32_t sac_facade_perf_get_timestamp(void)
+{
+    return quasar_profiler_get_cycle_count();
+}
+
+uint32_t sac_facade_perf_get_timestamp_frequency_hz(void)
+{
+    return quasar_clock_get_system_clock_freq();
+}
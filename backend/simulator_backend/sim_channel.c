@@ -0,0 +1,203 @@
+/** @file  sim_channel.c
+ *  @brief Shared wireless medium of the host-side WPS simulator.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "sim_channel.h"
+#include <string.h>
+#include "sim_radio.h"
+
+/* CONSTANTS ******************************************************************/
+#define NS_PER_S     1000000000ULL
+#define BITS_IN_BYTE 8
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void frame_sync_event(void *ctx);
+static void frame_end_event(void *ctx);
+static bool frame_is_lost(sim_channel_t *channel, sim_frame_t *frame, struct sim_radio *dst);
+static uint32_t prng_next(sim_channel_t *channel);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void sim_channel_init(sim_channel_t *channel, sim_kernel_t *kernel, const sim_channel_cfg_t *cfg)
+{
+    memset(channel, 0, sizeof(sim_channel_t));
+    channel->kernel = kernel;
+    channel->cfg = *cfg;
+    /* Xorshift generators must not be seeded with 0. */
+    channel->prng = (cfg->seed == 0) ? 1 : cfg->seed;
+}
+
+int sim_channel_attach(sim_channel_t *channel, struct sim_radio *radio)
+{
+    if (channel->radio_count >= SIM_MAX_RADIOS) {
+        return -1;
+    }
+    channel->radios[channel->radio_count] = radio;
+
+    return channel->radio_count++;
+}
+
+void sim_channel_set_link_loss(sim_channel_t *channel, uint8_t src, uint8_t dst, uint32_t loss)
+{
+    if ((src >= SIM_MAX_RADIOS) || (dst >= SIM_MAX_RADIOS)) {
+        return;
+    }
+    channel->link_loss[src][dst] = loss;
+    channel->link_loss_set[src][dst] = true;
+}
+
+sim_time_t sim_channel_get_air_time(sim_channel_t *channel, uint16_t size)
+{
+    return channel->cfg.preamble_ns + (((uint64_t)size * BITS_IN_BYTE * NS_PER_S) / channel->cfg.bitrate_bps);
+}
+
+bool sim_channel_is_busy(sim_channel_t *channel, uint32_t rf_key, struct sim_radio *self)
+{
+    for (uint8_t i = 0; i < SIM_MAX_FRAMES_ON_AIR; i++) {
+        sim_frame_t *frame = &channel->frames[i];
+
+        if (frame->in_use && (frame->src != self) && (frame->rf_key == rf_key) &&
+            (frame->start <= channel->kernel->now) && (frame->end > channel->kernel->now)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+sim_time_t sim_channel_transmit(sim_channel_t *channel, struct sim_radio *src, uint32_t rf_key, uint16_t address,
+                                const uint8_t *data, uint16_t size, bool auto_reply)
+{
+    sim_frame_t *frame = NULL;
+    sim_time_t now = channel->kernel->now;
+
+    for (uint8_t i = 0; i < SIM_MAX_FRAMES_ON_AIR; i++) {
+        if (!channel->frames[i].in_use) {
+            frame = &channel->frames[i];
+            break;
+        }
+    }
+    if ((frame == NULL) || (size > SIM_MAX_FRAME_SIZE)) {
+        return 0;
+    }
+
+    frame->in_use = true;
+    frame->src = src;
+    frame->rf_key = rf_key;
+    frame->address = address;
+    frame->start = now;
+    frame->sync = now + channel->cfg.preamble_ns;
+    frame->end = now + sim_channel_get_air_time(channel, size);
+    frame->collided = false;
+    frame->auto_reply = auto_reply;
+    frame->size = size;
+    memcpy(frame->data, data, size);
+
+    /* Any frame still on air on the same RF channel is corrupted, and corrupts this one. */
+    for (uint8_t i = 0; i < SIM_MAX_FRAMES_ON_AIR; i++) {
+        sim_frame_t *other = &channel->frames[i];
+
+        if ((other != frame) && other->in_use && (other->rf_key == rf_key) && (other->end > now)) {
+            if (!other->collided) {
+                channel->collision_count++;
+            }
+            other->collided = true;
+            frame->collided = true;
+        }
+    }
+    if (frame->collided) {
+        channel->collision_count++;
+    }
+
+    channel->frame_count++;
+    sim_kernel_schedule_at(channel->kernel, frame->sync, frame_sync_event, frame);
+    sim_kernel_schedule_at(channel->kernel, frame->end, frame_end_event, frame);
+
+    return frame->end;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Notify the listening radios that a synchronization word is on air.
+ *
+ *  @param[in] ctx  Frame on air.
+ */
+static void frame_sync_event(void *ctx)
+{
+    sim_frame_t *frame = (sim_frame_t *)ctx;
+    sim_channel_t *channel = sim_radio_get_channel(frame->src);
+
+    for (uint8_t i = 0; i < channel->radio_count; i++) {
+        if (channel->radios[i] != frame->src) {
+            sim_radio_on_frame_sync(channel->radios[i], frame);
+        }
+    }
+}
+
+/** @brief Deliver the frame to the radios that locked on it and release its slot.
+ *
+ *  @param[in] ctx  Frame on air.
+ */
+static void frame_end_event(void *ctx)
+{
+    sim_frame_t *frame = (sim_frame_t *)ctx;
+    sim_channel_t *channel = sim_radio_get_channel(frame->src);
+
+    for (uint8_t i = 0; i < channel->radio_count; i++) {
+        struct sim_radio *dst = channel->radios[i];
+
+        if (dst != frame->src) {
+            bool lost = frame_is_lost(channel, frame, dst);
+
+            sim_radio_on_frame_end(dst, frame, !frame->collided && !lost);
+        }
+    }
+    frame->in_use = false;
+}
+
+/** @brief Draw the loss model for one receiver.
+ *
+ *  @param[in] channel  Channel instance.
+ *  @param[in] frame    Frame on air.
+ *  @param[in] dst      Receiving radio.
+ *  @retval true   Frame is lost for this receiver.
+ *  @retval false  Frame is received.
+ */
+static bool frame_is_lost(sim_channel_t *channel, sim_frame_t *frame, struct sim_radio *dst)
+{
+    uint8_t src_idx = sim_radio_get_channel_index(frame->src);
+    uint8_t dst_idx = sim_radio_get_channel_index(dst);
+    uint32_t loss = channel->link_loss_set[src_idx][dst_idx] ? channel->link_loss[src_idx][dst_idx] :
+                                                               channel->cfg.default_loss;
+
+    if (loss == 0) {
+        return false;
+    }
+    if ((prng_next(channel) % SIM_LOSS_SCALE) < loss) {
+        channel->loss_count++;
+        return true;
+    }
+
+    return false;
+}
+
+/** @brief Xorshift32 pseudo-random generator.
+ *
+ *  @param[in] channel  Channel instance.
+ *  @return Next pseudo-random value.
+ */
+static uint32_t prng_next(sim_channel_t *channel)
+{
+    uint32_t x = channel->prng;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    channel->prng = x;
+
+    return x;
+}
@@ -0,0 +1,172 @@
+/** @file  sim_channel.h
+ *  @brief Shared wireless medium of the host-side WPS simulator.
+ *
+ *  The channel keeps track of every frame on air, delivers them to the virtual radios listening on the same RF
+ *  channel, detects overlapping transmissions and applies a configurable, deterministic per-link loss model.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SIM_CHANNEL_H_
+#define SIM_CHANNEL_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+#include "sim_kernel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Maximum number of virtual radios attached to a channel. */
+#define SIM_MAX_RADIOS 16
+/*! Maximum number of simultaneous frames on air. */
+#define SIM_MAX_FRAMES_ON_AIR 16
+/*! Maximum frame size in bytes, including the header size byte. */
+#define SIM_MAX_FRAME_SIZE 256
+/*! Loss probability scale, 1.0 is represented by this value. */
+#define SIM_LOSS_SCALE 65536
+
+/* TYPES **********************************************************************/
+struct sim_radio;
+
+/** @brief Frame on air.
+ */
+typedef struct sim_frame {
+    /*! Transmitting radio. */
+    struct sim_radio *src;
+    /*! RF channel key, radios only hear frames sent with the same key. */
+    uint32_t rf_key;
+    /*! Destination address. */
+    uint16_t address;
+    /*! Air time start (first preamble chip). */
+    sim_time_t start;
+    /*! Synchronization word detection time. */
+    sim_time_t sync;
+    /*! Air time end. */
+    sim_time_t end;
+    /*! Overlapped by another frame on the same RF channel. */
+    bool collided;
+    /*! Frame is an auto-reply. */
+    bool auto_reply;
+    /*! Frame size. */
+    uint16_t size;
+    /*! Frame data: header size byte, header and payload. */
+    uint8_t data[SIM_MAX_FRAME_SIZE];
+    /*! Slot is in use. */
+    bool in_use;
+} sim_frame_t;
+
+/** @brief Channel configuration.
+ */
+typedef struct sim_channel_cfg {
+    /*! Over the air data rate in bits per second. */
+    uint32_t bitrate_bps;
+    /*! Preamble and synchronization word duration. */
+    sim_time_t preamble_ns;
+    /*! Seed of the loss model pseudo-random generator. */
+    uint32_t seed;
+    /*! Default frame loss probability, scaled by SIM_LOSS_SCALE. */
+    uint32_t default_loss;
+    /*! Received signal strength reported to the receivers, in raw RSSI units. */
+    uint8_t rssi;
+    /*! Received noise strength reported to the receivers, in raw RNSI units. */
+    uint8_t rnsi;
+} sim_channel_cfg_t;
+
+/** @brief Channel instance.
+ */
+typedef struct sim_channel {
+    /*! Kernel driving the channel. */
+    sim_kernel_t *kernel;
+    /*! Configuration. */
+    sim_channel_cfg_t cfg;
+    /*! Attached radios. */
+    struct sim_radio *radios[SIM_MAX_RADIOS];
+    /*! Number of attached radios. */
+    uint8_t radio_count;
+    /*! Per-link loss probability override [src][dst], scaled by SIM_LOSS_SCALE. */
+    uint32_t link_loss[SIM_MAX_RADIOS][SIM_MAX_RADIOS];
+    /*! Per-link loss override enable [src][dst]. */
+    bool link_loss_set[SIM_MAX_RADIOS][SIM_MAX_RADIOS];
+    /*! Frames currently on air. */
+    sim_frame_t frames[SIM_MAX_FRAMES_ON_AIR];
+    /*! Pseudo-random generator state. */
+    uint32_t prng;
+    /*! Number of frames transmitted. */
+    uint32_t frame_count;
+    /*! Number of frames that overlapped another frame. */
+    uint32_t collision_count;
+    /*! Number of frames dropped by the loss model. */
+    uint32_t loss_count;
+} sim_channel_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the channel.
+ *
+ *  @param[in] channel  Channel instance.
+ *  @param[in] kernel   Kernel instance.
+ *  @param[in] cfg      Channel configuration.
+ */
+void sim_channel_init(sim_channel_t *channel, sim_kernel_t *kernel, const sim_channel_cfg_t *cfg);
+
+/** @brief Attach a radio to the channel.
+ *
+ *  @param[in] channel  Channel instance.
+ *  @param[in] radio    Radio instance.
+ *  @return Index of the radio on the channel, -1 if the channel is full.
+ */
+int sim_channel_attach(sim_channel_t *channel, struct sim_radio *radio);
+
+/** @brief Override the loss probability of a directed link.
+ *
+ *  @param[in] channel  Channel instance.
+ *  @param[in] src      Index of the transmitting radio.
+ *  @param[in] dst      Index of the receiving radio.
+ *  @param[in] loss     Loss probability scaled by SIM_LOSS_SCALE.
+ */
+void sim_channel_set_link_loss(sim_channel_t *channel, uint8_t src, uint8_t dst, uint32_t loss);
+
+/** @brief Get the air time of a frame.
+ *
+ *  @param[in] channel  Channel instance.
+ *  @param[in] size     Frame size in bytes.
+ *  @return Air time in nanoseconds.
+ */
+sim_time_t sim_channel_get_air_time(sim_channel_t *channel, uint16_t size);
+
+/** @brief Check whether energy is present on an RF channel.
+ *
+ *  @param[in] channel  Channel instance.
+ *  @param[in] rf_key   RF channel key.
+ *  @param[in] self     Radio performing the assessment, its own frames are ignored.
+ *  @retval true   Channel is busy.
+ *  @retval false  Channel is clear.
+ */
+bool sim_channel_is_busy(sim_channel_t *channel, uint32_t rf_key, struct sim_radio *self);
+
+/** @brief Put a frame on air, starting now.
+ *
+ *  Listening radios on the same RF channel are notified at synchronization word time and at the end of the frame.
+ *
+ *  @param[in] channel     Channel instance.
+ *  @param[in] src         Transmitting radio.
+ *  @param[in] rf_key      RF channel key.
+ *  @param[in] address     Destination address.
+ *  @param[in] data        Frame data.
+ *  @param[in] size        Frame size.
+ *  @param[in] auto_reply  Frame is an auto-reply.
+ *  @return Air time end, 0 if no frame slot is available.
+ */
+sim_time_t sim_channel_transmit(sim_channel_t *channel, struct sim_radio *src, uint32_t rf_key, uint16_t address,
+                                const uint8_t *data, uint16_t size, bool auto_reply);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_CHANNEL_H_ */
@@ -0,0 +1,188 @@
+/** @file  sim_kernel.c
+ *  @brief Discrete-event kernel of the host-side WPS simulator.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "sim_kernel.h"
+#include <string.h>
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static bool event_before(const sim_event_t *a, const sim_event_t *b);
+static void heap_sift_up(sim_kernel_t *kernel, uint32_t index);
+static void heap_sift_down(sim_kernel_t *kernel, uint32_t index);
+static void heap_remove(sim_kernel_t *kernel, uint32_t index);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void sim_kernel_init(sim_kernel_t *kernel)
+{
+    memset(kernel, 0, sizeof(sim_kernel_t));
+    kernel->next_id = SIM_EVENT_INVALID + 1;
+}
+
+sim_event_id_t sim_kernel_schedule_at(sim_kernel_t *kernel, sim_time_t time, sim_event_cb_t cb, void *ctx)
+{
+    sim_event_t *event;
+
+    if (kernel->count >= SIM_KERNEL_MAX_EVENTS) {
+        return SIM_EVENT_INVALID;
+    }
+
+    event = &kernel->heap[kernel->count];
+    event->time = (time < kernel->now) ? kernel->now : time;
+    event->id = kernel->next_id++;
+    event->cb = cb;
+    event->ctx = ctx;
+    heap_sift_up(kernel, kernel->count++);
+
+    return kernel->next_id - 1;
+}
+
+sim_event_id_t sim_kernel_schedule_in(sim_kernel_t *kernel, sim_time_t delay, sim_event_cb_t cb, void *ctx)
+{
+    return sim_kernel_schedule_at(kernel, kernel->now + delay, cb, ctx);
+}
+
+bool sim_kernel_cancel(sim_kernel_t *kernel, sim_event_id_t id)
+{
+    if (id == SIM_EVENT_INVALID) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < kernel->count; i++) {
+        if (kernel->heap[i].id == id) {
+            heap_remove(kernel, i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void sim_kernel_run_until(sim_kernel_t *kernel, sim_time_t until)
+{
+    while ((kernel->count != 0) && (kernel->heap[0].time <= until) && !kernel->stop) {
+        sim_kernel_step(kernel);
+    }
+
+    if (until > kernel->now) {
+        kernel->now = until;
+    }
+}
+
+bool sim_kernel_step(sim_kernel_t *kernel)
+{
+    sim_event_t event;
+
+    if (kernel->count == 0) {
+        return false;
+    }
+
+    /* Pop before dispatching so the callback can freely schedule or re-enter the kernel. */
+    event = kernel->heap[0];
+    heap_remove(kernel, 0);
+
+    /* A nested run may already have moved the time past this event. */
+    if (event.time > kernel->now) {
+        kernel->now = event.time;
+    }
+    kernel->dispatched++;
+    event.cb(event.ctx);
+
+    return true;
+}
+
+bool sim_kernel_peek(sim_kernel_t *kernel, sim_time_t *time)
+{
+    if (kernel->count == 0) {
+        return false;
+    }
+    *time = kernel->heap[0].time;
+
+    return true;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Event ordering: earliest time first, then insertion order.
+ *
+ *  @param[in] a  First event.
+ *  @param[in] b  Second event.
+ *  @retval true   a must be dispatched before b.
+ *  @retval false  Otherwise.
+ */
+static bool event_before(const sim_event_t *a, const sim_event_t *b)
+{
+    return (a->time < b->time) || ((a->time == b->time) && (a->id < b->id));
+}
+
+/** @brief Move an event up the heap until the heap property holds.
+ *
+ *  @param[in] kernel  Kernel instance.
+ *  @param[in] index   Heap index of the event.
+ */
+static void heap_sift_up(sim_kernel_t *kernel, uint32_t index)
+{
+    sim_event_t tmp;
+
+    while (index > 0) {
+        uint32_t parent = (index - 1) / 2;
+
+        if (!event_before(&kernel->heap[index], &kernel->heap[parent])) {
+            break;
+        }
+        tmp = kernel->heap[parent];
+        kernel->heap[parent] = kernel->heap[index];
+        kernel->heap[index] = tmp;
+        index = parent;
+    }
+}
+
+/** @brief Move an event down the heap until the heap property holds.
+ *
+ *  @param[in] kernel  Kernel instance.
+ *  @param[in] index   Heap index of the event.
+ */
+static void heap_sift_down(sim_kernel_t *kernel, uint32_t index)
+{
+    sim_event_t tmp;
+
+    for (;;) {
+        uint32_t left = (2 * index) + 1;
+        uint32_t right = left + 1;
+        uint32_t smallest = index;
+
+        if ((left < kernel->count) && event_before(&kernel->heap[left], &kernel->heap[smallest])) {
+            smallest = left;
+        }
+        if ((right < kernel->count) && event_before(&kernel->heap[right], &kernel->heap[smallest])) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
+        }
+        tmp = kernel->heap[smallest];
+        kernel->heap[smallest] = kernel->heap[index];
+        kernel->heap[index] = tmp;
+        index = smallest;
+    }
+}
+
+/** @brief Remove the event at the given heap index.
+ *
+ *  @param[in] kernel  Kernel instance.
+ *  @param[in] index   Heap index of the event.
+ */
+static void heap_remove(sim_kernel_t *kernel, uint32_t index)
+{
+    kernel->count--;
+    if (index == kernel->count) {
+        return;
+    }
+    kernel->heap[index] = kernel->heap[kernel->count];
+    heap_sift_down(kernel, index);
+    heap_sift_up(kernel, index);
+}
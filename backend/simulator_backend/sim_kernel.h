@@ -0,0 +1,147 @@
+/** @file  sim_kernel.h
+ *  @brief Discrete-event kernel of the host-side WPS simulator.
+ *
+ *  The kernel owns the simulated time base shared by every virtual node and
+ *  dispatches time-ordered events. Events with the same time stamp are
+ *  dispatched in insertion order so that a run is fully deterministic.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SIM_KERNEL_H_
+#define SIM_KERNEL_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Maximum number of events pending at the same time. */
+#define SIM_KERNEL_MAX_EVENTS 1024
+/*! Invalid event handle. */
+#define SIM_EVENT_INVALID 0
+
+/* MACROS *********************************************************************/
+/*! Convert PLL cycles at 20.48 MHz to nanoseconds (1e9 / 20.48e6 = 3125 / 64). */
+#define SIM_PLL_CYCLES_TO_NS(cycles) (((uint64_t)(cycles) * 3125) / 64)
+/*! Convert nanoseconds to PLL cycles at 20.48 MHz. */
+#define SIM_NS_TO_PLL_CYCLES(ns) (((uint64_t)(ns) * 64) / 3125)
+/*! Convert XTAL cycles at 32.768 kHz to nanoseconds (1e9 / 32768 = 1953125 / 64). */
+#define SIM_XTAL_CYCLES_TO_NS(cycles) (((uint64_t)(cycles) * 1953125) / 64)
+
+/* TYPES **********************************************************************/
+/*! Simulated time in nanoseconds. */
+typedef uint64_t sim_time_t;
+
+/*! Event handle, used to cancel a pending event. */
+typedef uint32_t sim_event_id_t;
+
+/*! Event callback. */
+typedef void (*sim_event_cb_t)(void *ctx);
+
+/** @brief Pending event.
+ */
+typedef struct sim_event {
+    /*! Absolute dispatch time. */
+    sim_time_t time;
+    /*! Insertion sequence number, used as tie breaker and as handle. */
+    sim_event_id_t id;
+    /*! Callback to invoke. */
+    sim_event_cb_t cb;
+    /*! Callback context. */
+    void *ctx;
+} sim_event_t;
+
+/** @brief Kernel instance.
+ */
+typedef struct sim_kernel {
+    /*! Current simulated time. */
+    sim_time_t now;
+    /*! Next event handle. */
+    sim_event_id_t next_id;
+    /*! Binary min-heap of pending events. */
+    sim_event_t heap[SIM_KERNEL_MAX_EVENTS];
+    /*! Number of pending events. */
+    uint32_t count;
+    /*! Number of dispatched events, for statistics. */
+    uint64_t dispatched;
+    /*! Stop request flag. */
+    bool stop;
+} sim_kernel_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the kernel.
+ *
+ *  @param[in] kernel  Kernel instance.
+ */
+void sim_kernel_init(sim_kernel_t *kernel);
+
+/** @brief Schedule an event at an absolute time.
+ *
+ *  @note An event scheduled in the past is dispatched at the current time.
+ *
+ *  @param[in] kernel  Kernel instance.
+ *  @param[in] time    Absolute dispatch time.
+ *  @param[in] cb      Callback.
+ *  @param[in] ctx     Callback context.
+ *  @return Event handle, SIM_EVENT_INVALID if the event queue is full.
+ */
+sim_event_id_t sim_kernel_schedule_at(sim_kernel_t *kernel, sim_time_t time, sim_event_cb_t cb, void *ctx);
+
+/** @brief Schedule an event relative to the current time.
+ *
+ *  @param[in] kernel  Kernel instance.
+ *  @param[in] delay   Delay from now.
+ *  @param[in] cb      Callback.
+ *  @param[in] ctx     Callback context.
+ *  @return Event handle, SIM_EVENT_INVALID if the event queue is full.
+ */
+sim_event_id_t sim_kernel_schedule_in(sim_kernel_t *kernel, sim_time_t delay, sim_event_cb_t cb, void *ctx);
+
+/** @brief Cancel a pending event.
+ *
+ *  @param[in] kernel  Kernel instance.
+ *  @param[in] id      Event handle.
+ *  @retval true   Event was pending and has been removed.
+ *  @retval false  Event was not found.
+ */
+bool sim_kernel_cancel(sim_kernel_t *kernel, sim_event_id_t id);
+
+/** @brief Dispatch every event due up to and including the given time.
+ *
+ *  The kernel time is set to @p until on return. This function is re-entrant: a callback may call it to let time
+ *  elapse while it busy-waits, which is how blocking SPI transfers and IRQ pin polling are modeled.
+ *
+ *  @param[in] kernel  Kernel instance.
+ *  @param[in] until   Absolute end time.
+ */
+void sim_kernel_run_until(sim_kernel_t *kernel, sim_time_t until);
+
+/** @brief Dispatch the next pending event, jumping the time forward to it.
+ *
+ *  @param[in] kernel  Kernel instance.
+ *  @retval true   An event was dispatched.
+ *  @retval false  No event pending.
+ */
+bool sim_kernel_step(sim_kernel_t *kernel);
+
+/** @brief Get the time of the next pending event.
+ *
+ *  @param[in]  kernel  Kernel instance.
+ *  @param[out] time    Time of the next event.
+ *  @retval true   An event is pending.
+ *  @retval false  No event pending.
+ */
+bool sim_kernel_peek(sim_kernel_t *kernel, sim_time_t *time);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_KERNEL_H_ */
@@ -0,0 +1,384 @@
+/** @file  sim_node.c
+ *  @brief Simulated node of the host-side WPS simulator.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "sim_node.h"
+#include <dlfcn.h>
+#include <stdio.h>
+#include <string.h>
+
+/* CONSTANTS ******************************************************************/
+#define NS_PER_S                  1000000000ULL
+#define DEFAULT_TICK_FREQUENCY_HZ 1000000
+#define DEFAULT_POLL_QUANTUM_NS   100
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void port_spi_begin(void *ctx);
+static void port_spi_end(void *ctx);
+static void port_spi_transfer(void *ctx, const uint8_t *tx_data, uint8_t *rx_data, uint16_t size, bool blocking);
+static bool port_spi_is_busy(void *ctx);
+static bool port_read_irq_pin(void *ctx);
+static void port_set_radio_irq_callback(void *ctx, void (*callback)(void));
+static void port_set_spi_callback(void *ctx, void (*callback)(void));
+static void port_enable_radio_irq(void *ctx, bool enable);
+static void port_enable_spi_irq(void *ctx, bool enable);
+static void port_context_switch(void *ctx);
+static uint64_t port_get_tick(void *ctx);
+static void radio_irq_event(void *ctx);
+static void spi_done_event(void *ctx);
+static void app_init_event(void *ctx);
+static void app_process_event(void *ctx);
+static void dispatch_irqs(sim_node_t *node);
+static void elapse(sim_node_t *node, sim_time_t duration);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+bool sim_node_init(sim_node_t *node, sim_kernel_t *kernel, sim_channel_t *channel, const sim_node_cfg_t *cfg)
+{
+    sim_port_bind_t bind;
+
+    memset(node, 0, sizeof(sim_node_t));
+    node->kernel = kernel;
+    node->cfg = *cfg;
+    if (node->cfg.tick_frequency_hz == 0) {
+        node->cfg.tick_frequency_hz = DEFAULT_TICK_FREQUENCY_HZ;
+    }
+    if (node->cfg.poll_quantum_ns == 0) {
+        node->cfg.poll_quantum_ns = DEFAULT_POLL_QUANTUM_NS;
+    }
+
+    if (!sim_radio_init(&node->radio, kernel, channel, &cfg->radio_cfg)) {
+        return false;
+    }
+    sim_radio_set_irq_callback(&node->radio, radio_irq_event, node);
+
+    node->port.ctx = node;
+    node->port.spi_begin = port_spi_begin;
+    node->port.spi_end = port_spi_end;
+    node->port.spi_transfer = port_spi_transfer;
+    node->port.spi_is_busy = port_spi_is_busy;
+    node->port.read_irq_pin = port_read_irq_pin;
+    node->port.set_radio_irq_callback = port_set_radio_irq_callback;
+    node->port.set_spi_callback = port_set_spi_callback;
+    node->port.enable_radio_irq = port_enable_radio_irq;
+    node->port.enable_spi_irq = port_enable_spi_irq;
+    node->port.context_switch = port_context_switch;
+    node->port.get_tick = port_get_tick;
+    node->port.tick_frequency_hz = node->cfg.tick_frequency_hz;
+
+    /* A new link namespace gives this node its own copy of every global of the wireless core. */
+    node->module = dlmopen(LM_ID_NEWLM, cfg->module_path, RTLD_NOW | RTLD_LOCAL);
+    if (node->module == NULL) {
+        fprintf(stderr, "sim_node: %s\n", dlerror());
+        return false;
+    }
+
+    bind = (sim_port_bind_t)dlsym(node->module, SIM_PORT_BIND_SYMBOL);
+    node->app_init = (sim_port_app_hook_t)dlsym(node->module, SIM_PORT_APP_INIT_SYMBOL);
+    node->app_process = (sim_port_app_hook_t)dlsym(node->module, SIM_PORT_APP_PROCESS_SYMBOL);
+    if ((bind == NULL) || (node->app_init == NULL)) {
+        fprintf(stderr, "sim_node: %s does not export the node entry points\n", cfg->module_path);
+        dlclose(node->module);
+        node->module = NULL;
+        return false;
+    }
+    bind(&node->port);
+
+    return true;
+}
+
+void sim_node_start(sim_node_t *node, sim_time_t delay)
+{
+    sim_kernel_schedule_in(node->kernel, delay, app_init_event, node);
+}
+
+void sim_node_deinit(sim_node_t *node)
+{
+    if (node->module != NULL) {
+        dlclose(node->module);
+        node->module = NULL;
+    }
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Assert the radio chip select.
+ *
+ *  @param[in] ctx  Node instance.
+ */
+static void port_spi_begin(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    if (node->isr_depth == 0) {
+        node->main_cs_active = true;
+    }
+    sim_radio_spi_begin(&node->radio);
+}
+
+/** @brief Release the radio chip select.
+ *
+ *  @param[in] ctx  Node instance.
+ */
+static void port_spi_end(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    sim_radio_spi_end(&node->radio);
+    if (node->isr_depth == 0) {
+        node->main_cs_active = false;
+        dispatch_irqs(node);
+    }
+}
+
+/** @brief Exchange bytes with the virtual transceiver.
+ *
+ *  @param[in]  ctx       Node instance.
+ *  @param[in]  tx_data   Bytes sent.
+ *  @param[out] rx_data   Bytes received.
+ *  @param[in]  size      Number of bytes.
+ *  @param[in]  blocking  Wait for the transfer time to elapse.
+ */
+static void port_spi_transfer(void *ctx, const uint8_t *tx_data, uint8_t *rx_data, uint16_t size, bool blocking)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+    sim_time_t duration = sim_radio_spi_duration(&node->radio, size);
+
+    for (uint16_t i = 0; i < size; i++) {
+        rx_data[i] = sim_radio_spi_byte(&node->radio, tx_data[i]);
+    }
+
+    if (blocking) {
+        elapse(node, duration);
+    } else {
+        node->spi_busy = true;
+        node->spi_busy_until = node->kernel->now + duration;
+        sim_kernel_schedule_at(node->kernel, node->spi_busy_until, spi_done_event, node);
+    }
+}
+
+/** @brief Check whether a non-blocking transfer is in progress.
+ *
+ *  @param[in] ctx  Node instance.
+ *  @retval true   Transfer in progress.
+ *  @retval false  Idle.
+ */
+static bool port_spi_is_busy(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    if (node->spi_busy) {
+        elapse(node, node->cfg.poll_quantum_ns);
+    }
+
+    return node->spi_busy;
+}
+
+/** @brief Poll the radio IRQ pin.
+ *
+ *  @param[in] ctx  Node instance.
+ *  @return Pin level.
+ */
+static bool port_read_irq_pin(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    elapse(node, node->cfg.poll_quantum_ns);
+
+    return sim_radio_irq_pin(&node->radio);
+}
+
+/** @brief Register the radio IRQ handler.
+ *
+ *  @param[in] ctx       Node instance.
+ *  @param[in] callback  Handler.
+ */
+static void port_set_radio_irq_callback(void *ctx, void (*callback)(void))
+{
+    ((sim_node_t *)ctx)->radio_irq_cb = callback;
+}
+
+/** @brief Register the SPI transfer complete handler.
+ *
+ *  @param[in] ctx       Node instance.
+ *  @param[in] callback  Handler.
+ */
+static void port_set_spi_callback(void *ctx, void (*callback)(void))
+{
+    ((sim_node_t *)ctx)->spi_cb = callback;
+}
+
+/** @brief Enable or disable the radio IRQ, disabling it discards a pending request.
+ *
+ *  @param[in] ctx     Node instance.
+ *  @param[in] enable  Enable state.
+ */
+static void port_enable_radio_irq(void *ctx, bool enable)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    node->radio_irq_enabled = enable;
+    if (!enable) {
+        node->radio_irq_pending = false;
+    } else {
+        dispatch_irqs(node);
+    }
+}
+
+/** @brief Enable or disable the SPI transfer complete IRQ, disabling it discards a pending request.
+ *
+ *  @param[in] ctx     Node instance.
+ *  @param[in] enable  Enable state.
+ */
+static void port_enable_spi_irq(void *ctx, bool enable)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    node->spi_irq_enabled = enable;
+    if (!enable) {
+        node->spi_irq_pending = false;
+    } else {
+        dispatch_irqs(node);
+    }
+}
+
+/** @brief Pend the radio IRQ by software.
+ *
+ *  @param[in] ctx  Node instance.
+ */
+static void port_context_switch(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    node->radio_irq_pending = true;
+    dispatch_irqs(node);
+}
+
+/** @brief Read the free running timer.
+ *
+ *  @param[in] ctx  Node instance.
+ *  @return Timer ticks.
+ */
+static uint64_t port_get_tick(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+    sim_time_t now;
+
+    elapse(node, node->cfg.poll_quantum_ns);
+    now = node->kernel->now;
+
+    return ((now / NS_PER_S) * node->cfg.tick_frequency_hz) +
+           (((now % NS_PER_S) * node->cfg.tick_frequency_hz) / NS_PER_S);
+}
+
+/** @brief Radio IRQ pin activation.
+ *
+ *  @param[in] ctx  Node instance.
+ */
+static void radio_irq_event(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    if (node->radio_irq_enabled) {
+        node->radio_irq_pending = true;
+        dispatch_irqs(node);
+    }
+}
+
+/** @brief Non-blocking transfer complete.
+ *
+ *  @param[in] ctx  Node instance.
+ */
+static void spi_done_event(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+
+    node->spi_busy = false;
+    if (node->spi_irq_enabled) {
+        node->spi_irq_pending = true;
+        dispatch_irqs(node);
+    }
+}
+
+/** @brief Run the application initialization in the main context.
+ *
+ *  @param[in] ctx  Node instance.
+ */
+static void app_init_event(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+    if (node->main_running || (node->isr_depth != 0)) {
+        sim_kernel_schedule_in(node->kernel, node->cfg.poll_quantum_ns, app_init_event, node);
+        return;
+    }
+
+    node->main_running = true;
+    node->app_init();
+    node->main_running = false;
+
+    if ((node->app_process != NULL) && (node->cfg.process_period_ns != 0)) {
+        sim_kernel_schedule_in(node->kernel, node->cfg.process_period_ns, app_process_event, node);
+    }
+}
+
+/** @brief Run one iteration of the application main loop.
+ *
+ *  @param[in] ctx  Node instance.
+ */
+static void app_process_event(void *ctx)
+{
+    sim_node_t *node = (sim_node_t *)ctx;
+    /* The main context cannot run while it is preempted by one of its own interrupts. */
+    if (!node->main_running && (node->isr_depth == 0)) {
+        node->main_running = true;
+        node->app_process();
+        node->main_running = false;
+    }
+    sim_kernel_schedule_in(node->kernel, node->cfg.process_period_ns, app_process_event, node);
+}
+
+/** @brief Service the pending interrupts when the node is not already in an interrupt.
+ *
+ *  @param[in] node  Node instance.
+ */
+static void dispatch_irqs(sim_node_t *node)
+{
+    while ((node->isr_depth == 0) && !node->main_cs_active) {
+        void (*handler)(void) = NULL;
+
+        if (node->spi_irq_pending) {
+            node->spi_irq_pending = false;
+            node->spi_irq_count++;
+            handler = node->spi_cb;
+        } else if (node->radio_irq_pending && node->radio_irq_enabled) {
+            node->radio_irq_pending = false;
+            node->radio_irq_count++;
+            handler = node->radio_irq_cb;
+        } else {
+            break;
+        }
+
+        if (handler != NULL) {
+            node->isr_depth++;
+            handler();
+            node->isr_depth--;
+        }
+    }
+}
+
+/** @brief Let the simulated time elapse while the node busy-waits.
+ *
+ *  @param[in] node      Node instance.
+ *  @param[in] duration  Time to elapse.
+ */
+static void elapse(sim_node_t *node, sim_time_t duration)
+{
+    sim_kernel_run_until(node->kernel, node->kernel->now + duration);
+}
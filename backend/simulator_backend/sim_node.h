@@ -0,0 +1,127 @@
+/** @file  sim_node.h
+ *  @brief Simulated node of the host-side WPS simulator.
+ *
+ *  A node couples a virtual SR1100 to one copy of the wireless core and its application. The wireless core relies on
+ *  file-scope state, so each node is built as a shared module (see wps_simulator_add_node() in CMakeLists.txt) and
+ *  loaded in its own link namespace with dlmopen(), giving every node private globals.
+ *
+ *  The node also emulates the MCU side seen by the wireless core:
+ *   - Radio IRQ, SPI transfer complete IRQ and the software context switch share a single priority level: they never
+ *     nest and are deferred while another one runs or while the main context holds the radio chip select.
+ *   - Blocking SPI transfers, IRQ pin polling and free running timer reads let the simulated time elapse, so the busy
+ *     waits of the PHY make progress and other nodes keep running meanwhile.
+ *   - Non-blocking transfers exchange their data immediately and signal completion after the SPI transfer time.
+ *
+ *  @note glibc limits the number of link namespaces, which caps the number of nodes per process to about 15.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SIM_NODE_H_
+#define SIM_NODE_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+#include "sim_channel.h"
+#include "sim_kernel.h"
+#include "sim_port.h"
+#include "sim_radio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* TYPES **********************************************************************/
+/** @brief Node configuration.
+ */
+typedef struct sim_node_cfg {
+    /*! Path of the node shared module. */
+    const char *module_path;
+    /*! Virtual transceiver configuration. */
+    sim_radio_cfg_t radio_cfg;
+    /*! Free running timer frequency, 1 MHz when 0. */
+    uint32_t tick_frequency_hz;
+    /*! Simulated time consumed by each free running timer read or IRQ pin poll, 100 ns when 0. */
+    sim_time_t poll_quantum_ns;
+    /*! Period of the application main loop, the main loop is not run when 0. */
+    sim_time_t process_period_ns;
+} sim_node_cfg_t;
+
+/** @brief Node instance.
+ */
+typedef struct sim_node {
+    /*! Kernel driving the node. */
+    sim_kernel_t *kernel;
+    /*! Virtual transceiver. */
+    sim_radio_t radio;
+    /*! Port bound to the node module. */
+    sim_port_t port;
+    /*! Configuration. */
+    sim_node_cfg_t cfg;
+    /*! Module handle. */
+    void *module;
+    /*! Application initialization hook. */
+    sim_port_app_hook_t app_init;
+    /*! Application main loop hook. */
+    sim_port_app_hook_t app_process;
+    /*! Radio IRQ handler. */
+    void (*radio_irq_cb)(void);
+    /*! SPI transfer complete handler. */
+    void (*spi_cb)(void);
+    /*! Radio IRQ is enabled. */
+    bool radio_irq_enabled;
+    /*! SPI transfer complete IRQ is enabled. */
+    bool spi_irq_enabled;
+    /*! Radio IRQ is pending. */
+    bool radio_irq_pending;
+    /*! SPI transfer complete IRQ is pending. */
+    bool spi_irq_pending;
+    /*! Interrupt nesting depth. */
+    uint8_t isr_depth;
+    /*! Main context is running. */
+    bool main_running;
+    /*! Chip select is held by the main context. */
+    bool main_cs_active;
+    /*! Non-blocking transfer in progress. */
+    bool spi_busy;
+    /*! End of the non-blocking transfer in progress. */
+    sim_time_t spi_busy_until;
+    /*! Number of radio IRQs serviced. */
+    uint32_t radio_irq_count;
+    /*! Number of SPI transfer complete IRQs serviced. */
+    uint32_t spi_irq_count;
+} sim_node_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Load a node module and attach its virtual transceiver to the channel.
+ *
+ *  @param[in] node     Node instance.
+ *  @param[in] kernel   Kernel instance.
+ *  @param[in] channel  Channel instance.
+ *  @param[in] cfg      Node configuration.
+ *  @retval true   Success.
+ *  @retval false  The module could not be loaded or the channel is full.
+ */
+bool sim_node_init(sim_node_t *node, sim_kernel_t *kernel, sim_channel_t *channel, const sim_node_cfg_t *cfg);
+
+/** @brief Schedule the application start.
+ *
+ *  @param[in] node   Node instance.
+ *  @param[in] delay  Delay before the application initialization hook runs.
+ */
+void sim_node_start(sim_node_t *node, sim_time_t delay);
+
+/** @brief Unload the node module.
+ *
+ *  @param[in] node  Node instance.
+ */
+void sim_node_deinit(sim_node_t *node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_NODE_H_ */
@@ -0,0 +1,74 @@
+/** @file  sim_port.h
+ *  @brief Interface between a simulated node and the host-side WPS simulator.
+ *
+ *  Every simulated node runs its own copy of the wireless core, linked with wireless_core_sim_backend.c. The
+ *  swc_hal facade of that copy forwards every hardware access to the port bound by the simulator when the node is
+ *  loaded.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SIM_PORT_H_
+#define SIM_PORT_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Name of the function a node module exports to receive its port. */
+#define SIM_PORT_BIND_SYMBOL "sim_node_bind"
+/*! Name of the function a node module exports to initialize its application. */
+#define SIM_PORT_APP_INIT_SYMBOL "sim_app_init"
+/*! Name of the optional function a node module exports to run one iteration of its main loop. */
+#define SIM_PORT_APP_PROCESS_SYMBOL "sim_app_process"
+
+/* TYPES **********************************************************************/
+/** @brief Hardware services offered by the simulator to a node.
+ */
+typedef struct sim_port {
+    /*! Opaque simulator context passed back to every function. */
+    void *ctx;
+    /*! Assert the radio chip select. */
+    void (*spi_begin)(void *ctx);
+    /*! Release the radio chip select. */
+    void (*spi_end)(void *ctx);
+    /*! Full-duplex SPI transfer, the non-blocking flavor completes through the SPI callback. */
+    void (*spi_transfer)(void *ctx, const uint8_t *tx_data, uint8_t *rx_data, uint16_t size, bool blocking);
+    /*! Check whether a non-blocking transfer is in progress. */
+    bool (*spi_is_busy)(void *ctx);
+    /*! Read the radio IRQ pin level. */
+    bool (*read_irq_pin)(void *ctx);
+    /*! Register the radio IRQ handler. */
+    void (*set_radio_irq_callback)(void *ctx, void (*callback)(void));
+    /*! Register the SPI transfer complete handler. */
+    void (*set_spi_callback)(void *ctx, void (*callback)(void));
+    /*! Enable or disable the radio IRQ. */
+    void (*enable_radio_irq)(void *ctx, bool enable);
+    /*! Enable or disable the SPI transfer complete IRQ. */
+    void (*enable_spi_irq)(void *ctx, bool enable);
+    /*! Pend the radio IRQ by software. */
+    void (*context_switch)(void *ctx);
+    /*! Read the free running timer. */
+    uint64_t (*get_tick)(void *ctx);
+    /*! Free running timer frequency. */
+    uint32_t tick_frequency_hz;
+} sim_port_t;
+
+/*! Port binding function exported by a node module. */
+typedef void (*sim_port_bind_t)(const sim_port_t *port);
+
+/*! Application hook exported by a node module. */
+typedef void (*sim_port_app_hook_t)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_PORT_H_ */
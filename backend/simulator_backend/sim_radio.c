@@ -0,0 +1,842 @@
+/** @file  sim_radio.c
+ *  @brief Behavioral model of an SR1100 transceiver for the host-side WPS simulator.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "sim_radio.h"
+#include <string.h>
+#include "sr1100_def.h"
+
+/* CONSTANTS ******************************************************************/
+#define NS_PER_S                 1000000000ULL
+#define BITS_IN_BYTE             8
+#define REG_ADDRESS_MASK         0x3F
+#define SPI_STATUS_BYTE          0x00
+#define IRQ_SOURCE_MASK          0x07FF
+#define BROADCAST_ADDRESS_MASK   0x00FF
+#define TIMEOUT_PLL_CYCLES_UNIT  8
+#define PWRUPDLAY_PLL_CYCLES_UNIT 8
+#define CCA_INTERVAL_PLL_UNIT    32
+#define RETRY_COUNT_MASK         0x0F
+#define RXTIME_MAX               0xFFFF
+#define SLEEP_DEPTH_IDLE_MAX     GET_SLPDEPTH_WAKEONCE(SLEEP_IDLE)
+#define SLEEP_DEPTH_DEEP         GET_SLPDEPTH_WAKEONCE(SLEEP_DEEP)
+#define ISI_MITIG_MAX            3
+#define PHASE_BYTES_ISI_MAX      16
+#define PHASE_BYTES_PER_STEP     4
+#define REPLY_LISTEN_MARGIN_PLL  256
+#define DEFAULT_SPI_CLOCK_HZ     40000000
+#define DEFAULT_TURNAROUND_NS    10000
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static uint16_t reg_read(sim_radio_t *radio, uint8_t addr);
+static void reg_write(sim_radio_t *radio, uint8_t addr, uint16_t value);
+static void actions_write(sim_radio_t *radio, uint8_t actions);
+static void raise_irq(sim_radio_t *radio, uint16_t flags);
+static void update_irq_pin(sim_radio_t *radio);
+static bool is_awake(sim_radio_t *radio);
+static bool is_exchanging(sim_radio_t *radio);
+static uint32_t get_rf_key(sim_radio_t *radio);
+static sim_time_t get_sleep_period(sim_radio_t *radio);
+static void cancel_state_event(sim_radio_t *radio);
+static void enter_sleep(sim_radio_t *radio);
+static void enter_idle(sim_radio_t *radio);
+static void schedule_wake(sim_radio_t *radio);
+static void wake_up(sim_radio_t *radio, bool timer_wake);
+static void wake_event(void *ctx);
+static void power_up_done_event(void *ctx);
+static void start_activity(sim_radio_t *radio);
+static void cca_event(void *ctx);
+static void latch_tx_frame(sim_radio_t *radio);
+static void transmit(sim_radio_t *radio, bool auto_reply);
+static void tx_end_event(void *ctx);
+static void start_listen(sim_radio_t *radio, bool auto_reply, sim_time_t deadline);
+static void rx_timeout_event(void *ctx);
+static void reply_start_event(void *ctx);
+static void rx_fifo_push(sim_radio_t *radio, uint8_t data);
+static uint8_t rx_fifo_pop(sim_radio_t *radio);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+bool sim_radio_init(sim_radio_t *radio, sim_kernel_t *kernel, sim_channel_t *channel, const sim_radio_cfg_t *cfg)
+{
+    int index;
+
+    memset(radio, 0, sizeof(sim_radio_t));
+    radio->kernel = kernel;
+    radio->channel = channel;
+    radio->cfg = *cfg;
+    if (radio->cfg.spi_clock_hz == 0) {
+        radio->cfg.spi_clock_hz = DEFAULT_SPI_CLOCK_HZ;
+    }
+    if (radio->cfg.turnaround_ns == 0) {
+        radio->cfg.turnaround_ns = DEFAULT_TURNAROUND_NS;
+    }
+
+    radio->regs[REG16_HARDDISABLES_IOCONFIG] = REG16_HARDDISABLES_IOCONFIG_DEFAULT;
+    radio->regs[REG16_V_I_TIME_REFS] = REG16_V_I_TIME_REFS_DEFAULT;
+    radio->regs[REG16_CCA_SETTINGS] = REG16_CCA_SETTINGS_DEFAULT;
+    radio->regs[REG16_CCA_THRES_GAIN] = REG16_CCA_THRES_GAIN_DEFAULT;
+    radio->regs[REG16_RXBANDFRE_CFG1FREQ] = REG16_RXBANDFRE_CFG1FREQ_DEFAULT;
+    radio->regs[REG16_CFG2FREQ_CFG3FREQ] = REG16_CFG2FREQ_CFG3FREQ_DEFAULT;
+    radio->regs[REG16_SLPPERIOD_15_0] = REG16_SLPPERIOD_15_0_DEFAULT;
+    radio->regs[REG16_TIMERCFG_SLEEPCFG] = REG16_TIMERCFG_SLEEPCFG_DEFAULT;
+    radio->regs[REG16_FRAMEPROC_PHASEDATA] = REG16_FRAMEPROC_PHASEDATA_DEFAULT;
+    radio->regs[REG16_PHY_0_1] = REG16_PHY_0_1_DEFAULT;
+    radio->regs[REG16_RXADDRESS] = REG16_RXADDRESS_DEFAULT;
+    radio->regs[REG16_TXADDRESS] = REG16_TXADDRESS_DEFAULT;
+    radio->regs[REG16_RX_TX_SIZEREG] = REG16_RX_TX_SIZEREG_DEFAULT;
+    /* Probed by sr_pwr_up() to detect the transceiver. */
+    radio->regs[REG16_CRC_30_16] = REG16_CRC_30_16_DEFAULT;
+    radio->irq_enable = REG16_IRQ_DEFAULT & IRQ_SOURCE_MASK;
+
+    /* The transceiver comes out of reset awake. */
+    radio->state = SIM_RADIO_STATE_IDLE;
+    radio->awake_since = kernel->now;
+    radio->timer_ref = kernel->now;
+
+    index = sim_channel_attach(channel, radio);
+    if (index < 0) {
+        return false;
+    }
+    radio->channel_index = (uint8_t)index;
+
+    return true;
+}
+
+void sim_radio_set_irq_callback(sim_radio_t *radio, void (*cb)(void *ctx), void *ctx)
+{
+    radio->irq_cb = cb;
+    radio->irq_ctx = ctx;
+}
+
+void sim_radio_spi_begin(sim_radio_t *radio)
+{
+    /* Selecting the radio again without releasing it continues the current burst, as the payload read does. */
+    if (radio->spi_cs) {
+        return;
+    }
+    radio->spi_cs = true;
+    radio->spi_expect_cmd = true;
+}
+
+void sim_radio_spi_end(sim_radio_t *radio)
+{
+    radio->spi_cs = false;
+    radio->spi_expect_cmd = true;
+
+    /* The wake-up time depends on several registers written in the same transaction as the SLEEP action. */
+    if (radio->state == SIM_RADIO_STATE_SLEEP || radio->state == SIM_RADIO_STATE_OFF) {
+        schedule_wake(radio);
+    }
+    update_irq_pin(radio);
+}
+
+uint8_t sim_radio_spi_byte(sim_radio_t *radio, uint8_t mosi)
+{
+    uint8_t miso = SPI_STATUS_BYTE;
+
+    if (radio->spi_expect_cmd) {
+        radio->spi_expect_cmd = false;
+        radio->spi_addr = mosi & REG_ADDRESS_MASK;
+        radio->spi_write = (mosi & REG_WRITE) != 0;
+        radio->spi_burst = (mosi & REG_READ_BURST) != 0;
+        radio->spi_byte_idx = 0;
+        return miso;
+    }
+
+    if (radio->spi_write) {
+        if (REG_IS_16_BITS(radio->spi_addr)) {
+            if (radio->spi_byte_idx == 0) {
+                radio->spi_word = mosi;
+                radio->spi_byte_idx = 1;
+                return miso;
+            }
+            radio->spi_word |= (uint16_t)mosi << BITS_IN_BYTE;
+            reg_write(radio, radio->spi_addr, radio->spi_word);
+        } else {
+            reg_write(radio, radio->spi_addr, mosi);
+        }
+    } else {
+        if (REG_IS_16_BITS(radio->spi_addr)) {
+            if (radio->spi_byte_idx == 0) {
+                radio->spi_word = reg_read(radio, radio->spi_addr);
+                radio->spi_byte_idx = 1;
+                return (uint8_t)radio->spi_word;
+            }
+            miso = (uint8_t)(radio->spi_word >> BITS_IN_BYTE);
+        } else {
+            miso = (uint8_t)reg_read(radio, radio->spi_addr);
+        }
+    }
+
+    /* Register access complete. */
+    radio->spi_byte_idx = 0;
+    if (!radio->spi_burst) {
+        /* Single accesses can be chained within the same chip select. */
+        radio->spi_expect_cmd = true;
+    } else if (radio->spi_addr != REG8_FIFOS) {
+        radio->spi_addr = (radio->spi_addr + 1) & REG_ADDRESS_MASK;
+    }
+
+    return miso;
+}
+
+sim_time_t sim_radio_spi_duration(sim_radio_t *radio, uint16_t size)
+{
+    return ((uint64_t)size * BITS_IN_BYTE * NS_PER_S) / radio->cfg.spi_clock_hz;
+}
+
+bool sim_radio_irq_pin(sim_radio_t *radio)
+{
+    bool active = (radio->irq_flags & radio->irq_enable) != 0;
+    bool active_high = GET_IRQPOLAR(radio->regs[REG16_HARDDISABLES_IOCONFIG]);
+
+    return active_high ? active : !active;
+}
+
+void sim_radio_on_frame_sync(sim_radio_t *radio, const sim_frame_t *frame)
+{
+    uint64_t rx_wait;
+
+    if ((radio->state != SIM_RADIO_STATE_RX_LISTEN) && (radio->state != SIM_RADIO_STATE_REPLY_LISTEN)) {
+        return;
+    }
+    if (frame->rf_key != get_rf_key(radio)) {
+        return;
+    }
+
+    /* The receiver keeps the frame even if the timeout would expire before its end. */
+    cancel_state_event(radio);
+    radio->locked_frame = frame;
+    radio->state = (radio->state == SIM_RADIO_STATE_RX_LISTEN) ? SIM_RADIO_STATE_RX_FRAME :
+                                                                 SIM_RADIO_STATE_REPLY_FRAME;
+
+    /* RXTIME is latched from the wake-up timer, which restarts at each wake-up. */
+    rx_wait = SIM_NS_TO_PLL_CYCLES(radio->kernel->now - radio->timer_ref);
+    radio->rx_wait_pll_cycles = (rx_wait > RXTIME_MAX) ? RXTIME_MAX : (uint16_t)rx_wait;
+}
+
+void sim_radio_on_frame_end(sim_radio_t *radio, const sim_frame_t *frame, bool crc_pass)
+{
+    bool auto_reply;
+    bool addr_match;
+    bool broadcast;
+    uint16_t flags;
+    uint16_t phase_bytes = 0;
+    sim_radio_t *src = (sim_radio_t *)frame->src;
+
+    if (radio->locked_frame != frame) {
+        return;
+    }
+    radio->locked_frame = NULL;
+    auto_reply = (radio->state == SIM_RADIO_STATE_REPLY_FRAME);
+
+    addr_match = (frame->address == radio->regs[REG16_RXADDRESS]);
+    broadcast = ((frame->address & BROADCAST_ADDRESS_MASK) == BROADCAST_ADDRESS);
+    flags = auto_reply ? BIT_ARRXENDI : BIT_RXENDI;
+    if (crc_pass) {
+        flags |= BIT_CRCPASSI;
+        flags |= addr_match ? BIT_ADDRMATI : 0;
+        flags |= broadcast ? BIT_BRDCASTI : 0;
+    }
+
+    if (crc_pass && (addr_match || broadcast)) {
+        radio->stats.rx_good++;
+        radio->regs[REG16_RSSI_RNSI] = MOV2MASK(radio->channel->cfg.rnsi, BITS_RNSI) |
+                                       MOV2MASK(radio->channel->cfg.rssi, BITS_RSSI);
+        radio->regs[REG16_RXTIME] = radio->rx_wait_pll_cycles;
+
+        if (GET_SAVEPHS(radio->regs[REG16_FRAMECFG_SAVETOBUF])) {
+            uint8_t isi_mitig = GET_ISIMITIG0(radio->regs[REG16_PHY_0_1]);
+
+            phase_bytes = (isi_mitig == ISI_MITIG_MAX) ? PHASE_BYTES_ISI_MAX :
+                                                         (PHASE_BYTES_PER_STEP * (isi_mitig + 2));
+        }
+        for (uint16_t i = 0; i < phase_bytes; i++) {
+            rx_fifo_push(radio, 0);
+        }
+        if (!auto_reply) {
+            rx_fifo_push(radio, src->cca_retries & RETRY_COUNT_MASK);
+        }
+        rx_fifo_push(radio, (uint8_t)frame->size);
+        for (uint16_t i = 0; i < frame->size; i++) {
+            rx_fifo_push(radio, frame->data[i]);
+        }
+    } else {
+        radio->stats.rx_rejected++;
+    }
+    raise_irq(radio, flags);
+
+    if (!auto_reply && crc_pass && addr_match && GET_RPLYTXEN(radio->regs[REG16_FRAMEPROC_PHASEDATA])) {
+        /* The auto-reply is loaded at the end of the frame, the MCU can prepare the next one during the turnaround. */
+        latch_tx_frame(radio);
+        radio->state = SIM_RADIO_STATE_REPLY_TX;
+        radio->state_event = sim_kernel_schedule_in(radio->kernel, radio->cfg.turnaround_ns, reply_start_event, radio);
+    } else if (GET_SLPRXEND(radio->regs[REG16_TIMERCFG_SLEEPCFG])) {
+        enter_sleep(radio);
+    } else {
+        enter_idle(radio);
+    }
+}
+
+sim_channel_t *sim_radio_get_channel(sim_radio_t *radio)
+{
+    return radio->channel;
+}
+
+uint8_t sim_radio_get_channel_index(sim_radio_t *radio)
+{
+    return radio->channel_index;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Read a register, applying the read side effects.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @param[in] addr   Register address.
+ *  @return Register value.
+ */
+static uint16_t reg_read(sim_radio_t *radio, uint8_t addr)
+{
+    uint16_t value = 0;
+
+    switch (addr) {
+    case REG16_IRQ:
+        /* Reading the status clears it. */
+        value = radio->irq_flags;
+        radio->irq_flags = 0;
+        update_irq_pin(radio);
+        break;
+    case REG8_FIFOS:
+        value = rx_fifo_pop(radio);
+        break;
+    case REG8_RXBUFLOAD:
+        value = radio->rx_fifo_wr - radio->rx_fifo_rd;
+        break;
+    case REG8_TXBUFLOAD:
+        value = radio->tx_fifo_len;
+        break;
+    case REG8_ACTIONS:
+        value = MOV2MASK(radio->cca_retries, BITS_TXRETRIES) | (radio->start_tx ? BIT_TXPENDIN : 0);
+        break;
+    case REG8_POWER_STATE:
+        if (is_awake(radio)) {
+            value = BIT_AWAKE | BIT_PROC_ON | BIT_DCDC_EN | BIT_PLL_EN | BIT_REF_EN;
+            switch (radio->state) {
+            case SIM_RADIO_STATE_IDLE:
+                /* Awake without activity, the receiver stays enabled in the RX direction (static RX power state). */
+                if (radio->regs[REG16_FRAMEPROC_PHASEDATA] & BIT_RADIODIR) {
+                    value |= BIT_RX_EN;
+                }
+                break;
+            case SIM_RADIO_STATE_TX:
+            case SIM_RADIO_STATE_REPLY_TX:
+                value |= BIT_TX_EN | BIT_INFRAME;
+                break;
+            case SIM_RADIO_STATE_RX_LISTEN:
+            case SIM_RADIO_STATE_REPLY_LISTEN:
+                value |= BIT_RX_EN;
+                break;
+            case SIM_RADIO_STATE_RX_FRAME:
+            case SIM_RADIO_STATE_REPLY_FRAME:
+                value |= BIT_RX_EN | BIT_INFRAME;
+                break;
+            default:
+                break;
+            }
+        }
+        break;
+    case REG8_NVM:
+        value = radio->cfg.nvm[radio->regs[REG8_NVM] & (SIM_RADIO_NVM_SIZE - 1)];
+        break;
+    default:
+        value = radio->regs[addr];
+        break;
+    }
+
+    return value;
+}
+
+/** @brief Write a register, applying the write side effects.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @param[in] addr   Register address.
+ *  @param[in] value  Register value.
+ */
+static void reg_write(sim_radio_t *radio, uint8_t addr, uint16_t value)
+{
+    switch (addr) {
+    case REG16_IRQ:
+        radio->regs[addr] = value;
+        radio->irq_enable = value & IRQ_SOURCE_MASK;
+        break;
+    case REG8_FIFOS:
+        if (radio->tx_fifo_len < SIM_RADIO_FIFO_SIZE) {
+            radio->tx_fifo[radio->tx_fifo_len++] = (uint8_t)value;
+        }
+        break;
+    case REG8_ACTIONS:
+        actions_write(radio, (uint8_t)value);
+        break;
+    case REG16_RSSI_RNSI:
+    case REG16_RXTIME:
+    case REG8_RXBUFLOAD:
+    case REG8_TXBUFLOAD:
+    case REG8_POWER_STATE:
+        /* Read-only. */
+        break;
+    default:
+        radio->regs[addr] = value;
+        break;
+    }
+}
+
+/** @brief Apply the ACTIONS register write.
+ *
+ *  @param[in] radio    Radio instance.
+ *  @param[in] actions  Action bits.
+ */
+static void actions_write(sim_radio_t *radio, uint8_t actions)
+{
+    if (actions & BIT_FLUSHTX) {
+        radio->tx_fifo_len = 0;
+    }
+    if (actions & BIT_FLUSHRX) {
+        radio->rx_fifo_rd = 0;
+        radio->rx_fifo_wr = 0;
+    }
+    if (actions & BIT_INITIMER) {
+        radio->timer_ref = radio->kernel->now;
+    }
+    if (actions & BIT_STARTTX) {
+        radio->start_tx = true;
+        radio->cca_retries = 0;
+    }
+
+    if (actions & BIT_SLEEP) {
+        /* A frame exchange in progress completes first, then ends as set by the sleep events. */
+        if (!is_exchanging(radio)) {
+            enter_sleep(radio);
+        }
+    } else if (!is_awake(radio)) {
+        /* Manual wake-up. A pending transmission starts right away. */
+        wake_up(radio, false);
+    } else if ((radio->state == SIM_RADIO_STATE_IDLE) && radio->start_tx) {
+        start_activity(radio);
+    }
+}
+
+/** @brief Raise IRQ flags.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @param[in] flags  Flags to raise.
+ */
+static void raise_irq(sim_radio_t *radio, uint16_t flags)
+{
+    radio->irq_flags |= flags;
+    update_irq_pin(radio);
+}
+
+/** @brief Update the IRQ pin and notify its activation.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+static void update_irq_pin(sim_radio_t *radio)
+{
+    bool active = (radio->irq_flags & radio->irq_enable) != 0;
+    bool rising = active && !radio->irq_active;
+
+    radio->irq_active = active;
+    if (rising && (radio->irq_cb != NULL)) {
+        radio->irq_cb(radio->irq_ctx);
+    }
+}
+
+/** @brief Check whether the radio is awake.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @retval true   Awake.
+ *  @retval false  Sleeping.
+ */
+static bool is_awake(sim_radio_t *radio)
+{
+    return (radio->state != SIM_RADIO_STATE_OFF) && (radio->state != SIM_RADIO_STATE_SLEEP);
+}
+
+/** @brief Check whether the radio is in the middle of a frame exchange.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @retval true   Transmitting or receiving a frame or its auto-reply.
+ *  @retval false  Idle, listening, waiting for a clear channel or sleeping.
+ */
+static bool is_exchanging(sim_radio_t *radio)
+{
+    switch (radio->state) {
+    case SIM_RADIO_STATE_TX:
+    case SIM_RADIO_STATE_RX_FRAME:
+    case SIM_RADIO_STATE_REPLY_TX:
+    case SIM_RADIO_STATE_REPLY_LISTEN:
+    case SIM_RADIO_STATE_REPLY_FRAME:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/** @brief Get the RF channel key from the frequency configuration.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @return RF channel key.
+ */
+static uint32_t get_rf_key(sim_radio_t *radio)
+{
+    return ((uint32_t)radio->regs[REG16_RXBANDFRE_CFG1FREQ] << 16) | radio->regs[REG16_CFG2FREQ_CFG3FREQ];
+}
+
+/** @brief Get the sleep period, in PLL cycles in idle sleep and XTAL cycles otherwise.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @return Sleep period.
+ */
+static sim_time_t get_sleep_period(sim_radio_t *radio)
+{
+    uint32_t period = radio->regs[REG16_SLPPERIOD_15_0] |
+                      ((uint32_t)GET_SLPPERIOD_23_16(radio->regs[REG16_SLPPERIOD_PWRUPDLAY]) << 16);
+
+    if (GET_SLPDEPTH_WAKEONCE(radio->regs[REG16_TIMERCFG_SLEEPCFG]) <= SLEEP_DEPTH_IDLE_MAX) {
+        return SIM_PLL_CYCLES_TO_NS(period);
+    }
+
+    return SIM_XTAL_CYCLES_TO_NS(period);
+}
+
+/** @brief Cancel the pending state machine event.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+static void cancel_state_event(sim_radio_t *radio)
+{
+    sim_kernel_cancel(radio->kernel, radio->state_event);
+    radio->state_event = SIM_EVENT_INVALID;
+}
+
+/** @brief Put the radio to sleep.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+static void enter_sleep(sim_radio_t *radio)
+{
+    cancel_state_event(radio);
+    radio->locked_frame = NULL;
+    if (is_awake(radio)) {
+        radio->stats.awake_ns += radio->kernel->now - radio->awake_since;
+    }
+    radio->state = SIM_RADIO_STATE_SLEEP;
+    if (!radio->spi_cs) {
+        schedule_wake(radio);
+    }
+}
+
+/** @brief Leave the radio awake and idle.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+static void enter_idle(sim_radio_t *radio)
+{
+    cancel_state_event(radio);
+    radio->locked_frame = NULL;
+    radio->state = SIM_RADIO_STATE_IDLE;
+}
+
+/** @brief Schedule the wake-up timer event according to the current configuration.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+static void schedule_wake(sim_radio_t *radio)
+{
+    uint16_t sleep_cfg = radio->regs[REG16_TIMERCFG_SLEEPCFG];
+
+    sim_kernel_cancel(radio->kernel, radio->wake_event);
+    radio->wake_event = SIM_EVENT_INVALID;
+
+    if (!GET_AUTOWAKE(sleep_cfg)) {
+        radio->state = (GET_SLPDEPTH_WAKEONCE(sleep_cfg) == SLEEP_DEPTH_DEEP) ? SIM_RADIO_STATE_OFF :
+                                                                                SIM_RADIO_STATE_SLEEP;
+        return;
+    }
+    radio->state = SIM_RADIO_STATE_SLEEP;
+    radio->wake_event = sim_kernel_schedule_at(radio->kernel, radio->timer_ref + get_sleep_period(radio), wake_event,
+                                               radio);
+}
+
+/** @brief Wake the radio up and start the power-up sequence.
+ *
+ *  @param[in] radio       Radio instance.
+ *  @param[in] timer_wake  Wake-up triggered by the wake-up timer.
+ */
+static void wake_up(sim_radio_t *radio, bool timer_wake)
+{
+    sim_time_t power_up_delay;
+
+    sim_kernel_cancel(radio->kernel, radio->wake_event);
+    radio->wake_event = SIM_EVENT_INVALID;
+
+    radio->awake_since = radio->kernel->now;
+    radio->stats.wakeups++;
+    if (timer_wake) {
+        /* The timer count restarts at wake-up. */
+        radio->timer_ref = radio->kernel->now;
+        raise_irq(radio, BIT_WAKEUPI);
+    }
+
+    if (!timer_wake && !radio->start_tx) {
+        radio->state = SIM_RADIO_STATE_IDLE;
+        return;
+    }
+    radio->state = SIM_RADIO_STATE_POWER_UP;
+    power_up_delay = SIM_PLL_CYCLES_TO_NS((uint32_t)GET_PWRUPDLAY(radio->regs[REG16_SLPPERIOD_PWRUPDLAY]) *
+                                          PWRUPDLAY_PLL_CYCLES_UNIT);
+    radio->state_event = sim_kernel_schedule_in(radio->kernel, power_up_delay, power_up_done_event, radio);
+}
+
+/** @brief Wake-up timer event.
+ *
+ *  @param[in] ctx  Radio instance.
+ */
+static void wake_event(void *ctx)
+{
+    sim_radio_t *radio = (sim_radio_t *)ctx;
+
+    radio->wake_event = SIM_EVENT_INVALID;
+    wake_up(radio, true);
+}
+
+/** @brief End of the power-up delay.
+ *
+ *  @param[in] ctx  Radio instance.
+ */
+static void power_up_done_event(void *ctx)
+{
+    sim_radio_t *radio = (sim_radio_t *)ctx;
+
+    radio->state_event = SIM_EVENT_INVALID;
+    start_activity(radio);
+}
+
+/** @brief Start the configured activity: transmission, reception or nothing.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+static void start_activity(sim_radio_t *radio)
+{
+    if (radio->start_tx) {
+        radio->state = SIM_RADIO_STATE_CCA;
+        cca_event(radio);
+    } else if (GET_RADIODIR(radio->regs[REG16_FRAMEPROC_PHASEDATA])) {
+        start_listen(radio, false,
+                     radio->timer_ref +
+                         SIM_PLL_CYCLES_TO_NS((uint32_t)GET_TIMEOUT(radio->regs[REG16_TIMELIMIT_BIASDELAY]) *
+                                              TIMEOUT_PLL_CYCLES_UNIT));
+    } else {
+        radio->state = SIM_RADIO_STATE_IDLE;
+    }
+}
+
+/** @brief Clear channel assessment, transmit when clear.
+ *
+ *  @param[in] ctx  Radio instance.
+ */
+static void cca_event(void *ctx)
+{
+    sim_radio_t *radio = (sim_radio_t *)ctx;
+    uint16_t cca_settings = radio->regs[REG16_CCA_SETTINGS];
+    bool cca_enabled = GET_CCATHRES(radio->regs[REG16_CCA_THRES_GAIN]) != 0;
+
+    radio->state_event = SIM_EVENT_INVALID;
+
+    if (!cca_enabled || !sim_channel_is_busy(radio->channel, get_rf_key(radio), radio)) {
+        transmit(radio, false);
+        return;
+    }
+
+    radio->stats.cca_busy++;
+    if (radio->cca_retries < GET_MAXRETRY(cca_settings)) {
+        radio->cca_retries++;
+        radio->state_event = sim_kernel_schedule_in(
+            radio->kernel,
+            SIM_PLL_CYCLES_TO_NS((uint32_t)(GET_CCAINTERV(cca_settings) + 1) * CCA_INTERVAL_PLL_UNIT), cca_event,
+            radio);
+        return;
+    }
+
+    if (GET_TXANYWAY(cca_settings)) {
+        transmit(radio, false);
+        return;
+    }
+    radio->stats.cca_fail++;
+    radio->start_tx = false;
+    raise_irq(radio, BIT_CCAFAILI);
+    if (GET_SLPCCAFA(radio->regs[REG16_TIMERCFG_SLEEPCFG])) {
+        enter_sleep(radio);
+    } else {
+        enter_idle(radio);
+    }
+}
+
+/** @brief Move the TX FIFO content to the frame to transmit.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+static void latch_tx_frame(sim_radio_t *radio)
+{
+    uint16_t size = GET_TXPKTSIZE(radio->regs[REG16_RX_TX_SIZEREG]);
+
+    memset(radio->tx_frame, 0, sizeof(radio->tx_frame));
+    memcpy(radio->tx_frame, radio->tx_fifo, (radio->tx_fifo_len < size) ? radio->tx_fifo_len : size);
+    radio->tx_frame_size = size;
+    radio->tx_frame_address = radio->regs[REG16_TXADDRESS];
+    radio->tx_fifo_len = 0;
+}
+
+/** @brief Put the frame to transmit on air.
+ *
+ *  A main frame is taken from the TX FIFO, an auto-reply has been latched at the end of the received frame.
+ *
+ *  @param[in] radio       Radio instance.
+ *  @param[in] auto_reply  Frame is an auto-reply.
+ */
+static void transmit(sim_radio_t *radio, bool auto_reply)
+{
+    sim_time_t end;
+
+    if (!auto_reply) {
+        latch_tx_frame(radio);
+        radio->start_tx = false;
+    }
+
+    end = sim_channel_transmit(radio->channel, radio, get_rf_key(radio), radio->tx_frame_address, radio->tx_frame,
+                               radio->tx_frame_size, auto_reply);
+    if (end == 0) {
+        /* No room left on the channel, the frame is silently dropped. */
+        end = radio->kernel->now + sim_channel_get_air_time(radio->channel, radio->tx_frame_size);
+    }
+
+    if (auto_reply) {
+        radio->stats.tx_auto_replies++;
+    } else {
+        radio->stats.tx_frames++;
+    }
+    radio->state = auto_reply ? SIM_RADIO_STATE_REPLY_TX : SIM_RADIO_STATE_TX;
+    radio->state_event = sim_kernel_schedule_at(radio->kernel, end, tx_end_event, radio);
+}
+
+/** @brief End of a transmission.
+ *
+ *  @param[in] ctx  Radio instance.
+ */
+static void tx_end_event(void *ctx)
+{
+    sim_radio_t *radio = (sim_radio_t *)ctx;
+    uint16_t sleep_cfg = radio->regs[REG16_TIMERCFG_SLEEPCFG];
+
+    radio->state_event = SIM_EVENT_INVALID;
+
+    if (radio->state == SIM_RADIO_STATE_REPLY_TX) {
+        raise_irq(radio, BIT_ARTXENDI);
+        if (GET_SLPRXEND(sleep_cfg)) {
+            enter_sleep(radio);
+        } else {
+            enter_idle(radio);
+        }
+        return;
+    }
+
+    raise_irq(radio, BIT_TXENDI);
+    if (GET_EXPECRP0(radio->regs[REG16_PHY_0_1])) {
+        start_listen(radio, true,
+                     radio->kernel->now + radio->cfg.turnaround_ns + radio->channel->cfg.preamble_ns +
+                         SIM_PLL_CYCLES_TO_NS(REPLY_LISTEN_MARGIN_PLL));
+    } else if (GET_SLPTXEND(sleep_cfg)) {
+        enter_sleep(radio);
+    } else {
+        enter_idle(radio);
+    }
+}
+
+/** @brief Open a receive window.
+ *
+ *  @param[in] radio       Radio instance.
+ *  @param[in] auto_reply  Waiting for an auto-reply.
+ *  @param[in] deadline    Receive window end.
+ */
+static void start_listen(sim_radio_t *radio, bool auto_reply, sim_time_t deadline)
+{
+    radio->state = auto_reply ? SIM_RADIO_STATE_REPLY_LISTEN : SIM_RADIO_STATE_RX_LISTEN;
+    radio->listen_start = radio->kernel->now;
+    radio->locked_frame = NULL;
+    radio->state_event = sim_kernel_schedule_at(radio->kernel, deadline, rx_timeout_event, radio);
+}
+
+/** @brief Receive window expired without synchronization.
+ *
+ *  @param[in] ctx  Radio instance.
+ */
+static void rx_timeout_event(void *ctx)
+{
+    sim_radio_t *radio = (sim_radio_t *)ctx;
+
+    radio->state_event = SIM_EVENT_INVALID;
+    radio->stats.rx_timeouts++;
+    raise_irq(radio, BIT_TIMEOUTI);
+    if (GET_SLPTIMEO(radio->regs[REG16_TIMERCFG_SLEEPCFG])) {
+        enter_sleep(radio);
+    } else {
+        enter_idle(radio);
+    }
+}
+
+/** @brief RX to TX turnaround elapsed, send the auto-reply.
+ *
+ *  @param[in] ctx  Radio instance.
+ */
+static void reply_start_event(void *ctx)
+{
+    sim_radio_t *radio = (sim_radio_t *)ctx;
+
+    radio->state_event = SIM_EVENT_INVALID;
+    transmit(radio, true);
+}
+
+/** @brief Push a byte in the RX FIFO.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @param[in] data   Byte.
+ */
+static void rx_fifo_push(sim_radio_t *radio, uint8_t data)
+{
+    if (radio->rx_fifo_wr >= SIM_RADIO_FIFO_SIZE) {
+        raise_irq(radio, BIT_RXOVRFLI);
+        return;
+    }
+    radio->rx_fifo[radio->rx_fifo_wr++] = data;
+}
+
+/** @brief Pop a byte from the RX FIFO.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @return Byte, 0 on underflow.
+ */
+static uint8_t rx_fifo_pop(sim_radio_t *radio)
+{
+    if (radio->rx_fifo_rd >= radio->rx_fifo_wr) {
+        raise_irq(radio, BIT_RXUDRFLI);
+        return 0;
+    }
+
+    return radio->rx_fifo[radio->rx_fifo_rd++];
+}
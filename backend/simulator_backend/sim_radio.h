@@ -0,0 +1,266 @@
+/** @file  sim_radio.h
+ *  @brief Behavioral model of an SR1100 transceiver for the host-side WPS simulator.
+ *
+ *  The model decodes the SPI byte stream produced by sr_access.h (single register accesses, register bursts and FIFO
+ *  bursts), keeps a shadow of the register map and implements the subset of the radio state machine exercised by
+ *  wps_phy_common.c: wake-up timer, CCA, frame transmission, reception with timeout, auto-reply in both directions,
+ *  automatic sleep on TX end / RX end / timeout and the IRQ flag and pin logic.
+ *
+ *  Not modeled: analog calibration results (DCRO, delay line), QSPI dummy cycles, BUFLOAD threshold interrupts,
+ *  ranging and the CIR phase information (reported as zeros).
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SIM_RADIO_H_
+#define SIM_RADIO_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+#include "sim_channel.h"
+#include "sim_kernel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Number of addressable registers. */
+#define SIM_RADIO_REG_COUNT 0x40
+/*! Size of the TX and RX FIFOs. */
+#define SIM_RADIO_FIFO_SIZE 512
+/*! Size of the NVM. */
+#define SIM_RADIO_NVM_SIZE 128
+
+/* TYPES **********************************************************************/
+/** @brief Radio model state.
+ */
+typedef enum sim_radio_state {
+    /*! Deep sleep without wake-up timer, POWER_STATE reads 0. */
+    SIM_RADIO_STATE_OFF = 0,
+    /*! Sleeping, waiting for the wake-up timer or a manual wake-up. */
+    SIM_RADIO_STATE_SLEEP,
+    /*! Awake and idle. */
+    SIM_RADIO_STATE_IDLE,
+    /*! Waiting for the power-up delay to elapse after a wake-up. */
+    SIM_RADIO_STATE_POWER_UP,
+    /*! Waiting for the next clear channel assessment. */
+    SIM_RADIO_STATE_CCA,
+    /*! Transmitting the main frame. */
+    SIM_RADIO_STATE_TX,
+    /*! Listening for the main frame. */
+    SIM_RADIO_STATE_RX_LISTEN,
+    /*! Receiving the main frame. */
+    SIM_RADIO_STATE_RX_FRAME,
+    /*! Transmitting an auto-reply. */
+    SIM_RADIO_STATE_REPLY_TX,
+    /*! Listening for an auto-reply. */
+    SIM_RADIO_STATE_REPLY_LISTEN,
+    /*! Receiving an auto-reply. */
+    SIM_RADIO_STATE_REPLY_FRAME,
+} sim_radio_state_t;
+
+/** @brief Radio model configuration.
+ */
+typedef struct sim_radio_cfg {
+    /*! SPI clock in Hz, used to time the blocking and non-blocking transfers. */
+    uint32_t spi_clock_hz;
+    /*! RX to TX turnaround before an auto-reply. */
+    sim_time_t turnaround_ns;
+    /*! NVM content returned through REG8_NVM. */
+    uint8_t nvm[SIM_RADIO_NVM_SIZE];
+} sim_radio_cfg_t;
+
+/** @brief Radio model statistics.
+ */
+typedef struct sim_radio_stats {
+    /*! Main frames transmitted. */
+    uint32_t tx_frames;
+    /*! Auto-replies transmitted. */
+    uint32_t tx_auto_replies;
+    /*! Frames received with a valid CRC and a matching address. */
+    uint32_t rx_good;
+    /*! Frames received with a bad CRC or a mismatching address. */
+    uint32_t rx_rejected;
+    /*! Receive windows that timed out. */
+    uint32_t rx_timeouts;
+    /*! Clear channel assessments that found the channel busy. */
+    uint32_t cca_busy;
+    /*! Transmissions aborted after the last CCA retry. */
+    uint32_t cca_fail;
+    /*! Wake-up events. */
+    uint32_t wakeups;
+    /*! Time spent awake, in nanoseconds. */
+    sim_time_t awake_ns;
+} sim_radio_stats_t;
+
+/** @brief Radio model instance.
+ */
+typedef struct sim_radio {
+    /*! Kernel driving the model. */
+    sim_kernel_t *kernel;
+    /*! Channel the radio is attached to. */
+    sim_channel_t *channel;
+    /*! Index of the radio on the channel. */
+    uint8_t channel_index;
+    /*! Configuration. */
+    sim_radio_cfg_t cfg;
+    /*! Register shadow. */
+    uint16_t regs[SIM_RADIO_REG_COUNT];
+    /*! Pending IRQ flags. */
+    uint16_t irq_flags;
+    /*! Enabled IRQ sources. */
+    uint16_t irq_enable;
+    /*! Current IRQ pin activity. */
+    bool irq_active;
+    /*! State. */
+    sim_radio_state_t state;
+    /*! Time at which the radio last woke up. */
+    sim_time_t awake_since;
+    /*! Reference of the wake-up timer. */
+    sim_time_t timer_ref;
+    /*! Pending wake-up event. */
+    sim_event_id_t wake_event;
+    /*! Pending state machine event (power-up, CCA, TX end, timeout). */
+    sim_event_id_t state_event;
+    /*! A transmission has been requested with STARTTX. */
+    bool start_tx;
+    /*! Number of CCA retries of the last transmission. */
+    uint8_t cca_retries;
+    /*! Frame the receiver is locked on. */
+    const sim_frame_t *locked_frame;
+    /*! Start of the current listening window. */
+    sim_time_t listen_start;
+    /*! Measured wait before the synchronization word, in PLL cycles. */
+    uint16_t rx_wait_pll_cycles;
+    /*! TX FIFO. */
+    uint8_t tx_fifo[SIM_RADIO_FIFO_SIZE];
+    /*! TX FIFO fill level. */
+    uint16_t tx_fifo_len;
+    /*! Frame being transmitted, latched from the TX FIFO. */
+    uint8_t tx_frame[SIM_MAX_FRAME_SIZE];
+    /*! Size of the frame being transmitted. */
+    uint16_t tx_frame_size;
+    /*! Destination address of the frame being transmitted. */
+    uint16_t tx_frame_address;
+    /*! RX FIFO. */
+    uint8_t rx_fifo[SIM_RADIO_FIFO_SIZE];
+    /*! RX FIFO read index. */
+    uint16_t rx_fifo_rd;
+    /*! RX FIFO write index. */
+    uint16_t rx_fifo_wr;
+    /*! SPI chip select is active. */
+    bool spi_cs;
+    /*! Next SPI byte is a command. */
+    bool spi_expect_cmd;
+    /*! Current register address. */
+    uint8_t spi_addr;
+    /*! Current access is a write. */
+    bool spi_write;
+    /*! Current access is a burst. */
+    bool spi_burst;
+    /*! Byte index within the current register. */
+    uint8_t spi_byte_idx;
+    /*! Register value being assembled or shifted out. */
+    uint16_t spi_word;
+    /*! Callback invoked when the IRQ pin becomes active. */
+    void (*irq_cb)(void *ctx);
+    /*! IRQ callback context. */
+    void *irq_ctx;
+    /*! Statistics. */
+    sim_radio_stats_t stats;
+} sim_radio_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the radio model in deep sleep with register defaults.
+ *
+ *  @param[in] radio    Radio instance.
+ *  @param[in] kernel   Kernel instance.
+ *  @param[in] channel  Channel to attach to.
+ *  @param[in] cfg      Radio configuration.
+ *  @retval true   Success.
+ *  @retval false  The channel is full.
+ */
+bool sim_radio_init(sim_radio_t *radio, sim_kernel_t *kernel, sim_channel_t *channel, const sim_radio_cfg_t *cfg);
+
+/** @brief Register the callback invoked on IRQ pin activation.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @param[in] cb     Callback.
+ *  @param[in] ctx    Callback context.
+ */
+void sim_radio_set_irq_callback(sim_radio_t *radio, void (*cb)(void *ctx), void *ctx);
+
+/** @brief Assert the chip select, starting a new SPI transaction.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+void sim_radio_spi_begin(sim_radio_t *radio);
+
+/** @brief Release the chip select.
+ *
+ *  @param[in] radio  Radio instance.
+ */
+void sim_radio_spi_end(sim_radio_t *radio);
+
+/** @brief Exchange one full-duplex SPI byte.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @param[in] mosi   Byte sent to the radio.
+ *  @return Byte received from the radio.
+ */
+uint8_t sim_radio_spi_byte(sim_radio_t *radio, uint8_t mosi);
+
+/** @brief Get the duration of an SPI transfer.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @param[in] size   Transfer size in bytes.
+ *  @return Transfer duration.
+ */
+sim_time_t sim_radio_spi_duration(sim_radio_t *radio, uint16_t size);
+
+/** @brief Get the logical IRQ pin state.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @retval true   An enabled IRQ source is pending.
+ *  @retval false  No enabled IRQ source is pending.
+ */
+bool sim_radio_irq_pin(sim_radio_t *radio);
+
+/** @brief Channel notification: a synchronization word is on air.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @param[in] frame  Frame on air.
+ */
+void sim_radio_on_frame_sync(sim_radio_t *radio, const sim_frame_t *frame);
+
+/** @brief Channel notification: a frame ended.
+ *
+ *  @param[in] radio     Radio instance.
+ *  @param[in] frame     Frame on air.
+ *  @param[in] crc_pass  The frame reached this radio uncorrupted.
+ */
+void sim_radio_on_frame_end(sim_radio_t *radio, const sim_frame_t *frame, bool crc_pass);
+
+/** @brief Get the channel the radio is attached to.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @return Channel instance.
+ */
+sim_channel_t *sim_radio_get_channel(sim_radio_t *radio);
+
+/** @brief Get the index of the radio on its channel.
+ *
+ *  @param[in] radio  Radio instance.
+ *  @return Channel index.
+ */
+uint8_t sim_radio_get_channel_index(sim_radio_t *radio);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_RADIO_H_ */
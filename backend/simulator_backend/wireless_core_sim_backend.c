@@ -0,0 +1,155 @@
+/** @file  wireless_core_sim_backend.c
+ *  @brief Implement swc_hal_facade facade prototype functions on top of the simulator port.
+ *
+ *  This file is linked in every simulated node module, next to the wireless core and the application. It only
+ *  forwards the facade calls to the port bound by the simulator through sim_node_bind().
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <stddef.h>
+#include "sim_port.h"
+#include "swc_hal_facade.h"
+
+/* CONSTANTS ******************************************************************/
+#define HALF_DUPLEX_MAX_SIZE 512
+
+/* PRIVATE GLOBALS ************************************************************/
+static const sim_port_t *sim_port;
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+/* Simulator Binding */
+__attribute__((visibility("default"))) void sim_node_bind(const sim_port_t *port)
+{
+    sim_port = port;
+}
+
+/* Context Switching and Interrupt Management */
+void swc_hal_radio_1_context_switch(void)
+{
+    sim_port->context_switch(sim_port->ctx);
+}
+
+void swc_hal_set_radio_1_irq_callback(void (*callback)(void))
+{
+    sim_port->set_radio_irq_callback(sim_port->ctx, callback);
+}
+
+void swc_hal_set_radio_1_non_blocking_transfer_callback(void (*callback)(void))
+{
+    sim_port->set_spi_callback(sim_port->ctx, callback);
+}
+
+void swc_hal_radio_1_disable_irq_it(void)
+{
+    sim_port->enable_radio_irq(sim_port->ctx, false);
+}
+
+void swc_hal_radio_1_enable_irq_it(void)
+{
+    sim_port->enable_radio_irq(sim_port->ctx, true);
+}
+
+void swc_hal_radio_1_disable_non_blocking_transfer_irq_it(void)
+{
+    sim_port->enable_spi_irq(sim_port->ctx, false);
+}
+
+void swc_hal_radio_1_enable_non_blocking_transfer_irq_it(void)
+{
+    sim_port->enable_spi_irq(sim_port->ctx, true);
+}
+
+/* Radio GPIO Management */
+bool swc_hal_radio_1_read_irq_pin(void)
+{
+    return sim_port->read_irq_pin(sim_port->ctx);
+}
+
+void swc_hal_radio_1_set_reset_pin(void)
+{
+    /* The virtual transceiver has no reset line. */
+}
+
+void swc_hal_radio_1_reset_reset_pin(void)
+{
+    /* The virtual transceiver has no reset line. */
+}
+
+/* Radio SPI Management */
+void swc_hal_radio_1_end_transfer(void)
+{
+    sim_port->spi_end(sim_port->ctx);
+}
+
+void swc_hal_radio_1_begin_transfer(void)
+{
+    sim_port->spi_begin(sim_port->ctx);
+}
+
+void swc_hal_radio_1_transfer_half_duplex_rx_blocking(uint8_t command, uint8_t *rx_data, uint16_t size)
+{
+    uint8_t status;
+    uint8_t dummy[HALF_DUPLEX_MAX_SIZE] = {0};
+
+    /* The quad lines are modeled as a regular SPI link. */
+    sim_port->spi_transfer(sim_port->ctx, &command, &status, 1, true);
+    sim_port->spi_transfer(sim_port->ctx, dummy, rx_data, size, true);
+}
+
+void swc_hal_radio_1_transfer_half_duplex_tx_blocking(uint8_t command, uint8_t *tx_data, uint16_t size)
+{
+    uint8_t status;
+    uint8_t dummy[HALF_DUPLEX_MAX_SIZE];
+
+    sim_port->spi_transfer(sim_port->ctx, &command, &status, 1, true);
+    sim_port->spi_transfer(sim_port->ctx, tx_data, dummy, size, true);
+}
+
+void swc_hal_radio_1_transfer_half_duplex_rx_non_blocking(uint8_t command, uint8_t *rx_data, uint16_t size)
+{
+    uint8_t status;
+    uint8_t dummy[HALF_DUPLEX_MAX_SIZE] = {0};
+
+    sim_port->spi_transfer(sim_port->ctx, &command, &status, 1, true);
+    sim_port->spi_transfer(sim_port->ctx, dummy, rx_data, size, false);
+}
+
+void swc_hal_radio_1_transfer_half_duplex_tx_non_blocking(uint8_t command, uint8_t *tx_data, uint16_t size)
+{
+    uint8_t status;
+    uint8_t dummy[HALF_DUPLEX_MAX_SIZE];
+
+    sim_port->spi_transfer(sim_port->ctx, &command, &status, 1, true);
+    sim_port->spi_transfer(sim_port->ctx, tx_data, dummy, size, false);
+}
+
+void swc_hal_radio_1_transfer_full_duplex_blocking(uint8_t *tx_data, uint8_t *rx_data, uint16_t size)
+{
+    sim_port->spi_transfer(sim_port->ctx, tx_data, rx_data, size, true);
+}
+
+void swc_hal_radio_1_transfer_full_duplex_non_blocking(uint8_t *tx_data, uint8_t *rx_data, uint16_t size)
+{
+    sim_port->spi_transfer(sim_port->ctx, tx_data, rx_data, size, false);
+}
+
+bool swc_hal_radio_1_is_transfer_busy(void)
+{
+    return sim_port->spi_is_busy(sim_port->ctx);
+}
+
+/* Timer and Delay Management */
+uint64_t swc_hal_get_tick_free_running_timer(void)
+{
+    return sim_port->get_tick(sim_port->ctx);
+}
+
+uint32_t swc_hal_get_free_running_timer_frequency_hz(void)
+{
+    return sim_port->tick_frequency_hz;
+}
@@ -11,20 +11,16 @@
 #include "sac_api.h"
 #include <string.h>
 #include "critical_section.h"
+#include "sac_footprint.h"
 #include "sac_utils.h"
+#if SAC_ENABLE_PERF_STATS
+#include "sac_hal_facade.h"
+#include "sac_stats.h"
+#endif
 
 /* CONSTANTS ******************************************************************/
-#define CDC_QUEUE_DATA_SIZE_INFLATION (SAC_MAX_CHANNEL_COUNT * SAC_WORD_SIZE_BYTE)
-#define CDC_QUEUE_SIZE_INFLATION      3
-#define TX_QUEUE_HIGH_LEVEL           2
-/* Number of free nodes required to do audio processing. */
-#define PROCESSING_NODE_COUNT 2
-/* Number of free nodes required for endpoint action. */
-#define EP_ACTION_NODE_COUNT 1
-/* Number of free nodes required for audio process input. */
-#define PROCESS_INPUT_NODE_COUNT 1
-/* Minimum number of queues in a system */
-#define MIN_QUEUE_NUM 1
+#define CDC_QUEUE_SIZE_INFLATION 3
+#define TX_QUEUE_HIGH_LEVEL      2
 
 /* PRIVATE GLOBALS ************************************************************/
 static mem_pool_t mem_pool;
@@ -37,9 +33,18 @@ static queue_t *init_audio_free_queue(const char *queue_name, uint16_t queue_dat
                                       uint8_t num_queues, sac_status_t *status);
 static void move_audio_packet_to_consumer_queue(sac_pipeline_t *pipeline, queue_node_t *processing_node,
                                                 sac_status_t *status);
-static bool is_process_exec_required(sac_processing_t *process, sac_pipeline_t *pipeline, queue_node_t *input_node,
-                                     sac_status_t *status);
-static queue_node_t *process_samples(sac_pipeline_t *pipeline, queue_node_t *input_node, sac_status_t *status);
+static bool is_process_exec_required(sac_processing_t *process, sac_pipeline_t *pipeline, sac_header_t *header,
+                                     uint8_t *data, uint16_t size, sac_status_t *status);
+static bool is_process_in_place(sac_processing_t *process, queue_node_t *node);
+static queue_node_t *process_samples(sac_pipeline_t *pipeline, sac_processing_t *process, sac_processing_t *end_process,
+                                     queue_node_t *input_node, sac_status_t *status);
+static bool is_header_corrupted(sac_pipeline_t *pipeline, sac_header_t *header);
+static bool is_producer_lending(sac_pipeline_t *pipeline);
+static bool is_consumer_direct(sac_pipeline_t *pipeline);
+static void discard_dropped_lent_packets(sac_pipeline_t *pipeline);
+static queue_node_t *process_lent_packet(sac_pipeline_t *pipeline, sac_processing_t **process, sac_status_t *status);
+static void render_to_consumer(sac_pipeline_t *pipeline, queue_node_t *node, sac_processing_t *last_process,
+                               sac_status_t *status);
 static void enqueue_producer_node(sac_pipeline_t *pipeline, sac_status_t *status);
 static uint16_t produce(sac_pipeline_t *pipeline, sac_status_t *status);
 static uint16_t consume(sac_pipeline_t *pipeline, sac_endpoint_t *consumer, sac_status_t *status);
@@ -48,6 +53,9 @@ static void consume_delay(sac_pipeline_t *pipeline, sac_endpoint_t *consumer, sa
 static queue_node_t *start_mixing_process(sac_pipeline_t *pipeline, sac_status_t *status);
 static bool is_consumer_overflowing(sac_endpoint_t *consumer);
 static sac_endpoint_t *find_last_endpoint(sac_endpoint_t *ep);
+#if SAC_ENABLE_PERF_STATS
+static void update_processing_queue_high_water_mark(sac_pipeline_t *pipeline);
+#endif
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 void sac_init(sac_cfg_t cfg, sac_status_t *status)
@@ -59,6 +67,11 @@ void sac_init(sac_cfg_t cfg, sac_status_t *status)
     queue_init();
 
     mem_pool_init(&mem_pool, cfg.memory_pool, cfg.memory_pool_size);
+    mem_pool_set_name(&mem_pool, "sac");
+
+#if SAC_ENABLE_PERF_STATS
+    sac_facade_perf_init();
+#endif
 
     sac_initialized = true;
 }
@@ -72,6 +85,15 @@ void sac_mixer_init(sac_mixer_module_cfg_t cfg, sac_status_t *status)
     sac_mixer_module = sac_mixer_module_init(cfg, &mem_pool, status);
 }
 
+void sac_mixer_set_input_gain(uint8_t input, int32_t gain_q31, sac_status_t *status)
+{
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(sac_mixer_module == NULL, status, SAC_ERR_NOT_INIT, return);
+
+    sac_mixer_module_set_input_gain(sac_mixer_module, input, gain_q31, status);
+}
+
 sac_pipeline_t *sac_pipeline_init(const char *name, sac_endpoint_t *producer, sac_pipeline_cfg_t cfg,
                                   sac_endpoint_t *consumer, sac_status_t *status)
 {
@@ -131,7 +153,7 @@ sac_endpoint_t *sac_endpoint_init(void *instance, const char *name, sac_endpoint
     endpoint->iface = iface;
     endpoint->cfg = cfg;
     endpoint->_internal.extra_queue_size = 0;
-    endpoint->_internal.num_endpoints = MIN_QUEUE_NUM;
+    endpoint->_internal.num_endpoints = SAC_MIN_QUEUE_NUM;
 
     return endpoint;
 }
@@ -417,7 +439,9 @@ void sac_pipeline_process(sac_pipeline_t *pipeline, sac_status_t *status)
     queue_node_t *output_node = NULL;
     sac_endpoint_t *consumer = NULL;
     sac_endpoint_t *producer = NULL;
-    uint8_t crc = 0;
+    sac_processing_t *process = NULL;
+    sac_processing_t *last_process = NULL;
+    bool lent = false;
 
     *status = SAC_OK;
 
@@ -426,6 +450,7 @@ void sac_pipeline_process(sac_pipeline_t *pipeline, sac_status_t *status)
 
     consumer = pipeline->consumer;
     producer = pipeline->producer;
+    process = pipeline->process;
 
     /* Prevent the mixer to make the buffering before the mixing. */
     if ((!pipeline->cfg.mixer_option.input_mixer_pipeline) && (!pipeline->cfg.mixer_option.output_mixer_pipeline)) {
@@ -457,14 +482,34 @@ void sac_pipeline_process(sac_pipeline_t *pipeline, sac_status_t *status)
             *status = SAC_WARN_NO_SAMPLES_TO_PROCESS;
             return;
         }
-        input_node = queue_get_free_node(pipeline->_internal.processing_queue);
-        sac_node_memcpy(input_node, producer_node->data, producer_node->data_size, status);
-        /* Free producer node to avoid conflict with producer. */
-        queue_free_node(producer_node);
-        if (*status != SAC_OK) {
-            /* Error while copying node content. */
-            queue_free_node(input_node);
-            return;
+        lent = is_producer_lending(pipeline);
+        if (lent) {
+            /* The node only accounts for a packet kept by the producer, the first stage reads the packet in place. */
+            queue_free_node(producer_node);
+            input_node = process_lent_packet(pipeline, &process, status);
+            if (input_node == NULL) {
+                return;
+            }
+        } else if (producer_node->copy_count == 0) {
+            /*
+             * The node is not shared with another producer queue, take ownership of it. The producer free queue
+             * reserves SAC_PROCESS_INPUT_NODE_COUNT nodes for this purpose so the producer is never starved.
+             */
+            input_node = producer_node;
+        } else {
+            /* The node is still referenced by another pipeline, work on a private copy. */
+            input_node = queue_get_free_node(pipeline->_internal.processing_queue);
+#if SAC_ENABLE_PERF_STATS
+            update_processing_queue_high_water_mark(pipeline);
+#endif
+            sac_node_memcpy(input_node, producer_node->data, producer_node->data_size, status);
+            /* Free producer node to avoid conflict with producer. */
+            queue_free_node(producer_node);
+            if (*status != SAC_OK) {
+                /* Error while copying node content. */
+                queue_free_node(input_node);
+                return;
+            }
         }
     }
 
@@ -473,21 +518,24 @@ void sac_pipeline_process(sac_pipeline_t *pipeline, sac_status_t *status)
      * been corrupted. In which case, set it to expected value to avoid queue node overflow
      * when using this packet as data source for memcpy().
      */
-    if (producer->cfg.use_encapsulation) {
-        crc = sac_node_get_header(input_node)->crc4;
-        sac_node_get_header(input_node)->crc4 = 0;
-        if (crc4itu(0, (uint8_t *)sac_node_get_header(input_node), sizeof(sac_header_t)) != crc) {
+    if (producer->cfg.use_encapsulation && !lent) {
+        if (is_header_corrupted(pipeline, sac_node_get_header(input_node))) {
             /* Audio packet is corrupted, set it to a known value. */
             sac_node_set_payload_size(input_node, producer->cfg.audio_payload_size);
-            sac_node_get_header(input_node)->fallback = 0;
-            sac_node_get_header(input_node)->tx_queue_level_high = 0;
-            pipeline->_statistics.producer_packets_corrupted_count++;
         }
     }
 
-    if (pipeline->process != NULL) {
+    if (is_consumer_direct(pipeline) && (process != NULL)) {
+        /* The last processing stage renders into the consumer buffer. */
+        last_process = process;
+        while (last_process->next_process != NULL) {
+            last_process = last_process->next_process;
+        }
+    }
+
+    if (process != NULL) {
         /* Apply all processing stages on audio packet. */
-        output_node = process_samples(pipeline, input_node, status);
+        output_node = process_samples(pipeline, process, last_process, input_node, status);
         if (*status != SAC_OK) {
             return;
         }
@@ -496,6 +544,12 @@ void sac_pipeline_process(sac_pipeline_t *pipeline, sac_status_t *status)
         output_node = input_node;
     }
 
+    if (is_consumer_direct(pipeline)) {
+        render_to_consumer(pipeline, output_node, last_process, status);
+        queue_free_node(output_node);
+        return;
+    }
+
     move_audio_packet_to_consumer_queue(pipeline, output_node, status);
 
     /*
@@ -521,6 +575,16 @@ uint32_t sac_get_allocated_bytes(sac_status_t *status)
     return mem_pool_get_allocated_bytes(&mem_pool);
 }
 
+void sac_get_memory_pool_stats(mem_pool_stats_t *stats, sac_status_t *status)
+{
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(!sac_initialized, status, SAC_ERR_NOT_INIT, return);
+    SAC_CHECK_STATUS(stats == NULL, status, SAC_ERR_NULL_PTR, return);
+
+    mem_pool_get_stats(&mem_pool, stats);
+}
+
 uint16_t sac_node_memcpy(queue_node_t *dest_node, uint8_t *data, uint16_t size, sac_status_t *status)
 {
     SAC_CHECK_STATUS(data == NULL, status, SAC_ERR_NULL_PTR, return 0);
@@ -574,21 +638,22 @@ static void init_audio_queues(sac_pipeline_t *pipeline, sac_status_t *status)
     uint8_t queue_size = 0;
     uint8_t num_queues_prod = producer->_internal.num_endpoints;
     uint8_t num_queues_cons = consumer->_internal.num_endpoints;
-    uint8_t num_queues_proc = MIN_QUEUE_NUM;
+    uint8_t num_queues_proc = SAC_MIN_QUEUE_NUM;
 
     *status = SAC_OK;
 
     /* Calculate required queue data inflation size. */
-    queue_data_inflation_size = SAC_NODE_PAYLOAD_SIZE_VAR_SIZE;
+    queue_data_inflation_size = SAC_NODE_TIMESTAMP_VAR_SIZE;
+    queue_data_inflation_size += SAC_NODE_PAYLOAD_SIZE_VAR_SIZE;
     queue_data_inflation_size += sizeof(sac_header_t);
-    queue_data_inflation_size += CDC_QUEUE_DATA_SIZE_INFLATION;
+    queue_data_inflation_size += SAC_CDC_QUEUE_DATA_SIZE_INFLATION;
 
     /* Initialize processing queue. */
     proc_queue_data_size = pipeline->cfg.max_payload_size;
     proc_queue_data_size += queue_data_inflation_size;
     proc_queue_data_size += sac_align_data_size(proc_queue_data_size, uint32_t); /* Align nodes on 32bits. */
     pipeline->_internal.processing_queue = init_audio_free_queue("Processing Free Queue", proc_queue_data_size,
-                                                                 PROCESSING_NODE_COUNT, num_queues_proc, status);
+                                                                 SAC_PROCESSING_NODE_COUNT, num_queues_proc, status);
     if (*status != SAC_OK) {
         return;
     }
@@ -608,7 +673,7 @@ static void init_audio_queues(sac_pipeline_t *pipeline, sac_status_t *status)
         }
         queue_size = producer->cfg.queue_size;
         /* Free queue is bigger to ensure produce action and audio process input can always succeed. */
-        free_queue_size = queue_size + EP_ACTION_NODE_COUNT + PROCESS_INPUT_NODE_COUNT;
+        free_queue_size = queue_size + SAC_EP_ACTION_NODE_COUNT + SAC_PROCESS_INPUT_NODE_COUNT;
         /* Initialize free queue with one extra node for producer action.
          * If multiple producers are chained, they will all share this free queue.
          */
@@ -654,7 +719,7 @@ static void init_audio_queues(sac_pipeline_t *pipeline, sac_status_t *status)
          */
         free_queue_size = queue_size;
         if (consumer->cfg.delayed_action) {
-            free_queue_size += EP_ACTION_NODE_COUNT;
+            free_queue_size += SAC_EP_ACTION_NODE_COUNT;
         }
         consumer->_internal.free_queue = init_audio_free_queue("Audio Buffer Free Queue", ep_queue_data_size,
                                                                free_queue_size, num_queues_cons, status);
@@ -808,70 +873,124 @@ static void move_audio_packet_to_consumer_queue(sac_pipeline_t *pipeline, queue_
     if (length > pipeline->_statistics.consumer_queue_peak_buffer_load) {
         pipeline->_statistics.consumer_queue_peak_buffer_load = length;
     }
+#if SAC_ENABLE_PERF_STATS
+    if (length > pipeline->_perf_statistics.consumer_queue_high_water_mark) {
+        pipeline->_perf_statistics.consumer_queue_high_water_mark = length;
+    }
+#endif
 }
 
 /** @brief Check if a process execution is required.
  *
  *  @param[in]  process   Process to check.
  *  @param[in]  pipeline  Pipeline of the process.
- *  @param[in]  node      Node to process.
+ *  @param[in]  header    Audio header of the packet to process.
+ *  @param[in]  data      Audio payload of the packet to process.
+ *  @param[in]  size      Size in bytes of the audio payload.
  *  @param[out] status    Status code.
  *  @return True if the process execution is required.
  */
-static bool is_process_exec_required(sac_processing_t *process, sac_pipeline_t *pipeline, queue_node_t *node,
-                                     sac_status_t *status)
+static bool is_process_exec_required(sac_processing_t *process, sac_pipeline_t *pipeline, sac_header_t *header,
+                                     uint8_t *data, uint16_t size, sac_status_t *status)
 {
     /* Only run process if gate returns true or gate is NULL. */
     if (process->iface.gate == NULL) {
         return true;
     } else {
-        return process->iface.gate(process, pipeline, sac_node_get_header(node), sac_node_get_data(node),
-                                   sac_node_get_payload_size(node), status);
+        return process->iface.gate(process, pipeline, header, data, size, status);
     }
 }
 
-/** @brief Apply all processing stages to a producer queue node.
+/** @brief Check if a process can write its output over its input node.
+ *
+ *  @param[in] process  Process to check.
+ *  @param[in] node     Node to process.
+ *  @return True if the process can be executed in place.
+ */
+static bool is_process_in_place(sac_processing_t *process, queue_node_t *node)
+{
+    /* A node still referenced by another queue must not be modified. */
+    if ((process->iface.is_in_place == NULL) || (node->copy_count != 0)) {
+        return false;
+    }
+
+    return process->iface.is_in_place(process->instance);
+}
+
+/** @brief Apply a range of processing stages to a producer queue node.
  *
  *  @param[in]  pipeline          Pipeline instance.
+ *  @param[in]  process           First processing stage to apply.
+ *  @param[in]  end_process       Processing stage following the last one to apply, NULL to apply the whole chain.
  *  @param[in]  input_node        Input node from the producer queue. This node could be shared with another pipeline,
  *                                so it should be read then freed.
  *  @param[out] status            Status code.
  *  @return Pointer to a producer queue node containing the processed data.
  */
-static queue_node_t *process_samples(sac_pipeline_t *pipeline, queue_node_t *input_node, sac_status_t *status)
+static queue_node_t *process_samples(sac_pipeline_t *pipeline, sac_processing_t *process, sac_processing_t *end_process,
+                                     queue_node_t *input_node, sac_status_t *status)
 {
     uint16_t rv = 0;
+    bool in_place = false;
     queue_node_t *output_node = NULL;
-    sac_processing_t *process = pipeline->process;
+#if SAC_ENABLE_PERF_STATS
+    uint32_t start_timestamp = 0;
+#endif
 
     *status = SAC_OK;
 
-    do {
-        if (is_process_exec_required(process, pipeline, input_node, status)) {
+    while (process != end_process) {
+        if (is_process_exec_required(process, pipeline, sac_node_get_header(input_node), sac_node_get_data(input_node),
+                                     sac_node_get_payload_size(input_node), status)) {
             if (*status != SAC_OK) {
                 queue_free_node(input_node);
                 return NULL;
             }
 
-            /* Get a process destination node. */
-            output_node = queue_get_free_node(pipeline->_internal.processing_queue);
-            if (output_node == NULL) {
-                *status = SAC_WARN_PROCESSING_Q_EMPTY;
-                queue_free_node(input_node);
-                return NULL;
+            in_place = is_process_in_place(process, input_node);
+            if (in_place) {
+                /* The process overwrites its input, no destination node is needed. */
+                output_node = input_node;
+            } else {
+                /* Get a process destination node. */
+                output_node = queue_get_free_node(pipeline->_internal.processing_queue);
+                if (output_node == NULL) {
+                    *status = SAC_WARN_PROCESSING_Q_EMPTY;
+                    queue_free_node(input_node);
+                    return NULL;
+                }
+#if SAC_ENABLE_PERF_STATS
+                update_processing_queue_high_water_mark(pipeline);
+#endif
             }
 
+#if SAC_ENABLE_PERF_STATS
+            start_timestamp = sac_facade_perf_get_timestamp();
+#endif
             rv = process->iface.process(process->instance, pipeline, sac_node_get_header(input_node),
                                         sac_node_get_data(input_node), sac_node_get_payload_size(input_node),
                                         sac_node_get_data(output_node), status);
+#if SAC_ENABLE_PERF_STATS
+            sac_perf_histogram_record(&process->_perf, sac_facade_perf_get_timestamp() - start_timestamp);
+#endif
             if (*status != SAC_OK) {
                 queue_free_node(input_node);
-                queue_free_node(output_node);
+                if (!in_place) {
+                    queue_free_node(output_node);
+                }
                 return NULL;
             }
-            if (rv != 0) { /* != 0 means processing happened. */
+            if (in_place) {
+                if (rv != 0) { /* != 0 means processing happened. */
+                    /* Update the size, the header is already in place. */
+                    sac_node_set_payload_size(input_node, rv);
+                }
+            } else if (rv != 0) { /* != 0 means processing happened. */
                 /* Copy the header from the input node. */
                 memcpy(sac_node_get_header(output_node), sac_node_get_header(input_node), sizeof(sac_header_t));
+#if SAC_ENABLE_PERF_STATS
+                sac_node_set_timestamp(output_node, sac_node_get_timestamp(input_node));
+#endif
                 /* Free input node. If the node is shared, it will stay in the other queue and won't go back to the
                  *  free queue yet.
                  */
@@ -886,7 +1005,7 @@ static queue_node_t *process_samples(sac_pipeline_t *pipeline, queue_node_t *inp
             output_node = NULL;
         }
         process = process->next_process;
-    } while (process != NULL);
+    }
 
     return input_node;
 }
@@ -902,7 +1021,7 @@ static void enqueue_producer_node(sac_pipeline_t *pipeline, sac_status_t *status
     queue_node_t *current_node = pipeline->producer->_internal.current_node;
     *status = SAC_OK;
 
-    if (producer->cfg.use_encapsulation) {
+    if (producer->cfg.use_encapsulation && !is_producer_lending(pipeline)) {
         /* If produced audio is encapsulated, save the payload size locally. */
         sac_node_set_payload_size(current_node, sac_node_get_header(current_node)->payload_size);
     }
@@ -917,10 +1036,21 @@ static void enqueue_producer_node(sac_pipeline_t *pipeline, sac_status_t *status
             *status = SAC_WARN_PRODUCER_Q_FULL;
             pipeline->_statistics.producer_buffer_overflow_count++;
             queue_free_node(queue_dequeue_node(producer->_internal.queue));
+            if (is_producer_lending(pipeline)) {
+                /* The producer still holds the dropped packet, the processing context discards it. */
+                CRITICAL_SECTION_ENTER();
+                pipeline->_internal.lent_packets_to_discard++;
+                CRITICAL_SECTION_EXIT();
+            }
         }
         producer = producer->next_endpoint;
     } while (producer != NULL);
 
+#if SAC_ENABLE_PERF_STATS
+    /* The packet latency is measured from the moment it is available to the pipeline. */
+    sac_node_set_timestamp(current_node, sac_facade_perf_get_timestamp());
+#endif
+
     /* Enqueue node. */
     producer = pipeline->producer;
     do {
@@ -928,6 +1058,14 @@ static void enqueue_producer_node(sac_pipeline_t *pipeline, sac_status_t *status
         producer = producer->next_endpoint;
     } while (producer != NULL);
 
+#if SAC_ENABLE_PERF_STATS
+    if (queue_get_length(pipeline->producer->_internal.queue) >
+        pipeline->_perf_statistics.producer_queue_high_water_mark) {
+        pipeline->_perf_statistics.producer_queue_high_water_mark = queue_get_length(
+            pipeline->producer->_internal.queue);
+    }
+#endif
+
     /* The current node is no longer been used by the producer. */
     pipeline->producer->_internal.current_node = NULL;
 }
@@ -943,6 +1081,10 @@ static uint16_t produce(sac_pipeline_t *pipeline, sac_status_t *status)
     sac_endpoint_t *producer = pipeline->producer;
     uint8_t *payload = NULL;
     uint16_t payload_size = 0;
+    uint16_t produced_size = 0;
+#if SAC_ENABLE_PERF_STATS
+    uint32_t start_timestamp = 0;
+#endif
 
     *status = SAC_OK;
 
@@ -954,6 +1096,11 @@ static uint16_t produce(sac_pipeline_t *pipeline, sac_status_t *status)
     }
 
     payload_size = producer->cfg.audio_payload_size;
+    if (is_producer_lending(pipeline)) {
+        /* The packet stays in the producer until it is processed, the node only accounts for it. */
+        sac_node_set_payload_size(producer->_internal.current_node, 0);
+        return payload_size;
+    }
     if (producer->cfg.use_encapsulation) {
         payload = (uint8_t *)sac_node_get_header(producer->_internal.current_node);
         payload_size += sizeof(sac_header_t);
@@ -962,7 +1109,15 @@ static uint16_t produce(sac_pipeline_t *pipeline, sac_status_t *status)
         sac_node_set_payload_size(producer->_internal.current_node, payload_size);
     }
 
-    return producer->iface.action(producer->instance, payload, payload_size);
+#if SAC_ENABLE_PERF_STATS
+    start_timestamp = sac_facade_perf_get_timestamp();
+#endif
+    produced_size = producer->iface.action(producer->instance, payload, payload_size);
+#if SAC_ENABLE_PERF_STATS
+    sac_perf_histogram_record(&pipeline->_perf_statistics.produce, sac_facade_perf_get_timestamp() - start_timestamp);
+#endif
+
+    return produced_size;
 }
 
 /** @brief Apply the consumer endpoint action on the current node.
@@ -976,6 +1131,10 @@ static uint16_t consume(sac_pipeline_t *pipeline, sac_endpoint_t *consumer, sac_
 {
     uint8_t *payload = NULL;
     uint16_t payload_size, crc = 0;
+    uint16_t consumed_size = 0;
+#if SAC_ENABLE_PERF_STATS
+    uint32_t start_timestamp = 0;
+#endif
 
     *status = SAC_OK;
 
@@ -1003,7 +1162,17 @@ static uint16_t consume(sac_pipeline_t *pipeline, sac_endpoint_t *consumer, sac_
         }
     }
 
-    return consumer->iface.action(consumer->instance, payload, payload_size);
+#if SAC_ENABLE_PERF_STATS
+    start_timestamp = sac_facade_perf_get_timestamp();
+    sac_perf_histogram_record(&pipeline->_perf_statistics.latency,
+                              start_timestamp - sac_node_get_timestamp(consumer->_internal.current_node));
+#endif
+    consumed_size = consumer->iface.action(consumer->instance, payload, payload_size);
+#if SAC_ENABLE_PERF_STATS
+    sac_perf_histogram_record(&pipeline->_perf_statistics.consume, sac_facade_perf_get_timestamp() - start_timestamp);
+#endif
+
+    return consumed_size;
 }
 
 /** @brief Execute the specified not delayed action consumer endpoint.
@@ -1137,10 +1306,293 @@ static queue_node_t *start_mixing_process(sac_pipeline_t *pipeline, sac_status_t
     /* Apply the Output Packet to the node and return it to the processing stage. */
     memcpy(sac_node_get_data(output_node), sac_mixer_module->output_packet_buffer, sac_mixer_module->cfg.payload_size);
     sac_node_set_payload_size(output_node, sac_mixer_module->cfg.payload_size);
+#if SAC_ENABLE_PERF_STATS
+    /* The mixed packet latency starts when it is created. */
+    sac_node_set_timestamp(output_node, sac_facade_perf_get_timestamp());
+#endif
+
+    return output_node;
+}
+
+/** @brief Check the CRC of an encapsulated audio header.
+ *
+ *  When the header is corrupted, the fields the pipeline relies on are reset and the packet is counted as corrupted.
+ *
+ *  @param[in] pipeline  Pipeline instance.
+ *  @param[in] header    Audio header to check.
+ *  @return True if the header is corrupted.
+ */
+static bool is_header_corrupted(sac_pipeline_t *pipeline, sac_header_t *header)
+{
+    uint8_t crc = header->crc4;
+
+    header->crc4 = 0;
+    if (crc4itu(0, (uint8_t *)header, sizeof(sac_header_t)) == crc) {
+        return false;
+    }
+
+    header->fallback = 0;
+    header->tx_queue_level_high = 0;
+    pipeline->_statistics.producer_packets_corrupted_count++;
+
+    return true;
+}
+
+/** @brief Check if the pipeline processes the producer packets where the producer stores them.
+ *
+ *  @param[in] pipeline  Pipeline instance.
+ *  @return True if the producer lends its packets instead of copying them in queue nodes.
+ */
+static bool is_producer_lending(sac_pipeline_t *pipeline)
+{
+    sac_endpoint_t *producer = pipeline->producer;
+
+    /* Shared producer nodes and delayed actions need the packet to be copied in a node. */
+    return (producer->iface.borrow != NULL) && (producer->iface.give_back != NULL) &&
+           (producer->next_endpoint == NULL) && (!producer->cfg.delayed_action) &&
+           (!pipeline->cfg.mixer_option.output_mixer_pipeline);
+}
+
+/** @brief Check if the pipeline renders its packets directly into the consumer buffers.
+ *
+ *  @param[in] pipeline  Pipeline instance.
+ *  @return True if the consumer provides its buffers instead of copying the packets from the consumer queue.
+ */
+static bool is_consumer_direct(sac_pipeline_t *pipeline)
+{
+    sac_endpoint_t *consumer = pipeline->consumer;
+
+    /* Several consumers, delayed actions and mixer inputs need the packet to be buffered in the consumer queue. */
+    return (consumer->iface.get_buffer != NULL) && (consumer->iface.commit != NULL) &&
+           (consumer->next_endpoint == NULL) && (!consumer->cfg.delayed_action) &&
+           (!pipeline->cfg.mixer_option.input_mixer_pipeline) && (!pipeline->cfg.mixer_option.output_mixer_pipeline);
+}
+
+/** @brief Discard the lent packets whose producer queue node was dropped on overflow.
+ *
+ *  @param[in] pipeline  Pipeline instance.
+ */
+static void discard_dropped_lent_packets(sac_pipeline_t *pipeline)
+{
+    sac_endpoint_t *producer = pipeline->producer;
+    uint16_t discard_count = 0;
+    uint16_t size = 0;
+
+    CRITICAL_SECTION_ENTER();
+    discard_count = pipeline->_internal.lent_packets_to_discard;
+    pipeline->_internal.lent_packets_to_discard = 0;
+    CRITICAL_SECTION_EXIT();
+
+    while (discard_count > 0) {
+        if (producer->iface.borrow(producer->instance, &size) == NULL) {
+            break;
+        }
+        producer->iface.give_back(producer->instance);
+        discard_count--;
+    }
+}
+
+/** @brief Run the first processing stages on the packet lent by the producer.
+ *
+ *  The stages read the packet where the producer stores it and the first one that processes it writes its output in
+ *  a processing node, so the packet is never copied. The packet is copied only if no stage processes it.
+ *
+ *  @param[in]     pipeline  Pipeline instance.
+ *  @param[in,out] process   First processing stage to apply, updated to the first stage that still has to be applied.
+ *  @param[out]    status    Status code.
+ *  @return Pointer to a processing queue node containing the packet, NULL if there is none.
+ */
+static queue_node_t *process_lent_packet(sac_pipeline_t *pipeline, sac_processing_t **process, sac_status_t *status)
+{
+    sac_endpoint_t *producer = pipeline->producer;
+    sac_header_t default_header = {0};
+    sac_header_t *header = &default_header;
+    queue_node_t *output_node = NULL;
+    uint8_t *packet = NULL;
+    uint8_t *payload = NULL;
+    uint16_t size = 0;
+    uint16_t payload_size = 0;
+    uint16_t rv = 0;
+#if SAC_ENABLE_PERF_STATS
+    uint32_t start_timestamp = 0;
+#endif
+
+    *status = SAC_OK;
+
+    discard_dropped_lent_packets(pipeline);
+
+    packet = producer->iface.borrow(producer->instance, &size);
+    if (packet == NULL) {
+        *status = SAC_WARN_NO_SAMPLES_TO_PROCESS;
+        return NULL;
+    }
+
+    payload = packet;
+    payload_size = size;
+    if (producer->cfg.use_encapsulation) {
+        if (size < sizeof(sac_header_t)) {
+            /* Not even a header, nothing to process. */
+            pipeline->_statistics.producer_packets_corrupted_count++;
+            producer->iface.give_back(producer->instance);
+            *status = SAC_WARN_NO_SAMPLES_TO_PROCESS;
+            return NULL;
+        }
+        header = (sac_header_t *)packet;
+        payload = packet + sizeof(sac_header_t);
+        payload_size = header->payload_size;
+        if (is_header_corrupted(pipeline, header)) {
+            payload_size = producer->cfg.audio_payload_size;
+        }
+        /* Never read past the lent packet. */
+        if (payload_size > (size - sizeof(sac_header_t))) {
+            payload_size = size - sizeof(sac_header_t);
+        }
+    }
+    if (payload_size > producer->cfg.audio_payload_size) {
+        payload_size = producer->cfg.audio_payload_size;
+    }
+
+    output_node = queue_get_free_node(pipeline->_internal.processing_queue);
+    if (output_node == NULL) {
+        producer->iface.give_back(producer->instance);
+        *status = SAC_WARN_PROCESSING_Q_EMPTY;
+        return NULL;
+    }
+#if SAC_ENABLE_PERF_STATS
+    update_processing_queue_high_water_mark(pipeline);
+    /* The packet latency is measured from the moment it is available to the pipeline. */
+    sac_node_set_timestamp(output_node, sac_facade_perf_get_timestamp());
+#endif
+
+    /* Apply the stages in place of the copy until one of them processes the packet. */
+    while ((*process != NULL) && (rv == 0)) {
+        if (is_process_exec_required(*process, pipeline, header, payload, payload_size, status)) {
+            if (*status != SAC_OK) {
+                break;
+            }
+#if SAC_ENABLE_PERF_STATS
+            start_timestamp = sac_facade_perf_get_timestamp();
+#endif
+            rv = (*process)->iface.process((*process)->instance, pipeline, header, payload, payload_size,
+                                           sac_node_get_data(output_node), status);
+#if SAC_ENABLE_PERF_STATS
+            sac_perf_histogram_record(&(*process)->_perf, sac_facade_perf_get_timestamp() - start_timestamp);
+#endif
+            if (*status != SAC_OK) {
+                break;
+            }
+        }
+        *process = (*process)->next_process;
+    }
+    if (*status != SAC_OK) {
+        producer->iface.give_back(producer->instance);
+        queue_free_node(output_node);
+        return NULL;
+    }
+
+    if (rv == 0) {
+        /* No stage processed the packet, copy it. */
+        memcpy(sac_node_get_data(output_node), payload, payload_size);
+        rv = payload_size;
+    }
+    memcpy(sac_node_get_header(output_node), header, sizeof(sac_header_t));
+    sac_node_set_payload_size(output_node, rv);
+
+    producer->iface.give_back(producer->instance);
 
     return output_node;
 }
 
+/** @brief Render a packet into a buffer of the consumer and hand it over.
+ *
+ *  The last processing stage writes its output directly into the consumer buffer. The packet is copied only if there
+ *  is no such stage or if it does not process the packet.
+ *
+ *  @param[in]  pipeline      Pipeline instance.
+ *  @param[in]  node          Node containing the packet processed by all the stages before the last one.
+ *  @param[in]  last_process  Last processing stage, NULL if it has already been applied.
+ *  @param[out] status        Status code.
+ */
+static void render_to_consumer(sac_pipeline_t *pipeline, queue_node_t *node, sac_processing_t *last_process,
+                               sac_status_t *status)
+{
+    sac_endpoint_t *consumer = pipeline->consumer;
+    uint16_t header_size = consumer->cfg.use_encapsulation ? sizeof(sac_header_t) : 0;
+    uint16_t payload_size = sac_node_get_payload_size(node);
+    sac_header_t *header = NULL;
+    uint8_t *buffer = NULL;
+    uint16_t rv = 0;
+    bool exec_required = false;
+#if SAC_ENABLE_PERF_STATS
+    uint32_t start_timestamp = 0;
+#endif
+
+    *status = SAC_OK;
+
+    /* Every check which can fail is done before a consumer buffer is taken, since it could not be given back. */
+    if (last_process != NULL) {
+        exec_required = is_process_exec_required(last_process, pipeline, sac_node_get_header(node),
+                                                 sac_node_get_data(node), payload_size, status);
+        if (*status != SAC_OK) {
+            return;
+        }
+    }
+
+    if (!consumer->_internal.buffering_complete) {
+        /* The audio core does not buffer packets for this consumer, it is started with the first one. */
+        consumer->_internal.buffering_complete = true;
+        consumer->iface.start(consumer->instance);
+    }
+
+    buffer = consumer->iface.get_buffer(
+        consumer->instance, header_size + pipeline->cfg.max_payload_size + SAC_CDC_QUEUE_DATA_SIZE_INFLATION);
+    if (buffer == NULL) {
+        /* The consumer is full, drop the packet. */
+        pipeline->_statistics.consumer_buffer_overflow_count++;
+        return;
+    }
+
+    if (exec_required) {
+#if SAC_ENABLE_PERF_STATS
+        start_timestamp = sac_facade_perf_get_timestamp();
+#endif
+        rv = last_process->iface.process(last_process->instance, pipeline, sac_node_get_header(node),
+                                         sac_node_get_data(node), payload_size, buffer + header_size, status);
+#if SAC_ENABLE_PERF_STATS
+        sac_perf_histogram_record(&last_process->_perf, sac_facade_perf_get_timestamp() - start_timestamp);
+#endif
+        if (*status != SAC_OK) {
+            /* The buffer belongs to the consumer, hand it over empty so it is released. */
+            consumer->iface.commit(consumer->instance, buffer, 0);
+            return;
+        }
+    }
+    if (rv == 0) {
+        /* No stage rendered the packet, copy it. */
+        memcpy(buffer + header_size, sac_node_get_data(node), payload_size);
+        rv = payload_size;
+    }
+
+    if (consumer->cfg.use_encapsulation) {
+        header = (sac_header_t *)buffer;
+        memcpy(header, sac_node_get_header(node), sizeof(sac_header_t));
+        header->payload_size = (uint8_t)rv;
+        /* No packet is waiting in the audio core for this consumer. */
+        header->tx_queue_level_high = 0;
+        header->crc4 = 0;
+        header->crc4 = crc4itu(0, buffer, sizeof(sac_header_t));
+    }
+
+#if SAC_ENABLE_PERF_STATS
+    start_timestamp = sac_facade_perf_get_timestamp();
+    sac_perf_histogram_record(&pipeline->_perf_statistics.latency, start_timestamp - sac_node_get_timestamp(node));
+#endif
+    consumer->iface.commit(consumer->instance, buffer, header_size + rv);
+#if SAC_ENABLE_PERF_STATS
+    sac_perf_histogram_record(&pipeline->_perf_statistics.consume, sac_facade_perf_get_timestamp() - start_timestamp);
+#endif
+}
+
 /** @brief Find the last endpoint in the list.
  *
  *  @param[in] ep  Top level endpoint of the lsit.
@@ -1155,3 +1607,19 @@ static sac_endpoint_t *find_last_endpoint(sac_endpoint_t *ep)
 
     return ep;
 }
+
+#if SAC_ENABLE_PERF_STATS
+/** @brief Update the highest number of processing nodes in use.
+ *
+ *  @param[in] pipeline  Pipeline instance.
+ */
+static void update_processing_queue_high_water_mark(sac_pipeline_t *pipeline)
+{
+    queue_t *processing_queue = pipeline->_internal.processing_queue;
+    uint16_t in_use = queue_get_limit(processing_queue) - queue_get_length(processing_queue);
+
+    if (in_use > pipeline->_perf_statistics.processing_queue_high_water_mark) {
+        pipeline->_perf_statistics.processing_queue_high_water_mark = in_use;
+    }
+}
+#endif
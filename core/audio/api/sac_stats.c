@@ -12,6 +12,24 @@
 #include <inttypes.h>
 #include <stdio.h>
 #include "sac_utils.h"
+#if SAC_ENABLE_PERF_STATS
+#include "sac_hal_facade.h"
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Number of fields of the TELEMETRY_RECORD_SAC_PIPELINE_STATS record. */
+#define TELEMETRY_PIPELINE_STATS_FIELD_COUNT 9
+#if SAC_ENABLE_PERF_STATS
+/*! Percentile reported by sac_pipeline_format_perf_stats(). */
+#define PERF_STATS_FORMAT_PERCENTILE 99
+#endif
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+#if SAC_ENABLE_PERF_STATS
+static uint16_t perf_histogram_get_bin(uint32_t duration);
+static uint32_t perf_histogram_get_bin_upper_bound(uint16_t bin);
+static int format_perf_histogram(char *buffer, uint16_t size, const char *name, const sac_perf_histogram_t *histogram);
+#endif
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 sac_statistics_t *sac_pipeline_update_stats(sac_pipeline_t *pipeline, sac_status_t *status)
@@ -76,6 +94,29 @@ int sac_pipeline_format_stats(sac_pipeline_t *pipeline, char *buffer, uint16_t s
     return string_length;
 }
 
+void sac_pipeline_add_stats_telemetry(sac_pipeline_t *pipeline, telemetry_t *telemetry, uint8_t instance,
+                                      sac_status_t *status)
+{
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(pipeline == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS(telemetry == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS(!telemetry_start_record(telemetry, TELEMETRY_RECORD_SAC_PIPELINE_STATS,
+                                             SAC_TELEMETRY_PIPELINE_STATS_VERSION, instance,
+                                             TELEMETRY_PIPELINE_STATS_FIELD_COUNT),
+                     status, SAC_ERR_NOT_ENOUGH_MEMORY, return);
+
+    telemetry_put_u32(telemetry, pipeline->_statistics.producer_buffer_load);
+    telemetry_put_u32(telemetry, pipeline->_statistics.producer_buffer_size);
+    telemetry_put_u32(telemetry, pipeline->_statistics.producer_buffer_overflow_count);
+    telemetry_put_u32(telemetry, pipeline->_statistics.producer_packets_corrupted_count);
+    telemetry_put_u32(telemetry, pipeline->_statistics.consumer_buffer_load);
+    telemetry_put_u32(telemetry, pipeline->_statistics.consumer_buffer_size);
+    telemetry_put_u32(telemetry, pipeline->_statistics.consumer_buffer_overflow_count);
+    telemetry_put_u32(telemetry, pipeline->_statistics.consumer_buffer_underflow_count);
+    telemetry_put_u32(telemetry, pipeline->_statistics.consumer_queue_peak_buffer_load);
+}
+
 uint32_t sac_pipeline_get_producer_buffer_load(sac_pipeline_t *pipeline, sac_status_t *status)
 {
     *status = SAC_OK;
@@ -156,3 +197,206 @@ void sac_pipeline_reset_stats(sac_pipeline_t *pipeline, sac_status_t *status)
     pipeline->_statistics.producer_buffer_size = produce_size;
     pipeline->_statistics.consumer_buffer_size = consume_size;
 }
+
+#if SAC_ENABLE_PERF_STATS
+sac_perf_statistics_t *sac_pipeline_get_perf_stats(sac_pipeline_t *pipeline, sac_status_t *status)
+{
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(pipeline == NULL, status, SAC_ERR_NULL_PTR, return NULL);
+
+    return &pipeline->_perf_statistics;
+}
+
+sac_perf_histogram_t *sac_processing_get_perf_stats(sac_processing_t *process, sac_status_t *status)
+{
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(process == NULL, status, SAC_ERR_NULL_PTR, return NULL);
+
+    return &process->_perf;
+}
+
+int sac_pipeline_format_perf_stats(sac_pipeline_t *pipeline, char *buffer, uint16_t size, sac_status_t *status)
+{
+    int string_length = 0;
+    sac_perf_statistics_t *perf = NULL;
+    sac_processing_t *process = NULL;
+
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(pipeline == NULL, status, SAC_ERR_NULL_PTR, return 0);
+    SAC_CHECK_STATUS(buffer == NULL, status, SAC_ERR_NULL_PTR, return 0);
+
+    perf = &pipeline->_perf_statistics;
+
+    string_length = snprintf(buffer, size,
+                             "<<< %s Performance >>>\r\n"
+                             "Timestamp Frequency:\t%10lu Hz\r\n"
+                             "  %-20s %10s %10s %10s %10s %10s\r\n",
+                             pipeline->name, (unsigned long)sac_facade_perf_get_timestamp_frequency_hz(), "Ticks",
+                             "Count", "Min", "Avg", "P99", "Max");
+
+    if (string_length < size) {
+        string_length += format_perf_histogram(&buffer[string_length], size - string_length, "Produce",
+                                               &perf->produce);
+    }
+    process = pipeline->process;
+    while ((process != NULL) && (string_length < size)) {
+        string_length += format_perf_histogram(&buffer[string_length], size - string_length, process->name,
+                                               &process->_perf);
+        process = process->next_process;
+    }
+    if (string_length < size) {
+        string_length += format_perf_histogram(&buffer[string_length], size - string_length, "Consume",
+                                               &perf->consume);
+    }
+    if (string_length < size) {
+        string_length += format_perf_histogram(&buffer[string_length], size - string_length, "Latency",
+                                               &perf->latency);
+    }
+    if (string_length < size) {
+        string_length += snprintf(&buffer[string_length], size - string_length,
+                                  "Queue High-Water Mark\r\n"
+                                  "  Producer:\t\t\t%10u\r\n"
+                                  "  Processing:\t\t\t%10u\r\n"
+                                  "  Consumer:\t\t\t%10u\r\n",
+                                  perf->producer_queue_high_water_mark, perf->processing_queue_high_water_mark,
+                                  perf->consumer_queue_high_water_mark);
+    }
+
+    return string_length;
+}
+
+void sac_pipeline_reset_perf_stats(sac_pipeline_t *pipeline, sac_status_t *status)
+{
+    sac_processing_t *process = NULL;
+
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(pipeline == NULL, status, SAC_ERR_NULL_PTR, return);
+
+    memset(&pipeline->_perf_statistics, 0, sizeof(sac_perf_statistics_t));
+
+    process = pipeline->process;
+    while (process != NULL) {
+        memset(&process->_perf, 0, sizeof(sac_perf_histogram_t));
+        process = process->next_process;
+    }
+}
+
+void sac_perf_histogram_record(sac_perf_histogram_t *histogram, uint32_t duration)
+{
+    if ((histogram->count == 0) || (duration < histogram->min)) {
+        histogram->min = duration;
+    }
+    if (duration > histogram->max) {
+        histogram->max = duration;
+    }
+    histogram->count++;
+    histogram->total += duration;
+    histogram->bins[perf_histogram_get_bin(duration)]++;
+}
+
+uint32_t sac_perf_histogram_get_percentile(const sac_perf_histogram_t *histogram, uint8_t percent)
+{
+    uint32_t target_count = 0;
+    uint32_t cumulative_count = 0;
+    uint32_t upper_bound = 0;
+
+    if (histogram->count == 0) {
+        return 0;
+    }
+
+    /* Rank of the percentile, rounded up. */
+    target_count = (uint32_t)((((uint64_t)histogram->count * percent) + 99) / 100);
+
+    for (uint16_t bin = 0; bin < SAC_PERF_HISTOGRAM_BIN_COUNT; bin++) {
+        cumulative_count += histogram->bins[bin];
+        if (cumulative_count >= target_count) {
+            upper_bound = perf_histogram_get_bin_upper_bound(bin);
+            break;
+        }
+    }
+
+    /* A bin upper bound may exceed every recorded duration. */
+    if (upper_bound > histogram->max) {
+        upper_bound = histogram->max;
+    }
+
+    return upper_bound;
+}
+#endif
+
+/* PRIVATE FUNCTIONS **********************************************************/
+#if SAC_ENABLE_PERF_STATS
+/** @brief Get the histogram bin of a duration.
+ *
+ *  Durations smaller than SAC_PERF_HISTOGRAM_SUB_BIN_COUNT have their own bin. Above that, each power
+ *  of two is split into SAC_PERF_HISTOGRAM_SUB_BIN_COUNT bins selected by the bits following the most
+ *  significant one.
+ *
+ *  @param[in] duration  Duration in timestamp ticks.
+ *  @return Bin index.
+ */
+static uint16_t perf_histogram_get_bin(uint32_t duration)
+{
+    uint32_t msb = 0;
+    uint32_t bin = 0;
+
+    if (duration < SAC_PERF_HISTOGRAM_SUB_BIN_COUNT) {
+        return (uint16_t)duration;
+    }
+
+    msb = 31 - (uint32_t)__builtin_clz(duration);
+    bin = ((msb - SAC_PERF_HISTOGRAM_SUB_BIN_BITS + 1) << SAC_PERF_HISTOGRAM_SUB_BIN_BITS) +
+          ((duration >> (msb - SAC_PERF_HISTOGRAM_SUB_BIN_BITS)) & (SAC_PERF_HISTOGRAM_SUB_BIN_COUNT - 1));
+    if (bin >= SAC_PERF_HISTOGRAM_BIN_COUNT) {
+        bin = SAC_PERF_HISTOGRAM_BIN_COUNT - 1;
+    }
+
+    return (uint16_t)bin;
+}
+
+/** @brief Get the largest duration counted in a histogram bin.
+ *
+ *  @param[in] bin  Bin index.
+ *  @return Largest duration in timestamp ticks, UINT32_MAX for the last bin since it has no upper bound.
+ */
+static uint32_t perf_histogram_get_bin_upper_bound(uint16_t bin)
+{
+    uint32_t octave = bin >> SAC_PERF_HISTOGRAM_SUB_BIN_BITS;
+    uint32_t sub_bin = bin & (SAC_PERF_HISTOGRAM_SUB_BIN_COUNT - 1);
+
+    if (bin == (SAC_PERF_HISTOGRAM_BIN_COUNT - 1)) {
+        return UINT32_MAX;
+    }
+    if (octave == 0) {
+        return sub_bin;
+    }
+
+    return ((SAC_PERF_HISTOGRAM_SUB_BIN_COUNT + sub_bin + 1) << (octave - 1)) - 1;
+}
+
+/** @brief Format a performance histogram as a single line.
+ *
+ *  @param[out] buffer     Buffer where to put the formatted string.
+ *  @param[in]  size       Size of the buffer.
+ *  @param[in]  name       Name of the measured operation.
+ *  @param[in]  histogram  Histogram to format.
+ *  @return The formatted string length, excluding the NULL terminator.
+ */
+static int format_perf_histogram(char *buffer, uint16_t size, const char *name, const sac_perf_histogram_t *histogram)
+{
+    uint32_t average = 0;
+
+    if (histogram->count != 0) {
+        average = (uint32_t)(histogram->total / histogram->count);
+    }
+
+    return snprintf(buffer, size, "  %-20s %10lu %10lu %10lu %10lu %10lu\r\n", name, (unsigned long)histogram->count,
+                    (unsigned long)histogram->min, (unsigned long)average,
+                    (unsigned long)sac_perf_histogram_get_percentile(histogram, PERF_STATS_FORMAT_PERCENTILE),
+                    (unsigned long)histogram->max);
+}
+#endif
@@ -16,6 +16,10 @@ static uint16_t ep_swc_action_consume(void *instance, uint8_t *samples, uint16_t
 static void ep_swc_consumer_start(void *instance);
 static void ep_swc_producer_start(void *instance);
 static void ep_swc_stop(void *instance);
+static uint8_t *ep_swc_borrow(void *instance, uint16_t *size);
+static void ep_swc_give_back(void *instance);
+static uint8_t *ep_swc_get_buffer(void *instance, uint16_t size);
+static uint16_t ep_swc_commit(void *instance, uint8_t *buffer, uint16_t size);
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 void sac_endpoint_swc_init(sac_endpoint_interface_t *swc_producer_iface, sac_endpoint_interface_t *swc_consumer_iface)
@@ -33,6 +37,22 @@ void sac_endpoint_swc_init(sac_endpoint_interface_t *swc_producer_iface, sac_end
     }
 }
 
+void sac_endpoint_swc_zero_copy_init(sac_endpoint_interface_t *swc_producer_iface,
+                                     sac_endpoint_interface_t *swc_consumer_iface)
+{
+    sac_endpoint_swc_init(swc_producer_iface, swc_consumer_iface);
+
+    if (swc_producer_iface != NULL) {
+        swc_producer_iface->borrow = ep_swc_borrow;
+        swc_producer_iface->give_back = ep_swc_give_back;
+    }
+
+    if (swc_consumer_iface != NULL) {
+        swc_consumer_iface->get_buffer = ep_swc_get_buffer;
+        swc_consumer_iface->commit = ep_swc_commit;
+    }
+}
+
 /* PRIVATE FUNCTIONS **********************************************************/
 /** @brief Produce Endpoint of the SPARK Wireless Core.
  *
@@ -122,3 +142,75 @@ static void ep_swc_stop(void *instance)
 {
     (void)instance;
 }
+
+/** @brief Lend the oldest received frame of the SPARK Wireless Core.
+ *
+ *  @param[in]  instance  Endpoint instance.
+ *  @param[out] size      Size of the frame in bytes.
+ *  @return The frame payload, NULL if no frame has been received.
+ */
+static uint8_t *ep_swc_borrow(void *instance, uint16_t *size)
+{
+    uint8_t *payload = NULL;
+    swc_error_t err = SWC_ERR_NONE;
+    ep_swc_instance_t *inst = (ep_swc_instance_t *)instance;
+
+    *size = swc_connection_receive(inst->connection, &payload, &err);
+    if (err != SWC_ERR_NONE) {
+        return NULL;
+    }
+
+    return payload;
+}
+
+/** @brief Free the frame lent by ep_swc_borrow().
+ *
+ *  @param[in] instance  Endpoint instance.
+ */
+static void ep_swc_give_back(void *instance)
+{
+    swc_error_t err = SWC_ERR_NONE;
+    ep_swc_instance_t *inst = (ep_swc_instance_t *)instance;
+
+    swc_connection_receive_complete(inst->connection, &err);
+}
+
+/** @brief Get the next payload buffer of the SPARK Wireless Core.
+ *
+ *  @param[in] instance  Endpoint instance.
+ *  @param[in] size      Largest number of bytes the audio core may write.
+ *  @return The payload buffer, NULL if the transmit queue is full or if size exceeds the maximum payload size of the
+ *          connection.
+ */
+static uint8_t *ep_swc_get_buffer(void *instance, uint16_t size)
+{
+    uint8_t *buf = NULL;
+    swc_error_t err = SWC_ERR_NONE;
+    ep_swc_instance_t *inst = (ep_swc_instance_t *)instance;
+
+    /* The payload buffers only hold the maximum payload size of the connection, a larger packet would overflow them. */
+    if (size > inst->connection->cfg.max_payload_size) {
+        return NULL;
+    }
+
+    swc_connection_get_payload_buffer(inst->connection, &buf, &err);
+
+    return buf;
+}
+
+/** @brief Send a payload buffer returned by ep_swc_get_buffer().
+ *
+ *  @param[in] instance  Endpoint instance.
+ *  @param[in] buffer    Payload buffer.
+ *  @param[in] size      Size of the payload in bytes.
+ *  @return Number of bytes consumed.
+ */
+static uint16_t ep_swc_commit(void *instance, uint8_t *buffer, uint16_t size)
+{
+    swc_error_t err = SWC_ERR_NONE;
+    ep_swc_instance_t *inst = (ep_swc_instance_t *)instance;
+
+    swc_connection_send(inst->connection, buffer, size, &err);
+
+    return (err == SWC_ERR_NONE) ? size : 0;
+}
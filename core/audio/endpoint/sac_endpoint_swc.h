@@ -34,6 +34,21 @@ typedef struct ep_swc_instance {
  */
 void sac_endpoint_swc_init(sac_endpoint_interface_t *swc_producer_iface, sac_endpoint_interface_t *swc_consumer_iface);
 
+/** @brief Initialize Wireless Core audio endpoint without copies.
+ *
+ *  The producer lends the received frames to the pipeline until they are processed, and the consumer lets the last
+ *  processing stage render into the wireless payload buffers. The Wireless Core queues then hold the audio buffering:
+ *  the consumer pipeline does not use its consumer queue, and the receive queue of the connection should be at least
+ *  as deep as the producer queue. The connections must not use fragmentation. The maximum payload size of the consumer
+ *  connection must hold the audio header, if used, the maximum payload size of the pipeline and
+ *  SAC_CDC_QUEUE_DATA_SIZE_INFLATION, otherwise every packet is dropped and counted as a consumer buffer overflow.
+ *
+ *  @param[out] swc_producer_iface  Wireless Core producer audio endpoint interface.
+ *  @param[out] swc_consumer_iface  Wireless Core consumer audio endpoint interface.
+ */
+void sac_endpoint_swc_zero_copy_init(sac_endpoint_interface_t *swc_producer_iface,
+                                     sac_endpoint_interface_t *swc_consumer_iface);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,6 +1,11 @@
 /** @file  sac_mixer_module.c
  *  @brief SPARK Audio Core Mixer Module is used to mix multiple audio streams into one.
  *
+ *  The 16-bit samples are scaled by Q2.14 gains, which hold the unity gain exactly, and summed in a saturating 32-bit
+ *  accumulator. On cores implementing the Arm DSP extension (Cortex-M33, Cortex-M4, ...) two samples are loaded per
+ *  word and scaled with the SMULBB and SMULTB halfword multiplies, other targets use a portable C implementation
+ *  producing the same results.
+ *
  *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
  *  @license   This source code is proprietary and subject to the SPARK Microsystems
                Software EULA found in this package in file EULA.txt.
@@ -10,10 +15,31 @@
 /* INCLUDES *******************************************************************/
 #include "sac_mixer_module.h"
 #include <stddef.h>
+#include <string.h>
+#include "fixed_point.h"
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include <arm_acle.h>
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Number of precision bits of the gains applied to 16-bit samples. */
+#define GAIN_Q14_PRECISION 14
+/*! Shift converting a Q1.31 gain to Q2.14. */
+#define GAIN_Q31_TO_Q14_SHIFT (FIXED_POINT_Q31_PRECISION - GAIN_Q14_PRECISION)
+/*! Initial accumulator value rounding the scaled 16-bit samples to the nearest integer. */
+#define GAIN_Q14_ROUNDING (1 << (GAIN_Q14_PRECISION - 1))
+/*! Range of a 24-bit sample. */
+#define INT24_MAX ((1 << 23) - 1)
+#define INT24_MIN (-(1 << 23))
 
 /* PRIVATE FUNCTION PROTOTYPE *************************************************/
-static void algo_mix_int16_samples(sac_mixer_module_t *sac_mixer_module);
-static uint8_t get_audio_payload_samples_count(sac_mixer_module_t *sac_mixer_module);
+static void mix_int16_samples(const sac_mixer_module_t *sac_mixer_module, const uint8_t *const *input,
+                              uint8_t *output, uint16_t sample_count);
+static void mix_int32_samples(const sac_mixer_module_t *sac_mixer_module, const uint8_t *const *input,
+                              uint8_t *output, uint16_t sample_count, int32_t sample_min, int32_t sample_max);
+static inline int32_t saturating_add(int32_t a, int32_t b);
+static inline int16_t saturate_int16(int32_t value);
+static uint8_t get_sample_size(uint8_t bit_depth);
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 sac_mixer_module_t *sac_mixer_module_init(sac_mixer_module_cfg_t cfg, mem_pool_t *mem_pool, sac_status_t *sac_status)
@@ -33,12 +59,13 @@ sac_mixer_module_t *sac_mixer_module_init(sac_mixer_module_cfg_t cfg, mem_pool_t
         return NULL;
     }
 
-    if (cfg.bit_depth != 16) {
+    if (get_sample_size(cfg.bit_depth) == 0) {
         *sac_status = SAC_ERR_MIXER_INIT_FAILURE;
         return NULL;
     }
 
-    if ((cfg.payload_size < MIN_NB_OF_BYTES_PER_PAYLOAD) || (cfg.payload_size > MAX_NB_OF_BYTES_PER_PAYLOAD)) {
+    if ((cfg.payload_size < MIN_NB_OF_BYTES_PER_PAYLOAD) || (cfg.payload_size > MAX_NB_OF_BYTES_PER_PAYLOAD) ||
+        ((cfg.payload_size % get_sample_size(cfg.bit_depth)) != 0)) {
         *sac_status = SAC_ERR_MIXER_INIT_FAILURE;
         return NULL;
     }
@@ -46,13 +73,68 @@ sac_mixer_module_t *sac_mixer_module_init(sac_mixer_module_cfg_t cfg, mem_pool_t
     /* Apply the configurations */
     sac_mixer_module->cfg = cfg;
 
+    for (uint8_t input = 0; input < cfg.nb_of_inputs; input++) {
+        sac_mixer_module_set_input_gain(sac_mixer_module, input, SAC_MIXER_GAIN_UNITY, sac_status);
+    }
+
     return sac_mixer_module;
 }
 
+void sac_mixer_module_set_input_gain(sac_mixer_module_t *sac_mixer_module, uint8_t input, int32_t gain_q31,
+                                     sac_status_t *sac_status)
+{
+    *sac_status = SAC_OK;
+
+    if (input >= sac_mixer_module->cfg.nb_of_inputs) {
+        *sac_status = SAC_ERR_INVALID_ARG;
+        return;
+    }
+
+    sac_mixer_module->gain_q31[input] = gain_q31;
+    /* Round to nearest, SAC_MIXER_GAIN_UNITY gives the exact Q2.14 unity. */
+    sac_mixer_module->gain_q14[input] = (int32_t)(((int64_t)gain_q31 + (1 << (GAIN_Q31_TO_Q14_SHIFT - 1))) >>
+                                                  GAIN_Q31_TO_Q14_SHIFT);
+}
+
 void sac_mixer_module_mix_packets(sac_mixer_module_t *sac_mixer_module)
 {
-    if (sac_mixer_module->cfg.bit_depth == 16) {
-        algo_mix_int16_samples(sac_mixer_module);
+    const uint8_t *input[MAX_NB_OF_INPUTS];
+    uint8_t read_index[MAX_NB_OF_INPUTS];
+    uint8_t nb_of_inputs = sac_mixer_module->cfg.nb_of_inputs;
+    uint8_t remaining_size = sac_mixer_module->cfg.payload_size;
+    uint8_t output_offset = 0;
+    uint8_t chunk_size = 0;
+
+    for (uint8_t i = 0; i < nb_of_inputs; i++) {
+        read_index[i] = sac_mixer_module->input_samples_queue[i].read_index;
+    }
+
+    /* Mix in chunks over which no input wraps around its ring buffer. */
+    while (remaining_size > 0) {
+        chunk_size = remaining_size;
+        for (uint8_t i = 0; i < nb_of_inputs; i++) {
+            if ((MAX_NB_OF_BYTES_PER_BUFFER - read_index[i]) < chunk_size) {
+                chunk_size = MAX_NB_OF_BYTES_PER_BUFFER - read_index[i];
+            }
+            input[i] = &sac_mixer_module->input_samples_queue[i].samples[read_index[i]];
+        }
+
+        if (sac_mixer_module->cfg.bit_depth == 16) {
+            mix_int16_samples(sac_mixer_module, input, &sac_mixer_module->output_packet_buffer[output_offset],
+                              chunk_size / sizeof(int16_t));
+        } else if (sac_mixer_module->cfg.bit_depth == 24) {
+            mix_int32_samples(sac_mixer_module, input, &sac_mixer_module->output_packet_buffer[output_offset],
+                              chunk_size / sizeof(int32_t), INT24_MIN, INT24_MAX);
+        } else {
+            mix_int32_samples(sac_mixer_module, input, &sac_mixer_module->output_packet_buffer[output_offset],
+                              chunk_size / sizeof(int32_t), INT32_MIN, INT32_MAX);
+        }
+
+        for (uint8_t i = 0; i < nb_of_inputs; i++) {
+            read_index[i] = (read_index[i] + chunk_size) % MAX_NB_OF_BYTES_PER_BUFFER;
+        }
+        output_offset += chunk_size;
+        remaining_size -= chunk_size;
     }
 
     sac_mixer_module_handle_remainder(sac_mixer_module);
@@ -60,13 +142,19 @@ void sac_mixer_module_mix_packets(sac_mixer_module_t *sac_mixer_module)
 
 void sac_mixer_module_append_samples(sac_mixer_queue_t *input_samples_queue, uint8_t *samples, uint8_t size)
 {
-    uint8_t mem_offset = 0;
+    uint8_t write_index = 0;
+    uint8_t first_size = 0;
 
-    /* Use the current size for the memory offset */
-    mem_offset = input_samples_queue->current_size;
+    /* The samples are written after the current ones, wrapping around the ring buffer */
+    write_index = (input_samples_queue->read_index + input_samples_queue->current_size) % MAX_NB_OF_BYTES_PER_BUFFER;
+    first_size = MAX_NB_OF_BYTES_PER_BUFFER - write_index;
+    if (first_size > size) {
+        first_size = size;
+    }
 
     /* Add the payload to the Input Samples Queue */
-    memcpy(input_samples_queue->samples + mem_offset, samples, size);
+    memcpy(&input_samples_queue->samples[write_index], samples, first_size);
+    memcpy(input_samples_queue->samples, samples + first_size, size - first_size);
 
     /* Update Input Samples Queue size */
     input_samples_queue->current_size += size;
@@ -74,13 +162,19 @@ void sac_mixer_module_append_samples(sac_mixer_queue_t *input_samples_queue, uin
 
 void sac_mixer_module_append_silence(sac_mixer_queue_t *input_samples_queue, uint8_t size)
 {
-    uint8_t mem_offset = 0;
+    uint8_t write_index = 0;
+    uint8_t first_size = 0;
 
-    /* Use the current size for the memory offset */
-    mem_offset = input_samples_queue->current_size;
+    /* The samples are written after the current ones, wrapping around the ring buffer */
+    write_index = (input_samples_queue->read_index + input_samples_queue->current_size) % MAX_NB_OF_BYTES_PER_BUFFER;
+    first_size = MAX_NB_OF_BYTES_PER_BUFFER - write_index;
+    if (first_size > size) {
+        first_size = size;
+    }
 
-    /* Add the payload to the Input Samples Queue */
-    memset(input_samples_queue->samples + mem_offset, 0, size);
+    /* Add the silence to the Input Samples Queue */
+    memset(&input_samples_queue->samples[write_index], 0, first_size);
+    memset(input_samples_queue->samples, 0, size - first_size);
 
     /* Update Input Samples Queue size */
     input_samples_queue->current_size += size;
@@ -88,60 +182,147 @@ void sac_mixer_module_append_silence(sac_mixer_queue_t *input_samples_queue, uin
 
 void sac_mixer_module_handle_remainder(sac_mixer_module_t *sac_mixer_module)
 {
-    uint8_t sample_remainder = 0;
-    uint8_t current_size = 0;
-    uint8_t sample_size = 0;
+    uint8_t payload_size = sac_mixer_module->cfg.payload_size;
+    sac_mixer_queue_t *queue = NULL;
 
-    sample_size = sac_mixer_module->cfg.payload_size;
-
-    /* Move the remaining input samples to the front of the queue */
+    /* The remaining input samples become the front of the queue */
     for (uint8_t input = 0; input < sac_mixer_module->cfg.nb_of_inputs; input++) {
-        current_size = sac_mixer_module->input_samples_queue[input].current_size;
-        sample_remainder = current_size - sample_size;
-
-        if (sample_remainder > 0) {
-            memcpy(sac_mixer_module->input_samples_queue[input].samples,
-                   sac_mixer_module->input_samples_queue[input].samples + sample_size, sample_remainder);
-        }
-        sac_mixer_module->input_samples_queue[input].current_size = sample_remainder;
+        queue = &sac_mixer_module->input_samples_queue[input];
+        queue->read_index = (queue->read_index + payload_size) % MAX_NB_OF_BYTES_PER_BUFFER;
+        queue->current_size -= payload_size;
     }
 }
 
 /* PRIVATE FUNCTIONS **********************************************************/
 /** @brief Mixing algorithm using int16 samples.
  *
- *  @param[in] sac_mixer_module  SPARK Audio Core Mixer Module structure.
+ *  @param[in]  sac_mixer_module  SPARK Audio Core Mixer Module structure.
+ *  @param[in]  input             Samples of every input.
+ *  @param[out] output            Mixed samples.
+ *  @param[in]  sample_count      Number of samples to mix.
  */
-static void algo_mix_int16_samples(sac_mixer_module_t *sac_mixer_module)
+static void mix_int16_samples(const sac_mixer_module_t *sac_mixer_module, const uint8_t *const *input,
+                              uint8_t *output, uint16_t sample_count)
 {
-    uint8_t nb_of_inputs = 0;
-    uint8_t packet_size = 0;
-    int32_t sample_summation = 0;
+    uint8_t nb_of_inputs = sac_mixer_module->cfg.nb_of_inputs;
+    uint16_t sample = 0;
+    int32_t acc = 0;
+    int16_t value = 0;
 
-    nb_of_inputs = sac_mixer_module->cfg.nb_of_inputs;
-    packet_size = get_audio_payload_samples_count(sac_mixer_module);
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+    int32_t acc_top = 0;
+    int32_t word = 0;
 
-    for (uint8_t sample = 0; sample < packet_size; sample++) {
-        for (uint8_t input = 0; input < nb_of_inputs; input++) {
-            sample_summation += ((int16_t *)sac_mixer_module->input_samples_queue[input].samples)[sample];
+    /* Two samples per word. The ring buffer is only halfword aligned, memcpy gives an unaligned LDR. */
+    for (; (sample + 2U) <= sample_count; sample += 2) {
+        acc = GAIN_Q14_ROUNDING;
+        acc_top = GAIN_Q14_ROUNDING;
+        for (uint8_t i = 0; i < nb_of_inputs; i++) {
+            memcpy(&word, input[i] + (sample * sizeof(int16_t)), sizeof(word));
+            acc = __qadd(acc, __smulbb(word, sac_mixer_module->gain_q14[i]));
+            acc_top = __qadd(acc_top, __smultb(word, sac_mixer_module->gain_q14[i]));
         }
-        ((int16_t *)sac_mixer_module->output_packet_buffer)[sample] = (sample_summation / nb_of_inputs);
-        sample_summation = 0;
+        word = (int32_t)(((uint32_t)__ssat(acc >> GAIN_Q14_PRECISION, 16) & UINT16_MAX) |
+                         ((uint32_t)__ssat(acc_top >> GAIN_Q14_PRECISION, 16) << 16));
+        memcpy(output + (sample * sizeof(int16_t)), &word, sizeof(word));
+    }
+#endif
+    for (; sample < sample_count; sample++) {
+        acc = GAIN_Q14_ROUNDING;
+        for (uint8_t i = 0; i < nb_of_inputs; i++) {
+            memcpy(&value, input[i] + (sample * sizeof(int16_t)), sizeof(value));
+            acc = saturating_add(acc, (int32_t)value * sac_mixer_module->gain_q14[i]);
+        }
+        value = saturate_int16(acc >> GAIN_Q14_PRECISION);
+        memcpy(output + (sample * sizeof(int16_t)), &value, sizeof(value));
+    }
+}
+
+/** @brief Mixing algorithm using samples in 32-bit words.
+ *
+ *  @param[in]  sac_mixer_module  SPARK Audio Core Mixer Module structure.
+ *  @param[in]  input             Samples of every input.
+ *  @param[out] output            Mixed samples.
+ *  @param[in]  sample_count      Number of samples to mix.
+ *  @param[in]  sample_min        Smallest sample value of the bit depth.
+ *  @param[in]  sample_max        Largest sample value of the bit depth.
+ */
+static void mix_int32_samples(const sac_mixer_module_t *sac_mixer_module, const uint8_t *const *input,
+                              uint8_t *output, uint16_t sample_count, int32_t sample_min, int32_t sample_max)
+{
+    uint8_t nb_of_inputs = sac_mixer_module->cfg.nb_of_inputs;
+    int64_t acc = 0;
+    int32_t value = 0;
+
+    for (uint16_t sample = 0; sample < sample_count; sample++) {
+        acc = 0;
+        for (uint8_t i = 0; i < nb_of_inputs; i++) {
+            memcpy(&value, input[i] + (sample * sizeof(int32_t)), sizeof(value));
+            if (sac_mixer_module->gain_q31[i] != SAC_MIXER_GAIN_UNITY) {
+                value = fixed_point_q31_multiply(value, sac_mixer_module->gain_q31[i]);
+            }
+            acc += value;
+        }
+        if (acc > sample_max) {
+            value = sample_max;
+        } else if (acc < sample_min) {
+            value = sample_min;
+        } else {
+            value = (int32_t)acc;
+        }
+        memcpy(output + (sample * sizeof(int32_t)), &value, sizeof(value));
     }
 }
 
-/** @brief Get the number of samples forming an audio payload.
+/** @brief Add two numbers with saturation, as the QADD instruction.
  *
- *  @param[in] sac_mixer_module  SPARK Audio Core Mixer Module structure.
- *  @return Number of samples.
+ *  @param[in] a  First number.
+ *  @param[in] b  Second number.
+ *  @return Sum, saturated to the int32 range.
  */
-static uint8_t get_audio_payload_samples_count(sac_mixer_module_t *sac_mixer_module)
+static inline int32_t saturating_add(int32_t a, int32_t b)
 {
-    uint8_t size_type = 0;
+    int64_t sum = (int64_t)a + b;
+
+    if (sum > INT32_MAX) {
+        return INT32_MAX;
+    } else if (sum < INT32_MIN) {
+        return INT32_MIN;
+    }
+
+    return (int32_t)sum;
+}
 
-    if (sac_mixer_module->cfg.bit_depth == 16) {
-        size_type = sizeof(int16_t);
+/** @brief Saturate a number to the int16 range, as the SSAT instruction.
+ *
+ *  @param[in] value  Number to saturate.
+ *  @return Saturated number.
+ */
+static inline int16_t saturate_int16(int32_t value)
+{
+    if (value > INT16_MAX) {
+        return INT16_MAX;
+    } else if (value < INT16_MIN) {
+        return INT16_MIN;
     }
 
-    return sac_mixer_module->cfg.payload_size / size_type;
+    return (int16_t)value;
+}
+
+/** @brief Get the size of a sample in the payload.
+ *
+ *  @param[in] bit_depth  Bit depth of a sample.
+ *  @return Size of a sample in bytes, 0 if the bit depth is not supported.
+ */
+static uint8_t get_sample_size(uint8_t bit_depth)
+{
+    switch (bit_depth) {
+    case 16:
+        return sizeof(int16_t);
+    case 24:
+    case 32:
+        return sizeof(int32_t);
+    default:
+        return 0;
+    }
 }
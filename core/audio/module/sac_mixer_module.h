@@ -1,6 +1,14 @@
 /** @file  sac_mixer_module.h
  *  @brief SPARK Audio Core Mixer Module is used to mix multiple audio streams into a single one.
  *
+ *  Every input is scaled by its own gain and the inputs are summed with saturation, so a single active input is output
+ *  at its original level. Supported formats are 16-bit samples, 24-bit samples LSB aligned in 32-bit words and 32-bit
+ *  samples. The gains are given in Q1.31 format, SAC_MIXER_GAIN_UNITY being applied exactly. An application mixing
+ *  several loud inputs sets their attenuation, SAC_MIXER_GAIN_AVERAGE(nb_of_inputs) outputs their average, which
+ *  can not saturate.
+ *
+ *  The input samples are kept in ring buffers, the samples left over after a mix are not moved.
+ *
  *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
  *  @license   This source code is proprietary and subject to the SPARK Microsystems
                Software EULA found in this package in file EULA.txt.
@@ -30,6 +38,12 @@ extern "C" {
 #define MAX_NB_OF_BYTES_PER_PAYLOAD 122
 /*! Give a buffer to have at least 2 packets. */
 #define MAX_NB_OF_BYTES_PER_BUFFER (MAX_NB_OF_BYTES_PER_PAYLOAD * 2)
+/*! Unity gain, in Q1.31 format. */
+#define SAC_MIXER_GAIN_UNITY INT32_MAX
+
+/* MACROS *********************************************************************/
+/*! Gain of 1 / nb_of_inputs, in Q1.31 format, averaging the inputs. */
+#define SAC_MIXER_GAIN_AVERAGE(nb_of_inputs) ((int32_t)(((int64_t)1 << 31) / (nb_of_inputs)))
 
 /* TYPES **********************************************************************/
 /** @brief The SPARK Audio Core Mixer Module configurations.
@@ -39,17 +53,19 @@ typedef struct sac_mixer_module_cfg {
     uint8_t nb_of_inputs;
     /*! The audio payload size in bytes which must match the output consuming endpoint. */
     uint8_t payload_size;
-    /*! Bit depth of each sample in the payload. */
+    /*! Bit depth of each sample in the payload: 16, 24 (in 32-bit words) or 32. */
     uint8_t bit_depth;
 } sac_mixer_module_cfg_t;
 
 /** @brief The SPARK Audio Core Mixer queue.
  */
 typedef struct sac_mixer_queue {
-    /*! Can have up to 2x the maximum payload in bytes. */
+    /*! Ring buffer, can have up to 2x the maximum payload in bytes. */
     uint8_t samples[MAX_NB_OF_BYTES_PER_BUFFER];
     /*! The current size of the queue in bytes. */
     uint8_t current_size;
+    /*! Index of the oldest sample in the ring buffer. */
+    uint8_t read_index;
 } sac_mixer_queue_t;
 
 /** @brief The SPARK Audio Core Mixer Module instance.
@@ -61,6 +77,10 @@ typedef struct sac_mixer_module {
     sac_mixer_queue_t input_samples_queue[MAX_NB_OF_INPUTS];
     /*! The mixed output packets array. */
     uint8_t output_packet_buffer[MAX_NB_OF_BYTES_PER_PAYLOAD];
+    /*! Gain of each input, in Q1.31 format. */
+    int32_t gain_q31[MAX_NB_OF_INPUTS];
+    /*! Gain of each input, in Q2.14 format, used for the 16-bit samples. */
+    int32_t gain_q14[MAX_NB_OF_INPUTS];
 } sac_mixer_module_t;
 
 /* PUBLIC FUNCTION PROTOTYPES *************************************************/
@@ -73,7 +93,21 @@ typedef struct sac_mixer_module {
  */
 sac_mixer_module_t *sac_mixer_module_init(sac_mixer_module_cfg_t cfg, mem_pool_t *mem_pool, sac_status_t *sac_status);
 
-/** @brief The SPARK Audio Core Mixer Module uses an algo to mix samples.
+/** @brief Set the gain of an input.
+ *
+ *  The gains are SAC_MIXER_GAIN_UNITY after the initialization.
+ *
+ *  @param[in]  sac_mixer_module  SPARK Audio Core Mixer Module instance.
+ *  @param[in]  input             Input index.
+ *  @param[in]  gain_q31          Gain, in Q1.31 format.
+ *  @param[out] sac_status        Status code.
+ */
+void sac_mixer_module_set_input_gain(sac_mixer_module_t *sac_mixer_module, uint8_t input, int32_t gain_q31,
+                                     sac_status_t *sac_status);
+
+/** @brief Mix a payload of every input into the output packet buffer.
+ *
+ *  Each input must hold at least a payload of samples.
  *
  *  @param[in] sac_mixer_module  SPARK Audio Core Mixer Module instance.
  */
@@ -94,7 +128,7 @@ void sac_mixer_module_append_samples(sac_mixer_queue_t *input_samples_queue, uin
  */
 void sac_mixer_module_append_silence(sac_mixer_queue_t *input_samples_queue, uint8_t size);
 
-/** @brief Put the remainder in front of the queue.
+/** @brief Release the payload of every input that has been mixed.
  *
  *  @param[in] sac_mixer_module  SPARK Audio Core Mixer Module instance.
  */
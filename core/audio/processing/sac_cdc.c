@@ -21,6 +21,8 @@
 #define CDC_DEFAULT_EXTRA_QUEUE_SIZE 3
 /* Seconds to microseconds conversion factor. */
 #define S_TO_US 1000000
+/* Number of fields of the TELEMETRY_RECORD_SAC_CDC_STATS record. */
+#define TELEMETRY_CDC_STATS_FIELD_COUNT 4
 
 /* PRIVATE FUNCTION PROTOTYPES ************************************************/
 static void detect_drift(sac_cdc_instance_t *cdc, sac_pipeline_t *pipeline, sac_header_t *header);
@@ -171,6 +173,23 @@ int sac_cdc_format_stats(sac_cdc_instance_t *cdc, char *buffer, uint16_t size, s
     return string_length;
 }
 
+void sac_cdc_add_stats_telemetry(sac_cdc_instance_t *cdc, telemetry_t *telemetry, uint8_t instance,
+                                 sac_status_t *status)
+{
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(cdc == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS(telemetry == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS(!telemetry_start_record(telemetry, TELEMETRY_RECORD_SAC_CDC_STATS, SAC_TELEMETRY_CDC_STATS_VERSION,
+                                             instance, TELEMETRY_CDC_STATS_FIELD_COUNT),
+                     status, SAC_ERR_NOT_ENOUGH_MEMORY, return);
+
+    telemetry_put_u32(telemetry, cdc->_internal.normal_queue_size / cdc->_internal.sample_amount);
+    telemetry_put_u32(telemetry, cdc->_internal.avg_val / cdc->_internal.sample_amount);
+    telemetry_put_u32(telemetry, cdc->_internal.sac_cdc_resampling_stats.cdc_inflated_packets_count);
+    telemetry_put_u32(telemetry, cdc->_internal.sac_cdc_resampling_stats.cdc_deflated_packets_count);
+}
+
 uint32_t sac_cdc_calculate_queue_average_size(uint8_t max_drift_ppm, uint32_t sample_rate, uint32_t sample_count,
                                               uint32_t resampling_length)
 {
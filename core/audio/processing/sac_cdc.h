@@ -13,12 +13,15 @@
 /* INCLUDES *******************************************************************/
 #include "resampling.h"
 #include "sac_api.h"
+#include "telemetry.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /* CONSTANTS ******************************************************************/
+/*! Version of the TELEMETRY_RECORD_SAC_CDC_STATS record. */
+#define SAC_TELEMETRY_CDC_STATS_VERSION 1
 /*! CDC default resampling length in number of samples. */
 #ifndef CDC_DEFAULT_RESAMPLING_LENGTH
 #define CDC_DEFAULT_RESAMPLING_LENGTH 1440
@@ -27,6 +30,8 @@ extern "C" {
 #ifndef CDC_DEFAULT_QUEUE_AVERAGE
 #define CDC_DEFAULT_QUEUE_AVERAGE 1000
 #endif
+/*! Memory pool footprint of a CDC instance, for its cdc_queue_avg_size. */
+#define SAC_CDC_FOOTPRINT(cdc_queue_avg_size) MEM_POOL_BLOCK_SIZE(sizeof(uint16_t) * (cdc_queue_avg_size))
 
 /* TYPES **********************************************************************/
 /** @brief SPARK Audio Core commands.
@@ -141,6 +146,19 @@ uint16_t sac_cdc_process(void *instance, sac_pipeline_t *pipeline, sac_header_t
  */
 int sac_cdc_format_stats(sac_cdc_instance_t *cdc, char *buffer, uint16_t size, sac_status_t *status);
 
+/** @brief Add the CDC resampling statistics to a telemetry frame.
+ *
+ *  The normal and average queue sizes, in number of samples, and the inflated and deflated packets counts are added
+ *  as a TELEMETRY_RECORD_SAC_CDC_STATS record.
+ *
+ *  @param[in]  cdc        CDC resampling instance.
+ *  @param[in]  telemetry  Telemetry instance, with a frame started.
+ *  @param[in]  instance   Record instance, identifies the CDC in the telemetry stream.
+ *  @param[out] status     Status code.
+ */
+void sac_cdc_add_stats_telemetry(sac_cdc_instance_t *cdc, telemetry_t *telemetry, uint8_t instance,
+                                 sac_status_t *status);
+
 /** @brief Calculate the queue average size to support max_drift_ppm.
  *
  *  @param[in] max_drift_ppm      Maximum amount of drift to be compensated.
@@ -0,0 +1,287 @@
+/** @file  sac_cdc_asrc.c
+ *  @brief Clock drift compensation processing stage using an adaptive sampling rate converter.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "sac_cdc_asrc.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include "sac_utils.h"
+
+/* CONSTANTS ******************************************************************/
+/* Number of fractional bits of the queue levels. */
+#define LEVEL_FRAC_BITS 8
+/* The queue level filter averages about 2^LEVEL_FILTER_SHIFT packets. */
+#define LEVEL_FILTER_SHIFT 8
+/* Number of samples the integral gain is expressed for. */
+#define INTEGRAL_GAIN_SAMPLE_COUNT 1000
+/* Parts per million to parts per billion conversion factor. */
+#define PPM_TO_PPB 1000
+/* Parts per billion conversion factor. */
+#define PPB_FACTOR 1000000000
+/* Number of extra nodes to add to the queue for monitoring its size. */
+#define CDC_DEFAULT_EXTRA_QUEUE_SIZE 3
+/* Number of fields of the TELEMETRY_RECORD_SAC_CDC_ASRC_STATS record. */
+#define TELEMETRY_CDC_ASRC_STATS_FIELD_COUNT 6
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void update_queue_level(sac_cdc_asrc_instance_t *cdc, sac_pipeline_t *pipeline);
+static void update_correction(sac_cdc_asrc_instance_t *cdc);
+static void validate_sac_bit_depth(sac_bit_depth_t bit_depth, sac_status_t *status);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void sac_cdc_asrc_init(void *instance, const char *name, sac_pipeline_t *pipeline, mem_pool_t *mem_pool,
+                       sac_status_t *status)
+{
+    (void)name;
+
+    sac_cdc_asrc_instance_t *cdc = instance;
+    polyphase_resampling_config_t resampling_config = {0};
+    int32_t *resampling_state = NULL;
+
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(cdc == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS((cdc->max_correction_ppm == 0) ||
+                         (cdc->max_correction_ppm > POLYPHASE_RESAMPLING_MAX_RATIO_OFFSET_PPM),
+                     status, SAC_ERR_PROCESSING_STAGE_INIT, return);
+
+    validate_sac_bit_depth(cdc->sample_format.bit_depth, status);
+    if (*status != SAC_OK) {
+        return;
+    }
+
+    /* Initialize configuration. */
+    if (cdc->sample_format.sample_encoding == SAC_SAMPLE_UNPACKED) {
+        cdc->_internal.size_of_buffer_type = SAC_WORD_SIZE_BYTE;
+    } else {
+        /* SAC_SAMPLE_PACKED */
+        SAC_CHECK_STATUS((cdc->sample_format.bit_depth % SAC_BYTE_SIZE_BITS) != 0, status,
+                         SAC_ERR_PROCESSING_STAGE_INIT, return);
+        cdc->_internal.size_of_buffer_type = cdc->sample_format.bit_depth / SAC_BYTE_SIZE_BITS;
+    }
+    cdc->_internal.sample_amount = pipeline->consumer->cfg.audio_payload_size /
+                                   (pipeline->consumer->cfg.channel_count * cdc->_internal.size_of_buffer_type);
+
+    /* Initialize the resampler. */
+    resampling_config.channel_count = pipeline->consumer->cfg.channel_count;
+    resampling_config.max_frame_count = cdc->_internal.sample_amount;
+    resampling_config.sample_size_byte = cdc->_internal.size_of_buffer_type;
+    resampling_config.bit_depth = cdc->sample_format.bit_depth;
+
+    resampling_state = mem_pool_malloc(mem_pool,
+                                       POLYPHASE_RESAMPLING_STATE_SIZE(resampling_config.max_frame_count,
+                                                                       resampling_config.channel_count) *
+                                           sizeof(int32_t));
+    SAC_CHECK_STATUS(resampling_state == NULL, status, SAC_ERR_NOT_ENOUGH_MEMORY, return);
+
+    SAC_CHECK_STATUS(polyphase_resampling_init(&cdc->_internal.resampling_instance, &resampling_config,
+                                               resampling_state) != RESAMPLING_NO_ERROR,
+                     status, SAC_ERR_PROCESSING_STAGE_INIT, return);
+
+    /* Initialize the loop. */
+    cdc->_internal.target_level = (int32_t)(pipeline->consumer->cfg.queue_size * cdc->_internal.sample_amount)
+                                  << LEVEL_FRAC_BITS;
+    cdc->_internal.avg_level = cdc->_internal.target_level;
+    cdc->_internal.avg_level_valid = false;
+    cdc->_internal.integral = 0;
+    cdc->_internal.correction_ppb = 0;
+
+    /* Initialize the statistics. */
+    memset(&cdc->_internal.stats, 0, sizeof(cdc->_internal.stats));
+
+    /* Set consumer endpoint queue extra. */
+    sac_set_extra_queue_size(pipeline->consumer, CDC_DEFAULT_EXTRA_QUEUE_SIZE, status);
+    if (*status != SAC_OK) {
+        return;
+    }
+}
+
+uint32_t sac_cdc_asrc_ctrl(void *instance, sac_pipeline_t *pipeline, uint8_t cmd, uint32_t arg,
+                           sac_status_t *status)
+{
+    sac_cdc_asrc_instance_t *cdc = instance;
+
+    *status = SAC_OK;
+
+    switch ((sac_cdc_asrc_cmd_t)cmd) {
+    case SAC_CDC_ASRC_SET_TARGET_QUEUE_SIZE:
+        if (arg <= pipeline->consumer->cfg.queue_size && arg > 0) {
+            cdc->_internal.target_level = (int32_t)(arg * cdc->_internal.sample_amount) << LEVEL_FRAC_BITS;
+        } else {
+            *status = SAC_ERR_INVALID_ARG;
+        }
+        break;
+    default:
+        *status = SAC_ERR_INVALID_CMD;
+    }
+
+    return 0;
+}
+
+uint16_t sac_cdc_asrc_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                              uint16_t size, uint8_t *data_out, sac_status_t *status)
+{
+    sac_cdc_asrc_instance_t *cdc = instance;
+    uint16_t frame_size = pipeline->consumer->cfg.channel_count * cdc->_internal.size_of_buffer_type;
+    uint16_t input_frame_count = size / frame_size;
+    uint16_t output_frame_count = 0;
+
+    *status = SAC_OK;
+
+    /* Only track the queue level while the audio link is stable, keep the current ratio otherwise. */
+    if (header->tx_queue_level_high == 0) {
+        update_queue_level(cdc, pipeline);
+        update_correction(cdc);
+    }
+
+    output_frame_count = polyphase_resampling_process(&cdc->_internal.resampling_instance, data_in, data_out,
+                                                      input_frame_count);
+    if (output_frame_count > input_frame_count) {
+        cdc->_internal.stats.inflated_packets_count++;
+    } else if (output_frame_count < input_frame_count) {
+        cdc->_internal.stats.deflated_packets_count++;
+    }
+
+    return output_frame_count * frame_size;
+}
+
+sac_cdc_asrc_stats_t sac_cdc_asrc_get_stats(sac_cdc_asrc_instance_t *cdc)
+{
+    sac_cdc_asrc_stats_t cdc_stats = cdc->_internal.stats;
+
+    cdc_stats.target_queue_level = (uint32_t)cdc->_internal.target_level >> LEVEL_FRAC_BITS;
+    cdc_stats.avg_queue_level = (uint32_t)cdc->_internal.avg_level >> LEVEL_FRAC_BITS;
+    cdc_stats.queue_level_error = (cdc->_internal.avg_level - cdc->_internal.target_level) / (1 << LEVEL_FRAC_BITS);
+    cdc_stats.correction_ppb = cdc->_internal.correction_ppb;
+
+    return cdc_stats;
+}
+
+int sac_cdc_asrc_format_stats(sac_cdc_asrc_instance_t *cdc, char *buffer, uint16_t size, sac_status_t *status)
+{
+    int string_length = 0;
+
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(cdc == NULL, status, SAC_ERR_NULL_PTR, return 0);
+    SAC_CHECK_STATUS(buffer == NULL, status, SAC_ERR_NULL_PTR, return 0);
+
+    sac_cdc_asrc_stats_t cdc_stats = sac_cdc_asrc_get_stats(cdc);
+
+    string_length = snprintf(buffer, size,
+                             "<< CDC ASRC Statistics >>\r\n"
+                             "  %s:\t\t%10" PRIu32 "\r\n"
+                             "  %s:\t\t%10" PRIu32 "\r\n"
+                             "  %s:\t\t\t%10" PRIi32 "\r\n"
+                             "  %s:\t\t%10" PRIi32 "\r\n"
+                             "  %s:\t%10" PRIu32 "\r\n"
+                             "  %s:\t%10" PRIu32 "\r\n",
+                             "Target queue level", cdc_stats.target_queue_level, "Avg queue level",
+                             cdc_stats.avg_queue_level, "Error", cdc_stats.queue_level_error, "Correction (ppb)",
+                             cdc_stats.correction_ppb, "Inflated Packets Count", cdc_stats.inflated_packets_count,
+                             "Deflated Packets Count", cdc_stats.deflated_packets_count);
+
+    return string_length;
+}
+
+void sac_cdc_asrc_add_stats_telemetry(sac_cdc_asrc_instance_t *cdc, telemetry_t *telemetry, uint8_t instance,
+                                      sac_status_t *status)
+{
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(cdc == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS(telemetry == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS(!telemetry_start_record(telemetry, TELEMETRY_RECORD_SAC_CDC_ASRC_STATS,
+                                             SAC_TELEMETRY_CDC_ASRC_STATS_VERSION, instance,
+                                             TELEMETRY_CDC_ASRC_STATS_FIELD_COUNT),
+                     status, SAC_ERR_NOT_ENOUGH_MEMORY, return);
+
+    sac_cdc_asrc_stats_t cdc_stats = sac_cdc_asrc_get_stats(cdc);
+
+    telemetry_put_u32(telemetry, cdc_stats.target_queue_level);
+    telemetry_put_u32(telemetry, cdc_stats.avg_queue_level);
+    telemetry_put_i32(telemetry, cdc_stats.queue_level_error);
+    telemetry_put_i32(telemetry, cdc_stats.correction_ppb);
+    telemetry_put_u32(telemetry, cdc_stats.inflated_packets_count);
+    telemetry_put_u32(telemetry, cdc_stats.deflated_packets_count);
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Update the filtered audio queue level.
+ *
+ *  The queue level moves by a whole packet every time one is enqueued or consumed, a first order low-pass filter
+ *  removes this sawtooth so that only the slow drift reaches the loop.
+ *
+ *  @param[in] cdc       CDC ASRC instance.
+ *  @param[in] pipeline  Pipeline instance.
+ */
+static void update_queue_level(sac_cdc_asrc_instance_t *cdc, sac_pipeline_t *pipeline)
+{
+    int32_t current_level = pipeline->_internal.samples_buffered_size /
+                            (pipeline->consumer->cfg.channel_count * cdc->_internal.size_of_buffer_type);
+
+    current_level += pipeline->_internal.pending_packets * cdc->_internal.sample_amount;
+    current_level <<= LEVEL_FRAC_BITS;
+
+    if (cdc->_internal.avg_level_valid) {
+        cdc->_internal.avg_level_acc += current_level - cdc->_internal.avg_level;
+    } else {
+        cdc->_internal.avg_level_acc = current_level << LEVEL_FILTER_SHIFT;
+        cdc->_internal.avg_level_valid = true;
+    }
+    cdc->_internal.avg_level = cdc->_internal.avg_level_acc >> LEVEL_FILTER_SHIFT;
+}
+
+/** @brief Update the ratio correction from the queue level error and apply it to the resampler.
+ *
+ *  A queue level above the target means the consumer is slower than the producer: the ratio correction increases so
+ *  that fewer samples are produced.
+ *
+ *  @param[in] cdc  CDC ASRC instance.
+ */
+static void update_correction(sac_cdc_asrc_instance_t *cdc)
+{
+    const int64_t max_correction = (int64_t)cdc->max_correction_ppm * PPM_TO_PPB;
+    int32_t error = cdc->_internal.avg_level - cdc->_internal.target_level;
+    int64_t correction = 0;
+
+    /* Integral term, clamped to the correction range to avoid windup. */
+    cdc->_internal.integral += ((int64_t)error * cdc->integral_gain * cdc->_internal.sample_amount) /
+                               INTEGRAL_GAIN_SAMPLE_COUNT;
+    if (cdc->_internal.integral > (max_correction << LEVEL_FRAC_BITS)) {
+        cdc->_internal.integral = max_correction << LEVEL_FRAC_BITS;
+    } else if (cdc->_internal.integral < -(max_correction << LEVEL_FRAC_BITS)) {
+        cdc->_internal.integral = -(max_correction << LEVEL_FRAC_BITS);
+    }
+
+    correction = ((int64_t)error * cdc->proportional_gain + cdc->_internal.integral) / (1 << LEVEL_FRAC_BITS);
+    if (correction > max_correction) {
+        correction = max_correction;
+    } else if (correction < -max_correction) {
+        correction = -max_correction;
+    }
+    cdc->_internal.correction_ppb = (int32_t)correction;
+
+    /* Convert the correction to a ratio offset in units of 2^-32 frame. */
+    polyphase_resampling_set_ratio_offset(&cdc->_internal.resampling_instance,
+                                          (int32_t)((correction * ((int64_t)1 << 32)) / PPB_FACTOR));
+}
+
+/** @brief Validate if bit depth value is supported by the SAC.
+ *
+ *  @param[in]  bit_depth  Bit depth to validate.
+ *  @param[out] status     Status code.
+ */
+static void validate_sac_bit_depth(sac_bit_depth_t bit_depth, sac_status_t *status)
+{
+    if ((bit_depth != SAC_16BITS) && (bit_depth != SAC_18BITS) && (bit_depth != SAC_20BITS) &&
+        (bit_depth != SAC_24BITS) && (bit_depth != SAC_32BITS)) {
+        *status = SAC_ERR_BIT_DEPTH;
+    }
+}
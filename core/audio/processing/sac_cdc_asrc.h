@@ -0,0 +1,187 @@
+/** @file  sac_cdc_asrc.h
+ *  @brief Clock drift compensation processing stage using an adaptive sampling rate converter.
+ *
+ *  The consumer queue level is low-pass filtered and a proportional-integral loop derives a continuously variable
+ *  conversion ratio from its error to the target level. Every packet is resampled at that ratio with a polyphase
+ *  fractional delay filter, so the drift is corrected smoothly instead of one sample at a time. It can replace the
+ *  sac_cdc processing stage in pipelines that cannot use the sac_cdc_pll audio clock adjustment.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SAC_CDC_ASRC_H_
+#define SAC_CDC_ASRC_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include "polyphase_resampling.h"
+#include "sac_api.h"
+#include "telemetry.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Version of the TELEMETRY_RECORD_SAC_CDC_ASRC_STATS record. */
+#define SAC_TELEMETRY_CDC_ASRC_STATS_VERSION 1
+/*! CDC ASRC default proportional gain, in ppb of ratio correction per sample of queue level error. With this gain, a
+ *  queue level error is corrected with a time constant of 50000 samples, about a second at 48 kHz.
+ */
+#ifndef CDC_ASRC_DEFAULT_PROPORTIONAL_GAIN
+#define CDC_ASRC_DEFAULT_PROPORTIONAL_GAIN 20000
+#endif
+/*! CDC ASRC default integral gain, in ppb of ratio correction per sample of queue level error and per 1000 processed
+ *  samples. This value gives a critically damped loop with the default proportional gain.
+ */
+#ifndef CDC_ASRC_DEFAULT_INTEGRAL_GAIN
+#define CDC_ASRC_DEFAULT_INTEGRAL_GAIN 100
+#endif
+/*! CDC ASRC default largest ratio correction, in ppm. */
+#ifndef CDC_ASRC_DEFAULT_MAX_CORRECTION_PPM
+#define CDC_ASRC_DEFAULT_MAX_CORRECTION_PPM 500
+#endif
+/*! Memory pool footprint of a CDC ASRC instance, frame_count being the consumer audio payload size in frames. */
+#define SAC_CDC_ASRC_FOOTPRINT(frame_count, channel_count) \
+    MEM_POOL_BLOCK_SIZE(POLYPHASE_RESAMPLING_STATE_SIZE(frame_count, channel_count) * sizeof(int32_t))
+
+/* TYPES **********************************************************************/
+/** @brief CDC ASRC commands.
+ */
+typedef enum sac_cdc_asrc_cmd {
+    /*! Set the Clock Drift Compensation target queue size, in number of packets. */
+    SAC_CDC_ASRC_SET_TARGET_QUEUE_SIZE,
+} sac_cdc_asrc_cmd_t;
+
+/** @brief CDC ASRC statistics.
+ */
+typedef struct sac_cdc_asrc_stats {
+    /*! Target queue level in number of samples. */
+    uint32_t target_queue_level;
+    /*! Filtered queue level in number of samples. */
+    uint32_t avg_queue_level;
+    /*! Filtered queue level minus the target queue level, in number of samples. */
+    int32_t queue_level_error;
+    /*! Current ratio correction in ppb, positive when fewer samples are produced than consumed. */
+    int32_t correction_ppb;
+    /*! Number of packets that got more samples after resampling. */
+    uint32_t inflated_packets_count;
+    /*! Number of packets that got fewer samples after resampling. */
+    uint32_t deflated_packets_count;
+} sac_cdc_asrc_stats_t;
+
+/** @brief CDC ASRC instance.
+ */
+typedef struct sac_cdc_asrc_instance {
+    /*! Format of the audio samples. */
+    sac_sample_format_t sample_format;
+    /*! Proportional gain of the loop, CDC_ASRC_DEFAULT_PROPORTIONAL_GAIN is a good starting point. */
+    uint32_t proportional_gain;
+    /*! Integral gain of the loop, CDC_ASRC_DEFAULT_INTEGRAL_GAIN is a good starting point. */
+    uint32_t integral_gain;
+    /*! Largest ratio correction in ppm, up to POLYPHASE_RESAMPLING_MAX_RATIO_OFFSET_PPM. */
+    uint16_t max_correction_ppm;
+    struct {
+        /*! Internal: Polyphase resampling instance. */
+        polyphase_resampling_instance_t resampling_instance;
+        /*! Internal: Number of bytes per audio sample. */
+        uint8_t size_of_buffer_type;
+        /*! Internal: Number of samples per channel in each audio payload. */
+        uint32_t sample_amount;
+        /*! Internal: Target queue level in number of samples, in 24.8 format. */
+        int32_t target_level;
+        /*! Internal: Filtered queue level in number of samples, in 24.8 format. */
+        int32_t avg_level;
+        /*! Internal: Queue level filter accumulator, avg_level scaled by the filter length. */
+        int32_t avg_level_acc;
+        /*! Internal: Whether avg_level holds at least one measurement. */
+        bool avg_level_valid;
+        /*! Internal: Integral term of the loop in ppb, in 56.8 format. */
+        int64_t integral;
+        /*! Internal: Current ratio correction in ppb. */
+        int32_t correction_ppb;
+        /*! Internal: CDC ASRC statistics structure. */
+        sac_cdc_asrc_stats_t stats;
+    } _internal;
+} sac_cdc_asrc_instance_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the CDC ASRC processing stage.
+ *
+ *  @param[in]  instance  CDC ASRC instance.
+ *  @param[in]  name      Processing stage name.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  mem_pool  Memory pool handle.
+ *  @param[out] status    Status code.
+ */
+void sac_cdc_asrc_init(void *instance, const char *name, sac_pipeline_t *pipeline, mem_pool_t *mem_pool,
+                       sac_status_t *status);
+
+/** @brief Control the CDC ASRC processing stage.
+ *
+ *  @param[in]  instance  CDC ASRC instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  cmd       Command.
+ *  @param[in]  arg       Argument.
+ *  @param[out] status    Status code.
+ *
+ *  @return Command specific value.
+ */
+uint32_t sac_cdc_asrc_ctrl(void *instance, sac_pipeline_t *pipeline, uint8_t cmd, uint32_t arg,
+                           sac_status_t *status);
+
+/** @brief Process the CDC ASRC processing stage.
+ *
+ *  The loop is updated with the current queue level, then the payload is resampled at the new ratio. The output holds
+ *  the same number of samples as the input, or one more or one less per channel.
+ *
+ *  @param[in]  instance  CDC ASRC instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  header    Audio packet's header.
+ *  @param[in]  data_in   Audio payload to process.
+ *  @param[in]  size      Size in bytes of the audio payload.
+ *  @param[out] data_out  Audio payload that has been processed.
+ *  @param[out] status    Status code.
+ *
+ *  @return Size in bytes of the processed samples.
+ */
+uint16_t sac_cdc_asrc_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                              uint16_t size, uint8_t *data_out, sac_status_t *status);
+
+/** @brief Get the CDC ASRC statistics.
+ *
+ *  @param[in] cdc  CDC ASRC instance.
+ *  @return The CDC ASRC statistics.
+ */
+sac_cdc_asrc_stats_t sac_cdc_asrc_get_stats(sac_cdc_asrc_instance_t *cdc);
+
+/** @brief Format the CDC ASRC statistics as a string of characters.
+ *
+ *  @param[in]  cdc     CDC ASRC instance.
+ *  @param[out] buffer  Buffer where to put the formatted string.
+ *  @param[in]  size    Size of the buffer.
+ *  @param[out] status  Status code.
+ *  @return The formatted string length, excluding the NULL terminator.
+ */
+int sac_cdc_asrc_format_stats(sac_cdc_asrc_instance_t *cdc, char *buffer, uint16_t size, sac_status_t *status);
+
+/** @brief Add the CDC ASRC statistics to a telemetry frame.
+ *
+ *  The sac_cdc_asrc_get_stats() fields are added in declaration order as a TELEMETRY_RECORD_SAC_CDC_ASRC_STATS
+ *  record.
+ *
+ *  @param[in]  cdc        CDC ASRC instance.
+ *  @param[in]  telemetry  Telemetry instance, with a frame started.
+ *  @param[in]  instance   Record instance, identifies the CDC in the telemetry stream.
+ *  @param[out] status     Status code.
+ */
+void sac_cdc_asrc_add_stats_telemetry(sac_cdc_asrc_instance_t *cdc, telemetry_t *telemetry, uint8_t instance,
+                                      sac_status_t *status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAC_CDC_ASRC_H_ */
@@ -22,11 +22,12 @@
 #define MAX_PLL_FRACN_OFFSET         (DECIMAL_FACTOR / 2)
 #define ERROR_DIVISOR                (DECIMAL_FACTOR / 3)
 #define QUEUE_AVERAGE_TIME_SEC       1
-#define QUEUE_ARRAY_SIZE             2000
 #define CDC_DEFAULT_EXTRA_QUEUE_SIZE 3
 /* Queue level thresholds. */
 #define CDC_QUEUE_HIGH_LEVEL_THRESHOLD(queue_limit) ((queue_limit) - 2)
 #define CDC_QUEUE_LOW_LEVEL_THRESHOLD               1
+/* Number of fields of the TELEMETRY_RECORD_SAC_CDC_PLL_STATS record. */
+#define TELEMETRY_CDC_PLL_STATS_FIELD_COUNT 6
 
 /* PRIVATE FUNCTION PROTOTYPES ************************************************/
 static void adjust_latency(sac_cdc_pll_instance_t *cdc);
@@ -82,7 +83,7 @@ void sac_cdc_pll_init(void *instance, const char *name, sac_pipeline_t *pipeline
                                        DECIMAL_FACTOR;
 
     /* Allocate rolling average memory. */
-    cdc->_internal.avg_arr = (uint8_t *)mem_pool_malloc(mem_pool, QUEUE_ARRAY_SIZE * sizeof(uint8_t));
+    cdc->_internal.avg_arr = (uint8_t *)mem_pool_malloc(mem_pool, SAC_CDC_PLL_QUEUE_ARRAY_SIZE * sizeof(uint8_t));
     SAC_CHECK_STATUS(cdc->_internal.avg_arr == NULL, status, SAC_ERR_NOT_ENOUGH_MEMORY, return);
     reset_queue_avg(cdc, pipeline);
 
@@ -235,6 +236,28 @@ int sac_cdc_pll_format_stats(sac_cdc_pll_instance_t *cdc, char *buffer, uint16_t
     return string_length;
 }
 
+void sac_cdc_pll_add_stats_telemetry(sac_cdc_pll_instance_t *cdc, telemetry_t *telemetry, uint8_t instance,
+                                     sac_status_t *status)
+{
+    *status = SAC_OK;
+
+    SAC_CHECK_STATUS(cdc == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS(telemetry == NULL, status, SAC_ERR_NULL_PTR, return);
+    SAC_CHECK_STATUS(!telemetry_start_record(telemetry, TELEMETRY_RECORD_SAC_CDC_PLL_STATS,
+                                             SAC_TELEMETRY_CDC_PLL_STATS_VERSION, instance,
+                                             TELEMETRY_CDC_PLL_STATS_FIELD_COUNT),
+                     status, SAC_ERR_NOT_ENOUGH_MEMORY, return);
+
+    sac_cdc_pll_stats_t cdc_stats = sac_cdc_pll_get_stats(cdc);
+
+    telemetry_put_u32(telemetry, cdc_stats.target_queue_size);
+    telemetry_put_u32(telemetry, cdc_stats.avg_queue_size);
+    telemetry_put_i32(telemetry, cdc_stats.queue_size_error);
+    telemetry_put_i32(telemetry, cdc_stats.queue_size_avg_delta);
+    telemetry_put_u32(telemetry, cdc_stats.current_pll_value);
+    telemetry_put_i32(telemetry, cdc_stats.pll_fracn_offset);
+}
+
 /* PRIVATE FUNCTIONS **********************************************************/
 /** @brief Tune queue size to the target level.
  *
@@ -286,10 +309,10 @@ static void update_queue_avg(sac_cdc_pll_instance_t *cdc, sac_pipeline_t *pipeli
     cdc->_internal.avg_arr[avg_idx] = current_queue_length;
     cdc->_internal.avg_sum += cdc->_internal.avg_arr[avg_idx]; /* Add new value. */
     cdc->_internal.avg_val = cdc->_internal.sample_amount *
-                             ((cdc->_internal.avg_sum * DECIMAL_FACTOR) / QUEUE_ARRAY_SIZE);
+                             ((cdc->_internal.avg_sum * DECIMAL_FACTOR) / SAC_CDC_PLL_QUEUE_ARRAY_SIZE);
     cdc->_internal.error = cdc->_internal.avg_val - cdc->_internal.target_queue_size;
 
-    if (++avg_idx >= QUEUE_ARRAY_SIZE) {
+    if (++avg_idx >= SAC_CDC_PLL_QUEUE_ARRAY_SIZE) {
         avg_idx = 0;
         /* Update Delta Avg. */
         cdc->_internal.avg_val_delta = cdc->_internal.avg_val - cdc->_internal.prev_avg_val;
@@ -309,10 +332,10 @@ static void reset_queue_avg(sac_cdc_pll_instance_t *cdc, sac_pipeline_t *pipelin
     cdc->_internal.avg_val = cdc->_internal.target_queue_size;
     cdc->_internal.prev_avg_val = cdc->_internal.target_queue_size;
     cdc->_internal.avg_val_delta = 0;
-    for (uint32_t i = 0; i < QUEUE_ARRAY_SIZE; i++) {
+    for (uint32_t i = 0; i < SAC_CDC_PLL_QUEUE_ARRAY_SIZE; i++) {
         cdc->_internal.avg_arr[i] = pipeline->consumer->cfg.queue_size;
     }
-    cdc->_internal.avg_sum = pipeline->consumer->cfg.queue_size * QUEUE_ARRAY_SIZE;
+    cdc->_internal.avg_sum = pipeline->consumer->cfg.queue_size * SAC_CDC_PLL_QUEUE_ARRAY_SIZE;
 }
 
 /** @brief Validate if bit depth value is supported by the SAC.
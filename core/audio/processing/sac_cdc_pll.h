@@ -12,11 +12,20 @@
 
 /* INCLUDES *******************************************************************/
 #include "sac_api.h"
+#include "telemetry.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* CONSTANTS ******************************************************************/
+/*! Version of the TELEMETRY_RECORD_SAC_CDC_PLL_STATS record. */
+#define SAC_TELEMETRY_CDC_PLL_STATS_VERSION 1
+/*! Number of queue level samples of the rolling average. */
+#define SAC_CDC_PLL_QUEUE_ARRAY_SIZE 2000
+/*! Memory pool footprint of a CDC PLL instance. */
+#define SAC_CDC_PLL_FOOTPRINT MEM_POOL_BLOCK_SIZE(SAC_CDC_PLL_QUEUE_ARRAY_SIZE * sizeof(uint8_t))
+
 /* TYPES **********************************************************************/
 /** @brief CDC Commands.
  */
@@ -148,6 +157,19 @@ sac_cdc_pll_stats_t sac_cdc_pll_get_stats(sac_cdc_pll_instance_t *cdc);
  */
 int sac_cdc_pll_format_stats(sac_cdc_pll_instance_t *cdc, char *buffer, uint16_t size, sac_status_t *status);
 
+/** @brief Add the Clock Drift Compensation statistics to a telemetry frame.
+ *
+ *  The sac_cdc_pll_get_stats() fields are added in declaration order as a TELEMETRY_RECORD_SAC_CDC_PLL_STATS
+ *  record.
+ *
+ *  @param[in]  cdc        CDC instance.
+ *  @param[in]  telemetry  Telemetry instance, with a frame started.
+ *  @param[in]  instance   Record instance, identifies the CDC in the telemetry stream.
+ *  @param[out] status     Status code.
+ */
+void sac_cdc_pll_add_stats_telemetry(sac_cdc_pll_instance_t *cdc, telemetry_t *telemetry, uint8_t instance,
+                                     sac_status_t *status);
+
 #ifdef __cplusplus
 }
 #endif
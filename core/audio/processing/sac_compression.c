@@ -11,16 +11,24 @@
 #include "sac_compression.h"
 #include <string.h>
 
+/* CONSTANTS ******************************************************************/
+/* Number of samples converted to 16-bit at once when the uncompressed samples are not 16-bit packed. Must be a
+ * multiple of twice the maximum channel count so mono blocks always fill whole bytes.
+ */
+#define CONVERSION_BLOCK_SAMPLE_COUNT 32
+
 /* MACROS *********************************************************************/
 #define BYTE_TO_BITS(byte) ((byte) * SAC_BYTE_SIZE_BITS)
 #define BITS_TO_BYTE(bits) ((bits) / SAC_BYTE_SIZE_BITS)
 
 /* PRIVATE FUNCTION PROTOTYPES *************************************************/
-static void extend_msb_to_32bits(void *instance, uint32_t *value);
-static uint16_t pack_stereo(void *instance, uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t unpack_stereo(void *instance, uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t pack_mono(void *instance, uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t unpack_mono(void *instance, uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
+static uint16_t pack(sac_compression_instance_t *compress_inst, uint8_t *buffer_in, uint16_t buffer_in_size,
+                     uint8_t *buffer_out);
+static uint16_t unpack(sac_compression_instance_t *compress_inst, uint8_t *buffer_in, uint16_t buffer_in_size,
+                       uint8_t *buffer_out);
+static bool is_16bits_packed(sac_compression_instance_t *compress_inst);
+static int16_t read_sample(sac_compression_instance_t *compress_inst, const uint8_t *buffer);
+static void write_sample(sac_compression_instance_t *compress_inst, int16_t sample, uint8_t *buffer);
 static void validate_sac_bit_depth(sac_bit_depth_t bit_depth, sac_status_t *status);
 static void instance_status_check(void *instance, sac_status_t *status);
 
@@ -41,8 +49,9 @@ void sac_compression_init(void *instance, const char *name, sac_pipeline_t *pipe
         return;
     }
 
-    adpcm_init_state(&(compress_inst->_internal.adpcm_left_state));
-    adpcm_init_state(&(compress_inst->_internal.adpcm_right_state));
+    for (uint8_t i = 0; i < SAC_MAX_CHANNEL_COUNT; i++) {
+        adpcm_init_state(&(compress_inst->_internal.adpcm_state[i]));
+    }
     compress_inst->_internal.bit_shift_16bits = compress_inst->sample_format.bit_depth - SAC_16BITS;
     if (compress_inst->sample_format.sample_encoding == SAC_SAMPLE_UNPACKED) {
         compress_inst->_internal.sample_size_bit = SAC_WORD_SIZE_BITS;
@@ -53,21 +62,19 @@ void sac_compression_init(void *instance, const char *name, sac_pipeline_t *pipe
 
     switch (compress_inst->compression_mode) {
     case SAC_COMPRESSION_PACK_STEREO:
-        compress_inst->_internal.discard_size = BITS_TO_BYTE(compress_inst->_internal.sample_size_bit * 2);
+    case SAC_COMPRESSION_UNPACK_STEREO:
+        compress_inst->_internal.channel_count = 2;
         break;
     case SAC_COMPRESSION_PACK_MONO:
-        compress_inst->_internal.discard_size = BITS_TO_BYTE(compress_inst->_internal.sample_size_bit);
-        break;
-    case SAC_COMPRESSION_UNPACK_STEREO:
     case SAC_COMPRESSION_UNPACK_MONO:
-        compress_inst->_internal.msb_position = compress_inst->sample_format.bit_depth - 1;
-        compress_inst->_internal.extend_size = compress_inst->_internal.sample_size_bit -
-                                               compress_inst->sample_format.bit_depth;
+        compress_inst->_internal.channel_count = 1;
         break;
     default:
         *status = SAC_ERR_PROCESSING_STAGE_INIT;
         return;
     }
+    compress_inst->_internal.discard_size = BITS_TO_BYTE(compress_inst->_internal.sample_size_bit *
+                                                         compress_inst->_internal.channel_count);
 }
 
 uint32_t sac_compression_ctrl(void *instance, sac_pipeline_t *pipeline, uint8_t cmd, uint32_t arg, sac_status_t *status)
@@ -95,16 +102,12 @@ uint16_t sac_compression_process(void *instance, sac_pipeline_t *pipeline, sac_h
 
     switch (compress_inst->compression_mode) {
     case SAC_COMPRESSION_PACK_STEREO:
-        output_size = pack_stereo(instance, data_in, size, data_out);
-        break;
-    case SAC_COMPRESSION_UNPACK_STEREO:
-        output_size = unpack_stereo(instance, data_in, size, data_out);
-        break;
     case SAC_COMPRESSION_PACK_MONO:
-        output_size = pack_mono(instance, data_in, size, data_out);
+        output_size = pack(compress_inst, data_in, size, data_out);
         break;
+    case SAC_COMPRESSION_UNPACK_STEREO:
     case SAC_COMPRESSION_UNPACK_MONO:
-        output_size = unpack_mono(instance, data_in, size, data_out);
+        output_size = unpack(compress_inst, data_in, size, data_out);
         break;
     }
     return output_size;
@@ -123,10 +126,8 @@ uint16_t sac_compression_process_discard(void *instance, sac_pipeline_t *pipelin
 
     switch (compress_inst->compression_mode) {
     case SAC_COMPRESSION_PACK_STEREO:
-        pack_stereo(instance, data_in, size, data_out);
-        break;
     case SAC_COMPRESSION_PACK_MONO:
-        pack_mono(instance, data_in, size, data_out);
+        pack(compress_inst, data_in, size, data_out);
         break;
     case SAC_COMPRESSION_UNPACK_STEREO:
     case SAC_COMPRESSION_UNPACK_MONO:
@@ -136,199 +137,154 @@ uint16_t sac_compression_process_discard(void *instance, sac_pipeline_t *pipelin
 }
 
 /* PRIVATE FUNCTIONS ***********************************************************/
-/** @brief Pack stereo uncompressed stream to stereo compressed stream.
+/** @brief Pack an uncompressed stream to a compressed stream.
  *
- *  @param[in]  instance        Compression instance.
- *  @param[in]  buffer_in       Array of the uncompressed stereo data.
+ *  The compressed stream starts with the encoder state of each channel, followed by the 4-bit
+ *  ADPCM samples packed by adpcm_encode_block().
+ *
+ *  @param[in]  compress_inst   Compression instance.
+ *  @param[in]  buffer_in       Array of the uncompressed interleaved data.
  *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the compressed stereo stream is written to.
+ *  @param[out] buffer_out      Array where the compressed stream is written to.
  *  @return written size, in byte, to the output buffer.
  */
-static uint16_t pack_stereo(void *instance, uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static uint16_t pack(sac_compression_instance_t *compress_inst, uint8_t *buffer_in, uint16_t buffer_in_size,
+                     uint8_t *buffer_out)
 {
-    uint8_t *input_buffer = (uint8_t *)buffer_in;
-    uint16_t pcm_sample_count = 0;
-    uint8_t left_code = 0;
-    uint8_t right_code = 0;
-    int16_t sample = 0;
-    sac_compression_instance_t *compress_inst = instance;
+    int16_t pcm[CONVERSION_BLOCK_SAMPLE_COUNT];
+    uint8_t channel_count = compress_inst->_internal.channel_count;
+    uint16_t header_size = SAC_COMPRESSION_HEADER_SIZE(channel_count);
+    uint16_t frame_count = 0;
+    uint16_t block_frame_count = 0;
+    uint16_t output_size = 0;
+
+    frame_count = (BYTE_TO_BITS(buffer_in_size) / compress_inst->_internal.sample_size_bit) / channel_count;
+
+    /* Set ADPCM encoder status. */
+    memcpy(buffer_out, compress_inst->_internal.adpcm_state, header_size);
+    buffer_out += header_size;
 
-    pcm_sample_count = (BYTE_TO_BITS(buffer_in_size) / compress_inst->_internal.sample_size_bit) / 2;
-
-    /* Set left ADPCM encoder status. */
-    memcpy(buffer_out, &(compress_inst->_internal.adpcm_left_state), sizeof(adpcm_state_t));
-
-    /* Set right ADPCM encoder status. */
-    memcpy(&buffer_out[sizeof(adpcm_state_t)], &(compress_inst->_internal.adpcm_right_state), sizeof(adpcm_state_t));
-
-    buffer_out += sizeof(sac_compression_adpcm_stereo_header_t);
-
-    /*
-     * Since two samples get compressed into a single byte,
-     * the loop will work with two samples at the same time (left and right samples).
-     */
-    for (uint8_t i = 0; i < pcm_sample_count; i++) {
-        /* Left Channel. */
-        sample = (*((int32_t *)input_buffer) >> compress_inst->_internal.bit_shift_16bits) & 0xFFFF;
-        left_code = adpcm_encode(sample, &(compress_inst->_internal.adpcm_left_state));
-        input_buffer += compress_inst->_internal.sample_size_byte;
-        /* Right Channel. */
-        sample = (*((int32_t *)input_buffer) >> compress_inst->_internal.bit_shift_16bits) & 0xFFFF;
-        right_code = adpcm_encode(sample, &(compress_inst->_internal.adpcm_right_state));
-        input_buffer += compress_inst->_internal.sample_size_byte;
-        /* Concatenate two ADPCM samples code per byte in the output buffer (4-bit MSB, 4-bit LSB). */
-        *buffer_out++ = (left_code & 0x0F) | ((right_code << 4) & 0xF0);
+    if (is_16bits_packed(compress_inst)) {
+        /* The samples are already in the encoder format. */
+        output_size = adpcm_encode_block((int16_t *)buffer_in, frame_count, channel_count,
+                                         compress_inst->_internal.adpcm_state, buffer_out);
+    } else {
+        /* Convert the samples to 16-bit one block at a time. */
+        while (frame_count > 0) {
+            block_frame_count = CONVERSION_BLOCK_SAMPLE_COUNT / channel_count;
+            if (block_frame_count > frame_count) {
+                block_frame_count = frame_count;
+            }
+            for (uint16_t i = 0; i < (block_frame_count * channel_count); i++) {
+                pcm[i] = read_sample(compress_inst, buffer_in);
+                buffer_in += compress_inst->_internal.sample_size_byte;
+            }
+            output_size += adpcm_encode_block(pcm, block_frame_count, channel_count,
+                                              compress_inst->_internal.adpcm_state, &buffer_out[output_size]);
+            frame_count -= block_frame_count;
+        }
     }
 
-    /* Each stereo sample takes 1 byte. */
-    return pcm_sample_count + sizeof(sac_compression_adpcm_stereo_header_t);
+    return output_size + header_size;
 }
 
-/** @brief Unpack stereo compressed stream to stereo uncompressed stream.
+/** @brief Unpack a compressed stream to an uncompressed stream.
  *
- *  @param[in]  instance        Compression instance.
- *  @param[in]  buffer_in       Array of the input stereo compressed data.
+ *  @param[in]  compress_inst   Compression instance.
+ *  @param[in]  buffer_in       Array of the compressed data, starting with the encoder state of each channel.
  *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the uncompressed stereo stream is written to.
+ *  @param[out] buffer_out      Array where the uncompressed interleaved stream is written to.
  *  @return written size, in byte, to the output buffer.
  */
-static uint16_t unpack_stereo(void *instance, uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static uint16_t unpack(sac_compression_instance_t *compress_inst, uint8_t *buffer_in, uint16_t buffer_in_size,
+                       uint8_t *buffer_out)
 {
-    uint8_t *output_buffer = (uint8_t *)buffer_out;
-    uint16_t pcm_sample_count = 0;
-    sac_compression_instance_t *compress_inst = instance;
-
-    /* Get left ADPCM status. */
-    memcpy(&(compress_inst->_internal.adpcm_left_state), buffer_in, sizeof(adpcm_state_t));
-
-    /* Get right ADPCM encoder status. */
-    memcpy(&(compress_inst->_internal.adpcm_right_state), &buffer_in[sizeof(adpcm_state_t)], sizeof(adpcm_state_t));
-
-    buffer_in += sizeof(sac_compression_adpcm_stereo_header_t);
-    pcm_sample_count = (buffer_in_size - sizeof(sac_compression_adpcm_stereo_header_t)) * 2;
-
-    /*
-     * Since two samples are compressed into a single byte, the loop will work with two compressed
-     * samples at the same time (left and right samples).
-     */
-    for (uint8_t i = 0; i < pcm_sample_count / 2; i++) {
-        *(int32_t *)output_buffer = (adpcm_decode(*buffer_in & 0x0F, &(compress_inst->_internal.adpcm_left_state))
-                                     << compress_inst->_internal.bit_shift_16bits);
-        if (compress_inst->_internal.extend_size > 0) {
-            extend_msb_to_32bits(instance, (uint32_t *)output_buffer);
-        }
-        output_buffer += compress_inst->_internal.sample_size_byte;
-        *(int32_t *)output_buffer =
-            (adpcm_decode((*buffer_in++ >> 4) & 0x0F, &(compress_inst->_internal.adpcm_right_state))
-             << compress_inst->_internal.bit_shift_16bits);
-        if (compress_inst->_internal.extend_size > 0) {
-            extend_msb_to_32bits(instance, (uint32_t *)output_buffer);
+    int16_t pcm[CONVERSION_BLOCK_SAMPLE_COUNT];
+    uint8_t channel_count = compress_inst->_internal.channel_count;
+    uint16_t header_size = SAC_COMPRESSION_HEADER_SIZE(channel_count);
+    uint16_t frame_count = 0;
+    uint16_t block_frame_count = 0;
+    uint16_t sample_count = 0;
+
+    /* Get ADPCM decoder status. */
+    memcpy(compress_inst->_internal.adpcm_state, buffer_in, header_size);
+    buffer_in += header_size;
+
+    /* Two compressed samples per byte. */
+    sample_count = (buffer_in_size - header_size) * 2;
+    frame_count = sample_count / channel_count;
+
+    if (is_16bits_packed(compress_inst)) {
+        /* The decoder output is already in the stream format. */
+        adpcm_decode_block(buffer_in, frame_count, channel_count, compress_inst->_internal.adpcm_state,
+                           (int16_t *)buffer_out);
+    } else {
+        /* Convert the samples from 16-bit one block at a time. */
+        while (frame_count > 0) {
+            block_frame_count = CONVERSION_BLOCK_SAMPLE_COUNT / channel_count;
+            if (block_frame_count > frame_count) {
+                block_frame_count = frame_count;
+            }
+            adpcm_decode_block(buffer_in, block_frame_count, channel_count, compress_inst->_internal.adpcm_state,
+                               pcm);
+            buffer_in += (block_frame_count * channel_count) / 2;
+            for (uint16_t i = 0; i < (block_frame_count * channel_count); i++) {
+                write_sample(compress_inst, pcm[i], buffer_out);
+                buffer_out += compress_inst->_internal.sample_size_byte;
+            }
+            frame_count -= block_frame_count;
         }
-        output_buffer += compress_inst->_internal.sample_size_byte;
     }
-    return compress_inst->_internal.sample_size_byte * pcm_sample_count;
+
+    return sample_count * compress_inst->_internal.sample_size_byte;
 }
 
-/** @brief Pack mono uncompressed stream to mono compressed stream.
+/** @brief Check if the uncompressed samples are in the ADPCM encoder format.
  *
- *  @param[in]  instance        Compression instance.
- *  @param[in]  buffer_in       Array of the uncompressed mono data.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the compressed stereo stream is written to.
- *  @return written size, in byte, to the output buffer.
+ *  @param[in] compress_inst  Compression instance.
+ *  @return True if the uncompressed samples are 16-bit packed.
  */
-static uint16_t pack_mono(void *instance, uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static bool is_16bits_packed(sac_compression_instance_t *compress_inst)
 {
-    uint8_t *input_buffer = (uint8_t *)buffer_in;
-    uint16_t pcm_sample_count = 0;
-    uint16_t compressed_byte_count = 0;
-    int16_t sample = 0;
-    sac_compression_instance_t *compress_inst = instance;
-
-    pcm_sample_count = (BYTE_TO_BITS(buffer_in_size) / compress_inst->_internal.sample_size_bit);
-    compressed_byte_count = (pcm_sample_count / 2);
-
-    /* Set left ADPCM encoder status. */
-    memcpy(buffer_out, &(compress_inst->_internal.adpcm_left_state), sizeof(adpcm_state_t));
-    buffer_out += sizeof(adpcm_state_t);
-
-    /* Since two samples get compressed into a single byte, the loop will work with two samples at the same time. */
-    for (uint8_t i = 0; i < compressed_byte_count; i++) {
-        /* Concatenate two ADPCM samples code per byte in the output buffer (4-bit MSB, 4-bit LSB). */
-        sample = (*((int32_t *)input_buffer) >> compress_inst->_internal.bit_shift_16bits) & 0xFFFF;
-        *buffer_out = adpcm_encode(sample, &(compress_inst->_internal.adpcm_left_state)) & 0x0F;
-        input_buffer += compress_inst->_internal.sample_size_byte;
-        sample = (*((int32_t *)input_buffer) >> compress_inst->_internal.bit_shift_16bits) & 0xFFFF;
-        *buffer_out++ |= (adpcm_encode(sample, &(compress_inst->_internal.adpcm_left_state)) << 4) & 0xF0;
-        input_buffer += compress_inst->_internal.sample_size_byte;
-    }
-    /* Manage odd number of samples */
-    if (pcm_sample_count & 0x01) {
-        sample = (*((int32_t *)input_buffer) >> compress_inst->_internal.bit_shift_16bits) & 0xFFFF;
-        *buffer_out = adpcm_encode(sample, &(compress_inst->_internal.adpcm_left_state)) & 0x0F;
-    }
-
-    return (compressed_byte_count + (pcm_sample_count & 0x01)) * sizeof(uint8_t) + sizeof(state_variable_t);
+    return (compress_inst->_internal.sample_size_bit == SAC_16BITS);
 }
 
-/** @brief Unpack mono compressed stream to mono uncompressed stream.
+/** @brief Read an uncompressed sample and reduce it to 16-bit.
  *
- *  @param[in]  instance        Compression instance.
- *  @param[in]  buffer_in       Array of the input mono compressed data.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the uncompressed stereo stream is written to.
- *  @return written size, in byte, to the output buffer.
+ *  @param[in] compress_inst  Compression instance.
+ *  @param[in] buffer         Location of the sample.
+ *  @return 16-bit sample.
  */
-static uint16_t unpack_mono(void *instance, uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static int16_t read_sample(sac_compression_instance_t *compress_inst, const uint8_t *buffer)
 {
-    uint8_t *output_buffer = (uint8_t *)buffer_out;
-    uint16_t pcm_sample_count = 0;
-    sac_compression_instance_t *compress_inst = instance;
+    uint32_t value = 0;
 
-    /* Get left ADPCM status. */
-    memcpy(&(compress_inst->_internal.adpcm_left_state), buffer_in, sizeof(adpcm_state_t));
-    buffer_in += sizeof(adpcm_state_t);
-
-    /* Get number of mono samples. */
-    pcm_sample_count = (buffer_in_size - sizeof(adpcm_state_t)) * 2;
-
-    /*
-     * Since two samples are compressed into a single byte, the loop will work with two compressed
-     * samples at the same time.
-     */
-    for (uint8_t i = 0; i < pcm_sample_count / 2; i++) {
-        *(int32_t *)output_buffer = (adpcm_decode((*buffer_in & 0x0F), &(compress_inst->_internal.adpcm_left_state))
-                                     << compress_inst->_internal.bit_shift_16bits);
-        if (compress_inst->_internal.extend_size > 0) {
-            extend_msb_to_32bits(instance, (uint32_t *)output_buffer);
-        }
-        output_buffer += compress_inst->_internal.sample_size_byte;
-        *(int32_t *)output_buffer =
-            (adpcm_decode((*buffer_in++ >> 4) & 0x0F, &(compress_inst->_internal.adpcm_left_state))
-             << compress_inst->_internal.bit_shift_16bits);
-        if (compress_inst->_internal.extend_size > 0) {
-            extend_msb_to_32bits(instance, (uint32_t *)output_buffer);
+    if (compress_inst->_internal.sample_size_byte == SAC_WORD_SIZE_BYTE) {
+        value = *((const uint32_t *)buffer);
+    } else {
+        for (uint8_t i = 0; i < compress_inst->_internal.sample_size_byte; i++) {
+            value |= (uint32_t)buffer[i] << BYTE_TO_BITS(i);
         }
-        output_buffer += compress_inst->_internal.sample_size_byte;
     }
-    return pcm_sample_count * compress_inst->_internal.sample_size_byte;
+
+    return (int16_t)(uint16_t)(value >> compress_inst->_internal.bit_shift_16bits);
 }
 
-/** @brief Extend value's sign bit into 32-bit word.
+/** @brief Write a 16-bit sample in the uncompressed sample format, sign extended to the sample size.
  *
- *  @param[in] value  The input value to be extended.
+ *  @param[in]  compress_inst  Compression instance.
+ *  @param[in]  sample         16-bit sample.
+ *  @param[out] buffer         Location of the sample.
  */
-static void extend_msb_to_32bits(void *instance, uint32_t *value)
+static void write_sample(sac_compression_instance_t *compress_inst, int16_t sample, uint8_t *buffer)
 {
-    sac_compression_instance_t *compress_inst = instance;
-    uint32_t msb_value = ((*value) & (1 << compress_inst->_internal.msb_position));
-    uint8_t i = 0;
-
-    for (i = 0; i < compress_inst->_internal.extend_size; i++) {
-        if (msb_value) {
-            *value |= (1 << (compress_inst->sample_format.bit_depth + i));
-        } else {
-            *value &= ~(1 << (compress_inst->sample_format.bit_depth + i));
+    uint32_t value = (uint32_t)(int32_t)sample << compress_inst->_internal.bit_shift_16bits;
+
+    if (compress_inst->_internal.sample_size_byte == SAC_WORD_SIZE_BYTE) {
+        *((uint32_t *)buffer) = value;
+    } else {
+        for (uint8_t i = 0; i < compress_inst->_internal.sample_size_byte; i++) {
+            buffer[i] = (uint8_t)(value >> BYTE_TO_BITS(i));
         }
     }
 }
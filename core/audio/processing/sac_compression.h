@@ -52,10 +52,8 @@ typedef struct sac_compression_instance {
     /*! Format of the uncompressed audio samples. */
     sac_sample_format_t sample_format;
     struct {
-        /*! Internal: Left ADPCM encoder state. */
-        adpcm_state_t adpcm_left_state;
-        /*! Internal: Right ADPCM encoder state. */
-        adpcm_state_t adpcm_right_state;
+        /*! Internal: ADPCM encoder or decoder state of each channel, left channel first. */
+        adpcm_state_t adpcm_state[SAC_MAX_CHANNEL_COUNT];
         /*! Internal: Sample size of an uncompressed sample in bits. */
         uint8_t sample_size_bit;
         /*! Internal: Sample size of an uncompressed sample in bytes. */
@@ -64,10 +62,8 @@ typedef struct sac_compression_instance {
         uint8_t discard_size;
         /*! Internal: Bit shift to downsize samples to 16-bits bit depth. */
         uint8_t bit_shift_16bits;
-        /*! Internal: Position of the sample MSB. */
-        uint8_t msb_position;
-        /*! Internal: Number of bits needed to be extended. */
-        uint32_t extend_size;
+        /*! Internal: Number of interleaved channels. */
+        uint8_t channel_count;
     } _internal;
 } sac_compression_instance_t;
 
@@ -0,0 +1,348 @@
+/** @file  sac_decoder.c
+ *  @brief SPARK Audio Core fused decoder processing stage.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "sac_decoder.h"
+#include <string.h>
+#include "fixed_point.h"
+#include "sac_compression.h"
+
+/* CONSTANTS ******************************************************************/
+/*! Largest interpolation ratio. */
+#define MAX_MULTIPLY_RATIO SAC_SRC_SIX
+/*! Number of compressed samples per byte. */
+#define ADPCM_SAMPLES_PER_BYTE 2
+/*! Ratio of the interpolator history a transition packet carries ahead of its samples, as in the SRC CMSIS stage. */
+#define FIR_SAMPLE_COUNT_CORRECTION_FACTOR 2
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void write_samples(const sac_decoder_instance_t *decoder, const int16_t *samples, uint16_t sample_count,
+                          uint8_t *buffer);
+static uint16_t write_transition_tile(sac_decoder_instance_t *decoder, const int16_t *pcm, uint16_t tile_frame_count,
+                                      uint16_t *skip_frame_count, uint16_t *hold_frame_count,
+                                      uint16_t transition_frame_count, uint8_t *buffer);
+static filtering_functions_error_t init_interpolate(sac_decoder_instance_t *decoder, const int32_t *coeffs,
+                                                    mem_pool_t *mem_pool, sac_status_t *status);
+static void instance_status_check(sac_decoder_instance_t *decoder, sac_status_t *status);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void sac_decoder_init(void *instance, const char *name, sac_pipeline_t *pipeline, mem_pool_t *mem_pool,
+                      sac_status_t *status)
+{
+    (void)name;
+    (void)pipeline;
+
+    sac_decoder_instance_t *decoder = instance;
+    const int32_t *coeffs = NULL;
+
+    *status = SAC_OK;
+
+    instance_status_check(decoder, status);
+    if (*status != SAC_OK) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < SAC_MAX_CHANNEL_COUNT; i++) {
+        adpcm_init_state(&decoder->_internal.adpcm_state[i]);
+    }
+
+    decoder->_internal.bit_shift = decoder->sample_format.bit_depth - SAC_16BITS;
+    if (decoder->sample_format.sample_encoding == SAC_SAMPLE_UNPACKED) {
+        decoder->_internal.sample_size_byte = SAC_WORD_SIZE_BYTE;
+    } else {
+        decoder->_internal.sample_size_byte = decoder->sample_format.bit_depth / SAC_BYTE_SIZE_BITS;
+    }
+
+    if (decoder->initial_volume_level == 100) {
+        decoder->_internal.gain_q31 = FIXED_POINT_Q31_MAX;
+    } else {
+        decoder->_internal.gain_q31 = (int32_t)(((int64_t)decoder->initial_volume_level * FIXED_POINT_Q31_MAX) / 100);
+    }
+
+    if (decoder->multiply_ratio > SAC_SRC_ONE) {
+        coeffs = sac_src_cmsis_get_interpolation_coeffs(decoder->multiply_ratio);
+        if (init_interpolate(decoder, coeffs, mem_pool, status) != FILTERING_FUNCTION_ERR_NONE) {
+            if (*status == SAC_OK) {
+                *status = SAC_ERR_PROCESSING_STAGE_INIT;
+            }
+            return;
+        }
+    }
+}
+
+uint32_t sac_decoder_ctrl(void *instance, sac_pipeline_t *pipeline, uint8_t cmd, uint32_t arg, sac_status_t *status)
+{
+    (void)pipeline;
+
+    sac_decoder_instance_t *decoder = instance;
+    uint32_t ret = 0;
+
+    *status = SAC_OK;
+
+    switch ((sac_decoder_cmd_t)cmd) {
+    case SAC_DECODER_SET_GAIN:
+        decoder->_internal.gain_q31 = (int32_t)arg;
+        break;
+    case SAC_DECODER_GET_GAIN:
+        ret = (uint32_t)decoder->_internal.gain_q31;
+        break;
+    default:
+        *status = SAC_ERR_INVALID_CMD;
+        break;
+    }
+
+    return ret;
+}
+
+uint16_t sac_decoder_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                             uint16_t size, uint8_t *data_out, sac_status_t *status)
+{
+    (void)header;
+
+    sac_decoder_instance_t *decoder = instance;
+    /* One extra sample, the interpolator reads its 16-bit input samples as 32-bit words. */
+    int16_t pcm[(SAC_DECODER_TILE_FRAME_COUNT * SAC_MAX_CHANNEL_COUNT) + 1];
+    int16_t interpolated[SAC_DECODER_TILE_FRAME_COUNT * MAX_MULTIPLY_RATIO * SAC_MAX_CHANNEL_COUNT];
+    uint8_t channel_count = decoder->channel_count;
+    uint16_t header_size = SAC_COMPRESSION_HEADER_SIZE(channel_count);
+    uint16_t frame_count = 0;
+    uint32_t expected_frame_count = 0;
+    uint16_t transition_frame_count = 0;
+    uint16_t hold_frame_count = 0;
+    uint16_t tile_frame_count = 0;
+    uint16_t tile_sample_count = 0;
+    uint16_t skip_frame_count = 0;
+    uint16_t output_size = 0;
+
+    *status = SAC_OK;
+
+    if (size <= header_size) {
+        return 0;
+    }
+
+    frame_count = ((size - header_size) * ADPCM_SAMPLES_PER_BYTE) / channel_count;
+
+    /* When using fallback, current_sample_count tracking is enabled, the packet size is validated like in the SRC. */
+    if (decoder->multiply_ratio > SAC_SRC_ONE) {
+        expected_frame_count = (pipeline != NULL) ? pipeline->_internal.current_sample_count : 0;
+        if ((expected_frame_count > 0) && (frame_count != expected_frame_count)) {
+            transition_frame_count = (SAC_SRC_CMSIS_FIR_NUM_TAPS / decoder->multiply_ratio) /
+                                     FIR_SAMPLE_COUNT_CORRECTION_FACTOR;
+            if (frame_count != (expected_frame_count + transition_frame_count)) {
+                /* Invalid packet size. */
+                *status = SAC_ERR_INVALID_PACKET_SIZE;
+                return 0;
+            }
+            /* Transition packet, the frames carried ahead of it only feed the interpolator history. */
+            hold_frame_count = frame_count - transition_frame_count;
+        }
+    }
+
+    /* Get ADPCM decoder status. */
+    memcpy(decoder->_internal.adpcm_state, data_in, header_size);
+    data_in += header_size;
+
+    while (frame_count > 0) {
+        tile_frame_count = (frame_count < SAC_DECODER_TILE_FRAME_COUNT) ? frame_count : SAC_DECODER_TILE_FRAME_COUNT;
+        tile_sample_count = tile_frame_count * channel_count;
+
+        adpcm_decode_block(data_in, tile_frame_count, channel_count, decoder->_internal.adpcm_state, pcm);
+        data_in += tile_sample_count / ADPCM_SAMPLES_PER_BYTE;
+
+        if (transition_frame_count > 0) {
+            output_size += write_transition_tile(decoder, pcm, tile_frame_count, &skip_frame_count, &hold_frame_count,
+                                                 transition_frame_count, &data_out[output_size]);
+        } else if (decoder->multiply_ratio > SAC_SRC_ONE) {
+            fir_interpolate_q15_multi(&decoder->_internal.interpolate_instance, (const uint8_t *)pcm,
+                                      (uint8_t *)interpolated, tile_frame_count);
+            tile_sample_count *= decoder->multiply_ratio;
+            write_samples(decoder, interpolated, tile_sample_count, &data_out[output_size]);
+            output_size += tile_sample_count * decoder->_internal.sample_size_byte;
+        } else {
+            write_samples(decoder, pcm, tile_sample_count, &data_out[output_size]);
+            output_size += tile_sample_count * decoder->_internal.sample_size_byte;
+        }
+        frame_count -= tile_frame_count;
+    }
+
+    return output_size;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Scale 16-bit samples by the gain and write them in the output sample format.
+ *
+ *  @param[in]  decoder       Decoder instance.
+ *  @param[in]  samples       16-bit samples.
+ *  @param[in]  sample_count  Number of samples.
+ *  @param[out] buffer        Location of the first output sample.
+ */
+static void write_samples(const sac_decoder_instance_t *decoder, const int16_t *samples, uint16_t sample_count,
+                          uint8_t *buffer)
+{
+    const int32_t gain = decoder->_internal.gain_q31;
+    const uint8_t bit_shift = decoder->_internal.bit_shift;
+    const uint8_t sample_size_byte = decoder->_internal.sample_size_byte;
+    int32_t value = 0;
+
+    for (uint16_t i = 0; i < sample_count; i++) {
+        /* Sign extended to the output bit depth, the gain is applied at full output precision. */
+        value = (int32_t)((uint32_t)(int32_t)samples[i] << bit_shift);
+        if (gain != FIXED_POINT_Q31_MAX) {
+            value = fixed_point_q31_multiply(value, gain);
+        }
+
+        if (sample_size_byte == sizeof(int16_t)) {
+            int16_t sample = (int16_t)value;
+
+            memcpy(buffer, &sample, sizeof(sample));
+        } else if (sample_size_byte == sizeof(int32_t)) {
+            memcpy(buffer, &value, sizeof(value));
+        } else {
+            for (uint8_t k = 0; k < sample_size_byte; k++) {
+                buffer[k] = (uint8_t)((uint32_t)value >> (k * SAC_BYTE_SIZE_BITS));
+            }
+        }
+        buffer += sample_size_byte;
+    }
+}
+
+/** @brief Write a tile of a transition packet.
+ *
+ *  Like the SRC CMSIS stage, the first frames of a transition packet are output repeated multiply_ratio times instead
+ *  of interpolated, while the interpolator history is fed with the frames following the transition_frame_count first
+ *  ones. The output of the interpolator is dropped.
+ *
+ *  @param[in]     decoder                 Decoder instance.
+ *  @param[in]     pcm                     Decoded frames of the tile.
+ *  @param[in]     tile_frame_count        Number of frames of the tile.
+ *  @param[in,out] skip_frame_count        Number of frames not fed to the interpolator yet, out of the first
+ *                                         transition_frame_count ones.
+ *  @param[in,out] hold_frame_count        Number of frames still to be output repeated.
+ *  @param[in]     transition_frame_count  Number of frames the transition packet carries ahead of the others.
+ *  @param[out]    buffer                  Location of the first output sample.
+ *  @return Number of bytes written.
+ */
+static uint16_t write_transition_tile(sac_decoder_instance_t *decoder, const int16_t *pcm, uint16_t tile_frame_count,
+                                      uint16_t *skip_frame_count, uint16_t *hold_frame_count,
+                                      uint16_t transition_frame_count, uint8_t *buffer)
+{
+    int16_t interpolated[SAC_DECODER_TILE_FRAME_COUNT * MAX_MULTIPLY_RATIO * SAC_MAX_CHANNEL_COUNT];
+    const uint8_t channel_count = decoder->channel_count;
+    const uint16_t frame_size_byte = channel_count * decoder->_internal.sample_size_byte;
+    uint16_t frame_count = 0;
+    uint16_t skip_count = 0;
+    uint16_t output_size = 0;
+
+    /* Manual interpolation of the frames to output. */
+    frame_count = (*hold_frame_count < tile_frame_count) ? *hold_frame_count : tile_frame_count;
+    for (uint16_t frame = 0; frame < frame_count; frame++) {
+        for (uint8_t k = 0; k < decoder->multiply_ratio; k++) {
+            write_samples(decoder, &pcm[frame * channel_count], channel_count, &buffer[output_size]);
+            output_size += frame_size_byte;
+        }
+    }
+    *hold_frame_count -= frame_count;
+
+    /* The interpolator skips the frames carried ahead, as the SRC CMSIS stage does. */
+    if (*skip_frame_count < transition_frame_count) {
+        skip_count = transition_frame_count - *skip_frame_count;
+        if (skip_count > tile_frame_count) {
+            skip_count = tile_frame_count;
+        }
+        *skip_frame_count += skip_count;
+    }
+    if (skip_count < tile_frame_count) {
+        fir_interpolate_q15_multi(&decoder->_internal.interpolate_instance,
+                                  (const uint8_t *)&pcm[skip_count * channel_count], (uint8_t *)interpolated,
+                                  tile_frame_count - skip_count);
+    }
+
+    return output_size;
+}
+
+/** @brief Allocate the state and coefficients of the Q15 interpolator and initialize it.
+ *
+ *  @param[in]  decoder   Decoder instance.
+ *  @param[in]  coeffs    Filter coefficients in 1.31 format.
+ *  @param[in]  mem_pool  Memory pool handle.
+ *  @param[out] status    Status code.
+ *  @return FIR initialization error code.
+ */
+static filtering_functions_error_t init_interpolate(sac_decoder_instance_t *decoder, const int32_t *coeffs,
+                                                    mem_pool_t *mem_pool, sac_status_t *status)
+{
+    int16_t *fir_state = NULL;
+    int16_t *fir_coeffs = NULL;
+    int16_t *fir_phase_coeffs = NULL;
+    fir_sample_format_t format = {
+        .bit_depth = FIR_16BITS,
+        .sample_size_byte = FIR_2_BYTES,
+        .sample_mask = FIR_MASK_16BITS,
+        .sample_bitshift = FIR_BITSHIFT_16BITS,
+    };
+
+    fir_state = mem_pool_malloc(mem_pool, sizeof(int16_t) *
+                                              FIR_MULTI_STATE_SIZE(SAC_SRC_CMSIS_FIR_NUM_TAPS / decoder->multiply_ratio,
+                                                                   SAC_DECODER_TILE_FRAME_COUNT,
+                                                                   decoder->channel_count));
+    fir_coeffs = mem_pool_malloc(mem_pool, sizeof(int16_t) * SAC_SRC_CMSIS_FIR_NUM_TAPS);
+    fir_phase_coeffs = mem_pool_malloc(mem_pool, sizeof(int16_t) * SAC_SRC_CMSIS_FIR_NUM_TAPS);
+    if ((fir_state == NULL) || (fir_coeffs == NULL) || (fir_phase_coeffs == NULL)) {
+        *status = SAC_ERR_NOT_ENOUGH_MEMORY;
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+    fir_coeffs_q31_to_q15(coeffs, fir_coeffs, SAC_SRC_CMSIS_FIR_NUM_TAPS);
+
+    decoder->_internal.interpolate_instance.input_sample_format = format;
+    decoder->_internal.interpolate_instance.output_sample_format = format;
+
+    return fir_interpolate_q15_multi_init(&decoder->_internal.interpolate_instance, decoder->multiply_ratio,
+                                          SAC_SRC_CMSIS_FIR_NUM_TAPS, decoder->channel_count, fir_coeffs,
+                                          fir_phase_coeffs, fir_state, SAC_DECODER_TILE_FRAME_COUNT);
+}
+
+/** @brief Check the decoder configuration.
+ *
+ *  @param[in]  decoder  Decoder instance.
+ *  @param[out] status   Status code.
+ */
+static void instance_status_check(sac_decoder_instance_t *decoder, sac_status_t *status)
+{
+    if (decoder == NULL) {
+        *status = SAC_ERR_NULL_PTR;
+        return;
+    }
+
+    if ((decoder->channel_count == 0) || (decoder->channel_count > SAC_MAX_CHANNEL_COUNT)) {
+        *status = SAC_ERR_CHANNEL_COUNT;
+        return;
+    }
+
+    if ((decoder->sample_format.bit_depth != SAC_16BITS) && (decoder->sample_format.bit_depth != SAC_24BITS)) {
+        *status = SAC_ERR_BIT_DEPTH;
+        return;
+    }
+
+    if ((decoder->sample_format.sample_encoding != SAC_SAMPLE_UNPACKED) &&
+        (decoder->sample_format.sample_encoding != SAC_SAMPLE_PACKED)) {
+        *status = SAC_ERR_PROCESSING_STAGE_INIT;
+        return;
+    }
+
+    if ((decoder->multiply_ratio != SAC_SRC_ONE) &&
+        (sac_src_cmsis_get_interpolation_coeffs(decoder->multiply_ratio) == NULL)) {
+        *status = SAC_ERR_PROCESSING_STAGE_INIT;
+        return;
+    }
+
+    if (decoder->initial_volume_level > 100) {
+        *status = SAC_ERR_PROCESSING_STAGE_INIT;
+        return;
+    }
+}
@@ -0,0 +1,128 @@
+/** @file  sac_decoder.h
+ *  @brief SPARK Audio Core fused decoder processing stage.
+ *
+ *  Replaces the decompression, sampling rate converter, unpacking and volume stages of a receiving pipeline with a
+ *  single pass over the samples: the ADPCM samples are decoded, interpolated, scaled by the gain and written in the
+ *  output sample format a few frames at a time, in stack tiles. No intermediate payload is written to memory.
+ *
+ *  The input is the stream produced by the compression stage in SAC_COMPRESSION_PACK_STEREO or
+ *  SAC_COMPRESSION_PACK_MONO mode. The interpolation uses the filters of the SRC CMSIS stage, in Q15 format. Like
+ *  that stage, the packet size is validated against the sample count of the fallback mode and a transition packet is
+ *  output without interpolation while its first frames only feed the interpolator history.
+ *
+ *  The output is not bit-exact with the decompression and SRC CMSIS stages: the coefficients are rounded to 1.15 and
+ *  the interpolated samples to 16 bits before the gain, so the samples differ by a few 16-bit LSB, up to 4 in the
+ *  sac_decoder_check test. Without interpolation the output is exact.
+ *
+ *  The interpolator history belongs to the stage. When other fallback modes of the pipeline interpolate with an SRC
+ *  CMSIS stage, decode with SAC_SRC_ONE and keep that stage after the decoder, so the history carries over mode
+ *  switches.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SAC_DECODER_H_
+#define SAC_DECODER_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdint.h>
+#include "adpcm.h"
+#include "filtering_functions.h"
+#include "sac_api.h"
+#include "sac_src_cmsis.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Number of frames decoded and interpolated at once. */
+#define SAC_DECODER_TILE_FRAME_COUNT 8
+/*! Memory pool footprint of a decoder instance. */
+#define SAC_DECODER_FOOTPRINT(multiply_ratio, channel_count)                                                        \
+    (((multiply_ratio) > SAC_SRC_ONE) ?                                                                             \
+         (2 * MEM_POOL_BLOCK_SIZE(SAC_SRC_CMSIS_FIR_NUM_TAPS * sizeof(int16_t)) +                                   \
+          MEM_POOL_BLOCK_SIZE(FIR_MULTI_STATE_SIZE(SAC_SRC_CMSIS_FIR_NUM_TAPS / (multiply_ratio),                    \
+                                                   SAC_DECODER_TILE_FRAME_COUNT, channel_count) * sizeof(int16_t))) : \
+         0)
+
+/* TYPES **********************************************************************/
+/** @brief Decoder Commands.
+ */
+typedef enum sac_decoder_cmd {
+    /*! Set the gain, the argument is the gain in Q1.31 format. */
+    SAC_DECODER_SET_GAIN,
+    /*! Get the gain in Q1.31 format. */
+    SAC_DECODER_GET_GAIN,
+} sac_decoder_cmd_t;
+
+/** @brief Decoder Instance.
+ */
+typedef struct sac_decoder_instance {
+    /*! Number of interleaved channels, 1 or 2. */
+    uint8_t channel_count;
+    /*! Interpolation ratio, SAC_SRC_ONE to only decode. */
+    src_cmsis_ratio_t multiply_ratio;
+    /*! Format of the output samples, 16 or 24 bits. */
+    sac_sample_format_t sample_format;
+    /*! Initial volume level from 0 to 100. */
+    uint8_t initial_volume_level;
+    struct {
+        /*! Internal: ADPCM decoder state of each channel. */
+        adpcm_state_t adpcm_state[SAC_MAX_CHANNEL_COUNT];
+        /*! Internal: Channel-fused Q15 FIR interpolator. */
+        fir_interpolate_q15_multi_instance_t interpolate_instance;
+        /*! Internal: Gain in Q1.31 format. */
+        int32_t gain_q31;
+        /*! Internal: Size of an output sample in bytes. */
+        uint8_t sample_size_byte;
+        /*! Internal: Bit shift from the 16-bit decoded samples to the output bit depth. */
+        uint8_t bit_shift;
+    } _internal;
+} sac_decoder_instance_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the decoder processing stage.
+ *
+ *  @param[in]  instance  Decoder instance.
+ *  @param[in]  name      Processing stage name.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  mem_pool  Memory pool for memory allocation.
+ *  @param[out] status    Status code.
+ */
+void sac_decoder_init(void *instance, const char *name, sac_pipeline_t *pipeline, mem_pool_t *mem_pool,
+                      sac_status_t *status);
+
+/** @brief Decoder control function.
+ *
+ *  @param[in]  instance  Decoder instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  cmd       Control command, a sac_decoder_cmd_t.
+ *  @param[in]  arg       Control argument.
+ *  @param[out] status    Status code.
+ *  @return Gain in Q1.31 format for SAC_DECODER_GET_GAIN, 0 otherwise.
+ */
+uint32_t sac_decoder_ctrl(void *instance, sac_pipeline_t *pipeline, uint8_t cmd, uint32_t arg, sac_status_t *status);
+
+/** @brief Decode, interpolate and scale an ADPCM compressed packet.
+ *
+ *  @param[in]  instance  Decoder instance.
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[in]  header    SPARK Audio Core header.
+ *  @param[in]  data_in   Compressed stream, starting with the ADPCM state of each channel.
+ *  @param[in]  size      Size of the compressed stream in bytes.
+ *  @param[out] data_out  Samples in the output sample format.
+ *  @param[out] status    Status code, SAC_ERR_INVALID_PACKET_SIZE if the packet size matches neither the sample
+ *                        count of the fallback mode nor a transition packet.
+ *  @return Number of bytes written.
+ */
+uint16_t sac_decoder_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
+                             uint16_t size, uint8_t *data_out, sac_status_t *status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAC_DECODER_H_ */
@@ -90,3 +90,10 @@ uint16_t sac_mute_on_underflow_process(void *instance, sac_pipeline_t *pipeline,
 
     return return_size;
 }
+
+bool sac_mute_on_underflow_is_in_place(void *instance)
+{
+    (void)instance;
+
+    return true;
+}
@@ -82,6 +82,13 @@ uint32_t sac_mute_on_underflow_ctrl(void *instance, sac_pipeline_t *pipeline, ui
 uint16_t sac_mute_on_underflow_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
                                        uint16_t size, uint8_t *data_out, sac_status_t *status);
 
+/** @brief Check if the mute on underflow processing stage can be executed in place.
+ *
+ *  @param[in] instance  Process instance.
+ *  @return True, the payload is cleared without changing its size.
+ */
+bool sac_mute_on_underflow_is_in_place(void *instance);
+
 #ifdef __cplusplus
 }
 #endif
@@ -57,3 +57,12 @@ uint16_t sac_mute_packet_process(void *instance, sac_pipeline_t *pipeline, sac_h
         }
     }
 }
+
+bool sac_mute_packet_is_in_place(void *instance)
+{
+    if (instance == NULL) {
+        return false;
+    }
+
+    return ((sac_mute_packet_instance_t *)instance)->is_tx;
+}
@@ -44,6 +44,14 @@ typedef struct sac_mute_packet_instance {
 uint16_t sac_mute_packet_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
                                  uint16_t size, uint8_t *data_out, sac_status_t *status);
 
+/** @brief Check if the mute packet processing stage can be executed in place.
+ *
+ *  @param[in] instance  Process instance.
+ *  @return True on an audio transmitting pipeline where a muted packet shrinks to a single byte, false on an audio
+ *          receiving pipeline where a muted packet is expanded.
+ */
+bool sac_mute_packet_is_in_place(void *instance);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,6 +1,12 @@
 /** @file  sac_packing.c
  *  @brief SPARK Audio Core packing/unpacking for 18/20/24 bits audio processing stage.
  *
+ *  Every packing mode is a kernel converting blocks of four samples, the smallest number of samples filling a whole
+ *  number of bytes in every packed format. A block is read and written with 32-bit words: for example four samples
+ *  in 32-bit words are packed into three 32-bit words of 24-bit samples. The kernel of a mode is taken from a table
+ *  when the mode is set. The samples that do not fill a whole block are converted through a zero padded block on
+ *  the stack.
+ *
  *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
  *  @license   This source code is proprietary and subject to the SPARK Microsystems
  *             Software EULA found in this package in file EULA.txt.
@@ -12,39 +18,136 @@
 #include <string.h>
 
 /* CONSTANTS ******************************************************************/
-#define SAMPLE_SIZE_18BITS            (2.25f)
-#define PACKED_SIZE_18BITS            ((uint8_t)(SAMPLE_SIZE_18BITS * 4.0f))
-#define SAMPLE_SIZE_20BITS            (2.5f)
-#define PACKED_SIZE_20BITS            ((uint8_t)(SAMPLE_SIZE_20BITS * 2.0f))
-#define SAMPLE_SIZE_16BITS            2
-#define SAMPLE_SIZE_24BITS            3
-#define SAMPLE_SIZE_32BITS            4
+/*! Number of samples converted by one kernel iteration. */
+#define BLOCK_SAMPLE_COUNT 4
+/*! Sizes of a sample in bits, samples of 32 bits are 32-bit words containing 18, 20 or 24-bit audio. */
+#define SAMPLE_BITS_16 16
+#define SAMPLE_BITS_18 18
+#define SAMPLE_BITS_20 20
+#define SAMPLE_BITS_24 24
+#define SAMPLE_BITS_32 32
+/*! Sizes of a block in bytes. */
+#define BLOCK_SIZE_16BITS BLOCK_SIZE(SAMPLE_BITS_16)
+#define BLOCK_SIZE_18BITS BLOCK_SIZE(SAMPLE_BITS_18)
+#define BLOCK_SIZE_20BITS BLOCK_SIZE(SAMPLE_BITS_20)
+#define BLOCK_SIZE_24BITS BLOCK_SIZE(SAMPLE_BITS_24)
+#define BLOCK_SIZE_32BITS BLOCK_SIZE(SAMPLE_BITS_32)
+/*! Masks of the samples. */
+#define MASK_16BITS 0x0000FFFF
+#define MASK_18BITS 0x0003FFFF
+#define MASK_20BITS 0x000FFFFF
+#define MASK_24BITS 0x00FFFFFF
+
 #define CODEC_WORD_SIZE_OFFSET_18BITS 2
 
+/* MACROS *********************************************************************/
+/*! Size in bytes of a block of samples. */
+#define BLOCK_SIZE(sample_bits) (((sample_bits) * BLOCK_SAMPLE_COUNT) / SAC_BYTE_SIZE_BITS)
+/*! Size in bytes of a number of samples, the last byte is padded with zeros. */
+#define PACKED_SIZE(sample_count, sample_bits) \
+    ((uint16_t)((((uint32_t)(sample_count) * (sample_bits)) + SAC_BYTE_SIZE_BITS - 1) / SAC_BYTE_SIZE_BITS))
+
+#ifdef SINE_DEBUG_CAPTURE
+/*! Write a value in a debug capture buffer, wrapping around at its end. */
+#define DEBUG_CAPTURE(buffer, index, value)                                                \
+    do {                                                                                   \
+        (buffer)[index] = (value);                                                         \
+        (index) = ((index) + 1 >= sizeof(buffer) / sizeof((buffer)[0])) ? 0 : (index) + 1; \
+    } while (0)
+#endif
+
+/* TYPES **********************************************************************/
+/** @brief Packing kernel.
+ */
+typedef struct sac_packing_kernel {
+    /*! Convert a number of blocks of BLOCK_SAMPLE_COUNT samples. */
+    void (*convert)(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+    /*! Size of an input sample in bits. */
+    uint8_t input_sample_bits;
+    /*! Size of an output sample in bits. */
+    uint8_t output_sample_bits;
+} sac_packing_kernel_t;
+
 /* PRIVATE FUNCTION PROTOTYPES *************************************************/
-static void extend_msb_18bits_value(uint32_t *value);
-static void extend_msb_20bits_value(uint32_t *value);
-static void extend_msb_24bits_value(uint32_t *value);
-static uint16_t pack_18bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t pack_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t pack_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t pack_32bits_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t pack_20bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t pack_24bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t pack_24bits_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t scale_24bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t scale_24bits_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t scale_20bits_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t scale_16bits_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t unpack_20bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t unpack_24bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t unpack_24bits_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t unpack_18bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t unpack_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t unpack_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t extend_18bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t extend_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
-static uint16_t extend_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out);
+static void pack_18bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void pack_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void pack_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void pack_32bits_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void pack_20bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void pack_24bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void pack_24bits_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void scale_24bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void scale_24bits_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void scale_20bits_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void scale_16bits_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void unpack_18bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void unpack_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void unpack_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void unpack_20bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void unpack_24bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void unpack_24bits_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void extend_18bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void extend_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static void extend_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count);
+static const sac_packing_kernel_t *get_kernel(sac_packing_mode_t packing_mode);
+static inline uint32_t sign_extend(uint32_t value, uint8_t bit_depth);
+static inline uint32_t read_word(const uint8_t *data);
+static inline void write_word(uint8_t *data, uint32_t word);
+static inline void read_block_16bits(const uint8_t *data, uint32_t *sample);
+static inline void read_block_18bits(const uint8_t *data, uint32_t *sample);
+static inline void read_block_20bits(const uint8_t *data, uint32_t *sample);
+static inline void read_block_24bits(const uint8_t *data, uint32_t *sample);
+static inline void read_block_32bits(const uint8_t *data, uint32_t *sample);
+static inline void write_block_16bits(uint8_t *data, const uint32_t *sample);
+static inline void write_block_18bits(uint8_t *data, const uint32_t *sample);
+static inline void write_block_20bits(uint8_t *data, const uint32_t *sample);
+static inline void write_block_24bits(uint8_t *data, const uint32_t *sample);
+static inline void write_block_32bits(uint8_t *data, const uint32_t *sample);
+
+/* PRIVATE GLOBALS ************************************************************/
+/*! Kernel of each packing mode. */
+static const sac_packing_kernel_t packing_kernels[] = {
+    [SAC_PACK_18BITS] = {pack_18bits, SAMPLE_BITS_32, SAMPLE_BITS_18},
+    [SAC_PACK_20BITS] = {pack_20bits, SAMPLE_BITS_32, SAMPLE_BITS_20},
+    [SAC_PACK_24BITS] = {pack_24bits, SAMPLE_BITS_32, SAMPLE_BITS_24},
+    [SAC_PACK_32BITS_24BITS] = {pack_32bits_24bits, SAMPLE_BITS_32, SAMPLE_BITS_24},
+    [SAC_PACK_20BITS_16BITS] = {pack_20bits_16bits, SAMPLE_BITS_32, SAMPLE_BITS_16},
+    [SAC_PACK_24BITS_16BITS] = {pack_24bits_16bits, SAMPLE_BITS_32, SAMPLE_BITS_16},
+    [SAC_PACK_24BITS_20BITS] = {pack_24bits_20bits, SAMPLE_BITS_32, SAMPLE_BITS_20},
+    [SAC_SCALE_24BITS_16BITS] = {scale_24bits_16bits, SAMPLE_BITS_24, SAMPLE_BITS_16},
+    [SAC_SCALE_24BITS_20BITS] = {scale_24bits_20bits, SAMPLE_BITS_24, SAMPLE_BITS_20},
+    [SAC_SCALE_20BITS_24BITS] = {scale_20bits_24bits, SAMPLE_BITS_20, SAMPLE_BITS_24},
+    [SAC_SCALE_16BITS_24BITS] = {scale_16bits_24bits, SAMPLE_BITS_16, SAMPLE_BITS_24},
+    [SAC_UNPACK_18BITS] = {unpack_18bits, SAMPLE_BITS_18, SAMPLE_BITS_32},
+    [SAC_UNPACK_20BITS] = {unpack_20bits, SAMPLE_BITS_20, SAMPLE_BITS_32},
+    [SAC_UNPACK_24BITS] = {unpack_24bits, SAMPLE_BITS_24, SAMPLE_BITS_32},
+    [SAC_UNPACK_20BITS_16BITS] = {unpack_20bits_16bits, SAMPLE_BITS_16, SAMPLE_BITS_32},
+    [SAC_UNPACK_24BITS_16BITS] = {unpack_24bits_16bits, SAMPLE_BITS_16, SAMPLE_BITS_32},
+    [SAC_UNPACK_24BITS_20BITS] = {unpack_24bits_20bits, SAMPLE_BITS_20, SAMPLE_BITS_32},
+    [SAC_EXTEND_18BITS] = {extend_18bits, SAMPLE_BITS_32, SAMPLE_BITS_32},
+    [SAC_EXTEND_20BITS] = {extend_20bits, SAMPLE_BITS_32, SAMPLE_BITS_32},
+    [SAC_EXTEND_24BITS] = {extend_24bits, SAMPLE_BITS_32, SAMPLE_BITS_32},
+};
+
+/* Debug captures for pack_32bits_24bits (coord send path):
+ * s_pack_in_buf  = input  (left-justified 32-bit, should be sine[n] << 8)
+ * s_pack_out_buf = output (packed 24-bit as uint32, should be sine[n]) */
+#ifdef SINE_DEBUG_CAPTURE
+volatile int32_t  s_pack_in_buf[192];
+static uint32_t   s_pack_in_idx = 0;
+volatile uint32_t s_pack_out_buf[192];
+static uint32_t   s_pack_out_idx = 0;
+#endif
+
+/* Debug captures for unpack_24bits:
+ * s_unpack_in_buf  = raw packed input  (3-byte value read as uint32, before sign-extend)
+ * s_unpack_debug_buf = unpacked output (right-justified 32-bit, after sign-extend) */
+#ifdef SINE_DEBUG_CAPTURE
+volatile uint32_t s_unpack_in_buf[192];
+static uint32_t s_unpack_in_idx = 0;
+volatile int32_t s_unpack_debug_buf[192];
+static uint32_t s_unpack_debug_idx = 0;
+#endif
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 void sac_packing_init(void *instance, const char *name, sac_pipeline_t *pipeline, mem_pool_t *mem_pool,
@@ -63,28 +166,8 @@ void sac_packing_init(void *instance, const char *name, sac_pipeline_t *pipeline
         return;
     }
 
-    switch (packing_inst->packing_mode) {
-    case SAC_PACK_18BITS:
-    case SAC_PACK_20BITS:
-    case SAC_PACK_24BITS:
-    case SAC_PACK_32BITS_24BITS:
-    case SAC_PACK_20BITS_16BITS:
-    case SAC_PACK_24BITS_16BITS:
-    case SAC_PACK_24BITS_20BITS:
-    case SAC_SCALE_24BITS_16BITS:
-    case SAC_SCALE_24BITS_20BITS:
-    case SAC_SCALE_16BITS_24BITS:
-    case SAC_UNPACK_18BITS:
-    case SAC_UNPACK_20BITS:
-    case SAC_UNPACK_24BITS:
-    case SAC_UNPACK_20BITS_16BITS:
-    case SAC_UNPACK_24BITS_16BITS:
-    case SAC_UNPACK_24BITS_20BITS:
-    case SAC_EXTEND_18BITS:
-    case SAC_EXTEND_20BITS:
-    case SAC_EXTEND_24BITS:
-        break;
-    default:
+    packing_inst->_internal.kernel = get_kernel(packing_inst->packing_mode);
+    if (packing_inst->_internal.kernel == NULL) {
         *status = SAC_ERR_PROCESSING_STAGE_INIT;
         return;
     }
@@ -97,12 +180,19 @@ uint32_t sac_packing_ctrl(void *instance, sac_pipeline_t *pipeline, uint8_t cmd,
 
     uint32_t ret = 0;
     sac_packing_instance_t *packing_inst = instance;
+    const sac_packing_kernel_t *kernel = NULL;
 
     *status = SAC_OK;
 
     switch ((sac_packing_cmd_t)cmd) {
     case SAC_PACKING_SET_MODE:
+        kernel = get_kernel((sac_packing_mode_t)arg);
+        if (kernel == NULL) {
+            *status = SAC_ERR_INVALID_ARG;
+            break;
+        }
         packing_inst->packing_mode = arg;
+        packing_inst->_internal.kernel = kernel;
         break;
     case SAC_PACKING_GET_MODE:
         ret = packing_inst->packing_mode;
@@ -121,850 +211,674 @@ uint16_t sac_packing_process(void *instance, sac_pipeline_t *pipeline, sac_heade
     (void)header;
 
     sac_packing_instance_t *packing_inst = instance;
-    uint16_t output_size = 0;
+    const sac_packing_kernel_t *kernel = packing_inst->_internal.kernel;
+    uint8_t block_in[BLOCK_SIZE_32BITS];
+    uint8_t block_out[BLOCK_SIZE_32BITS];
+    uint16_t sample_count = ((uint32_t)size * SAC_BYTE_SIZE_BITS) / kernel->input_sample_bits;
+    uint16_t block_count = sample_count / BLOCK_SAMPLE_COUNT;
+    uint16_t remaining_sample_count = sample_count % BLOCK_SAMPLE_COUNT;
 
     *status = SAC_OK;
 
+    kernel->convert(data_in, data_out, block_count);
+
+    if (remaining_sample_count > 0) {
+        /* Complete the last block with zeros, only the bytes of the remaining samples are written back. */
+        data_in += block_count * BLOCK_SIZE(kernel->input_sample_bits);
+        data_out += block_count * BLOCK_SIZE(kernel->output_sample_bits);
+        memset(block_in, 0, sizeof(block_in));
+        memcpy(block_in, data_in, PACKED_SIZE(remaining_sample_count, kernel->input_sample_bits));
+        kernel->convert(block_in, block_out, 1);
+        memcpy(data_out, block_out, PACKED_SIZE(remaining_sample_count, kernel->output_sample_bits));
+    }
+
+    return PACKED_SIZE(sample_count, kernel->output_sample_bits);
+}
+
+bool sac_packing_is_in_place(void *instance)
+{
+    sac_packing_instance_t *packing_inst = instance;
+
+    if (packing_inst == NULL) {
+        return false;
+    }
+
     switch (packing_inst->packing_mode) {
-    case SAC_PACK_18BITS:
-        output_size = pack_18bits(data_in, size, data_out);
-        break;
-    case SAC_PACK_20BITS:
-        output_size = pack_20bits(data_in, size, data_out);
-        break;
-    case SAC_PACK_24BITS:
-        output_size = pack_24bits(data_in, size, data_out);
-        break;
-    case SAC_UNPACK_18BITS:
-        output_size = unpack_18bits(data_in, size, data_out);
-        break;
-    case SAC_UNPACK_20BITS:
-        output_size = unpack_20bits(data_in, size, data_out);
-        break;
-    case SAC_UNPACK_24BITS:
-        output_size = unpack_24bits(data_in, size, data_out);
-        break;
     case SAC_EXTEND_18BITS:
-        output_size = extend_18bits(data_in, size, data_out);
-        break;
     case SAC_EXTEND_20BITS:
-        output_size = extend_20bits(data_in, size, data_out);
-        break;
     case SAC_EXTEND_24BITS:
-        output_size = extend_24bits(data_in, size, data_out);
-        break;
-    case SAC_PACK_32BITS_24BITS:
-        output_size = pack_32bits_24bits(data_in, size, data_out);
-        break;
-    case SAC_PACK_20BITS_16BITS:
-        output_size = pack_20bits_16bits(data_in, size, data_out);
-        break;
-    case SAC_PACK_24BITS_16BITS:
-        output_size = pack_24bits_16bits(data_in, size, data_out);
-        break;
-    case SAC_PACK_24BITS_20BITS:
-        output_size = pack_24bits_20bits(data_in, size, data_out);
-        break;
-    case SAC_SCALE_24BITS_16BITS:
-        output_size = scale_24bits_16bits(data_in, size, data_out);
-        break;
-    case SAC_SCALE_24BITS_20BITS:
-        output_size = scale_24bits_20bits(data_in, size, data_out);
-        break;
-    case SAC_SCALE_20BITS_24BITS:
-        output_size = scale_20bits_24bits(data_in, size, data_out);
-        break;
-    case SAC_SCALE_16BITS_24BITS:
-        output_size = scale_16bits_24bits(data_in, size, data_out);
-        break;
-    case SAC_UNPACK_20BITS_16BITS:
-        output_size = unpack_20bits_16bits(data_in, size, data_out);
-        break;
-    case SAC_UNPACK_24BITS_16BITS:
-        output_size = unpack_24bits_16bits(data_in, size, data_out);
-        break;
-    case SAC_UNPACK_24BITS_20BITS:
-        output_size = unpack_24bits_20bits(data_in, size, data_out);
-        break;
+        /* Sign extension keeps 32-bit words, each block is read before being written back. */
+        return true;
+    default:
+        return false;
     }
-
-    return output_size;
 }
 
 /* PRIVATE FUNCTIONS ***********************************************************/
-/** @brief Pack 32-bit audio samples into 18-bit audio samples.
- *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 20-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 18-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t pack_18bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint32_t *data32_in = (uint32_t *)buffer_in;
-    uint8_t *data_out = buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i += 4) {
-        *(uint32_t *)(&(data_out[0])) = 0;
-        /* Check if sample #4 exists. */
-        if ((i + 3) < sample_count) {
-            /* Get 18 MSB's from (18 + CODEC_WORD_SIZE_OFFSET_18BITS) bit sample, shift sample by 6 bits and copy sample
-             * #4.
-             */
-            *(uint32_t *)(&(data_out[6])) &= (~0x3FFFFU << 6);
-            *(uint32_t *)(&(data_out[6])) = (((data32_in[3] >> CODEC_WORD_SIZE_OFFSET_18BITS) & 0x3FFFF) << 6);
-            /* Increment return size by (floor(2.25)). */
-            ret += 2;
-        }
-
-        /* Check if sample #3 exists. */
-        if ((i + 2) < sample_count) {
-            /* Get 18 MSB's from (18 + CODEC_WORD_SIZE_OFFSET_18BITS) bit sample, shift sample by 4 bits and copy sample
-             * #3.
-             */
-            *(uint32_t *)(&(data_out[4])) &= (~0x3FFFFU << 4);
-            *(uint32_t *)(&(data_out[4])) |= (((data32_in[2] >> CODEC_WORD_SIZE_OFFSET_18BITS) & 0x3FFFF) << 4);
-            /* Increment return size by (floor(2.25)). */
-            ret += 2;
-        }
+/** @brief Pack 32-bit words containing 20-bit audio samples into 18-bit audio samples.
+ *
+ *  The 18 MSBs of the 20-bit audio samples are kept, the codec word size being 2 bits larger.
+ *
+ *  @param[in]  data_in      Blocks of 32-bit words containing 20-bit audio.
+ *  @param[out] data_out     Blocks of packed 18-bit samples.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void pack_18bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-        /* Check if sample #2 exists. */
-        if ((i + 1) < sample_count) {
-            /* Get 18 MSB's from (18 + CODEC_WORD_SIZE_OFFSET_18BITS) bit sample, shift sample by 2 bits and copy sample
-             * #2.
-             */
-            *(uint32_t *)(&(data_out[2])) &= (~0x3FFFFU << 2);
-            *(uint32_t *)(&(data_out[2])) |= (((data32_in[1] >> CODEC_WORD_SIZE_OFFSET_18BITS) & 0x3FFFF) << 2);
-            /* Increment return size by (floor(2.25)). */
-            ret += 2;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] >>= CODEC_WORD_SIZE_OFFSET_18BITS;
         }
-
-        /* Get 18 MSB's from (18 + CODEC_WORD_SIZE_OFFSET_18BITS) bit sample, copy sample #1 without erasing sample #2.
-         */
-        *(uint32_t *)(&(data_out[0])) &= ~0x3FFFF;
-        *(uint32_t *)(&(data_out[0])) |= ((data32_in[0] >> CODEC_WORD_SIZE_OFFSET_18BITS) & 0x3FFFF);
-        /* Increment return size by (ceil(2.25)). */
-        ret += 3;
-
-        /* Increment pointers. */
-        data_out += PACKED_SIZE_18BITS;
-        data32_in += 4;
+        write_block_18bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_18BITS;
     }
-
-    return ret;
 }
 
-/** @brief Pack 32-bit audio samples into 20-bit audio samples.
+/** @brief Pack 32-bit words containing 20-bit audio samples into 20-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 20-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 20-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[in]  data_in      Blocks of 32-bit words containing 20-bit audio.
+ *  @param[out] data_out     Blocks of packed 20-bit samples.
+ *  @param[in]  block_count  Number of blocks.
  */
-static uint16_t pack_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static void pack_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
 {
-    uint32_t *data32_in = (uint32_t *)buffer_in;
-    uint8_t *data_out = buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    for (i = 0; i < sample_count; i += 2) {
-        *(uint32_t *)(&(data_out[0])) = 0;
-        /* Check if sample #2 exists. */
-        if ((i + 1) < sample_count) {
-            /* Copy Sample #2 */
-            *(uint32_t *)(&(data_out[2])) = ((data32_in[1]) & 0xFFFFF);
-            /* Shift Sample #2 by 4 bits. */
-            *(uint32_t *)(&(data_out[2])) <<= 4;
-            /* Increment return size by (floor(2.5)). */
-            ret += 2;
-        }
-        /* Copy Sample #1 without erasing Sample #2. */
-        *(uint32_t *)(&(data_out[0])) |= ((data32_in[0]) & 0xFFFFF);
-        /* Increment return size by (ceil(2.5)). */
-        ret += 3;
-
-        /* Increment pointers */
-        data_out += PACKED_SIZE_20BITS;
-        data32_in += 2;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        write_block_20bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_20BITS;
     }
-
-    return ret;
 }
 
-/** @brief Pack 32-bit audio samples into 24-bit audio samples.
+/** @brief Pack 32-bit words containing 24-bit audio samples into 24-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 24-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 24-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[in]  data_in      Blocks of 32-bit words containing 24-bit audio.
+ *  @param[out] data_out     Blocks of packed 24-bit samples.
+ *  @param[in]  block_count  Number of blocks.
  */
-static uint16_t pack_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static void pack_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
 {
-    uint32_t *data32_in = (uint32_t *)buffer_in;
-    uint8_t *data_out = buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    for (i = 0; i < sample_count; i++) {
-        /* Copy Sample. */
-        *(uint32_t *)(&(data_out[0])) = ((*data32_in) & 0xFFFFFF);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_24BITS;
-
-        /* Increment pointers. */
-        data_out += SAMPLE_SIZE_24BITS;
-        data32_in++;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        write_block_24bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_24BITS;
     }
-
-    return ret;
 }
 
-/* Debug captures for pack_32bits_24bits (coord send path):
- * s_pack_in_buf  = input  (left-justified 32-bit, should be sine[n] << 8)
- * s_pack_out_buf = output (packed 24-bit as uint32, should be sine[n]) */
-#ifdef SINE_DEBUG_CAPTURE
-volatile int32_t  s_pack_in_buf[192];
-static uint32_t   s_pack_in_idx = 0;
-volatile uint32_t s_pack_out_buf[192];
-static uint32_t   s_pack_out_idx = 0;
-#endif
-
 /** @brief Pack 32-bit words containing 32-bit audio samples into 24-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 32-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 24-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[in]  data_in      Blocks of 32-bit words containing 32-bit audio.
+ *  @param[out] data_out     Blocks of packed 24-bit samples.
+ *  @param[in]  block_count  Number of blocks.
  */
-static uint16_t pack_32bits_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static void pack_32bits_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
 {
-    uint32_t *data32_in = (uint32_t *)buffer_in;
-    uint8_t *data_out = buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    for (i = 0; i < sample_count; i++) {
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
 #ifdef SINE_DEBUG_CAPTURE
-        s_pack_in_buf[s_pack_in_idx] = (int32_t)(*data32_in);
-        s_pack_in_idx = (s_pack_in_idx + 1 >= sizeof(s_pack_in_buf) / sizeof(s_pack_in_buf[0])) ? 0 : s_pack_in_idx + 1;
+            DEBUG_CAPTURE(s_pack_in_buf, s_pack_in_idx, (int32_t)sample[k]);
 #endif
-        /* Copy Sample. */
-        *(uint32_t *)(&(data_out[0])) = (((*data32_in) >> 8) & 0xFFFFFF);
+            sample[k] >>= (SAMPLE_BITS_32 - SAMPLE_BITS_24);
 #ifdef SINE_DEBUG_CAPTURE
-        s_pack_out_buf[s_pack_out_idx] = *(uint32_t *)(&(data_out[0]));
-        s_pack_out_idx = (s_pack_out_idx + 1 >= sizeof(s_pack_out_buf) / sizeof(s_pack_out_buf[0])) ? 0 : s_pack_out_idx + 1;
+            DEBUG_CAPTURE(s_pack_out_buf, s_pack_out_idx, sample[k]);
 #endif
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_24BITS;
-
-        /* Increment pointers. */
-        data_out += SAMPLE_SIZE_24BITS;
-        data32_in++;
+        }
+        write_block_24bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_24BITS;
     }
-
-    return ret;
 }
 
 /** @brief Pack 32-bit words containing 20-bit audio samples into 16-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 20-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 16-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[in]  data_in      Blocks of 32-bit words containing 20-bit audio.
+ *  @param[out] data_out     Blocks of 16-bit samples.
+ *  @param[in]  block_count  Number of blocks.
  */
-static uint16_t pack_20bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static void pack_20bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
 {
-    uint32_t *data32_in = (uint32_t *)buffer_in;
-    uint16_t *data_out = (uint16_t *)buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    for (i = 0; i < sample_count; i++) {
-        /* Copy 16 bits MSB of input sample. */
-        data_out[i] = ((data32_in[i] >> 4) & 0xFFFF);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_16BITS;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] >>= (SAMPLE_BITS_20 - SAMPLE_BITS_16);
+        }
+        write_block_16bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_16BITS;
     }
-
-    return ret;
 }
 
 /** @brief Pack 32-bit words containing 24-bit audio samples into 16-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 24-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 16-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[in]  data_in      Blocks of 32-bit words containing 24-bit audio.
+ *  @param[out] data_out     Blocks of 16-bit samples.
+ *  @param[in]  block_count  Number of blocks.
  */
-static uint16_t pack_24bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static void pack_24bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
 {
-    uint32_t *data32_in = (uint32_t *)buffer_in;
-    uint16_t *data_out = (uint16_t *)buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    for (i = 0; i < sample_count; i++) {
-        /* Copy 16 bits MSB of input sample. */
-        data_out[i] = ((data32_in[i] >> 8) & 0xFFFF);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_16BITS;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] >>= (SAMPLE_BITS_24 - SAMPLE_BITS_16);
+        }
+        write_block_16bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_16BITS;
     }
-
-    return ret;
 }
 
 /** @brief Pack 32-bit words containing 24-bit audio samples into 20-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 24-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 20-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t pack_24bits_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint32_t *data32_in = (uint32_t *)buffer_in;
-    uint8_t *data_out = buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i += 2) {
-        *(uint32_t *)(&(data_out[0])) = 0;
-        /* Check if sample #2 exists. */
-        if ((i + 1) < sample_count) {
-            /* Copy Sample #2 */
-            *(uint32_t *)(&(data_out[2])) = (((data32_in[1]) >> 4) & 0xFFFFF);
-            /* Shift Sample #2 by 4 bits. */
-            *(uint32_t *)(&(data_out[2])) <<= 4;
-            /* Increment return size by (floor(2.5)). */
-            ret += 2;
+ *  @param[in]  data_in      Blocks of 32-bit words containing 24-bit audio.
+ *  @param[out] data_out     Blocks of packed 20-bit samples.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void pack_24bits_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
+
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] >>= (SAMPLE_BITS_24 - SAMPLE_BITS_20);
         }
-        /* Copy Sample #1 without erasing Sample #2. */
-        *(uint32_t *)(&(data_out[0])) |= (((data32_in[0]) >> 4) & 0xFFFFF);
-        /* Increment return size by (ceil(2.5)). */
-        ret += 3;
-
-        /* Increment pointers */
-        data_out += PACKED_SIZE_20BITS;
-        data32_in += 2;
+        write_block_20bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_20BITS;
     }
-
-    return ret;
 }
 
 /** @brief Scale packed 24-bit audio samples into packed 16-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input packed 24-bit samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 16-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t scale_24bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint8_t *data24_in = buffer_in;
-    uint16_t *data_out = (uint16_t *)buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_24BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i++) {
-        /* Copy 16 bits MSB of input sample. */
-        (*data_out) = (*(uint16_t *)(&(data24_in[1])) & 0xFFFF);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_16BITS;
-        /* Increment pointers. */
-        data24_in += SAMPLE_SIZE_24BITS;
-        data_out++;
-    }
+ *  @param[in]  data_in      Blocks of packed 24-bit samples.
+ *  @param[out] data_out     Blocks of 16-bit samples.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void scale_24bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    return ret;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_24bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] >>= (SAMPLE_BITS_24 - SAMPLE_BITS_16);
+        }
+        write_block_16bits(data_out, sample);
+        data_in += BLOCK_SIZE_24BITS;
+        data_out += BLOCK_SIZE_16BITS;
+    }
 }
 
 /** @brief Scale packed 24-bit audio samples into packed 20-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input packed 24-bit samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 20-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t scale_24bits_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint8_t *data24_in = buffer_in;
-    uint8_t *data_out = buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_24BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i += 2) {
-        *(uint32_t *)(&(data_out[0])) = 0;
-        /* Check if sample #2 exists. */
-        if ((i + 1) < sample_count) {
-            /* Copy Sample #2 */
-            *(uint32_t *)(&(data_out[2])) = ((*(uint32_t *)(&(data24_in[3])) >> 4) & 0xFFFFF);
-            /* Shift Sample #2 by 4 bits. */
-            *(uint32_t *)(&(data_out[2])) <<= 4;
-            /* Increment return size by (floor(2.5)). */
-            ret += 2;
+ *  @param[in]  data_in      Blocks of packed 24-bit samples.
+ *  @param[out] data_out     Blocks of packed 20-bit samples.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void scale_24bits_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
+
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_24bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] >>= (SAMPLE_BITS_24 - SAMPLE_BITS_20);
         }
-        /* Copy Sample #1 without erasing Sample #2. */
-        *(uint32_t *)(&(data_out[0])) |= ((*(uint32_t *)(&(data24_in[0])) >> 4) & 0xFFFFF);
-        /* Increment return size by (ceil(2.5)). */
-        ret += 3;
-
-        /* Increment pointers */
-        data_out += PACKED_SIZE_20BITS;
-        data24_in += (SAMPLE_SIZE_24BITS * 2);
+        write_block_20bits(data_out, sample);
+        data_in += BLOCK_SIZE_24BITS;
+        data_out += BLOCK_SIZE_20BITS;
     }
-
-    return ret;
 }
 
 /** @brief Scale packed 20-bit audio samples into packed 24-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input packed 20-bit samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 24-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t scale_20bits_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint8_t *data_in = buffer_in;
-    uint8_t *data_out = buffer_out;
-    uint16_t sample_count = (uint16_t)((float)buffer_in_size / SAMPLE_SIZE_20BITS);
-    uint16_t i;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i += 2) {
-        uint32_t sample32;
-        uint32_t sample24;
-
-        sample32 = ((*(uint32_t *)(&data_in[0]) << 4) & 0x00FFFFF0);
-        extend_msb_24bits_value(&sample32);
-        /* Keep only the 24 useful bits (little-endian packed: LSB first). */
-        sample24 = (sample32 >> 8) & 0x00FFFFFF;
-        /* LSB. */
-        data_out[0] = (uint8_t)(sample24 & 0xFF);
-        data_out[1] = (uint8_t)((sample24 >> 8) & 0xFF);
-        /* MSB. */
-        data_out[2] = (uint8_t)((sample24 >> 16) & 0xFF);
-        data_out += 3;
-        /* 3 bytes per 24-bit sample */
-        ret += 3;
-
-        /* Check if sample #2 exists. */
-        if ((i + 1) < sample_count) {
-            sample32 = (*(uint32_t *)(&data_in[2]) & 0x00FFFFF0);
-            extend_msb_24bits_value(&sample32);
-            sample24 = (sample32 >> 8) & 0x00FFFFFF;
-            data_out[0] = (uint8_t)(sample24 & 0xFF);
-            data_out[1] = (uint8_t)((sample24 >> 8) & 0xFF);
-            data_out[2] = (uint8_t)((sample24 >> 16) & 0xFF);
-            data_out += 3;
-            ret += 3;
-        }
+ *  @param[in]  data_in      Blocks of packed 20-bit samples.
+ *  @param[out] data_out     Blocks of packed 24-bit samples.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void scale_20bits_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-        /* Move to next pair of packed 20-bit samples (5 bytes). */
-        data_in += PACKED_SIZE_20BITS;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_20bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] <<= (SAMPLE_BITS_24 - SAMPLE_BITS_20);
+        }
+        write_block_24bits(data_out, sample);
+        data_in += BLOCK_SIZE_20BITS;
+        data_out += BLOCK_SIZE_24BITS;
     }
-
-    return ret;
 }
 
 /** @brief Scale packed 16-bit audio samples into packed 24-bit audio samples.
  *
- *  @param[in]  buffer_in       Array of the input packed 16-bit samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the packed 24-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t scale_16bits_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint8_t *data24_out = buffer_out;
-    uint16_t *data16_in = (uint16_t *)buffer_in;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_16BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i++) {
-        /* Copy 16 bits MSB of input sample. */
-        data24_out[0] = 0;
-        /* Copy input sample into MSB of 24-bit sample. */
-        *(uint16_t *)&data24_out[1] = data16_in[i];
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_24BITS;
-        /* Increment pointers. */
-        data24_out += SAMPLE_SIZE_24BITS;
-    }
+ *  @param[in]  data_in      Blocks of 16-bit samples.
+ *  @param[out] data_out     Blocks of packed 24-bit samples.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void scale_16bits_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    return ret;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_16bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] <<= (SAMPLE_BITS_24 - SAMPLE_BITS_16);
+        }
+        write_block_24bits(data_out, sample);
+        data_in += BLOCK_SIZE_16BITS;
+        data_out += BLOCK_SIZE_24BITS;
+    }
 }
 
-/** @brief Unpack 18-bit audio samples into 32-bit audio samples.
+/** @brief Unpack 18-bit audio samples into 32-bit words containing 20-bit audio.
  *
- *  @param[in]  buffer_in       Array of the input 18-bit samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the unpacked 32-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
+ *  The samples are shifted left by the codec word size offset and sign extended.
+ *
+ *  @param[in]  data_in      Blocks of packed 18-bit samples.
+ *  @param[out] data_out     Blocks of 32-bit words.
+ *  @param[in]  block_count  Number of blocks.
  */
-static uint16_t unpack_18bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static void unpack_18bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
 {
-    uint32_t *data32_out = (uint32_t *)buffer_out;
-    uint8_t *data_in = buffer_in;
-    uint16_t sample_count = (uint16_t)((buffer_in_size + SAMPLE_SIZE_18BITS - 1) / SAMPLE_SIZE_18BITS);
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i += 4) {
-        /* Copy sample #1, shift left by offset required for codec's data word size. */
-        (data32_out[0]) = ((*(uint32_t *)(&(data_in[0])) & 0x3FFFF) << CODEC_WORD_SIZE_OFFSET_18BITS);
-        extend_msb_18bits_value(&data32_out[0]);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_32BITS;
-
-        /* Check if sample #4 exists. */
-        if ((i + 3) < sample_count) {
-            /* Copy sample #4 and right shift by 6 bits, shift left by offset required for codec's data word size. */
-            (data32_out[3]) = (((*(uint32_t *)(&(data_in[6])) & 0xFFFFC0) >> 6) << CODEC_WORD_SIZE_OFFSET_18BITS);
-            extend_msb_18bits_value(&data32_out[3]);
-            /* Increment return size. */
-            ret += SAMPLE_SIZE_32BITS;
-        }
-
-        /* Check if sample #3 exists. */
-        if ((i + 2) < sample_count) {
-            /* Copy sample #3 and right shift by 4 bits, shift left by offset required for codec's data word size. */
-            (data32_out[2]) = (((*(uint32_t *)(&(data_in[4])) & 0x3FFFF0) >> 4) << CODEC_WORD_SIZE_OFFSET_18BITS);
-            extend_msb_18bits_value(&data32_out[2]);
-            /* Increment return size. */
-            ret += SAMPLE_SIZE_32BITS;
-        }
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-        /* Check if sample #2 exists. */
-        if ((i + 1) < sample_count) {
-            /* Copy sample #2 and right shift by 2 bits, shift left by offset required for codec's data word size. */
-            (data32_out[1]) = (((*(uint32_t *)(&(data_in[2])) & 0xFFFFC) >> 2) << CODEC_WORD_SIZE_OFFSET_18BITS);
-            extend_msb_18bits_value(&data32_out[1]);
-            /* Increment return size. */
-            ret += SAMPLE_SIZE_32BITS;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_18bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] = sign_extend(sample[k], SAMPLE_BITS_18) << CODEC_WORD_SIZE_OFFSET_18BITS;
         }
-
-        /* Increment pointers. */
-        data_in += PACKED_SIZE_18BITS;
-        data32_out += 4;
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_18BITS;
+        data_out += BLOCK_SIZE_32BITS;
     }
-
-    return ret;
 }
 
-/** @brief Unpack 20-bit audio samples into 32-bit audio samples.
- *
- *  @param[in]  buffer_in       Array of the input 20-bit samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the unpacked 32-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t unpack_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint32_t *data32_out = (uint32_t *)buffer_out;
-    uint8_t *data_in = buffer_in;
-    uint16_t sample_count = (uint16_t)((float)buffer_in_size / SAMPLE_SIZE_20BITS);
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i += 2) {
-        /* Copy Sample #1. */
-        (data32_out[0]) = (*(uint32_t *)(&(data_in[0])));
-        extend_msb_20bits_value(&data32_out[0]);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_32BITS;
-
-        /* Check if sample #2 exists. */
-        if ((i + 1) < sample_count) {
-            /* Copy Sample #2. */
-            (data32_out[1]) = (*(uint32_t *)(&(data_in[2])) & 0xFFFFF0);
-            /* Shift Sample #2 by 4 bits. */
-            (data32_out[1]) >>= 4;
-            extend_msb_20bits_value(&data32_out[1]);
-            /* Increment return size. */
-            ret += SAMPLE_SIZE_32BITS;
-        }
+/** @brief Unpack 20-bit audio samples into sign extended 32-bit words.
+ *
+ *  @param[in]  data_in      Blocks of packed 20-bit samples.
+ *  @param[out] data_out     Blocks of 32-bit words.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void unpack_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-        /* Increment pointers. */
-        data_in += PACKED_SIZE_20BITS;
-        data32_out += 2;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_20bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] = sign_extend(sample[k], SAMPLE_BITS_20);
+        }
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_20BITS;
+        data_out += BLOCK_SIZE_32BITS;
     }
-
-    return ret;
 }
 
-/* Debug captures for unpack_24bits:
- * s_unpack_in_buf  = raw packed input  (3-byte value read as uint32, before sign-extend)
- * s_unpack_debug_buf = unpacked output (right-justified 32-bit, after sign-extend) */
-#ifdef SINE_DEBUG_CAPTURE
-volatile uint32_t s_unpack_in_buf[192];
-static uint32_t s_unpack_in_idx = 0;
-volatile int32_t s_unpack_debug_buf[192];
-static uint32_t s_unpack_debug_idx = 0;
-#endif
-
-/** @brief Unpack 24-bit audio samples into 32-bit audio samples.
+/** @brief Unpack 24-bit audio samples into sign extended 32-bit words.
  *
- *  @param[in]  buffer_in       Array of the input 24-bit samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the unpacked 32-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[in]  data_in      Blocks of packed 24-bit samples.
+ *  @param[out] data_out     Blocks of 32-bit words.
+ *  @param[in]  block_count  Number of blocks.
  */
-static uint16_t unpack_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static void unpack_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
 {
-    uint32_t *data32_out = (uint32_t *)buffer_out;
-    uint8_t *data_in = buffer_in;
-    uint16_t sample_count = (uint16_t)((float)buffer_in_size / SAMPLE_SIZE_24BITS);
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i++) {
-        /* Copy Sample. */
-        (*data32_out) = (*(uint32_t *)(&(data_in[0])) & 0xFFFFFF);
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_24bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
 #ifdef SINE_DEBUG_CAPTURE
-        s_unpack_in_buf[s_unpack_in_idx] = (*data32_out);
-        s_unpack_in_idx = (s_unpack_in_idx + 1 >= sizeof(s_unpack_in_buf) / sizeof(s_unpack_in_buf[0])) ? 0 : s_unpack_in_idx + 1;
+            DEBUG_CAPTURE(s_unpack_in_buf, s_unpack_in_idx, sample[k]);
 #endif
-
-        extend_msb_24bits_value(data32_out);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_32BITS;
-
+            sample[k] = sign_extend(sample[k], SAMPLE_BITS_24);
 #ifdef SINE_DEBUG_CAPTURE
-        s_unpack_debug_buf[s_unpack_debug_idx] = (int32_t)(*data32_out);
-        s_unpack_debug_idx = (s_unpack_debug_idx + 1 >= sizeof(s_unpack_debug_buf) / sizeof(s_unpack_debug_buf[0])) ? 0 : s_unpack_debug_idx + 1;
+            DEBUG_CAPTURE(s_unpack_debug_buf, s_unpack_debug_idx, (int32_t)sample[k]);
 #endif
-
-        /* Increment pointers. */
-        data_in += SAMPLE_SIZE_24BITS;
-        data32_out++;
+        }
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_24BITS;
+        data_out += BLOCK_SIZE_32BITS;
     }
-
-    return ret;
 }
 
 /** @brief Unpack 16-bit audio samples into 32-bit words containing 20-bit audio.
  *
- *  @param[in]  buffer_in       Array of the input 16-bit audio samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the unpacked 20-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t unpack_20bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint16_t *data32_in = (uint16_t *)buffer_in;
-    uint32_t *data_out = (uint32_t *)buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_16BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i++) {
-        /* Copy input sample. */
-        data_out[i] = ((data32_in[i] << 4) & 0x000FFFF0);
-        extend_msb_20bits_value(&data_out[i]);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_32BITS;
-    }
+ *  @param[in]  data_in      Blocks of 16-bit samples.
+ *  @param[out] data_out     Blocks of 32-bit words.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void unpack_20bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    return ret;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_16bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] = sign_extend(sample[k], SAMPLE_BITS_16) << (SAMPLE_BITS_20 - SAMPLE_BITS_16);
+        }
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_16BITS;
+        data_out += BLOCK_SIZE_32BITS;
+    }
 }
 
 /** @brief Unpack 16-bit audio samples into 32-bit words containing 24-bit audio.
  *
- *  @param[in]  buffer_in       Array of the input 16-bit audio samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the unpacked 24-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t unpack_24bits_16bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint16_t *data32_in = (uint16_t *)buffer_in;
-    uint32_t *data_out = (uint32_t *)buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_16BITS;
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i++) {
-        /* Copy input sample. */
-        data_out[i] = ((data32_in[i] << 8) & 0x00FFFF00);
-        extend_msb_24bits_value(&data_out[i]);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_32BITS;
-    }
+ *  @param[in]  data_in      Blocks of 16-bit samples.
+ *  @param[out] data_out     Blocks of 32-bit words.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void unpack_24bits_16bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    return ret;
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_16bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] = sign_extend(sample[k], SAMPLE_BITS_16) << (SAMPLE_BITS_24 - SAMPLE_BITS_16);
+        }
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_16BITS;
+        data_out += BLOCK_SIZE_32BITS;
+    }
 }
 
 /** @brief Unpack 20-bit audio samples into 32-bit words containing 24-bit audio.
  *
- *  @param[in]  buffer_in       Array of the input 20-bit samples.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Array where the unpacked 24-bit stream is written to.
- *  @return Written size, in byte, to the output buffer.
- */
-static uint16_t unpack_24bits_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
-{
-    uint32_t *data32_out = (uint32_t *)buffer_out;
-    uint8_t *data_in = buffer_in;
-    uint16_t sample_count = (uint16_t)((float)buffer_in_size / SAMPLE_SIZE_20BITS);
-    uint16_t i = 0;
-    uint16_t ret = 0;
-
-    for (i = 0; i < sample_count; i += 2) {
-        /* Copy Sample #1. */
-        (data32_out[0]) = ((*(uint32_t *)(&(data_in[0])) << 4) & 0x00FFFFF0);
-        extend_msb_24bits_value(&data32_out[0]);
-        /* Increment return size. */
-        ret += SAMPLE_SIZE_32BITS;
-
-        /* Check if sample #2 exists. */
-        if ((i + 1) < sample_count) {
-            /* Copy Sample #2. */
-            (data32_out[1]) = (*(uint32_t *)(&(data_in[2])) & 0x00FFFFF0);
-            extend_msb_24bits_value(&data32_out[1]);
-            /* Increment return size. */
-            ret += SAMPLE_SIZE_32BITS;
+ *  @param[in]  data_in      Blocks of packed 20-bit samples.
+ *  @param[out] data_out     Blocks of 32-bit words.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void unpack_24bits_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
+
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_20bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] = sign_extend(sample[k], SAMPLE_BITS_20) << (SAMPLE_BITS_24 - SAMPLE_BITS_20);
         }
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_20BITS;
+        data_out += BLOCK_SIZE_32BITS;
+    }
+}
 
-        /* Increment pointers. */
-        data_in += PACKED_SIZE_20BITS;
-        data32_out += 2;
+/** @brief Extend the sign bit of 32-bit words containing 18-bit audio, left aligned on 20 bits.
+ *
+ *  @param[in]  data_in      Blocks of 32-bit words.
+ *  @param[out] data_out     Blocks of 32-bit words, can be data_in.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void extend_18bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
+
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] = sign_extend(sample[k] >> CODEC_WORD_SIZE_OFFSET_18BITS, SAMPLE_BITS_18)
+                        << CODEC_WORD_SIZE_OFFSET_18BITS;
+        }
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_32BITS;
     }
+}
 
-    return ret;
+/** @brief Extend the sign bit of 32-bit words containing 20-bit audio.
+ *
+ *  @param[in]  data_in      Blocks of 32-bit words.
+ *  @param[out] data_out     Blocks of 32-bit words, can be data_in.
+ *  @param[in]  block_count  Number of blocks.
+ */
+static void extend_20bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
+{
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
+
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] = sign_extend(sample[k], SAMPLE_BITS_20);
+        }
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_32BITS;
+    }
 }
 
-/** @brief Extend 18-bit audio samples sign bit into 32-bit word.
+/** @brief Extend the sign bit of 32-bit words containing 24-bit audio.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 18-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Output of the input 32-bit samples.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[in]  data_in      Blocks of 32-bit words.
+ *  @param[out] data_out     Blocks of 32-bit words, can be data_in.
+ *  @param[in]  block_count  Number of blocks.
  */
-static uint16_t extend_18bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static void extend_24bits(const uint8_t *data_in, uint8_t *data_out, uint16_t block_count)
 {
-    uint32_t *data32_out = (uint32_t *)buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
+    uint32_t sample[BLOCK_SAMPLE_COUNT];
 
-    /* Copy data into output buffer. */
-    memcpy(buffer_out, buffer_in, buffer_in_size);
+    for (uint16_t i = 0; i < block_count; i++) {
+        read_block_32bits(data_in, sample);
+        for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+            sample[k] = sign_extend(sample[k], SAMPLE_BITS_24);
+        }
+        write_block_32bits(data_out, sample);
+        data_in += BLOCK_SIZE_32BITS;
+        data_out += BLOCK_SIZE_32BITS;
+    }
+}
 
-    /* Extend sign bit of output buffer samples. */
-    for (i = 0; i < sample_count; i++) {
-        extend_msb_18bits_value(&data32_out[i]);
+/** @brief Get the kernel of a packing mode.
+ *
+ *  @param[in] packing_mode  Packing mode.
+ *  @return Kernel of the mode, NULL if the mode is invalid.
+ */
+static const sac_packing_kernel_t *get_kernel(sac_packing_mode_t packing_mode)
+{
+    if ((uint32_t)packing_mode >= (sizeof(packing_kernels) / sizeof(packing_kernels[0]))) {
+        return NULL;
     }
 
-    return buffer_in_size;
+    return &packing_kernels[packing_mode];
 }
 
-/** @brief Extend 20-bit audio samples sign bit into 32-bit word.
+/** @brief Extend the sign bit of a sample into a 32-bit word.
+ *
+ *  The shifts compile to a single signed bit field extraction on Arm Cortex-M cores, without branches.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 20-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Output of the input 32-bit samples.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[in] value      Sample in the LSBs of the word, the other bits are ignored.
+ *  @param[in] bit_depth  Number of bits of the sample.
+ *  @return Sign extended sample.
  */
-static uint16_t extend_20bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static inline uint32_t sign_extend(uint32_t value, uint8_t bit_depth)
 {
-    uint32_t *data32_out = (uint32_t *)buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
+    return (uint32_t)((int32_t)(value << (SAMPLE_BITS_32 - bit_depth)) >> (SAMPLE_BITS_32 - bit_depth));
+}
 
-    /* Copy data into output buffer. */
-    memcpy(buffer_out, buffer_in, buffer_in_size);
+/** @brief Read a little endian 32-bit word at any alignment.
+ *
+ *  @param[in] data  Location of the word.
+ *  @return Word.
+ */
+static inline uint32_t read_word(const uint8_t *data)
+{
+    uint32_t word;
 
-    /* Extend sign bit of output buffer samples. */
-    for (i = 0; i < sample_count; i++) {
-        extend_msb_20bits_value(&data32_out[i]);
-    }
+    memcpy(&word, data, sizeof(word));
 
-    return buffer_in_size;
+    return word;
 }
 
-/** @brief Extend 24-bit audio samples sign bit into 32-bit word.
+/** @brief Write a little endian 32-bit word at any alignment.
  *
- *  @param[in]  buffer_in       Array of the input 32-bit samples containing 24-bit audio.
- *  @param[in]  buffer_in_size  Size in byte of the input array.
- *  @param[out] buffer_out      Output of the input 32-bit samples.
- *  @return Written size, in byte, to the output buffer.
+ *  @param[out] data  Location of the word.
+ *  @param[in]  word  Word.
  */
-static uint16_t extend_24bits(uint8_t *buffer_in, uint16_t buffer_in_size, uint8_t *buffer_out)
+static inline void write_word(uint8_t *data, uint32_t word)
 {
-    uint32_t *data32_out = (uint32_t *)buffer_out;
-    uint16_t sample_count = buffer_in_size / SAMPLE_SIZE_32BITS;
-    uint16_t i = 0;
+    memcpy(data, &word, sizeof(word));
+}
 
-    /* Copy data into output buffer. */
-    memcpy(buffer_out, buffer_in, buffer_in_size);
+/** @brief Read a block of 16-bit samples from two words.
+ *
+ *  @param[in]  data    Block of 16-bit samples.
+ *  @param[out] sample  Samples in the LSBs of the words.
+ */
+static inline void read_block_16bits(const uint8_t *data, uint32_t *sample)
+{
+    uint32_t word0 = read_word(&data[0]);
+    uint32_t word1 = read_word(&data[4]);
 
-    /* Extend sign bit of output buffer samples. */
-    for (i = 0; i < sample_count; i++) {
-        extend_msb_24bits_value(&data32_out[i]);
-    }
+    sample[0] = word0 & MASK_16BITS;
+    sample[1] = word0 >> 16;
+    sample[2] = word1 & MASK_16BITS;
+    sample[3] = word1 >> 16;
+}
 
-    return buffer_in_size;
+/** @brief Read a block of packed 18-bit samples from two words and a byte.
+ *
+ *  @param[in]  data    Block of packed 18-bit samples.
+ *  @param[out] sample  Samples in the LSBs of the words.
+ */
+static inline void read_block_18bits(const uint8_t *data, uint32_t *sample)
+{
+    uint32_t word0 = read_word(&data[0]);
+    uint32_t word1 = read_word(&data[4]);
+
+    sample[0] = word0 & MASK_18BITS;
+    sample[1] = ((word0 >> 18) | (word1 << 14)) & MASK_18BITS;
+    sample[2] = (word1 >> 4) & MASK_18BITS;
+    sample[3] = (word1 >> 22) | ((uint32_t)data[8] << 10);
 }
 
-/** @brief Extend 18-bit value's sign bit into 32-bit word.
+/** @brief Read a block of packed 20-bit samples from two words and a half word.
  *
- *  @param[in] value  The 18-bit input value to be extended.
+ *  @param[in]  data    Block of packed 20-bit samples.
+ *  @param[out] sample  Samples in the LSBs of the words.
  */
-static void extend_msb_18bits_value(uint32_t *value)
+static inline void read_block_20bits(const uint8_t *data, uint32_t *sample)
 {
-    *value >>= CODEC_WORD_SIZE_OFFSET_18BITS;
+    uint32_t word0 = read_word(&data[0]);
+    uint32_t word1 = read_word(&data[4]);
 
-    if ((*value) & (1 << 17)) {
-        /* Negative value. */
-        *value |= 0xFFFC0000;
-    } else {
-        /* Positive value. */
-        *value &= 0x0003FFFF;
-    }
+    sample[0] = word0 & MASK_20BITS;
+    sample[1] = ((word0 >> 20) | (word1 << 12)) & MASK_20BITS;
+    sample[2] = (word1 >> 8) & MASK_20BITS;
+    sample[3] = (word1 >> 28) | ((uint32_t)data[8] << 4) | ((uint32_t)data[9] << 12);
+}
 
-    *value <<= CODEC_WORD_SIZE_OFFSET_18BITS;
+/** @brief Read a block of packed 24-bit samples from three words.
+ *
+ *  @param[in]  data    Block of packed 24-bit samples.
+ *  @param[out] sample  Samples in the LSBs of the words.
+ */
+static inline void read_block_24bits(const uint8_t *data, uint32_t *sample)
+{
+    uint32_t word0 = read_word(&data[0]);
+    uint32_t word1 = read_word(&data[4]);
+    uint32_t word2 = read_word(&data[8]);
+
+    sample[0] = word0 & MASK_24BITS;
+    sample[1] = ((word0 >> 24) | (word1 << 8)) & MASK_24BITS;
+    sample[2] = ((word1 >> 16) | (word2 << 16)) & MASK_24BITS;
+    sample[3] = word2 >> 8;
 }
 
-/** @brief Extend 20-bit value's sign bit into 32-bit word.
+/** @brief Read a block of 32-bit words.
  *
- *  @param[in] value  The 20-bit input value to be extended.
+ *  @param[in]  data    Block of 32-bit words.
+ *  @param[out] sample  Words.
  */
-static void extend_msb_20bits_value(uint32_t *value)
+static inline void read_block_32bits(const uint8_t *data, uint32_t *sample)
 {
-    if ((*value) & (1 << 19)) {
-        /* Negative value. */
-        *value |= 0xFFF00000;
-    } else {
-        /* Positive value. */
-        *value &= 0x000FFFFF;
+    for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+        sample[k] = read_word(&data[k * sizeof(uint32_t)]);
     }
 }
 
-/** @brief Extend 24-bit value's sign bit into 32-bit word.
+/** @brief Write a block of 16-bit samples as two words.
+ *
+ *  @param[out] data    Block of 16-bit samples.
+ *  @param[in]  sample  Samples in the LSBs of the words, the other bits are ignored.
+ */
+static inline void write_block_16bits(uint8_t *data, const uint32_t *sample)
+{
+    write_word(&data[0], (sample[0] & MASK_16BITS) | (sample[1] << 16));
+    write_word(&data[4], (sample[2] & MASK_16BITS) | (sample[3] << 16));
+}
+
+/** @brief Write a block of packed 18-bit samples as two words and a byte.
+ *
+ *  @param[out] data    Block of packed 18-bit samples.
+ *  @param[in]  sample  Samples in the LSBs of the words, the other bits are ignored.
+ */
+static inline void write_block_18bits(uint8_t *data, const uint32_t *sample)
+{
+    uint32_t sample1 = sample[1] & MASK_18BITS;
+    uint32_t sample3 = sample[3] & MASK_18BITS;
+
+    write_word(&data[0], (sample[0] & MASK_18BITS) | (sample1 << 18));
+    write_word(&data[4], (sample1 >> 14) | ((sample[2] & MASK_18BITS) << 4) | (sample3 << 22));
+    data[8] = (uint8_t)(sample3 >> 10);
+}
+
+/** @brief Write a block of packed 20-bit samples as two words and a half word.
+ *
+ *  @param[out] data    Block of packed 20-bit samples.
+ *  @param[in]  sample  Samples in the LSBs of the words, the other bits are ignored.
+ */
+static inline void write_block_20bits(uint8_t *data, const uint32_t *sample)
+{
+    uint32_t sample1 = sample[1] & MASK_20BITS;
+    uint32_t sample3 = sample[3] & MASK_20BITS;
+
+    write_word(&data[0], (sample[0] & MASK_20BITS) | (sample1 << 20));
+    write_word(&data[4], (sample1 >> 12) | ((sample[2] & MASK_20BITS) << 8) | (sample3 << 28));
+    data[8] = (uint8_t)(sample3 >> 4);
+    data[9] = (uint8_t)(sample3 >> 12);
+}
+
+/** @brief Write a block of packed 24-bit samples as three words.
+ *
+ *  @param[out] data    Block of packed 24-bit samples.
+ *  @param[in]  sample  Samples in the LSBs of the words, the other bits are ignored.
+ */
+static inline void write_block_24bits(uint8_t *data, const uint32_t *sample)
+{
+    uint32_t sample1 = sample[1] & MASK_24BITS;
+    uint32_t sample2 = sample[2] & MASK_24BITS;
+
+    write_word(&data[0], (sample[0] & MASK_24BITS) | (sample1 << 24));
+    write_word(&data[4], (sample1 >> 8) | (sample2 << 16));
+    write_word(&data[8], (sample2 >> 16) | (sample[3] << 8));
+}
+
+/** @brief Write a block of 32-bit words.
  *
- *  @param[in] value  The 24-bit input value to be extended.
+ *  @param[out] data    Block of 32-bit words.
+ *  @param[in]  sample  Words.
  */
-static void extend_msb_24bits_value(uint32_t *value)
+static inline void write_block_32bits(uint8_t *data, const uint32_t *sample)
 {
-    if ((*value) & (1 << 23)) {
-        /* Negative value. */
-        *value |= 0xFF000000;
-    } else {
-        /* Positive value. */
-        *value &= 0x00FFFFFF;
+    for (uint8_t k = 0; k < BLOCK_SAMPLE_COUNT; k++) {
+        write_word(&data[k * sizeof(uint32_t)], sample[k]);
     }
 }
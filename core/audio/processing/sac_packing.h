@@ -66,7 +66,12 @@ typedef enum sac_packing_mode {
 } sac_packing_mode_t;
 
 typedef struct sac_packing_instance {
+    /*! Conversion applied to the audio samples. */
     sac_packing_mode_t packing_mode;
+    struct {
+        /*! Internal: Kernel of the packing mode, resolved when the mode is set. */
+        const struct sac_packing_kernel *kernel;
+    } _internal;
 } sac_packing_instance_t;
 
 /* PUBLIC FUNCTION PROTOTYPES *************************************************/
@@ -108,6 +113,13 @@ uint32_t sac_packing_ctrl(void *instance, sac_pipeline_t *pipeline, uint8_t cmd,
 uint16_t sac_packing_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
                              uint16_t size, uint8_t *data_out, sac_status_t *status);
 
+/** @brief Check if the packing processing stage can be executed in place.
+ *
+ *  @param[in] instance  Packing instance.
+ *  @return True if the current packing mode keeps the payload size, false otherwise.
+ */
+bool sac_packing_is_in_place(void *instance);
+
 #ifdef __cplusplus
 }
 #endif
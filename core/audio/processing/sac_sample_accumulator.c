@@ -12,6 +12,9 @@
 #include <string.h>
 #include "sac_error.h"
 #include "sac_stats.h"
+#if SAC_ENABLE_PERF_STATS
+#include "sac_hal_facade.h"
+#endif
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 void sac_sample_accumulator_init(void *instance, const char *name, sac_pipeline_t *pipeline, mem_pool_t *mem_pool,
@@ -158,6 +161,9 @@ uint16_t sac_sample_accumulator_process(void *instance, sac_pipeline_t *pipeline
         *sac_node_get_header(node) = *header;
         /* Set the node's payload size. */
         sac_node_set_payload_size(node, acc_inst->_internal.accumulator_size);
+#if SAC_ENABLE_PERF_STATS
+        sac_node_set_timestamp(node, sac_facade_perf_get_timestamp());
+#endif
         /* Enqueue the extra packet at the head of the producer queue since this packet is older. */
         sac_node_data_memcpy(node, current_read_ptr + ((i - 1) * acc_inst->_internal.accumulator_size),
                              acc_inst->_internal.accumulator_size, status);
@@ -16,6 +16,10 @@
 extern "C" {
 #endif
 
+/* CONSTANTS ******************************************************************/
+/*! Memory pool footprint of a sample accumulator instance, for its max_accumulator_size. */
+#define SAC_SAMPLE_ACCUMULATOR_FOOTPRINT(max_accumulator_size) MEM_POOL_BLOCK_SIZE(max_accumulator_size)
+
 /* TYPES **********************************************************************/
 /** @brief SPARK Audio Core commands.
  */
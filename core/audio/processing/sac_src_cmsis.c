@@ -14,8 +14,7 @@
 #include <string.h>
 
 /* CONSTANTS ******************************************************************/
-/*! Must be dividable by all sac_src_factor since fir phaseLength is (NumTaps / ratio). */
-#define FIR_NUMTAPS 24
+#define FIR_NUMTAPS SAC_SRC_CMSIS_FIR_NUM_TAPS
 /*
  * The filters used in this processing stage will introduce a delay equivalent to FIR_NUMTAPS samples.
  * This delay is the results of the FIR filters used for decimation and interpolation.
@@ -146,6 +145,20 @@ static const int32_t fir_n24_c0_10_w_hamming_x6_gain_32bit[FIR_NUMTAPS] = {
 };
 /* PRIVATE FUNCTION PROTOTYPES ************************************************/
 void set_word_size(src_cmsis_cfg_t *cmsis_cfg, uint8_t *input_sample_size_byte, uint8_t *output_sample_size_byte);
+static void set_fir_format(fir_sample_format_t *format, uint8_t bit_depth, uint8_t sample_size_byte);
+static filtering_functions_error_t init_interpolate(fir_interpolate_multi_instance_t *fir, uint8_t multiply_ratio,
+                                                    uint8_t channel_count, const int32_t *coeffs, uint32_t block_size,
+                                                    mem_pool_t *mem_pool, sac_status_t *status);
+static filtering_functions_error_t init_interpolate_q15(fir_interpolate_q15_multi_instance_t *fir,
+                                                        uint8_t multiply_ratio, uint8_t channel_count,
+                                                        const int32_t *coeffs, uint32_t block_size,
+                                                        mem_pool_t *mem_pool, sac_status_t *status);
+static filtering_functions_error_t init_decimate(fir_decimate_multi_instance_t *fir, uint8_t divide_ratio,
+                                                 uint8_t channel_count, const int32_t *coeffs, uint32_t block_size,
+                                                 mem_pool_t *mem_pool, sac_status_t *status);
+static filtering_functions_error_t init_decimate_q15(fir_decimate_q15_multi_instance_t *fir, uint8_t divide_ratio,
+                                                     uint8_t channel_count, const int32_t *coeffs, uint32_t block_size,
+                                                     mem_pool_t *mem_pool, sac_status_t *status);
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 void sac_src_cmsis_init(void *instance, const char *name, sac_pipeline_t *pipeline, mem_pool_t *mem_pool,
@@ -154,20 +167,16 @@ void sac_src_cmsis_init(void *instance, const char *name, sac_pipeline_t *pipeli
     (void)pipeline;
     (void)name;
 
-    int32_t *fir_state = NULL;
     const int32_t *fir_coeff_decimation = NULL;
     const int32_t *fir_coeff_interpolation = NULL;
     src_cmsis_instance_t *src_instance = instance;
-    fir_decimate_instance_t *decimate_instance = NULL;
-    fir_interpolate_instance_t *interpolate_instance = NULL;
-    fir_sample_format_t *input_format = NULL;
-    fir_sample_format_t *output_format = NULL;
+    fir_sample_format_t input_format = {0};
+    fir_sample_format_t output_format = {0};
     uint8_t input_sample_size_byte = 0;
     uint8_t output_sample_size_byte = 0;
     uint32_t block_size = 0;
     uint32_t allocation_size = 0;
     uint16_t discard_accumulator_size = 0;
-    uint8_t bit_depth = 0;
     filtering_functions_error_t fir_err = FILTERING_FUNCTION_ERR_NONE;
 
     *status = SAC_OK;
@@ -207,96 +216,57 @@ void sac_src_cmsis_init(void *instance, const char *name, sac_pipeline_t *pipeli
         return;
     }
 
+    if (src_instance->cfg.use_q15_filters && ((src_instance->cfg.input_sample_format.bit_depth != SAC_16BITS) ||
+                                              (src_instance->cfg.output_sample_format.bit_depth != SAC_16BITS))) {
+        /* Q15 filters would truncate samples wider than 16 bits. */
+        *status = SAC_ERR_PROCESSING_STAGE_INIT;
+        return;
+    }
+
     if ((src_instance->cfg.multiply_ratio == 1) && (src_instance->cfg.divide_ratio == 1)) {
         *status = SAC_ERR_PROCESSING_STAGE_INIT;
         return;
     }
 
     set_word_size(&src_instance->cfg, &input_sample_size_byte, &output_sample_size_byte);
+    set_fir_format(&input_format, src_instance->cfg.input_sample_format.bit_depth, input_sample_size_byte);
+    set_fir_format(&output_format, src_instance->cfg.output_sample_format.bit_depth, output_sample_size_byte);
 
-    switch (src_instance->cfg.multiply_ratio) {
-    case SAC_SRC_ONE:
-        fir_coeff_interpolation = NULL;
-        break;
-    case SAC_SRC_TWO:
-        fir_coeff_interpolation = fir_n24_c0_35_w_hamming_x2_gain_32bit;
-        break;
-    case SAC_SRC_THREE:
-        fir_coeff_interpolation = fir_n24_c0_20_w_hamming_x3_gain_32bit;
-        break;
-    case SAC_SRC_FOUR:
-        fir_coeff_interpolation = fir_n24_c0_15_w_hamming_x4_gain_32bit;
-        break;
-    case SAC_SRC_SIX:
-        fir_coeff_interpolation = fir_n24_c0_10_w_hamming_x6_gain_32bit;
-        break;
-    default:
+    fir_coeff_interpolation = sac_src_cmsis_get_interpolation_coeffs(src_instance->cfg.multiply_ratio);
+    if ((fir_coeff_interpolation == NULL) && (src_instance->cfg.multiply_ratio != SAC_SRC_ONE)) {
         /* Invalid ratio. */
         *status = SAC_ERR_PROCESSING_STAGE_INIT;
         return;
     }
 
     if (src_instance->cfg.multiply_ratio > SAC_SRC_ONE) {
-        /* Allocate interpolate instance memory. */
-        allocation_size = sizeof(fir_interpolate_instance_t) * src_instance->cfg.channel_count;
-        src_instance->_internal.interpolate_instances = mem_pool_malloc(mem_pool, allocation_size);
-        if (src_instance->_internal.interpolate_instances == NULL) {
-            *status = SAC_ERR_NOT_ENOUGH_MEMORY;
+        /* The filters keep one history per channel, sized by the number of frames of a payload. */
+        block_size = (src_instance->cfg.payload_size / input_sample_size_byte) / src_instance->cfg.channel_count;
+
+        /* If the SRC instance performs both interpolation and decimation,
+         * the same input format is used for both filters.
+         */
+        if (src_instance->cfg.use_q15_filters) {
+            fir_err = init_interpolate_q15(&src_instance->_internal.interpolate.q15, src_instance->cfg.multiply_ratio,
+                                           src_instance->cfg.channel_count, fir_coeff_interpolation, block_size,
+                                           mem_pool, status);
+            src_instance->_internal.interpolate.q15.input_sample_format = input_format;
+            src_instance->_internal.interpolate.q15.output_sample_format =
+                (src_instance->cfg.divide_ratio > SAC_SRC_ONE) ? input_format : output_format;
+        } else {
+            fir_err = init_interpolate(&src_instance->_internal.interpolate.q31, src_instance->cfg.multiply_ratio,
+                                       src_instance->cfg.channel_count, fir_coeff_interpolation, block_size, mem_pool,
+                                       status);
+            src_instance->_internal.interpolate.q31.input_sample_format = input_format;
+            src_instance->_internal.interpolate.q31.output_sample_format =
+                (src_instance->cfg.divide_ratio > SAC_SRC_ONE) ? input_format : output_format;
+        }
+        if (*status != SAC_OK) {
             return;
         }
-
-        block_size = (src_instance->cfg.payload_size / input_sample_size_byte);
-        interpolate_instance = src_instance->_internal.interpolate_instances;
-        for (uint8_t i = 0; i < src_instance->cfg.channel_count; i++) {
-            /* Allocate FIR state memory. */
-            allocation_size = sizeof(int32_t) * (FIR_NUMTAPS + block_size);
-            fir_state = mem_pool_malloc(mem_pool, allocation_size);
-            if (fir_state == NULL) {
-                *status = SAC_ERR_NOT_ENOUGH_MEMORY;
-                return;
-            }
-
-            /* Input format assignment. */
-            input_format = &interpolate_instance[i].input_sample_format;
-            bit_depth = src_instance->cfg.input_sample_format.bit_depth;
-            input_format->bit_depth = bit_depth;
-            input_format->sample_size_byte = input_sample_size_byte;
-            if (bit_depth == SAC_16BITS) {
-                input_format->sample_bitshift = FIR_BITSHIFT_16BITS;
-                input_format->sample_mask = FIR_MASK_16BITS;
-            } else {
-                input_format->sample_bitshift = FIR_BITSHIFT_24BITS;
-                input_format->sample_mask = FIR_MASK_24BITS;
-            }
-
-            /* Output format assignment. */
-            /* If the SRC instance performs both interpolation and decimation,
-             * the same input format is used for both filters.
-             */
-            output_format = &interpolate_instance[i].output_sample_format;
-            if (src_instance->cfg.divide_ratio > SAC_SRC_ONE) {
-                output_format->bit_depth = input_format->bit_depth;
-                output_format->sample_size_byte = input_format->sample_size_byte;
-                output_format->sample_bitshift = input_format->sample_bitshift;
-            } else {
-                bit_depth = src_instance->cfg.output_sample_format.bit_depth;
-                output_format->bit_depth = bit_depth;
-                output_format->sample_size_byte = output_sample_size_byte;
-                if (bit_depth == SAC_16BITS) {
-                    output_format->sample_bitshift = FIR_BITSHIFT_16BITS;
-                } else {
-                    output_format->sample_bitshift = FIR_BITSHIFT_24BITS;
-                }
-            }
-
-            /* Initialize interpolate instance. */
-            fir_err = fir_interpolate_init(&src_instance->_internal.interpolate_instances[i],
-                                           src_instance->cfg.multiply_ratio, FIR_NUMTAPS, fir_coeff_interpolation,
-                                           fir_state, block_size);
-            if (fir_err != FILTERING_FUNCTION_ERR_NONE) {
-                *status = SAC_ERR_PROCESSING_STAGE_INIT;
-                return;
-            }
+        if (fir_err != FILTERING_FUNCTION_ERR_NONE) {
+            *status = SAC_ERR_PROCESSING_STAGE_INIT;
+            return;
         }
     }
 
@@ -333,66 +303,27 @@ void sac_src_cmsis_init(void *instance, const char *name, sac_pipeline_t *pipeli
             }
         }
 
-        /* Allocate decimate instance memory. */
-        allocation_size = sizeof(fir_decimate_instance_t) * src_instance->cfg.channel_count;
-        src_instance->_internal.decimate_instances = mem_pool_malloc(mem_pool, allocation_size);
-        if (src_instance->_internal.decimate_instances == NULL) {
-            *status = SAC_ERR_NOT_ENOUGH_MEMORY;
+        block_size = ((src_instance->cfg.payload_size * src_instance->cfg.multiply_ratio) / input_sample_size_byte) /
+                     src_instance->cfg.channel_count;
+        if (src_instance->cfg.use_q15_filters) {
+            fir_err = init_decimate_q15(&src_instance->_internal.decimate.q15, src_instance->cfg.divide_ratio,
+                                        src_instance->cfg.channel_count, fir_coeff_decimation, block_size, mem_pool,
+                                        status);
+            src_instance->_internal.decimate.q15.input_sample_format = input_format;
+            src_instance->_internal.decimate.q15.output_sample_format = output_format;
+        } else {
+            fir_err = init_decimate(&src_instance->_internal.decimate.q31, src_instance->cfg.divide_ratio,
+                                    src_instance->cfg.channel_count, fir_coeff_decimation, block_size, mem_pool,
+                                    status);
+            src_instance->_internal.decimate.q31.input_sample_format = input_format;
+            src_instance->_internal.decimate.q31.output_sample_format = output_format;
+        }
+        if (*status != SAC_OK) {
             return;
         }
-
-        block_size = (src_instance->cfg.payload_size * src_instance->cfg.multiply_ratio) / input_sample_size_byte;
-        decimate_instance = src_instance->_internal.decimate_instances;
-        for (uint8_t i = 0; i < src_instance->cfg.channel_count; i++) {
-            /* Allocate FIR state memory. */
-            allocation_size = sizeof(int32_t) * (FIR_NUMTAPS + block_size);
-            fir_state = mem_pool_malloc(mem_pool, allocation_size);
-            if (fir_state == NULL) {
-                *status = SAC_ERR_NOT_ENOUGH_MEMORY;
-                return;
-            }
-
-            /* Input format assignment. */
-            input_format = &decimate_instance[i].input_sample_format;
-            if (src_instance->cfg.multiply_ratio > SAC_SRC_ONE) {
-                memcpy(input_format, &src_instance->_internal.interpolate_instances->input_sample_format,
-                       sizeof(fir_sample_format_t));
-            } else {
-                bit_depth = src_instance->cfg.input_sample_format.bit_depth;
-                input_format->bit_depth = bit_depth;
-                input_format->sample_size_byte = input_sample_size_byte;
-                if (bit_depth == SAC_16BITS) {
-                    input_format->sample_bitshift = FIR_BITSHIFT_16BITS;
-                    input_format->sample_mask = FIR_MASK_16BITS;
-                } else {
-                    input_format->sample_bitshift = FIR_BITSHIFT_24BITS;
-                    input_format->sample_mask = FIR_MASK_24BITS;
-                }
-            }
-
-            /* Output format assignment. */
-            bit_depth = src_instance->cfg.output_sample_format.bit_depth;
-            decimate_instance[i].output_sample_format.bit_depth = bit_depth;
-            decimate_instance[i].output_sample_format.sample_size_byte = output_sample_size_byte;
-
-            /* Output format assignment. */
-            output_format = &decimate_instance[i].output_sample_format;
-            bit_depth = src_instance->cfg.output_sample_format.bit_depth;
-            output_format->bit_depth = bit_depth;
-            output_format->sample_size_byte = output_sample_size_byte;
-            if (bit_depth == SAC_16BITS) {
-                output_format->sample_bitshift = FIR_BITSHIFT_16BITS;
-            } else {
-                output_format->sample_bitshift = FIR_BITSHIFT_24BITS;
-            }
-
-            /* Initialize decimate instance. */
-            fir_err = fir_decimate_init(&src_instance->_internal.decimate_instances[i], FIR_NUMTAPS,
-                                        src_instance->cfg.divide_ratio, fir_coeff_decimation, fir_state, block_size);
-            if (fir_err != FILTERING_FUNCTION_ERR_NONE) {
-                *status = SAC_ERR_PROCESSING_STAGE_INIT;
-                return;
-            }
+        if (fir_err != FILTERING_FUNCTION_ERR_NONE) {
+            *status = SAC_ERR_PROCESSING_STAGE_INIT;
+            return;
         }
     }
 
@@ -509,9 +440,13 @@ uint16_t sac_src_cmsis_process(void *instance, sac_pipeline_t *pipeline, sac_hea
             sample_count_in -= accumulator_sample_count / FIR_SAMPLE_COUNT_CORRECTION_FACTOR;
         }
 
-        for (uint8_t i = 0; i < src_instance->cfg.channel_count; i++) {
-            fir_interpolate(&src_instance->_internal.interpolate_instances[i], audio_in, audio_out,
-                            sample_count_in / src_instance->cfg.channel_count, i, src_instance->cfg.channel_count);
+        /* All channels are interpolated in a single pass over the input. */
+        if (src_instance->cfg.use_q15_filters) {
+            fir_interpolate_q15_multi(&src_instance->_internal.interpolate.q15, audio_in, audio_out,
+                                      sample_count_in / src_instance->cfg.channel_count);
+        } else {
+            fir_interpolate_multi(&src_instance->_internal.interpolate.q31, audio_in, audio_out,
+                                  sample_count_in / src_instance->cfg.channel_count);
         }
         sample_count_out = sample_count_in * src_instance->cfg.multiply_ratio;
     }
@@ -524,9 +459,13 @@ uint16_t sac_src_cmsis_process(void *instance, sac_pipeline_t *pipeline, sac_hea
             audio_in = data_in;
         }
         audio_out = data_out;
-        for (uint8_t i = 0; i < src_instance->cfg.channel_count; i++) {
-            fir_decimate(&src_instance->_internal.decimate_instances[i], audio_in, audio_out,
-                         sample_count_in / src_instance->cfg.channel_count, i, src_instance->cfg.channel_count);
+        /* All channels are decimated in a single pass over the input. */
+        if (src_instance->cfg.use_q15_filters) {
+            fir_decimate_q15_multi(&src_instance->_internal.decimate.q15, audio_in, audio_out,
+                                   sample_count_in / src_instance->cfg.channel_count);
+        } else {
+            fir_decimate_multi(&src_instance->_internal.decimate.q31, audio_in, audio_out,
+                               sample_count_in / src_instance->cfg.channel_count);
         }
         sample_count_out = sample_count_in / src_instance->cfg.divide_ratio;
     }
@@ -630,6 +569,22 @@ uint16_t sac_src_cmsis_process_discard(void *instance, sac_pipeline_t *pipeline,
     return ret;
 }
 
+const int32_t *sac_src_cmsis_get_interpolation_coeffs(src_cmsis_ratio_t multiply_ratio)
+{
+    switch (multiply_ratio) {
+    case SAC_SRC_TWO:
+        return fir_n24_c0_35_w_hamming_x2_gain_32bit;
+    case SAC_SRC_THREE:
+        return fir_n24_c0_20_w_hamming_x3_gain_32bit;
+    case SAC_SRC_FOUR:
+        return fir_n24_c0_15_w_hamming_x4_gain_32bit;
+    case SAC_SRC_SIX:
+        return fir_n24_c0_10_w_hamming_x6_gain_32bit;
+    default:
+        return NULL;
+    }
+}
+
 /* PRIVATE FUNCTIONS **********************************************************/
 void set_word_size(src_cmsis_cfg_t *cmsis_cfg, uint8_t *input_sample_size_byte, uint8_t *output_sample_size_byte)
 {
@@ -644,3 +599,143 @@ void set_word_size(src_cmsis_cfg_t *cmsis_cfg, uint8_t *input_sample_size_byte,
         *output_sample_size_byte = SAC_WORD_SIZE_BYTE;
     }
 }
+
+/** @brief Fill a FIR sample format from a bit depth and a word size.
+ *
+ *  @param[out] format            FIR sample format.
+ *  @param[in]  bit_depth         Bit depth of a sample, 16 or 24 bits.
+ *  @param[in]  sample_size_byte  Word size of a sample in bytes.
+ */
+static void set_fir_format(fir_sample_format_t *format, uint8_t bit_depth, uint8_t sample_size_byte)
+{
+    format->bit_depth = bit_depth;
+    format->sample_size_byte = sample_size_byte;
+    if (bit_depth == SAC_16BITS) {
+        format->sample_bitshift = FIR_BITSHIFT_16BITS;
+        format->sample_mask = FIR_MASK_16BITS;
+    } else {
+        format->sample_bitshift = FIR_BITSHIFT_24BITS;
+        format->sample_mask = FIR_MASK_24BITS;
+    }
+}
+
+/** @brief Allocate the state of the channel-fused interpolator and initialize it.
+ *
+ *  @param[out] fir             Interpolator instance.
+ *  @param[in]  multiply_ratio  Upsample factor.
+ *  @param[in]  channel_count   Number of interleaved channels.
+ *  @param[in]  coeffs          Filter coefficients.
+ *  @param[in]  block_size      Maximum number of input samples per channel.
+ *  @param[in]  mem_pool        Memory pool handle.
+ *  @param[out] status          Status code.
+ *  @return FIR initialization error code.
+ */
+static filtering_functions_error_t init_interpolate(fir_interpolate_multi_instance_t *fir, uint8_t multiply_ratio,
+                                                    uint8_t channel_count, const int32_t *coeffs, uint32_t block_size,
+                                                    mem_pool_t *mem_pool, sac_status_t *status)
+{
+    int32_t *fir_state = NULL;
+
+    fir_state = mem_pool_malloc(mem_pool,
+                                sizeof(int32_t) * FIR_MULTI_STATE_SIZE(FIR_NUMTAPS / multiply_ratio, block_size,
+                                                                       channel_count));
+    if (fir_state == NULL) {
+        *status = SAC_ERR_NOT_ENOUGH_MEMORY;
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    return fir_interpolate_multi_init(fir, multiply_ratio, FIR_NUMTAPS, channel_count, coeffs, fir_state, block_size);
+}
+
+/** @brief Allocate the state and coefficients of the channel-fused Q15 interpolator and initialize it.
+ *
+ *  @param[out] fir             Interpolator instance.
+ *  @param[in]  multiply_ratio  Upsample factor.
+ *  @param[in]  channel_count   Number of interleaved channels.
+ *  @param[in]  coeffs          Filter coefficients in 1.31 format.
+ *  @param[in]  block_size      Maximum number of input samples per channel.
+ *  @param[in]  mem_pool        Memory pool handle.
+ *  @param[out] status          Status code.
+ *  @return FIR initialization error code.
+ */
+static filtering_functions_error_t init_interpolate_q15(fir_interpolate_q15_multi_instance_t *fir,
+                                                        uint8_t multiply_ratio, uint8_t channel_count,
+                                                        const int32_t *coeffs, uint32_t block_size,
+                                                        mem_pool_t *mem_pool, sac_status_t *status)
+{
+    int16_t *fir_state = NULL;
+    int16_t *fir_coeffs = NULL;
+    int16_t *fir_phase_coeffs = NULL;
+
+    fir_state = mem_pool_malloc(mem_pool,
+                                sizeof(int16_t) * FIR_MULTI_STATE_SIZE(FIR_NUMTAPS / multiply_ratio, block_size,
+                                                                       channel_count));
+    fir_coeffs = mem_pool_malloc(mem_pool, sizeof(int16_t) * FIR_NUMTAPS);
+    fir_phase_coeffs = mem_pool_malloc(mem_pool, sizeof(int16_t) * FIR_NUMTAPS);
+    if ((fir_state == NULL) || (fir_coeffs == NULL) || (fir_phase_coeffs == NULL)) {
+        *status = SAC_ERR_NOT_ENOUGH_MEMORY;
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+    fir_coeffs_q31_to_q15(coeffs, fir_coeffs, FIR_NUMTAPS);
+
+    return fir_interpolate_q15_multi_init(fir, multiply_ratio, FIR_NUMTAPS, channel_count, fir_coeffs,
+                                          fir_phase_coeffs, fir_state, block_size);
+}
+
+/** @brief Allocate the state of the channel-fused decimator and initialize it.
+ *
+ *  @param[out] fir            Decimator instance.
+ *  @param[in]  divide_ratio   Decimation factor.
+ *  @param[in]  channel_count  Number of interleaved channels.
+ *  @param[in]  coeffs         Filter coefficients.
+ *  @param[in]  block_size     Maximum number of input samples per channel.
+ *  @param[in]  mem_pool       Memory pool handle.
+ *  @param[out] status         Status code.
+ *  @return FIR initialization error code.
+ */
+static filtering_functions_error_t init_decimate(fir_decimate_multi_instance_t *fir, uint8_t divide_ratio,
+                                                 uint8_t channel_count, const int32_t *coeffs, uint32_t block_size,
+                                                 mem_pool_t *mem_pool, sac_status_t *status)
+{
+    int32_t *fir_state = NULL;
+
+    fir_state = mem_pool_malloc(mem_pool, sizeof(int32_t) * FIR_MULTI_STATE_SIZE(FIR_NUMTAPS, block_size,
+                                                                                 channel_count));
+    if (fir_state == NULL) {
+        *status = SAC_ERR_NOT_ENOUGH_MEMORY;
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    return fir_decimate_multi_init(fir, FIR_NUMTAPS, divide_ratio, channel_count, coeffs, fir_state, block_size);
+}
+
+/** @brief Allocate the state and coefficients of the channel-fused Q15 decimator and initialize it.
+ *
+ *  @param[out] fir            Decimator instance.
+ *  @param[in]  divide_ratio   Decimation factor.
+ *  @param[in]  channel_count  Number of interleaved channels.
+ *  @param[in]  coeffs         Filter coefficients in 1.31 format.
+ *  @param[in]  block_size     Maximum number of input samples per channel.
+ *  @param[in]  mem_pool       Memory pool handle.
+ *  @param[out] status         Status code.
+ *  @return FIR initialization error code.
+ */
+static filtering_functions_error_t init_decimate_q15(fir_decimate_q15_multi_instance_t *fir, uint8_t divide_ratio,
+                                                     uint8_t channel_count, const int32_t *coeffs, uint32_t block_size,
+                                                     mem_pool_t *mem_pool, sac_status_t *status)
+{
+    int16_t *fir_state = NULL;
+    int16_t *fir_coeffs = NULL;
+
+    fir_state = mem_pool_malloc(mem_pool, sizeof(int16_t) * FIR_MULTI_STATE_SIZE(FIR_NUMTAPS, block_size,
+                                                                                 channel_count));
+    fir_coeffs = mem_pool_malloc(mem_pool, sizeof(int16_t) * FIR_NUMTAPS);
+    if ((fir_state == NULL) || (fir_coeffs == NULL)) {
+        *status = SAC_ERR_NOT_ENOUGH_MEMORY;
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+    fir_coeffs_q31_to_q15(coeffs, fir_coeffs, FIR_NUMTAPS);
+
+    return fir_decimate_q15_multi_init(fir, FIR_NUMTAPS, divide_ratio, channel_count, fir_coeffs, fir_state,
+                                       block_size);
+}
@@ -21,6 +21,12 @@
 extern "C" {
 #endif
 
+/* CONSTANTS ******************************************************************/
+/*! Number of taps of the SRC filters, must be dividable by all the ratios since the polyphase length is
+ *  (taps / ratio).
+ */
+#define SAC_SRC_CMSIS_FIR_NUM_TAPS 24
+
 /* TYPES **********************************************************************/
 /** @brief SRC CMSIS Ratio.
  */
@@ -52,6 +58,10 @@ typedef struct src_cmsis_cfg {
     sac_sample_format_t output_sample_format;
     /*! Number of channels in audio packet. */
     uint8_t channel_count;
+    /*! True to filter with 16-bit coefficients and a 32-bit accumulator, using the dual 16-bit MAC of the core when
+     *  available. Only valid when both the input and output bit depths are 16 bits.
+     */
+    bool use_q15_filters;
 } src_cmsis_cfg_t;
 
 /** @brief SRC CMSIS Instance.
@@ -60,10 +70,16 @@ typedef struct src_cmsis_instance {
     /*! SRC CMSIS user configuration. */
     src_cmsis_cfg_t cfg;
     struct {
-        /*! Internal: Instances for the arm_fir_interpolation. 1 instance per channel. */
-        fir_interpolate_instance_t *interpolate_instances;
-        /*! Internal: Instances for the arm_fir_decimation. 1 instance per channel. */
-        fir_decimate_instance_t *decimate_instances;
+        /*! Internal: Channel-fused FIR interpolator, q15 is used when cfg.use_q15_filters is set. */
+        union {
+            fir_interpolate_multi_instance_t q31;
+            fir_interpolate_q15_multi_instance_t q15;
+        } interpolate;
+        /*! Internal: Channel-fused FIR decimator, q15 is used when cfg.use_q15_filters is set. */
+        union {
+            fir_decimate_multi_instance_t q31;
+            fir_decimate_q15_multi_instance_t q15;
+        } decimate;
         /*! Internal: Audio buffer to be used between multiply and divide process. */
         uint8_t *multiply_out_buffer;
         /*! Internal: Buffer to accumulate last FIR_NUM_TAPS samples of input payload. */
@@ -135,6 +151,16 @@ uint16_t sac_src_cmsis_process(void *instance, sac_pipeline_t *pipeline, sac_hea
 uint16_t sac_src_cmsis_process_discard(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
                                        uint16_t size, uint8_t *data_out, sac_status_t *status);
 
+/** @brief Get the interpolation filter of a ratio.
+ *
+ *  The coefficients are in Q1.31 format and include the gain compensating the interpolation zero-stuffing, so that
+ *  other stages interpolating audio samples can use the same filters.
+ *
+ *  @param[in] multiply_ratio  Interpolation ratio.
+ *  @return SAC_SRC_CMSIS_FIR_NUM_TAPS coefficients, NULL if the ratio is not an interpolation ratio.
+ */
+const int32_t *sac_src_cmsis_get_interpolation_coeffs(src_cmsis_ratio_t multiply_ratio);
+
 #ifdef __cplusplus
 }
 #endif
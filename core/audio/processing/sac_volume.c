@@ -10,6 +10,13 @@
 /* INCLUDES *******************************************************************/
 #include "sac_volume.h"
 #include <string.h>
+#include "fixed_point.h"
+
+/* CONSTANTS ******************************************************************/
+/*! Volume step of the fixed-point mode, in Q1.31 format. */
+#define VOLUME_TICK_Q31 ((int32_t)(SAC_VOLUME_TICK * FIXED_POINT_Q31_MAX))
+/*! Number of time constants of an exponential ramp within the ramp length. */
+#define EXPONENTIAL_RAMP_TIME_CONSTANT_COUNT 4
 
 /* PRIVATE FUNCTION PROTOTYPES ************************************************/
 static void volume_increase(sac_volume_instance_t *volume_ctrl);
@@ -22,12 +29,19 @@ static void apply_volume_factor_16bits(int16_t *audio_samples_in, uint16_t sampl
 static void apply_volume_factor_32bits(int32_t *audio_samples_in, uint16_t samples_count, int32_t *audio_samples_out,
                                        float volume_factor);
 static void validate_sac_bit_depth(sac_bit_depth_t bit_depth, sac_status_t *status);
+static void init_fixed_point_gain(sac_volume_instance_t *instance);
+static uint16_t process_fixed_point(sac_volume_instance_t *instance, uint8_t *data_in, uint16_t size,
+                                   uint8_t *data_out);
+static inline int32_t get_next_gain(sac_volume_instance_t *instance, int32_t gain);
+static void apply_gain_ramp_16bits(sac_volume_instance_t *instance, int16_t *audio_samples_in, uint16_t samples_count,
+                                   int16_t *audio_samples_out);
+static void apply_gain_ramp_32bits(sac_volume_instance_t *instance, int32_t *audio_samples_in, uint16_t samples_count,
+                                   int32_t *audio_samples_out);
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 void sac_volume_init(void *instance, const char *name, sac_pipeline_t *pipeline, mem_pool_t *mem_pool,
                      sac_status_t *status)
 {
-    (void)pipeline;
     (void)mem_pool;
     (void)name;
 
@@ -58,6 +72,29 @@ void sac_volume_init(void *instance, const char *name, sac_pipeline_t *pipeline,
         return;
     }
 
+    if ((vol_inst->mode != SAC_VOLUME_MODE_FLOAT) && (vol_inst->mode != SAC_VOLUME_MODE_FIXED_POINT)) {
+        *status = SAC_ERR_PROCESSING_STAGE_INIT;
+        return;
+    }
+
+    if ((vol_inst->ramp != SAC_VOLUME_RAMP_LINEAR) && (vol_inst->ramp != SAC_VOLUME_RAMP_EXPONENTIAL)) {
+        *status = SAC_ERR_PROCESSING_STAGE_INIT;
+        return;
+    }
+
+    if (vol_inst->mode == SAC_VOLUME_MODE_FIXED_POINT) {
+        if ((vol_inst->channel_count == 0) && (pipeline != NULL) && (pipeline->consumer != NULL)) {
+            vol_inst->channel_count = pipeline->consumer->cfg.channel_count;
+        }
+        if (vol_inst->channel_count == 0) {
+            /* The gain ramps need the frame size. */
+            *status = SAC_ERR_PROCESSING_STAGE_INIT;
+            return;
+        }
+        init_fixed_point_gain(vol_inst);
+        return;
+    }
+
     vol_inst->_internal.volume_factor = (vol_inst->initial_volume_level / 100.0);
     vol_inst->_internal.volume_threshold = (vol_inst->initial_volume_level / 100.0);
 }
@@ -83,7 +120,11 @@ uint32_t sac_volume_ctrl(void *instance, sac_pipeline_t *pipeline, uint8_t cmd,
         volume_mute(vol_inst);
         break;
     case SAC_VOLUME_GET_FACTOR:
-        ret = (uint32_t)(volume_get_level(vol_inst) * 10000.0);
+        if (vol_inst->mode == SAC_VOLUME_MODE_FIXED_POINT) {
+            ret = (uint32_t)((((uint64_t)vol_inst->_internal.gain_q31 * 10000) + (1ULL << 30)) >> 31);
+        } else {
+            ret = (uint32_t)(volume_get_level(vol_inst) * 10000.0);
+        }
         break;
     default:
         *status = SAC_ERR_INVALID_CMD;
@@ -101,6 +142,10 @@ uint16_t sac_volume_process(void *instance, sac_pipeline_t *pipeline, sac_header
 
     *status = SAC_OK;
 
+    if (vol_inst->mode == SAC_VOLUME_MODE_FIXED_POINT) {
+        return process_fixed_point(vol_inst, data_in, size, data_out);
+    }
+
     if ((vol_inst->_internal.volume_threshold != SAC_VOLUME_MAX) ||
         (vol_inst->_internal.volume_factor != SAC_VOLUME_MAX)) {
         adjust_volume_factor(vol_inst);
@@ -137,6 +182,13 @@ uint16_t sac_volume_process(void *instance, sac_pipeline_t *pipeline, sac_header
     }
 }
 
+bool sac_volume_is_in_place(void *instance)
+{
+    (void)instance;
+
+    return true;
+}
+
 /* PRIVATE FUNCTIONS **********************************************************/
 /** @brief Increase the audio volume.
  *
@@ -144,6 +196,15 @@ uint16_t sac_volume_process(void *instance, sac_pipeline_t *pipeline, sac_header
  */
 static void volume_increase(sac_volume_instance_t *instance)
 {
+    if (instance->mode == SAC_VOLUME_MODE_FIXED_POINT) {
+        if (instance->_internal.target_gain_q31 >= (FIXED_POINT_Q31_MAX - VOLUME_TICK_Q31)) {
+            instance->_internal.target_gain_q31 = FIXED_POINT_Q31_MAX;
+        } else {
+            instance->_internal.target_gain_q31 += VOLUME_TICK_Q31;
+        }
+        return;
+    }
+
     instance->_internal.volume_threshold += SAC_VOLUME_TICK;
     if (instance->_internal.volume_threshold >= SAC_VOLUME_MAX) {
         instance->_internal.volume_threshold = SAC_VOLUME_MAX;
@@ -156,6 +217,15 @@ static void volume_increase(sac_volume_instance_t *instance)
  */
 static void volume_decrease(sac_volume_instance_t *instance)
 {
+    if (instance->mode == SAC_VOLUME_MODE_FIXED_POINT) {
+        if (instance->_internal.target_gain_q31 <= VOLUME_TICK_Q31) {
+            instance->_internal.target_gain_q31 = 0;
+        } else {
+            instance->_internal.target_gain_q31 -= VOLUME_TICK_Q31;
+        }
+        return;
+    }
+
     instance->_internal.volume_threshold -= SAC_VOLUME_TICK;
     if (instance->_internal.volume_threshold <= SAC_VOLUME_MIN) {
         instance->_internal.volume_threshold = SAC_VOLUME_MIN;
@@ -168,6 +238,12 @@ static void volume_decrease(sac_volume_instance_t *instance)
  */
 static void volume_mute(sac_volume_instance_t *instance)
 {
+    if (instance->mode == SAC_VOLUME_MODE_FIXED_POINT) {
+        /* The fixed-point gain ramps down to avoid a click */
+        instance->_internal.target_gain_q31 = 0;
+        return;
+    }
+
     instance->_internal.volume_factor = 0;
     instance->_internal.volume_threshold = 0;
 }
@@ -251,3 +327,146 @@ static void validate_sac_bit_depth(sac_bit_depth_t bit_depth, sac_status_t *stat
         *status = SAC_ERR_BIT_DEPTH;
     }
 }
+
+/** @brief Initialize the fixed-point gain and ramp coefficient.
+ *
+ *  @param[in] instance  Volume instance.
+ */
+static void init_fixed_point_gain(sac_volume_instance_t *instance)
+{
+    uint16_t ramp_frame_count = instance->ramp_frame_count;
+    int64_t coefficient;
+
+    if (ramp_frame_count == 0) {
+        ramp_frame_count = SAC_VOLUME_DEFAULT_RAMP_FRAME_COUNT;
+    }
+
+    if (instance->initial_volume_level == (SAC_VOLUME_MAX * 100)) {
+        instance->_internal.gain_q31 = FIXED_POINT_Q31_MAX;
+    } else {
+        instance->_internal.gain_q31 = (int32_t)(((int64_t)instance->initial_volume_level * FIXED_POINT_Q31_MAX) / 100);
+    }
+    instance->_internal.target_gain_q31 = instance->_internal.gain_q31;
+
+    if (instance->ramp == SAC_VOLUME_RAMP_EXPONENTIAL) {
+        coefficient = ((int64_t)FIXED_POINT_Q31_MAX * EXPONENTIAL_RAMP_TIME_CONSTANT_COUNT) / ramp_frame_count;
+    } else {
+        coefficient = (int64_t)FIXED_POINT_Q31_MAX / ramp_frame_count;
+    }
+    instance->_internal.ramp_coefficient_q31 = (coefficient > FIXED_POINT_Q31_MAX) ? FIXED_POINT_Q31_MAX :
+                                                                                    (int32_t)coefficient;
+}
+
+/** @brief Process the volume in fixed-point mode.
+ *
+ *  @param[in]  instance  Volume instance.
+ *  @param[in]  data_in   Data in to be processed.
+ *  @param[in]  size      Number of bytes to process.
+ *  @param[out] data_out  Processed samples out, may be data_in.
+ *  @return Number of bytes processed. Return 0 if no samples processed.
+ */
+static uint16_t process_fixed_point(sac_volume_instance_t *instance, uint8_t *data_in, uint16_t size,
+                                   uint8_t *data_out)
+{
+    if ((instance->_internal.gain_q31 == FIXED_POINT_Q31_MAX) &&
+        (instance->_internal.target_gain_q31 == FIXED_POINT_Q31_MAX)) {
+        /* Unity gain, the payload is left untouched */
+        return 0;
+    }
+
+    if ((instance->sample_format.bit_depth == SAC_16BITS) &&
+        (instance->sample_format.sample_encoding == SAC_SAMPLE_PACKED)) {
+        apply_gain_ramp_16bits(instance, (int16_t *)data_in, (size / (SAC_WORD_SIZE_BYTE / 2)), (int16_t *)data_out);
+    } else {
+        apply_gain_ramp_32bits(instance, (int32_t *)data_in, (size / SAC_WORD_SIZE_BYTE), (int32_t *)data_out);
+    }
+
+    return size;
+}
+
+/** @brief Get the gain of the next frame of a ramp.
+ *
+ *  @param[in] instance  Volume instance.
+ *  @param[in] gain      Gain of the current frame, in Q1.31 format.
+ *  @return Gain of the next frame, in Q1.31 format.
+ */
+static inline int32_t get_next_gain(sac_volume_instance_t *instance, int32_t gain)
+{
+    int32_t target = instance->_internal.target_gain_q31;
+    int32_t coefficient = instance->_internal.ramp_coefficient_q31;
+    int32_t step;
+
+    /* Both gains are positive, the difference cannot overflow */
+    if (instance->ramp == SAC_VOLUME_RAMP_EXPONENTIAL) {
+        step = fixed_point_q31_multiply(target - gain, coefficient);
+        if (step == 0) {
+            return target;
+        }
+        return gain + step;
+    }
+
+    if (gain < target) {
+        return ((target - gain) <= coefficient) ? target : (gain + coefficient);
+    }
+    return ((gain - target) <= coefficient) ? target : (gain - coefficient);
+}
+
+/** @brief Apply the fixed-point gain on each sample, ramping it frame by frame towards the requested gain.
+ *
+ *  @param[in]  instance           Volume instance.
+ *  @param[in]  audio_samples_in   16bits samples pointer of data in.
+ *  @param[in]  samples_count      Number of samples to process.
+ *  @param[out] audio_samples_out  16bits samples pointer of data out, may be audio_samples_in.
+ */
+static void apply_gain_ramp_16bits(sac_volume_instance_t *instance, int16_t *audio_samples_in, uint16_t samples_count,
+                                   int16_t *audio_samples_out)
+{
+    uint8_t channel_count = instance->channel_count;
+    int32_t gain = instance->_internal.gain_q31;
+    uint16_t count = 0;
+
+    /* Ramp the gain on every frame until the requested gain is reached */
+    while ((gain != instance->_internal.target_gain_q31) && ((count + channel_count) <= samples_count)) {
+        gain = get_next_gain(instance, gain);
+        for (uint8_t channel = 0; channel < channel_count; channel++, count++) {
+            audio_samples_out[count] = (int16_t)fixed_point_q31_multiply(audio_samples_in[count], gain);
+        }
+    }
+
+    /* Constant gain for the rest of the packet */
+    for (; count < samples_count; count++) {
+        audio_samples_out[count] = (int16_t)fixed_point_q31_multiply(audio_samples_in[count], gain);
+    }
+
+    instance->_internal.gain_q31 = gain;
+}
+
+/** @brief Apply the fixed-point gain on each sample, ramping it frame by frame towards the requested gain.
+ *
+ *  @param[in]  instance           Volume instance.
+ *  @param[in]  audio_samples_in   32bits samples pointer of data in.
+ *  @param[in]  samples_count      Number of samples to process.
+ *  @param[out] audio_samples_out  32bits samples pointer of data out, may be audio_samples_in.
+ */
+static void apply_gain_ramp_32bits(sac_volume_instance_t *instance, int32_t *audio_samples_in, uint16_t samples_count,
+                                   int32_t *audio_samples_out)
+{
+    uint8_t channel_count = instance->channel_count;
+    int32_t gain = instance->_internal.gain_q31;
+    uint16_t count = 0;
+
+    /* Ramp the gain on every frame until the requested gain is reached */
+    while ((gain != instance->_internal.target_gain_q31) && ((count + channel_count) <= samples_count)) {
+        gain = get_next_gain(instance, gain);
+        for (uint8_t channel = 0; channel < channel_count; channel++, count++) {
+            audio_samples_out[count] = fixed_point_q31_multiply(audio_samples_in[count], gain);
+        }
+    }
+
+    /* Constant gain for the rest of the packet */
+    for (; count < samples_count; count++) {
+        audio_samples_out[count] = fixed_point_q31_multiply(audio_samples_in[count], gain);
+    }
+
+    instance->_internal.gain_q31 = gain;
+}
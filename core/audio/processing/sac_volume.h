@@ -27,6 +27,10 @@ extern "C" {
 #define SAC_VOLUME_GRAD 0.0003
 /*! Step value to use when increasing or decreasing the volume. */
 #define SAC_VOLUME_TICK 0.1
+/*! Default number of audio frames for a fixed-point gain ramp between the minimum and maximum volume. */
+#ifndef SAC_VOLUME_DEFAULT_RAMP_FRAME_COUNT
+#define SAC_VOLUME_DEFAULT_RAMP_FRAME_COUNT 960
+#endif
 
 /* TYPES **********************************************************************/
 /** @brief Volume Commands.
@@ -42,6 +46,28 @@ typedef enum sac_volume_cmd {
     SAC_VOLUME_GET_FACTOR,
 } sac_volume_cmd_t;
 
+/** @brief Volume arithmetic modes.
+ */
+typedef enum sac_volume_mode {
+    /*! Floating point gain, moved towards the requested volume by SAC_VOLUME_GRAD once per packet. */
+    SAC_VOLUME_MODE_FLOAT = 0,
+    /*! Q1.31 fixed-point gain with a rounded saturating multiply, ramped towards the requested volume on every frame.
+     *  The output is bit-exact across platforms and does not use the FPU.
+     */
+    SAC_VOLUME_MODE_FIXED_POINT,
+} sac_volume_mode_t;
+
+/** @brief Volume gain ramp shapes, for the fixed-point mode.
+ */
+typedef enum sac_volume_ramp {
+    /*! The gain moves towards the requested volume by a constant step on every frame. */
+    SAC_VOLUME_RAMP_LINEAR = 0,
+    /*! The gain moves towards the requested volume by a constant fraction of the remaining distance on every frame,
+     *  reaching 98% of a volume change after the ramp length.
+     */
+    SAC_VOLUME_RAMP_EXPONENTIAL,
+} sac_volume_ramp_t;
+
 /** @brief Volume Instance.
  */
 typedef struct sac_volume_instance {
@@ -49,11 +75,31 @@ typedef struct sac_volume_instance {
     sac_sample_format_t sample_format;
     /*! Initial volume level from 0 to 100. */
     uint8_t initial_volume_level;
+    /*! Arithmetic used to apply the volume. */
+    sac_volume_mode_t mode;
+    /*! Shape of the gain ramps, fixed-point mode only. */
+    sac_volume_ramp_t ramp;
+    /*! Number of interleaved channels, fixed-point mode only. All the samples of a frame get the same gain. 0 takes
+     *  the channel count of the pipeline consumer.
+     */
+    uint8_t channel_count;
+    /*! Number of frames of a ramp between the minimum and maximum volume, fixed-point mode only. 0 selects
+     *  SAC_VOLUME_DEFAULT_RAMP_FRAME_COUNT.
+     */
+    uint16_t ramp_frame_count;
     struct {
         /*! Internal: Factor used for calculation. */
         float volume_factor;
         /*! Internal: Threshold set by user that _volume_factor will tend towards. */
         float volume_threshold;
+        /*! Internal: Current gain in Q1.31 format, fixed-point mode. */
+        int32_t gain_q31;
+        /*! Internal: Gain requested by the user in Q1.31 format, fixed-point mode. */
+        int32_t target_gain_q31;
+        /*! Internal: Gain step per frame of a linear ramp, or fraction of the remaining distance per frame of an
+         *  exponential ramp, in Q1.31 format.
+         */
+        int32_t ramp_coefficient_q31;
     } _internal;
 } sac_volume_instance_t;
 
@@ -82,7 +128,17 @@ void sac_volume_init(void *instance, const char *name, sac_pipeline_t *pipeline,
 uint16_t sac_volume_process(void *instance, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
                             uint16_t size, uint8_t *data_out, sac_status_t *status);
 
+/** @brief Check if the volume processing stage can be executed in place.
+ *
+ *  @param[in] instance  Volume instance.
+ *  @return True, the volume is applied sample by sample without changing the payload size.
+ */
+bool sac_volume_is_in_place(void *instance);
+
 /** @brief Volume Control function.
+ *
+ *  In fixed-point mode, every command except SAC_VOLUME_GET_FACTOR only changes the requested volume and the gain
+ *  ramps towards it, including when muting.
  *
  *  @param[in]  volume  Volume instance.
  *  @param[in]  cmd     Control command.
@@ -24,12 +24,25 @@ extern "C" {
 #endif
 
 /* CONSTANTS ******************************************************************/
+#ifndef SAC_ENABLE_PERF_STATS
+/*! Compile the per-stage timing, queue depth and latency instrumentation. Set by the build system. */
+#define SAC_ENABLE_PERF_STATS 0
+#endif
+
 /*! Maximum of audio channels supported in audio core. */
 #define SAC_MAX_CHANNEL_COUNT 2
 /*! Placeholder to be used in a `sac_processing_ctrl` function call when no arguments are required. */
 #define SAC_NO_ARG 0
+/*! Position of the production timestamp in the audio packet. */
+#define SAC_NODE_TIMESTAMP_OFFSET 0
+#if SAC_ENABLE_PERF_STATS
+/*! Size of the production timestamp variable, only stored when the instrumentation is compiled. */
+#define SAC_NODE_TIMESTAMP_VAR_SIZE sizeof(uint32_t)
+#else
+#define SAC_NODE_TIMESTAMP_VAR_SIZE 0
+#endif
 /*! Position of the audio payload in the audio packet. */
-#define SAC_NODE_PAYLOAD_SIZE_OFFSET 0
+#define SAC_NODE_PAYLOAD_SIZE_OFFSET (SAC_NODE_TIMESTAMP_OFFSET + SAC_NODE_TIMESTAMP_VAR_SIZE)
 /*! Size of the audio payload variable. */
 #define SAC_NODE_PAYLOAD_SIZE_VAR_SIZE sizeof(uint16_t)
 /*! Position of the audio header in the audio packet. */
@@ -46,6 +59,18 @@ extern "C" {
 #define SAC_WORD_SIZE_BYTE 4
 /*! Number of bits required to store an audio sample aligned to a CPU word. */
 #define SAC_WORD_SIZE_BITS ((SAC_WORD_SIZE_BYTE) * (SAC_BYTE_SIZE_BITS))
+#ifndef SAC_PERF_HISTOGRAM_SUB_BIN_BITS
+/*! Number of linear bins each power of two is split into in a performance histogram, as a power of two. */
+#define SAC_PERF_HISTOGRAM_SUB_BIN_BITS 2
+#endif
+#ifndef SAC_PERF_HISTOGRAM_OCTAVE_COUNT
+/*! Number of powers of two covered by a performance histogram. Longer durations are counted in the last bin. */
+#define SAC_PERF_HISTOGRAM_OCTAVE_COUNT 24
+#endif
+/*! Number of linear bins per power of two in a performance histogram. */
+#define SAC_PERF_HISTOGRAM_SUB_BIN_COUNT (1 << SAC_PERF_HISTOGRAM_SUB_BIN_BITS)
+/*! Number of bins in a performance histogram. */
+#define SAC_PERF_HISTOGRAM_BIN_COUNT (SAC_PERF_HISTOGRAM_OCTAVE_COUNT * SAC_PERF_HISTOGRAM_SUB_BIN_COUNT)
 
 /* MACROS *********************************************************************/
 /*! Get the audio payload size in the audio packet. */
@@ -61,6 +86,15 @@ extern "C" {
 /*! Get a pointer to the packet data in the audio packet. */
 #define sac_node_get_data(node) ((uint8_t *)(queue_get_data_ptr(node, SAC_PACKET_DATA_OFFSET)))
 
+#if SAC_ENABLE_PERF_STATS
+/*! Get the timestamp at which the audio packet was produced. */
+#define sac_node_get_timestamp(node) (*((uint32_t *)(queue_get_data_ptr(node, SAC_NODE_TIMESTAMP_OFFSET))))
+
+/*! Set the timestamp at which the audio packet was produced. */
+#define sac_node_set_timestamp(node, timestamp) \
+    ((*((uint32_t *)(queue_get_data_ptr(node, SAC_NODE_TIMESTAMP_OFFSET)))) = (timestamp))
+#endif
+
 /*! Return an array size aligned on a specific type. */
 #define sac_align_data_size(current_size, type_to_align) \
     (sizeof(type_to_align) - ((current_size) % sizeof(type_to_align)))
@@ -127,6 +161,43 @@ typedef struct sac_header {
     uint8_t payload_size;
 } sac_header_t;
 
+#if SAC_ENABLE_PERF_STATS
+/** @brief Histogram of durations expressed in timestamp ticks.
+ *
+ *  Bins are logarithmic: each power of two is split into SAC_PERF_HISTOGRAM_SUB_BIN_COUNT linear bins, so a
+ *  percentile read from the histogram is within 1 / SAC_PERF_HISTOGRAM_SUB_BIN_COUNT of the real value.
+ */
+typedef struct sac_perf_histogram {
+    /*! Number of durations recorded. */
+    uint32_t count;
+    /*! Shortest duration recorded. */
+    uint32_t min;
+    /*! Longest duration recorded. */
+    uint32_t max;
+    /*! Sum of all durations recorded. */
+    uint64_t total;
+    /*! Number of durations recorded in each bin. */
+    uint32_t bins[SAC_PERF_HISTOGRAM_BIN_COUNT];
+} sac_perf_histogram_t;
+
+/** @brief Audio Core Pipeline Performance Statistics.
+ */
+typedef struct sac_perf_statistics {
+    /*! Execution time of the producer endpoint action. */
+    sac_perf_histogram_t produce;
+    /*! Execution time of the consumer endpoint action. */
+    sac_perf_histogram_t consume;
+    /*! Time between the enqueue of a packet in the producer queue and the start of its consumption. */
+    sac_perf_histogram_t latency;
+    /*! Highest number of audio packets in the producer queue. */
+    uint16_t producer_queue_high_water_mark;
+    /*! Highest number of processing nodes in use at the same time. */
+    uint16_t processing_queue_high_water_mark;
+    /*! Highest number of audio packets in the consumer queue. */
+    uint16_t consumer_queue_high_water_mark;
+} sac_perf_statistics_t;
+#endif
+
 /** @brief Processing Interface.
  */
 typedef struct sac_processing_interface {
@@ -141,6 +212,11 @@ typedef struct sac_processing_interface {
     /*! Function called by process_samples prior to process to determine if process will be executed or not. */
     bool (*gate)(sac_processing_t *process, sac_pipeline_t *pipeline, sac_header_t *header, uint8_t *data_in,
                  uint16_t size, sac_status_t *status);
+    /*! Optional function called by process_samples prior to process to determine if the stage can write its output
+     *  over its input. An in-place capable stage never outputs more bytes than it receives and leaves its input
+     *  untouched when it returns 0. NULL if the stage always needs a separate output buffer.
+     */
+    bool (*is_in_place)(void *instance);
 } sac_processing_interface_t;
 
 /** @brief Audio Core Processing.
@@ -154,6 +230,10 @@ typedef struct sac_processing {
     sac_processing_interface_t iface;
     /*! Pointer to the next processing state. */
     struct sac_processing *next_process;
+#if SAC_ENABLE_PERF_STATS
+    /*! Execution time of the processing stage. */
+    sac_perf_histogram_t _perf;
+#endif
 } sac_processing_t;
 
 /** @brief Endpoint Interface.
@@ -165,6 +245,22 @@ typedef struct sac_endpoint_interface {
     void (*start)(void *instance);
     /*! Function the audio core uses to stop any endpoint operations. */
     void (*stop)(void *instance);
+    /*! Optional, producer only. Function the audio core uses to access the oldest produced packet where the endpoint
+     *  stores it, instead of having action copy it in a queue node. Return NULL if no packet is available.
+     */
+    uint8_t *(*borrow)(void *instance, uint16_t *size);
+    /*! Optional, producer only. Function the audio core uses to hand back the packet returned by borrow. */
+    void (*give_back)(void *instance);
+    /*! Optional, consumer only. Function the audio core uses to get the endpoint buffer the last processing stage
+     *  renders the next packet into, instead of having action copy it from a queue node. Return NULL if the endpoint
+     *  is full or if its buffers can not hold size bytes.
+     */
+    uint8_t *(*get_buffer)(void *instance, uint16_t size);
+    /*! Optional, consumer only. Function the audio core uses to hand over the buffer returned by get_buffer once it is
+     *  filled. Return the number of bytes consumed. Every buffer returned by get_buffer is committed, with a size of 0
+     *  if the packet could not be rendered.
+     */
+    uint16_t (*commit)(void *instance, uint8_t *buffer, uint16_t size);
 } sac_endpoint_interface_t;
 
 /** @brief Add Audio Core Mixer's specific options when using pipelines to mix packets.
@@ -278,6 +374,10 @@ typedef struct sac_pipeline {
     sac_pipeline_cfg_t cfg;
     /*! SAC pipeline statistics. */
     sac_statistics_t _statistics;
+#if SAC_ENABLE_PERF_STATS
+    /*! SAC pipeline performance statistics. */
+    sac_perf_statistics_t _perf_statistics;
+#endif
     struct {
         /*! Internal: The number of audio packets to buffer before considering the initial buffering complete. */
         uint8_t buffering_threshold;
@@ -289,6 +389,8 @@ typedef struct sac_pipeline {
         uint32_t current_sample_count;
         /*! Internal: Used to track pending packets in the accumulator to be added to the CDC target queue length. */
         uint32_t pending_packets;
+        /*! Internal: Number of packets lent by the producer whose queue node was dropped on overflow. */
+        uint16_t lent_packets_to_discard;
     } _internal;
 } sac_pipeline_t;
 
@@ -309,6 +411,17 @@ void sac_init(sac_cfg_t cfg, sac_status_t *status);
  */
 void sac_mixer_init(sac_mixer_module_cfg_t cfg, sac_status_t *status);
 
+/** @brief Set the gain of a SAC Mixer Module input.
+ *
+ *  The inputs are mixed at unity gain, SAC_MIXER_GAIN_UNITY, until their gain is set.
+ *  SAC_MIXER_GAIN_AVERAGE(nb_of_inputs) outputs the average of the inputs instead.
+ *
+ *  @param[in]  input     Input index, the order of the producer endpoints of the mixer pipeline.
+ *  @param[in]  gain_q31  Gain, in Q1.31 format.
+ *  @param[out] status    Status code.
+ */
+void sac_mixer_set_input_gain(uint8_t input, int32_t gain_q31, sac_status_t *status);
+
 /** @brief Initialize a SAC pipeline.
  *
  *  @param[in]  name      Name of the pipeline.
@@ -462,6 +575,10 @@ uint32_t sac_processing_ctrl(sac_processing_t *sac_processing, sac_pipeline_t *p
                              sac_status_t *status);
 
 /** @brief Execute the Audio Core processing stages.
+ *
+ *  When the producer provides borrow and give_back, the first processing stage reads the packet where the producer
+ *  stores it. When the consumer provides get_buffer and commit, the last processing stage writes the packet into the
+ *  consumer buffer and the consumer queue is not used. Both only apply to a single endpoint outside of a mixer.
  *
  *  @param[in]  pipeline  Pipeline instance.
  *  @param[out] status    Status code.
@@ -489,6 +606,13 @@ void sac_pipeline_consume(sac_pipeline_t *pipeline, sac_status_t *status);
  */
 uint32_t sac_get_allocated_bytes(sac_status_t *status);
 
+/** @brief Get the usage statistics of the memory pool.
+ *
+ *  @param[out] stats   Memory pool usage statistics.
+ *  @param[out] status  Status code.
+ */
+void sac_get_memory_pool_stats(mem_pool_stats_t *stats, sac_status_t *status);
+
 /** @brief Copy data into a node.
  *
  *  @param[in]  dest_node  Node to copy data to.
@@ -0,0 +1,117 @@
+/** @file  sac_footprint.h
+ *  @brief SPARK Audio Core memory pool footprint.
+ *
+ *  Constant expressions giving the number of memory pool bytes the SAC allocates for a given configuration, so that
+ *  the pool given to sac_init() can be sized at compile time and checked against the configuration:
+ *
+ *      #define POOL_NEEDED (SAC_FOOTPRINT_PIPELINE(MAX_PAYLOAD) + 2 * SAC_FOOTPRINT_ENDPOINT +            \
+ *                           SAC_FOOTPRINT_PRODUCER_QUEUES(1, PRODUCER_PAYLOAD, PRODUCER_QUEUE_SIZE) +    \
+ *                           SAC_FOOTPRINT_CONSUMER_QUEUES(1, CONSUMER_PAYLOAD, CONSUMER_QUEUE_SIZE, false) + \
+ *                           SAC_FOOTPRINT_PROCESSING + SAC_CDC_PLL_FOOTPRINT + ...)
+ *      static uint8_t sac_memory_pool[SAC_FOOTPRINT_POOL_SIZE(POOL_NEEDED)];
+ *      SAC_FOOTPRINT_CHECK(sizeof(sac_memory_pool), POOL_NEEDED);
+ *
+ *  The footprint of a processing stage that allocates from the pool is given by the stage header, e.g.
+ *  SAC_CDC_FOOTPRINT(). The stages whose allocations depend on run time state, such as the sample rate converter and
+ *  the fallback, are to be measured with sac_get_memory_pool_stats().
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SAC_FOOTPRINT_H_
+#define SAC_FOOTPRINT_H_
+
+/* INCLUDES *******************************************************************/
+#include "mem_pool.h"
+#include "queue.h"
+#include "sac_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Node data inflation for the clock drift compensation to add samples. */
+#define SAC_CDC_QUEUE_DATA_SIZE_INFLATION (SAC_MAX_CHANNEL_COUNT * SAC_WORD_SIZE_BYTE)
+/*! Number of free nodes required to do audio processing. */
+#define SAC_PROCESSING_NODE_COUNT 2
+/*! Number of free nodes required for endpoint action. */
+#define SAC_EP_ACTION_NODE_COUNT 1
+/*! Number of free nodes required for audio process input. */
+#define SAC_PROCESS_INPUT_NODE_COUNT 1
+/*! Minimum number of queues in a system. */
+#define SAC_MIN_QUEUE_NUM 1
+
+/*! Pool bytes taken by an array of count elements of a type. */
+#define SAC_FOOTPRINT_ARRAY(type, count) MEM_POOL_BLOCK_SIZE(sizeof(type) * (count))
+
+/*! Pool size holding the given SAC footprint. */
+#define SAC_FOOTPRINT_POOL_SIZE(footprint) MEM_POOL_SIZE_NEEDED(footprint)
+
+/*! Fail the build if a pool of pool_size bytes does not hold the given SAC footprint. */
+#define SAC_FOOTPRINT_CHECK(pool_size, footprint) \
+    _Static_assert((pool_size) >= SAC_FOOTPRINT_POOL_SIZE(footprint), "SAC memory pool is too small")
+
+/*! Size of the node data holding an audio payload, timestamp, size, header and inflation included. */
+#define SAC_FOOTPRINT_NODE_DATA_SIZE_UNALIGNED(payload_size)                                              \
+    ((payload_size) + SAC_NODE_TIMESTAMP_VAR_SIZE + SAC_NODE_PAYLOAD_SIZE_VAR_SIZE + sizeof(sac_header_t) + \
+     SAC_CDC_QUEUE_DATA_SIZE_INFLATION)
+
+/*! Size of the node data holding an audio payload, nodes being aligned on 32 bits. */
+#define SAC_FOOTPRINT_NODE_DATA_SIZE(payload_size)         \
+    (SAC_FOOTPRINT_NODE_DATA_SIZE_UNALIGNED(payload_size) + \
+     sac_align_data_size(SAC_FOOTPRINT_NODE_DATA_SIZE_UNALIGNED(payload_size), uint32_t))
+
+/*! Footprint of a free queue of node_count nodes shared by num_queues queues. */
+#define SAC_FOOTPRINT_FREE_QUEUE(num_queues, node_count, payload_size)                                       \
+    (MEM_POOL_BLOCK_SIZE(QUEUE_NB_BYTES_NEEDED(num_queues, node_count, SAC_FOOTPRINT_NODE_DATA_SIZE(payload_size))) + \
+     SAC_FOOTPRINT_ARRAY(queue_t, 1))
+
+/*! Footprint of sac_pipeline_init() and of the processing queue allocated by sac_pipeline_setup(). */
+#define SAC_FOOTPRINT_PIPELINE(max_payload_size) \
+    (SAC_FOOTPRINT_ARRAY(sac_pipeline_t, 1) +     \
+     SAC_FOOTPRINT_FREE_QUEUE(SAC_MIN_QUEUE_NUM, SAC_PROCESSING_NODE_COUNT, max_payload_size))
+
+/*! Footprint of sac_endpoint_init(). */
+#define SAC_FOOTPRINT_ENDPOINT SAC_FOOTPRINT_ARRAY(sac_endpoint_t, 1)
+
+/*! Footprint of sac_processing_stage_init(). */
+#define SAC_FOOTPRINT_PROCESSING SAC_FOOTPRINT_ARRAY(sac_processing_t, 1)
+
+/*! Footprint of sac_mixer_init(). */
+#define SAC_FOOTPRINT_MIXER SAC_FOOTPRINT_ARRAY(sac_mixer_module_t, 1)
+
+/** @brief Footprint of the producer queues allocated by sac_pipeline_setup().
+ *
+ *  @param[in] endpoint_count      Number of chained producers.
+ *  @param[in] audio_payload_size  Audio payload size of the first producer.
+ *  @param[in] queue_size          Queue size of the first producer.
+ */
+#define SAC_FOOTPRINT_PRODUCER_QUEUES(endpoint_count, audio_payload_size, queue_size)                         \
+    (SAC_FOOTPRINT_FREE_QUEUE(endpoint_count,                                                                \
+                              (((queue_size) < SAC_MIN_PRODUCER_QUEUE_SIZE) ? SAC_MIN_PRODUCER_QUEUE_SIZE :   \
+                                                                              (queue_size)) +                 \
+                                  SAC_EP_ACTION_NODE_COUNT + SAC_PROCESS_INPUT_NODE_COUNT,                    \
+                              audio_payload_size) +                                                           \
+     (endpoint_count) * SAC_FOOTPRINT_ARRAY(queue_t, 1))
+
+/** @brief Footprint of the consumer queues allocated by sac_pipeline_setup().
+ *
+ *  @param[in] endpoint_count      Number of chained consumers.
+ *  @param[in] audio_payload_size  Audio payload size of the first consumer.
+ *  @param[in] queue_size          Queue size of the first consumer, plus the extra queue size set by its processing
+ *                                 stages.
+ *  @param[in] delayed_action      Delayed action setting of the first consumer.
+ */
+#define SAC_FOOTPRINT_CONSUMER_QUEUES(endpoint_count, audio_payload_size, queue_size, delayed_action)                \
+    (SAC_FOOTPRINT_FREE_QUEUE(endpoint_count, (queue_size) + ((delayed_action) ? SAC_EP_ACTION_NODE_COUNT : 0),      \
+                              audio_payload_size) +                                                                  \
+     (endpoint_count) * SAC_FOOTPRINT_ARRAY(queue_t, 1))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SAC_FOOTPRINT_H_ */
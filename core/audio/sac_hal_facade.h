@@ -77,6 +77,27 @@ int sac_facade_cdc_format_stats(char *buffer, uint16_t size, sac_status_t *statu
  */
 void facade_app_audio_cdc_set_target_queue_size(sac_pipeline_t *pipeline, uint8_t queue_size, sac_status_t *status);
 
+#if SAC_ENABLE_PERF_STATS
+/** @brief Initialize the time source used by the Audio Core performance statistics.
+ */
+void sac_facade_perf_init(void);
+
+/** @brief Get the current value of the performance statistics time source.
+ *
+ *  @note The time source must be free running and wrap around on 32 bits. A fine resolution,
+ *        like a CPU cycle counter, is required to measure processing stages.
+ *
+ *  @return Current timestamp in ticks.
+ */
+uint32_t sac_facade_perf_get_timestamp(void);
+
+/** @brief Get the frequency of the performance statistics time source.
+ *
+ *  @return Number of timestamp ticks per second.
+ */
+uint32_t sac_facade_perf_get_timestamp_frequency_hz(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,11 +11,16 @@
 
 /* INCLUDES *******************************************************************/
 #include "sac_api.h"
+#include "telemetry.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* CONSTANTS ******************************************************************/
+/*! Version of the TELEMETRY_RECORD_SAC_PIPELINE_STATS record. */
+#define SAC_TELEMETRY_PIPELINE_STATS_VERSION 1
+
 /* PUBLIC FUNCTION PROTOTYPES *************************************************/
 /** @brief Update the SPARK Audio Core pipeline statistics.
  *
@@ -40,6 +45,19 @@ sac_statistics_t *sac_pipeline_update_stats(sac_pipeline_t *pipeline, sac_status
  */
 int sac_pipeline_format_stats(sac_pipeline_t *pipeline, char *buffer, uint16_t size, sac_status_t *status);
 
+/** @brief Add the pipeline statistics to a telemetry frame.
+ *
+ *  The statistics last computed by sac_pipeline_update_stats() are added as a TELEMETRY_RECORD_SAC_PIPELINE_STATS
+ *  record holding every sac_statistics_t field in declaration order.
+ *
+ *  @param[in]  pipeline   Pipeline instance.
+ *  @param[in]  telemetry  Telemetry instance, with a frame started.
+ *  @param[in]  instance   Record instance, identifies the pipeline in the telemetry stream.
+ *  @param[out] status     Status code.
+ */
+void sac_pipeline_add_stats_telemetry(sac_pipeline_t *pipeline, telemetry_t *telemetry, uint8_t instance,
+                                      sac_status_t *status);
+
 /** @brief Get producer buffer load.
  *
  *  @param[in]  pipeline  Pipeline instance.
@@ -103,6 +121,63 @@ uint32_t sac_pipeline_get_consumer_queue_peak_buffer_load(sac_pipeline_t *pipeli
  */
 void sac_pipeline_reset_stats(sac_pipeline_t *pipeline, sac_status_t *status);
 
+#if SAC_ENABLE_PERF_STATS
+/** @brief Get the SPARK Audio Core pipeline performance statistics.
+ *
+ *  Durations are expressed in ticks of the time source provided by sac_facade_perf_get_timestamp().
+ *  The execution time of each processing stage is available with sac_processing_get_perf_stats().
+ *
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[out] status    Status code.
+ *  @return Reference to the performance statistics.
+ */
+sac_perf_statistics_t *sac_pipeline_get_perf_stats(sac_pipeline_t *pipeline, sac_status_t *status);
+
+/** @brief Get the execution time histogram of a processing stage.
+ *
+ *  @param[in]  process  Processing stage instance.
+ *  @param[out] status   Status code.
+ *  @return Reference to the execution time histogram.
+ */
+sac_perf_histogram_t *sac_processing_get_perf_stats(sac_processing_t *process, sac_status_t *status);
+
+/** @brief Format the pipeline performance statistics as a string of characters.
+ *
+ *  The output has one line per histogram (producer, consumer, every processing stage and
+ *  latency) followed by the queue high-water marks. It is meant to be printed after the
+ *  output of sac_pipeline_format_stats().
+ *
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[out] buffer    Buffer where to put the formatted string.
+ *  @param[in]  size      Size of the buffer.
+ *  @param[out] status    Status code.
+ *  @return The formatted string length, excluding the NULL terminator.
+ */
+int sac_pipeline_format_perf_stats(sac_pipeline_t *pipeline, char *buffer, uint16_t size, sac_status_t *status);
+
+/** @brief Reset the SPARK Audio Core pipeline and processing stages performance statistics.
+ *
+ *  @param[in]  pipeline  Pipeline instance.
+ *  @param[out] status    Status code.
+ */
+void sac_pipeline_reset_perf_stats(sac_pipeline_t *pipeline, sac_status_t *status);
+
+/** @brief Add a duration to a performance histogram.
+ *
+ *  @param[in] histogram  Histogram to update.
+ *  @param[in] duration   Duration in timestamp ticks.
+ */
+void sac_perf_histogram_record(sac_perf_histogram_t *histogram, uint32_t duration);
+
+/** @brief Get a percentile of the durations recorded in a performance histogram.
+ *
+ *  @param[in] histogram  Histogram to read.
+ *  @param[in] percent    Percentile to get, from 1 to 100.
+ *  @return Upper bound of the bin holding the percentile, never more than the longest duration recorded.
+ */
+uint32_t sac_perf_histogram_get_percentile(const sac_perf_histogram_t *histogram, uint8_t percent);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,12 +11,17 @@
 #include "swc_api.h"
 #include <stdio.h>
 #include "mem_pool.h"
+#include "spsc_queue.h"
 #include "swc_error.h"
+#include "swc_footprint.h"
 #include "swc_hal_facade.h"
 #include "swc_utils.h"
 #if !WPS_DISABLE_FRAGMENTATION
 #include "wps_frag.h"
 #endif
+#if !WPS_DISABLE_AGGREGATION
+#include "wps_aggr.h"
+#endif
 #include "sr_phy_hal.h"
 #include "wps_stats.h"
 
@@ -36,11 +41,6 @@
 #define WPS_DEFAULT_SFD_LEN SFD_LENGTH_32_OOK
 #endif
 
-/*! Default callback queue size margin. */
-#ifndef WPS_QUEUE_MARGIN
-#define WPS_QUEUE_MARGIN 5
-#endif
-
 /*! Default frequency shift setting. */
 #ifndef WPS_DEFAULT_FREQ_SHIFT
 #define WPS_DEFAULT_FREQ_SHIFT false /* Not yet supported */
@@ -127,10 +127,6 @@
 #define WPS_DEFAULT_SYNC_FRAME_LOST_MAX_DURATION ((uint32_t)409600) /* 409600 PLL cycles = 20 ms */
 #endif
 
-#ifndef WPS_DEFAULT_REQUEST_MEMORY_SIZE
-#define WPS_DEFAULT_REQUEST_MEMORY_SIZE 5
-#endif
-
 /*! Default number of tries deadline for the Stop-and-Wait ARQ */
 #ifndef WPS_DEFAULT_TRY_DEADLINE
 #define WPS_DEFAULT_TRY_DEADLINE 0
@@ -246,8 +242,6 @@
 #define PULSE_GAIN_MAX 7
 /*! Maximal clear channel assessment threshold. */
 #define CCA_THRESH_MAX 115
-/*! The radio's maximum payload size is 256, one byte must be reserved for the header size. */
-#define FRAME_SIZE_MAX 255
 /*! The minimum queue size required for WPS to enable parallel processing. */
 #define WPS_MIN_QUEUE_SIZE 2
 /*! Maximum number of allowed timeslot in the schedule based off MAC header space. */
@@ -342,6 +336,10 @@ static bool is_channel_supported(uint8_t frequency);
 static uint32_t get_phy_rate_factor(chip_rate_cfg_t chip_rate);
 #endif
 static void update_node_max_header_size(void);
+static void send_segments(wps_connection_t *const wps_conn_handle, const wps_payload_segment_t *const segments,
+                          uint8_t segment_count, wps_error_t *const wps_err);
+static wps_rx_frame read_payload_to_buffer(wps_connection_t *const wps_conn_handle, uint8_t *const payload,
+                                           uint16_t size, wps_error_t *const wps_err);
 static void update_node_max_ack_header_size(void);
 static rf_channel_t ***allocate_fallback_channel(uint8_t fallback_mode_count, swc_error_t *err);
 
@@ -376,6 +374,7 @@ void swc_init(swc_cfg_t cfg, swc_node_cfg_t node_cfg, void (*callback)(void), sw
 
     memset(&wps, 0, sizeof(wps_t));
     mem_pool_init(&mem_pool, cfg.memory_pool, (size_t)cfg.memory_pool_size);
+    mem_pool_set_name(&mem_pool, "swc");
 
     /* Links the necessary functions to allow the wireless core interact with the radio. */
     swc_config_hardware_interface();
@@ -460,6 +459,9 @@ void swc_init(swc_cfg_t cfg, swc_node_cfg_t node_cfg, void (*callback)(void), sw
     wps_init_rdo(&wps, WPS_DEFAULT_RDO_ROLLOVER_VAL, WPS_DEFAULT_RDO_STEP_MS, &wps_err);
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
 
+    wps_disable_dynamic_allocation(&wps, &wps_err);
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
+
     wps_enable_random_channel_sequence(&wps, &wps_err);
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
 
@@ -550,6 +552,27 @@ void swc_set_fast_sync(bool enabled, swc_error_t *const err)
 #endif
 }
 
+void swc_set_dynamic_allocation(const int32_t *const timeslot_id, uint8_t timeslot_count, swc_error_t *const err)
+{
+    wps_error_t wps_err = WPS_NO_ERROR;
+    uint8_t wps_timeslot_id[LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT];
+
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR(is_started, err, SWC_ERR_CHANGING_CONFIG_WHILE_RUNNING, return);
+    CHECK_ERROR(IS_NODE_UNINITIALIZED(), err, SWC_ERR_NODE_NOT_INITIALIZED, return);
+    CHECK_ERROR(timeslot_id == NULL, err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(timeslot_count > LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT, err, SWC_ERR_DYNAMIC_ALLOCATION, return);
+
+    for (uint8_t i = 0; i < timeslot_count; i++) {
+        CHECK_ERROR(timeslot_id[i] & BIT_AUTO_REPLY_TIMESLOT, err, SWC_ERR_DYNAMIC_ALLOCATION, return);
+        wps_timeslot_id[i] = (uint8_t)(timeslot_id[i] & TIMESLOT_VALUE_MASK);
+    }
+
+    wps_set_dynamic_allocation(&wps, wps_timeslot_id, timeslot_count, &wps_err);
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_DYNAMIC_ALLOCATION, return);
+}
+
 void swc_set_certification_mode(bool enabled, swc_error_t *const err)
 {
     CHECK_ERROR(is_started, err, SWC_ERR_CHANGING_CONFIG_WHILE_RUNNING, return);
@@ -960,7 +983,7 @@ swc_connection_t *swc_connection_init(swc_connection_cfg_t cfg, swc_error_t *con
         .connection_id = WPS_DEFAULT_CONNECTION_ID,
         .dynamic_phy_mode = ((!is_rx_conn && is_coord) || (is_rx_conn && !is_coord)) && wps.mac.dynamic_phy_mode_en,
     };
-    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, cfg.max_payload_size, FRAME_SIZE_MAX, &wps_err);
+    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, cfg.max_payload_size, SWC_FRAME_SIZE_MAX, &wps_err);
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_PAYLOAD_TOO_BIG, return NULL);
 
     header_size = conn->wps_conn_handle->cfg.header_size;
@@ -1279,6 +1302,13 @@ void swc_connection_set_tx_success_callback(swc_connection_t *const conn, void (
                 SWC_ERR_INVALID_OPERATION_AFTER_SETUP, return);
     wps_error_t wps_err = WPS_NO_ERROR;
 
+#if !WPS_DISABLE_AGGREGATION
+    if (conn->wps_conn_handle->aggr.enabled) {
+        wps_aggr_set_tx_success_callback(conn->wps_conn_handle, cb, arg, &wps_err);
+        CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_FAILED_TO_SET_CALLBACK, return);
+        return;
+    }
+#endif
 #if !WPS_DISABLE_FRAGMENTATION
     if (conn->wps_conn_handle->frag.enabled) {
         wps_frag_set_tx_success_callback(conn->wps_conn_handle, cb, arg, &wps_err);
@@ -1338,6 +1368,12 @@ void swc_connection_set_rx_success_callback(swc_connection_t *const conn, void (
                 SWC_ERR_INVALID_OPERATION_AFTER_SETUP, return);
     wps_error_t wps_err = WPS_NO_ERROR;
 
+#if !WPS_DISABLE_AGGREGATION
+    if (conn->wps_conn_handle->aggr.enabled) {
+        wps_aggr_set_rx_success_callback(conn->wps_conn_handle, cb, arg);
+        return;
+    }
+#endif
 #if !WPS_DISABLE_FRAGMENTATION
     if (conn->wps_conn_handle->frag.enabled) {
         wps_frag_set_rx_success_callback(conn->wps_conn_handle, cb, arg);
@@ -1409,6 +1445,9 @@ void swc_connection_set_fragmentation(const swc_connection_t *const conn, swc_er
     CHECK_ERROR((conn == NULL), err, SWC_ERR_NULL_PTR, return);
     CHECK_ERROR((conn->cfg.queue_size < WPS_MIN_QUEUE_SIZE), err, SWC_ERR_MIN_QUEUE_SIZE, return);
     CHECK_ERROR(IS_SWC_CONN_LOCKED(conn), err, SWC_ERR_INVALID_OPERATION_AFTER_SWC_LOCK, return);
+#if !WPS_DISABLE_AGGREGATION
+    CHECK_ERROR(conn->wps_conn_handle->aggr.enabled, err, SWC_ERR_AGGREGATION_NOT_SUPPORTED, return);
+#endif
 
     wps_error_t wps_err = WPS_NO_ERROR;
     uint16_t *frag_tx_meta_buffer = mem_pool_malloc(&mem_pool, sizeof(uint16_t) * conn->cfg.queue_size);
@@ -1417,6 +1456,97 @@ void swc_connection_set_fragmentation(const swc_connection_t *const conn, swc_er
     wps_frag_init(conn->wps_conn_handle, (void *)frag_tx_meta_buffer, conn->cfg.queue_size, &wps_err);
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
 }
+
+void swc_connection_set_fragmentation_resume(const swc_connection_t *const conn,
+                                             const swc_connection_t *const feedback_conn, uint16_t max_payload_size,
+                                             swc_error_t *const err)
+{
+    *err = SWC_ERR_NONE;
+    CHECK_ERROR(is_started, err, SWC_ERR_CHANGING_CONFIG_WHILE_RUNNING, return);
+    CHECK_ERROR((conn == NULL) || (feedback_conn == NULL), err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(IS_SWC_CONN_LOCKED(conn), err, SWC_ERR_INVALID_OPERATION_AFTER_SWC_LOCK, return);
+    CHECK_ERROR((conn->wps_conn_handle->is_tx_connection == feedback_conn->wps_conn_handle->is_tx_connection), err,
+                SWC_ERR_INVALID_PARAMETER, return);
+
+    wps_error_t wps_err = WPS_NO_ERROR;
+    uint8_t *frame_buffer = mem_pool_malloc(&mem_pool, max_payload_size);
+
+    CHECK_ERROR(frame_buffer == NULL, err, SWC_ERR_NOT_ENOUGH_MEMORY, return);
+    wps_frag_enable_resume(conn->wps_conn_handle, feedback_conn->wps_conn_handle, frame_buffer, max_payload_size,
+                           &wps_err);
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INVALID_PARAMETER, return);
+}
+
+void swc_connection_poll_fragmentation(const swc_connection_t *const conn, swc_error_t *const err)
+{
+    wps_error_t wps_err = WPS_NO_ERROR;
+
+    *err = SWC_ERR_NONE;
+    CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(!conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_TX_CONN_ACTION_ON_RX_CONN, return);
+
+    wps_frag_poll(conn->wps_conn_handle, &wps_err);
+    if (wps_err == WPS_QUEUE_FULL_ERROR) {
+        *err = SWC_WARN_SEND_QUEUE_FULL;
+    } else if (wps_err != WPS_NO_ERROR) {
+        *err = SWC_ERR_INVALID_PARAMETER;
+    }
+}
+
+void swc_connection_abort_fragmentation(const swc_connection_t *const conn, swc_error_t *const err)
+{
+    *err = SWC_ERR_NONE;
+    CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(!conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_TX_CONN_ACTION_ON_RX_CONN, return);
+
+    wps_frag_abort(conn->wps_conn_handle);
+}
+#endif
+
+#if !WPS_DISABLE_AGGREGATION
+void swc_connection_set_aggregation(const swc_connection_t *const conn, uint32_t max_hold_time_ms,
+                                    swc_error_t *const err)
+{
+    *err = SWC_ERR_NONE;
+    CHECK_ERROR(is_started, err, SWC_ERR_CHANGING_CONFIG_WHILE_RUNNING, return);
+    CHECK_ERROR((conn == NULL), err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(IS_SWC_CONN_LOCKED(conn), err, SWC_ERR_INVALID_OPERATION_AFTER_SWC_LOCK, return);
+#if !WPS_DISABLE_FRAGMENTATION
+    CHECK_ERROR(conn->wps_conn_handle->frag.enabled, err, SWC_ERR_FRAGMENTATION_NOT_SUPPORTED, return);
+#endif
+
+    wps_error_t wps_err = WPS_NO_ERROR;
+    uint32_t max_hold_time = (uint64_t)swc_hal_get_free_running_timer_frequency_hz() * max_hold_time_ms / 1000;
+
+    wps_aggr_init(conn->wps_conn_handle, max_hold_time, &wps_err);
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INVALID_PARAMETER, return);
+}
+
+void swc_connection_flush_aggregation(const swc_connection_t *const conn, swc_error_t *const err)
+{
+    wps_error_t wps_err = WPS_NO_ERROR;
+
+    *err = SWC_ERR_NONE;
+    CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(!conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_TX_CONN_ACTION_ON_RX_CONN, return);
+    CHECK_ERROR(!conn->wps_conn_handle->aggr.enabled, err, SWC_ERR_INVALID_PARAMETER, return);
+
+    wps_aggr_flush(conn->wps_conn_handle, &wps_err);
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
+}
+
+void swc_connection_process_aggregation(const swc_connection_t *const conn, swc_error_t *const err)
+{
+    wps_error_t wps_err = WPS_NO_ERROR;
+
+    *err = SWC_ERR_NONE;
+    CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(!conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_TX_CONN_ACTION_ON_RX_CONN, return);
+    CHECK_ERROR(!conn->wps_conn_handle->aggr.enabled, err, SWC_ERR_INVALID_PARAMETER, return);
+
+    wps_aggr_process(conn->wps_conn_handle, &wps_err);
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
+}
 #endif
 
 void swc_connection_set_acknowledgement(const swc_connection_t *const conn, bool enabled, swc_error_t *const err)
@@ -1473,7 +1603,7 @@ void swc_connection_set_credit_flow_ctrl(const swc_connection_t *const conn, boo
 
     hdr_cfg.connection_id = enabled;
     hdr_cfg.credit_fc_enabled = enabled;
-    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, conn->cfg.max_payload_size, FRAME_SIZE_MAX, &wps_err);
+    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, conn->cfg.max_payload_size, SWC_FRAME_SIZE_MAX, &wps_err);
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_PAYLOAD_TOO_BIG, return);
 
     /* Validate credit flow control auto reply connection requirement */
@@ -1501,6 +1631,41 @@ void swc_connection_set_credit_flow_ctrl(const swc_connection_t *const conn, boo
     update_node_max_ack_header_size();
 }
 
+void swc_connection_set_dynamic_allocation(const swc_connection_t *const conn, swc_error_t *const err)
+{
+    wps_error_t wps_err = WPS_NO_ERROR;
+
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR(is_started, err, SWC_ERR_CHANGING_CONFIG_WHILE_RUNNING, return);
+    CHECK_ERROR(IS_NODE_UNINITIALIZED(), err, SWC_ERR_NODE_NOT_INITIALIZED, return);
+    CHECK_ERROR((conn == NULL), err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(!wps.mac.dynamic_alloc.enable, err, SWC_ERR_DYNAMIC_ALLOCATION, return);
+    CHECK_ERROR(IS_SWC_CONN_LOCKED(conn), err, SWC_ERR_INVALID_OPERATION_AFTER_SWC_LOCK, return);
+
+    bool is_coord = (wps.node.cfg.role == NETWORK_COORDINATOR);
+    bool is_rx_conn = is_rx_connection(conn->wps_conn_handle);
+    wps_header_cfg_t hdr_cfg = wps_get_header_cfg(conn->wps_conn_handle);
+
+    if (is_coord != is_rx_conn) {
+        /* Connection from the coordinator, it carries the allocation map */
+        hdr_cfg.dynamic_alloc_map_enabled = true;
+    } else {
+        /* Connection to the coordinator, it carries the number of frames waiting on the node */
+        hdr_cfg.queue_depth_enabled = true;
+        if (is_coord) {
+            wps_add_dynamic_allocation_node(&wps, conn->wps_conn_handle->cfg.source_address, &wps_err);
+            CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_DYNAMIC_ALLOCATION, return);
+        }
+    }
+    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, conn->cfg.max_payload_size, SWC_FRAME_SIZE_MAX, &wps_err);
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_PAYLOAD_TOO_BIG, return);
+
+    /* Iterate through each connection to update max header size if applicable */
+    update_node_max_header_size();
+    update_node_max_ack_header_size();
+}
+
 void swc_connection_set_retransmission(const swc_connection_t *const conn, bool enabled, uint32_t try_deadline,
                                        uint32_t time_deadline, swc_error_t *const err)
 {
@@ -1523,6 +1688,65 @@ void swc_connection_set_retransmission(const swc_connection_t *const conn, bool
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
 }
 
+void swc_connection_set_retransmission_window(const swc_connection_t *const conn, uint8_t window_size,
+                                              swc_error_t *const err)
+{
+    wps_error_t wps_err = WPS_NO_ERROR;
+    bool sr_arq_enabled = (window_size > 1);
+
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR(is_started, err, SWC_ERR_CHANGING_CONFIG_WHILE_RUNNING, return);
+    CHECK_ERROR(IS_NODE_UNINITIALIZED(), err, SWC_ERR_NODE_NOT_INITIALIZED, return);
+    CHECK_ERROR((conn == NULL), err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(sr_arq_enabled && !conn->wps_conn_handle->ack_enable, err, SWC_ERR_ARQ_WITH_ACK_DISABLED, return);
+    CHECK_ERROR(sr_arq_enabled && !has_main_timeslot(conn->cfg.timeslot_id, conn->cfg.timeslot_count), err,
+                SWC_ERR_NO_MAIN_TIMESLOT, return);
+    CHECK_ERROR((window_size == 0) || (window_size > LINK_SR_ARQ_WINDOW_SIZE_MAX), err, SWC_ERR_ARQ_WINDOW_SIZE,
+                return);
+    CHECK_ERROR(IS_SWC_CONN_LOCKED(conn), err, SWC_ERR_INVALID_OPERATION_AFTER_SWC_LOCK, return);
+
+    if (sr_arq_enabled) {
+        /* The ACK bitmap is carried in the ACK frame header. */
+        conn->wps_conn_handle->ack_frame_enable = true;
+        if (conn->wps_conn_handle->auto_link_protocol == NULL) {
+            link_protocol_t *auto_link_protocol = mem_pool_malloc(&mem_pool, sizeof(link_protocol_t));
+
+            CHECK_ERROR(auto_link_protocol == NULL, err, SWC_ERR_NOT_ENOUGH_MEMORY, return);
+            conn->wps_conn_handle->auto_link_protocol = auto_link_protocol;
+        }
+        /* Reorder buffer holding the frames received out of order, a payload is written before it is read. The memory
+         * pool can not free it, so it is kept when selective repeat is disabled and reused while it is large enough.
+         */
+        uint8_t *reorder_buffer = conn->wps_conn_handle->sr_arq_rx_payload;
+
+        if ((reorder_buffer == NULL) || (conn->wps_conn_handle->sr_arq_rx_slot_count < window_size)) {
+            reorder_buffer = mem_pool_malloc_no_zero(&mem_pool, window_size * conn->wps_conn_handle->payload_size);
+            CHECK_ERROR(reorder_buffer == NULL, err, SWC_ERR_NOT_ENOUGH_MEMORY, return);
+            conn->wps_conn_handle->sr_arq_rx_payload = reorder_buffer;
+            conn->wps_conn_handle->sr_arq_rx_slot_count = window_size;
+        }
+        wps_connection_enable_selective_repeat_arq(conn->wps_conn_handle, window_size, reorder_buffer, &wps_err);
+    } else {
+        wps_connection_disable_selective_repeat_arq(conn->wps_conn_handle, &wps_err);
+    }
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
+
+    wps_header_cfg_t hdr_cfg = wps_get_header_cfg(conn->wps_conn_handle);
+
+    hdr_cfg.sr_arq_enabled = sr_arq_enabled;
+    /* The ACK field is matched to its connection by ID. Other features may need the ID, so it is never cleared here. */
+    if (sr_arq_enabled) {
+        hdr_cfg.connection_id = true;
+    }
+    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, conn->cfg.max_payload_size, SWC_FRAME_SIZE_MAX, &wps_err);
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_PAYLOAD_TOO_BIG, return);
+
+    /* Iterate through each connection to update max header size if applicable */
+    update_node_max_header_size();
+    update_node_max_ack_header_size();
+}
+
 void swc_connection_set_throttling_active_ratio(const swc_connection_t *const conn, uint8_t active_ratio,
                                                 swc_error_t *const err)
 {
@@ -1619,7 +1843,7 @@ void swc_connection_set_connection_priority(swc_connection_t *const conn, uint8_
     wps_header_cfg_t hdr_cfg = wps_get_header_cfg(conn->wps_conn_handle);
 
     hdr_cfg.connection_id = true;
-    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, conn->cfg.max_payload_size, FRAME_SIZE_MAX, &wps_err);
+    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, conn->cfg.max_payload_size, SWC_FRAME_SIZE_MAX, &wps_err);
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_PAYLOAD_TOO_BIG, return);
 
     wps_connection_set_timeslot_priority(conn->wps_conn_handle, &wps, conn->cfg.timeslot_id, conn->cfg.timeslot_count,
@@ -1654,7 +1878,7 @@ void swc_connection_set_connection_slots_priority(swc_connection_t *const conn,
     wps_header_cfg_t hdr_cfg = wps_get_header_cfg(conn->wps_conn_handle);
 
     hdr_cfg.connection_id = true;
-    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, conn->cfg.max_payload_size, FRAME_SIZE_MAX, &wps_err);
+    wps_set_header_cfg(&wps, conn->wps_conn_handle, hdr_cfg, conn->cfg.max_payload_size, SWC_FRAME_SIZE_MAX, &wps_err);
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_PAYLOAD_TOO_BIG, return);
 
     wps_connection_set_timeslot_priority(conn->wps_conn_handle, &wps, conn->cfg.timeslot_id, conn->cfg.timeslot_count,
@@ -1699,6 +1923,50 @@ void swc_connection_set_concurrency_cfg(const swc_connection_t *const conn,
 #endif
 }
 
+void swc_connection_set_adaptive_cca(const swc_connection_t *const conn, bool enabled, swc_error_t *const err)
+{
+    wps_error_t wps_err = WPS_NO_ERROR;
+
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR(is_started, err, SWC_ERR_CHANGING_CONFIG_WHILE_RUNNING, return);
+    CHECK_ERROR(IS_NODE_UNINITIALIZED(), err, SWC_ERR_NODE_NOT_INITIALIZED, return);
+    CHECK_ERROR((conn == NULL), err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(enabled && !conn->wps_conn_handle->cca.enable, err, SWC_ERR_CCA_INVALID_PARAMETERS, return);
+    CHECK_ERROR(enabled && !has_main_timeslot(conn->cfg.timeslot_id, conn->cfg.timeslot_count), err,
+                SWC_ERR_NO_MAIN_TIMESLOT, return);
+    CHECK_ERROR(IS_SWC_CONN_LOCKED(conn), err, SWC_ERR_INVALID_OPERATION_AFTER_SWC_LOCK, return);
+
+    if (enabled) {
+        link_cca_adaptive_channel_t *channel_buffer = conn->wps_conn_handle->cca_adaptive.channel;
+
+        if (channel_buffer == NULL) {
+            channel_buffer = mem_pool_malloc(&mem_pool, conn->wps_conn_handle->max_channel_count *
+                                                            sizeof(link_cca_adaptive_channel_t));
+            CHECK_ERROR(channel_buffer == NULL, err, SWC_ERR_NOT_ENOUGH_MEMORY, return);
+        }
+        /* Seed with the device address so that co-located devices draw different retry times. */
+        wps_connection_enable_adaptive_cca(conn->wps_conn_handle, channel_buffer,
+                                           ((uint32_t)wps.node.cfg.local_address << 16) | conn->cfg.source_address,
+                                           &wps_err);
+    } else {
+        wps_connection_disable_adaptive_cca(conn->wps_conn_handle, &wps_err);
+    }
+    CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
+}
+
+uint8_t swc_connection_get_channel_busy_ratio(const swc_connection_t *const conn, uint8_t channel_index,
+                                              swc_error_t *const err)
+{
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR((conn == NULL), err, SWC_ERR_NULL_PTR, return 0);
+    CHECK_ERROR(channel_index >= conn->wps_conn_handle->max_channel_count, err, SWC_ERR_CHANNEL_OUT_OF_RANGE,
+                return 0);
+
+    return link_cca_adaptive_get_busy_ratio(&conn->wps_conn_handle->cca_adaptive, channel_index);
+}
+
 void swc_connection_set_fallback_cfg(swc_connection_t *const conn, const swc_connection_fallback_cfg_t *const cfg,
                                      swc_error_t *const err)
 {
@@ -1810,6 +2078,9 @@ void swc_connection_get_payload_buffer(const swc_connection_t *const conn, uint8
     CHECK_ERROR(!conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_TX_CONN_ACTION_ON_RX_CONN, return);
 #if !WPS_DISABLE_FRAGMENTATION
     CHECK_ERROR((conn->wps_conn_handle->frag.enabled), err, SWC_ERR_FRAGMENTATION_NOT_SUPPORTED, return);
+#endif
+#if !WPS_DISABLE_AGGREGATION
+    CHECK_ERROR((conn->wps_conn_handle->aggr.enabled), err, SWC_ERR_AGGREGATION_NOT_SUPPORTED, return);
 #endif
     wps_get_free_slot(conn->wps_conn_handle, payload_buffer, conn->cfg.max_payload_size, &wps_err);
     if (wps_err != WPS_NO_ERROR) {
@@ -1830,6 +2101,9 @@ void swc_connection_allocate_payload_buffer(const swc_connection_t *const conn,
     CHECK_ERROR(!conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_TX_CONN_ACTION_ON_RX_CONN, return);
 #if !WPS_DISABLE_FRAGMENTATION
     CHECK_ERROR((conn->wps_conn_handle->frag.enabled), err, SWC_ERR_FRAGMENTATION_NOT_SUPPORTED, return);
+#endif
+#if !WPS_DISABLE_AGGREGATION
+    CHECK_ERROR((conn->wps_conn_handle->aggr.enabled), err, SWC_ERR_AGGREGATION_NOT_SUPPORTED, return);
 #endif
     CHECK_ERROR((payload_size == 0 || payload_size > conn->cfg.max_payload_size), err, SWC_ERR_INVALID_PARAMETER,
                 return);
@@ -1846,22 +2120,43 @@ void swc_connection_allocate_payload_buffer(const swc_connection_t *const conn,
 
 void swc_connection_send(const swc_connection_t *const conn, const uint8_t *const payload_buffer, uint16_t size,
                          swc_error_t *const err)
+{
+    swc_payload_segment_t segment = {
+        .payload = payload_buffer,
+        .size = size,
+    };
+
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR(payload_buffer == NULL, err, SWC_ERR_NULL_PTR, return);
+
+    swc_connection_sendv(conn, &segment, 1, err);
+}
+
+void swc_connection_sendv(const swc_connection_t *const conn, const swc_payload_segment_t *const segments,
+                          uint8_t segment_count, swc_error_t *const err)
 {
     wps_error_t wps_err = WPS_NO_ERROR;
 
     *err = SWC_ERR_NONE;
 
-    CHECK_ERROR((conn == NULL) || (payload_buffer == NULL), err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR((conn == NULL) || (segments == NULL), err, SWC_ERR_NULL_PTR, return);
     CHECK_ERROR(!conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_TX_CONN_ACTION_ON_RX_CONN, return);
+    CHECK_ERROR(segment_count == 0, err, SWC_ERR_INVALID_PARAMETER, return);
+    /* A single segment is referenced by the queue like with swc_connection_send(), others are copied. */
+    CHECK_ERROR((segment_count == 1) && (segments[0].payload == NULL), err, SWC_ERR_NULL_PTR, return);
+    for (uint8_t i = 0; i < segment_count; i++) {
+        CHECK_ERROR((segments[i].payload == NULL) && (segments[i].size != 0), err, SWC_ERR_NULL_PTR, return);
+    }
 
 #if !WPS_DISABLE_FRAGMENTATION
     if (!conn->wps_conn_handle->frag.enabled) {
-        wps_send(conn->wps_conn_handle, payload_buffer, size, &wps_err);
+        send_segments(conn->wps_conn_handle, segments, segment_count, &wps_err);
     } else {
-        wps_frag_send(conn->wps_conn_handle, payload_buffer, size, &wps_err);
+        wps_frag_sendv(conn->wps_conn_handle, segments, segment_count, &wps_err);
     }
 #else
-    wps_send(conn->wps_conn_handle, payload_buffer, size, &wps_err);
+    send_segments(conn->wps_conn_handle, segments, segment_count, &wps_err);
 #endif
 
     if (wps_err == WPS_WRONG_TX_SIZE_ERROR) {
@@ -1891,7 +2186,15 @@ uint16_t swc_connection_receive(const swc_connection_t *const conn, uint8_t **co
 #if !WPS_DISABLE_FRAGMENTATION
     CHECK_ERROR((conn->wps_conn_handle->frag.enabled), err, SWC_ERR_FRAGMENTATION_NOT_SUPPORTED, return 0);
 #endif
+#if !WPS_DISABLE_AGGREGATION
+    if (conn->wps_conn_handle->aggr.enabled) {
+        frame = wps_aggr_read(conn->wps_conn_handle, &wps_err);
+    } else {
+        frame = wps_read(conn->wps_conn_handle, &wps_err);
+    }
+#else
     frame = wps_read(conn->wps_conn_handle, &wps_err);
+#endif
     if (wps_err != WPS_NO_ERROR) {
         *err = SWC_ERR_RECEIVE_QUEUE_EMPTY;
         *payload = NULL;
@@ -1912,6 +2215,13 @@ uint16_t swc_connection_receive_get_payload_size(const swc_connection_t *const c
     CHECK_ERROR((conn == NULL), err, SWC_ERR_NULL_PTR, return 0);
     CHECK_ERROR(conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_RX_CONN_ACTION_ON_TX_CONN, return 0);
 
+#if !WPS_DISABLE_AGGREGATION
+    if (conn->wps_conn_handle->aggr.enabled) {
+        payload_size = wps_aggr_get_read_payload_size(conn->wps_conn_handle, &wps_err);
+        CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_RECEIVE_QUEUE_EMPTY, return 0);
+        return payload_size;
+    }
+#endif
 #if !WPS_DISABLE_FRAGMENTATION
     if (conn->wps_conn_handle->frag.enabled) {
         payload_size = wps_frag_get_read_payload_size(conn->wps_conn_handle, &wps_err);
@@ -1939,7 +2249,15 @@ void swc_connection_receive_complete(const swc_connection_t *const conn, swc_err
     CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return);
     CHECK_ERROR(conn->wps_conn_handle->is_tx_connection, err, SWC_ERR_RX_CONN_ACTION_ON_TX_CONN, return);
 
+#if !WPS_DISABLE_AGGREGATION
+    if (conn->wps_conn_handle->aggr.enabled) {
+        wps_aggr_read_done(conn->wps_conn_handle, &wps_err);
+    } else {
+        wps_read_done(conn->wps_conn_handle, &wps_err);
+    }
+#else
     wps_read_done(conn->wps_conn_handle, &wps_err);
+#endif
 
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_RECEIVE_QUEUE_EMPTY, return);
 }
@@ -1969,10 +2287,10 @@ uint16_t swc_connection_receive_to_buffer(const swc_connection_t *const conn, ui
     if (conn->wps_conn_handle->frag.enabled) {
         frame = wps_frag_read(conn->wps_conn_handle, payload, size, &wps_err);
     } else {
-        frame = wps_read_to_buffer(conn->wps_conn_handle, payload, size, &wps_err);
+        frame = read_payload_to_buffer(conn->wps_conn_handle, payload, size, &wps_err);
     }
 #else
-    frame = wps_read_to_buffer(conn->wps_conn_handle, payload, size, &wps_err);
+    frame = read_payload_to_buffer(conn->wps_conn_handle, payload, size, &wps_err);
 #endif
 
     if (wps_err == WPS_WRONG_RX_SIZE_ERROR) {
@@ -1994,6 +2312,11 @@ uint16_t swc_connection_get_enqueued_count(const swc_connection_t *const conn, s
 
     CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return 0);
 
+#if !WPS_DISABLE_AGGREGATION
+    if (conn->wps_conn_handle->aggr.enabled && !conn->wps_conn_handle->is_tx_connection) {
+        return wps_aggr_get_fifo_size(conn->wps_conn_handle);
+    }
+#endif
 #if !WPS_DISABLE_FRAGMENTATION
     if (conn->wps_conn_handle->frag.enabled) {
         return wps_frag_get_fifo_size(conn->wps_conn_handle);
@@ -2026,6 +2349,9 @@ void swc_connection_flush_queue(const swc_connection_t *conn, swc_error_t *err)
     *err = SWC_ERR_NONE;
     CHECK_ERROR(is_started, err, SWC_ERR_FLUSH_QUEUE_WHILE_RUNNING, return);
     CHECK_ERROR(conn == NULL, err, SWC_ERR_UNINITIALIZED_CONNECTION, return);
+    /* Flushed frames leave the selective repeat window as if they were dropped. */
+    link_sr_arq_tx_skip(&conn->wps_conn_handle->selective_repeat_arq,
+                        xlayer_queue_get_size(&conn->wps_conn_handle->xlayer_queue));
     /* Flush content of the connection's queue. */
     xlayer_queue_flush(&conn->wps_conn_handle->xlayer_queue);
     /* Reset saw_arq to make sure new packets are not considered duplicates of flushed packets. */
@@ -2067,8 +2393,8 @@ void swc_setup(swc_error_t *const err)
     wps_init_xlayer(&wps.node, xlayer_tx_pool, xlayer_rx_pool, &wps_err);
     CHECK_ERROR(wps_err != WPS_NO_ERROR, err, SWC_ERR_INTERNAL, return);
 
-    /* Determine callbacks count and add a margin for other event callbacks */
-    required_callback_queue_size = calculate_activated_callback_count() + WPS_QUEUE_MARGIN;
+    /* Determine callbacks count and add a margin for other event callbacks, the lock-free queue needs a power of two */
+    required_callback_queue_size = spsc_queue_round_capacity(calculate_activated_callback_count() + WPS_QUEUE_MARGIN);
 
     /* Allocate the callback queue based on the required size */
     wps_callback_inst_t *callback_queue = mem_pool_malloc(&mem_pool,
@@ -2214,6 +2540,11 @@ uint32_t swc_get_allocated_bytes(void)
     return mem_pool_get_allocated_bytes(&mem_pool);
 }
 
+void swc_get_memory_pool_stats(mem_pool_stats_t *const stats)
+{
+    mem_pool_get_stats(&mem_pool, stats);
+}
+
 void swc_free_memory(void)
 {
     is_started = false;
@@ -3384,3 +3715,41 @@ static rf_channel_t ***allocate_fallback_channel(uint8_t fallback_mode_count, sw
 
     return fallback_channel;
 }
+
+/** @brief Send a payload gathered from several segments on a connection without fragmentation.
+ *
+ *  @param[in]  wps_conn_handle  WPS connection handle.
+ *  @param[in]  segments         Payload segments to send.
+ *  @param[in]  segment_count    Number of segments.
+ *  @param[out] wps_err          WPS error code.
+ */
+static void send_segments(wps_connection_t *const wps_conn_handle, const wps_payload_segment_t *const segments,
+                          uint8_t segment_count, wps_error_t *const wps_err)
+{
+#if !WPS_DISABLE_AGGREGATION
+    if (wps_conn_handle->aggr.enabled) {
+        wps_aggr_sendv(wps_conn_handle, segments, segment_count, wps_err);
+        return;
+    }
+#endif
+    wps_sendv(wps_conn_handle, segments, segment_count, wps_err);
+}
+
+/** @brief Copy a received payload in a buffer on a connection without fragmentation.
+ *
+ *  @param[in]  wps_conn_handle  WPS connection handle.
+ *  @param[out] payload          Buffer where to copy the payload.
+ *  @param[in]  size             Buffer size in bytes.
+ *  @param[out] wps_err          WPS error code.
+ *  @return WPS received frame.
+ */
+static wps_rx_frame read_payload_to_buffer(wps_connection_t *const wps_conn_handle, uint8_t *const payload,
+                                           uint16_t size, wps_error_t *const wps_err)
+{
+#if !WPS_DISABLE_AGGREGATION
+    if (wps_conn_handle->aggr.enabled) {
+        return wps_aggr_read_to_buffer(wps_conn_handle, payload, size, wps_err);
+    }
+#endif
+    return wps_read_to_buffer(wps_conn_handle, payload, size, wps_err);
+}
@@ -15,6 +15,24 @@
 #include "wps_config.h"
 #include "wps_stats.h"
 
+/* CONSTANTS ******************************************************************/
+/*! Number of fields of the TELEMETRY_RECORD_SWC_CONNECTION_STATS record. */
+#define TELEMETRY_CONNECTION_STATS_FIELD_COUNT 34
+#if WPS_ENABLE_LATENCY_STATS
+/*! Number of fields of the TELEMETRY_RECORD_SWC_CONNECTION_LATENCY record. */
+#define TELEMETRY_CONNECTION_LATENCY_FIELD_COUNT \
+    (2 + (3 * WPS_LATENCY_HISTOGRAM_BIN_COUNT) + (2 * 3) + WPS_RETRY_HISTOGRAM_BIN_COUNT)
+#endif
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+#if WPS_ENABLE_LATENCY_STATS
+static void put_latency_histogram_telemetry(telemetry_t *telemetry, const swc_latency_histogram_t *histogram);
+static void convert_latency_histogram(const swc_connection_t *const conn, const wps_latency_histogram_t *histogram,
+                                      swc_latency_histogram_t *swc_histogram);
+static uint32_t ticks_to_us(const swc_connection_t *const conn, uint64_t ticks);
+static int format_latency_stats(const swc_connection_t *const conn, char *const buffer, uint16_t size);
+#endif
+
 /* PUBLIC FUNCTIONS ***********************************************************/
 swc_statistics_t *swc_connection_update_stats(swc_connection_t *const conn, swc_error_t *err)
 {
@@ -138,6 +156,80 @@ swc_statistics_t *swc_connection_update_stats(swc_connection_t *const conn, swc_
     return &conn->stats;
 }
 
+void swc_connection_add_stats_telemetry(const swc_connection_t *const conn, telemetry_t *telemetry, uint8_t instance,
+                                        swc_error_t *err)
+{
+    const swc_statistics_t *stats;
+
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(telemetry == NULL, err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(!telemetry_start_record(telemetry, TELEMETRY_RECORD_SWC_CONNECTION_STATS,
+                                        SWC_TELEMETRY_CONNECTION_STATS_VERSION, instance,
+                                        TELEMETRY_CONNECTION_STATS_FIELD_COUNT),
+                err, SWC_ERR_BUFFER_SIZE_TOO_SMALL, return);
+
+    stats = &conn->stats;
+    telemetry_put_u32(telemetry, stats->packet_sent_and_acked_count);
+    telemetry_put_u32(telemetry, stats->packet_sent_and_not_acked_count);
+    telemetry_put_u32(telemetry, stats->no_packet_tranmission_count);
+    telemetry_put_u32(telemetry, stats->packet_dropped_count);
+    telemetry_put_u32(telemetry, stats->tx_timeslot_occurrence);
+    telemetry_put_float(telemetry, stats->tx_used_capacity_pc);
+    telemetry_put_u32(telemetry, stats->packet_successfully_received_count);
+    telemetry_put_u32(telemetry, stats->no_packet_reception_count);
+    telemetry_put_u32(telemetry, stats->rx_timeslot_occurrence);
+    telemetry_put_u32(telemetry, stats->packet_duplicated_count);
+    telemetry_put_u32(telemetry, stats->packet_invalid_data_size_count);
+    telemetry_put_u32(telemetry, stats->packet_invalid_header_size_count);
+    telemetry_put_u32(telemetry, stats->packet_rejected_count);
+    telemetry_put_u32(telemetry, stats->packet_overrun_count);
+    telemetry_put_u32(telemetry, stats->packet_ack_data_received_count);
+    telemetry_put_u32(telemetry, stats->packet_ack_data_send_count);
+    telemetry_put_u32(telemetry, stats->cca_pass_count);
+    telemetry_put_u32(telemetry, stats->cca_fail_count);
+    telemetry_put_u32(telemetry, stats->cca_try_fail_count);
+    telemetry_put_u32(telemetry, stats->rssi_avg_raw);
+    telemetry_put_u32(telemetry, stats->rnsi_avg_raw);
+    telemetry_put_u32(telemetry, stats->rssi_inst);
+    telemetry_put_u32(telemetry, stats->rnsi_inst);
+    telemetry_put_u32(telemetry, stats->rssi_avg);
+    telemetry_put_u32(telemetry, stats->rnsi_avg);
+    telemetry_put_u32(telemetry, stats->link_margin_avg);
+    telemetry_put_u32(telemetry, stats->rssi_block_avg_tenth_db);
+    telemetry_put_u32(telemetry, stats->rnsi_block_avg_tenth_db);
+    telemetry_put_u32(telemetry, stats->link_margin_block_avg_tenth_db);
+    telemetry_put_u32(telemetry, stats->bytes_sent);
+    telemetry_put_u32(telemetry, stats->bytes_received);
+    telemetry_put_u32(telemetry, stats->tx_data_rate_bps);
+    telemetry_put_u32(telemetry, stats->rx_data_rate_bps);
+    telemetry_put_u32(telemetry, stats->tick_since_reset);
+
+#if WPS_ENABLE_LATENCY_STATS
+    if (conn->wps_conn_handle->latency_stats.enable) {
+        swc_latency_statistics_t latency_stats;
+
+        CHECK_ERROR(!telemetry_start_record(telemetry, TELEMETRY_RECORD_SWC_CONNECTION_LATENCY,
+                                            SWC_TELEMETRY_CONNECTION_LATENCY_VERSION, instance,
+                                            TELEMETRY_CONNECTION_LATENCY_FIELD_COUNT),
+                    err, SWC_ERR_BUFFER_SIZE_TOO_SMALL, return);
+
+        swc_connection_get_latency_stats(conn, &latency_stats, err);
+        telemetry_put_u32(telemetry, WPS_LATENCY_HISTOGRAM_BIN_COUNT);
+        telemetry_put_u32(telemetry, WPS_RETRY_HISTOGRAM_BIN_COUNT);
+        for (uint8_t i = 0; i < WPS_LATENCY_HISTOGRAM_BIN_COUNT; i++) {
+            telemetry_put_u32(telemetry, latency_stats.bin_upper_bound_us[i]);
+        }
+        put_latency_histogram_telemetry(telemetry, &latency_stats.ack_latency);
+        put_latency_histogram_telemetry(telemetry, &latency_stats.drop_age);
+        for (uint8_t i = 0; i < WPS_RETRY_HISTOGRAM_BIN_COUNT; i++) {
+            telemetry_put_u32(telemetry, latency_stats.retry_count[i]);
+        }
+    }
+#endif
+}
+
 #if WPS_ENABLE_PHY_STATS_PER_BANDS
 swc_statistics_t *swc_connection_update_stats_per_channel(swc_connection_t *const conn, const uint8_t channel_number)
 {
@@ -377,9 +469,47 @@ int swc_connection_format_stats(const swc_connection_t *const conn, char *const
     string_length += snprintf(buffer + string_length, size - string_length, "%s:\t%10" PRIu32 "\r\n",
                               link_margin_block_avg_str, conn->stats.link_margin_block_avg_tenth_db);
 
+#if WPS_ENABLE_LATENCY_STATS
+    if (conn->wps_conn_handle->is_tx_connection && conn->wps_conn_handle->latency_stats.enable &&
+        (string_length < size)) {
+        string_length += format_latency_stats(conn, buffer + string_length, size - string_length);
+    }
+#endif
+
     return string_length;
 }
 
+#if WPS_ENABLE_LATENCY_STATS
+void swc_connection_set_latency_stats(const swc_connection_t *const conn, bool enabled, swc_error_t *err)
+{
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return);
+
+    wps_stats_set_latency_enable(conn->wps_conn_handle, enabled);
+}
+
+void swc_connection_get_latency_stats(const swc_connection_t *const conn, swc_latency_statistics_t *const stats,
+                                      swc_error_t *err)
+{
+    const wps_latency_stats_t *latency_stats;
+
+    *err = SWC_ERR_NONE;
+
+    CHECK_ERROR(conn == NULL, err, SWC_ERR_NULL_PTR, return);
+    CHECK_ERROR(stats == NULL, err, SWC_ERR_NULL_PTR, return);
+
+    latency_stats = wps_stats_get_latency_stats(conn->wps_conn_handle);
+
+    for (uint8_t i = 0; i < WPS_LATENCY_HISTOGRAM_BIN_COUNT; i++) {
+        stats->bin_upper_bound_us[i] = ticks_to_us(conn, wps_stats_get_latency_bin_upper_bound(i));
+    }
+    convert_latency_histogram(conn, &latency_stats->ack_latency, &stats->ack_latency);
+    convert_latency_histogram(conn, &latency_stats->drop_age, &stats->drop_age);
+    memcpy(stats->retry_count, latency_stats->retry_bins, sizeof(stats->retry_count));
+}
+#endif
+
 void swc_connection_reset_stats(swc_connection_t *const conn, swc_error_t *err)
 {
     *err = SWC_ERR_NONE;
@@ -390,3 +520,100 @@ void swc_connection_reset_stats(swc_connection_t *const conn, swc_error_t *err)
     conn->stats.tick_on_reset = conn->wps_conn_handle->cfg.get_tick();
     wps_stats_reset(conn->wps_conn_handle);
 }
+
+/* PRIVATE FUNCTIONS **********************************************************/
+#if WPS_ENABLE_LATENCY_STATS
+/** @brief Write a latency histogram to the current telemetry record.
+ *
+ *  @param[in] telemetry  Telemetry instance.
+ *  @param[in] histogram  Latency histogram.
+ */
+static void put_latency_histogram_telemetry(telemetry_t *telemetry, const swc_latency_histogram_t *histogram)
+{
+    telemetry_put_u32(telemetry, histogram->count);
+    telemetry_put_u32(telemetry, histogram->avg_us);
+    telemetry_put_u32(telemetry, histogram->max_us);
+    for (uint8_t i = 0; i < WPS_LATENCY_HISTOGRAM_BIN_COUNT; i++) {
+        telemetry_put_u32(telemetry, histogram->bins[i]);
+    }
+}
+
+/** @brief Convert a WPS latency histogram to microseconds.
+ *
+ *  @param[in]  conn           Connection handle.
+ *  @param[in]  histogram      WPS latency histogram, in connection ticks.
+ *  @param[out] swc_histogram  Latency histogram.
+ */
+static void convert_latency_histogram(const swc_connection_t *const conn, const wps_latency_histogram_t *histogram,
+                                      swc_latency_histogram_t *swc_histogram)
+{
+    swc_histogram->count = histogram->count;
+    swc_histogram->avg_us = (histogram->count == 0) ? 0 : ticks_to_us(conn, histogram->total / histogram->count);
+    swc_histogram->max_us = ticks_to_us(conn, histogram->max);
+    memcpy(swc_histogram->bins, histogram->bins, sizeof(swc_histogram->bins));
+}
+
+/** @brief Convert a duration in connection ticks to microseconds.
+ *
+ *  @param[in] conn   Connection handle.
+ *  @param[in] ticks  Duration in ticks, UINT32_MAX for an unbounded duration.
+ *  @return Duration in microseconds, saturated to UINT32_MAX.
+ */
+static uint32_t ticks_to_us(const swc_connection_t *const conn, uint64_t ticks)
+{
+    uint64_t duration_us;
+
+    if (ticks >= UINT32_MAX) {
+        return UINT32_MAX;
+    }
+    duration_us = (ticks * 1000000) / conn->wps_conn_handle->cfg.tick_frequency_hz;
+
+    return (duration_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)duration_us;
+}
+
+/** @brief Format the connection latency statistics as a string of characters.
+ *
+ *  Only the histogram bins holding at least one duration are printed.
+ *
+ *  @param[in]  conn    Connection handle.
+ *  @param[out] buffer  Buffer where to put the formatted string.
+ *  @param[in]  size    Size of the buffer.
+ *  @return The formated string length, excluding the NULL terminator.
+ */
+static int format_latency_stats(const swc_connection_t *const conn, char *const buffer, uint16_t size)
+{
+    swc_latency_statistics_t stats;
+    swc_error_t err;
+    int string_length;
+    uint32_t lower_bound_us = 0;
+
+    swc_connection_get_latency_stats(conn, &stats, &err);
+
+    string_length = snprintf(buffer, size,
+                             "ACK Latency:\t\t\t%10" PRIu32 " (avg us)\t%10" PRIu32 " (max us)\r\n"
+                             "Drop Age:\t\t\t%10" PRIu32 " (avg us)\t%10" PRIu32 " (max us)\r\n"
+                             "Latency Histogram (us):\t\t%10s\t%10s\r\n",
+                             stats.ack_latency.avg_us, stats.ack_latency.max_us, stats.drop_age.avg_us,
+                             stats.drop_age.max_us, "ACK'd", "Dropped");
+
+    for (uint8_t i = 0; (i < WPS_LATENCY_HISTOGRAM_BIN_COUNT) && (string_length < size); i++) {
+        if ((stats.ack_latency.bins[i] != 0) || (stats.drop_age.bins[i] != 0)) {
+            string_length += snprintf(buffer + string_length, size - string_length,
+                                      "  %10" PRIu32 " - %10" PRIu32 ":\t%10" PRIu32 "\t%10" PRIu32 "\r\n",
+                                      lower_bound_us, stats.bin_upper_bound_us[i], stats.ack_latency.bins[i],
+                                      stats.drop_age.bins[i]);
+        }
+        lower_bound_us = stats.bin_upper_bound_us[i] + 1;
+    }
+
+    for (uint8_t i = 0; (i < WPS_RETRY_HISTOGRAM_BIN_COUNT) && (string_length < size); i++) {
+        if (stats.retry_count[i] != 0) {
+            string_length += snprintf(buffer + string_length, size - string_length,
+                                      "Retry Count %" PRIu8 "%s:\t\t\t%10" PRIu32 "\r\n", i,
+                                      (i == WPS_RETRY_HISTOGRAM_BIN_COUNT - 1) ? "+" : "", stats.retry_count[i]);
+        }
+    }
+
+    return string_length;
+}
+#endif
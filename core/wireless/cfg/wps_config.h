@@ -89,6 +89,21 @@
 #define WPS_ENABLE_LINK_STATS true
 #endif
 
+/** @brief Enable the gathering of per connection latency statistics.
+ *
+ *  @note This adds to every connection the following histograms, recorded once enabled on the connection :
+ *          - ack_latency : Time from the payload enqueue to its acknowledge
+ *          - drop_age    : Time from the payload enqueue to its drop
+ *          - retry       : Number of retries of the acknowledged payloads
+ */
+#ifndef WPS_ENABLE_LATENCY_STATS
+#define WPS_ENABLE_LATENCY_STATS false
+#endif
+
+#if !WPS_ENABLE_LINK_STATS && WPS_ENABLE_LATENCY_STATS
+#error "WPS_ENABLE_LATENCY_STATS (latency stats) cannot be enabled if WPS_ENABLE_LINK_STATS (link stats) is disabled."
+#endif
+
 /** @brief Disable the link-throttle feature.
  */
 #ifndef WPS_DISABLE_LINK_THROTTLE
@@ -103,6 +118,26 @@
 #define WPS_DISABLE_FRAGMENTATION false
 #endif
 
+/** @brief Disable the aggregation feature.
+ *
+ * If aggregation is disabled, make sure the build system doesn't compile the wps_aggr files.
+ */
+#ifndef WPS_DISABLE_AGGREGATION
+#define WPS_DISABLE_AGGREGATION false
+#endif
+
+/** @brief Disable the dynamic time slot allocation feature.
+ *
+ * Time slots not granted to the local device are slept over by the link-throttle time slot skipping, so the feature
+ * is disabled by default along with the link-throttle feature.
+ */
+#ifndef WPS_DISABLE_DYNAMIC_ALLOCATION
+#define WPS_DISABLE_DYNAMIC_ALLOCATION WPS_DISABLE_LINK_THROTTLE
+#endif
+#if WPS_DISABLE_LINK_THROTTLE && !WPS_DISABLE_DYNAMIC_ALLOCATION
+#error "The dynamic time slot allocation feature requires the link-throttle feature."
+#endif
+
 /* If your compiler is not GCC but supports GCC attributes (see __packed below),
  * you can remove this error check.
  */
@@ -0,0 +1,145 @@
+/** @file link_cca_adaptive.c
+ *  @brief Adaptive Clear Channel Assessment backoff module.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "link_cca_adaptive.h"
+#include <stddef.h>
+
+/* CONSTANTS ******************************************************************/
+/*! Busy level averaging factor, each new sample weights 1 / 2^shift. */
+#define BUSY_LEVEL_AVERAGE_SHIFT 3
+/*! Busy level of a transmission whose CCA tries all failed. */
+#define BUSY_LEVEL_MAX UINT16_MAX
+/*! Smallest retry window, as a fraction 1 / 2^shift of the configured retry time. */
+#define MIN_RETRY_WINDOW_SHIFT 2
+/*! Pseudo-random generator state used when the seed is 0. */
+#define DEFAULT_PRNG_STATE 0x2545F491
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static uint32_t prng_next(link_cca_adaptive_t *cca_adaptive);
+static bool is_channel_valid(const link_cca_adaptive_t *cca_adaptive, uint8_t channel);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void link_cca_adaptive_init(link_cca_adaptive_t *cca_adaptive, link_cca_adaptive_channel_t *channel_buffer,
+                            uint8_t channel_count, uint32_t seed)
+{
+    cca_adaptive->channel = channel_buffer;
+    cca_adaptive->channel_count = (channel_buffer != NULL) ? channel_count : 0;
+    cca_adaptive->prng_state = (seed != 0) ? seed : DEFAULT_PRNG_STATE;
+    cca_adaptive->enabled = (cca_adaptive->channel_count != 0);
+
+    for (uint8_t i = 0; i < cca_adaptive->channel_count; i++) {
+        cca_adaptive->channel[i].busy_level = 0;
+        cca_adaptive->channel[i].persistent_busy = false;
+    }
+}
+
+void link_cca_adaptive_disable(link_cca_adaptive_t *cca_adaptive)
+{
+    cca_adaptive->enabled = false;
+}
+
+void link_cca_adaptive_update(link_cca_adaptive_t *cca_adaptive, uint8_t channel, uint8_t fail_count, bool cca_pass)
+{
+    uint32_t try_count = fail_count + (cca_pass ? 1 : 0);
+    link_cca_adaptive_channel_t *stats;
+    int32_t sample;
+
+    if (!is_channel_valid(cca_adaptive, channel) || (try_count == 0)) {
+        return;
+    }
+    stats = &cca_adaptive->channel[channel];
+
+    sample = (int32_t)((fail_count * (uint32_t)BUSY_LEVEL_MAX) / try_count);
+    stats->busy_level = (uint16_t)(stats->busy_level + ((sample - stats->busy_level) / (1 << BUSY_LEVEL_AVERAGE_SHIFT)));
+
+    /* Hysteresis, so that a channel does not flip between states on every transmission. */
+    if (stats->busy_level >= LINK_CCA_ADAPTIVE_BUSY_ENTER_LEVEL) {
+        stats->persistent_busy = true;
+    } else if (stats->busy_level < LINK_CCA_ADAPTIVE_BUSY_EXIT_LEVEL) {
+        stats->persistent_busy = false;
+    }
+}
+
+uint16_t link_cca_adaptive_get_retry_time(link_cca_adaptive_t *cca_adaptive, uint8_t channel,
+                                          uint16_t retry_time_pll_cycles)
+{
+    uint32_t step_count = retry_time_pll_cycles / LINK_CCA_ADAPTIVE_RETRY_TIME_STEP_PLL_CYCLES;
+    uint32_t min_window;
+    uint32_t window;
+
+    if (!is_channel_valid(cca_adaptive, channel) || (step_count <= 1)) {
+        return retry_time_pll_cycles;
+    }
+
+    /* The window grows from a fraction of the configured retry time on an idle channel up to the whole of it on a
+     * channel where every try fails.
+     */
+    min_window = (step_count + (1 << MIN_RETRY_WINDOW_SHIFT) - 1) >> MIN_RETRY_WINDOW_SHIFT;
+    window = min_window + (((step_count - min_window) * cca_adaptive->channel[channel].busy_level) / BUSY_LEVEL_MAX);
+
+    return (uint16_t)((1 + (prng_next(cca_adaptive) % window)) * LINK_CCA_ADAPTIVE_RETRY_TIME_STEP_PLL_CYCLES);
+}
+
+uint8_t link_cca_adaptive_get_try_count(const link_cca_adaptive_t *cca_adaptive, uint8_t channel,
+                                        uint8_t max_try_count)
+{
+    if (!is_channel_valid(cca_adaptive, channel) || !cca_adaptive->channel[channel].persistent_busy ||
+        (max_try_count <= 1)) {
+        return max_try_count;
+    }
+
+    return max_try_count / 2;
+}
+
+uint8_t link_cca_adaptive_get_busy_ratio(const link_cca_adaptive_t *cca_adaptive, uint8_t channel)
+{
+    if (!is_channel_valid(cca_adaptive, channel)) {
+        return 0;
+    }
+
+    return (uint8_t)(((uint32_t)cca_adaptive->channel[channel].busy_level * 100 + (BUSY_LEVEL_MAX / 2)) /
+                     BUSY_LEVEL_MAX);
+}
+
+bool link_cca_adaptive_is_channel_busy(const link_cca_adaptive_t *cca_adaptive, uint8_t channel)
+{
+    return is_channel_valid(cca_adaptive, channel) && cca_adaptive->channel[channel].persistent_busy;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Get the next pseudo-random number.
+ *
+ *  @param[in] cca_adaptive  Adaptive CCA instance.
+ *  @return Pseudo-random number.
+ */
+static uint32_t prng_next(link_cca_adaptive_t *cca_adaptive)
+{
+    uint32_t state = cca_adaptive->prng_state;
+
+    /* Xorshift32. */
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    cca_adaptive->prng_state = state;
+
+    return state;
+}
+
+/** @brief Get whether the statistics of a channel are available.
+ *
+ *  @param[in] cca_adaptive  Adaptive CCA instance.
+ *  @param[in] channel       Channel index in the hopping sequence.
+ *  @retval true   Module is enabled and the channel is in range.
+ *  @retval false  Module is disabled or the channel is out of range.
+ */
+static bool is_channel_valid(const link_cca_adaptive_t *cca_adaptive, uint8_t channel)
+{
+    return cca_adaptive->enabled && (channel < cca_adaptive->channel_count);
+}
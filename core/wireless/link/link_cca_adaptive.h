@@ -0,0 +1,133 @@
+/** @file link_cca_adaptive.h
+ *  @brief Adaptive Clear Channel Assessment backoff module.
+ *
+ *  This module learns how busy every channel of the hopping sequence is from the outcome of the CCA tries and adapts
+ *  the CCA parameters of the next transmission on that channel:
+ *      The retry time is drawn at random in a window that grows with the channel busy level, so that the devices of
+ *      co-located networks stop retrying in lockstep. The window never exceeds the configured retry time, the
+ *      transmission therefore always fits in the receiver timeout.
+ *      On a channel that is persistently busy, the try budget is reduced so that less airtime is spent waiting on it
+ *      and the frame is retried on the next channel of the sequence instead.
+ *
+ *  The module has no dependency on the radio, the statistics are fed by the MAC after every transmission.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef LINK_CCA_ADAPTIVE_H_
+#define LINK_CCA_ADAPTIVE_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Granularity of the radio CCA retry time, in PLL cycles. */
+#define LINK_CCA_ADAPTIVE_RETRY_TIME_STEP_PLL_CYCLES 32
+/*! Busy level at or above which a channel is considered persistently busy, in 1/65536. */
+#define LINK_CCA_ADAPTIVE_BUSY_ENTER_LEVEL 32768
+/*! Busy level below which a persistently busy channel is considered usable again, in 1/65536. */
+#define LINK_CCA_ADAPTIVE_BUSY_EXIT_LEVEL 16384
+
+/* TYPES **********************************************************************/
+/** @brief Adaptive CCA statistics of a channel.
+ */
+typedef struct link_cca_adaptive_channel {
+    /*! Moving average of the ratio of failed CCA tries, in 1/65536. */
+    uint16_t busy_level;
+    /*! Channel is persistently busy. */
+    bool persistent_busy;
+} link_cca_adaptive_channel_t;
+
+/** @brief Adaptive CCA module instance.
+ */
+typedef struct link_cca_adaptive {
+    /*! Statistics of every channel of the hopping sequence. */
+    link_cca_adaptive_channel_t *channel;
+    /*! Number of channels. */
+    uint8_t channel_count;
+    /*! Pseudo-random generator state. */
+    uint32_t prng_state;
+    /*! Adaptive CCA enable flag. */
+    bool enabled;
+} link_cca_adaptive_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize and enable the adaptive CCA module.
+ *
+ *  @note The seed should be unique to the device, e.g. its address, so that co-located devices draw different retry
+ *        times.
+ *
+ *  @param[in] cca_adaptive    Adaptive CCA instance.
+ *  @param[in] channel_buffer  Statistics storage of channel_count channels.
+ *  @param[in] channel_count   Number of channels of the hopping sequence.
+ *  @param[in] seed            Pseudo-random generator seed.
+ */
+void link_cca_adaptive_init(link_cca_adaptive_t *cca_adaptive, link_cca_adaptive_channel_t *channel_buffer,
+                            uint8_t channel_count, uint32_t seed);
+
+/** @brief Disable the adaptive CCA module.
+ *
+ *  The CCA parameters are then used as configured.
+ *
+ *  @param[in] cca_adaptive  Adaptive CCA instance.
+ */
+void link_cca_adaptive_disable(link_cca_adaptive_t *cca_adaptive);
+
+/** @brief Update the channel statistics with the outcome of a transmission.
+ *
+ *  @param[in] cca_adaptive  Adaptive CCA instance.
+ *  @param[in] channel       Channel index in the hopping sequence.
+ *  @param[in] fail_count    Number of failed CCA tries.
+ *  @param[in] cca_pass      True if the last CCA try passed.
+ */
+void link_cca_adaptive_update(link_cca_adaptive_t *cca_adaptive, uint8_t channel, uint8_t fail_count, bool cca_pass);
+
+/** @brief Get the CCA retry time to use for the next transmission on a channel.
+ *
+ *  @param[in] cca_adaptive           Adaptive CCA instance.
+ *  @param[in] channel                Channel index in the hopping sequence.
+ *  @param[in] retry_time_pll_cycles  Configured CCA retry time, in PLL cycles.
+ *  @return CCA retry time, in PLL cycles, a multiple of LINK_CCA_ADAPTIVE_RETRY_TIME_STEP_PLL_CYCLES that does not
+ *          exceed the configured retry time.
+ */
+uint16_t link_cca_adaptive_get_retry_time(link_cca_adaptive_t *cca_adaptive, uint8_t channel,
+                                          uint16_t retry_time_pll_cycles);
+
+/** @brief Get the CCA try budget to use for the next transmission on a channel.
+ *
+ *  @param[in] cca_adaptive   Adaptive CCA instance.
+ *  @param[in] channel        Channel index in the hopping sequence.
+ *  @param[in] max_try_count  Configured CCA try count.
+ *  @return CCA try count, halved on a persistently busy channel.
+ */
+uint8_t link_cca_adaptive_get_try_count(const link_cca_adaptive_t *cca_adaptive, uint8_t channel,
+                                        uint8_t max_try_count);
+
+/** @brief Get the busy ratio of a channel.
+ *
+ *  @param[in] cca_adaptive  Adaptive CCA instance.
+ *  @param[in] channel       Channel index in the hopping sequence.
+ *  @return Moving average of the ratio of failed CCA tries, in percent.
+ */
+uint8_t link_cca_adaptive_get_busy_ratio(const link_cca_adaptive_t *cca_adaptive, uint8_t channel);
+
+/** @brief Get whether a channel is persistently busy.
+ *
+ *  @param[in] cca_adaptive  Adaptive CCA instance.
+ *  @param[in] channel       Channel index in the hopping sequence.
+ *  @retval true   Channel is persistently busy.
+ *  @retval false  Channel is usable or the module is disabled.
+ */
+bool link_cca_adaptive_is_channel_busy(const link_cca_adaptive_t *cca_adaptive, uint8_t channel);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* LINK_CCA_ADAPTIVE_H_ */
@@ -0,0 +1,170 @@
+/** @file  link_dynamic_alloc.c
+ *  @brief Demand-driven dynamic time slot allocation module.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "link_dynamic_alloc.h"
+#include <string.h>
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void allocate_timeslots(link_dynamic_alloc_t *dynamic_alloc);
+static uint8_t get_node_with_highest_demand(const link_dynamic_alloc_t *dynamic_alloc);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void link_dynamic_alloc_init(link_dynamic_alloc_t *dynamic_alloc)
+{
+    memset(dynamic_alloc, 0, sizeof(link_dynamic_alloc_t));
+}
+
+bool link_dynamic_alloc_set_timeslots(link_dynamic_alloc_t *dynamic_alloc, const uint8_t *timeslot_id,
+                                      uint8_t timeslot_count)
+{
+    uint64_t timeslot_mask = 0;
+
+    if (timeslot_count > LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT) {
+        return false;
+    }
+    for (uint8_t i = 0; i < timeslot_count; i++) {
+        if (timeslot_id[i] > LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_ID) {
+            return false;
+        }
+        timeslot_mask |= (uint64_t)1 << timeslot_id[i];
+    }
+
+    memcpy(dynamic_alloc->timeslot_id, timeslot_id, timeslot_count);
+    memset(dynamic_alloc->owner, LINK_DYNAMIC_ALLOC_NO_OWNER, sizeof(dynamic_alloc->owner));
+    dynamic_alloc->timeslot_count = timeslot_count;
+    dynamic_alloc->timeslot_mask = timeslot_mask;
+    dynamic_alloc->map_valid = false;
+    dynamic_alloc->enable = (timeslot_count > 0);
+
+    return true;
+}
+
+bool link_dynamic_alloc_add_node(link_dynamic_alloc_t *dynamic_alloc, uint8_t address)
+{
+    for (uint8_t i = 0; i < dynamic_alloc->node_count; i++) {
+        if (dynamic_alloc->node_address[i] == address) {
+            return true;
+        }
+    }
+    if (dynamic_alloc->node_count >= LINK_DYNAMIC_ALLOC_MAX_NODE_COUNT) {
+        return false;
+    }
+
+    dynamic_alloc->node_address[dynamic_alloc->node_count] = address;
+    dynamic_alloc->node_demand[dynamic_alloc->node_count] = 0;
+    dynamic_alloc->node_count++;
+
+    return true;
+}
+
+void link_dynamic_alloc_set_demand(link_dynamic_alloc_t *dynamic_alloc, uint8_t address, uint8_t demand)
+{
+    for (uint8_t i = 0; i < dynamic_alloc->node_count; i++) {
+        if (dynamic_alloc->node_address[i] == address) {
+            dynamic_alloc->node_demand[i] = demand;
+            return;
+        }
+    }
+}
+
+void link_dynamic_alloc_start_superframe(link_dynamic_alloc_t *dynamic_alloc, uint32_t superframe_count,
+                                         bool is_coordinator)
+{
+    dynamic_alloc->superframe_count = superframe_count;
+
+    if (is_coordinator) {
+        allocate_timeslots(dynamic_alloc);
+        dynamic_alloc->map_valid = true;
+    } else {
+        dynamic_alloc->map_valid = false;
+    }
+}
+
+bool link_dynamic_alloc_get_owner(const link_dynamic_alloc_t *dynamic_alloc, uint8_t timeslot_id, uint8_t *owner)
+{
+    if (!link_dynamic_alloc_is_dynamic_timeslot(dynamic_alloc, timeslot_id)) {
+        return false;
+    }
+
+    *owner = LINK_DYNAMIC_ALLOC_NO_OWNER;
+    if (dynamic_alloc->map_valid) {
+        for (uint8_t i = 0; i < dynamic_alloc->timeslot_count; i++) {
+            if (dynamic_alloc->timeslot_id[i] == timeslot_id) {
+                *owner = dynamic_alloc->owner[i];
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+void link_dynamic_alloc_write_map(const link_dynamic_alloc_t *dynamic_alloc, uint8_t *map)
+{
+    memcpy(map, dynamic_alloc->owner, dynamic_alloc->timeslot_count);
+}
+
+void link_dynamic_alloc_read_map(link_dynamic_alloc_t *dynamic_alloc, const uint8_t *map)
+{
+    memcpy(dynamic_alloc->owner, map, dynamic_alloc->timeslot_count);
+    dynamic_alloc->map_valid = true;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Grant every dynamic time slot of the superframe.
+ *
+ *  Time slots are granted one at a time to the node with the most pending frames, so that the busiest nodes are
+ *  interleaved instead of served one after the other. The demand is decremented for every granted time slot, it is
+ *  refreshed by the next frame received from the node.
+ *
+ *  @param[in] dynamic_alloc  Dynamic allocation instance.
+ */
+static void allocate_timeslots(link_dynamic_alloc_t *dynamic_alloc)
+{
+    uint8_t node;
+
+    for (uint8_t i = 0; i < dynamic_alloc->timeslot_count; i++) {
+        node = get_node_with_highest_demand(dynamic_alloc);
+        if (node >= dynamic_alloc->node_count) {
+            dynamic_alloc->owner[i] = LINK_DYNAMIC_ALLOC_NO_OWNER;
+            dynamic_alloc->unused_count++;
+            continue;
+        }
+        dynamic_alloc->owner[i] = dynamic_alloc->node_address[node];
+        dynamic_alloc->node_demand[node]--;
+        dynamic_alloc->granted_count++;
+    }
+
+    if (dynamic_alloc->node_count > 0) {
+        dynamic_alloc->first_node = (dynamic_alloc->first_node + 1) % dynamic_alloc->node_count;
+    }
+}
+
+/** @brief Get the node with the most pending frames.
+ *
+ *  @param[in] dynamic_alloc  Dynamic allocation instance.
+ *  @return Index of the node, node_count if no node has pending frames.
+ */
+static uint8_t get_node_with_highest_demand(const link_dynamic_alloc_t *dynamic_alloc)
+{
+    uint8_t highest_node = dynamic_alloc->node_count;
+    uint8_t highest_demand = 0;
+    uint8_t node = dynamic_alloc->first_node;
+
+    for (uint8_t i = 0; i < dynamic_alloc->node_count; i++) {
+        if (dynamic_alloc->node_demand[node] > highest_demand) {
+            highest_demand = dynamic_alloc->node_demand[node];
+            highest_node = node;
+        }
+        node = (node + 1 == dynamic_alloc->node_count) ? 0 : node + 1;
+    }
+
+    return highest_node;
+}
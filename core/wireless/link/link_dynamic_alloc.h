@@ -0,0 +1,177 @@
+/** @file  link_dynamic_alloc.h
+ *  @brief Demand-driven dynamic time slot allocation module.
+ *
+ *  A set of main time slots of the schedule is shared by the nodes of a star network instead of being owned by a
+ *  single connection. Every node reports in its frame headers the number of frames waiting in its queue. At the start
+ *  of every superframe, the coordinator grants the dynamic time slots to the nodes with the most pending frames and
+ *  sends the resulting allocation map in the header of its frames. A node only transmits in a dynamic time slot granted
+ *  to it by a map received in the current superframe, every other dynamic time slot is slept over.
+ *
+ *  Only the 8 least significant bits of the node addresses are carried in the allocation map.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef LINK_DYNAMIC_ALLOC_H_
+#define LINK_DYNAMIC_ALLOC_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Maximum number of dynamic time slots, which is also the size of the allocation map in the frame header. */
+#ifndef LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT
+#define LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT 8
+#endif
+/*! Maximum number of nodes sharing the dynamic time slots. */
+#ifndef LINK_DYNAMIC_ALLOC_MAX_NODE_COUNT
+#define LINK_DYNAMIC_ALLOC_MAX_NODE_COUNT 8
+#endif
+/*! Allocation map value of a dynamic time slot granted to no node. */
+#define LINK_DYNAMIC_ALLOC_NO_OWNER 0xFF
+/*! Largest time slot index that can be dynamic. */
+#define LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_ID 63
+
+/* TYPES **********************************************************************/
+/** @brief Dynamic time slot allocation.
+ */
+typedef struct link_dynamic_alloc {
+    /*! Module enable flag. */
+    bool enable;
+    /*! Number of dynamic time slots. */
+    uint8_t timeslot_count;
+    /*! Schedule index of every dynamic time slot. */
+    uint8_t timeslot_id[LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT];
+    /*! Dynamic time slots, bit n is the time slot of schedule index n. */
+    uint64_t timeslot_mask;
+    /*! Node address granted every dynamic time slot in the current superframe. */
+    uint8_t owner[LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT];
+    /*! Whether the allocation map applies to the current superframe. */
+    bool map_valid;
+    /*! Superframe the allocation map was last updated for. */
+    uint32_t superframe_count;
+
+    /* Coordinator */
+    /*! Number of nodes sharing the dynamic time slots. */
+    uint8_t node_count;
+    /*! Address of every node. */
+    uint8_t node_address[LINK_DYNAMIC_ALLOC_MAX_NODE_COUNT];
+    /*! Number of frames every node still has to send, as last reported and minus the time slots granted since. */
+    uint8_t node_demand[LINK_DYNAMIC_ALLOC_MAX_NODE_COUNT];
+    /*! Index of the node winning the ties in the next allocation, rotated every superframe for fairness. */
+    uint8_t first_node;
+
+    /* Statistics */
+    /*! Number of dynamic time slots granted to a node. */
+    uint32_t granted_count;
+    /*! Number of dynamic time slots left unused because no node had pending frames. */
+    uint32_t unused_count;
+} link_dynamic_alloc_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the dynamic allocation module, disabled.
+ *
+ *  @param[in] dynamic_alloc  Dynamic allocation instance.
+ */
+void link_dynamic_alloc_init(link_dynamic_alloc_t *dynamic_alloc);
+
+/** @brief Set the dynamic time slots and enable the module.
+ *
+ *  @param[in] dynamic_alloc   Dynamic allocation instance.
+ *  @param[in] timeslot_id     Schedule index of every dynamic time slot.
+ *  @param[in] timeslot_count  Number of dynamic time slots, up to LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT.
+ *  @retval true   Dynamic time slots are set.
+ *  @retval false  Too many time slots or time slot index out of range.
+ */
+bool link_dynamic_alloc_set_timeslots(link_dynamic_alloc_t *dynamic_alloc, const uint8_t *timeslot_id,
+                                      uint8_t timeslot_count);
+
+/** @brief Add a node sharing the dynamic time slots, coordinator side.
+ *
+ *  @param[in] dynamic_alloc  Dynamic allocation instance.
+ *  @param[in] address        Node address.
+ *  @retval true   Node is added, or was already.
+ *  @retval false  Node table is full.
+ */
+bool link_dynamic_alloc_add_node(link_dynamic_alloc_t *dynamic_alloc, uint8_t address);
+
+/** @brief Update the number of frames a node has to send, coordinator side.
+ *
+ *  @param[in] dynamic_alloc  Dynamic allocation instance.
+ *  @param[in] address        Node address.
+ *  @param[in] demand         Number of frames waiting in the node queue.
+ */
+void link_dynamic_alloc_set_demand(link_dynamic_alloc_t *dynamic_alloc, uint8_t address, uint8_t demand);
+
+/** @brief Start a new superframe.
+ *
+ *  The coordinator grants the dynamic time slots of the superframe, one at a time, to the node with the most pending
+ *  frames. A node discards its allocation map until the coordinator sends the one of the new superframe.
+ *
+ *  @param[in] dynamic_alloc     Dynamic allocation instance.
+ *  @param[in] superframe_count  Superframe count of the scheduler.
+ *  @param[in] is_coordinator    Whether the local device is the coordinator.
+ */
+void link_dynamic_alloc_start_superframe(link_dynamic_alloc_t *dynamic_alloc, uint32_t superframe_count,
+                                         bool is_coordinator);
+
+/** @brief Get the owner of a time slot.
+ *
+ *  @param[in]  dynamic_alloc  Dynamic allocation instance.
+ *  @param[in]  timeslot_id    Schedule index of the time slot.
+ *  @param[out] owner          Address of the node granted the time slot, LINK_DYNAMIC_ALLOC_NO_OWNER if none.
+ *  @retval true   Time slot is dynamic.
+ *  @retval false  Time slot is not dynamic, owner is not written.
+ */
+bool link_dynamic_alloc_get_owner(const link_dynamic_alloc_t *dynamic_alloc, uint8_t timeslot_id, uint8_t *owner);
+
+/** @brief Check if a time slot is dynamic.
+ *
+ *  @param[in] dynamic_alloc  Dynamic allocation instance.
+ *  @param[in] timeslot_id    Schedule index of the time slot.
+ *  @retval true   Time slot is dynamic.
+ *  @retval false  Time slot is not dynamic.
+ */
+static inline bool link_dynamic_alloc_is_dynamic_timeslot(const link_dynamic_alloc_t *dynamic_alloc,
+                                                          uint8_t timeslot_id)
+{
+    return (timeslot_id <= LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_ID) &&
+           ((dynamic_alloc->timeslot_mask & ((uint64_t)1 << timeslot_id)) != 0);
+}
+
+/** @brief Write the allocation map to a frame header field.
+ *
+ *  @param[in]  dynamic_alloc  Dynamic allocation instance.
+ *  @param[out] map            Header field of link_dynamic_alloc_get_map_size() bytes.
+ */
+void link_dynamic_alloc_write_map(const link_dynamic_alloc_t *dynamic_alloc, uint8_t *map);
+
+/** @brief Read the allocation map of the current superframe from a frame header field.
+ *
+ *  @param[in] dynamic_alloc  Dynamic allocation instance.
+ *  @param[in] map            Header field of link_dynamic_alloc_get_map_size() bytes.
+ */
+void link_dynamic_alloc_read_map(link_dynamic_alloc_t *dynamic_alloc, const uint8_t *map);
+
+/** @brief Get the size of the allocation map header field.
+ *
+ *  @param[in] dynamic_alloc  Dynamic allocation instance.
+ *  @return Header field size.
+ */
+static inline uint8_t link_dynamic_alloc_get_map_size(const link_dynamic_alloc_t *dynamic_alloc)
+{
+    return dynamic_alloc->timeslot_count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LINK_DYNAMIC_ALLOC_H_ */
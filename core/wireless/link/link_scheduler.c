@@ -14,6 +14,7 @@
 
 /* PRIVATE FUNCTION PROTOTYPES ************************************************/
 static inline bool time_slot_is_empty(scheduler_t *scheduler, timeslot_t *time_slot);
+static void update_priority_order(timeslot_conn_list_t *conn_list);
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 void link_scheduler_init(scheduler_t *scheduler, uint16_t local_addr)
@@ -21,6 +22,7 @@ void link_scheduler_init(scheduler_t *scheduler, uint16_t local_addr)
     // Do not modify scheduler->schedule as it is already initialized prior to calling wps_init().
     scheduler->current_time_slot_num = 0;
     scheduler->sleep_cycles = 0;
+    scheduler->superframe_count = 0;
     scheduler->local_addr = local_addr;
     scheduler->tx_disabled = false;
     scheduler->timeslot_mismatch = false;
@@ -32,9 +34,41 @@ void link_scheduler_reset(scheduler_t *scheduler)
     scheduler->schedule.size = 0;
     scheduler->current_time_slot_num = 0;
     scheduler->sleep_cycles = 0;
+    scheduler->superframe_count = 0;
     scheduler->tx_disabled = false;
 }
 
+void link_scheduler_update_plan(scheduler_t *scheduler)
+{
+    uint32_t size = scheduler->schedule.size;
+
+    for (uint32_t i = 0; i < size; i++) {
+        timeslot_t *time_slot = &scheduler->schedule.timeslot[i];
+        uint32_t next = i;
+        uint32_t increment = 0;
+        uint32_t pll_cycles = 0;
+
+        do {
+            pll_cycles += scheduler->schedule.timeslot[next].duration_pll_cycles;
+            next = (next + 1) % size;
+            increment++;
+        } while (time_slot_is_empty(scheduler, &scheduler->schedule.timeslot[next]) && (increment < size));
+
+        if (time_slot_is_empty(scheduler, &scheduler->schedule.timeslot[next])) {
+            /* Every time slot is empty, step one time slot at a time. */
+            next = (i + 1) % size;
+            increment = 1;
+            pll_cycles = time_slot->duration_pll_cycles;
+        }
+        time_slot->next_timeslot_num = next;
+        time_slot->next_timeslot_increment = increment;
+        time_slot->next_timeslot_pll_cycles = pll_cycles;
+
+        update_priority_order(&time_slot->main_conn_list);
+        update_priority_order(&time_slot->auto_conn_list);
+    }
+}
+
 uint8_t link_scheduler_increment_time_slot(scheduler_t *scheduler)
 {
     uint8_t inc_count = 0;
@@ -42,17 +76,17 @@ uint8_t link_scheduler_increment_time_slot(scheduler_t *scheduler)
     scheduler->timeslot_mismatch = false;
 
     if (scheduler->schedule.size != 0) {
-        uint8_t i = scheduler->current_time_slot_num;
+        timeslot_t *time_slot = &scheduler->schedule.timeslot[scheduler->current_time_slot_num];
 
-        scheduler->current_sleep_lvl = scheduler->schedule.timeslot[i].sleep_lvl;
-        do {
-            scheduler->sleep_cycles += scheduler->schedule.timeslot[i].duration_pll_cycles;
-            i = (i + 1) % scheduler->schedule.size;
-            inc_count++;
-        } while (time_slot_is_empty(scheduler, &scheduler->schedule.timeslot[i]));
+        scheduler->current_sleep_lvl = time_slot->sleep_lvl;
+        scheduler->sleep_cycles += time_slot->next_timeslot_pll_cycles;
+        inc_count = time_slot->next_timeslot_increment;
 
-        scheduler->current_time_slot_num = i;
-        scheduler->next_sleep_lvl = scheduler->schedule.timeslot[i].sleep_lvl;
+        if (time_slot->next_timeslot_num <= scheduler->current_time_slot_num) {
+            scheduler->superframe_count++;
+        }
+        scheduler->current_time_slot_num = time_slot->next_timeslot_num;
+        scheduler->next_sleep_lvl = scheduler->schedule.timeslot[time_slot->next_timeslot_num].sleep_lvl;
     }
 
     return inc_count;
@@ -77,3 +111,22 @@ static inline bool time_slot_is_empty(scheduler_t *scheduler, timeslot_t *time_s
 
     return false;
 }
+
+/** @brief Sort the connection indexes of a time slot by priority.
+ *
+ *  Connections of equal priority keep their index order.
+ *
+ *  @param[in] conn_list  Time slot connection list.
+ */
+static void update_priority_order(timeslot_conn_list_t *conn_list)
+{
+    for (uint8_t i = 0; i < conn_list->connection_count; i++) {
+        uint8_t j = i;
+
+        while ((j > 0) && (conn_list->priority[conn_list->priority_order[j - 1]] > conn_list->priority[i])) {
+            conn_list->priority_order[j] = conn_list->priority_order[j - 1];
+            j--;
+        }
+        conn_list->priority_order[j] = i;
+    }
+}
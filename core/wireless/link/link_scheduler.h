@@ -27,6 +27,8 @@ typedef struct timeslot_conn_list {
     wps_connection_t *connection[WPS_MAX_CONN_PER_TIMESLOT];
     /*! List of priority for connection instances. */
     uint8_t priority[WPS_MAX_CONN_PER_TIMESLOT];
+    /*! Connection indexes sorted by priority, then by index, computed by link_scheduler_update_plan(). */
+    uint8_t priority_order[WPS_MAX_CONN_PER_TIMESLOT];
     /*!  Maximum payload size of all connections. */
     uint8_t max_payload_size;
     /*! Maximum CCA RX timeout offset in PLL cycles of all connections. */
@@ -46,6 +48,12 @@ typedef struct timeslot {
     uint8_t last_used_main_connection;
     /*! Sleep level for this time slot. */
     sleep_lvl_t sleep_lvl;
+    /*! Index of the next non-empty time slot, computed by link_scheduler_update_plan(). */
+    uint8_t next_timeslot_num;
+    /*! Number of time slots from this time slot to the next non-empty time slot. */
+    uint8_t next_timeslot_increment;
+    /*! Duration from the start of this time slot to the start of the next non-empty time slot, in PLL cycles. */
+    uint32_t next_timeslot_pll_cycles;
 } timeslot_t;
 
 /** @brief Schedule instance.
@@ -70,6 +78,8 @@ typedef struct scheduler {
     sleep_lvl_t next_sleep_lvl;
     /*! Sleep time in PLL cycles */
     uint32_t sleep_cycles;
+    /*! Number of times the schedule wrapped around to its first time slot. */
+    uint32_t superframe_count;
     /*! Local Address. */
     uint16_t local_addr;
     /*! TX disabled flag. */
@@ -93,6 +103,16 @@ void link_scheduler_init(scheduler_t *scheduler, uint16_t local_addr);
  */
 void link_scheduler_reset(scheduler_t *scheduler);
 
+/** @brief Compile the schedule into its execution plan.
+ *
+ *  For every time slot, the next non-empty time slot and the sleep time to reach it are computed once, as well as the
+ *  priority order of the connections, so that the MAC does not walk the schedule on every time slot. This must be
+ *  called once the connections are assigned to the schedule and whenever a time slot becomes empty or not empty.
+ *
+ *  @param[in] scheduler  Scheduler object.
+ */
+void link_scheduler_update_plan(scheduler_t *scheduler);
+
 /** @brief Add a time slot to schedule.
  *
  *  @note Sleep cycle is computed based on number of
@@ -122,7 +142,10 @@ static inline void link_scheduler_set_time_slot_i(scheduler_t *scheduler, uint8_
  */
 static inline void link_scheduler_enable_tx(scheduler_t *scheduler)
 {
-    scheduler->tx_disabled = false;
+    if (scheduler->tx_disabled) {
+        scheduler->tx_disabled = false;
+        link_scheduler_update_plan(scheduler);
+    }
 }
 
 /** @brief Disable transmissions.
@@ -131,7 +154,10 @@ static inline void link_scheduler_enable_tx(scheduler_t *scheduler)
  */
 static inline void link_scheduler_disable_tx(scheduler_t *scheduler)
 {
-    scheduler->tx_disabled = true;
+    if (!scheduler->tx_disabled) {
+        scheduler->tx_disabled = true;
+        link_scheduler_update_plan(scheduler);
+    }
 }
 
 /** @brief Get the current time slot.
@@ -0,0 +1,232 @@
+/** @file  link_sr_arq.c
+ *  @brief Selective Repeat Automatic Repeat Query module.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "link_sr_arq.h"
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void slide_tx_window(sr_arq_t *sr_arq);
+static void slide_rx_window(sr_arq_t *sr_arq);
+static uint8_t count_bits(uint8_t bitmap);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void link_sr_arq_init(sr_arq_t *sr_arq, uint8_t window_size, bool enable)
+{
+    if (window_size == 0) {
+        window_size = 1;
+    } else if (window_size > LINK_SR_ARQ_WINDOW_SIZE_MAX) {
+        window_size = LINK_SR_ARQ_WINDOW_SIZE_MAX;
+    }
+
+    sr_arq->window_size = window_size;
+    sr_arq->enable = enable;
+    sr_arq->tx_base_seq = 0;
+    sr_arq->tx_acked = 0;
+    sr_arq->tx_sent = 0;
+    sr_arq->tx_offset = 0;
+    sr_arq->tx_next_offset = 0;
+    sr_arq->rx_base_seq = 0;
+    sr_arq->rx_buffered = 0;
+    sr_arq->rx_slot_base = 0;
+    sr_arq->rx_seq = 0;
+    sr_arq->rx_peer_base_seq = 0;
+    link_sr_arq_reset_stats(sr_arq);
+}
+
+uint8_t link_sr_arq_select_tx_frame(sr_arq_t *sr_arq, uint16_t queue_size)
+{
+    uint8_t count = (queue_size < sr_arq->window_size) ? (uint8_t)queue_size : sr_arq->window_size;
+    uint8_t offset = sr_arq->tx_next_offset;
+
+    if (count == 0) {
+        sr_arq->tx_offset = 0;
+        return 0;
+    }
+
+    if (offset >= count) {
+        offset = 0;
+    }
+    /* Skip the frames already acknowledged but not yet released because an older one is still in flight. */
+    for (uint8_t i = 0; i < count; i++) {
+        if ((sr_arq->tx_acked & (1 << offset)) == 0) {
+            break;
+        }
+        offset = (offset + 1 < count) ? (offset + 1) : 0;
+    }
+    sr_arq->tx_offset = offset;
+
+    return offset;
+}
+
+void link_sr_arq_tx_done(sr_arq_t *sr_arq, bool acked)
+{
+    sr_arq->tx_sent |= (1 << sr_arq->tx_offset);
+    if (acked) {
+        sr_arq->tx_acked |= (1 << sr_arq->tx_offset);
+    }
+    sr_arq->tx_next_offset = sr_arq->tx_offset + 1;
+}
+
+uint8_t link_sr_arq_tx_ack_update(sr_arq_t *sr_arq, uint8_t rx_base_seq, uint8_t bitmap)
+{
+    uint8_t delivered = (uint8_t)(rx_base_seq - sr_arq->tx_base_seq);
+    uint16_t acked = 0;
+    uint8_t new_acked = 0;
+
+    /* The peer can not be ahead by more than the window, anything else is an outdated field. */
+    if (delivered > sr_arq->window_size) {
+        return 0;
+    }
+
+    /* Every frame before the next expected one has been received. */
+    acked = (1 << delivered) - 1;
+    /* The expected frame itself is missing, the bitmap starts right after it. */
+    acked |= (uint16_t)bitmap << (delivered + 1);
+    acked &= (1 << sr_arq->window_size) - 1;
+    /* Only frames in flight can be acknowledged, a bit for a frame not sent yet comes from an outdated field. */
+    acked &= sr_arq->tx_sent;
+
+    new_acked = (uint8_t)acked & ~sr_arq->tx_acked;
+    sr_arq->tx_acked |= new_acked;
+    sr_arq->bitmap_ack_count += count_bits(new_acked);
+
+    return count_bits(new_acked);
+}
+
+bool link_sr_arq_tx_release(sr_arq_t *sr_arq)
+{
+    if ((sr_arq->tx_acked & 1) == 0) {
+        return false;
+    }
+    slide_tx_window(sr_arq);
+
+    return true;
+}
+
+void link_sr_arq_tx_skip(sr_arq_t *sr_arq, uint16_t count)
+{
+    while (count > 0) {
+        slide_tx_window(sr_arq);
+        count--;
+    }
+}
+
+sr_arq_rx_status_t link_sr_arq_rx_classify(sr_arq_t *sr_arq, uint8_t *slot)
+{
+    uint8_t offset = (uint8_t)(sr_arq->rx_seq - sr_arq->rx_base_seq);
+
+    if (offset == 0) {
+        return SR_ARQ_RX_IN_ORDER;
+    }
+    /* Past the window, the frame is a retransmission of one already delivered. */
+    if ((offset >= sr_arq->window_size) || (sr_arq->rx_buffered & (1 << offset))) {
+        return SR_ARQ_RX_DUPLICATE;
+    }
+    *slot = (sr_arq->rx_slot_base + offset) % sr_arq->window_size;
+
+    return SR_ARQ_RX_OUT_OF_ORDER;
+}
+
+void link_sr_arq_rx_accept(sr_arq_t *sr_arq, sr_arq_rx_status_t status)
+{
+    uint8_t offset = (uint8_t)(sr_arq->rx_seq - sr_arq->rx_base_seq);
+
+    switch (status) {
+    case SR_ARQ_RX_IN_ORDER:
+        slide_rx_window(sr_arq);
+        break;
+    case SR_ARQ_RX_OUT_OF_ORDER:
+        sr_arq->rx_buffered |= (1 << offset);
+        sr_arq->out_of_order_count++;
+        break;
+    default:
+        break;
+    }
+}
+
+bool link_sr_arq_rx_pop(sr_arq_t *sr_arq, uint8_t *slot, bool *buffered)
+{
+    uint8_t peer_lag = (uint8_t)(sr_arq->rx_base_seq - sr_arq->rx_peer_base_seq);
+    uint8_t peer_lead = (uint8_t)(sr_arq->rx_peer_base_seq - sr_arq->rx_base_seq);
+
+    if (sr_arq->rx_buffered & 1) {
+        *slot = sr_arq->rx_slot_base;
+        *buffered = true;
+        slide_rx_window(sr_arq);
+        return true;
+    }
+
+    /* The transmitter window base trails the receiver by at most the window while ACKs are in flight, any other value
+     * means the transmitter gave up the expected frame.
+     */
+    if (peer_lag <= sr_arq->window_size) {
+        return false;
+    }
+
+    if (sr_arq->rx_buffered == 0) {
+        /* Nothing held back, resynchronize in one step. */
+        sr_arq->skipped_count += peer_lead;
+        sr_arq->rx_base_seq = sr_arq->rx_peer_base_seq;
+        return false;
+    }
+
+    *buffered = false;
+    sr_arq->skipped_count++;
+    slide_rx_window(sr_arq);
+
+    return true;
+}
+
+uint8_t link_sr_arq_get_rx_buffered_count(sr_arq_t *sr_arq)
+{
+    return count_bits(sr_arq->rx_buffered);
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Slide the transmit window by one frame.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ */
+static void slide_tx_window(sr_arq_t *sr_arq)
+{
+    sr_arq->tx_acked >>= 1;
+    sr_arq->tx_sent >>= 1;
+    sr_arq->tx_base_seq++;
+    if (sr_arq->tx_next_offset > 0) {
+        sr_arq->tx_next_offset--;
+    }
+}
+
+/** @brief Slide the receive window by one frame.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ */
+static void slide_rx_window(sr_arq_t *sr_arq)
+{
+    sr_arq->rx_buffered >>= 1;
+    sr_arq->rx_base_seq++;
+    sr_arq->rx_slot_base = (sr_arq->rx_slot_base + 1) % sr_arq->window_size;
+}
+
+/** @brief Count the bits set in a bitmap.
+ *
+ *  @param[in] bitmap  Bitmap.
+ *  @return Number of bits set.
+ */
+static uint8_t count_bits(uint8_t bitmap)
+{
+    uint8_t count = 0;
+
+    while (bitmap != 0) {
+        bitmap &= (uint8_t)(bitmap - 1);
+        count++;
+    }
+
+    return count;
+}
@@ -0,0 +1,242 @@
+/** @file  link_sr_arq.h
+ *  @brief Selective Repeat Automatic Repeat Query module.
+ *
+ *  The transmitter keeps up to window size frames in flight. Each frame carries an 8-bit sequence number and the
+ *  sequence number of the oldest frame still held by the transmitter (window base). The receiver acknowledges with its
+ *  next expected sequence number and a bitmap of the frames it already buffered after it, so a frame whose ACK was lost
+ *  is not sent again. Frames received out of order are held back until the missing ones arrive or until the
+ *  transmitter window base moves past them because they were dropped.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef LINK_SR_ARQ_H_
+#define LINK_SR_ARQ_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Maximum number of frames in flight, bounded by the ACK bitmap size. */
+#define LINK_SR_ARQ_WINDOW_SIZE_MAX 8
+/*! Size of the selective repeat field in the frame header: sequence number and window base. */
+#define LINK_SR_ARQ_HEADER_SIZE 2
+/*! Size of the selective repeat field in the ACK frame header: next expected sequence number and bitmap. */
+#define LINK_SR_ARQ_ACK_HEADER_SIZE 2
+
+/* TYPES **********************************************************************/
+/** @brief Classification of a received frame.
+ */
+typedef enum sr_arq_rx_status {
+    /*! Frame is the next expected one and can be delivered. */
+    SR_ARQ_RX_IN_ORDER = 0,
+    /*! Frame is inside the window but a previous one is missing, it must be held back. */
+    SR_ARQ_RX_OUT_OF_ORDER,
+    /*! Frame was already received. */
+    SR_ARQ_RX_DUPLICATE,
+} sr_arq_rx_status_t;
+
+/** @brief Selective Repeat ARQ.
+ */
+typedef struct sr_arq {
+    /*! Number of frames in flight. */
+    uint8_t window_size;
+    /*! Module enable flag. */
+    bool enable;
+
+    /* Transmitter */
+    /*! Sequence number of the oldest unacknowledged frame, which is the head of the TX queue. */
+    uint8_t tx_base_seq;
+    /*! Acknowledged frames, bit n is the frame with sequence number tx_base_seq + n. */
+    uint8_t tx_acked;
+    /*! Frames sent at least once, bit n is the frame with sequence number tx_base_seq + n. */
+    uint8_t tx_sent;
+    /*! Window offset of the frame being sent. */
+    uint8_t tx_offset;
+    /*! Window offset where the search for the next frame to send starts. */
+    uint8_t tx_next_offset;
+
+    /* Receiver */
+    /*! Next expected sequence number. */
+    uint8_t rx_base_seq;
+    /*! Frames held back, bit n is the frame with sequence number rx_base_seq + n. */
+    uint8_t rx_buffered;
+    /*! Reorder slot of the frame with sequence number rx_base_seq. */
+    uint8_t rx_slot_base;
+    /*! Sequence number of the last received frame. */
+    uint8_t rx_seq;
+    /*! Transmitter window base of the last received frame. */
+    uint8_t rx_peer_base_seq;
+
+    /* Statistics */
+    /*! Number of frames received out of order. */
+    uint32_t out_of_order_count;
+    /*! Number of frames skipped because the transmitter dropped them. */
+    uint32_t skipped_count;
+    /*! Number of frames acknowledged by the ACK bitmap only. */
+    uint32_t bitmap_ack_count;
+} sr_arq_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the selective repeat ARQ object.
+ *
+ *  @param[in] sr_arq       Selective repeat ARQ object.
+ *  @param[in] window_size  Number of frames in flight, from 1 to LINK_SR_ARQ_WINDOW_SIZE_MAX.
+ *  @param[in] enable       Enable flag.
+ */
+void link_sr_arq_init(sr_arq_t *sr_arq, uint8_t window_size, bool enable);
+
+/** @brief Select the next frame to send.
+ *
+ *  Unacknowledged frames of the window are sent in turn, so a frame that failed does not block the following ones.
+ *
+ *  @param[in] sr_arq       Selective repeat ARQ object.
+ *  @param[in] queue_size   Number of frames in the TX queue.
+ *  @return Window offset of the frame to send, which is also its position in the TX queue.
+ */
+uint8_t link_sr_arq_select_tx_frame(sr_arq_t *sr_arq, uint16_t queue_size);
+
+/** @brief Record the outcome of the frame being sent.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @param[in] acked   The frame has been acknowledged.
+ */
+void link_sr_arq_tx_done(sr_arq_t *sr_arq, bool acked);
+
+/** @brief Apply the acknowledgment field received from the peer.
+ *
+ *  Only the frames sent and not yet released are acknowledged, so a repeated or outdated field never acknowledges a
+ *  frame twice nor a frame that was not sent.
+ *
+ *  @param[in] sr_arq       Selective repeat ARQ object.
+ *  @param[in] rx_base_seq  Next sequence number expected by the peer.
+ *  @param[in] bitmap       Frames buffered by the peer, bit n is the frame with sequence number rx_base_seq + 1 + n.
+ *  @return Number of frames acknowledged for the first time.
+ */
+uint8_t link_sr_arq_tx_ack_update(sr_arq_t *sr_arq, uint8_t rx_base_seq, uint8_t bitmap);
+
+/** @brief Slide the window over the oldest frame if it is acknowledged.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @retval true   The oldest frame is acknowledged and must be removed from the TX queue.
+ *  @retval false  The oldest frame is still in flight.
+ */
+bool link_sr_arq_tx_release(sr_arq_t *sr_arq);
+
+/** @brief Slide the window over frames removed from the TX queue without being acknowledged.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @param[in] count   Number of frames removed from the head of the TX queue.
+ */
+void link_sr_arq_tx_skip(sr_arq_t *sr_arq, uint16_t count);
+
+/** @brief Classify the last received frame.
+ *
+ *  @param[in]  sr_arq  Selective repeat ARQ object.
+ *  @param[out] slot    Reorder slot where an out of order frame must be held.
+ *  @return Frame classification.
+ */
+sr_arq_rx_status_t link_sr_arq_rx_classify(sr_arq_t *sr_arq, uint8_t *slot);
+
+/** @brief Accept the last received frame once it has been delivered or held back.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @param[in] status  Classification returned by link_sr_arq_rx_classify().
+ */
+void link_sr_arq_rx_accept(sr_arq_t *sr_arq, sr_arq_rx_status_t status);
+
+/** @brief Advance the receive window over frames that can no longer be waited for.
+ *
+ *  Call repeatedly until it returns false. A held back frame becomes deliverable when all the previous ones were
+ *  received or dropped by the transmitter.
+ *
+ *  @param[in]  sr_arq    Selective repeat ARQ object.
+ *  @param[out] slot      Reorder slot of the frame to deliver.
+ *  @param[out] buffered  True if the slot holds a frame, false if the frame was dropped by the transmitter.
+ *  @retval true   The window advanced by one frame.
+ *  @retval false  The window is waiting for the next expected frame.
+ */
+bool link_sr_arq_rx_pop(sr_arq_t *sr_arq, uint8_t *slot, bool *buffered);
+
+/** @brief Get the number of frames held back.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @return Number of frames held back.
+ */
+uint8_t link_sr_arq_get_rx_buffered_count(sr_arq_t *sr_arq);
+
+/** @brief Get the sequence number of the frame being sent.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @return Sequence number.
+ */
+static inline uint8_t link_sr_arq_get_tx_seq_num(sr_arq_t *sr_arq)
+{
+    return (uint8_t)(sr_arq->tx_base_seq + sr_arq->tx_offset);
+}
+
+/** @brief Get the window offset of the frame being sent.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @return Window offset.
+ */
+static inline uint8_t link_sr_arq_get_tx_offset(sr_arq_t *sr_arq)
+{
+    return sr_arq->tx_offset;
+}
+
+/** @brief Store the selective repeat field of a received frame.
+ *
+ *  @param[in] sr_arq         Selective repeat ARQ object.
+ *  @param[in] seq_num        Sequence number of the frame.
+ *  @param[in] peer_base_seq  Window base of the transmitter.
+ */
+static inline void link_sr_arq_update_rx_seq_num(sr_arq_t *sr_arq, uint8_t seq_num, uint8_t peer_base_seq)
+{
+    sr_arq->rx_seq = seq_num;
+    sr_arq->rx_peer_base_seq = peer_base_seq;
+}
+
+/** @brief Get the bitmap of frames held back, as sent in the ACK field.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @return Bitmap, bit n is the frame with sequence number rx_base_seq + 1 + n.
+ */
+static inline uint8_t link_sr_arq_get_rx_bitmap(sr_arq_t *sr_arq)
+{
+    return (uint8_t)(sr_arq->rx_buffered >> 1);
+}
+
+/** @brief Return if selective repeat is enabled.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ *  @retval true   Selective repeat is enabled.
+ *  @retval false  Selective repeat is disabled.
+ */
+static inline bool link_sr_arq_is_enabled(sr_arq_t *sr_arq)
+{
+    return sr_arq->enable;
+}
+
+/** @brief Reset the selective repeat ARQ object stats.
+ *
+ *  @param[in] sr_arq  Selective repeat ARQ object.
+ */
+static inline void link_sr_arq_reset_stats(sr_arq_t *sr_arq)
+{
+    sr_arq->out_of_order_count = 0;
+    sr_arq->skipped_count = 0;
+    sr_arq->bitmap_ack_count = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* LINK_SR_ARQ_H_ */
@@ -145,7 +145,7 @@ nvm_power_adjust_t wps_radio_get_power_adjust(wps_radio_t *wps_radio)
 
 void wps_init_callback_queue(wps_t *wps, wps_callback_inst_t *callback_buffer, size_t size)
 {
-    circular_queue_init(&wps->mac.callback_queue, callback_buffer, size, sizeof(wps_callback_inst_t));
+    spsc_queue_init(&wps->mac.callback_queue, callback_buffer, size, sizeof(wps_callback_inst_t));
 }
 
 void wps_init_request_queue(wps_t *wps, xlayer_request_info_t *request_buffer, size_t size,
@@ -334,6 +334,9 @@ uint8_t wps_get_connection_header_size(wps_t *wps, const wps_connection_t *conne
 
     header_size += header_cfg.connection_id ? wps_mac_get_connection_id_proto_size(&wps->mac) : 0;
     header_size += header_cfg.credit_fc_enabled ? wps_mac_get_credit_flow_control_proto_size(&wps->mac) : 0;
+    header_size += header_cfg.sr_arq_enabled ? wps_mac_get_sr_arq_proto_size(&wps->mac) : 0;
+    header_size += header_cfg.dynamic_alloc_map_enabled ? wps_mac_get_dynamic_alloc_map_proto_size(&wps->mac) : 0;
+    header_size += header_cfg.queue_depth_enabled ? wps_mac_get_queue_depth_proto_size(&wps->mac) : 0;
 
     return header_size;
 }
@@ -350,6 +353,7 @@ uint8_t wps_get_connection_ack_header_size(wps_t *wps, const wps_connection_t *c
     }
     header_size += header_cfg.connection_id ? wps_mac_get_connection_id_proto_size(&wps->mac) : 0;
     header_size += header_cfg.credit_fc_enabled ? wps_mac_get_credit_flow_control_proto_size(&wps->mac) : 0;
+    header_size += header_cfg.sr_arq_enabled ? wps_mac_get_sr_arq_ack_proto_size(&wps->mac) : 0;
 
     return header_size;
 }
@@ -499,6 +503,37 @@ void wps_configure_header_connection(wps_t *wps, wps_connection_t *connection, w
 
         link_protocol_add(&connection->link_protocol, &link_proto_info, &link_err);
     }
+
+    /* Must follow the connection ID field since it identifies the connection the sequence number belongs to. */
+    if (header_cfg.sr_arq_enabled == true) {
+        link_proto_info.id = MAC_PROTO_ID_SR_ARQ;
+        link_proto_info.instance = &wps->mac;
+        link_proto_info.send = wps_mac_send_sr_arq;
+        link_proto_info.receive = wps_mac_receive_sr_arq;
+        link_proto_info.size = wps_mac_get_sr_arq_proto_size(&wps->mac);
+
+        link_protocol_add(&connection->link_protocol, &link_proto_info, &link_err);
+    }
+
+    if (header_cfg.dynamic_alloc_map_enabled == true) {
+        link_proto_info.id = MAC_PROTO_ID_DYNAMIC_ALLOC_MAP;
+        link_proto_info.instance = &wps->mac;
+        link_proto_info.send = wps_mac_send_dynamic_alloc_map;
+        link_proto_info.receive = wps_mac_receive_dynamic_alloc_map;
+        link_proto_info.size = wps_mac_get_dynamic_alloc_map_proto_size(&wps->mac);
+
+        link_protocol_add(&connection->link_protocol, &link_proto_info, &link_err);
+    }
+
+    if (header_cfg.queue_depth_enabled == true) {
+        link_proto_info.id = MAC_PROTO_ID_QUEUE_DEPTH;
+        link_proto_info.instance = &wps->mac;
+        link_proto_info.send = wps_mac_send_queue_depth;
+        link_proto_info.receive = wps_mac_receive_queue_depth;
+        link_proto_info.size = wps_mac_get_queue_depth_proto_size(&wps->mac);
+
+        link_protocol_add(&connection->link_protocol, &link_proto_info, &link_err);
+    }
 }
 
 void wps_configure_header_acknowledge(wps_t *wps, wps_connection_t *connection, wps_error_t *err)
@@ -568,6 +603,16 @@ void wps_configure_header_acknowledge(wps_t *wps, wps_connection_t *connection,
 
         link_protocol_add(connection->auto_link_protocol, &link_proto_info, &link_err);
     }
+
+    if (header_cfg.sr_arq_enabled == true) {
+        link_proto_info.id = MAC_PROTO_ID_SR_ARQ;
+        link_proto_info.instance = &wps->mac;
+        link_proto_info.send = wps_mac_send_sr_arq_header_acknowledge;
+        link_proto_info.receive = wps_mac_receive_sr_arq_header_acknowledge;
+        link_proto_info.size = wps_mac_get_sr_arq_ack_proto_size(&wps->mac);
+
+        link_protocol_add(connection->auto_link_protocol, &link_proto_info, &link_err);
+    }
 }
 
 void wps_create_connection(wps_connection_t *connection, wps_node_t *node, wps_connection_cfg_t *config,
@@ -822,6 +867,52 @@ void wps_connection_disable_stop_and_wait_arq(wps_connection_t *connection, wps_
     link_saw_arq_init(&connection->stop_and_wait_arq, 0, 0, false, false);
 }
 
+void wps_connection_enable_selective_repeat_arq(wps_connection_t *connection, uint8_t window_size,
+                                                uint8_t *rx_payload_buffer, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+    CHECK_ERROR(connection->ack_enable == false, err, WPS_ACK_DISABLED_ERROR, return);
+    CHECK_ERROR((window_size < 2) || (window_size > LINK_SR_ARQ_WINDOW_SIZE_MAX), err, WPS_ARQ_WINDOW_SIZE_ERROR,
+                return);
+    CHECK_ERROR(rx_payload_buffer == NULL, err, WPS_NOT_ENOUGH_MEMORY_ERROR, return);
+
+    memset(connection->sr_arq_rx_node, 0, sizeof(connection->sr_arq_rx_node));
+    connection->sr_arq_rx_payload = rx_payload_buffer;
+    link_sr_arq_init(&connection->selective_repeat_arq, window_size, true);
+}
+
+void wps_connection_disable_selective_repeat_arq(wps_connection_t *connection, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+
+    /* Frames held back are lost, their payload lives in the reorder buffer so only the nodes are released. */
+    for (uint8_t i = 0; i < LINK_SR_ARQ_WINDOW_SIZE_MAX; i++) {
+        if (connection->sr_arq_rx_node[i] != NULL) {
+            connection->sr_arq_rx_node[i]->xlayer.frame.payload_memory = NULL;
+            connection->sr_arq_rx_node[i]->xlayer.frame.max_frame_size = 0;
+            xlayer_queue_free_node(connection->sr_arq_rx_node[i]);
+            connection->sr_arq_rx_node[i] = NULL;
+        }
+    }
+    link_sr_arq_init(&connection->selective_repeat_arq, 1, false);
+}
+
+void wps_connection_enable_adaptive_cca(wps_connection_t *connection, link_cca_adaptive_channel_t *channel_buffer,
+                                        uint32_t seed, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+    CHECK_ERROR(channel_buffer == NULL, err, WPS_NOT_ENOUGH_MEMORY_ERROR, return);
+
+    link_cca_adaptive_init(&connection->cca_adaptive, channel_buffer, connection->max_channel_count, seed);
+}
+
+void wps_connection_disable_adaptive_cca(wps_connection_t *connection, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+
+    link_cca_adaptive_disable(&connection->cca_adaptive);
+}
+
 void wps_connection_enable_auto_sync(wps_connection_t *connection, wps_error_t *err)
 {
     *err = WPS_NO_ERROR;
@@ -914,6 +1005,35 @@ void wps_disable_ddcm(wps_t *wps, wps_error_t *err)
     link_ddcm_init(&wps->mac.link_ddcm, DDCM_DISABLE, 0);
 }
 
+void wps_set_dynamic_allocation(wps_t *wps, const uint8_t *timeslot_id, uint8_t timeslot_count, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+
+    CHECK_ERROR(WPS_DISABLE_DYNAMIC_ALLOCATION, err, WPS_DYNAMIC_ALLOCATION_ERROR, return);
+    CHECK_ERROR(timeslot_id == NULL, err, WPS_DYNAMIC_ALLOCATION_ERROR, return);
+    for (uint8_t i = 0; i < timeslot_count; i++) {
+        CHECK_ERROR(timeslot_id[i] >= wps->mac.scheduler.schedule.size, err, WPS_DYNAMIC_ALLOCATION_ERROR, return);
+    }
+    CHECK_ERROR(!link_dynamic_alloc_set_timeslots(&wps->mac.dynamic_alloc, timeslot_id, timeslot_count), err,
+                WPS_DYNAMIC_ALLOCATION_ERROR, return);
+}
+
+void wps_disable_dynamic_allocation(wps_t *wps, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+
+    link_dynamic_alloc_init(&wps->mac.dynamic_alloc);
+}
+
+void wps_add_dynamic_allocation_node(wps_t *wps, uint16_t address, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+
+    CHECK_ERROR(!wps->mac.dynamic_alloc.enable, err, WPS_DYNAMIC_ALLOCATION_ERROR, return);
+    CHECK_ERROR(!link_dynamic_alloc_add_node(&wps->mac.dynamic_alloc, (uint8_t)address), err,
+                WPS_DYNAMIC_ALLOCATION_ERROR, return);
+}
+
 void wps_connection_config_status(wps_connection_t *connection, connect_status_cfg_t *status_cfg, wps_error_t *err)
 {
     *err = WPS_NO_ERROR;
@@ -1011,6 +1131,7 @@ void wps_connect(wps_t *wps, wps_error_t *err)
         wps_phy_init(&wps->phy[i], &phy_cfg);
     }
 
+    link_scheduler_update_plan(&wps->mac.scheduler);
     wps_mac_reset(&wps->mac);
     wps_phy_connect(wps->phy);
 }
@@ -1179,6 +1300,38 @@ void wps_send(wps_connection_t *connection, const uint8_t *payload, uint8_t size
     connection->tx_node = NULL;
 }
 
+void wps_sendv(wps_connection_t *connection, const wps_payload_segment_t *segments, uint8_t segment_count,
+               wps_error_t *err)
+{
+    uint8_t *payload = NULL;
+    uint32_t size = 0;
+    uint16_t offset = 0;
+
+    *err = WPS_NO_ERROR;
+
+    if (segment_count == 1) {
+        CHECK_ERROR(segments[0].size > UINT8_MAX, err, WPS_WRONG_TX_SIZE_ERROR, return);
+        wps_send(connection, segments[0].payload, segments[0].size, err);
+        return;
+    }
+
+    for (uint8_t i = 0; i < segment_count; i++) {
+        size += segments[i].size;
+    }
+    CHECK_ERROR((size > UINT8_MAX) || (size > connection->payload_size && (connection->payload_size != 0)), err,
+                WPS_WRONG_TX_SIZE_ERROR, return);
+
+    wps_get_free_slot(connection, &payload, size, err);
+    if (*err != WPS_NO_ERROR) {
+        return;
+    }
+    for (uint8_t i = 0; i < segment_count; i++) {
+        memcpy(&payload[offset], segments[i].payload, segments[i].size);
+        offset += segments[i].size;
+    }
+    wps_send(connection, payload, size, err);
+}
+
 wps_rx_frame wps_read(wps_connection_t *connection, wps_error_t *err)
 {
     wps_rx_frame frame_out = {0};
@@ -1342,12 +1495,11 @@ void wps_process_callback(wps_t *wps)
     /* Process MAC connection statistics */
     wps_mac_statistics_process_data(&wps->mac.stats_process_data);
 
-    while (circular_queue_is_empty(&wps->mac.callback_queue) == false) {
-        callback = circular_queue_front(&wps->mac.callback_queue);
-        if (callback != NULL && callback->func != NULL) {
+    while ((callback = spsc_queue_front(&wps->mac.callback_queue)) != NULL) {
+        if (callback->func != NULL) {
             callback->func(callback->conn, callback->parg);
         }
-        circular_queue_dequeue(&wps->mac.callback_queue);
+        spsc_queue_dequeue(&wps->mac.callback_queue);
     }
 
     wps->node.low_power_allowed = true;
@@ -245,7 +245,9 @@ void wps_set_vref_tune_offset_enabled_flag(wps_radio_t *node, bool vref_tune_off
  *  be executed by the application.
  *
  *  The size of the callback buffer should be equal to the size
- *  of the biggest Xlayer queue.
+ *  of the biggest Xlayer queue, rounded up to a power of two with
+ *  spsc_queue_round_capacity(). A size that is not a power of two
+ *  is rounded down.
  *
  *  @param[in] wps              Wireless Protocol Stack instance.
  *  @param[in] callback_buffer  Array of callback function pointer.
@@ -439,6 +441,39 @@ void wps_enable_ddcm(wps_t *wps, uint16_t max_timeslot_offset, uint32_t sync_los
  */
 void wps_disable_ddcm(wps_t *wps, wps_error_t *err);
 
+/** @brief Share time slots between the nodes with a demand-driven allocation.
+ *
+ *  At the start of every superframe, the coordinator grants the dynamic time slots to the nodes with the most frames
+ *  waiting in their queue and sends the allocation in the header of the frames of its main connections. Time slots not
+ *  granted to the local device are slept over. Every device must keep at least one time slot that is not dynamic, and
+ *  the coordinator main connection frames should be scheduled before the dynamic time slots, as a node only uses the
+ *  allocation received during the current superframe.
+ *
+ *  @note This must be called before the connection headers are configured, the allocation map size depends on the
+ *        number of dynamic time slots.
+ *
+ *  @param[in]  wps             Wireless Protocol Stack instance.
+ *  @param[in]  timeslot_id     Schedule index of every dynamic time slot.
+ *  @param[in]  timeslot_count  Number of dynamic time slots, up to LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT.
+ *  @param[out] err             Pointer to the error code.
+ */
+void wps_set_dynamic_allocation(wps_t *wps, const uint8_t *timeslot_id, uint8_t timeslot_count, wps_error_t *err);
+
+/** @brief Disable the dynamic time slot allocation.
+ *
+ *  @param[in]  wps  Wireless Protocol Stack instance.
+ *  @param[out] err  Pointer to the error code.
+ */
+void wps_disable_dynamic_allocation(wps_t *wps, wps_error_t *err);
+
+/** @brief Add a node sharing the dynamic time slots, coordinator side.
+ *
+ *  @param[in]  wps      Wireless Protocol Stack instance.
+ *  @param[in]  address  Node address.
+ *  @param[out] err      Pointer to the error code.
+ */
+void wps_add_dynamic_allocation_node(wps_t *wps, uint16_t address, wps_error_t *err);
+
 /** @brief Configure connection status information.
  *
  *  @param[in]  connection  Connection instance.
@@ -669,6 +704,55 @@ void wps_connection_enable_stop_and_wait_arq(wps_connection_t *connection, uint1
  */
 void wps_connection_disable_stop_and_wait_arq(wps_connection_t *connection, wps_error_t *err);
 
+/** @brief Enable Selective Repeat (SR) on top of the SaW ARQ for connection's packet.
+ *
+ *  Up to window size frames are kept in flight. A frame that is not acknowledged is retransmitted
+ *  later without blocking the following ones and the receiver reorders the frames before delivery.
+ *
+ *  @note This function must be called after wps_connection_enable_stop_and_wait_arq. Both
+ *        ends of the connection must use the same window size.
+ *
+ *  @param[in]  connection         Connection instance.
+ *  @param[in]  window_size        Number of frames in flight, from 2 to LINK_SR_ARQ_WINDOW_SIZE_MAX.
+ *  @param[in]  rx_payload_buffer  Reorder buffer of window_size * payload size bytes.
+ *  @param[out] err                Pointer to the error code.
+ */
+void wps_connection_enable_selective_repeat_arq(wps_connection_t *connection, uint8_t window_size,
+                                                uint8_t *rx_payload_buffer, wps_error_t *err);
+
+/** @brief Disable Selective Repeat (SR) for connection's packet.
+ *
+ *  The connection falls back to the SaW ARQ with a single frame in flight.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ */
+void wps_connection_disable_selective_repeat_arq(wps_connection_t *connection, wps_error_t *err);
+
+/** @brief Enable the adaptive CCA backoff for connection's packet.
+ *
+ *  The busy level of every channel is learned from the CCA tries. The CCA retry time is then drawn at random in a
+ *  window that grows with the channel busy level and the try budget is halved on persistently busy channels when the
+ *  fail action is to abort the transmission.
+ *
+ *  @note The retry time is only randomized on network nodes, the coordinator keeps the configured one as the nodes
+ *        rely on it to compensate the CCA delay in their synchronization.
+ *
+ *  @param[in]  connection      Connection instance.
+ *  @param[in]  channel_buffer  Statistics storage of max_channel_count channels.
+ *  @param[in]  seed            Retry time pseudo-random generator seed, unique to the device.
+ *  @param[out] err             Pointer to the error code.
+ */
+void wps_connection_enable_adaptive_cca(wps_connection_t *connection, link_cca_adaptive_channel_t *channel_buffer,
+                                        uint32_t seed, wps_error_t *err);
+
+/** @brief Disable the adaptive CCA backoff for connection's packet.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ */
+void wps_connection_disable_adaptive_cca(wps_connection_t *connection, wps_error_t *err);
+
 /** @brief Enable auto-sync mode.
  *
  * If this mode is enabled, when the cross-layer queue is empty,
@@ -891,6 +975,19 @@ void wps_get_free_slot(wps_connection_t *connection, uint8_t **payload, uint16_t
  */
 void wps_send(wps_connection_t *connection, const uint8_t *payload, uint8_t size, wps_error_t *err);
 
+/** @brief Send a payload gathered from several segments over the air.
+ *
+ *  A single segment is referenced like with wps_send(). Several segments are copied in a slot of the WPS queue,
+ *  without assembling the payload in an intermediate buffer.
+ *
+ *  @param[in]  connection     Connection instance.
+ *  @param[in]  segments       Application payload segments to send over the air, in order.
+ *  @param[in]  segment_count  Number of segments.
+ *  @param[out] err            Pointer to the error code.
+ */
+void wps_sendv(wps_connection_t *connection, const wps_payload_segment_t *segments, uint8_t segment_count,
+               wps_error_t *err);
+
 /** @brief Read last received frame.
  *
  *  @param[in]  connection  Connection instance.
@@ -0,0 +1,318 @@
+/** @file  wps_aggr.c
+ *  @brief WPS Aggregation module.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "wps_aggr.h"
+#include "critical_section.h"
+#include "wps.h"
+#include "wps_config.h"
+#include "wps_mac_xlayer.h"
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void commit_tx_frame(wps_connection_t *connection, wps_error_t *err);
+static bool is_tx_frame_due(wps_connection_t *connection);
+static uint16_t count_sdus(const uint8_t *payload, size_t size);
+static void wps_aggr_read_process(void *conn, void *arg);
+static void wps_aggr_tx_success_callback(void *conn, void *parg);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void wps_aggr_init(wps_connection_t *connection, uint32_t max_hold_time, wps_error_t *err)
+{
+    aggr_t *aggr;
+
+    *err = WPS_NO_ERROR;
+
+    CHECK_ERROR(connection == NULL, err, WPS_CONNECTION_NOT_ALLOCATED, return);
+#if !WPS_DISABLE_FRAGMENTATION
+    CHECK_ERROR(connection->frag.enabled, err, WPS_AGGREGATION_ERROR, return);
+#endif
+    CHECK_ERROR(connection->payload_size <= WPS_AGGR_SDU_HEADER_SIZE, err, WPS_WRONG_TX_SIZE_ERROR, return);
+
+    aggr = &connection->aggr;
+    aggr->enabled = true;
+    aggr->tx_frame = NULL;
+    aggr->tx_frame_size = 0;
+    aggr->max_hold_time = max_hold_time;
+    aggr->enqueued_count = 0;
+
+    if (connection->is_tx_connection) {
+        /* Keep the callback set beforehand, it is now raised by the aggregation module. */
+        aggr->tx_success_callback = connection->tx_success_callback;
+        aggr->tx_success_parg_callback = connection->tx_success_parg_callback;
+        wps_set_tx_success_callback(connection, wps_aggr_tx_success_callback, (void *)connection, err);
+        CHECK_ERROR(*err != WPS_NO_ERROR, err, WPS_FRAG_FAILED_TO_SET_CALLBACK, return);
+    } else {
+        aggr->rx_success_callback = connection->rx_success_callback;
+        aggr->rx_success_parg_callback = connection->rx_success_parg_callback;
+        connection->rx_queue = &aggr->xlayer_queue;
+        xlayer_queue_init_queue(&aggr->xlayer_queue, connection->xlayer_queue.max_size, "aggr queue");
+        wps_set_rx_success_callback(connection, wps_aggr_read_process, (void *)connection, err);
+        CHECK_ERROR(*err != WPS_NO_ERROR, err, WPS_FRAG_FAILED_TO_SET_CALLBACK, return);
+    }
+}
+
+void wps_aggr_send(wps_connection_t *connection, const uint8_t *payload, uint16_t size, wps_error_t *err)
+{
+    wps_payload_segment_t segment = {
+        .payload = payload,
+        .size = size,
+    };
+
+    wps_aggr_sendv(connection, &segment, 1, err);
+}
+
+void wps_aggr_sendv(wps_connection_t *connection, const wps_payload_segment_t *segments, uint8_t segment_count,
+                    wps_error_t *err)
+{
+    aggr_t *aggr = &connection->aggr;
+    uint32_t size = 0;
+
+    *err = WPS_NO_ERROR;
+
+    for (uint8_t i = 0; i < segment_count; i++) {
+        size += segments[i].size;
+    }
+    CHECK_ERROR((size > WPS_AGGR_MAX_SDU_SIZE) || ((size + WPS_AGGR_SDU_HEADER_SIZE) > connection->payload_size), err,
+                WPS_WRONG_TX_SIZE_ERROR, return);
+
+    CRITICAL_SECTION_ENTER();
+    if ((aggr->tx_frame != NULL) &&
+        ((aggr->tx_frame_size + WPS_AGGR_SDU_HEADER_SIZE + size) > connection->payload_size)) {
+        commit_tx_frame(connection, err);
+    }
+    if (aggr->tx_frame == NULL) {
+        wps_get_free_slot(connection, &aggr->tx_frame, connection->payload_size, err);
+        if (*err != WPS_NO_ERROR) {
+            aggr->tx_frame = NULL;
+            CRITICAL_SECTION_EXIT();
+            return;
+        }
+        aggr->tx_frame_size = 0;
+        aggr->tx_frame_tick = connection->cfg.get_tick();
+    }
+
+    aggr->tx_frame[aggr->tx_frame_size] = (uint8_t)size;
+    aggr->tx_frame_size += WPS_AGGR_SDU_HEADER_SIZE;
+    for (uint8_t i = 0; i < segment_count; i++) {
+        memcpy(&aggr->tx_frame[aggr->tx_frame_size], segments[i].payload, segments[i].size);
+        aggr->tx_frame_size += segments[i].size;
+    }
+
+    if (((aggr->tx_frame_size + WPS_AGGR_SDU_HEADER_SIZE) > connection->payload_size) || is_tx_frame_due(connection)) {
+        commit_tx_frame(connection, err);
+    }
+    CRITICAL_SECTION_EXIT();
+}
+
+void wps_aggr_flush(wps_connection_t *connection, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+
+    CRITICAL_SECTION_ENTER();
+    commit_tx_frame(connection, err);
+    CRITICAL_SECTION_EXIT();
+}
+
+void wps_aggr_process(wps_connection_t *connection, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+
+    CRITICAL_SECTION_ENTER();
+    if (is_tx_frame_due(connection)) {
+        commit_tx_frame(connection, err);
+    }
+    CRITICAL_SECTION_EXIT();
+}
+
+wps_rx_frame wps_aggr_read(wps_connection_t *connection, wps_error_t *err)
+{
+    wps_rx_frame frame = wps_read(connection, err);
+
+    if (*err != WPS_NO_ERROR) {
+        return frame;
+    }
+
+    /* The frame payload starts at the oldest SDU not released yet. */
+    frame.size = frame.payload[0];
+    frame.payload += WPS_AGGR_SDU_HEADER_SIZE;
+
+    return frame;
+}
+
+wps_rx_frame wps_aggr_read_to_buffer(wps_connection_t *connection, uint8_t *payload, uint16_t max_size,
+                                     wps_error_t *err)
+{
+    wps_rx_frame frame = wps_aggr_read(connection, err);
+
+    if (*err != WPS_NO_ERROR) {
+        return frame;
+    }
+    if (frame.size > max_size) {
+        *err = WPS_WRONG_RX_SIZE_ERROR;
+        frame.payload = NULL;
+        frame.size = 0;
+        return frame;
+    }
+
+    memcpy(payload, frame.payload, frame.size);
+    frame.payload = payload;
+    wps_aggr_read_done(connection, err);
+
+    return frame;
+}
+
+uint16_t wps_aggr_get_read_payload_size(wps_connection_t *connection, wps_error_t *err)
+{
+    return wps_aggr_read(connection, err).size;
+}
+
+void wps_aggr_read_done(wps_connection_t *connection, wps_error_t *err)
+{
+    xlayer_queue_node_t *node = xlayer_queue_get_node(&connection->xlayer_queue);
+    xlayer_frame_t *frame;
+
+    *err = WPS_NO_ERROR;
+
+    CHECK_ERROR(node == NULL, err, WPS_QUEUE_EMPTY_ERROR, return);
+
+    frame = &node->xlayer.frame;
+    frame->payload_begin_it += WPS_AGGR_SDU_HEADER_SIZE + frame->payload_begin_it[0];
+    connection->aggr.enqueued_count--;
+    if (frame->payload_begin_it >= frame->payload_end_it) {
+        wps_read_done(connection, err);
+    }
+}
+
+void wps_aggr_set_tx_success_callback(wps_connection_t *connection, void (*callback)(void *conn, void *parg),
+                                      void *parg, wps_error_t *err)
+{
+    wps_set_tx_success_callback(connection, wps_aggr_tx_success_callback, (void *)connection, err);
+    connection->aggr.tx_success_callback = callback;
+    connection->aggr.tx_success_parg_callback = parg;
+}
+
+void wps_aggr_set_rx_success_callback(wps_connection_t *connection, void (*callback)(void *conn, void *parg),
+                                      void *parg)
+{
+    connection->aggr.rx_success_callback = callback;
+    connection->aggr.rx_success_parg_callback = parg;
+}
+
+uint16_t wps_aggr_get_fifo_size(wps_connection_t *connection)
+{
+    return connection->aggr.enqueued_count;
+}
+
+/* PRIVATE FUNCTION ***********************************************************/
+/** @brief Enqueue the frame being filled for transmission.
+ *
+ *  @note Must be called within a critical section.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ */
+static void commit_tx_frame(wps_connection_t *connection, wps_error_t *err)
+{
+    aggr_t *aggr = &connection->aggr;
+
+    if (aggr->tx_frame == NULL) {
+        return;
+    }
+
+    /* The slot has been reserved when the frame was started, the queue has room for it. */
+    wps_send(connection, aggr->tx_frame, aggr->tx_frame_size, err);
+    aggr->tx_frame = NULL;
+    aggr->tx_frame_size = 0;
+}
+
+/** @brief Tell whether the frame being filled must be enqueued for transmission.
+ *
+ *  While other frames wait in the connection queue, holding the frame does not delay it.
+ *
+ *  @param[in] connection  Connection instance.
+ *  @retval true   The frame is due.
+ *  @retval false  The frame can wait for more SDUs.
+ */
+static bool is_tx_frame_due(wps_connection_t *connection)
+{
+    aggr_t *aggr = &connection->aggr;
+
+    return (aggr->tx_frame != NULL) && (xlayer_queue_get_size(&connection->xlayer_queue) == 0) &&
+           ((connection->cfg.get_tick() - aggr->tx_frame_tick) >= aggr->max_hold_time);
+}
+
+/** @brief Count the SDUs of an aggregated frame.
+ *
+ *  @param[in] payload  Aggregated frame payload.
+ *  @param[in] size     Aggregated frame payload size in bytes.
+ *  @return Number of SDUs, 0 if the frame is malformed.
+ */
+static uint16_t count_sdus(const uint8_t *payload, size_t size)
+{
+    uint16_t count = 0;
+    size_t offset = 0;
+
+    while (offset < size) {
+        offset += WPS_AGGR_SDU_HEADER_SIZE + payload[offset];
+        count++;
+    }
+
+    return (offset == size) ? count : 0;
+}
+
+/** @brief Move a received frame to the connection queue and notify its SDUs.
+ *
+ *  @param[in] conn  SWC connection instance to pass to the application callback.
+ *  @param[in] arg   Aggregation connection instance.
+ */
+static void wps_aggr_read_process(void *conn, void *arg)
+{
+    wps_connection_t *connection = (wps_connection_t *)arg;
+    xlayer_queue_node_t *node = xlayer_queue_dequeue_node(&connection->aggr.xlayer_queue);
+    uint16_t sdu_count;
+
+    (void)conn;
+
+    if (node == NULL) {
+        return;
+    }
+
+    sdu_count = count_sdus(node->xlayer.frame.payload_begin_it,
+                           node->xlayer.frame.payload_end_it - node->xlayer.frame.payload_begin_it);
+    if (sdu_count == 0) {
+        wps_mac_xlayer_free_node_with_data(connection, node);
+        return;
+    }
+
+    xlayer_queue_enqueue_node(&connection->xlayer_queue, node);
+    connection->aggr.enqueued_count += sdu_count;
+
+    if (connection->aggr.rx_success_callback != NULL) {
+        for (uint16_t i = 0; i < sdu_count; i++) {
+            connection->aggr.rx_success_callback(connection->cfg.conn, connection->aggr.rx_success_parg_callback);
+        }
+    }
+}
+
+/** @brief Enqueue the frame being filled once the connection queue is empty, then notify the application.
+ *
+ *  @param[in] conn  SWC connection instance to pass to the application callback.
+ *  @param[in] parg  Aggregation connection instance.
+ */
+static void wps_aggr_tx_success_callback(void *conn, void *parg)
+{
+    wps_connection_t *connection = (wps_connection_t *)parg;
+    wps_error_t err = WPS_NO_ERROR;
+
+    wps_aggr_process(connection, &err);
+
+    if (connection->aggr.tx_success_callback != NULL) {
+        connection->aggr.tx_success_callback(conn, connection->aggr.tx_success_parg_callback);
+    }
+}
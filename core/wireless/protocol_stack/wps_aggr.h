@@ -0,0 +1,155 @@
+/** @file  wps_aggr.h
+ *  @brief WPS Aggregation module.
+ *
+ *  Several small SDUs (service data units) are packed in one frame, each one prefixed with its size in bytes, so that
+ *  they share a single timeslot and MAC header. The receiver unpacks the frame and reads the SDUs one by one.
+ *
+ *  An SDU is held in the frame being filled until the frame is full, until wps_aggr_flush() is called, or until the
+ *  connection queue is empty and the SDU has been held for max_hold_time. Holding SDUs while other frames wait for
+ *  their timeslot adds no latency.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef WPS_AGGR_H_
+#define WPS_AGGR_H_
+
+/* INCLUDES *******************************************************************/
+#include "wps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Size in bytes of the header prefixing each SDU in an aggregated frame. */
+#define WPS_AGGR_SDU_HEADER_SIZE 1
+/*! Largest SDU size in bytes, limited by the SDU header. */
+#define WPS_AGGR_MAX_SDU_SIZE 255
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the aggregation module.
+ *
+ *  @note This needs to be initialized on both sides of the connection. It can't be used with fragmentation.
+ *
+ *  @param[in]  connection     Connection instance.
+ *  @param[in]  max_hold_time  Time an SDU may be held once the connection queue is empty, in ticks of the connection
+ *                             get_tick() function. With 0, SDUs are only held while other frames wait in the queue.
+ *  @param[out] err            Pointer to the error code.
+ */
+void wps_aggr_init(wps_connection_t *connection, uint32_t max_hold_time, wps_error_t *err);
+
+/** @brief Send an SDU over the air.
+ *
+ *  The SDU is copied in the frame being filled. The frame is enqueued in the connection Xlayer once full or due.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[in]  payload     SDU to send over the air.
+ *  @param[in]  size        SDU size in bytes, up to WPS_AGGR_MAX_SDU_SIZE and to the connection payload size minus
+ *                          WPS_AGGR_SDU_HEADER_SIZE.
+ *  @param[out] err         Pointer to the error code.
+ */
+void wps_aggr_send(wps_connection_t *connection, const uint8_t *payload, uint16_t size, wps_error_t *err);
+
+/** @brief Send an SDU gathered from several segments over the air.
+ *
+ *  The segments are copied one after the other in the frame being filled.
+ *
+ *  @param[in]  connection     Connection instance.
+ *  @param[in]  segments       SDU segments to send over the air, in order.
+ *  @param[in]  segment_count  Number of segments.
+ *  @param[out] err            Pointer to the error code.
+ */
+void wps_aggr_sendv(wps_connection_t *connection, const wps_payload_segment_t *segments, uint8_t segment_count,
+                    wps_error_t *err);
+
+/** @brief Enqueue the frame being filled, if any, regardless of the hold time.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ */
+void wps_aggr_flush(wps_connection_t *connection, wps_error_t *err);
+
+/** @brief Enqueue the frame being filled if its hold time has elapsed and the connection queue is empty.
+ *
+ *  This is done on every transmitted frame and every sent SDU. Call it periodically when max_hold_time is not 0, so
+ *  that an SDU sent while the connection is idle does not wait for the next one.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ */
+void wps_aggr_process(wps_connection_t *connection, wps_error_t *err);
+
+/** @brief Read the oldest received SDU.
+ *
+ *  The SDU stays in the reception frame until wps_aggr_read_done() is called.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ *  @return WPS Received frame structure, including SDU and size.
+ */
+wps_rx_frame wps_aggr_read(wps_connection_t *connection, wps_error_t *err);
+
+/** @brief Copy the oldest received SDU in a buffer and release it.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] payload     Buffer where to copy the SDU.
+ *  @param[in]  max_size    Buffer size in bytes.
+ *  @param[out] err         Pointer to the error code.
+ *  @return WPS Received frame structure, including buffer and SDU size.
+ */
+wps_rx_frame wps_aggr_read_to_buffer(wps_connection_t *connection, uint8_t *payload, uint16_t max_size,
+                                     wps_error_t *err);
+
+/** @brief Get the size of the oldest received SDU.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ *  @return SDU size in bytes.
+ */
+uint16_t wps_aggr_get_read_payload_size(wps_connection_t *connection, wps_error_t *err);
+
+/** @brief Release the oldest received SDU.
+ *
+ *  The reception frame is freed once all its SDUs are released.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ */
+void wps_aggr_read_done(wps_connection_t *connection, wps_error_t *err);
+
+/** @brief Set the callback function to execute when an aggregated frame is successfully transmitted.
+ *
+ *  @param[in]  connection  Pointer to the connection.
+ *  @param[in]  callback    Function pointer to the callback.
+ *  @param[in]  parg        Void pointer argument for the callback.
+ *  @param[out] err         Pointer to the error code.
+ */
+void wps_aggr_set_tx_success_callback(wps_connection_t *connection, void (*callback)(void *conn, void *parg),
+                                      void *parg, wps_error_t *err);
+
+/** @brief Set the callback function to execute when an SDU is received.
+ *
+ *  @note The callback is raised once per SDU of the received frame.
+ *
+ *  @param[in] connection  Pointer to the connection.
+ *  @param[in] callback    Function pointer to the callback.
+ *  @param[in] parg        Void pointer argument for the callback.
+ */
+void wps_aggr_set_rx_success_callback(wps_connection_t *connection, void (*callback)(void *conn, void *parg),
+                                      void *parg);
+
+/** @brief Return the number of received SDUs ready to read.
+ *
+ *  @param[in] connection  Connection instance.
+ *  @return Number of SDUs.
+ */
+uint16_t wps_aggr_get_fifo_size(wps_connection_t *connection);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WPS_AGGR_H_ */
@@ -9,28 +9,23 @@
 
 /* INCLUDES *******************************************************************/
 #include "wps_callback.h"
-#include "critical_section.h"
 #include "xlayer.h"
 
 /* PUBLIC FUNCTIONS ***********************************************************/
-void wps_callback_enqueue(circular_queue_t *queue, xlayer_callback_t *xlayer_callback)
+void wps_callback_enqueue(spsc_queue_t *queue, xlayer_callback_t *xlayer_callback)
 {
     wps_callback_inst_t *callback = NULL;
 
-    CRITICAL_SECTION_ENTER();
-
-    if (!circular_queue_is_full(queue)) {
-        callback = circular_queue_get_free_slot_raw(queue);
+    if (xlayer_callback == NULL) {
+        return;
+    }
 
-        if (callback != NULL && xlayer_callback != NULL) {
-            callback->func = xlayer_callback->callback;
-            callback->conn = xlayer_callback->conn;
-            callback->parg = xlayer_callback->parg_callback;
+    callback = spsc_queue_get_free_slot(queue);
+    if (callback != NULL) {
+        callback->func = xlayer_callback->callback;
+        callback->conn = xlayer_callback->conn;
+        callback->parg = xlayer_callback->parg_callback;
 
-            queue->free_space -= 1;
-            circular_queue_enqueue_raw(queue);
-        }
+        spsc_queue_enqueue(queue);
     }
-
-    CRITICAL_SECTION_EXIT();
 }
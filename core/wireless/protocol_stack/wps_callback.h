@@ -14,6 +14,7 @@ extern "C" {
 #endif
 
 /* INCLUDES *******************************************************************/
+#include "spsc_queue.h"
 #include "wps_def.h"
 #include "xlayer.h"
 
@@ -31,11 +32,13 @@ typedef struct wps_callback_inst {
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 /** @brief Enqueue a new callback to process at the end of the wps process.
+ *
+ *  The MAC is the only producer of the callback queue, the callback is enqueued without masking interrupts.
  *
  *  @param[in] queue            Callback queue instance.
  *  @param[in] xlayer_callback  Callback source.
  */
-void wps_callback_enqueue(circular_queue_t *queue, xlayer_callback_t *xlayer_callback);
+void wps_callback_enqueue(spsc_queue_t *queue, xlayer_callback_t *xlayer_callback);
 
 #ifdef __cplusplus
 }
@@ -20,155 +20,115 @@
 #define USE_HIGHEST_CONNECTION_PRIORITY 0xFF
 
 /* PRIVATE FUNCTION PROTOTYPES ************************************************/
-static uint8_t get_highest_conn_index_based_on_priority(wps_connection_t **connections,
-                                                        const uint8_t *connection_priorities, uint8_t connection_count);
+static uint8_t get_highest_conn_index_based_on_priority(const timeslot_conn_list_t *conn_list, uint32_t excluded_mask);
 
-static uint8_t get_highest_main_conn_index_based_on_priority_and_credits(wps_connection_t **connections,
-                                                                         const uint8_t *connection_priorities,
-                                                                         uint8_t connection_count, uint8_t depth);
+static uint8_t get_highest_main_conn_index_based_on_priority_and_credits(const timeslot_conn_list_t *conn_list);
 
-static uint8_t get_highest_auto_conn_index_based_on_priority_and_credits(wps_connection_t **connections,
-                                                                         const uint8_t *connection_priorities,
-                                                                         uint8_t connection_count);
+static uint8_t get_highest_auto_conn_index_based_on_priority_and_credits(const timeslot_conn_list_t *conn_list);
 
 /* PUBLIC FUNCTIONS ***********************************************************/
-uint8_t wps_conn_priority_get_highest_main_conn_index(wps_connection_t **connections,
-                                                      const uint8_t *connection_priorities, uint8_t connection_count)
+uint8_t wps_conn_priority_get_highest_main_conn_index(const timeslot_conn_list_t *conn_list)
 {
-    wps_connection_t *first_connection = connections[0];
+    wps_connection_t *first_connection = conn_list->connection[0];
     uint8_t high_priority_id = 0;
 
     if (first_connection->credit_flow_ctrl.enabled == false) {
-        return get_highest_conn_index_based_on_priority(connections, connection_priorities, connection_count);
+        return get_highest_conn_index_based_on_priority(conn_list, 0);
     }
 
-    high_priority_id = get_highest_main_conn_index_based_on_priority_and_credits(connections, connection_priorities,
-                                                                                 connection_count,
-                                                                                 connection_count - 1);
+    high_priority_id = get_highest_main_conn_index_based_on_priority_and_credits(conn_list);
 
     if (high_priority_id == USE_HIGHEST_CONNECTION_PRIORITY) {
-        high_priority_id = get_highest_conn_index_based_on_priority(connections, connection_priorities,
-                                                                    connection_count);
+        high_priority_id = get_highest_conn_index_based_on_priority(conn_list, 0);
     }
 
     return high_priority_id;
 }
 
-uint8_t wps_conn_priority_get_highest_auto_conn_index(wps_connection_t **connections,
-                                                      const uint8_t *connection_priorities, uint8_t connection_count)
+uint8_t wps_conn_priority_get_highest_auto_conn_index(const timeslot_conn_list_t *conn_list)
 {
-    wps_connection_t *first_connection = connections[0];
+    wps_connection_t *first_connection = conn_list->connection[0];
 
     if (first_connection->credit_flow_ctrl.enabled == false) {
-        return get_highest_conn_index_based_on_priority(connections, connection_priorities, connection_count);
+        return get_highest_conn_index_based_on_priority(conn_list, 0);
     }
 
-    return get_highest_auto_conn_index_based_on_priority_and_credits(connections, connection_priorities,
-                                                                     connection_count);
+    return get_highest_auto_conn_index_based_on_priority_and_credits(conn_list);
 }
 
 /* PRIVATE STATE FUNCTIONS ****************************************************/
 /** @brief Get the index of the highest priority connection.
  *
- *  @param[in] connections            Connection table.
- *  @param[in] connection_priorities  Connection priorities table.
- *  @param[in] connection_count       Connection count.
- *  @return Connection index with the highest priority.
+ *  The connections are visited in priority order, the first one with a frame to send is the highest priority one.
+ *
+ *  @param[in] conn_list      Time slot connection list.
+ *  @param[in] excluded_mask  Bit mask of the connection indexes not to take into account.
+ *  @return Connection index with the highest priority, 0 if no connection has a frame to send.
  */
-static uint8_t get_highest_conn_index_based_on_priority(wps_connection_t **connections,
-                                                        const uint8_t *connection_priorities, uint8_t connection_count)
+static uint8_t get_highest_conn_index_based_on_priority(const timeslot_conn_list_t *conn_list, uint32_t excluded_mask)
 {
-    xlayer_t *free_xlayer = NULL;
-    xlayer_queue_node_t *node = NULL;
-    uint8_t min_prio = WPS_MAX_CONN_PRIORITY + 1;
-    uint8_t min_index = 0;
-
-    for (uint8_t i = 0; i < connection_count; i++) {
-        if (connections[i]->currently_enabled) {
-            node = xlayer_queue_get_node(&connections[i]->xlayer_queue);
-        } else {
-            node = NULL;
-        }
-        if (node == NULL) {
-            free_xlayer = NULL;
-        } else {
-            free_xlayer = &node->xlayer;
-        }
-        if (free_xlayer != NULL) {
-            if (connection_priorities[i] < min_prio) {
-                min_prio = connection_priorities[i];
-                min_index = i;
-            }
-            if (min_prio == 0) {
-                break;
-            }
+    wps_connection_t *connection = NULL;
+    uint8_t index = 0;
+
+    for (uint8_t i = 0; i < conn_list->connection_count; i++) {
+        index = conn_list->priority_order[i];
+        connection = conn_list->connection[index];
+        if (((excluded_mask & (1UL << index)) == 0) && connection->currently_enabled &&
+            (xlayer_queue_get_node(&connection->xlayer_queue) != NULL)) {
+            return index;
         }
     }
 
-    return min_index;
+    return 0;
 }
 
 /** @brief Get the index of the highest priority for main connection base on priority order and credits information.
  *
- *  @param[in] connections            Connection table.
- *  @param[in] connection_priorities  Connection priorities table.
- *  @param[in] connection_count       Connection count.
- *  @param[in] depth                  Recursive search depth
+ *  A connection without credits is skipped in favor of the next highest priority one, up to the connection count
+ *  minus one times.
+ *
+ *  @param[in] conn_list  Time slot connection list.
  *  @return Main connection index with the highest priority.
  */
-static uint8_t get_highest_main_conn_index_based_on_priority_and_credits(wps_connection_t **connections,
-                                                                         const uint8_t *connection_priorities,
-                                                                         uint8_t connection_count, uint8_t depth)
+static uint8_t get_highest_main_conn_index_based_on_priority_and_credits(const timeslot_conn_list_t *conn_list)
 {
-    uint8_t high_priority_conn_id = get_highest_conn_index_based_on_priority(connections, connection_priorities,
-                                                                             connection_count);
-    wps_connection_t *wps_conn = connections[high_priority_conn_id];
+    uint32_t excluded_mask = 0;
 
-    if ((wps_conn->credit_flow_ctrl.credits_count > 0) ||
-        (wps_conn->credit_flow_ctrl.skipped_frames_count >= CREDIT_FLOW_CTRL_SKIPPED_FRAMES_THRESHOLD)) {
-        return high_priority_conn_id;
-    }
+    for (uint8_t depth = conn_list->connection_count - 1;; depth--) {
+        uint8_t high_priority_conn_id = get_highest_conn_index_based_on_priority(conn_list, excluded_mask);
+        wps_connection_t *wps_conn = conn_list->connection[high_priority_conn_id];
+
+        if ((wps_conn->credit_flow_ctrl.credits_count > 0) ||
+            (wps_conn->credit_flow_ctrl.skipped_frames_count >= CREDIT_FLOW_CTRL_SKIPPED_FRAMES_THRESHOLD)) {
+            return high_priority_conn_id;
+        }
 
-    if (depth > 0) {
         if (wps_conn->credit_flow_ctrl.skipped_frames_count < UINT8_MAX) {
             wps_conn->credit_flow_ctrl.skipped_frames_count++;
         }
 
-        uint8_t new_connection_priorities[WPS_MAX_CONN_PER_TIMESLOT];
+        if (depth == 0) {
+            return USE_HIGHEST_CONNECTION_PRIORITY;
+        }
 
-        memcpy(new_connection_priorities, connection_priorities, sizeof(new_connection_priorities));
         /* Use a different connection, `high_priority_conn_id` connection will not be taken into account. */
-        new_connection_priorities[high_priority_conn_id] = WPS_MAX_CONN_PRIORITY + 1;
-        high_priority_conn_id = get_highest_main_conn_index_based_on_priority_and_credits(connections,
-                                                                                          new_connection_priorities,
-                                                                                          connection_count, depth - 1);
-
-        return high_priority_conn_id;
+        excluded_mask |= (1UL << high_priority_conn_id);
     }
-
-    if (wps_conn->credit_flow_ctrl.skipped_frames_count < UINT8_MAX) {
-        wps_conn->credit_flow_ctrl.skipped_frames_count++;
-    }
-
-    return USE_HIGHEST_CONNECTION_PRIORITY;
 }
 
 /** @brief Get the index of the highest priority for auto-reply connection base on priority order and credits
  *         information. The main goal is to select the oldest connection that sent credit information.
  *
- *  @param[in] connections            Connection table.
- *  @param[in] connection_priorities  Connection priorities table.
- *  @param[in] connection_count       Connection count.
+ *  @param[in] conn_list  Time slot connection list.
  *  @return Auto reply connection index with the highest priority.
  */
-static uint8_t get_highest_auto_conn_index_based_on_priority_and_credits(wps_connection_t **connections,
-                                                                         const uint8_t *connection_priorities,
-                                                                         uint8_t connection_count)
+static uint8_t get_highest_auto_conn_index_based_on_priority_and_credits(const timeslot_conn_list_t *conn_list)
 {
+    wps_connection_t *const *connections = conn_list->connection;
+    uint8_t connection_count = conn_list->connection_count;
     uint8_t max_notify_missed_credits_count = 0;
     uint8_t high_notify_conn_id = 0;
-    uint8_t high_priority_conn_id = get_highest_conn_index_based_on_priority(connections, connection_priorities,
-                                                                             connection_count);
+    uint8_t high_priority_conn_id = get_highest_conn_index_based_on_priority(conn_list, 0);
 
     for (uint8_t idx = 0; idx < connection_count; idx++) {
         if (connections[idx]->currently_enabled) {
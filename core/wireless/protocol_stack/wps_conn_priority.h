@@ -10,6 +10,7 @@
 #define WPS_CONN_PRIORITY_H
 
 /* INCLUDES *******************************************************************/
+#include "link_scheduler.h"
 #include "wps_def.h"
 
 #ifdef __cplusplus
@@ -19,23 +20,21 @@ extern "C" {
 /* PUBLIC FUNCTION PROTOTYPES *************************************************/
 /** @brief Get the index of the highest priority for main connection.
  *
- *  @param[in] connections            Connection table.
- *  @param[in] connection_priorities  Connection priorities table.
- *  @param[in] connection_count       Connection count.
+ *  @note The priority order of the connection list is computed by link_scheduler_update_plan().
+ *
+ *  @param[in] conn_list  Time slot main connection list.
  *  @return Main connection index with the highest priority.
  */
-uint8_t wps_conn_priority_get_highest_main_conn_index(wps_connection_t **connections,
-                                                      const uint8_t *connection_priorities, uint8_t connection_count);
+uint8_t wps_conn_priority_get_highest_main_conn_index(const timeslot_conn_list_t *conn_list);
 
 /** @brief Get the index of the highest priority for auto-reply connection.
  *
- *  @param[in] connections            Connection table.
- *  @param[in] connection_priorities  Connection priorities table.
- *  @param[in] connection_count       Connection count.
+ *  @note The priority order of the connection list is computed by link_scheduler_update_plan().
+ *
+ *  @param[in] conn_list  Time slot auto-reply connection list.
  *  @return Auto reply connection index with the highest priority.
  */
-uint8_t wps_conn_priority_get_highest_auto_conn_index(wps_connection_t **connections,
-                                                      const uint8_t *connection_priorities, uint8_t connection_count);
+uint8_t wps_conn_priority_get_highest_auto_conn_index(const timeslot_conn_list_t *conn_list);
 
 #ifdef __cplusplus
 }
@@ -16,6 +16,7 @@ extern "C" {
 /* INCLUDES *******************************************************************/
 #include "circular_queue.h"
 #include "link_cca.h"
+#include "link_cca_adaptive.h"
 #include "link_channel_hopping.h"
 #include "link_connect_status.h"
 #include "link_credit_flow_ctrl.h"
@@ -26,6 +27,7 @@ extern "C" {
 #include "link_protocol.h"
 #include "link_random_datarate_offset.h"
 #include "link_saw_arq.h"
+#include "link_sr_arq.h"
 #include "link_tdma_sync.h"
 #include "sr_access.h"
 #include "sr_def.h"
@@ -59,6 +61,52 @@ extern "C" {
 
 /* TYPES **********************************************************************/
 #if !WPS_DISABLE_FRAGMENTATION
+/** @brief Largest number of fragments of a resumable fragmentation transaction.
+ */
+#define WPS_FRAG_RESUME_MAX_FRAGMENT_COUNT 256
+
+/** @brief WPS fragment resumable transaction state.
+ */
+typedef enum frag_resume_state {
+    /*! No transaction in progress */
+    FRAG_RESUME_IDLE = 0,
+    /*! Transaction is being transmitted or reassembled */
+    FRAG_RESUME_IN_PROGRESS,
+    /*! Transaction has been reassembled and is waiting to be read */
+    FRAG_RESUME_COMPLETE,
+} frag_resume_state_t;
+
+/** @brief WPS fragment resumable transaction instance.
+ */
+typedef struct frag_resume {
+    /*! Resumable fragmentation enable flag */
+    bool enabled;
+    /*! Connection carrying the reception reports, in the opposite direction of the fragments */
+    struct wps_connection *feedback_connection;
+    /*! Connection whose reception reports are carried by this connection, NULL if none */
+    struct wps_connection *data_connection;
+    /*! Frame buffer, holding the frame to retransmit or the frame being reassembled */
+    uint8_t *buffer;
+    /*! Frame buffer size in bytes */
+    uint16_t buffer_size;
+    /*! Size of the frame in the buffer, in bytes */
+    uint16_t frame_size;
+    /*! Number of fragments of the transaction, 0 while unknown to the receiver */
+    uint16_t fragment_count;
+    /*! Number of fragments received */
+    uint16_t received_count;
+    /*! Receiving this fragment index or a greater one triggers a new reception report */
+    uint16_t report_trigger_index;
+    /*! Transaction ID */
+    uint8_t transaction_id;
+    /*! Tell whether transaction_id is the ID of a transaction that has already been reassembled */
+    bool transaction_done;
+    /*! Transaction state */
+    volatile frag_resume_state_t state;
+    /*! One bit per fragment, set for received fragments on RX and for fragments to transmit on TX */
+    uint8_t bitmap[WPS_FRAG_RESUME_MAX_FRAGMENT_COUNT / 8];
+} frag_resume_t;
+
 /** @brief WPS fragment Connection instance
  */
 typedef struct frag {
@@ -74,6 +122,8 @@ typedef struct frag {
     uint16_t fragment_index;
     /*! Current transaction ID */
     uint8_t transaction_id;
+    /*! ID of the next transmitted transaction */
+    uint8_t tx_transaction_id;
     /*! Tell whether the current frame have been dropped */
     bool dropped_frame;
     /*! Number of payloads ready to read */
@@ -102,9 +152,40 @@ typedef struct frag {
     void (*event_callback)(void *conn, void *parg);
     /*! Event callback void pointer argument */
     void *event_parg_callback;
+    /*! Resumable transaction instance */
+    frag_resume_t resume;
 } frag_t;
 #endif /* !WPS_DISABLE_FRAGMENTATION */
 
+#if !WPS_DISABLE_AGGREGATION
+/** @brief WPS aggregation Connection instance
+ */
+typedef struct aggr {
+    /*! Aggregation enable flag */
+    bool enabled;
+    /*! Aggregation xlayer queue, holding the received frames until they are unpacked */
+    xlayer_queue_t xlayer_queue;
+    /*! Frame being filled with SDUs, not enqueued for transmission yet */
+    uint8_t *tx_frame;
+    /*! Size in bytes of the SDUs in the frame being filled */
+    uint16_t tx_frame_size;
+    /*! Tick of the first SDU put in the frame being filled */
+    uint64_t tx_frame_tick;
+    /*! Time an SDU may be held waiting for more SDUs once the connection queue is empty, in ticks */
+    uint32_t max_hold_time;
+    /*! Number of SDUs ready to read */
+    uint16_t enqueued_count;
+    /*! Function called by the wps to indicate a frame has been transmitted */
+    void (*tx_success_callback)(void *conn, void *parg);
+    /*! TX success callback void pointer argument */
+    void *tx_success_parg_callback;
+    /*! Function called by the wps to indicate an SDU has been received */
+    void (*rx_success_callback)(void *conn, void *parg);
+    /*! RX success callback void pointer argument */
+    void *rx_success_parg_callback;
+} aggr_t;
+#endif /* !WPS_DISABLE_AGGREGATION */
+
 /** @brief WPS Connection.
  */
 typedef struct wps_connection wps_connection_t;
@@ -136,6 +217,46 @@ typedef struct wps_stats {
 } wps_stats_t;
 #endif /* WPS_ENABLE_LINK_STATS */
 
+#if WPS_ENABLE_LATENCY_STATS
+#ifndef WPS_LATENCY_HISTOGRAM_BIN_COUNT
+/*! Number of bins of a latency histogram. Longer durations are counted in the last bin. */
+#define WPS_LATENCY_HISTOGRAM_BIN_COUNT 16
+#endif
+#ifndef WPS_RETRY_HISTOGRAM_BIN_COUNT
+/*! Number of bins of the retry count histogram. Higher retry counts are counted in the last bin. */
+#define WPS_RETRY_HISTOGRAM_BIN_COUNT 8
+#endif
+
+/** @brief WPS latency histogram, in connection ticks.
+ *
+ *  Bins are logarithmic: bin 0 counts the durations shorter than one tick and bin n counts the durations from
+ *  2^(n-1) to 2^n - 1 ticks.
+ */
+typedef struct wps_latency_histogram {
+    /*! Number of durations recorded */
+    uint32_t count;
+    /*! Longest duration recorded */
+    uint32_t max;
+    /*! Sum of all durations recorded */
+    uint64_t total;
+    /*! Number of durations recorded in each bin */
+    uint32_t bins[WPS_LATENCY_HISTOGRAM_BIN_COUNT];
+} wps_latency_histogram_t;
+
+/** @brief WPS latency statistics.
+ */
+typedef struct wps_latency_stats {
+    /*! Whether the latency statistics are recorded on the connection */
+    bool enable;
+    /*! Time from the payload enqueue to its acknowledge */
+    wps_latency_histogram_t ack_latency;
+    /*! Time from the payload enqueue to its drop */
+    wps_latency_histogram_t drop_age;
+    /*! Number of acknowledged payloads per retry count */
+    uint32_t retry_bins[WPS_RETRY_HISTOGRAM_BIN_COUNT];
+} wps_latency_stats_t;
+#endif /* WPS_ENABLE_LATENCY_STATS */
+
 /** @brief WPS event enum definition.
  */
 typedef enum wps_event {
@@ -183,6 +304,12 @@ typedef struct wps_header_cfg {
     bool credit_fc_enabled;
     /*! Dynamic PHY mode enabled flag. */
     bool dynamic_phy_mode;
+    /*! Selective repeat ARQ flag. */
+    bool sr_arq_enabled;
+    /*! Dynamic time slot allocation map flag. */
+    bool dynamic_alloc_map_enabled;
+    /*! Queue depth flag, used by the dynamic time slot allocation. */
+    bool queue_depth_enabled;
 } wps_header_cfg_t;
 
 /** @brief Phase information.
@@ -270,8 +397,18 @@ struct wps_connection {
     link_protocol_t *auto_link_protocol;
     /*! Stop and Wait (SaW) and Automatic Repeat Query (ARQ) */
     saw_arq_t stop_and_wait_arq;
+    /*! Selective Repeat (SR) ARQ, replaces the stop and wait sequence number when enabled */
+    sr_arq_t selective_repeat_arq;
+    /*! Frames received out of order, indexed by selective repeat reorder slot */
+    xlayer_queue_node_t *sr_arq_rx_node[LINK_SR_ARQ_WINDOW_SIZE_MAX];
+    /*! Payload storage of the frames received out of order, one payload size per reorder slot */
+    uint8_t *sr_arq_rx_payload;
+    /*! Number of payloads the reorder buffer can hold */
+    uint8_t sr_arq_rx_slot_count;
     /*! Clear Channel Assessment */
     link_cca_t cca;
+    /*! Adaptive Clear Channel Assessment backoff */
+    link_cca_adaptive_t cca_adaptive;
     /*! Fallback Module instance */
     link_fallback_t link_fallback;
     /*! Connection status */
@@ -286,6 +423,10 @@ struct wps_connection {
     /*! Fragmentation instance */
     frag_t frag;
 #endif
+#if !WPS_DISABLE_AGGREGATION
+    /*! Aggregation instance */
+    aggr_t aggr;
+#endif
 
     /* Statistics */
 #if WPS_ENABLE_PHY_STATS
@@ -307,6 +448,10 @@ struct wps_connection {
     /*! Wireless protocol stack statistics per channel */
     wps_stats_t *wps_chan_stats;
 #endif
+#endif
+#if WPS_ENABLE_LATENCY_STATS
+    /*! Wireless protocol stack latency statistics */
+    wps_latency_stats_t latency_stats;
 #endif
     /*! Running total of CCA events */
     uint32_t total_cca_events;
@@ -521,6 +666,15 @@ typedef struct rx_frame {
     uint16_t size;
 } wps_rx_frame;
 
+/** @brief Payload segment, part of a payload gathered from several buffers.
+ */
+typedef struct wps_payload_segment {
+    /*! Pointer to the segment data */
+    const uint8_t *payload;
+    /*! Size of the segment data */
+    uint16_t size;
+} wps_payload_segment_t;
+
 /** @brief Phase frame.
  */
 typedef struct phase_frame {
@@ -87,6 +87,12 @@ typedef enum wps_err {
     WPS_PRIO_NOT_ENABLE_ON_ALL_CONN_ERROR,
     /*! The priority configuration of the connection is not allowed. */
     WPS_NOT_ALLOWED_CONN_PRIORITY_CONFIGURATION_ERROR,
+    /*! The selective repeat ARQ window size is out of range. */
+    WPS_ARQ_WINDOW_SIZE_ERROR,
+    /*! Aggregation can't be used on a fragmented connection. */
+    WPS_AGGREGATION_ERROR,
+    /*! Dynamic time slot allocation is not enabled or its configuration is invalid. */
+    WPS_DYNAMIC_ALLOCATION_ERROR,
 } wps_error_t;
 
 #endif /* WPS_ERROR_H_ */
@@ -9,11 +9,14 @@
 
 /* INCLUDES *******************************************************************/
 #include "wps_frag.h"
+#include "critical_section.h"
 #include "wps.h"
 #include "wps_config.h"
+#include "wps_mac_xlayer.h"
 
 /* CONSTANTS ******************************************************************/
 #define MAX_TRANSACTION_ID 32
+#define BITS_PER_BYTE      8
 
 /* TYPES **********************************************************************/
 /** @brief WPS fragment transfer type.
@@ -27,6 +30,8 @@ typedef enum fragment_transfer_type {
     LAST_FRAGMENT_TRANSFER_TYPE = 0b100,
     /*! Abort messsage */
     ABORT_TRANSFER_TYPE = 0b110,
+    /*! Resumable transaction reception report */
+    RESUME_REPORT_TRANSFER_TYPE = 0b001,
 } fragment_transfer_type_t;
 
 /* Assumes a little-endian processor. */
@@ -76,15 +81,40 @@ typedef struct last_fragment {
     uint8_t fragment_number;
 } __packed last_fragment_t;
 
+/** @brief WPS fragment resumable transaction reception report structure.
+ *
+ *  The header is followed by a bitmap of the missing fragments, the first bit standing for first_fragment_number.
+ *  A report without bitmap acknowledges the whole transaction.
+ */
+typedef struct resume_report {
+    /*! Transaction control field */
+    transaction_control_t transaction_control;
+    /*! Index of the fragment described by the first bit of the bitmap */
+    uint8_t first_fragment_number;
+} __packed resume_report_t;
+
+/** @brief Read position in a payload gathered from several segments.
+ */
+typedef struct segment_cursor {
+    /*! Payload segments */
+    const wps_payload_segment_t *segments;
+    /*! Index of the segment being read */
+    uint8_t index;
+    /*! Offset in the segment being read */
+    uint16_t offset;
+} segment_cursor_t;
+
 /* PRIVATE FUNCTION PROTOTYPES ************************************************/
-static inline void send_full_frame(wps_connection_t *connection, uint8_t transaction_id, const uint8_t *payload,
+static inline void send_full_frame(wps_connection_t *connection, uint8_t transaction_id, segment_cursor_t *cursor,
                                    size_t size, wps_error_t *err);
-static inline size_t send_first_fragment(wps_connection_t *connection, uint8_t transaction_id, const uint8_t **payload,
-                                         size_t size, wps_error_t *err);
-static inline size_t send_middle_fragment(wps_connection_t *connection, uint8_t transaction_id, const uint8_t **payload,
-                                          size_t size, uint8_t fragment_number, wps_error_t *err);
-static inline void send_last_fragment(wps_connection_t *connection, uint8_t transaction_id, const uint8_t **payload,
+static inline size_t send_first_fragment(wps_connection_t *connection, uint8_t transaction_id,
+                                         segment_cursor_t *cursor, size_t size, wps_error_t *err);
+static inline size_t send_middle_fragment(wps_connection_t *connection, uint8_t transaction_id,
+                                          segment_cursor_t *cursor, size_t size, uint8_t fragment_number,
+                                          wps_error_t *err);
+static inline void send_last_fragment(wps_connection_t *connection, uint8_t transaction_id, segment_cursor_t *cursor,
                                       size_t size, uint8_t fragment_number, wps_error_t *err);
+static void gather_segments(segment_cursor_t *cursor, uint8_t *buffer, size_t size);
 
 static void wps_frag_read_process(void *conn, void *arg);
 static void wps_frag_read_process_fail(wps_connection_t *connection, uint8_t transaction_id);
@@ -99,6 +129,20 @@ static void wps_frag_tx_success_callback(void *conn, void *arg);
 static void wps_frag_tx_dropped_callback(void *conn, void *arg);
 static void wps_frag_tx_fail_callback(void *conn, void *arg);
 
+static void resume_send(wps_connection_t *connection, segment_cursor_t *cursor, size_t size, wps_error_t *err);
+static void resume_send_pending(wps_connection_t *connection);
+static void resume_send_fragment(wps_connection_t *connection, uint16_t fragment_number, wps_error_t *err);
+static bool resume_read_process(wps_connection_t *connection);
+static void resume_process_fragment(wps_connection_t *connection, const uint8_t *payload, size_t size);
+static void resume_process_report(wps_connection_t *connection, const uint8_t *payload, size_t size);
+static void resume_send_report(wps_connection_t *connection, fragment_transfer_type_t transfer_type);
+static void resume_abort_reception(wps_connection_t *connection);
+static uint16_t resume_get_fragment_offset(wps_connection_t *connection, uint16_t fragment_number);
+static uint16_t resume_get_fragment_count(wps_connection_t *connection, size_t size);
+static inline bool bitmap_get(const uint8_t *bitmap, uint16_t index);
+static inline void bitmap_set(uint8_t *bitmap, uint16_t index);
+static inline void bitmap_clear(uint8_t *bitmap, uint16_t index);
+
 /* PUBLIC FUNCTIONS ***********************************************************/
 void wps_frag_init(wps_connection_t *connection, void *meta_tx_buffer, uint32_t meta_tx_size, wps_error_t *err)
 {
@@ -110,6 +154,8 @@ void wps_frag_init(wps_connection_t *connection, void *meta_tx_buffer, uint32_t
     connection->frag.fragment_index = 0;
     connection->frag.enqueued_count = 0;
     connection->frag.remaining_fragment = 0;
+    connection->frag.tx_transaction_id = 0;
+    memset(&connection->frag.resume, 0, sizeof(frag_resume_t));
 
     connection->rx_queue = &connection->frag.xlayer_queue;
     circular_queue_init(&connection->frag.meta_data_queue_tx, meta_tx_buffer, meta_tx_size, sizeof(uint16_t));
@@ -121,39 +167,120 @@ void wps_frag_init(wps_connection_t *connection, void *meta_tx_buffer, uint32_t
     CHECK_ERROR(*err != WPS_NO_ERROR, err, WPS_FRAG_FAILED_TO_SET_CALLBACK, return);
 }
 
+void wps_frag_enable_resume(wps_connection_t *connection, wps_connection_t *feedback_connection, uint8_t *buffer,
+                            uint16_t buffer_size, wps_error_t *err)
+{
+    *err = WPS_NO_ERROR;
+
+    CHECK_ERROR((connection == NULL) || (feedback_connection == NULL), err, WPS_CONNECTION_NOT_ALLOCATED, return);
+    CHECK_ERROR(!connection->frag.enabled || !feedback_connection->frag.enabled, err, WPS_FRAGMENT_ERROR, return);
+    CHECK_ERROR(buffer == NULL, err, WPS_NOT_ENOUGH_MEMORY_ERROR, return);
+    /* A report must hold at least one byte of bitmap, an empty report being an acknowledgment. */
+    CHECK_ERROR(feedback_connection->payload_size <= sizeof(resume_report_t), err, WPS_WRONG_TX_SIZE_ERROR, return);
+
+    connection->frag.resume.enabled = true;
+    connection->frag.resume.feedback_connection = feedback_connection;
+    connection->frag.resume.buffer = buffer;
+    connection->frag.resume.buffer_size = buffer_size;
+    connection->frag.resume.state = FRAG_RESUME_IDLE;
+    feedback_connection->frag.resume.data_connection = connection;
+
+    if (connection->is_tx_connection) {
+        /* Pending fragments are enqueued as queue slots are released. */
+        wps_set_tx_success_callback(connection, wps_frag_tx_success_callback, (void *)connection, err);
+        CHECK_ERROR(*err != WPS_NO_ERROR, err, WPS_FRAG_FAILED_TO_SET_CALLBACK, return);
+    }
+}
+
+void wps_frag_poll(wps_connection_t *connection, wps_error_t *err)
+{
+    frag_resume_t *resume = &connection->frag.resume;
+
+    *err = WPS_NO_ERROR;
+
+    CHECK_ERROR(!resume->enabled, err, WPS_FRAGMENT_ERROR, return);
+
+    CRITICAL_SECTION_ENTER();
+    if (resume->state == FRAG_RESUME_IN_PROGRESS) {
+        /* The last fragment always triggers a reception report. */
+        resume_send_fragment(connection, resume->fragment_count - 1, err);
+        resume_send_pending(connection);
+    }
+    CRITICAL_SECTION_EXIT();
+}
+
+void wps_frag_abort(wps_connection_t *connection)
+{
+    frag_resume_t *resume = &connection->frag.resume;
+
+    CRITICAL_SECTION_ENTER();
+    resume->state = FRAG_RESUME_IDLE;
+    memset(resume->bitmap, 0, sizeof(resume->bitmap));
+    CRITICAL_SECTION_EXIT();
+}
+
 void wps_frag_send(wps_connection_t *connection, const uint8_t *payload, size_t size, wps_error_t *err)
 {
-    static uint8_t transaction_id;
+    wps_payload_segment_t segment = {
+        .payload = payload,
+        .size = (uint16_t)size,
+    };
+
+    CHECK_ERROR(size > UINT16_MAX, err, WPS_WRONG_TX_SIZE_ERROR, return);
+
+    wps_frag_sendv(connection, &segment, 1, err);
+}
+
+void wps_frag_sendv(wps_connection_t *connection, const wps_payload_segment_t *segments, uint8_t segment_count,
+                    wps_error_t *err)
+{
+    uint8_t transaction_id = connection->frag.tx_transaction_id;
     uint16_t fragment_number = 0;
     uint16_t *ptr_fragment_queue = NULL;
+    segment_cursor_t cursor = {
+        .segments = segments,
+        .index = 0,
+        .offset = 0,
+    };
+    size_t size = 0;
     *err = WPS_NO_ERROR;
 
+    for (uint8_t i = 0; i < segment_count; i++) {
+        size += segments[i].size;
+    }
+    CHECK_ERROR(size > UINT16_MAX, err, WPS_WRONG_TX_SIZE_ERROR, return);
+
+    if (connection->frag.resume.enabled) {
+        resume_send(connection, &cursor, size, err);
+        return;
+    }
+
     if (check_queue_space(connection, size) == false) {
         *err = WPS_QUEUE_FULL_ERROR;
         return;
     }
 
     if (size + sizeof(full_frame_t) <= connection->payload_size) {
-        send_full_frame(connection, transaction_id, payload, size, err);
+        send_full_frame(connection, transaction_id, &cursor, size, err);
         if (*err != WPS_NO_ERROR) {
             return;
         }
     } else {
 
-        size = send_first_fragment(connection, transaction_id, &payload, size, err);
+        size = send_first_fragment(connection, transaction_id, &cursor, size, err);
 
         if (*err != WPS_NO_ERROR) {
             return;
         }
         while (size / (connection->payload_size - sizeof(middle_fragment_t))) {
             fragment_number++;
-            size = send_middle_fragment(connection, transaction_id, &payload, size, fragment_number, err);
+            size = send_middle_fragment(connection, transaction_id, &cursor, size, fragment_number, err);
             if (*err != WPS_NO_ERROR) {
                 return;
             }
         };
         fragment_number++;
-        send_last_fragment(connection, transaction_id, &payload, size, fragment_number, err);
+        send_last_fragment(connection, transaction_id, &cursor, size, fragment_number, err);
         if (*err != WPS_NO_ERROR) {
             return;
         }
@@ -181,7 +308,7 @@ void wps_frag_send(wps_connection_t *connection, const uint8_t *payload, size_t
         }
     }
 
-    transaction_id = (transaction_id + 1) % MAX_TRANSACTION_ID;
+    connection->frag.tx_transaction_id = (transaction_id + 1) % MAX_TRANSACTION_ID;
 }
 
 wps_rx_frame wps_frag_read(wps_connection_t *connection, uint8_t *payload, size_t max_size, wps_error_t *err)
@@ -197,6 +324,21 @@ wps_rx_frame wps_frag_read(wps_connection_t *connection, uint8_t *payload, size_
         .size = 0,
     };
 
+    if (frag_connection->resume.state == FRAG_RESUME_COMPLETE) {
+        /* Reassembled frames are read before the frames waiting in the queue. */
+        *err = WPS_NO_ERROR;
+        if (max_size < frag_connection->resume.frame_size) {
+            *err = WPS_WRONG_RX_SIZE_ERROR;
+            frame_out.payload = NULL;
+        } else {
+            memcpy(payload, frag_connection->resume.buffer, frag_connection->resume.frame_size);
+            frame_out.size = frag_connection->resume.frame_size;
+        }
+        frag_connection->resume.state = FRAG_RESUME_IDLE;
+        frag_connection->enqueued_count--;
+        return frame_out;
+    }
+
     if (*err != WPS_NO_ERROR) {
         frag_connection->enqueued_count--;
         return frame_out;
@@ -300,6 +442,12 @@ wps_rx_frame wps_frag_read(wps_connection_t *connection, uint8_t *payload, size_
 uint16_t wps_frag_get_read_payload_size(wps_connection_t *connection, wps_error_t *err)
 {
     frag_t *frag_connection = &connection->frag;
+
+    if (frag_connection->resume.state == FRAG_RESUME_COMPLETE) {
+        *err = WPS_NO_ERROR;
+        return frag_connection->resume.frame_size;
+    }
+
     wps_rx_frame frame = wps_read(connection, err);
     transaction_control_t *transaction_control = (transaction_control_t *)frame.payload;
 
@@ -397,11 +545,11 @@ uint16_t wps_frag_get_fifo_size(wps_connection_t *connection)
  *
  *  @param[in] connection      Connection instance.
  *  @param[in] transaction_id  transaction ID.
- *  @param[in] payload         Fragment payload.
+ *  @param[in] cursor          Fragment payload position in the payload segments.
  *  @param[in] size            Fragment payload size.
  *  @param[in] err             Pointer to the error code.
  */
-static inline void send_full_frame(wps_connection_t *connection, uint8_t transaction_id, const uint8_t *payload,
+static inline void send_full_frame(wps_connection_t *connection, uint8_t transaction_id, segment_cursor_t *cursor,
                                    size_t size, wps_error_t *err)
 {
     uint8_t *payload_in = NULL;
@@ -416,7 +564,7 @@ static inline void send_full_frame(wps_connection_t *connection, uint8_t transac
     fragment->transaction_control.transfer_type = FULL_FRAME_TRANSFER_TYPE;
     fragment->transaction_control.transaction_id = transaction_id;
 
-    memcpy(payload_in + sizeof(full_frame_t), payload, size);
+    gather_segments(cursor, payload_in + sizeof(full_frame_t), size);
     wps_send(connection, payload_in, size + sizeof(full_frame_t), err);
 }
 
@@ -424,13 +572,13 @@ static inline void send_full_frame(wps_connection_t *connection, uint8_t transac
  *
  *  @param[in] connection      Connection instance.
  *  @param[in] transaction_id  transaction ID.
- *  @param[in] payload         Fragment payload.
+ *  @param[in] cursor          Fragment payload position in the payload segments.
  *  @param[in] size            Fragment payload size.
  *  @param[in] err             Pointer to the error code.
  *  @return New payload size.
  */
-static inline size_t send_first_fragment(wps_connection_t *connection, uint8_t transaction_id, const uint8_t **payload,
-                                         size_t size, wps_error_t *err)
+static inline size_t send_first_fragment(wps_connection_t *connection, uint8_t transaction_id,
+                                         segment_cursor_t *cursor, size_t size, wps_error_t *err)
 {
     uint8_t *payload_in = NULL;
     first_fragment_t *fragment = NULL;
@@ -447,8 +595,7 @@ static inline size_t send_first_fragment(wps_connection_t *connection, uint8_t t
     fragment->fragment_number = 0;
     fragment->total_upper_layer_frame_size = size;
 
-    memcpy(payload_in + sizeof(first_fragment_t), *payload, fragment_size);
-    *payload += fragment_size;
+    gather_segments(cursor, payload_in + sizeof(first_fragment_t), fragment_size);
     wps_send(connection, payload_in, connection->payload_size, err);
     if (*err != WPS_NO_ERROR) {
         return size;
@@ -460,14 +607,15 @@ static inline size_t send_first_fragment(wps_connection_t *connection, uint8_t t
  *
  *  @param[in] connection       Connection instance.
  *  @param[in] transaction_id   transaction ID.
- *  @param[in] payload          Fragment payload.
+ *  @param[in] cursor           Fragment payload position in the payload segments.
  *  @param[in] size             Fragment payload size.
  *  @param[in] fragment_number  Index of the fragment.
  *  @param[in] err              Pointer to the error code.
  *  @return New payload size.
  */
-static inline size_t send_middle_fragment(wps_connection_t *connection, uint8_t transaction_id, const uint8_t **payload,
-                                          size_t size, uint8_t fragment_number, wps_error_t *err)
+static inline size_t send_middle_fragment(wps_connection_t *connection, uint8_t transaction_id,
+                                          segment_cursor_t *cursor, size_t size, uint8_t fragment_number,
+                                          wps_error_t *err)
 {
     uint8_t *payload_in = NULL;
     middle_fragment_t *fragment = NULL;
@@ -483,12 +631,11 @@ static inline size_t send_middle_fragment(wps_connection_t *connection, uint8_t
     fragment->transaction_control.transaction_id = transaction_id;
     fragment->fragment_number = fragment_number;
 
-    memcpy(payload_in + sizeof(middle_fragment_t), *payload, fragment_size);
+    gather_segments(cursor, payload_in + sizeof(middle_fragment_t), fragment_size);
     wps_send(connection, payload_in, connection->payload_size, err);
     if (*err != WPS_NO_ERROR) {
         return size;
     }
-    *payload += fragment_size;
     return size - fragment_size;
 }
 
@@ -496,12 +643,12 @@ static inline size_t send_middle_fragment(wps_connection_t *connection, uint8_t
  *
  *  @param[in] connection       Connection instance.
  *  @param[in] transaction_id  transaction ID.
- *  @param[in] payload          Fragment payload.
+ *  @param[in] cursor           Fragment payload position in the payload segments.
  *  @param[in] size             Fragment payload size.
  *  @param[in] fragment_number  Index of the fragment.
  *  @param[in] err              Pointer to the error code.
  */
-static inline void send_last_fragment(wps_connection_t *connection, uint8_t transaction_id, const uint8_t **payload,
+static inline void send_last_fragment(wps_connection_t *connection, uint8_t transaction_id, segment_cursor_t *cursor,
                                       size_t size, uint8_t fragment_number, wps_error_t *err)
 {
     uint8_t *payload_in = NULL;
@@ -517,13 +664,41 @@ static inline void send_last_fragment(wps_connection_t *connection, uint8_t tran
     fragment->transaction_control.transaction_id = transaction_id;
     fragment->fragment_number = fragment_number;
 
-    memcpy(payload_in + sizeof(last_fragment_t), *payload, size);
+    gather_segments(cursor, payload_in + sizeof(last_fragment_t), size);
     wps_send(connection, payload_in, size + sizeof(last_fragment_t), err);
     if (*err != WPS_NO_ERROR) {
         return;
     }
 }
 
+/** @brief Copy the next bytes of the payload segments in a buffer.
+ *
+ *  The copy crosses segment boundaries and the cursor is moved past the copied bytes.
+ *
+ *  @param[in]  cursor  Position in the payload segments.
+ *  @param[out] buffer  Destination buffer.
+ *  @param[in]  size    Number of bytes to copy.
+ */
+static void gather_segments(segment_cursor_t *cursor, uint8_t *buffer, size_t size)
+{
+    while (size > 0) {
+        const wps_payload_segment_t *segment = &cursor->segments[cursor->index];
+        size_t chunk_size = segment->size - cursor->offset;
+
+        if (chunk_size > size) {
+            chunk_size = size;
+        }
+        memcpy(buffer, segment->payload + cursor->offset, chunk_size);
+        buffer += chunk_size;
+        size -= chunk_size;
+        cursor->offset += chunk_size;
+        if (cursor->offset == segment->size) {
+            cursor->index++;
+            cursor->offset = 0;
+        }
+    }
+}
+
 /** @brief  State machine to handle new received frame.
  *
  *  @param[in] conn  SWC connection instance to pass to the application callback.
@@ -537,6 +712,10 @@ static void wps_frag_read_process(void *conn, void *arg)
 
     (void)conn;
 
+    if (resume_read_process(connection)) {
+        return;
+    }
+
     frame = frag_read(connection, &err);
     if (err != WPS_NO_ERROR) {
         return;
@@ -858,6 +1037,12 @@ static void wps_frag_tx_success_callback(void *conn, void *parg)
     wps_connection_t *connection = (wps_connection_t *)parg;
     uint16_t *ptr_fragment_queue = NULL;
 
+    if (connection->frag.resume.enabled) {
+        /* Success is reported once the receiver acknowledges the whole frame. */
+        resume_send_pending(connection);
+        return;
+    }
+
     if (connection->frag.remaining_fragment) {
         connection->frag.remaining_fragment--;
     } else {
@@ -900,3 +1085,441 @@ static void wps_frag_tx_fail_callback(void *conn, void *parg)
         connection->tx_fail_callback(conn, connection->frag.tx_fail_parg_callback);
     }
 }
+
+/** @brief Start a resumable transaction.
+ *
+ *  The frame is kept in the resume buffer until the receiver acknowledges it, so that any fragment can be sent again.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[in]  cursor      Application payload segments to send over the air.
+ *  @param[in]  size        Payload size in bytes.
+ *  @param[out] err         Pointer to the error code.
+ */
+static void resume_send(wps_connection_t *connection, segment_cursor_t *cursor, size_t size, wps_error_t *err)
+{
+    frag_resume_t *resume = &connection->frag.resume;
+    uint16_t fragment_count = resume_get_fragment_count(connection, size);
+
+    if (resume->state != FRAG_RESUME_IDLE) {
+        /* Only one transaction at a time, the previous one is not acknowledged yet. */
+        *err = WPS_QUEUE_FULL_ERROR;
+        return;
+    }
+    if ((size == 0) || (size > resume->buffer_size) || (fragment_count > WPS_FRAG_RESUME_MAX_FRAGMENT_COUNT)) {
+        *err = WPS_WRONG_TX_SIZE_ERROR;
+        return;
+    }
+
+    gather_segments(cursor, resume->buffer, size);
+    resume->frame_size = size;
+    resume->fragment_count = fragment_count;
+    resume->transaction_id = connection->frag.tx_transaction_id;
+    connection->frag.tx_transaction_id = (connection->frag.tx_transaction_id + 1) % MAX_TRANSACTION_ID;
+
+    memset(resume->bitmap, 0, sizeof(resume->bitmap));
+    for (uint16_t i = 0; i < fragment_count; i++) {
+        bitmap_set(resume->bitmap, i);
+    }
+    /* Publish the transaction once the bitmap is ready, the TX success callback may enqueue fragments as well. */
+    resume->state = FRAG_RESUME_IN_PROGRESS;
+
+    resume_send_pending(connection);
+}
+
+/** @brief Enqueue the pending fragments of the resumable transaction, as long as the queue has free slots.
+ *
+ *  The fragments left pending are enqueued from the TX success callback, once slots are released. This function is
+ *  called from the application and from the callback contexts, the whole enqueuing is done in a critical section so
+ *  a fragment is never taken by two contexts.
+ *
+ *  @param[in] connection  Connection instance.
+ */
+static void resume_send_pending(wps_connection_t *connection)
+{
+    frag_resume_t *resume = &connection->frag.resume;
+    wps_error_t err = WPS_NO_ERROR;
+
+    CRITICAL_SECTION_ENTER();
+    for (uint16_t i = 0; (i < resume->fragment_count) && (resume->state == FRAG_RESUME_IN_PROGRESS); i++) {
+        if (resume->bitmap[i / BITS_PER_BYTE] == 0) {
+            i |= BITS_PER_BYTE - 1;
+            continue;
+        }
+        if (!bitmap_get(resume->bitmap, i)) {
+            continue;
+        }
+        if (wps_get_fifo_free_space(connection) == 0) {
+            break;
+        }
+        bitmap_clear(resume->bitmap, i);
+        resume_send_fragment(connection, i, &err);
+        if (err != WPS_NO_ERROR) {
+            bitmap_set(resume->bitmap, i);
+            break;
+        }
+    }
+    CRITICAL_SECTION_EXIT();
+}
+
+/** @brief Send one fragment of the resumable transaction from the resume buffer.
+ *
+ *  A single fragment transaction is sent as a last fragment of index 0.
+ *
+ *  @param[in]  connection       Connection instance.
+ *  @param[in]  fragment_number  Index of the fragment.
+ *  @param[out] err              Pointer to the error code.
+ */
+static void resume_send_fragment(wps_connection_t *connection, uint16_t fragment_number, wps_error_t *err)
+{
+    frag_resume_t *resume = &connection->frag.resume;
+    uint16_t offset = resume_get_fragment_offset(connection, fragment_number);
+    uint8_t *payload_in = NULL;
+    size_t header_size;
+    size_t fragment_size;
+
+    if (fragment_number == (resume->fragment_count - 1)) {
+        header_size = sizeof(last_fragment_t);
+        fragment_size = resume->frame_size - offset;
+    } else if (fragment_number == 0) {
+        header_size = sizeof(first_fragment_t);
+        fragment_size = connection->payload_size - sizeof(first_fragment_t);
+    } else {
+        header_size = sizeof(middle_fragment_t);
+        fragment_size = connection->payload_size - sizeof(middle_fragment_t);
+    }
+
+    wps_get_free_slot(connection, &payload_in, header_size + fragment_size, err);
+    if (*err != WPS_NO_ERROR) {
+        return;
+    }
+
+    if (header_size == sizeof(first_fragment_t)) {
+        first_fragment_t *fragment = (first_fragment_t *)payload_in;
+
+        fragment->transaction_control.transfer_type = NON_LAST_FRAGMENT_TRANSFER_TYPE;
+        fragment->total_upper_layer_frame_size = resume->frame_size;
+    } else {
+        middle_fragment_t *fragment = (middle_fragment_t *)payload_in;
+
+        fragment->transaction_control.transfer_type = (fragment_number == (resume->fragment_count - 1)) ?
+                                                          LAST_FRAGMENT_TRANSFER_TYPE :
+                                                          NON_LAST_FRAGMENT_TRANSFER_TYPE;
+    }
+    ((middle_fragment_t *)payload_in)->transaction_control.transaction_id = resume->transaction_id;
+    ((middle_fragment_t *)payload_in)->fragment_number = fragment_number;
+
+    memcpy(payload_in + header_size, resume->buffer + offset, fragment_size);
+    wps_send(connection, payload_in, header_size + fragment_size, err);
+}
+
+/** @brief Handle the received frame if it belongs to a resumable transaction.
+ *
+ *  Fragments are copied to their place in the resume buffer as soon as they are received, so they can arrive in any
+ *  order. Reception reports are handled on the connection carrying them. The frame is released in both cases.
+ *
+ *  @param[in] connection  Connection instance.
+ *  @retval true   The frame has been handled and released.
+ *  @retval false  The frame is not part of a resumable transaction.
+ */
+static bool resume_read_process(wps_connection_t *connection)
+{
+    xlayer_queue_node_t *node = xlayer_queue_get_node(&connection->frag.xlayer_queue);
+    const uint8_t *payload;
+    size_t size;
+    uint8_t transfer_type;
+
+    if (node == NULL) {
+        return false;
+    }
+
+    payload = node->xlayer.frame.payload_begin_it;
+    size = node->xlayer.frame.payload_end_it - node->xlayer.frame.payload_begin_it;
+    if (size < sizeof(transaction_control_t)) {
+        return false;
+    }
+    transfer_type = ((const transaction_control_t *)payload)->transfer_type;
+
+    if ((connection->frag.resume.data_connection != NULL) &&
+        ((transfer_type == RESUME_REPORT_TRANSFER_TYPE) || (transfer_type == ABORT_TRANSFER_TYPE))) {
+        resume_process_report(connection->frag.resume.data_connection, payload, size);
+    } else if (connection->frag.resume.enabled && (transfer_type != FULL_FRAME_TRANSFER_TYPE)) {
+        resume_process_fragment(connection, payload, size);
+    } else {
+        return false;
+    }
+
+    node = xlayer_queue_dequeue_node(&connection->frag.xlayer_queue);
+    wps_mac_xlayer_free_node_with_data(connection, node);
+
+    return true;
+}
+
+/** @brief Reassemble a received fragment of a resumable transaction.
+ *
+ *  A reception report is sent when the transaction is complete, when the last fragment is received and when the last
+ *  fragment requested by the previous report is received.
+ *
+ *  @param[in] connection  Connection instance.
+ *  @param[in] payload     Fragment.
+ *  @param[in] size        Fragment size in bytes.
+ */
+static void resume_process_fragment(wps_connection_t *connection, const uint8_t *payload, size_t size)
+{
+    frag_resume_t *resume = &connection->frag.resume;
+    const middle_fragment_t *fragment = (const middle_fragment_t *)payload;
+    uint8_t transfer_type = fragment->transaction_control.transfer_type;
+    uint8_t transaction_id = fragment->transaction_control.transaction_id;
+    uint16_t fragment_number;
+    uint16_t offset;
+    size_t header_size;
+
+    if (((transfer_type != NON_LAST_FRAGMENT_TRANSFER_TYPE) && (transfer_type != LAST_FRAGMENT_TRANSFER_TYPE)) ||
+        (size < sizeof(middle_fragment_t))) {
+        return;
+    }
+    fragment_number = fragment->fragment_number;
+    header_size = ((transfer_type == NON_LAST_FRAGMENT_TRANSFER_TYPE) && (fragment_number == 0)) ?
+                      sizeof(first_fragment_t) :
+                      sizeof(middle_fragment_t);
+    if (size < header_size) {
+        return;
+    }
+
+    if ((resume->state != FRAG_RESUME_IN_PROGRESS) && resume->transaction_done &&
+        (transaction_id == resume->transaction_id)) {
+        /* Transaction already reassembled, the acknowledgment has been lost. */
+        resume_send_report(connection, RESUME_REPORT_TRANSFER_TYPE);
+        return;
+    }
+    if (resume->state == FRAG_RESUME_COMPLETE) {
+        /* Previous frame not read yet, the fragment is requested again once the sender polls. */
+        return;
+    }
+    if ((resume->state == FRAG_RESUME_IN_PROGRESS) && (transaction_id != resume->transaction_id)) {
+        /* The sender has given up the current transaction. */
+        resume_abort_reception(connection);
+    }
+    if (resume->state == FRAG_RESUME_IDLE) {
+        resume->state = FRAG_RESUME_IN_PROGRESS;
+        resume->transaction_id = transaction_id;
+        resume->transaction_done = false;
+        resume->fragment_count = 0;
+        resume->received_count = 0;
+        resume->report_trigger_index = UINT16_MAX;
+        memset(resume->bitmap, 0, sizeof(resume->bitmap));
+    }
+
+    offset = resume_get_fragment_offset(connection, fragment_number);
+    size -= header_size;
+    if (((offset + size) > resume->buffer_size) ||
+        ((header_size == sizeof(first_fragment_t)) &&
+         (((const first_fragment_t *)payload)->total_upper_layer_frame_size > resume->buffer_size))) {
+        resume_send_report(connection, ABORT_TRANSFER_TYPE);
+        resume_abort_reception(connection);
+        return;
+    }
+
+    if ((transfer_type == LAST_FRAGMENT_TRANSFER_TYPE) && (resume->fragment_count == 0)) {
+        resume->fragment_count = fragment_number + 1;
+        resume->frame_size = offset + size;
+    }
+    if (!bitmap_get(resume->bitmap, fragment_number)) {
+        memcpy(resume->buffer + offset, payload + header_size, size);
+        bitmap_set(resume->bitmap, fragment_number);
+        resume->received_count++;
+    }
+
+    if ((resume->fragment_count != 0) && (resume->received_count >= resume->fragment_count)) {
+        resume->state = FRAG_RESUME_COMPLETE;
+        resume->transaction_done = true;
+        resume_send_report(connection, RESUME_REPORT_TRANSFER_TYPE);
+        /* The reassembled frame is always counted, wps_frag_read() uncounts it whether a callback is set or not. */
+        connection->frag.enqueued_count++;
+        if (connection->frag.rx_success_callback != NULL) {
+            connection->frag.rx_success_callback(connection->cfg.conn, connection->frag.rx_success_parg_callback);
+        }
+    } else if ((transfer_type == LAST_FRAGMENT_TRANSFER_TYPE) ||
+               ((resume->fragment_count != 0) && (fragment_number >= resume->report_trigger_index))) {
+        resume_send_report(connection, RESUME_REPORT_TRANSFER_TYPE);
+    }
+}
+
+/** @brief Handle a reception report of a resumable transaction.
+ *
+ *  @param[in] connection  Connection instance the report refers to.
+ *  @param[in] payload     Reception report.
+ *  @param[in] size        Reception report size in bytes.
+ */
+static void resume_process_report(wps_connection_t *connection, const uint8_t *payload, size_t size)
+{
+    frag_resume_t *resume = &connection->frag.resume;
+    const resume_report_t *report = (const resume_report_t *)payload;
+    const uint8_t *bitmap = payload + sizeof(resume_report_t);
+    uint16_t bit_count;
+
+    if ((size < sizeof(resume_report_t)) || (resume->state != FRAG_RESUME_IN_PROGRESS) ||
+        (report->transaction_control.transaction_id != resume->transaction_id)) {
+        return;
+    }
+
+    if (report->transaction_control.transfer_type == ABORT_TRANSFER_TYPE) {
+        wps_frag_abort(connection);
+        if (connection->tx_drop_callback != NULL) {
+            connection->tx_drop_callback(connection->cfg.conn, connection->tx_drop_parg_callback);
+        }
+        return;
+    }
+
+    bit_count = (size - sizeof(resume_report_t)) * BITS_PER_BYTE;
+    if (bit_count == 0) {
+        /* Whole frame acknowledged. */
+        wps_frag_abort(connection);
+        if (connection->frag.tx_success_callback != NULL) {
+            connection->frag.tx_success_callback(connection->cfg.conn, connection->frag.tx_success_parg_callback);
+        }
+        return;
+    }
+
+    /* The application context may be enqueuing fragments, the bitmap is only updated in a critical section. */
+    CRITICAL_SECTION_ENTER();
+    for (uint16_t i = 0; i < bit_count; i++) {
+        uint16_t fragment_number = report->first_fragment_number + i;
+
+        if ((fragment_number < resume->fragment_count) && bitmap_get(bitmap, i)) {
+            bitmap_set(resume->bitmap, fragment_number);
+        }
+    }
+    resume_send_pending(connection);
+    CRITICAL_SECTION_EXIT();
+}
+
+/** @brief Send a reception report of the resumable transaction on the feedback connection.
+ *
+ *  The report lists the missing fragments starting from the first one, as many as fit in the feedback connection
+ *  payload. The sender enqueues them again and the receiver reports again once the last one is received.
+ *
+ *  @param[in] connection     Connection instance.
+ *  @param[in] transfer_type  RESUME_REPORT_TRANSFER_TYPE or ABORT_TRANSFER_TYPE.
+ */
+static void resume_send_report(wps_connection_t *connection, fragment_transfer_type_t transfer_type)
+{
+    frag_resume_t *resume = &connection->frag.resume;
+    wps_connection_t *feedback_connection = resume->feedback_connection;
+    wps_error_t err = WPS_NO_ERROR;
+    resume_report_t *report = NULL;
+    uint8_t *payload_in = NULL;
+    uint16_t first_missing = 0;
+    uint16_t bitmap_size = 0;
+
+    if ((transfer_type == RESUME_REPORT_TRANSFER_TYPE) && !resume->transaction_done) {
+        while ((first_missing < resume->fragment_count) && bitmap_get(resume->bitmap, first_missing)) {
+            first_missing++;
+        }
+        bitmap_size = (resume->fragment_count - first_missing + BITS_PER_BYTE - 1) / BITS_PER_BYTE;
+        if (bitmap_size > (feedback_connection->payload_size - sizeof(resume_report_t))) {
+            bitmap_size = feedback_connection->payload_size - sizeof(resume_report_t);
+        }
+    }
+
+    wps_get_free_slot(feedback_connection, &payload_in, sizeof(resume_report_t) + bitmap_size, &err);
+    if (err != WPS_NO_ERROR) {
+        /* The sender polls the receiver again. */
+        return;
+    }
+    report = (resume_report_t *)payload_in;
+    report->transaction_control.transfer_type = transfer_type;
+    report->transaction_control.transaction_id = resume->transaction_id;
+    report->first_fragment_number = first_missing;
+
+    memset(payload_in + sizeof(resume_report_t), 0, bitmap_size);
+    for (uint16_t i = 0; i < (bitmap_size * BITS_PER_BYTE); i++) {
+        uint16_t fragment_number = first_missing + i;
+
+        if ((fragment_number < resume->fragment_count) && !bitmap_get(resume->bitmap, fragment_number)) {
+            bitmap_set(payload_in + sizeof(resume_report_t), i);
+            resume->report_trigger_index = fragment_number;
+        }
+    }
+
+    wps_send(feedback_connection, payload_in, sizeof(resume_report_t) + bitmap_size, &err);
+}
+
+/** @brief Give up the resumable transaction being reassembled.
+ *
+ *  @param[in] connection  Connection instance.
+ */
+static void resume_abort_reception(wps_connection_t *connection)
+{
+    connection->frag.resume.state = FRAG_RESUME_IDLE;
+    connection->frag.resume.transaction_done = false;
+
+    if (connection->frag.rx_fail_callback != NULL) {
+        connection->frag.rx_fail_callback(connection->cfg.conn, connection->frag.rx_fail_parg_callback);
+    }
+}
+
+/** @brief Get the offset of a fragment in the upper layer frame.
+ *
+ *  @param[in] connection       Connection instance.
+ *  @param[in] fragment_number  Index of the fragment.
+ *  @return Offset in bytes.
+ */
+static uint16_t resume_get_fragment_offset(wps_connection_t *connection, uint16_t fragment_number)
+{
+    if (fragment_number == 0) {
+        return 0;
+    }
+
+    return (connection->payload_size - sizeof(first_fragment_t)) +
+           (fragment_number - 1) * (connection->payload_size - sizeof(middle_fragment_t));
+}
+
+/** @brief Get the number of fragments of a resumable transaction.
+ *
+ *  @param[in] connection  Connection instance.
+ *  @param[in] size        Upper layer frame size in bytes.
+ *  @return Number of fragments.
+ */
+static uint16_t resume_get_fragment_count(wps_connection_t *connection, size_t size)
+{
+    size_t first_payload = connection->payload_size - sizeof(first_fragment_t);
+    size_t subsequent_payload = connection->payload_size - sizeof(middle_fragment_t);
+
+    if (size <= first_payload) {
+        return 1;
+    }
+
+    /* The last fragment follows the full middle fragments, even if it is empty. */
+    return 2 + (size - first_payload) / subsequent_payload;
+}
+
+/** @brief Get a bit of a fragment bitmap.
+ *
+ *  @param[in] bitmap  Bitmap.
+ *  @param[in] index   Bit index.
+ *  @return Bit value.
+ */
+static inline bool bitmap_get(const uint8_t *bitmap, uint16_t index)
+{
+    return (bitmap[index / BITS_PER_BYTE] & (1 << (index % BITS_PER_BYTE))) != 0;
+}
+
+/** @brief Set a bit of a fragment bitmap.
+ *
+ *  @param[in] bitmap  Bitmap.
+ *  @param[in] index   Bit index.
+ */
+static inline void bitmap_set(uint8_t *bitmap, uint16_t index)
+{
+    bitmap[index / BITS_PER_BYTE] |= (1 << (index % BITS_PER_BYTE));
+}
+
+/** @brief Clear a bit of a fragment bitmap.
+ *
+ *  @param[in] bitmap  Bitmap.
+ *  @param[in] index   Bit index.
+ */
+static inline void bitmap_clear(uint8_t *bitmap, uint16_t index)
+{
+    bitmap[index / BITS_PER_BYTE] &= ~(1 << (index % BITS_PER_BYTE));
+}
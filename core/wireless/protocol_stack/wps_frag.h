@@ -26,6 +26,47 @@ extern "C" {
  */
 void wps_frag_init(wps_connection_t *connection, void *meta_tx_buffer, uint32_t meta_tx_size, wps_error_t *err);
 
+/** @brief Enable resumable transactions on a fragmentation connection.
+ *
+ *  The sender keeps each frame until the receiver acknowledges it. The receiver reassembles the fragments in any order
+ *  and sends reception reports listing the missing fragments on the feedback connection, so that only those are sent
+ *  again instead of the whole frame. Only one transaction is in progress at a time: wps_frag_send() returns
+ *  WPS_QUEUE_FULL_ERROR until the previous frame is acknowledged, and the TX success callback is raised once per
+ *  acknowledged frame.
+ *
+ *  @note This needs to be enabled on both sides, with the same buffer size. Both connections must have fragmentation
+ *        enabled and the feedback connection goes in the opposite direction. The frame may be larger than the
+ *        connection queue, up to WPS_FRAG_RESUME_MAX_FRAGMENT_COUNT fragments.
+ *
+ *  @param[in]  connection           Connection instance carrying the fragments.
+ *  @param[in]  feedback_connection  Connection instance carrying the reception reports.
+ *  @param[in]  buffer               Frame buffer, holding the frame to retransmit or the frame being reassembled.
+ *  @param[in]  buffer_size          Frame buffer size, the largest frame size.
+ *  @param[out] err                  Pointer to the error code.
+ */
+void wps_frag_enable_resume(wps_connection_t *connection, wps_connection_t *feedback_connection, uint8_t *buffer,
+                            uint16_t buffer_size, wps_error_t *err);
+
+/** @brief Poll the receiver of the resumable transaction in progress.
+ *
+ *  The last fragment is sent again, which makes the receiver send a new reception report. Use it when the frame is
+ *  not acknowledged within the application timeout, since a lost last fragment or a lost report stalls the
+ *  transaction.
+ *
+ *  @param[in]  connection  Connection instance.
+ *  @param[out] err         Pointer to the error code.
+ */
+void wps_frag_poll(wps_connection_t *connection, wps_error_t *err);
+
+/** @brief Give up the resumable transaction in progress.
+ *
+ *  The fragments already enqueued are still sent, the receiver drops the partial frame when the next transaction
+ *  starts.
+ *
+ *  @param[in] connection  Connection instance.
+ */
+void wps_frag_abort(wps_connection_t *connection);
+
 /** @brief Send payload over the air.
  *
  *  Enqueue a node in the connection Xlayer and WPS will
@@ -38,6 +79,19 @@ void wps_frag_init(wps_connection_t *connection, void *meta_tx_buffer, uint32_t
  */
 void wps_frag_send(wps_connection_t *connection, const uint8_t *payload, size_t size, wps_error_t *err);
 
+/** @brief Send a payload gathered from several segments over the air.
+ *
+ *  The segments are copied directly in the fragments, a fragment may hold the end of a segment and the start of the
+ *  next one. This avoids assembling the payload in an intermediate buffer.
+ *
+ *  @param[in]  connection     Connection instance.
+ *  @param[in]  segments       Application payload segments to send over the air, in order.
+ *  @param[in]  segment_count  Number of segments.
+ *  @param[out] err            Pointer to the error code.
+ */
+void wps_frag_sendv(wps_connection_t *connection, const wps_payload_segment_t *segments, uint8_t segment_count,
+                    wps_error_t *err);
+
 /** @brief Read last received frame.
  *
  *  @param[in]  connection  Connection instance.
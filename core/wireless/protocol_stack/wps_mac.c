@@ -11,6 +11,7 @@
 #include "wps_mac.h"
 #include "wps.h"
 #include "wps_config.h"
+#include "xlayer_circular_data.h"
 
 /* CONSTANTS ******************************************************************/
 #define SYNC_PLL_STARTUP_CYCLES ((uint32_t)0x60)
@@ -21,6 +22,7 @@
 static void process_main_frame_outcome(wps_mac_t *wps_mac);
 static void process_auto_frame_outcome(wps_mac_t *wps_mac);
 static void update_sync(wps_mac_t *wps_mac);
+static void update_cca_adaptive(wps_mac_t *wps_mac);
 static void process_rx_main(wps_mac_t *wps_mac);
 static void process_rx_auto(wps_mac_t *wps_mac);
 static void process_tx_main(wps_mac_t *wps_mac);
@@ -36,6 +38,7 @@ static void prepare_tx_auto(wps_mac_t *wps_mac);
 static void prepare_rx_auto(wps_mac_t *wps_mac);
 static void process_next_timeslot(wps_mac_t *wps_mac);
 static bool is_saw_arq_enable(wps_connection_t *connection);
+static bool is_sr_arq_enable(wps_connection_t *connection);
 static bool is_saw_arq_guaranteed_delivery_mode(saw_arq_t *saw_arq);
 static bool no_payload_received(xlayer_t *current_queue);
 static void extract_header_main(wps_mac_t *wps_mac, xlayer_t *current_queue);
@@ -46,9 +49,16 @@ static void flush_timeout_frames_before_sending(wps_mac_t *wps_mac, wps_connecti
                                                 xlayer_callback_t *callback);
 static void flush_tx_frame(wps_mac_t *wps_mac, wps_connection_t *connection, xlayer_callback_t *callback);
 static bool send_done(wps_connection_t *connection);
+static void select_sr_arq_tx_frame(wps_mac_t *wps_mac, wps_connection_t *connection, xlayer_callback_t *callback);
+static void hold_sr_arq_frame(wps_connection_t *connection, xlayer_queue_node_t *node, uint8_t slot);
+static void deliver_sr_arq_frames(wps_mac_t *wps_mac, wps_connection_t *connection);
 #if !WPS_DISABLE_LINK_THROTTLE
 static void handle_link_throttle(wps_mac_t *wps_mac, uint8_t *inc_count);
 #endif /* !WPS_DISABLE_LINK_THROTTLE */
+#if !WPS_DISABLE_DYNAMIC_ALLOCATION
+static void apply_dynamic_allocation(wps_mac_t *wps_mac, timeslot_t *time_slot);
+static uint8_t get_dynamic_timeslot_connection_id(wps_mac_t *wps_mac);
+#endif /* !WPS_DISABLE_DYNAMIC_ALLOCATION */
 static inline wps_error_t get_status_error(link_connect_status_t *link_connect_status);
 static void update_connect_status_main(wps_mac_t *wps_mac, wps_connection_t *conn);
 static void update_connect_status_auto(wps_mac_t *wps_mac, wps_connection_t *conn);
@@ -262,6 +272,21 @@ static void update_sync(wps_mac_t *wps_mac)
     }
 }
 
+/** @brief Update the adaptive CCA statistics of the channel used by the last transmission.
+ *
+ *  @param[in] wps_mac  MAC structure.
+ */
+static void update_cca_adaptive(wps_mac_t *wps_mac)
+{
+    if ((wps_mac->config.cca_max_try_count == 0) || (wps_mac->config.channel == &wps_mac->muted_transfer_channel)) {
+        return;
+    }
+
+    link_cca_adaptive_update(&wps_mac->main_connection->cca_adaptive, wps_mac->channel_index,
+                             wps_mac->config.cca_try_count,
+                             wps_mac->config.cca_try_count < wps_mac->config.cca_max_try_count);
+}
+
 /** @brief Update the connection status for the current main connection.
  *
  *  @param[in] wps_mac  WPS MAC instance.
@@ -336,6 +361,8 @@ static void process_rx_main(wps_mac_t *wps_mac)
 {
     bool duplicate = false;
     wps_connection_t *connection = NULL;
+    sr_arq_rx_status_t sr_arq_status = SR_ARQ_RX_IN_ORDER;
+    uint8_t sr_arq_slot = 0;
 
     link_ddcm_pll_cycles_update(&wps_mac->link_ddcm, link_tdma_sync_get_sleep_cycles(&wps_mac->tdma_sync));
 
@@ -362,7 +389,16 @@ static void process_rx_main(wps_mac_t *wps_mac)
     wps_mac->main_xlayer->config.rssi_raw = wps_mac->config.rssi_raw;
     wps_mac->main_xlayer->config.rnsi_raw = wps_mac->config.rnsi_raw;
 
-    duplicate = link_saw_arq_is_rx_frame_duplicate(&wps_mac->main_connection->stop_and_wait_arq);
+    if (is_sr_arq_enable(wps_mac->main_connection)) {
+        /* The transmitter window base may have moved past missing frames, release the ones held back. */
+        deliver_sr_arq_frames(wps_mac, wps_mac->main_connection);
+        if (!no_payload_received(wps_mac->main_xlayer)) {
+            sr_arq_status = link_sr_arq_rx_classify(&wps_mac->main_connection->selective_repeat_arq, &sr_arq_slot);
+        }
+        duplicate = (sr_arq_status == SR_ARQ_RX_DUPLICATE);
+    } else {
+        duplicate = link_saw_arq_is_rx_frame_duplicate(&wps_mac->main_connection->stop_and_wait_arq);
+    }
     /* Increment duplicate only if frame have payload and is not internal to the MAC */
     if (duplicate && !no_payload_received(wps_mac->main_xlayer)) {
         link_saw_arq_incr_duplicate_count(&wps_mac->main_connection->stop_and_wait_arq);
@@ -395,14 +431,25 @@ static void process_rx_main(wps_mac_t *wps_mac)
 
     /* Frame successfully received */
     wps_mac->output_signal.main_signal = MAC_SIGNAL_WPS_FRAME_RX_SUCCESS;
-    wps_mac->config.callback_main.callback = wps_mac->main_connection->rx_success_callback;
-    wps_mac->config.callback_main.parg_callback = wps_mac->main_connection->rx_success_parg_callback;
-    wps_mac->config.callback_main.conn = wps_mac->main_connection->cfg.conn;
-    xlayer_queue_enqueue_node(wps_mac->main_connection->rx_queue, wps_mac->rx_node);
-    wps_callback_enqueue(&wps_mac->callback_queue, &wps_mac->config.callback_main);
     if (wps_mac->config.phases_info != NULL) {
         memcpy(&wps_mac->main_xlayer->config.phases_info, wps_mac->config.phases_info, sizeof(phase_info_t));
     }
+    if (sr_arq_status == SR_ARQ_RX_OUT_OF_ORDER) {
+        /* A previous frame is missing, the application is notified when the frame is delivered. */
+        hold_sr_arq_frame(wps_mac->main_connection, wps_mac->rx_node, sr_arq_slot);
+        wps_mac->rx_node = NULL;
+    } else {
+        wps_mac->config.callback_main.callback = wps_mac->main_connection->rx_success_callback;
+        wps_mac->config.callback_main.parg_callback = wps_mac->main_connection->rx_success_parg_callback;
+        wps_mac->config.callback_main.conn = wps_mac->main_connection->cfg.conn;
+        xlayer_queue_enqueue_node(wps_mac->main_connection->rx_queue, wps_mac->rx_node);
+        wps_callback_enqueue(&wps_mac->callback_queue, &wps_mac->config.callback_main);
+        if (is_sr_arq_enable(wps_mac->main_connection)) {
+            link_sr_arq_rx_accept(&wps_mac->main_connection->selective_repeat_arq, SR_ARQ_RX_IN_ORDER);
+            /* The frames held back right after this one can now be delivered. */
+            deliver_sr_arq_frames(wps_mac, wps_mac->main_connection);
+        }
+    }
 
     link_ddcm_cca_event_update(&wps_mac->link_ddcm, wps_mac->config.rx_cca_retry_count, wps_mac->config.cca_retry_time,
                                wps_mac->output_signal.main_signal == MAC_SIGNAL_WPS_FRAME_RX_SUCCESS);
@@ -507,7 +554,15 @@ static void process_tx_main(wps_mac_t *wps_mac)
             link_saw_arq_inc_seq_num(&wps_mac->main_connection->stop_and_wait_arq);
             link_credit_flow_ctrl_frame_ack_received(&wps_mac->main_connection->credit_flow_ctrl);
         }
-        send_done(wps_mac->main_connection);
+        if (is_sr_arq_enable(wps_mac->main_connection)) {
+            /* The frame leaves the TX queue once all the older ones are acknowledged. */
+            link_sr_arq_tx_done(&wps_mac->main_connection->selective_repeat_arq, true);
+            while (link_sr_arq_tx_release(&wps_mac->main_connection->selective_repeat_arq)) {
+                send_done(wps_mac->main_connection);
+            }
+        } else {
+            send_done(wps_mac->main_connection);
+        }
     } else {
         /* Update status of all connections in the timeslot (None of them transmitted a packet). */
         for (uint8_t i = 0; i < wps_mac->timeslot->main_conn_list.connection_count; i++) {
@@ -521,11 +576,14 @@ static void process_tx_main(wps_mac_t *wps_mac)
         wps_callback_enqueue(&wps_mac->callback_queue, &wps_mac->config.callback_main);
         if (!is_saw_arq_enable(wps_mac->main_connection)) {
             send_done(wps_mac->main_connection);
+        } else if (is_sr_arq_enable(wps_mac->main_connection)) {
+            link_sr_arq_tx_done(&wps_mac->main_connection->selective_repeat_arq, false);
         }
     }
 
     /* Update LQI statistics */
     wps_mac_statistics_update_main_conn(wps_mac);
+    update_cca_adaptive(wps_mac);
 
     link_ddcm_pll_cycles_update(&wps_mac->link_ddcm, link_tdma_sync_get_sleep_cycles(&wps_mac->tdma_sync));
     link_ddcm_cca_event_update(&wps_mac->link_ddcm, wps_mac->config.cca_try_count, wps_mac->config.cca_retry_time,
@@ -562,6 +620,7 @@ static void process_tx_main_empty(wps_mac_t *wps_mac)
 
     /* Update LQI statistics for empty frame */
     wps_mac_statistics_update_main_conn_empty_frame(wps_mac);
+    update_cca_adaptive(wps_mac);
 
     link_ddcm_pll_cycles_update(&wps_mac->link_ddcm, link_tdma_sync_get_sleep_cycles(&wps_mac->tdma_sync));
 }
@@ -701,6 +760,7 @@ static void prepare_tx_main(wps_mac_t *wps_mac)
 
     for (uint8_t i = 0; i < wps_mac->timeslot->main_conn_list.connection_count; i++) {
         if (is_saw_arq_enable(wps_mac->timeslot->main_conn_list.connection[i]) &&
+            !is_sr_arq_enable(wps_mac->timeslot->main_conn_list.connection[i]) &&
             is_saw_arq_guaranteed_delivery_mode(&wps_mac->timeslot->main_conn_list.connection[i]->stop_and_wait_arq) ==
                 false) {
             flush_timeout_frames_before_sending(wps_mac, wps_mac->timeslot->main_conn_list.connection[i],
@@ -709,12 +769,14 @@ static void prepare_tx_main(wps_mac_t *wps_mac)
         if (wps_mac->timeslot->main_conn_list.connection[i]->tx_flush) {
             flush_tx_frame(wps_mac, wps_mac->timeslot->main_conn_list.connection[i], &wps_mac->config.callback_main);
         }
+        if (is_sr_arq_enable(wps_mac->timeslot->main_conn_list.connection[i])) {
+            select_sr_arq_tx_frame(wps_mac, wps_mac->timeslot->main_conn_list.connection[i],
+                                   &wps_mac->config.callback_main);
+        }
     }
     if (wps_mac->timeslot->main_conn_list.connection_count > 1) {
         wps_mac->main_connection_id =
-            wps_conn_priority_get_highest_main_conn_index(wps_mac->timeslot->main_conn_list.connection,
-                                                          wps_mac->timeslot->main_conn_list.priority,
-                                                          wps_mac->timeslot->main_conn_list.connection_count);
+            wps_conn_priority_get_highest_main_conn_index(&wps_mac->timeslot->main_conn_list);
         wps_mac->main_connection = link_scheduler_get_current_main_connection(&wps_mac->scheduler,
                                                                               wps_mac->main_connection_id);
     }
@@ -905,7 +967,18 @@ static void config_tx(wps_mac_t *wps_mac, uint32_t next_channel)
         wps_mac->current_phy_mode = CHIP_RATE_20_48_ISI_1;
     }
 
-    wps_mac->config.cca_retry_time = wps_mac->main_connection->cca.retry_time_pll_cycles;
+    if (wps_mac->main_connection->cca.fail_action == CCA_FAIL_ACTION_ABORT_TX) {
+        /* Spend less airtime on a persistently busy channel, the frame is retried on the next one. */
+        cca_max_try_count = link_cca_adaptive_get_try_count(&wps_mac->main_connection->cca_adaptive, next_channel,
+                                                            cca_max_try_count);
+    }
+    if (wps_mac_is_network_node(wps_mac)) {
+        /* The coordinator keeps the configured retry time, the nodes rely on it to compensate the CCA delay. */
+        wps_mac->config.cca_retry_time = link_cca_adaptive_get_retry_time(
+            &wps_mac->main_connection->cca_adaptive, next_channel, wps_mac->main_connection->cca.retry_time_pll_cycles);
+    } else {
+        wps_mac->config.cca_retry_time = wps_mac->main_connection->cca.retry_time_pll_cycles;
+    }
     wps_mac->config.cca_max_try_count = cca_max_try_count;
     wps_mac->config.cca_on_time = wps_mac->main_connection->cca.on_time_pll_cycles;
     wps_mac->config.cca_try_count = 0;
@@ -1030,9 +1103,7 @@ static void prepare_tx_auto(wps_mac_t *wps_mac)
     }
     if (wps_mac->timeslot->auto_conn_list.connection_count > 1) {
         wps_mac->auto_connection_id =
-            wps_conn_priority_get_highest_auto_conn_index(wps_mac->timeslot->auto_conn_list.connection,
-                                                          wps_mac->timeslot->auto_conn_list.priority,
-                                                          wps_mac->timeslot->auto_conn_list.connection_count);
+            wps_conn_priority_get_highest_auto_conn_index(&wps_mac->timeslot->auto_conn_list);
         wps_mac->auto_connection = link_scheduler_get_current_auto_connection(&wps_mac->scheduler,
                                                                               wps_mac->auto_connection_id);
     }
@@ -1103,7 +1174,11 @@ static void process_next_timeslot(wps_mac_t *wps_mac)
 
     wps_mac->channel_index = link_channel_hopping_get_channel(&wps_mac->channel_hopping);
     wps_mac->timeslot = link_scheduler_get_current_timeslot(&wps_mac->scheduler);
+#if !WPS_DISABLE_DYNAMIC_ALLOCATION
+    wps_mac->main_connection_id = get_dynamic_timeslot_connection_id(wps_mac);
+#else
     wps_mac->main_connection_id = 0;
+#endif
     wps_mac->auto_connection_id = 0;
     wps_mac->main_connection = link_scheduler_get_current_main_connection(&wps_mac->scheduler,
                                                                           wps_mac->main_connection_id);
@@ -1141,6 +1216,17 @@ static bool is_saw_arq_enable(wps_connection_t *connection)
     return connection->stop_and_wait_arq.enable;
 }
 
+/** @brief Return if selective repeat is enable or not.
+ *
+ *  @param[in] connection  Connection.
+ *  @retval True   Selective repeat ARQ is enable.
+ *  @retval False  Selective repeat ARQ is disable.
+ */
+static bool is_sr_arq_enable(wps_connection_t *connection)
+{
+    return is_saw_arq_enable(connection) && link_sr_arq_is_enabled(&connection->selective_repeat_arq);
+}
+
 /** @brief Return if stop and wait is in guaranteed delivery mode.
  *
  *  @note Guaranteed delivery mode is achieved when ttl_retry and ttl_ms are
@@ -1357,6 +1443,129 @@ static void flush_tx_frame(wps_mac_t *wps_mac, wps_connection_t *connection, xla
         wps_mac->output_signal.main_signal = MAC_SIGNAL_WPS_TX_DROP;
         wps_mac_statistics_update_tx_dropped_conn_stats(connection);
         send_done(connection);
+        if (is_sr_arq_enable(connection)) {
+            link_sr_arq_tx_skip(&connection->selective_repeat_arq, 1);
+        }
+    }
+}
+
+/** @brief Select the frame to send on a selective repeat connection.
+ *
+ *  Acknowledged frames are released from the head of the TX queue and the oldest
+ *  frame is dropped when its time to live expires, the same way as in stop and wait.
+ *
+ *  @param[in] wps_mac     WPS MAC instance.
+ *  @param[in] connection  Connection.
+ *  @param[in] callback    Callback used to notify a dropped frame.
+ */
+static void select_sr_arq_tx_frame(wps_mac_t *wps_mac, wps_connection_t *connection, xlayer_callback_t *callback)
+{
+    sr_arq_t *sr_arq = &connection->selective_repeat_arq;
+    xlayer_queue_node_t *xlayer_queue_node = NULL;
+    bool timeout = false;
+    uint8_t offset = 0;
+
+    /* Frames acknowledged by the ACK bitmap are released once all the older ones are. */
+    while (link_sr_arq_tx_release(sr_arq)) {
+        send_done(connection);
+    }
+
+    do {
+        timeout = false;
+        offset = link_sr_arq_select_tx_frame(sr_arq, xlayer_queue_get_size(&connection->xlayer_queue));
+        xlayer_queue_node = xlayer_queue_get_node_at(&connection->xlayer_queue, offset);
+        if (xlayer_queue_node == NULL) {
+            break;
+        }
+        if ((offset == 0) && !is_saw_arq_guaranteed_delivery_mode(&connection->stop_and_wait_arq)) {
+            timeout = link_saw_arq_is_frame_timeout(&connection->stop_and_wait_arq,
+                                                    xlayer_queue_node->xlayer.frame.time_stamp,
+                                                    xlayer_queue_node->xlayer.frame.retry_count++,
+                                                    connection->cfg.get_tick());
+        } else {
+            /* Only the oldest frame can be dropped, the other ones expire when they reach the head. */
+            xlayer_queue_node->xlayer.frame.retry_count++;
+        }
+        if (timeout) {
+            callback->callback = connection->tx_drop_callback;
+            callback->parg_callback = connection->tx_drop_parg_callback;
+            callback->conn = connection->cfg.conn;
+            wps_callback_enqueue(&wps_mac->callback_queue, callback);
+            wps_mac->output_signal.main_signal = MAC_SIGNAL_WPS_TX_DROP;
+            wps_mac_statistics_update_tx_dropped_conn_stats(connection);
+            send_done(connection);
+            link_sr_arq_tx_skip(sr_arq, 1);
+        }
+    } while (timeout);
+}
+
+/** @brief Hold back a frame received out of order.
+ *
+ *  The RX buffer must be released in order, so the payload is moved to the reorder
+ *  buffer and its RX buffer space is released right away.
+ *
+ *  @param[in] connection  Connection.
+ *  @param[in] node        Received node.
+ *  @param[in] slot        Reorder slot.
+ */
+static void hold_sr_arq_frame(wps_connection_t *connection, xlayer_queue_node_t *node, uint8_t slot)
+{
+    xlayer_frame_t *frame = &node->xlayer.frame;
+    uint8_t *held_memory = connection->sr_arq_rx_payload + (slot * connection->payload_size);
+    uint8_t begin_offset = frame->payload_begin_it - frame->payload_memory;
+    uint8_t end_offset = frame->payload_end_it - frame->payload_memory;
+
+    memcpy(held_memory, frame->payload_memory, frame->max_frame_size);
+    xlayer_circular_data_free_space(connection->rx_data, frame->payload_memory, frame->max_frame_size);
+    frame->payload_memory = held_memory;
+    frame->payload_begin_it = held_memory + begin_offset;
+    frame->payload_end_it = held_memory + end_offset;
+
+    connection->sr_arq_rx_node[slot] = node;
+    link_sr_arq_rx_accept(&connection->selective_repeat_arq, SR_ARQ_RX_OUT_OF_ORDER);
+}
+
+/** @brief Deliver the frames held back that are no longer waiting for a previous one.
+ *
+ *  @param[in] wps_mac     WPS MAC instance.
+ *  @param[in] connection  Connection.
+ */
+static void deliver_sr_arq_frames(wps_mac_t *wps_mac, wps_connection_t *connection)
+{
+    xlayer_queue_node_t *node = NULL;
+    xlayer_frame_t *frame = NULL;
+    uint8_t *payload_memory = NULL;
+    uint8_t slot = 0;
+    bool buffered = false;
+
+    while (link_sr_arq_rx_pop(&connection->selective_repeat_arq, &slot, &buffered)) {
+        node = connection->sr_arq_rx_node[slot];
+        connection->sr_arq_rx_node[slot] = NULL;
+        if (!buffered || (node == NULL)) {
+            continue;
+        }
+
+        /* Move the payload back to the RX buffer, where the application releases it from. */
+        frame = &node->xlayer.frame;
+        payload_memory = xlayer_circular_data_allocate_space(connection->rx_data, frame->max_frame_size);
+        if (payload_memory == NULL) {
+            frame->payload_memory = NULL;
+            frame->max_frame_size = 0;
+            xlayer_queue_free_node(node);
+            wps_mac->config.callback_main.callback = connection->evt_callback;
+            wps_mac->config.callback_main.parg_callback = connection->evt_parg_callback;
+            connection->wps_error = WPS_RX_OVERRUN_ERROR;
+        } else {
+            memcpy(payload_memory, frame->payload_memory, frame->max_frame_size);
+            frame->payload_begin_it = payload_memory + (frame->payload_begin_it - frame->payload_memory);
+            frame->payload_end_it = payload_memory + (frame->payload_end_it - frame->payload_memory);
+            frame->payload_memory = payload_memory;
+            xlayer_queue_enqueue_node(connection->rx_queue, node);
+            wps_mac->config.callback_main.callback = connection->rx_success_callback;
+            wps_mac->config.callback_main.parg_callback = connection->rx_success_parg_callback;
+        }
+        wps_mac->config.callback_main.conn = connection->cfg.conn;
+        wps_callback_enqueue(&wps_mac->callback_queue, &wps_mac->config.callback_main);
     }
 }
 
@@ -1391,6 +1600,9 @@ static void handle_link_throttle(wps_mac_t *wps_mac, uint8_t *inc_count)
             candidate_connection = time_slot->auto_conn_list.connection[i];
             candidate_connection->currently_enabled = true;
         }
+#if !WPS_DISABLE_DYNAMIC_ALLOCATION
+        apply_dynamic_allocation(wps_mac, time_slot);
+#endif
 
         ts_enabled = false;
         for (uint8_t i = 0; i < time_slot->main_conn_list.connection_count; i++) {
@@ -1408,6 +1620,64 @@ static void handle_link_throttle(wps_mac_t *wps_mac, uint8_t *inc_count)
 }
 #endif /* !WPS_DISABLE_LINK_THROTTLE */
 
+#if !WPS_DISABLE_DYNAMIC_ALLOCATION
+/** @brief Disable the connections of a dynamic time slot not granted to their source.
+ *
+ *  The allocation of the dynamic time slots is updated first when the schedule has started a new superframe.
+ *
+ *  @param[in] wps_mac    WPS MAC instance.
+ *  @param[in] time_slot  Time slot to be processed.
+ */
+static void apply_dynamic_allocation(wps_mac_t *wps_mac, timeslot_t *time_slot)
+{
+    link_dynamic_alloc_t *dynamic_alloc = &wps_mac->dynamic_alloc;
+    wps_connection_t *connection = NULL;
+    uint8_t owner;
+
+    if (!dynamic_alloc->enable) {
+        return;
+    }
+
+    if (dynamic_alloc->superframe_count != wps_mac->scheduler.superframe_count) {
+        link_dynamic_alloc_start_superframe(dynamic_alloc, wps_mac->scheduler.superframe_count,
+                                            wps_mac->node_role == NETWORK_COORDINATOR);
+    }
+
+    if (!link_dynamic_alloc_get_owner(dynamic_alloc, wps_mac->scheduler.current_time_slot_num, &owner)) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < time_slot->main_conn_list.connection_count; i++) {
+        connection = time_slot->main_conn_list.connection[i];
+        if ((uint8_t)connection->cfg.source_address != owner) {
+            connection->currently_enabled = false;
+        }
+    }
+}
+
+/** @brief Get the ID of the connection granted the current time slot.
+ *
+ *  @param[in] wps_mac  WPS MAC instance.
+ *  @return ID of the first enabled main connection if the current time slot is dynamic, 0 otherwise.
+ */
+static uint8_t get_dynamic_timeslot_connection_id(wps_mac_t *wps_mac)
+{
+    timeslot_conn_list_t *conn_list = &wps_mac->timeslot->main_conn_list;
+
+    if (!link_dynamic_alloc_is_dynamic_timeslot(&wps_mac->dynamic_alloc, wps_mac->scheduler.current_time_slot_num)) {
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < conn_list->connection_count; i++) {
+        if (conn_list->connection[i]->currently_enabled) {
+            return i;
+        }
+    }
+
+    return 0;
+}
+#endif /* !WPS_DISABLE_DYNAMIC_ALLOCATION */
+
 /** @brief Get the event associated with the current connection status.
  *
  *  @param[in] link_connect_status Link connection status module instance.
@@ -36,6 +36,9 @@ void wps_mac_certification_init(void *wps_mac)
 
     mac->node_role = NETWORK_COORDINATOR;
 
+    /* The plan is otherwise only compiled by wps_connect(), the walk below needs it to step through the schedule. */
+    link_scheduler_update_plan(&mac->scheduler);
+
     /* Get first timeslots used by the node. */
     link_scheduler_increment_time_slot(&mac->scheduler);
     initial_index = mac->scheduler.current_time_slot_num;
@@ -123,6 +126,9 @@ void wps_mac_certification_init(void *wps_mac)
         link_scheduler_increment_time_slot(&mac->scheduler);
         current_index = mac->scheduler.current_time_slot_num;
     }
+
+    /* Time slot durations, connection sources and connection counts changed, compile the plan again. */
+    link_scheduler_update_plan(&mac->scheduler);
 }
 
 /** @brief Send certification frame on connection.
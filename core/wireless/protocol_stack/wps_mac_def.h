@@ -14,8 +14,10 @@
 #include <stdint.h>
 #include <string.h>
 #include "link_ddcm.h"
+#include "link_dynamic_alloc.h"
 #include "link_scheduler.h"
 #include "link_tdma_sync.h"
+#include "spsc_queue.h"
 #include "wps_config.h"
 #include "wps_def.h"
 #include "wps_mac_statistics.h"
@@ -75,6 +77,12 @@ typedef enum wps_mac_proto_id {
     MAC_PROTO_ID_CREDIT_FC,
     /*! MAC layer phy mode protocol identifier */
     MAC_PROTO_ID_PHY_MODE,
+    /*! MAC layer selective repeat ARQ protocol identifier */
+    MAC_PROTO_ID_SR_ARQ,
+    /*! MAC layer dynamic time slot allocation map protocol identifier */
+    MAC_PROTO_ID_DYNAMIC_ALLOC_MAP,
+    /*! MAC layer queue depth protocol identifier */
+    MAC_PROTO_ID_QUEUE_DEPTH,
 } wps_mac_proto_id_t;
 
 /** @brief Wireless protocol stack MAC Layer output signal parameter.
@@ -205,6 +213,8 @@ typedef struct wps_mac_struct {
     link_rdo_t link_rdo;
     /*! Distributed desync instance. */
     link_ddcm_t link_ddcm;
+    /*! Dynamic time slot allocation instance. */
+    link_dynamic_alloc_t dynamic_alloc;
     /*! RX node */
     xlayer_queue_node_t *rx_node;
     /*! Main connection ID */
@@ -256,8 +266,8 @@ typedef struct wps_mac_struct {
 
     /*! function pointer to trigger the callback process */
     void (*callback_context_switch)(void);
-    /*! Circular queue instance to save the callbacks */
-    circular_queue_t callback_queue;
+    /*! Lock-free queue to save the callbacks, filled by the MAC and emptied by wps_process_callback() */
+    spsc_queue_t callback_queue;
     /*! Circular queue to forward application request to WPS */
     circular_queue_t request_queue;
     /*! WPS throttle feature configuration structure */
@@ -19,6 +19,14 @@
  */
 #define CREDIT_FLOW_CONTROL_MAX_VALUE (255)
 
+/** @brief Size of the queue depth field.
+ */
+#define QUEUE_DEPTH_PROTO_SIZE (1)
+
+/** @brief Maximum value of queue depth send in the frame header.
+ */
+#define QUEUE_DEPTH_MAX_VALUE (255)
+
 /* PRIVATE FUNCTION PROTOTYPES ************************************************/
 static void update_phases_data(wps_phase_info_t *phase_data, uint16_t rx_wait_time);
 static bool is_phase_data_valid(wps_phase_info_t *phase_data);
@@ -71,6 +79,11 @@ void wps_mac_receive_timeslot_id_saw(void *wps_mac, uint8_t *timeslot_id_saw)
         }
     }
 
+    /* Duplicates are detected from the selective repeat sequence number when it is enabled. */
+    if (link_sr_arq_is_enabled(&mac->main_connection->selective_repeat_arq)) {
+        return;
+    }
+
     link_saw_arq_update_rx_seq_num(&mac->main_connection->stop_and_wait_arq,
                                    MASK2VAL(*timeslot_id_saw, HEADER_BYTE0_SEQ_NUM_MASK));
     /* Check if received frame is an auto sync frame */
@@ -467,6 +480,119 @@ uint8_t wps_mac_get_phy_mode_proto_size(void *wps_mac)
     return sizeof(uint8_t);
 }
 
+void wps_mac_send_sr_arq(void *wps_mac, uint8_t *sr_arq)
+{
+    wps_mac_t *mac = wps_mac;
+    sr_arq_t *arq = &mac->main_connection->selective_repeat_arq;
+
+    sr_arq[0] = link_sr_arq_get_tx_seq_num(arq);
+    sr_arq[1] = arq->tx_base_seq;
+}
+
+void wps_mac_receive_sr_arq(void *wps_mac, uint8_t *sr_arq)
+{
+    wps_mac_t *mac = wps_mac;
+    /* The connection ID field has already been read, main_connection is only updated after the whole header. */
+    wps_connection_t *connection = link_scheduler_get_current_main_connection(&mac->scheduler,
+                                                                              mac->main_connection_id);
+
+    link_sr_arq_update_rx_seq_num(&connection->selective_repeat_arq, sr_arq[0], sr_arq[1]);
+}
+
+uint8_t wps_mac_get_sr_arq_proto_size(void *wps_mac)
+{
+    (void)wps_mac;
+
+    return LINK_SR_ARQ_HEADER_SIZE;
+}
+
+void wps_mac_send_sr_arq_header_acknowledge(void *wps_mac, uint8_t *sr_arq)
+{
+    wps_mac_t *mac = wps_mac;
+    wps_connection_t *connection = link_scheduler_get_current_main_connection(&mac->scheduler,
+                                                                              mac->main_ack_connection_id);
+
+    sr_arq[0] = connection->selective_repeat_arq.rx_base_seq;
+    sr_arq[1] = link_sr_arq_get_rx_bitmap(&connection->selective_repeat_arq);
+}
+
+void wps_mac_receive_sr_arq_header_acknowledge(void *wps_mac, uint8_t *sr_arq)
+{
+    wps_mac_t *mac = wps_mac;
+    wps_connection_t *connection = link_scheduler_get_current_main_connection(&mac->scheduler,
+                                                                              mac->main_ack_connection_id);
+    uint8_t new_acked = link_sr_arq_tx_ack_update(&connection->selective_repeat_arq, sr_arq[0], sr_arq[1]);
+
+    /* Frames whose ACK was lost are confirmed here, they are released before the next transmission. */
+    mac->config.callback_auto.callback = connection->tx_success_callback;
+    mac->config.callback_auto.parg_callback = connection->tx_success_parg_callback;
+    mac->config.callback_auto.conn = connection->cfg.conn;
+    while (new_acked > 0) {
+        wps_callback_enqueue(&mac->callback_queue, &mac->config.callback_auto);
+        new_acked--;
+    }
+}
+
+uint8_t wps_mac_get_sr_arq_ack_proto_size(void *wps_mac)
+{
+    (void)wps_mac;
+
+    return LINK_SR_ARQ_ACK_HEADER_SIZE;
+}
+
+void wps_mac_send_dynamic_alloc_map(void *wps_mac, uint8_t *map)
+{
+    wps_mac_t *mac = wps_mac;
+
+    link_dynamic_alloc_write_map(&mac->dynamic_alloc, map);
+}
+
+void wps_mac_receive_dynamic_alloc_map(void *wps_mac, uint8_t *map)
+{
+    wps_mac_t *mac = wps_mac;
+
+    if (mac->node_role == NETWORK_NODE) {
+        link_dynamic_alloc_read_map(&mac->dynamic_alloc, map);
+    }
+}
+
+uint8_t wps_mac_get_dynamic_alloc_map_proto_size(void *wps_mac)
+{
+    wps_mac_t *mac = wps_mac;
+
+    return link_dynamic_alloc_get_map_size(&mac->dynamic_alloc);
+}
+
+void wps_mac_send_queue_depth(void *wps_mac, uint8_t *queue_depth)
+{
+    wps_mac_t *mac = wps_mac;
+    uint16_t pending = xlayer_queue_get_size(&mac->main_connection->xlayer_queue);
+
+    /* The frame being sent is not part of the demand */
+    if (pending > 0) {
+        pending--;
+    }
+
+    *queue_depth = (pending > QUEUE_DEPTH_MAX_VALUE) ? QUEUE_DEPTH_MAX_VALUE : (uint8_t)pending;
+}
+
+void wps_mac_receive_queue_depth(void *wps_mac, uint8_t *queue_depth)
+{
+    wps_mac_t *mac = wps_mac;
+
+    if (mac->node_role == NETWORK_COORDINATOR) {
+        link_dynamic_alloc_set_demand(&mac->dynamic_alloc, (uint8_t)mac->main_connection->cfg.source_address,
+                                      *queue_depth);
+    }
+}
+
+uint8_t wps_mac_get_queue_depth_proto_size(void *wps_mac)
+{
+    (void)wps_mac;
+
+    return QUEUE_DEPTH_PROTO_SIZE;
+}
+
 /* PRIVATE FUNCTIONS ***********************************************************/
 /** @brief Update phases data.
  *
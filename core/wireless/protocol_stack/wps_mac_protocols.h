@@ -230,6 +230,92 @@ void wps_mac_handle_missing_phy_mode(void *wps_mac);
  */
 uint8_t wps_mac_get_phy_mode_proto_size(void *wps_mac);
 
+/** @brief Interface to write the selective repeat ARQ sequence number and window base to the header buffer.
+ *
+ *  @param[in] wps_mac  MAC Layer instance.
+ *  @param[in] sr_arq   Selective repeat ARQ field buffer pointer.
+ */
+void wps_mac_send_sr_arq(void *wps_mac, uint8_t *sr_arq);
+
+/** @brief Interface to read the selective repeat ARQ sequence number and window base from the header buffer.
+ *
+ *  @param[in]  wps_mac  MAC Layer instance.
+ *  @param[out] sr_arq   Selective repeat ARQ field buffer pointer.
+ */
+void wps_mac_receive_sr_arq(void *wps_mac, uint8_t *sr_arq);
+
+/** @brief Get the size of the selective repeat ARQ header field.
+ *
+ *  @param[in] wps_mac MAC Layer instance.
+ *  @return Header field size.
+ */
+uint8_t wps_mac_get_sr_arq_proto_size(void *wps_mac);
+
+/** @brief Interface to write the selective repeat ARQ acknowledgment to the header buffer for ACK frame without
+ *         dedicated auto-reply connection.
+ *
+ *  @param[in] wps_mac  MAC Layer instance.
+ *  @param[in] sr_arq   Selective repeat ARQ acknowledgment buffer pointer.
+ */
+void wps_mac_send_sr_arq_header_acknowledge(void *wps_mac, uint8_t *sr_arq);
+
+/** @brief Interface to read the selective repeat ARQ acknowledgment from the header buffer for ACK frame without
+ *         dedicated auto-reply connection.
+ *
+ *  @param[in] wps_mac  MAC Layer instance.
+ *  @param[in] sr_arq   Selective repeat ARQ acknowledgment buffer pointer.
+ */
+void wps_mac_receive_sr_arq_header_acknowledge(void *wps_mac, uint8_t *sr_arq);
+
+/** @brief Get the size of the selective repeat ARQ acknowledgment header field.
+ *
+ *  @param[in] wps_mac MAC Layer instance.
+ *  @return Header field size.
+ */
+uint8_t wps_mac_get_sr_arq_ack_proto_size(void *wps_mac);
+
+/** @brief Interface to write the dynamic time slot allocation map to the header buffer.
+ *
+ *  @param[in] wps_mac  MAC Layer instance.
+ *  @param[in] map      Allocation map buffer pointer.
+ */
+void wps_mac_send_dynamic_alloc_map(void *wps_mac, uint8_t *map);
+
+/** @brief Interface to read the dynamic time slot allocation map from the header buffer.
+ *
+ *  @param[in]  wps_mac  MAC Layer instance.
+ *  @param[out] map      Allocation map buffer pointer.
+ */
+void wps_mac_receive_dynamic_alloc_map(void *wps_mac, uint8_t *map);
+
+/** @brief Get the size of the dynamic time slot allocation map header field.
+ *
+ *  @param[in] wps_mac MAC Layer instance.
+ *  @return Header field size.
+ */
+uint8_t wps_mac_get_dynamic_alloc_map_proto_size(void *wps_mac);
+
+/** @brief Interface to write the number of frames waiting in the connection queue to the header buffer.
+ *
+ *  @param[in] wps_mac      MAC Layer instance.
+ *  @param[in] queue_depth  Queue depth buffer pointer.
+ */
+void wps_mac_send_queue_depth(void *wps_mac, uint8_t *queue_depth);
+
+/** @brief Interface to read the number of frames waiting in the remote connection queue from the header buffer.
+ *
+ *  @param[in]  wps_mac      MAC Layer instance.
+ *  @param[out] queue_depth  Queue depth buffer pointer.
+ */
+void wps_mac_receive_queue_depth(void *wps_mac, uint8_t *queue_depth);
+
+/** @brief Get the size of the queue depth header field.
+ *
+ *  @param[in] wps_mac MAC Layer instance.
+ *  @return Header field size.
+ */
+uint8_t wps_mac_get_queue_depth_proto_size(void *wps_mac);
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,10 @@ static inline void wps_mac_statistics_store_process_data(wps_mac_stats_entry_t *
 #if WPS_ENABLE_LINK_STATS
 static void wps_mac_update_stats(wps_mac_t *mac);
 #endif
+#if WPS_ENABLE_LATENCY_STATS
+static uint32_t get_frame_age(wps_connection_t *connection, xlayer_frame_t *frame);
+static void latency_histogram_record(wps_latency_histogram_t *histogram, uint32_t duration);
+#endif
 
 /* PUBLIC FUNCTIONS ***********************************************************/
 #if WPS_ENABLE_STATS_USED_TIMESLOTS || WPS_ENABLE_PHY_STATS || WPS_ENABLE_PHY_STATS_PER_BANDS
@@ -182,6 +186,7 @@ void wps_mac_statistics_update_main_stats(void *wps_mac)
         mac->main_connection->wps_stats.tx_success++;
         mac->main_connection->wps_stats.tx_byte_sent += (mac->main_xlayer->frame.payload_end_it -
                                                          mac->main_xlayer->frame.payload_begin_it);
+        wps_mac_statistics_update_tx_latency(mac->main_connection, &mac->main_xlayer->frame);
 
         wps_mac_update_stats(mac);
 #if WPS_ENABLE_PHY_STATS_PER_BANDS
@@ -281,6 +286,7 @@ void wps_mac_statistics_update_auto_stats(void *wps_mac)
         mac->auto_connection->wps_stats.tx_success++;
         mac->auto_connection->wps_stats.tx_byte_sent += (mac->auto_xlayer->frame.payload_end_it -
                                                          mac->auto_xlayer->frame.payload_begin_it);
+        wps_mac_statistics_update_tx_latency(mac->auto_connection, &mac->auto_xlayer->frame);
 #if WPS_ENABLE_PHY_STATS_PER_BANDS
         mac->auto_connection->wps_chan_stats[current_channel].tx_success++;
         mac->auto_connection->wps_chan_stats[current_channel].tx_byte_sent +=
@@ -306,6 +312,41 @@ void wps_mac_statistics_update_auto_stats(void *wps_mac)
 }
 #endif /* WPS_ENABLE_LINK_STATS */
 
+#if WPS_ENABLE_LATENCY_STATS
+void wps_mac_statistics_update_tx_latency(wps_connection_t *connection, xlayer_frame_t *frame)
+{
+    wps_latency_stats_t *latency_stats = &connection->latency_stats;
+    uint16_t retry_count;
+
+    if (!latency_stats->enable) {
+        return;
+    }
+
+    latency_histogram_record(&latency_stats->ack_latency, get_frame_age(connection, frame));
+
+    /* The retry count is incremented by the stop and wait ARQ every time the frame is selected for transmission. */
+    retry_count = (frame->retry_count > 0) ? (frame->retry_count - 1) : 0;
+    if (retry_count >= WPS_RETRY_HISTOGRAM_BIN_COUNT) {
+        retry_count = WPS_RETRY_HISTOGRAM_BIN_COUNT - 1;
+    }
+    latency_stats->retry_bins[retry_count]++;
+}
+
+void wps_mac_statistics_update_tx_drop_age(wps_connection_t *connection)
+{
+    xlayer_queue_node_t *node;
+
+    if (!connection->latency_stats.enable) {
+        return;
+    }
+
+    node = xlayer_queue_get_node(&connection->xlayer_queue);
+    if (node != NULL) {
+        latency_histogram_record(&connection->latency_stats.drop_age, get_frame_age(connection, &node->xlayer.frame));
+    }
+}
+#endif /* WPS_ENABLE_LATENCY_STATS */
+
 /* PRIVATE STATE FUNCTIONS ****************************************************/
 #if WPS_ENABLE_STATS_USED_TIMESLOTS || WPS_ENABLE_PHY_STATS || WPS_ENABLE_PHY_STATS_PER_BANDS
 /** @brief Store statistics processing data to buffer.
@@ -366,3 +407,42 @@ static void wps_mac_update_stats(wps_mac_t *mac)
     }
 }
 #endif
+
+#if WPS_ENABLE_LATENCY_STATS
+/** @brief Get the time elapsed since a frame was enqueued.
+ *
+ *  @param[in] connection  WPS connection object.
+ *  @param[in] frame       Frame.
+ *  @return Frame age in connection ticks, saturated to 32 bits.
+ */
+static uint32_t get_frame_age(wps_connection_t *connection, xlayer_frame_t *frame)
+{
+    uint64_t age = connection->cfg.get_tick() - frame->time_stamp;
+
+    return (age > UINT32_MAX) ? UINT32_MAX : (uint32_t)age;
+}
+
+/** @brief Add a duration to a latency histogram.
+ *
+ *  @param[in] histogram  Histogram to update.
+ *  @param[in] duration   Duration in connection ticks.
+ */
+static void latency_histogram_record(wps_latency_histogram_t *histogram, uint32_t duration)
+{
+    uint32_t bin = 0;
+
+    if (duration != 0) {
+        bin = 32 - (uint32_t)__builtin_clz(duration);
+        if (bin >= WPS_LATENCY_HISTOGRAM_BIN_COUNT) {
+            bin = WPS_LATENCY_HISTOGRAM_BIN_COUNT - 1;
+        }
+    }
+
+    histogram->count++;
+    histogram->total += duration;
+    if (duration > histogram->max) {
+        histogram->max = duration;
+    }
+    histogram->bins[bin]++;
+}
+#endif
@@ -125,7 +125,29 @@ void wps_mac_statistics_update_main_stats(void *wps_mac);
  */
 void wps_mac_statistics_update_auto_stats(void *wps_mac);
 
+#if WPS_ENABLE_LATENCY_STATS
+/** @brief Update latency statistics for an acknowledged TX frame.
+ *
+ *  @param[in] connection  WPS connection object.
+ *  @param[in] frame       Acknowledged frame.
+ */
+void wps_mac_statistics_update_tx_latency(wps_connection_t *connection, xlayer_frame_t *frame);
+
+/** @brief Update latency statistics for the TX frame about to be dropped.
+ *
+ *  @param[in] connection  WPS connection object, its TX queue head is the dropped frame.
+ */
+void wps_mac_statistics_update_tx_drop_age(wps_connection_t *connection);
+#else
+/// \cond DO_NOT_DOCUMENT
+#define wps_mac_statistics_update_tx_latency(connection, frame)
+#define wps_mac_statistics_update_tx_drop_age(connection)
+/// \endcond
+#endif /* WPS_ENABLE_LATENCY_STATS */
+
 /** @brief Update statistics for TX packets drop for particular connection
+ *
+ *  @note The frame being dropped must still be at the head of the connection TX queue.
  *
  *  @param[in] connection  WPS connection object.
  */
@@ -133,6 +155,7 @@ static inline void wps_mac_statistics_update_tx_dropped_conn_stats(wps_connectio
 {
     connection->wps_stats.tx_drop++;
     connection->total_pkt_dropped++;
+    wps_mac_statistics_update_tx_drop_age(connection);
 }
 #else
 /// \cond DO_NOT_DOCUMENT
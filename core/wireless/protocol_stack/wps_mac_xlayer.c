@@ -34,7 +34,13 @@ xlayer_t *wps_mac_xlayer_get_xlayer_for_tx_main(wps_mac_t *wps_mac, wps_connecti
     uint8_t *header_memory = overrun_buffer + XLAYER_QUEUE_SPI_COMM_ADDITIONAL_BYTES;
 
     if (connection->currently_enabled && valid_credits) {
-        node = xlayer_queue_get_node(&connection->xlayer_queue);
+        if (connection->stop_and_wait_arq.enable && link_sr_arq_is_enabled(&connection->selective_repeat_arq)) {
+            /* Selective repeat sends any frame of the window, not only the oldest one. */
+            node = xlayer_queue_get_node_at(&connection->xlayer_queue,
+                                            link_sr_arq_get_tx_offset(&connection->selective_repeat_arq));
+        } else {
+            node = xlayer_queue_get_node(&connection->xlayer_queue);
+        }
         /* Check if there is something available to send on the COORDINATOR after connect event*/
         if (connection->send_sync_frame && node != NULL && wps_mac->node_role == NETWORK_COORDINATOR) {
             /* Prepare sync frame */
@@ -417,6 +417,13 @@ void wps_stats_reset(wps_connection_t *connection)
 #endif
 
     link_saw_arq_reset_stats(&connection->stop_and_wait_arq);
+    link_sr_arq_reset_stats(&connection->selective_repeat_arq);
+
+#if WPS_ENABLE_LATENCY_STATS
+    memset(&connection->latency_stats.ack_latency, 0, sizeof(wps_latency_histogram_t));
+    memset(&connection->latency_stats.drop_age, 0, sizeof(wps_latency_histogram_t));
+    memset(connection->latency_stats.retry_bins, 0, sizeof(connection->latency_stats.retry_bins));
+#endif
 
 #if WPS_ENABLE_PHY_STATS_PER_BANDS
     for (size_t i = 0; i < connection->max_channel_count; i++) {
@@ -425,3 +432,14 @@ void wps_stats_reset(wps_connection_t *connection)
     }
 #endif
 }
+
+#if WPS_ENABLE_LATENCY_STATS
+uint32_t wps_stats_get_latency_bin_upper_bound(uint8_t bin)
+{
+    if ((bin + 1) >= WPS_LATENCY_HISTOGRAM_BIN_COUNT) {
+        return UINT32_MAX;
+    }
+
+    return ((uint32_t)1 << bin) - 1;
+}
+#endif /* WPS_ENABLE_LATENCY_STATS */
@@ -595,6 +595,37 @@ float wps_stats_get_per(wps_connection_t *connection);
  */
 void wps_stats_reset(wps_connection_t *connection);
 
+#if WPS_ENABLE_LATENCY_STATS
+/** @brief Enable or disable the recording of the latency statistics.
+ *
+ *  @param[in] connection  WPS connection object.
+ *  @param[in] enable      Whether the latency statistics are recorded.
+ */
+static inline void wps_stats_set_latency_enable(wps_connection_t *connection, bool enable)
+{
+    connection->latency_stats.enable = enable;
+}
+
+/** @brief Get the latency statistics.
+ *
+ *  Durations are expressed in ticks of the connection get_tick() function.
+ *
+ *  @param[in] connection  WPS connection object.
+ *  @return Reference to the latency statistics.
+ */
+static inline const wps_latency_stats_t *wps_stats_get_latency_stats(wps_connection_t *connection)
+{
+    return &connection->latency_stats;
+}
+
+/** @brief Get the largest duration counted in a latency histogram bin.
+ *
+ *  @param[in] bin  Bin index.
+ *  @return Largest duration in ticks, UINT32_MAX for the last bin since it has no upper bound.
+ */
+uint32_t wps_stats_get_latency_bin_upper_bound(uint8_t bin);
+#endif /* WPS_ENABLE_LATENCY_STATS */
+
 #if WPS_ENABLE_PHY_STATS_PER_BANDS
 /** @brief Get average RSSI of frames with payload.
  *
@@ -11,6 +11,7 @@
 
 /* INCLUDES *******************************************************************/
 #include <stdint.h>
+#include "mem_pool.h"
 #include "swc_def.h"
 #include "swc_error.h"
 #include "wps.h"
@@ -191,6 +192,36 @@ typedef struct swc_qos_indicators {
     uint32_t phase_offset_data[PHASE_OFFSET_BYTE_COUNT];
 } swc_qos_indicators_t;
 
+#if WPS_ENABLE_LATENCY_STATS
+/** @brief Wireless latency histogram.
+ *
+ *  Bins are logarithmic, bin n counts the durations up to bin_upper_bound_us[n] not counted in the previous bins.
+ */
+typedef struct swc_latency_histogram {
+    /*! Number of durations recorded. */
+    uint32_t count;
+    /*! Average duration, in microseconds. */
+    uint32_t avg_us;
+    /*! Longest duration recorded, in microseconds. */
+    uint32_t max_us;
+    /*! Number of durations recorded in each bin. */
+    uint32_t bins[WPS_LATENCY_HISTOGRAM_BIN_COUNT];
+} swc_latency_histogram_t;
+
+/** @brief Wireless latency statistics.
+ */
+typedef struct swc_latency_statistics {
+    /*! Largest duration counted in each latency histogram bin, in microseconds. UINT32_MAX for the last bin. */
+    uint32_t bin_upper_bound_us[WPS_LATENCY_HISTOGRAM_BIN_COUNT];
+    /*! Time from the packet enqueue by swc_connection_send() to its acknowledge. */
+    swc_latency_histogram_t ack_latency;
+    /*! Time from the packet enqueue by swc_connection_send() to its drop by the timeout mechanism. */
+    swc_latency_histogram_t drop_age;
+    /*! Number of acknowledged packets per retry count, the last bin counts all the higher retry counts. */
+    uint32_t retry_count[WPS_RETRY_HISTOGRAM_BIN_COUNT];
+} swc_latency_statistics_t;
+#endif
+
 /** @brief Identifies each radio unit by a unique ID.
  *
  *  Each enum value corresponds to a specific radio HAL structure index, simplifying
@@ -206,6 +237,12 @@ typedef enum swc_radio_id {
     SWC_RADIO_ID_MAX = 2,
 } swc_radio_id_t;
 
+/** @brief Payload segment, part of a payload gathered from several buffers.
+ *
+ *  The structure members are payload, a pointer to the segment data, and size, the segment size in bytes.
+ */
+typedef wps_payload_segment_t swc_payload_segment_t;
+
 /** @brief Wireless connection configuration.
  */
 typedef struct swc_connection_cfg {
@@ -378,6 +415,26 @@ void swc_set_certification_mode(bool enabled, swc_error_t *const err);
  */
 void swc_set_fast_sync(bool enabled, swc_error_t *const err);
 
+/** @brief Share time slots between the nodes of a star network with a demand-driven allocation.
+ *
+ *  The dynamic time slots are shared by the connections from the nodes to the coordinator that list them and that
+ *  are configured with swc_connection_set_dynamic_allocation(). Nodes report the number of frames waiting in their
+ *  queue in every frame they send. At the start of every schedule, the coordinator grants the dynamic time slots, one
+ *  at a time, to the nodes with the most pending frames and sends this allocation in the header of its frames. A node
+ *  only transmits in the dynamic time slots granted to it during the current schedule and sleeps in the others.
+ *
+ *  @note This must be called with the same time slots on the coordinator and on every node, after swc_init() and
+ *        before swc_connection_set_dynamic_allocation().
+ *
+ *  @note Every device must keep time slots that are not dynamic: the nodes report their queue in them when they are
+ *        granted no dynamic time slot. Frames from the coordinator should be scheduled before the dynamic time slots.
+ *
+ *  @param[in]  timeslot_id     Array of main time slot IDs to share, up to LINK_DYNAMIC_ALLOC_MAX_TIMESLOT_COUNT.
+ *  @param[in]  timeslot_count  Number of time slots to share.
+ *  @param[out] err             Wireless Core error code.
+ */
+void swc_set_dynamic_allocation(const int32_t *const timeslot_id, uint8_t timeslot_count, swc_error_t *const err);
+
 /** @brief Advance configuration for concurrency mechanism.
  *
  *  @note By default, random channel sequence and DDCM are enabled, while RDO is disabled.
@@ -739,6 +796,83 @@ void swc_connection_optimized_latency(const swc_connection_t *const conn, uint8_
  *  @param[out] err   Wireless Core error code.
  */
 void swc_connection_set_fragmentation(const swc_connection_t *const conn, swc_error_t *const err);
+
+/** @brief Enable resumable fragmentation on the target connection.
+ *
+ *  Fragments lost on the connection are reported by the receiver on the feedback connection and only those are sent
+ *  again, instead of the whole payload. The payload is kept by the transmitter until the receiver acknowledges it,
+ *  so swc_connection_send() returns SWC_WARN_SEND_QUEUE_FULL until then and the TX success callback is raised once
+ *  per acknowledged payload. The payload may be larger than the connection queue.
+ *
+ *  @note This needs to be implemented on both sides of the connection with the same maximum payload size, after
+ *        swc_connection_set_fragmentation() has been called on both connections.
+ *
+ *  @note The feedback connection goes in the opposite direction and may carry application payloads as well.
+ *
+ *  @param[in]  conn              Connection handle.
+ *  @param[in]  feedback_conn     Connection handle carrying the reception reports.
+ *  @param[in]  max_payload_size  Largest payload size sent on the connection, in bytes.
+ *  @param[out] err               Wireless Core error code.
+ */
+void swc_connection_set_fragmentation_resume(const swc_connection_t *const conn,
+                                             const swc_connection_t *const feedback_conn, uint16_t max_payload_size,
+                                             swc_error_t *const err);
+
+/** @brief Poll the receiver of the resumable fragmentation payload in progress.
+ *
+ *  Call it when the payload is not acknowledged within the application timeout, a lost last fragment or a lost
+ *  reception report otherwise stalls the transfer.
+ *
+ *  @param[in]  conn  Connection handle.
+ *  @param[out] err   Wireless Core error code.
+ */
+void swc_connection_poll_fragmentation(const swc_connection_t *const conn, swc_error_t *const err);
+
+/** @brief Give up the resumable fragmentation payload in progress.
+ *
+ *  @param[in]  conn  Connection handle.
+ *  @param[out] err   Wireless Core error code.
+ */
+void swc_connection_abort_fragmentation(const swc_connection_t *const conn, swc_error_t *const err);
+#endif
+
+#if !WPS_DISABLE_AGGREGATION
+/** @brief Enable small payload aggregation on the target connection.
+ *
+ *  Payloads sent with swc_connection_send() are packed in the same frame, each one prefixed with its size, until the
+ *  frame reaches the maximum payload size of the connection. The receiver unpacks the frame and reads the payloads
+ *  one by one with the usual receive functions. A payload is held until the frame is full, until
+ *  swc_connection_flush_aggregation() is called, or until no other frame waits in the connection queue and the payload
+ *  has been held for max_hold_time_ms.
+ *
+ *  @note This needs to be implemented on both sides of the connection. It can't be used with fragmentation.
+ *
+ *  @note The TX success callback is raised once per transmitted frame and the RX success callback once per received
+ *        payload. Payloads are limited to 255 bytes.
+ *
+ *  @param[in]  conn              Connection handle.
+ *  @param[in]  max_hold_time_ms  Time a payload may be held once the connection queue is empty, in milliseconds.
+ *  @param[out] err               Wireless Core error code.
+ */
+void swc_connection_set_aggregation(const swc_connection_t *const conn, uint32_t max_hold_time_ms,
+                                    swc_error_t *const err);
+
+/** @brief Send the frame being filled by the aggregation without waiting for more payloads.
+ *
+ *  @param[in]  conn  Connection handle.
+ *  @param[out] err   Wireless Core error code.
+ */
+void swc_connection_flush_aggregation(const swc_connection_t *const conn, swc_error_t *const err);
+
+/** @brief Send the frame being filled by the aggregation if its hold time has elapsed.
+ *
+ *  Call it periodically when the hold time is not 0, so that a payload sent while the connection is idle does not
+ *  wait for the next one.
+ *
+ *  @param[in]  conn  Connection handle.
+ *  @param[out] err   Wireless Core error code.
+ */
+void swc_connection_process_aggregation(const swc_connection_t *const conn, swc_error_t *const err);
 #endif
 
 /** @brief Enable/disable ACK exchange on target connection.
@@ -774,6 +908,19 @@ void swc_connection_set_acknowledgement(const swc_connection_t *const conn, bool
  */
 void swc_connection_set_credit_flow_ctrl(const swc_connection_t *const conn, bool enabled, swc_error_t *const err);
 
+/** @brief Enable the dynamic time slot allocation on the target connection.
+ *
+ *  A connection from the coordinator carries the allocation in its frame headers. A connection to the coordinator
+ *  carries the number of frames waiting in its queue, and is granted the dynamic time slots it lists by the
+ *  coordinator.
+ *
+ *  @note This must be called on both sides of the connection, after swc_set_dynamic_allocation().
+ *
+ *  @param[in]  conn  Connection handle.
+ *  @param[out] err   Wireless Core error code.
+ */
+void swc_connection_set_dynamic_allocation(const swc_connection_t *const conn, swc_error_t *const err);
+
 /** @brief Enable retransmission of frame with or without condition to drop the frame.
  *
  *  @note Setting `try_deadline` and `time_deadline` to 0 will result in a Guaranteed delivery transmission mode.
@@ -794,6 +941,27 @@ void swc_connection_set_credit_flow_ctrl(const swc_connection_t *const conn, boo
 void swc_connection_set_retransmission(const swc_connection_t *const conn, bool enabled, uint32_t try_deadline,
                                        uint32_t time_deadline, swc_error_t *const err);
 
+/** @brief Set the number of frames that can be in flight at once on target connection.
+ *
+ *  With a window larger than 1, the connection uses selective repeat: a frame that is not acknowledged is
+ *  retransmitted later without blocking the following ones and the receiver reorders the frames before
+ *  delivering them. The deadlines set with `swc_connection_set_retransmission` still apply.
+ *
+ *  @note This function must be called after swc_connection_set_retransmission.
+ *
+ *  @note By default, the window is 1, which is the stop and wait mode. The same window must be set on
+ *        both ends of the connection.
+ *
+ *  @note The acknowledgment bitmap is carried in the ACK frame, it is not available when the timeslot
+ *        has an auto-reply connection. Lost ACKs then lead to retransmissions dropped as duplicates.
+ *
+ *  @param[in]  conn         Connection handle.
+ *  @param[in]  window_size  Number of frames in flight, from 1 to LINK_SR_ARQ_WINDOW_SIZE_MAX.
+ *  @param[out] err          Wireless Core error code.
+ */
+void swc_connection_set_retransmission_window(const swc_connection_t *const conn, uint8_t window_size,
+                                              swc_error_t *const err);
+
 /** @brief Return the event notified by the event callback.
  *
  *  @param[in] conn  Connection handle.
@@ -907,6 +1075,37 @@ void swc_connection_set_connection_slots_priority(swc_connection_t *const conn,
 void swc_connection_set_concurrency_cfg(const swc_connection_t *const conn,
                                         const swc_connection_concurrency_cfg_t *const cfg, swc_error_t *const err);
 
+/** @brief Enable or disable the adaptive CCA backoff on target connection.
+ *
+ *  The connection learns how busy every channel of the hopping sequence is from its CCA tries. In dense
+ *  environments, the CCA retry time is then drawn at random in a window that grows with the channel busy level,
+ *  instead of being fixed, and the try count is halved on persistently busy channels when the fail action is
+ *  SWC_CCA_ABORT_TX so that the frame is retried on the next channel instead.
+ *
+ *  @note The concurrency mechanism must be enabled with swc_connection_set_concurrency_cfg before this call.
+ *
+ *  @note The retry time is only randomized on nodes, the coordinator keeps the configured one. The configured retry
+ *        time and try count are upper bounds, the receiver configuration does not change.
+ *
+ *  @note By default, the adaptive CCA backoff is disabled.
+ *
+ *  @param[in]  conn     Connection handle.
+ *  @param[in]  enabled  Enable or disable the adaptive CCA backoff.
+ *  @param[out] err      Wireless Core error code.
+ */
+void swc_connection_set_adaptive_cca(const swc_connection_t *const conn, bool enabled, swc_error_t *const err);
+
+/** @brief Get the busy ratio of a channel learned by the adaptive CCA backoff.
+ *
+ *  @param[in]  conn           Connection handle.
+ *  @param[in]  channel_index  Channel index in the channel sequence.
+ *  @param[out] err            Wireless Core error code.
+ *  @return Moving average of the ratio of failed CCA tries on the channel, in percent, 0 when the adaptive CCA
+ *          backoff is disabled.
+ */
+uint8_t swc_connection_get_channel_busy_ratio(const swc_connection_t *const conn, uint8_t channel_index,
+                                              swc_error_t *const err);
+
 /** @brief Set the connection's fallback configuration.
  *
  *  @note By default, fallback is disabled.
@@ -984,6 +1183,21 @@ void swc_connection_allocate_payload_buffer(const swc_connection_t *const conn,
 void swc_connection_send(const swc_connection_t *const conn, const uint8_t *const payload_buffer, uint16_t size,
                          swc_error_t *const err);
 
+/** @brief Enqueue a payload gathered from several segments in the connection transmission queue.
+ *
+ *  The segments are copied directly in the transmission queue, or in the fragments when fragmentation is enabled,
+ *  so a message made of a header and a body does not need to be assembled in an intermediate buffer first. A single
+ *  segment is referenced without copy, like with swc_connection_send(). A segment with a NULL payload is rejected
+ *  with SWC_ERR_NULL_PTR unless it is empty and not the only segment.
+ *
+ *  @param[in]  conn           Connection handle.
+ *  @param[in]  segments       Payload segments to transmit, in order.
+ *  @param[in]  segment_count  Number of segments.
+ *  @param[out] err            Wireless Core error code.
+ */
+void swc_connection_sendv(const swc_connection_t *const conn, const swc_payload_segment_t *const segments,
+                          uint8_t segment_count, swc_error_t *const err);
+
 /** @brief Retrieve a payload buffer from the connection reception queue.
  *
  *  @param[in]  conn            Connection handle.
@@ -1102,6 +1316,15 @@ swc_fallback_info_t swc_connection_get_fallback_info(const swc_connection_t *con
  */
 uint32_t swc_get_allocated_bytes(void);
 
+/** @brief Get the usage statistics of the memory pool.
+ *
+ *  @note The high-water mark is kept across swc_free_memory(), it gives the memory pool size needed by the
+ *        application across its reconfigurations.
+ *
+ *  @param[out] stats  Memory pool usage statistics.
+ */
+void swc_get_memory_pool_stats(mem_pool_stats_t *const stats);
+
 /** @brief Free the memory to reconfigure the wireless core.
  */
 void swc_free_memory(void);
@@ -222,6 +222,16 @@ typedef enum swc_error {
     SWC_ERR_INVALID_OPERATION_SLOT_PRIO_ENABLED = SWC_GENERATE_ERR_CODE,
     /*! User tried to call an RX connection function on a TX connection. */
     SWC_ERR_RX_CONN_ACTION_ON_TX_CONN = SWC_GENERATE_ERR_CODE,
+    /*! Retransmission window size is out of range. */
+    SWC_ERR_ARQ_WINDOW_SIZE = SWC_GENERATE_ERR_CODE,
+    /*! The function call is not supported when the SDU aggregation is enabled on the connection.
+     *  swc_connection_send() should be used instead.
+     */
+    SWC_ERR_AGGREGATION_NOT_SUPPORTED = SWC_GENERATE_ERR_CODE,
+    /*! Dynamic time slot allocation is not configured, or its time slots or node count are out of range. */
+    SWC_ERR_DYNAMIC_ALLOCATION = SWC_GENERATE_ERR_CODE,
+    /*! The feature needs the connection to use at least one main timeslot. */
+    SWC_ERR_NO_MAIN_TIMESLOT = SWC_GENERATE_ERR_CODE,
 } swc_error_t;
 
 /* PUBLIC FUNCTION PROTOTYPES *************************************************/
@@ -0,0 +1,173 @@
+/** @file  swc_footprint.h
+ *  @brief SPARK Wireless Core memory pool footprint.
+ *
+ *  Constant expressions giving the number of memory pool bytes the SWC allocates for a given configuration, so that
+ *  the pool given to swc_init() can be sized at compile time and checked against the configuration:
+ *
+ *      #define POOL_NEEDED (SWC_FOOTPRINT_NODE(TIMESLOT_COUNT, CHANNEL_SEQ_LEN) + SWC_FOOTPRINT_RADIO(false) +      \
+ *                           SWC_FOOTPRINT_CONNECTION(5, 2, CHANNEL_COUNT, 1) +                                    \
+ *                           SWC_FOOTPRINT_TX_DATA(QUEUE_SIZE, SWC_FOOTPRINT_MAX_HEADER_SIZE(PAYLOAD), PAYLOAD) + \
+ *                           ...)
+ *      static uint8_t swc_memory_pool[SWC_FOOTPRINT_POOL_SIZE(POOL_NEEDED)];
+ *      SWC_FOOTPRINT_CHECK(sizeof(swc_memory_pool), POOL_NEEDED);
+ *
+ *  The expressions are evaluated by the target compiler, they therefore match the target structure layouts. The
+ *  connection header size is only known once the connection features are set, SWC_FOOTPRINT_MAX_HEADER_SIZE() gives
+ *  its upper bound. The actual usage can be read at run time with swc_get_memory_pool_stats().
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef SWC_FOOTPRINT_H_
+#define SWC_FOOTPRINT_H_
+
+/* INCLUDES *******************************************************************/
+#include "mem_pool.h"
+#include "spsc_queue.h"
+#include "swc_api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Default callback queue size margin. */
+#ifndef WPS_QUEUE_MARGIN
+#define WPS_QUEUE_MARGIN 5
+#endif
+
+/*! Number of entries of the WPS request queues. */
+#ifndef WPS_DEFAULT_REQUEST_MEMORY_SIZE
+#define WPS_DEFAULT_REQUEST_MEMORY_SIZE 5
+#endif
+
+/*! The radio's maximum payload size is 256, one byte must be reserved for the header size. */
+#define SWC_FRAME_SIZE_MAX 255
+
+/*! Pool bytes taken by an array of count elements of a type. */
+#define SWC_FOOTPRINT_ARRAY(type, count) MEM_POOL_BLOCK_SIZE(sizeof(type) * (count))
+
+/*! Pool size holding the given SWC footprint. */
+#define SWC_FOOTPRINT_POOL_SIZE(footprint) MEM_POOL_SIZE_NEEDED(footprint)
+
+/*! Fail the build if a pool of pool_size bytes does not hold the given SWC footprint. */
+#define SWC_FOOTPRINT_CHECK(pool_size, footprint) \
+    _Static_assert((pool_size) >= SWC_FOOTPRINT_POOL_SIZE(footprint), "SWC memory pool is too small")
+
+/*! Upper bound of the connection header size, held by the radio header FIFO and by the frame with the payload and
+ *  its size byte.
+ */
+#define SWC_FOOTPRINT_MAX_HEADER_SIZE(max_payload_size)                                           \
+    (((SWC_FRAME_SIZE_MAX - (max_payload_size) - WPS_PAYLOAD_SIZE_BYTE_SIZE) < MAX_HEADER_SIZE) ? \
+         (SWC_FRAME_SIZE_MAX - (max_payload_size) - WPS_PAYLOAD_SIZE_BYTE_SIZE) :                 \
+         MAX_HEADER_SIZE)
+
+/*! Footprint of swc_init(), for the timeslot and channel sequence lengths of the swc_cfg_t. */
+#define SWC_FOOTPRINT_NODE(timeslot_sequence_length, channel_sequence_length)               \
+    (SWC_FOOTPRINT_ARRAY(wps_schedule_ratio_cfg_t, WPS_DEFAULT_REQUEST_MEMORY_SIZE) +        \
+     SWC_FOOTPRINT_ARRAY(xlayer_write_request_info_t, WPS_DEFAULT_REQUEST_MEMORY_SIZE) +     \
+     SWC_FOOTPRINT_ARRAY(xlayer_read_request_info_t, WPS_DEFAULT_REQUEST_MEMORY_SIZE) +      \
+     SWC_FOOTPRINT_ARRAY(timeslot_t, timeslot_sequence_length) +                             \
+     SWC_FOOTPRINT_ARRAY(xlayer_request_info_t, WPS_DEFAULT_REQUEST_MEMORY_SIZE) +           \
+     SWC_FOOTPRINT_ARRAY(uint8_t, channel_sequence_length) +                                 \
+     SWC_FOOTPRINT_ARRAY(uint32_t, channel_sequence_length) + SWC_FOOTPRINT_ARRAY(wps_radio_t, WPS_RADIO_COUNT))
+
+/*! Footprint of swc_radio_module_init(), per radio. */
+#define SWC_FOOTPRINT_RADIO(dynamic_phy_mode_enabled) \
+    (SWC_FOOTPRINT_ARRAY(nvm_t, 1) + SWC_FOOTPRINT_ARRAY(calib_vars_t, (dynamic_phy_mode_enabled) ? 2 : 1))
+
+#if WPS_ENABLE_PHY_STATS_PER_BANDS
+/*! Footprint of the per channel statistics of a connection. */
+#define SWC_FOOTPRINT_STATS_PER_BANDS(channel_count)                                              \
+    (SWC_FOOTPRINT_ARRAY(lqi_t, channel_count) + SWC_FOOTPRINT_ARRAY(wps_stats_t, channel_count) + \
+     SWC_FOOTPRINT_ARRAY(swc_statistics_t, channel_count) + SWC_FOOTPRINT_ARRAY(swc_qos_indicators_t, channel_count))
+#else
+#define SWC_FOOTPRINT_STATS_PER_BANDS(channel_count) 0
+#endif
+
+/** @brief Footprint of swc_connection_init().
+ *
+ *  @param[in] name_length          Length of the connection name, without the terminating null character.
+ *  @param[in] timeslot_count       Number of timeslots of the connection.
+ *  @param[in] channel_count        Number of channels of the channel sequence.
+ *  @param[in] channel_table_count  0 for a connection on auto-reply timeslots only, 2 for a connection on main
+ *                                  timeslots with the dynamic PHY mode, 1 otherwise.
+ */
+#define SWC_FOOTPRINT_CONNECTION(name_length, timeslot_count, channel_count, channel_table_count)                    \
+    (SWC_FOOTPRINT_ARRAY(swc_connection_t, 1) + SWC_FOOTPRINT_ARRAY(wps_connection_t, 1) +                          \
+     SWC_FOOTPRINT_ARRAY(char, (name_length) + 1) + SWC_FOOTPRINT_ARRAY(int32_t, timeslot_count) +                  \
+     SWC_FOOTPRINT_ARRAY(gain_loop_t[WPS_RADIO_COUNT], channel_count) +                                              \
+     (channel_table_count) * SWC_FOOTPRINT_ARRAY(rf_channel_t[WPS_RADIO_COUNT], channel_count) +                     \
+     SWC_FOOTPRINT_STATS_PER_BANDS(channel_count))
+
+/*! Footprint of the TX data buffer of a TX main or auto-reply connection, allocated by swc_setup(). */
+#define SWC_FOOTPRINT_TX_DATA(queue_size, header_size, max_payload_size) \
+    (SWC_FOOTPRINT_ARRAY(xlayer_circular_data_t, 1) +                    \
+     MEM_POOL_BLOCK_SIZE(XLAYER_CIRCULAR_DATA_TX_REQUIRED_BYTES(queue_size, header_size, max_payload_size)))
+
+/*! Footprint of the RX data buffer of a RX main or auto-reply connection, allocated by swc_setup(). */
+#define SWC_FOOTPRINT_RX_DATA(queue_size, max_payload_size) \
+    (SWC_FOOTPRINT_ARRAY(xlayer_circular_data_t, 1) +       \
+     MEM_POOL_BLOCK_SIZE(XLAYER_CIRCULAR_DATA_RX_REQUIRED_BYTES(queue_size, max_payload_size)))
+
+/** @brief Footprint of the shared xlayer queues, allocated by swc_setup().
+ *
+ *  @param[in] tx_queues_size   Sum of the queue sizes of the TX connections.
+ *  @param[in] rx_queues_size   Sum of the queue sizes of the RX connections.
+ *  @param[in] max_header_size  Largest header size of the main connections.
+ */
+#define SWC_FOOTPRINT_XLAYER_QUEUES(tx_queues_size, rx_queues_size, max_header_size) \
+    (MEM_POOL_BLOCK_SIZE(XLAYER_QUEUE_TX_REQUIRED_BYTES(tx_queues_size)) +          \
+     MEM_POOL_BLOCK_SIZE(XLAYER_QUEUE_RX_REQUIRED_BYTES(rx_queues_size, (max_header_size) + EMPTY_BYTE)))
+
+/** @brief Footprint of the callback queue, allocated by swc_setup().
+ *
+ *  @param[in] callback_count  Sum over the connections of the queue size times the number of registered callbacks
+ *                             among TX success or fail, RX success, TX drop and ranging data ready, plus one per
+ *                             connection with an event callback.
+ */
+#define SWC_FOOTPRINT_CALLBACK_QUEUE(callback_count) \
+    SWC_FOOTPRINT_ARRAY(wps_callback_inst_t, SPSC_QUEUE_ROUND_CAPACITY((callback_count) + WPS_QUEUE_MARGIN))
+
+/*! Footprint of swc_connection_set_fragmentation(). */
+#define SWC_FOOTPRINT_FRAGMENTATION(queue_size) SWC_FOOTPRINT_ARRAY(uint16_t, queue_size)
+
+/*! Footprint of swc_connection_set_fragmentation_resume(). */
+#define SWC_FOOTPRINT_FRAGMENTATION_RESUME(max_payload_size) SWC_FOOTPRINT_ARRAY(uint8_t, max_payload_size)
+
+/*! Footprint of the auto-reply link protocol, allocated once by swc_connection_set_credit_flow_ctrl() or
+ *  swc_connection_set_retransmission_window().
+ */
+#define SWC_FOOTPRINT_ACK_PROTOCOL SWC_FOOTPRINT_ARRAY(link_protocol_t, 1)
+
+/*! Footprint of the reorder buffer of swc_connection_set_retransmission_window(). */
+#define SWC_FOOTPRINT_SR_ARQ(window_size, max_payload_size) \
+    SWC_FOOTPRINT_ARRAY(uint8_t, (window_size) * (max_payload_size))
+
+/*! Footprint of swc_connection_set_throttling(). */
+#define SWC_FOOTPRINT_THROTTLING SWC_FOOTPRINT_ARRAY(bool, WPS_PATTERN_THROTTLE_GRANULARITY)
+
+/*! Footprint of swc_connection_set_adaptive_cca(). */
+#define SWC_FOOTPRINT_ADAPTIVE_CCA(channel_count) SWC_FOOTPRINT_ARRAY(link_cca_adaptive_channel_t, channel_count)
+
+/** @brief Footprint of swc_connection_set_fallback_cfg().
+ *
+ *  @param[in] fallback_mode_count  Number of fallback modes.
+ *  @param[in] cca_enabled          The fallback CCA try counts are set.
+ *  @param[in] channel_count        Number of channels of the channel sequence.
+ *  @param[in] channel_table_count  0 for a RX connection, 2 for a TX connection with the dynamic PHY mode, 1 otherwise.
+ */
+#define SWC_FOOTPRINT_FALLBACK(fallback_mode_count, cca_enabled, channel_count, channel_table_count)         \
+    (((cca_enabled) ? SWC_FOOTPRINT_ARRAY(uint8_t, fallback_mode_count) : 0) +                               \
+     SWC_FOOTPRINT_ARRAY(uint8_t, fallback_mode_count) +                                                     \
+     (channel_table_count) *                                                                                 \
+         (SWC_FOOTPRINT_ARRAY(rf_channel_t(*)[WPS_RADIO_COUNT], fallback_mode_count) +                       \
+          (fallback_mode_count) * SWC_FOOTPRINT_ARRAY(rf_channel_t[WPS_RADIO_COUNT], channel_count)))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SWC_FOOTPRINT_H_ */
@@ -11,11 +11,18 @@
 
 /* INCLUDES *******************************************************************/
 #include "swc_api.h"
+#include "telemetry.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* CONSTANTS ******************************************************************/
+/*! Version of the TELEMETRY_RECORD_SWC_CONNECTION_STATS record. */
+#define SWC_TELEMETRY_CONNECTION_STATS_VERSION 1
+/*! Version of the TELEMETRY_RECORD_SWC_CONNECTION_LATENCY record. */
+#define SWC_TELEMETRY_CONNECTION_LATENCY_VERSION 1
+
 /* PUBLIC FUNCTION PROTOTYPES *************************************************/
 /** @brief Update connection statistics.
  *
@@ -31,6 +38,8 @@ extern "C" {
 swc_statistics_t *swc_connection_update_stats(swc_connection_t *const conn, swc_error_t *err);
 
 /** @brief Format the connection statistics as a string of characters.
+ *
+ *  @note When the latency statistics are enabled on a TX connection, their histograms are appended.
  *
  *  @param[in]  conn    Connection handle.
  *  @param[out] buffer  Buffer where to put the formatted string.
@@ -41,6 +50,21 @@ swc_statistics_t *swc_connection_update_stats(swc_connection_t *const conn, swc_
 int swc_connection_format_stats(const swc_connection_t *const conn, char *const buffer,
                                 uint16_t size, swc_error_t *err);
 
+/** @brief Add the connection statistics to a telemetry frame.
+ *
+ *  The statistics last computed by swc_connection_update_stats() are added as a TELEMETRY_RECORD_SWC_CONNECTION_STATS
+ *  record holding every swc_statistics_t field in declaration order, except tick_on_reset. When the latency
+ *  statistics are enabled on the connection, a TELEMETRY_RECORD_SWC_CONNECTION_LATENCY record is added with the bin
+ *  counts, the bin upper bounds and the swc_latency_statistics_t histograms.
+ *
+ *  @param[in]  conn       Connection handle.
+ *  @param[in]  telemetry  Telemetry instance, with a frame started.
+ *  @param[in]  instance   Record instance, identifies the connection in the telemetry stream.
+ *  @param[out] err        Wireless Core error code.
+ */
+void swc_connection_add_stats_telemetry(const swc_connection_t *const conn, telemetry_t *telemetry, uint8_t instance,
+                                        swc_error_t *err);
+
 #if WPS_ENABLE_PHY_STATS_PER_BANDS
 /** @brief Update connection statistics on a per channel basis.
  *
@@ -69,6 +93,30 @@ swc_statistics_t *swc_connection_update_stats_per_channel(swc_connection_t *cons
 swc_qos_indicators_t *swc_connection_update_qos_per_channel(swc_connection_t *const conn, const uint8_t channel_number);
 #endif
 
+#if WPS_ENABLE_LATENCY_STATS
+/** @brief Enable or disable the latency statistics of a connection.
+ *
+ *  When enabled, the time from the enqueue of every packet to its acknowledge or to its drop is recorded in a
+ *  histogram, along with the number of retries of every acknowledged packet.
+ *
+ *  @param[in]  conn     Connection handle.
+ *  @param[in]  enabled  Whether the latency statistics are recorded.
+ *  @param[out] err      Wireless Core error code.
+ */
+void swc_connection_set_latency_stats(const swc_connection_t *const conn, bool enabled, swc_error_t *err);
+
+/** @brief Get the connection latency statistics.
+ *
+ *  @note The resolution of the durations is the period of the free running timer.
+ *
+ *  @param[in]  conn   Connection handle.
+ *  @param[out] stats  Latency statistics.
+ *  @param[out] err    Wireless Core error code.
+ */
+void swc_connection_get_latency_stats(const swc_connection_t *const conn, swc_latency_statistics_t *const stats,
+                                      swc_error_t *err);
+#endif
+
 /** @brief Reset all the connection statistics.
  *
  *  @param[in]  conn  Connection handle.
@@ -33,6 +33,13 @@ extern "C" {
  */
 #define XLAYER_QUEUE_SPI_COMM_HEADER_SIZE_POSITION_OFFSET 1
 
+/*! Number of bytes required by the TX circular data, see xlayer_circular_data_get_tx_required_bytes(). */
+#define XLAYER_CIRCULAR_DATA_TX_REQUIRED_BYTES(queue_size, header_size, max_payload_size) \
+    ((queue_size) * (XLAYER_QUEUE_SPI_COMM_ADDITIONAL_BYTES + (header_size) + (max_payload_size)))
+
+/*! Number of bytes required by the RX circular data, see xlayer_circular_data_get_rx_required_bytes(). */
+#define XLAYER_CIRCULAR_DATA_RX_REQUIRED_BYTES(queue_size, max_payload_size) ((queue_size) * (max_payload_size))
+
 /* TYPES **********************************************************************/
 /** @brief Circular data container
  */
@@ -124,7 +131,7 @@ static inline uint16_t xlayer_circular_data_get_last_head(xlayer_circular_data_t
 static inline uint16_t xlayer_circular_data_get_tx_required_bytes(uint16_t queue_size, uint8_t header_size,
                                                                   uint16_t max_payload_size)
 {
-    return (queue_size * (XLAYER_QUEUE_SPI_COMM_ADDITIONAL_BYTES + (uint16_t)header_size + max_payload_size));
+    return XLAYER_CIRCULAR_DATA_TX_REQUIRED_BYTES(queue_size, (uint16_t)header_size, max_payload_size);
 }
 
 /** @brief A function that calculates the required space for a RX payload in the cyclic data buffer
@@ -135,7 +142,7 @@ static inline uint16_t xlayer_circular_data_get_tx_required_bytes(uint16_t queue
  */
 static inline uint16_t xlayer_circular_data_get_rx_required_bytes(uint16_t queue_size, uint16_t max_payload_size)
 {
-    return (queue_size * max_payload_size);
+    return XLAYER_CIRCULAR_DATA_RX_REQUIRED_BYTES(queue_size, max_payload_size);
 }
 
 #ifdef __cplusplus
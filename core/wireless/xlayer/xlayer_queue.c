@@ -195,6 +195,23 @@ xlayer_queue_node_t *xlayer_queue_get_node(xlayer_queue_t *xlayer_queue)
     return (xlayer_queue->free_xlayer_queue_type || (xlayer_queue->size == 0)) ? NULL : xlayer_queue->head;
 }
 
+xlayer_queue_node_t *xlayer_queue_get_node_at(xlayer_queue_t *xlayer_queue, uint16_t index)
+{
+    xlayer_queue_node_t *node = NULL;
+
+    CRITICAL_SECTION_ENTER();
+    if (!xlayer_queue->free_xlayer_queue_type && (index < xlayer_queue->size)) {
+        node = xlayer_queue->head;
+        while (index > 0) {
+            node = node->next;
+            index--;
+        }
+    }
+    CRITICAL_SECTION_EXIT();
+
+    return node;
+}
+
 uint16_t xlayer_queue_get_size(xlayer_queue_t *xlayer_queue)
 {
     return (xlayer_queue == NULL) ? 0 : xlayer_queue->size;
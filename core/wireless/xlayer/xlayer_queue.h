@@ -24,6 +24,13 @@ extern "C" {
 #define HEADER_MAX_SIZE              10
 #define XLAYER_QUEUE_LIMIT_UNLIMITED 0xFFFF
 
+/*! Number of bytes required by the TX queue, see xlayer_queue_get_tx_required_bytes(). */
+#define XLAYER_QUEUE_TX_REQUIRED_BYTES(num_nodes) ((num_nodes) * sizeof(xlayer_queue_node_t))
+
+/*! Number of bytes required by the RX queue, see xlayer_queue_get_rx_required_bytes(). */
+#define XLAYER_QUEUE_RX_REQUIRED_BYTES(num_nodes, max_header_size) \
+    ((num_nodes) * (sizeof(xlayer_queue_node_t) + (max_header_size)))
+
 /* TYPES **********************************************************************/
 /** @brief Cross layer queue node.
  */
@@ -153,6 +160,14 @@ bool xlayer_queue_enqueue_at_head(xlayer_queue_t *xlayer_queue, xlayer_queue_nod
  */
 xlayer_queue_node_t *xlayer_queue_get_node(xlayer_queue_t *xlayer_queue);
 
+/** @brief Get the node at a given position of the xlayer_queue, without removing it.
+ *
+ *  @param[in] xlayer_queue  Desired xlayer_queue.
+ *  @param[in] index         Position from the head, 0 being the head.
+ *  @return Address of the node, NULL if the xlayer_queue holds less nodes.
+ */
+xlayer_queue_node_t *xlayer_queue_get_node_at(xlayer_queue_t *xlayer_queue, uint16_t index);
+
 /** @brief Get the size of desired xlayer_queue.
  *
  *  @param[in] xlayer_queue  Desired xlayer_queue.
@@ -220,7 +235,7 @@ void xlayer_queue_set_tx_frame_buffer(xlayer_frame_t *frame, uint8_t header_size
  */
 static inline uint16_t xlayer_queue_get_tx_required_bytes(uint16_t num_nodes)
 {
-    return (num_nodes * sizeof(xlayer_queue_node_t));
+    return XLAYER_QUEUE_TX_REQUIRED_BYTES(num_nodes);
 }
 
 /** @brief Function to calculate the required bytes for the RX queue.
@@ -231,7 +246,7 @@ static inline uint16_t xlayer_queue_get_tx_required_bytes(uint16_t num_nodes)
  */
 static inline uint16_t xlayer_queue_get_rx_required_bytes(uint16_t num_nodes, uint8_t max_header_size)
 {
-    return (num_nodes * (sizeof(xlayer_queue_node_t) + max_header_size));
+    return XLAYER_QUEUE_RX_REQUIRED_BYTES(num_nodes, max_header_size);
 }
 
 #ifdef __cplusplus
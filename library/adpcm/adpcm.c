@@ -22,6 +22,16 @@
 
 /* CONSTANTS ******************************************************************/
 #define STEP_SIZE_TABLE_LENGTH 89
+/* Number of magnitude values of a 4-bit ADPCM sample, the sign bit excluded. */
+#define MAGNITUDE_COUNT 8
+/* Mask of the magnitude bits of a 4-bit ADPCM sample. */
+#define MAGNITUDE_MASK 0x07
+/* Sign bit of a 4-bit ADPCM sample. */
+#define SIGN_BIT 0x08
+/* Mask of a 4-bit ADPCM sample. */
+#define NIBBLE_MASK 0x0F
+/* Shift of the second 4-bit ADPCM sample in a byte. */
+#define NIBBLE_SHIFT 4
 
 const uint16_t step_size_table[STEP_SIZE_TABLE_LENGTH] = {
     7,    8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,   28,
@@ -34,6 +44,44 @@ const uint16_t step_size_table[STEP_SIZE_TABLE_LENGTH] = {
 /* Table of index changes */
 const int8_t index_table[] = {-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
 
+/* MACROS *********************************************************************/
+/* (magnitude + ½) * step_size/4, with the truncations of the reference repetitive addition. */
+#define DIFFERENCE(step_size, magnitude)                                                    \
+    ((((magnitude) & 4) ? (step_size) : 0) + (((magnitude) & 2) ? ((step_size) >> 1) : 0) + \
+     (((magnitude) & 1) ? ((step_size) >> 2) : 0) + ((step_size) >> 3))
+/* Differences of every 4-bit ADPCM sample magnitude for a step size. */
+#define DIFFERENCE_ROW(step_size)                                                                            \
+    {DIFFERENCE(step_size, 0), DIFFERENCE(step_size, 1), DIFFERENCE(step_size, 2), DIFFERENCE(step_size, 3), \
+     DIFFERENCE(step_size, 4), DIFFERENCE(step_size, 5), DIFFERENCE(step_size, 6), DIFFERENCE(step_size, 7)}
+
+/* PRIVATE GLOBALS ************************************************************/
+/* Predictor difference for each step_size_table entry and 4-bit ADPCM sample magnitude, used by the block functions
+ * in place of the repetitive addition.
+ */
+static const uint16_t difference_table[STEP_SIZE_TABLE_LENGTH][MAGNITUDE_COUNT] = {
+    DIFFERENCE_ROW(7),     DIFFERENCE_ROW(8),     DIFFERENCE_ROW(9),     DIFFERENCE_ROW(10),    DIFFERENCE_ROW(11),
+    DIFFERENCE_ROW(12),    DIFFERENCE_ROW(13),    DIFFERENCE_ROW(14),    DIFFERENCE_ROW(16),    DIFFERENCE_ROW(17),
+    DIFFERENCE_ROW(19),    DIFFERENCE_ROW(21),    DIFFERENCE_ROW(23),    DIFFERENCE_ROW(25),    DIFFERENCE_ROW(28),
+    DIFFERENCE_ROW(31),    DIFFERENCE_ROW(34),    DIFFERENCE_ROW(37),    DIFFERENCE_ROW(41),    DIFFERENCE_ROW(45),
+    DIFFERENCE_ROW(50),    DIFFERENCE_ROW(55),    DIFFERENCE_ROW(60),    DIFFERENCE_ROW(66),    DIFFERENCE_ROW(73),
+    DIFFERENCE_ROW(80),    DIFFERENCE_ROW(88),    DIFFERENCE_ROW(97),    DIFFERENCE_ROW(107),   DIFFERENCE_ROW(118),
+    DIFFERENCE_ROW(130),   DIFFERENCE_ROW(143),   DIFFERENCE_ROW(157),   DIFFERENCE_ROW(173),   DIFFERENCE_ROW(190),
+    DIFFERENCE_ROW(209),   DIFFERENCE_ROW(230),   DIFFERENCE_ROW(253),   DIFFERENCE_ROW(279),   DIFFERENCE_ROW(307),
+    DIFFERENCE_ROW(337),   DIFFERENCE_ROW(371),   DIFFERENCE_ROW(408),   DIFFERENCE_ROW(449),   DIFFERENCE_ROW(494),
+    DIFFERENCE_ROW(544),   DIFFERENCE_ROW(598),   DIFFERENCE_ROW(658),   DIFFERENCE_ROW(724),   DIFFERENCE_ROW(796),
+    DIFFERENCE_ROW(876),   DIFFERENCE_ROW(963),   DIFFERENCE_ROW(1060),  DIFFERENCE_ROW(1166),  DIFFERENCE_ROW(1282),
+    DIFFERENCE_ROW(1411),  DIFFERENCE_ROW(1552),  DIFFERENCE_ROW(1707),  DIFFERENCE_ROW(1878),  DIFFERENCE_ROW(2066),
+    DIFFERENCE_ROW(2272),  DIFFERENCE_ROW(2499),  DIFFERENCE_ROW(2749),  DIFFERENCE_ROW(3024),  DIFFERENCE_ROW(3327),
+    DIFFERENCE_ROW(3660),  DIFFERENCE_ROW(4026),  DIFFERENCE_ROW(4428),  DIFFERENCE_ROW(4871),  DIFFERENCE_ROW(5358),
+    DIFFERENCE_ROW(5894),  DIFFERENCE_ROW(6484),  DIFFERENCE_ROW(7132),  DIFFERENCE_ROW(7845),  DIFFERENCE_ROW(8630),
+    DIFFERENCE_ROW(9493),  DIFFERENCE_ROW(10442), DIFFERENCE_ROW(11487), DIFFERENCE_ROW(12635), DIFFERENCE_ROW(13899),
+    DIFFERENCE_ROW(15289), DIFFERENCE_ROW(16818), DIFFERENCE_ROW(18500), DIFFERENCE_ROW(20350), DIFFERENCE_ROW(22385),
+    DIFFERENCE_ROW(24623), DIFFERENCE_ROW(27086), DIFFERENCE_ROW(29794), DIFFERENCE_ROW(32767)};
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static inline uint8_t encode_sample(int32_t original_sample, int32_t *predicted_sample, int32_t *index);
+static inline int16_t decode_sample(uint8_t original_sample, int32_t *predicted_sample, int32_t *index);
+
 /* PUBLIC FUNCTIONS ***********************************************************/
 void adpcm_init_state(adpcm_state_t *state)
 {
@@ -162,3 +210,181 @@ int16_t adpcm_decode(uint8_t original_sample, adpcm_state_t *state)
 
     return (int16_t)new_sample;
 }
+
+uint16_t adpcm_encode_block(const int16_t *pcm, uint16_t frame_count, uint8_t channel_count, adpcm_state_t *state,
+                            uint8_t *adpcm)
+{
+    int32_t left_predicted_sample = state[0].state.predicted_sample;
+    int32_t left_index = state[0].state.index;
+    int32_t right_predicted_sample = 0;
+    int32_t right_index = 0;
+    uint16_t byte_count = 0;
+    uint8_t left_code = 0;
+    uint8_t right_code = 0;
+
+    if (channel_count == 2) {
+        right_predicted_sample = state[1].state.predicted_sample;
+        right_index = state[1].state.index;
+
+        /* One byte per frame, left channel in the 4-bit LSB and right channel in the 4-bit MSB. */
+        for (uint16_t i = 0; i < frame_count; i++) {
+            left_code = encode_sample(*pcm++, &left_predicted_sample, &left_index);
+            right_code = encode_sample(*pcm++, &right_predicted_sample, &right_index);
+            *adpcm++ = left_code | (right_code << NIBBLE_SHIFT);
+        }
+        byte_count = frame_count;
+
+        state[1].state.predicted_sample = (int16_t)right_predicted_sample;
+        state[1].state.index = (uint8_t)right_index;
+    } else if (channel_count == 1) {
+        /* One byte per pair of samples, oldest sample in the 4-bit LSB. */
+        for (uint16_t i = 0; i < (frame_count / 2); i++) {
+            left_code = encode_sample(*pcm++, &left_predicted_sample, &left_index);
+            right_code = encode_sample(*pcm++, &left_predicted_sample, &left_index);
+            *adpcm++ = left_code | (right_code << NIBBLE_SHIFT);
+        }
+        byte_count = frame_count / 2;
+        if (frame_count & 0x01) {
+            *adpcm = encode_sample(*pcm, &left_predicted_sample, &left_index);
+            byte_count++;
+        }
+    } else {
+        return 0;
+    }
+
+    state[0].state.predicted_sample = (int16_t)left_predicted_sample;
+    state[0].state.index = (uint8_t)left_index;
+
+    return byte_count;
+}
+
+uint16_t adpcm_decode_block(const uint8_t *adpcm, uint16_t frame_count, uint8_t channel_count, adpcm_state_t *state,
+                            int16_t *pcm)
+{
+    int32_t left_predicted_sample = state[0].state.predicted_sample;
+    int32_t left_index = state[0].state.index;
+    int32_t right_predicted_sample = 0;
+    int32_t right_index = 0;
+    uint8_t code = 0;
+
+    if (channel_count == 2) {
+        right_predicted_sample = state[1].state.predicted_sample;
+        right_index = state[1].state.index;
+
+        for (uint16_t i = 0; i < frame_count; i++) {
+            code = *adpcm++;
+            *pcm++ = decode_sample(code & NIBBLE_MASK, &left_predicted_sample, &left_index);
+            *pcm++ = decode_sample(code >> NIBBLE_SHIFT, &right_predicted_sample, &right_index);
+        }
+
+        state[1].state.predicted_sample = (int16_t)right_predicted_sample;
+        state[1].state.index = (uint8_t)right_index;
+    } else if (channel_count == 1) {
+        for (uint16_t i = 0; i < (frame_count / 2); i++) {
+            code = *adpcm++;
+            *pcm++ = decode_sample(code & NIBBLE_MASK, &left_predicted_sample, &left_index);
+            *pcm++ = decode_sample(code >> NIBBLE_SHIFT, &left_predicted_sample, &left_index);
+        }
+        if (frame_count & 0x01) {
+            *pcm = decode_sample(*adpcm & NIBBLE_MASK, &left_predicted_sample, &left_index);
+        }
+    } else {
+        return 0;
+    }
+
+    state[0].state.predicted_sample = (int16_t)left_predicted_sample;
+    state[0].state.index = (uint8_t)left_index;
+
+    return frame_count * channel_count;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Encode a 16-bit PCM sample with the predictor state held in local variables.
+ *
+ *  Gives the same result as adpcm_encode(), with the predictor update read from difference_table.
+ *
+ *  @param[in]     original_sample   16-bit PCM sample.
+ *  @param[in,out] predicted_sample  Output of the ADPCM predictor.
+ *  @param[in,out] index             Index into step_size_table.
+ *  @return 4-bit ADPCM sample.
+ */
+static inline uint8_t encode_sample(int32_t original_sample, int32_t *predicted_sample, int32_t *index)
+{
+    int32_t step_size = step_size_table[*index];
+    int32_t difference = original_sample - *predicted_sample;
+    int32_t predicted_difference = 0;
+    uint8_t new_sample = 0;
+
+    if (difference < 0) {
+        new_sample = SIGN_BIT;
+        difference = -difference;
+    }
+
+    /* Quantize the difference down to three bits by successive approximation. */
+    if (difference >= step_size) {
+        new_sample |= 4;
+        difference -= step_size;
+    }
+    step_size >>= 1;
+    if (difference >= step_size) {
+        new_sample |= 2;
+        difference -= step_size;
+    }
+    step_size >>= 1;
+    if (difference >= step_size) {
+        new_sample |= 1;
+    }
+
+    predicted_difference = difference_table[*index][new_sample & MAGNITUDE_MASK];
+    if (new_sample & SIGN_BIT) {
+        predicted_difference = -predicted_difference;
+    }
+    *predicted_sample += predicted_difference;
+    if (*predicted_sample > INT16_MAX) {
+        *predicted_sample = INT16_MAX;
+    } else if (*predicted_sample < INT16_MIN) {
+        *predicted_sample = INT16_MIN;
+    }
+
+    *index += index_table[new_sample];
+    if (*index < 0) {
+        *index = 0;
+    } else if (*index > (STEP_SIZE_TABLE_LENGTH - 1)) {
+        *index = STEP_SIZE_TABLE_LENGTH - 1;
+    }
+
+    return new_sample;
+}
+
+/** @brief Decode a 4-bit ADPCM sample with the predictor state held in local variables.
+ *
+ *  Gives the same result as adpcm_decode(), with the predictor update read from difference_table.
+ *
+ *  @param[in]     original_sample   4-bit ADPCM sample.
+ *  @param[in,out] predicted_sample  Output of the ADPCM predictor.
+ *  @param[in,out] index             Index into step_size_table.
+ *  @return 16-bit PCM sample.
+ */
+static inline int16_t decode_sample(uint8_t original_sample, int32_t *predicted_sample, int32_t *index)
+{
+    int32_t difference = difference_table[*index][original_sample & MAGNITUDE_MASK];
+
+    if (original_sample & SIGN_BIT) {
+        difference = -difference;
+    }
+    *predicted_sample += difference;
+    if (*predicted_sample > INT16_MAX) {
+        *predicted_sample = INT16_MAX;
+    } else if (*predicted_sample < INT16_MIN) {
+        *predicted_sample = INT16_MIN;
+    }
+
+    *index += index_table[original_sample];
+    if (*index < 0) {
+        *index = 0;
+    } else if (*index > (STEP_SIZE_TABLE_LENGTH - 1)) {
+        *index = STEP_SIZE_TABLE_LENGTH - 1;
+    }
+
+    return (int16_t)*predicted_sample;
+}
@@ -92,6 +92,39 @@ uint8_t adpcm_encode(int32_t original_sample, adpcm_state_t *state);
  */
 int16_t adpcm_decode(uint8_t original_sample, adpcm_state_t *state);
 
+/** @brief Encode a block of interleaved 16-bit PCM samples using ADPCM compression.
+ *
+ *  Gives the same result as calling adpcm_encode() on every sample, with the channel states kept
+ *  in local variables for the whole block and the 4-bit samples packed as they are produced:
+ *    - stereo: one byte per frame, left channel in the 4-bit LSB and right channel in the 4-bit MSB;
+ *    - mono: one byte per pair of samples, oldest sample in the 4-bit LSB. An odd last sample uses
+ *      the 4-bit LSB of a last byte whose 4-bit MSB is cleared.
+ *
+ *  @param[in]     pcm            Interleaved 16-bit PCM samples.
+ *  @param[in]     frame_count    Number of samples per channel.
+ *  @param[in]     channel_count  Number of interleaved channels, 1 or 2.
+ *  @param[in,out] state          Internal ADPCM encoder state of each channel.
+ *  @param[out]    adpcm          Packed 4-bit ADPCM samples.
+ *  @return Number of bytes written to adpcm, 0 if the channel count is not supported.
+ */
+uint16_t adpcm_encode_block(const int16_t *pcm, uint16_t frame_count, uint8_t channel_count, adpcm_state_t *state,
+                            uint8_t *adpcm);
+
+/** @brief Decode a block of packed 4-bit ADPCM samples into interleaved 16-bit PCM samples.
+ *
+ *  Gives the same result as calling adpcm_decode() on every sample. The packing is the one
+ *  produced by adpcm_encode_block().
+ *
+ *  @param[in]     adpcm          Packed 4-bit ADPCM samples.
+ *  @param[in]     frame_count    Number of samples per channel.
+ *  @param[in]     channel_count  Number of interleaved channels, 1 or 2.
+ *  @param[in,out] state          Internal ADPCM decoder state of each channel.
+ *  @param[out]    pcm            Interleaved 16-bit PCM samples.
+ *  @return Number of samples written to pcm, 0 if the channel count is not supported.
+ */
+uint16_t adpcm_decode_block(const uint8_t *adpcm, uint16_t frame_count, uint8_t channel_count, adpcm_state_t *state,
+                            int16_t *pcm);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,33 @@
+/** @file crc16_ccitt.c
+ *  @brief 16-bit CRC implementation (CRC-16/CCITT-FALSE, polynomial 0x1021).
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "crc16_ccitt.h"
+#include <stddef.h>
+
+/* CONSTANTS ******************************************************************/
+/* Lookup table for CRC16-CCITT, one entry per nibble to keep the flash footprint small */
+static const uint16_t table_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+};
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *data, uint16_t len)
+{
+    if (data == NULL) {
+        return 0;
+    }
+    while (len--) {
+        crc = (uint16_t)(crc << 4) ^ table_nibble[(crc >> 12) ^ (*data >> 4)];
+        crc = (uint16_t)(crc << 4) ^ table_nibble[(crc >> 12) ^ (*data & 0xf)];
+        data++;
+    }
+    return crc;
+}
@@ -0,0 +1,37 @@
+/** @file crc16_ccitt.h
+ *  @brief 16-bit CRC implementation (CRC-16/CCITT-FALSE, polynomial 0x1021).
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef CRC16_CCITT_H_
+#define CRC16_CCITT_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Initial CRC value. */
+#define CRC16_CCITT_INIT 0xFFFF
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Calculate CRC16 of input data.
+ *
+ *  @param[in] crc   Existing CRC value before process a new one, CRC16_CCITT_INIT for the first block.
+ *  @param[in] data  Pointer to data to be hashed with CRC.
+ *  @param[in] len   Size of data.
+ *  @return CRC value.
+ */
+uint16_t crc16_ccitt(uint16_t crc, const uint8_t *data, uint16_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC16_CCITT_H_ */
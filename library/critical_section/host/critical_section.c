@@ -0,0 +1,31 @@
+/** @file  critical_section.c
+ *  @brief This file contains functions for entering and exiting critical sections on the host.
+ *
+ *         The host has no interrupts, the critical section is a recursive mutex shared by every thread so host tools
+ *         running producers and consumers in separate threads get the same mutual exclusion as on the target. The
+ *         implementation takes into account nested critical sections.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#define _GNU_SOURCE
+#include <pthread.h>
+#include "critical_section.h"
+
+/* PRIVATE GLOBALS ************************************************************/
+static pthread_mutex_t critical_region_mutex = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void CRITICAL_SECTION_ENTER(void)
+{
+    pthread_mutex_lock(&critical_region_mutex);
+}
+
+void CRITICAL_SECTION_EXIT(void)
+{
+    pthread_mutex_unlock(&critical_region_mutex);
+}
@@ -23,6 +23,10 @@ extern "C" {
 #define FIR_BITSHIFT_16BITS 16
 #define FIR_BITSHIFT_24BITS 8
 
+/*! Number of state samples required by a channel-fused filter: one history of (taps + block_size - 1) per channel. */
+#define FIR_MULTI_STATE_SIZE(num_taps, block_size, channel_count) \
+    ((uint32_t)(channel_count) * ((uint32_t)(num_taps) + (uint32_t)(block_size) - 1U))
+
 /* TYPES **********************************************************************/
 /** @brief Error status returned by init functions in the library.
  */
@@ -99,6 +103,100 @@ typedef struct fir_interpolate_instance {
     fir_sample_format_t output_sample_format;
 } fir_interpolate_instance_t;
 
+/** @brief Instance structure for the channel-fused 32-bit FIR decimator.
+ */
+typedef struct fir_decimate_multi_instance {
+    /*! Decimation factor. */
+    uint8_t divide_ratio;
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! Number of coefficients in the filter. */
+    uint16_t num_taps;
+    /*! Points to the coefficient array. The array is of length num_taps. */
+    const int32_t *p_coeffs;
+    /*! Points to the state variable array. The array is of length FIR_MULTI_STATE_SIZE(num_taps, block_size,
+     *  channel_count), each channel owns a contiguous history of state_stride samples.
+     */
+    int32_t *p_state;
+    /*! Number of state samples per channel. */
+    uint32_t state_stride;
+    /*! Sample size of an input sample in bytes. */
+    fir_sample_format_t input_sample_format;
+    /*! Sample size of an output sample in bytes. */
+    fir_sample_format_t output_sample_format;
+} fir_decimate_multi_instance_t;
+
+/** @brief Instance structure for the channel-fused 32-bit FIR interpolator.
+ */
+typedef struct fir_interpolate_multi_instance {
+    /*! Upsample factor. */
+    uint8_t multiply_ratio;
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! Length of each polyphase filter component. */
+    uint16_t phase_length;
+    /*! Points to the coefficient array. The array is of length multiply_ratio*phase_length. */
+    const int32_t *p_coeffs;
+    /*! Points to the state variable array. The array is of length FIR_MULTI_STATE_SIZE(phase_length, block_size,
+     *  channel_count), each channel owns a contiguous history of state_stride samples.
+     */
+    int32_t *p_state;
+    /*! Number of state samples per channel. */
+    uint32_t state_stride;
+    /*! Sample size of an input sample in bytes. */
+    fir_sample_format_t input_sample_format;
+    /*! Sample size of an output sample in bytes. */
+    fir_sample_format_t output_sample_format;
+} fir_interpolate_multi_instance_t;
+
+/** @brief Instance structure for the channel-fused Q15 FIR decimator.
+ */
+typedef struct fir_decimate_q15_multi_instance {
+    /*! Decimation factor. */
+    uint8_t divide_ratio;
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! Number of coefficients in the filter. */
+    uint16_t num_taps;
+    /*! Points to the 1.15 coefficient array. The array is of length num_taps. */
+    const int16_t *p_coeffs;
+    /*! Points to the state variable array. The array is of length FIR_MULTI_STATE_SIZE(num_taps, block_size,
+     *  channel_count), each channel owns a contiguous history of state_stride samples.
+     */
+    int16_t *p_state;
+    /*! Number of state samples per channel. */
+    uint32_t state_stride;
+    /*! Sample size of an input sample in bytes. */
+    fir_sample_format_t input_sample_format;
+    /*! Sample size of an output sample in bytes. */
+    fir_sample_format_t output_sample_format;
+} fir_decimate_q15_multi_instance_t;
+
+/** @brief Instance structure for the channel-fused Q15 FIR interpolator.
+ */
+typedef struct fir_interpolate_q15_multi_instance {
+    /*! Upsample factor. */
+    uint8_t multiply_ratio;
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! Length of each polyphase filter component. */
+    uint16_t phase_length;
+    /*! Points to the 1.15 coefficient array rearranged by polyphase component. The array is of length
+     *  multiply_ratio*phase_length.
+     */
+    const int16_t *p_phase_coeffs;
+    /*! Points to the state variable array. The array is of length FIR_MULTI_STATE_SIZE(phase_length, block_size,
+     *  channel_count), each channel owns a contiguous history of state_stride samples.
+     */
+    int16_t *p_state;
+    /*! Number of state samples per channel. */
+    uint32_t state_stride;
+    /*! Sample size of an input sample in bytes. */
+    fir_sample_format_t input_sample_format;
+    /*! Sample size of an output sample in bytes. */
+    fir_sample_format_t output_sample_format;
+} fir_interpolate_q15_multi_instance_t;
+
 /* PUBLIC FUNCTION PROTOTYPES *************************************************/
 /** @brief  Initialization function for the 16-bit FIR interpolator.
  *
@@ -173,6 +271,141 @@ void fir_decimate(const fir_decimate_instance_t *instance, const uint8_t *src, u
 void fir_interpolate(const fir_interpolate_instance_t *instance, const uint8_t *src, uint8_t *dst, uint32_t block_size,
                      uint8_t channel, uint8_t channel_count);
 
+/** @brief Initialization function for the channel-fused 32-bit FIR decimator.
+ *
+ *  @param[in] instance       Points to an instance of the channel-fused FIR decimator structure.
+ *  @param[in] num_taps       Number of coefficients in the filter.
+ *  @param[in] divide_ratio   Decimation factor.
+ *  @param[in] channel_count  Number of interleaved channels.
+ *  @param[in] p_coeffs       Points to the filter coefficients.
+ *  @param[in] p_state        Points to the state buffer of FIR_MULTI_STATE_SIZE(num_taps, block_size, channel_count)
+ *                            samples.
+ *  @param[in] block_size     Maximum number of input samples per channel to process per call.
+ *  @return FIR initialization error code.
+ */
+filtering_functions_error_t fir_decimate_multi_init(fir_decimate_multi_instance_t *instance, uint16_t num_taps,
+                                                    uint8_t divide_ratio, uint8_t channel_count,
+                                                    const int32_t *p_coeffs, int32_t *p_state, uint32_t block_size);
+
+/** @brief Processing function for the channel-fused 32-bit FIR decimator.
+ *
+ *  All the interleaved channels are filtered in a single pass over the input and only the retained outputs are
+ *  computed.
+ *
+ *  @param[in]  instance    Points to an instance of the channel-fused FIR decimator structure.
+ *  @param[in]  src         Points to the block of interleaved input data.
+ *  @param[out] dst         Points to the block of interleaved output data.
+ *  @param[in]  block_size  Number of input samples per channel to process.
+ *
+ *  @par           Scaling and Overflow Behavior
+ *                   Same as fir_decimate().
+ */
+void fir_decimate_multi(const fir_decimate_multi_instance_t *instance, const uint8_t *src, uint8_t *dst,
+                        uint32_t block_size);
+
+/** @brief Initialization function for the channel-fused 32-bit FIR interpolator.
+ *
+ *  @param[in] instance        Points to an instance of the channel-fused FIR interpolator structure.
+ *  @param[in] multiply_ratio  Upsample factor.
+ *  @param[in] num_taps        Number of filter coefficients in the filter.
+ *  @param[in] channel_count   Number of interleaved channels.
+ *  @param[in] p_coeffs        Points to the filter coefficient buffer.
+ *  @param[in] p_state         Points to the state buffer of FIR_MULTI_STATE_SIZE(num_taps / multiply_ratio,
+ *                             block_size, channel_count) samples.
+ *  @param[in] block_size      Maximum number of input samples per channel to process per call.
+ *  @return FIR initialization error code.
+ */
+filtering_functions_error_t fir_interpolate_multi_init(fir_interpolate_multi_instance_t *instance,
+                                                       uint8_t multiply_ratio, uint16_t num_taps,
+                                                       uint8_t channel_count, const int32_t *p_coeffs,
+                                                       int32_t *p_state, uint32_t block_size);
+
+/** @brief Processing function for the channel-fused 32-bit FIR interpolator.
+ *
+ *  @param[in]  instance    Points to an instance of the channel-fused FIR interpolator structure.
+ *  @param[in]  src         Points to the block of interleaved input data.
+ *  @param[out] dst         Points to the block of interleaved output data.
+ *  @param[in]  block_size  Number of input samples per channel to process.
+ *
+ *  @par           Scaling and Overflow Behavior
+ *                   Same as fir_interpolate().
+ */
+void fir_interpolate_multi(const fir_interpolate_multi_instance_t *instance, const uint8_t *src, uint8_t *dst,
+                           uint32_t block_size);
+
+/** @brief Convert 1.31 filter coefficients to 1.15 format with rounding.
+ *
+ *  @param[in]  p_src     Points to the 1.31 coefficients.
+ *  @param[out] p_dst     Points to the 1.15 coefficients.
+ *  @param[in]  num_taps  Number of coefficients.
+ */
+void fir_coeffs_q31_to_q15(const int32_t *p_src, int16_t *p_dst, uint16_t num_taps);
+
+/** @brief Initialization function for the channel-fused Q15 FIR decimator.
+ *
+ *  @param[in] instance       Points to an instance of the channel-fused Q15 FIR decimator structure.
+ *  @param[in] num_taps       Number of coefficients in the filter.
+ *  @param[in] divide_ratio   Decimation factor.
+ *  @param[in] channel_count  Number of interleaved channels.
+ *  @param[in] p_coeffs       Points to the 1.15 filter coefficients.
+ *  @param[in] p_state        Points to the state buffer of FIR_MULTI_STATE_SIZE(num_taps, block_size, channel_count)
+ *                            samples.
+ *  @param[in] block_size     Maximum number of input samples per channel to process per call.
+ *  @return FIR initialization error code.
+ */
+filtering_functions_error_t fir_decimate_q15_multi_init(fir_decimate_q15_multi_instance_t *instance,
+                                                        uint16_t num_taps, uint8_t divide_ratio,
+                                                        uint8_t channel_count, const int16_t *p_coeffs,
+                                                        int16_t *p_state, uint32_t block_size);
+
+/** @brief Processing function for the channel-fused Q15 FIR decimator.
+ *
+ *  @param[in]  instance    Points to an instance of the channel-fused Q15 FIR decimator structure.
+ *  @param[in]  src         Points to the block of interleaved input data.
+ *  @param[out] dst         Points to the block of interleaved output data.
+ *  @param[in]  block_size  Number of input samples per channel to process.
+ *
+ *  @par           Scaling and Overflow Behavior
+ *                   Input samples are truncated to 1.15 format. Products are 2.30 and accumulated in a 32-bit
+ *                   accumulator, two at a time with the SMLAD instruction when the core implements the DSP
+ *                   extension. The sum of the absolute values of the coefficients must stay below 2.0 to prevent an
+ *                   internal overflow. The result is then saturated to the 16-bit or 24-bit output bit depth.
+ */
+void fir_decimate_q15_multi(const fir_decimate_q15_multi_instance_t *instance, const uint8_t *src, uint8_t *dst,
+                            uint32_t block_size);
+
+/** @brief Initialization function for the channel-fused Q15 FIR interpolator.
+ *
+ *  @param[in]  instance        Points to an instance of the channel-fused Q15 FIR interpolator structure.
+ *  @param[in]  multiply_ratio  Upsample factor.
+ *  @param[in]  num_taps        Number of filter coefficients in the filter.
+ *  @param[in]  channel_count   Number of interleaved channels.
+ *  @param[in]  p_coeffs        Points to the 1.15 filter coefficients.
+ *  @param[out] p_phase_coeffs  Points to a buffer of num_taps coefficients receiving the polyphase components.
+ *  @param[in]  p_state         Points to the state buffer of FIR_MULTI_STATE_SIZE(num_taps / multiply_ratio,
+ *                              block_size, channel_count) samples.
+ *  @param[in]  block_size      Maximum number of input samples per channel to process per call.
+ *  @return FIR initialization error code.
+ */
+filtering_functions_error_t fir_interpolate_q15_multi_init(fir_interpolate_q15_multi_instance_t *instance,
+                                                           uint8_t multiply_ratio, uint16_t num_taps,
+                                                           uint8_t channel_count, const int16_t *p_coeffs,
+                                                           int16_t *p_phase_coeffs, int16_t *p_state,
+                                                           uint32_t block_size);
+
+/** @brief Processing function for the channel-fused Q15 FIR interpolator.
+ *
+ *  @param[in]  instance    Points to an instance of the channel-fused Q15 FIR interpolator structure.
+ *  @param[in]  src         Points to the block of interleaved input data.
+ *  @param[out] dst         Points to the block of interleaved output data.
+ *  @param[in]  block_size  Number of input samples per channel to process.
+ *
+ *  @par           Scaling and Overflow Behavior
+ *                   Same as fir_decimate_q15_multi(), applied to each polyphase component.
+ */
+void fir_interpolate_q15_multi(const fir_interpolate_q15_multi_instance_t *instance, const uint8_t *src,
+                               uint8_t *dst, uint32_t block_size);
+
 #ifdef __cplusplus
 }
 #endif
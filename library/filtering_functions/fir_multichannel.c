@@ -0,0 +1,231 @@
+/** @file  fir_multichannel.c
+ *  @brief Channel-fused 32-bit FIR decimator and interpolator.
+ *
+ *  The interleaved input is walked once per call. Every frame is split in the per-channel history buffers and all
+ *  channels are filtered with the same coefficient set, so the source buffer and the coefficients are only fetched
+ *  once per block instead of once per channel.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <string.h>
+#include "filtering_functions.h"
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static inline int32_t read_sample(const uint8_t *src, const fir_sample_format_t *format);
+static inline void write_sample(uint8_t *dst, int64_t acc, const fir_sample_format_t *format);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+filtering_functions_error_t fir_decimate_multi_init(fir_decimate_multi_instance_t *instance, uint16_t num_taps,
+                                                    uint8_t divide_ratio, uint8_t channel_count,
+                                                    const int32_t *p_coeffs, int32_t *p_state, uint32_t block_size)
+{
+    if ((num_taps == 0) || (divide_ratio == 0) || (channel_count == 0)) {
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    /* The size of the input block must be a multiple of the decimation factor */
+    if ((block_size % divide_ratio) != 0) {
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    instance->num_taps = num_taps;
+    instance->divide_ratio = divide_ratio;
+    instance->channel_count = channel_count;
+    instance->p_coeffs = p_coeffs;
+    instance->state_stride = num_taps + (block_size - 1U);
+
+    /* Clear the history of every channel. */
+    memset(p_state, 0, FIR_MULTI_STATE_SIZE(num_taps, block_size, channel_count) * sizeof(int32_t));
+    instance->p_state = p_state;
+
+    return FILTERING_FUNCTION_ERR_NONE;
+}
+
+void fir_decimate_multi(const fir_decimate_multi_instance_t *instance, const uint8_t *src, uint8_t *dst,
+                        uint32_t block_size)
+{
+    const int32_t *p_coeffs = instance->p_coeffs;
+    const fir_sample_format_t *input_format = &instance->input_sample_format;
+    const fir_sample_format_t *output_format = &instance->output_sample_format;
+    const uint32_t num_taps = instance->num_taps;
+    const uint32_t state_stride = instance->state_stride;
+    const uint8_t divide_ratio = instance->divide_ratio;
+    const uint8_t channel_count = instance->channel_count;
+    const uint8_t sample_size_in_byte = input_format->sample_size_byte;
+    const uint8_t sample_size_out_byte = output_format->sample_size_byte;
+    uint32_t block_count = block_size / divide_ratio;
+    uint32_t write_idx = num_taps - 1U; /* Where the next input frame is stored in each channel history */
+    uint32_t read_idx = 0;              /* Oldest history sample of the current output */
+    int32_t *p_state_ch = NULL;
+    const int32_t *px = NULL;
+    const int32_t *pb = NULL;
+    int64_t acc = 0;
+    uint32_t tap_count = 0;
+
+    while (block_count > 0U) {
+        /* Split decimation factor number of interleaved frames in the channel histories. */
+        for (uint8_t i = 0; i < divide_ratio; i++) {
+            p_state_ch = instance->p_state + write_idx;
+            for (uint8_t ch = 0; ch < channel_count; ch++) {
+                *p_state_ch = read_sample(src, input_format);
+                p_state_ch += state_stride;
+                src += sample_size_in_byte;
+            }
+            write_idx++;
+        }
+
+        /* Only the retained output of each group is computed, the discarded ones are never evaluated. */
+        for (uint8_t ch = 0; ch < channel_count; ch++) {
+            px = instance->p_state + (ch * state_stride) + read_idx;
+            pb = p_coeffs;
+            acc = 0;
+
+            /* Loop unrolling: Compute 4 taps at a time */
+            tap_count = num_taps >> 2U;
+            while (tap_count > 0U) {
+                acc += (int64_t)px[0] * pb[0];
+                acc += (int64_t)px[1] * pb[1];
+                acc += (int64_t)px[2] * pb[2];
+                acc += (int64_t)px[3] * pb[3];
+                px += 4;
+                pb += 4;
+                tap_count--;
+            }
+            tap_count = num_taps % 0x4U;
+            while (tap_count > 0U) {
+                acc += (int64_t)*px++ * *pb++;
+                tap_count--;
+            }
+
+            write_sample(dst, acc, output_format);
+            dst += sample_size_out_byte;
+        }
+
+        read_idx += divide_ratio;
+        block_count--;
+    }
+
+    /* Keep the last (num_taps - 1) samples of every channel for the next call. */
+    for (uint8_t ch = 0; ch < channel_count; ch++) {
+        p_state_ch = instance->p_state + (ch * state_stride);
+        memmove(p_state_ch, p_state_ch + read_idx, (num_taps - 1U) * sizeof(int32_t));
+    }
+}
+
+filtering_functions_error_t fir_interpolate_multi_init(fir_interpolate_multi_instance_t *instance,
+                                                       uint8_t multiply_ratio, uint16_t num_taps,
+                                                       uint8_t channel_count, const int32_t *p_coeffs,
+                                                       int32_t *p_state, uint32_t block_size)
+{
+    if ((num_taps == 0) || (multiply_ratio == 0) || (channel_count == 0)) {
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    /* The filter length must be a multiple of the interpolation factor */
+    if ((num_taps % multiply_ratio) != 0) {
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    instance->multiply_ratio = multiply_ratio;
+    instance->phase_length = num_taps / multiply_ratio;
+    instance->channel_count = channel_count;
+    instance->p_coeffs = p_coeffs;
+    instance->state_stride = instance->phase_length + (block_size - 1U);
+
+    /* Clear the history of every channel. */
+    memset(p_state, 0, FIR_MULTI_STATE_SIZE(instance->phase_length, block_size, channel_count) * sizeof(int32_t));
+    instance->p_state = p_state;
+
+    return FILTERING_FUNCTION_ERR_NONE;
+}
+
+void fir_interpolate_multi(const fir_interpolate_multi_instance_t *instance, const uint8_t *src, uint8_t *dst,
+                           uint32_t block_size)
+{
+    const fir_sample_format_t *input_format = &instance->input_sample_format;
+    const fir_sample_format_t *output_format = &instance->output_sample_format;
+    const uint32_t phase_len = instance->phase_length;
+    const uint32_t state_stride = instance->state_stride;
+    const uint8_t multiply_ratio = instance->multiply_ratio;
+    const uint8_t channel_count = instance->channel_count;
+    const uint8_t sample_size_in_byte = input_format->sample_size_byte;
+    const uint8_t sample_size_out_byte = output_format->sample_size_byte;
+    uint32_t block_count = block_size;
+    uint32_t write_idx = phase_len - 1U; /* Where the next input frame is stored in each channel history */
+    uint32_t read_idx = 0;               /* Oldest history sample of the current output */
+    int32_t *p_state_ch = NULL;
+    const int32_t *px = NULL;
+    const int32_t *pb = NULL;
+    int64_t acc = 0;
+    uint32_t tap_count = 0;
+
+    while (block_count > 0U) {
+        /* Split one interleaved frame in the channel histories. */
+        p_state_ch = instance->p_state + write_idx;
+        for (uint8_t ch = 0; ch < channel_count; ch++) {
+            *p_state_ch = read_sample(src, input_format);
+            p_state_ch += state_stride;
+            src += sample_size_in_byte;
+        }
+        write_idx++;
+
+        /* Each output phase only uses its polyphase component, the stuffed zeros are never multiplied. */
+        for (uint8_t phase = 0; phase < multiply_ratio; phase++) {
+            for (uint8_t ch = 0; ch < channel_count; ch++) {
+                px = instance->p_state + (ch * state_stride) + read_idx;
+                pb = instance->p_coeffs + (multiply_ratio - 1U - phase);
+                acc = 0;
+
+                tap_count = phase_len;
+                while (tap_count > 0U) {
+                    acc += (int64_t)*px++ * *pb;
+                    pb += multiply_ratio;
+                    tap_count--;
+                }
+
+                write_sample(dst, acc, output_format);
+                dst += sample_size_out_byte;
+            }
+        }
+
+        read_idx++;
+        block_count--;
+    }
+
+    /* Keep the last (phase_len - 1) samples of every channel for the next call. */
+    for (uint8_t ch = 0; ch < channel_count; ch++) {
+        p_state_ch = instance->p_state + (ch * state_stride);
+        memmove(p_state_ch, p_state_ch + read_idx, (phase_len - 1U) * sizeof(int32_t));
+    }
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Read an input sample and align it on 32 bits.
+ *
+ *  @param[in] src     Points to the input sample.
+ *  @param[in] format  Input sample format.
+ *  @return Sample in 1.31 format.
+ */
+static inline int32_t read_sample(const uint8_t *src, const fir_sample_format_t *format)
+{
+    return (int32_t)((*((const int32_t *)src) & format->sample_mask) << format->sample_bitshift);
+}
+
+/** @brief Scale an accumulator back to the output format and store it.
+ *
+ *  @param[out] dst     Points to the output sample.
+ *  @param[in]  acc     Accumulator in 2.62 format.
+ *  @param[in]  format  Output sample format.
+ */
+static inline void write_sample(uint8_t *dst, int64_t acc, const fir_sample_format_t *format)
+{
+    acc = acc >> (31 + format->sample_bitshift);
+    for (uint8_t k = 0; k < format->sample_size_byte; k++) {
+        dst[k] = ((uint8_t *)&acc)[k];
+    }
+}
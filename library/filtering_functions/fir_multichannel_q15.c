@@ -0,0 +1,279 @@
+/** @file  fir_multichannel_q15.c
+ *  @brief Channel-fused FIR decimator and interpolator with 16-bit coefficients and a 32-bit accumulator.
+ *
+ *  Samples and coefficients are kept in 1.15 format so two taps are packed in a 32-bit word. On cores implementing
+ *  the Arm DSP extension (Cortex-M33, Cortex-M4, ...) the multiply-accumulate uses the SMLAD dual 16-bit MAC, other
+ *  targets use a portable C implementation producing the same results.
+ *
+ *  @note The 32-bit accumulator holds 2.30 products. To prevent an overflow, the sum of the absolute values of the
+ *        coefficients used for one output must stay below 2.0.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include <string.h>
+#include "filtering_functions.h"
+#if defined(__ARM_FEATURE_SIMD32) && (__ARM_FEATURE_SIMD32 == 1)
+#include <arm_acle.h>
+#endif
+
+/* CONSTANTS ******************************************************************/
+#define Q31_TO_Q15_SHIFT 16
+#define Q15_MAX          INT16_MAX
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static inline int16_t read_sample(const uint8_t *src, const fir_sample_format_t *format);
+static inline void write_sample(uint8_t *dst, int32_t acc, const fir_sample_format_t *format);
+static inline int32_t mac_q15(const int16_t *px, const int16_t *pb, uint32_t tap_count);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void fir_coeffs_q31_to_q15(const int32_t *p_src, int16_t *p_dst, uint16_t num_taps)
+{
+    int32_t coeff = 0;
+
+    for (uint16_t i = 0; i < num_taps; i++) {
+        /* Round to nearest, the positive full scale can not be represented in 1.15 format. */
+        coeff = (int32_t)(((int64_t)p_src[i] + (1 << (Q31_TO_Q15_SHIFT - 1))) >> Q31_TO_Q15_SHIFT);
+        p_dst[i] = (coeff > Q15_MAX) ? Q15_MAX : (int16_t)coeff;
+    }
+}
+
+filtering_functions_error_t fir_decimate_q15_multi_init(fir_decimate_q15_multi_instance_t *instance,
+                                                        uint16_t num_taps, uint8_t divide_ratio,
+                                                        uint8_t channel_count, const int16_t *p_coeffs,
+                                                        int16_t *p_state, uint32_t block_size)
+{
+    if ((num_taps == 0) || (divide_ratio == 0) || (channel_count == 0)) {
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    /* The size of the input block must be a multiple of the decimation factor */
+    if ((block_size % divide_ratio) != 0) {
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    instance->num_taps = num_taps;
+    instance->divide_ratio = divide_ratio;
+    instance->channel_count = channel_count;
+    instance->p_coeffs = p_coeffs;
+    instance->state_stride = num_taps + (block_size - 1U);
+
+    /* Clear the history of every channel. */
+    memset(p_state, 0, FIR_MULTI_STATE_SIZE(num_taps, block_size, channel_count) * sizeof(int16_t));
+    instance->p_state = p_state;
+
+    return FILTERING_FUNCTION_ERR_NONE;
+}
+
+void fir_decimate_q15_multi(const fir_decimate_q15_multi_instance_t *instance, const uint8_t *src, uint8_t *dst,
+                            uint32_t block_size)
+{
+    const fir_sample_format_t *input_format = &instance->input_sample_format;
+    const fir_sample_format_t *output_format = &instance->output_sample_format;
+    const uint32_t num_taps = instance->num_taps;
+    const uint32_t state_stride = instance->state_stride;
+    const uint8_t divide_ratio = instance->divide_ratio;
+    const uint8_t channel_count = instance->channel_count;
+    const uint8_t sample_size_in_byte = input_format->sample_size_byte;
+    const uint8_t sample_size_out_byte = output_format->sample_size_byte;
+    uint32_t block_count = block_size / divide_ratio;
+    uint32_t write_idx = num_taps - 1U; /* Where the next input frame is stored in each channel history */
+    uint32_t read_idx = 0;              /* Oldest history sample of the current output */
+    int16_t *p_state_ch = NULL;
+
+    while (block_count > 0U) {
+        /* Split decimation factor number of interleaved frames in the channel histories. */
+        for (uint8_t i = 0; i < divide_ratio; i++) {
+            p_state_ch = instance->p_state + write_idx;
+            for (uint8_t ch = 0; ch < channel_count; ch++) {
+                *p_state_ch = read_sample(src, input_format);
+                p_state_ch += state_stride;
+                src += sample_size_in_byte;
+            }
+            write_idx++;
+        }
+
+        /* Only the retained output of each group is computed, the discarded ones are never evaluated. */
+        for (uint8_t ch = 0; ch < channel_count; ch++) {
+            write_sample(dst, mac_q15(instance->p_state + (ch * state_stride) + read_idx, instance->p_coeffs, num_taps),
+                         output_format);
+            dst += sample_size_out_byte;
+        }
+
+        read_idx += divide_ratio;
+        block_count--;
+    }
+
+    /* Keep the last (num_taps - 1) samples of every channel for the next call. */
+    for (uint8_t ch = 0; ch < channel_count; ch++) {
+        p_state_ch = instance->p_state + (ch * state_stride);
+        memmove(p_state_ch, p_state_ch + read_idx, (num_taps - 1U) * sizeof(int16_t));
+    }
+}
+
+filtering_functions_error_t fir_interpolate_q15_multi_init(fir_interpolate_q15_multi_instance_t *instance,
+                                                           uint8_t multiply_ratio, uint16_t num_taps,
+                                                           uint8_t channel_count, const int16_t *p_coeffs,
+                                                           int16_t *p_phase_coeffs, int16_t *p_state,
+                                                           uint32_t block_size)
+{
+    uint16_t phase_len = 0;
+
+    if ((num_taps == 0) || (multiply_ratio == 0) || (channel_count == 0)) {
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+
+    /* The filter length must be a multiple of the interpolation factor */
+    if ((num_taps % multiply_ratio) != 0) {
+        return FILTERING_FUNCTION_CFG_ERR;
+    }
+    phase_len = num_taps / multiply_ratio;
+
+    /* Store each polyphase component contiguously so its taps can be fetched in pairs. */
+    for (uint8_t phase = 0; phase < multiply_ratio; phase++) {
+        for (uint16_t k = 0; k < phase_len; k++) {
+            p_phase_coeffs[(phase * phase_len) + k] = p_coeffs[(multiply_ratio - 1U - phase) + (k * multiply_ratio)];
+        }
+    }
+
+    instance->multiply_ratio = multiply_ratio;
+    instance->phase_length = phase_len;
+    instance->channel_count = channel_count;
+    instance->p_phase_coeffs = p_phase_coeffs;
+    instance->state_stride = phase_len + (block_size - 1U);
+
+    /* Clear the history of every channel. */
+    memset(p_state, 0, FIR_MULTI_STATE_SIZE(phase_len, block_size, channel_count) * sizeof(int16_t));
+    instance->p_state = p_state;
+
+    return FILTERING_FUNCTION_ERR_NONE;
+}
+
+void fir_interpolate_q15_multi(const fir_interpolate_q15_multi_instance_t *instance, const uint8_t *src,
+                               uint8_t *dst, uint32_t block_size)
+{
+    const fir_sample_format_t *input_format = &instance->input_sample_format;
+    const fir_sample_format_t *output_format = &instance->output_sample_format;
+    const uint32_t phase_len = instance->phase_length;
+    const uint32_t state_stride = instance->state_stride;
+    const uint8_t multiply_ratio = instance->multiply_ratio;
+    const uint8_t channel_count = instance->channel_count;
+    const uint8_t sample_size_in_byte = input_format->sample_size_byte;
+    const uint8_t sample_size_out_byte = output_format->sample_size_byte;
+    uint32_t block_count = block_size;
+    uint32_t write_idx = phase_len - 1U; /* Where the next input frame is stored in each channel history */
+    uint32_t read_idx = 0;               /* Oldest history sample of the current output */
+    int16_t *p_state_ch = NULL;
+    const int16_t *pb = NULL;
+
+    while (block_count > 0U) {
+        /* Split one interleaved frame in the channel histories. */
+        p_state_ch = instance->p_state + write_idx;
+        for (uint8_t ch = 0; ch < channel_count; ch++) {
+            *p_state_ch = read_sample(src, input_format);
+            p_state_ch += state_stride;
+            src += sample_size_in_byte;
+        }
+        write_idx++;
+
+        /* Each output phase only uses its polyphase component, the stuffed zeros are never multiplied. */
+        pb = instance->p_phase_coeffs;
+        for (uint8_t phase = 0; phase < multiply_ratio; phase++) {
+            for (uint8_t ch = 0; ch < channel_count; ch++) {
+                write_sample(dst, mac_q15(instance->p_state + (ch * state_stride) + read_idx, pb, phase_len),
+                             output_format);
+                dst += sample_size_out_byte;
+            }
+            pb += phase_len;
+        }
+
+        read_idx++;
+        block_count--;
+    }
+
+    /* Keep the last (phase_len - 1) samples of every channel for the next call. */
+    for (uint8_t ch = 0; ch < channel_count; ch++) {
+        p_state_ch = instance->p_state + (ch * state_stride);
+        memmove(p_state_ch, p_state_ch + read_idx, (phase_len - 1U) * sizeof(int16_t));
+    }
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Read an input sample and convert it to 1.15 format.
+ *
+ *  @param[in] src     Points to the input sample.
+ *  @param[in] format  Input sample format.
+ *  @return Sample in 1.15 format.
+ */
+static inline int16_t read_sample(const uint8_t *src, const fir_sample_format_t *format)
+{
+    int32_t sample = (int32_t)((*((const int32_t *)src) & format->sample_mask) << format->sample_bitshift);
+
+    return (int16_t)(sample >> Q31_TO_Q15_SHIFT);
+}
+
+/** @brief Scale an accumulator back to the output format, saturate it and store it.
+ *
+ *  @param[out] dst     Points to the output sample.
+ *  @param[in]  acc     Accumulator in 2.30 format.
+ *  @param[in]  format  Output sample format.
+ */
+static inline void write_sample(uint8_t *dst, int32_t acc, const fir_sample_format_t *format)
+{
+    const int32_t max = (int32_t)((1UL << (format->bit_depth - 1)) - 1);
+    const int32_t min = -max - 1;
+
+    /* The 2.30 accumulator is aligned on the output bit depth: bit_depth - 1 = 31 - sample_bitshift fractional bits. */
+    acc = acc >> (format->sample_bitshift - 1);
+    if (acc > max) {
+        acc = max;
+    } else if (acc < min) {
+        acc = min;
+    }
+    for (uint8_t k = 0; k < format->sample_size_byte; k++) {
+        dst[k] = ((uint8_t *)&acc)[k];
+    }
+}
+
+/** @brief Multiply-accumulate two 1.15 vectors.
+ *
+ *  @param[in] px         Points to the oldest history sample.
+ *  @param[in] pb         Points to the first coefficient.
+ *  @param[in] tap_count  Number of taps.
+ *  @return Accumulator in 2.30 format.
+ */
+static inline int32_t mac_q15(const int16_t *px, const int16_t *pb, uint32_t tap_count)
+{
+    int32_t acc = 0;
+
+#if defined(__ARM_FEATURE_SIMD32) && (__ARM_FEATURE_SIMD32 == 1)
+    int16x2_t x = 0;
+    int16x2_t c = 0;
+
+    /* Two taps per SMLAD. The history is only halfword aligned, memcpy lets the compiler emit an unaligned LDR. */
+    while (tap_count >= 2U) {
+        memcpy(&x, px, sizeof(x));
+        memcpy(&c, pb, sizeof(c));
+        acc = __smlad(x, c, acc);
+        px += 2;
+        pb += 2;
+        tap_count -= 2U;
+    }
+#else
+    while (tap_count >= 2U) {
+        acc += ((int32_t)px[0] * pb[0]) + ((int32_t)px[1] * pb[1]);
+        px += 2;
+        pb += 2;
+        tap_count -= 2U;
+    }
+#endif
+    if (tap_count > 0U) {
+        acc += (int32_t)*px * *pb;
+    }
+
+    return acc;
+}
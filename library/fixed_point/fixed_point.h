@@ -22,6 +22,10 @@ extern "C" {
 /* CONSTANTS ******************************************************************/
 #define FIXED_POINT_TOTAL_NUMBER_OF_BITS 32
 #define FIXED_POINT_SIGN_BIT             1
+/*! Largest Q1.31 value, the closest to 1.0. */
+#define FIXED_POINT_Q31_MAX ((q_num_t)INT32_MAX)
+/*! Number of precision bits of the Q1.31 format. */
+#define FIXED_POINT_Q31_PRECISION 31
 
 /* TYPES **********************************************************************/
 typedef int32_t q_num_t;
@@ -119,6 +123,28 @@ q_num_t fixed_point_sub(q_num_t q_num1, q_num_t q_num2);
  */
 q_num_t fixed_point_multiply(fixed_point_format_t *fixed_point_format, q_num_t q_num1, q_num_t q_num2);
 
+/** @brief Multiply a 32 bits number by a Q1.31 number.
+ *
+ *  The product is rounded to the nearest integer and saturated, the result is bit-exact on every platform. It does not
+ *  depend on a fixed_point_format_t, so it can be inlined in sample processing loops.
+ *
+ *  @param[in] value   Number to multiply, in any Q format.
+ *  @param[in] q31     Factor, in Q1.31 format.
+ *  @return Product, in the Q format of value.
+ */
+static inline int32_t fixed_point_q31_multiply(int32_t value, q_num_t q31)
+{
+    int64_t product = (((int64_t)value * q31) + (1LL << (FIXED_POINT_Q31_PRECISION - 1))) >> FIXED_POINT_Q31_PRECISION;
+
+    if (product > INT32_MAX) {
+        return INT32_MAX;
+    } else if (product < INT32_MIN) {
+        return INT32_MIN;
+    }
+
+    return (int32_t)product;
+}
+
 /** @brief Divided two Q represented number.
  *
  *  @note Result is 32 bits saturated.
@@ -9,24 +9,64 @@
 
 /* INCLUDES *******************************************************************/
 #include "uwb_log.h"
-#include <stdarg.h>
-#include <stdbool.h>
+#include <inttypes.h>
 #include <string.h>
+#include "critical_section.h"
+
+/* CONSTANTS ******************************************************************/
+/* Maximum size of a single conversion specification, with its '*' replaced by their values. */
+#define MAX_SPEC_SIZE 24
 
 /* TYPES **********************************************************************/
-typedef struct log_header {
-    uint32_t ts;
-    uint8_t level;
-} log_header_t;
+/** @brief Argument type expected by a conversion specification.
+ */
+typedef enum arg_kind {
+    /*! No argument, "%%". */
+    ARG_NONE,
+    ARG_INT,
+    ARG_LONG,
+    ARG_LONG_LONG,
+    ARG_INTMAX,
+    ARG_SIZE,
+    ARG_PTRDIFF,
+    ARG_DOUBLE,
+    ARG_POINTER,
+    /*! Conversion that cannot be deferred, the remaining arguments are not recorded. */
+    ARG_UNSUPPORTED,
+} arg_kind_t;
+
+/** @brief Parsed conversion specification.
+ */
+typedef struct conversion {
+    /*! First character of the specification, the '%'. */
+    const char *start;
+    /*! Character following the specification. */
+    const char *end;
+    /*! Number of '*' width and precision, each taking an int argument before the value. */
+    uint8_t star_count;
+    /*! Type of the value argument. */
+    arg_kind_t kind;
+} conversion_t;
 
 /* PRIVATE GLOBALS ************************************************************/
 static const char *const level_str[] = {"TRACE : ", "DEBUG : ", "INFO : ", "WARN : ", "ERROR : ", "FATAL : "};
 
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static void log_deferred(uwb_log_t *log, log_error_t *err, log_level_t level, const char *fmt, va_list args);
+static const char *parse_conversion(const char *fmt, conversion_t *conv);
+static bool format_conversion(const conversion_t *conv, const uwb_log_arg_t *args, char *buffer, size_t size,
+                              size_t *len);
+static size_t format_prefix(const uwb_log_t *log, uint32_t ts, uint8_t level, char *buffer, size_t size);
+static void append(size_t size, size_t *len, int written);
+
 /* PUBLIC FUNCTIONS ***********************************************************/
 
 /** @brief Initialize the log interface
  *
  *  The log and config structure must initialize prior to the function call.
+ *  In deferred mode, log->buffer must hold UWB_LOG_DEFERRED_BUFFER_SIZE() bytes
+ *  and be aligned as a uwb_log_entry_t, the simplest being an array of
+ *  uwb_log_entry_t.
  *
  *  @param[in] log  log struct with buffer and function pointers.
  *  @param[out] config  Configuration structure.
@@ -35,15 +75,19 @@ static const char *const level_str[] = {"TRACE : ", "DEBUG : ", "INFO : ", "WARN
 void uwb_log_init(uwb_log_t *log, log_config_t config)
 {
     log->config = config;
-    uwb_circ_buff_init(&log->circ_buf, log->buffer, log->buf_size, sizeof(char));
+    log->dropped_count = 0;
+    log->reported_dropped_count = 0;
+    spsc_queue_init(&log->queue, log->buffer, (log->buffer != NULL) ? (log->buf_size / sizeof(uwb_log_entry_t)) : 0,
+                    sizeof(uwb_log_entry_t));
 }
 
 /** @brief Write new log.
  *
  *  Print the log to the interface declared in the log structure.
- *  if deferred mode is enabled in the config structure, logs are saved in a
- *  buffer for processor optimization. You need to call sr1000_log_dump later
- *  to empty the buffer. Otherwise, the interface function is called right away
+ *  if deferred mode is enabled in the config structure, the log is recorded
+ *  unformatted in a ring buffer, you need to call uwb_log_dump later to
+ *  format and output it. When the ring buffer is full, the log is dropped
+ *  and counted. Otherwise, the interface function is called right away
  *  to output the log string.
  *
  *  @param[in]  log   Log struct.
@@ -61,47 +105,20 @@ void uwb_log_init(uwb_log_t *log, log_config_t config)
 void uwb_vlog(uwb_log_t *log, log_error_t *err, log_level_t level, const char *fmt, va_list args)
 {
     char log_buf[MAX_LOG_SIZE];
-    circ_buff_error_t cb_err = CIRC_BUFF_ERR_NONE;
     size_t str_size = 0;
-    uint32_t ts = 0;
 
     *err = LOG_ERR_NONE;
 
     if ((bool)log->config.enabled && (level >= log->config.level)) {
         if ((bool)log->config.deferred) {
-            log_header_t log_header;
-
-            log_header.level = level;
-            log_header.ts = log->timestamp();
-            str_size = vsnprintf(log_buf, MAX_LOG_SIZE, fmt, args);
-            uwb_circ_buff_in(&log->circ_buf, &log_header.level, sizeof(log_header.level), &cb_err);
-            uwb_circ_buff_in(&log->circ_buf, &log_header.ts, sizeof(log_header.ts), &cb_err);
-
-            if (cb_err != CIRC_BUFF_ERR_NONE) {
-                *err = LOG_ERR_BUFFER_ACCESS;
-                return;
-            }
-
-            for (size_t i = 0; i <= str_size; i++) {
-                uwb_circ_buff_in(&log->circ_buf, &log_buf[i], sizeof(char), &cb_err);
-
-                if (cb_err != CIRC_BUFF_ERR_NONE) {
-                    *err = LOG_ERR_BUFFER_ACCESS;
-                    return;
-                }
-            }
+            log_deferred(log, err, level, fmt, args);
         } else {
-            if ((bool)log->config.timestamp) {
-                ts = log->timestamp();
-                str_size += snprintf(log_buf + str_size, MAX_LOG_SIZE - str_size, "[%lu.%.3lu] ", ts / log->config.freq,
-                                     ts % log->config.freq);
-            }
-
-            str_size += snprintf(log_buf + str_size, MAX_LOG_SIZE - str_size, "%s", level_str[level]);
-            str_size += vsnprintf(log_buf + str_size, MAX_LOG_SIZE - str_size, fmt, args);
+            str_size = format_prefix(log, (bool)log->config.timestamp ? log->timestamp() : 0, level, log_buf,
+                                     MAX_LOG_SIZE);
+            append(MAX_LOG_SIZE, &str_size, vsnprintf(log_buf + str_size, MAX_LOG_SIZE - str_size, fmt, args));
 
             if ((bool)log->config.new_line) {
-                snprintf(log_buf + str_size, MAX_LOG_SIZE - str_size, "\n\r");
+                append(MAX_LOG_SIZE, &str_size, snprintf(log_buf + str_size, MAX_LOG_SIZE - str_size, "\n\r"));
             }
 
             log->io(log_buf);
@@ -112,10 +129,10 @@ void uwb_vlog(uwb_log_t *log, log_error_t *err, log_level_t level, const char *f
 /** @brief Write new log.
  *
  *  Print the log to the interface declared in the log structure.
- *  if deferred mode is enabled in the config structure, logs are saved in a
- *  buffer for processor optimization. You need to call sr1000_log_dump later
- *  to empty the buffer. Otherwise, the interface function is called right away
- *  to output the log string.
+ *  if deferred mode is enabled in the config structure, the log is recorded
+ *  unformatted in a ring buffer, you need to call uwb_log_dump later to
+ *  format and output it. Otherwise, the interface function is called right
+ *  away to output the log string.
  *
  *  @param[in]  log   Log struct.
  *  @param[out] err   Pointer that receive an error code.
@@ -140,8 +157,9 @@ void uwb_log(uwb_log_t *log, log_error_t *err, log_level_t level, const char *fm
 
 /** @brief Output log when deferred mode is enabled
  *
- *  This function output one log from the log buffer. Do not
- *  use it if deferred mode is not enabled
+ *  This function formats and outputs one log from the log buffer. When logs
+ *  were dropped since the last call, a warning with the number of dropped
+ *  logs is output first. Do not use it if deferred mode is not enabled.
  *
  *  @param[in]  log   Log struct.
  *  @param[out] err   Pointer that receive an error code.
@@ -149,10 +167,9 @@ void uwb_log(uwb_log_t *log, log_error_t *err, log_level_t level, const char *fm
  */
 bool uwb_log_dump(uwb_log_t *log, log_error_t *err)
 {
-    log_header_t log_header = {0};
-    size_t str_size = 0;
-    circ_buff_error_t cb_err = CIRC_BUFF_ERR_NONE;
-    char log_buf[MAX_LOG_SIZE] = {0};
+    char log_buf[MAX_LOG_SIZE];
+    uwb_log_entry_t *entry;
+    uint32_t dropped_count = log->dropped_count;
 
     *err = LOG_ERR_NONE;
 
@@ -161,37 +178,75 @@ bool uwb_log_dump(uwb_log_t *log, log_error_t *err)
         return false;
     }
 
-    uwb_circ_buff_out(&log->circ_buf, &log_header.level, sizeof(log_header.level), &cb_err);
-    uwb_circ_buff_out(&log->circ_buf, &log_header.ts, sizeof(log_header.ts), &cb_err);
+    if (dropped_count != log->reported_dropped_count) {
+        snprintf(log_buf, MAX_LOG_SIZE, "%s%" PRIu32 " log(s) dropped%s", level_str[WARN],
+                 dropped_count - log->reported_dropped_count, (bool)log->config.new_line ? "\n\r" : "");
+        log->reported_dropped_count = dropped_count;
+        log->io(log_buf);
+    }
 
-    if (cb_err != CIRC_BUFF_ERR_NONE) {
-        *err = LOG_ERR_BUFFER_ACCESS;
+    entry = spsc_queue_front(&log->queue);
+    if (entry == NULL) {
         return false;
     }
+    uwb_log_format_entry(log, entry, log_buf, MAX_LOG_SIZE);
+    spsc_queue_dequeue(&log->queue);
 
-    if ((bool)log->config.timestamp) {
-        str_size += snprintf(log_buf + str_size, MAX_LOG_SIZE - str_size, "[%lu.%.3lu] ",
-                             log_header.ts / log->config.freq, log_header.ts % log->config.freq);
+    log->io(log_buf);
+
+    return !spsc_queue_is_empty(&log->queue);
+}
+
+/** @brief Format a deferred log.
+ *
+ *  This is the formatting done by uwb_log_dump, it can also be used on a log
+ *  read from a memory dump, provided the format string and %s argument
+ *  pointers are valid in the formatting context.
+ *
+ *  @param[in]  log     Log struct, for its configuration.
+ *  @param[in]  entry   Deferred log.
+ *  @param[out] buffer  Buffer where to put the formatted string.
+ *  @param[in]  size    Size of the buffer.
+ *  @return The formatted string length, excluding the NULL terminator.
+ */
+size_t uwb_log_format_entry(const uwb_log_t *log, const uwb_log_entry_t *entry, char *buffer, size_t size)
+{
+    const char *fmt = entry->fmt;
+    const char *percent;
+    conversion_t conv;
+    uint8_t arg_index = 0;
+    size_t str_size;
+
+    if (size == 0) {
+        return 0;
     }
 
-    str_size += snprintf(log_buf + str_size, MAX_LOG_SIZE - str_size, "%s", level_str[log_header.level]);
+    str_size = format_prefix(log, entry->ts, entry->level, buffer, size);
 
-    do {
-        uwb_circ_buff_out(&log->circ_buf, &log_buf[str_size], sizeof(char), &cb_err);
+    while ((percent = strchr(fmt, '%')) != NULL) {
+        append(size, &str_size,
+               snprintf(buffer + str_size, size - str_size, "%.*s", (int)(percent - fmt), fmt));
+        fmt = parse_conversion(percent, &conv);
 
-        if (cb_err != CIRC_BUFF_ERR_NONE) {
-            *err = LOG_ERR_BUFFER_ACCESS;
-            return false;
+        if (conv.kind == ARG_NONE) {
+            append(size, &str_size, snprintf(buffer + str_size, size - str_size, "%%"));
+            continue;
         }
-    } while (log_buf[str_size++] != 0);
-
-    if (log->config.new_line) {
-        snprintf(log_buf + str_size - 1, MAX_LOG_SIZE - str_size, "\n\r");
+        if ((conv.kind == ARG_UNSUPPORTED) || (arg_index + conv.star_count + 1 > entry->arg_count) ||
+            !format_conversion(&conv, &entry->args[arg_index], buffer, size, &str_size)) {
+            /* Argument not recorded, output the rest of the format string as is */
+            fmt = percent;
+            break;
+        }
+        arg_index += conv.star_count + 1;
     }
+    append(size, &str_size, snprintf(buffer + str_size, size - str_size, "%s", fmt));
 
-    log->io(log_buf);
+    if ((bool)log->config.new_line) {
+        append(size, &str_size, snprintf(buffer + str_size, size - str_size, "\n\r"));
+    }
 
-    return !(log->circ_buf.buf_empty);
+    return str_size;
 }
 
 /** @brief Set the logging level output
@@ -209,3 +264,291 @@ void uwb_log_set_level(uwb_log_t *log, log_level_t level)
 {
     log->config.level = level;
 }
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Record a log in the deferred mode buffer.
+ *
+ *  The format string is only scanned for its conversion specifications, to pull the arguments with their type. The
+ *  log is built on the stack, then copied in the ring buffer in a critical section, as the ring buffer only supports a
+ *  single producer while logs can come from several contexts at different interrupt priorities.
+ *
+ *  @param[in]  log    Log struct.
+ *  @param[out] err    Pointer that receive an error code.
+ *  @param[in]  level  Log level.
+ *  @param[in]  fmt    Format string.
+ *  @param[in]  args   Arguments for the string.
+ */
+static void log_deferred(uwb_log_t *log, log_error_t *err, log_level_t level, const char *fmt, va_list args)
+{
+    uwb_log_entry_t entry;
+    uwb_log_entry_t *slot;
+    const char *percent = fmt;
+    conversion_t conv;
+    uint8_t arg_count = 0;
+
+    entry.fmt = fmt;
+    entry.ts = (bool)log->config.timestamp ? log->timestamp() : 0;
+    entry.level = level;
+
+    while ((percent = strchr(percent, '%')) != NULL) {
+        percent = parse_conversion(percent, &conv);
+        if (conv.kind == ARG_NONE) {
+            continue;
+        }
+        if ((conv.kind == ARG_UNSUPPORTED) || (arg_count + conv.star_count + 1 > UWB_LOG_MAX_ARGS)) {
+            break;
+        }
+        for (uint8_t i = 0; i < conv.star_count; i++) {
+            entry.args[arg_count++].i = (unsigned int)va_arg(args, int);
+        }
+        switch (conv.kind) {
+        case ARG_LONG:
+            entry.args[arg_count].l = va_arg(args, unsigned long);
+            break;
+        case ARG_LONG_LONG:
+            entry.args[arg_count].ll = va_arg(args, unsigned long long);
+            break;
+        case ARG_INTMAX:
+            entry.args[arg_count].j = va_arg(args, uintmax_t);
+            break;
+        case ARG_SIZE:
+            entry.args[arg_count].z = va_arg(args, size_t);
+            break;
+        case ARG_PTRDIFF:
+            entry.args[arg_count].t = va_arg(args, ptrdiff_t);
+            break;
+        case ARG_DOUBLE:
+            entry.args[arg_count].d = va_arg(args, double);
+            break;
+        case ARG_POINTER:
+            entry.args[arg_count].p = va_arg(args, const void *);
+            break;
+        case ARG_INT:
+        default:
+            entry.args[arg_count].i = va_arg(args, unsigned int);
+            break;
+        }
+        arg_count++;
+    }
+    entry.arg_count = arg_count;
+
+    CRITICAL_SECTION_ENTER();
+    slot = spsc_queue_get_free_slot(&log->queue);
+    if (slot != NULL) {
+        memcpy(slot, &entry, offsetof(uwb_log_entry_t, args) + (arg_count * sizeof(uwb_log_arg_t)));
+        spsc_queue_enqueue(&log->queue);
+    } else {
+        log->dropped_count++;
+    }
+    CRITICAL_SECTION_EXIT();
+
+    if (slot == NULL) {
+        *err = LOG_ERR_BUFFER_FULL;
+    }
+}
+
+/** @brief Parse a conversion specification.
+ *
+ *  @param[in]  fmt   Conversion specification, starting with its '%'.
+ *  @param[out] conv  Parsed conversion specification.
+ *  @return The character following the conversion specification.
+ */
+static const char *parse_conversion(const char *fmt, conversion_t *conv)
+{
+    uint8_t long_count = 0;
+    char modifier = 0;
+
+    conv->start = fmt++;
+    conv->star_count = 0;
+    conv->kind = ARG_UNSUPPORTED;
+
+    /* Flags */
+    while ((*fmt != '\0') && (strchr("-+ #0", *fmt) != NULL)) {
+        fmt++;
+    }
+    /* Width and precision */
+    while ((*fmt == '*') || (*fmt == '.') || ((*fmt >= '0') && (*fmt <= '9'))) {
+        if (*fmt == '*') {
+            conv->star_count++;
+        }
+        fmt++;
+    }
+    /* Length modifier */
+    while ((*fmt != '\0') && (strchr("hljztL", *fmt) != NULL)) {
+        modifier = *fmt;
+        long_count += (*fmt == 'l');
+        fmt++;
+    }
+
+    switch (*fmt) {
+    case '%':
+        conv->kind = ARG_NONE;
+        break;
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'c':
+        if (long_count >= 2) {
+            conv->kind = ARG_LONG_LONG;
+        } else if (long_count == 1) {
+            conv->kind = ARG_LONG;
+        } else if (modifier == 'j') {
+            conv->kind = ARG_INTMAX;
+        } else if (modifier == 'z') {
+            conv->kind = ARG_SIZE;
+        } else if (modifier == 't') {
+            conv->kind = ARG_PTRDIFF;
+        } else if (modifier != 'L') {
+            conv->kind = ARG_INT;
+        }
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        if (modifier != 'L') {
+            conv->kind = ARG_DOUBLE;
+        }
+        break;
+    case 's':
+    case 'p':
+        if (long_count == 0) {
+            conv->kind = ARG_POINTER;
+        }
+        break;
+    default:
+        break;
+    }
+    if (*fmt != '\0') {
+        fmt++;
+    }
+    conv->end = fmt;
+
+    return fmt;
+}
+
+/** @brief Format a conversion specification with its recorded arguments.
+ *
+ *  @param[in]    conv    Parsed conversion specification.
+ *  @param[in]    args    Recorded arguments of the conversion, its '*' values first.
+ *  @param[out]   buffer  Output buffer.
+ *  @param[in]    size    Size of the output buffer.
+ *  @param[inout] len     Length of the output string.
+ *  @retval true   Conversion is formatted.
+ *  @retval false  Conversion specification is too long to be formatted.
+ */
+static bool format_conversion(const conversion_t *conv, const uwb_log_arg_t *args, char *buffer, size_t size,
+                              size_t *len)
+{
+    char spec[MAX_SPEC_SIZE];
+    size_t spec_len = 0;
+    uint8_t star_index = 0;
+    int written = 0;
+
+    /* Replace the '*' by their recorded values, vsnprintf cannot be given a rebuilt va_list */
+    for (const char *c = conv->start; c < conv->end; c++) {
+        if (spec_len + 1 >= sizeof(spec)) {
+            return false;
+        }
+        if (*c != '*') {
+            spec[spec_len++] = *c;
+            continue;
+        }
+        int star = (int)args[star_index++].i;
+
+        if ((star < 0) && (c[-1] == '.')) {
+            /* A negative precision is taken as if the precision were omitted */
+            spec_len--;
+            continue;
+        }
+        written = snprintf(&spec[spec_len], sizeof(spec) - spec_len, "%d", star);
+        if ((written < 0) || ((size_t)written >= sizeof(spec) - spec_len)) {
+            return false;
+        }
+        spec_len += (size_t)written;
+    }
+    spec[spec_len] = '\0';
+
+    buffer += *len;
+    size -= *len;
+    args += star_index;
+    switch (conv->kind) {
+    case ARG_LONG:
+        written = snprintf(buffer, size, spec, args->l);
+        break;
+    case ARG_LONG_LONG:
+        written = snprintf(buffer, size, spec, args->ll);
+        break;
+    case ARG_INTMAX:
+        written = snprintf(buffer, size, spec, args->j);
+        break;
+    case ARG_SIZE:
+        written = snprintf(buffer, size, spec, args->z);
+        break;
+    case ARG_PTRDIFF:
+        written = snprintf(buffer, size, spec, args->t);
+        break;
+    case ARG_DOUBLE:
+        written = snprintf(buffer, size, spec, args->d);
+        break;
+    case ARG_POINTER:
+        written = snprintf(buffer, size, spec, args->p);
+        break;
+    case ARG_INT:
+    default:
+        written = snprintf(buffer, size, spec, args->i);
+        break;
+    }
+    append(size + *len, len, written);
+
+    return true;
+}
+
+/** @brief Format the timestamp and level prefix of a log.
+ *
+ *  @param[in]  log     Log struct.
+ *  @param[in]  ts      Log timestamp.
+ *  @param[in]  level   Log level.
+ *  @param[out] buffer  Output buffer.
+ *  @param[in]  size    Size of the output buffer.
+ *  @return The prefix length.
+ */
+static size_t format_prefix(const uwb_log_t *log, uint32_t ts, uint8_t level, char *buffer, size_t size)
+{
+    size_t str_size = 0;
+
+    buffer[0] = '\0';
+    if ((bool)log->config.timestamp) {
+        append(size, &str_size,
+               snprintf(buffer, size, "[%" PRIu32 ".%.3" PRIu32 "] ", ts / log->config.freq, ts % log->config.freq));
+    }
+    if (level <= FATAL) {
+        append(size, &str_size, snprintf(buffer + str_size, size - str_size, "%s", level_str[level]));
+    }
+
+    return str_size;
+}
+
+/** @brief Account for a string appended to a buffer, clamping to the buffer size on truncation.
+ *
+ *  @param[in]    size     Size of the output buffer.
+ *  @param[inout] len      Length of the output string.
+ *  @param[in]    written  Return value of the snprintf call that appended the string.
+ */
+static void append(size_t size, size_t *len, int written)
+{
+    if (written <= 0) {
+        return;
+    }
+    *len += (size_t)written;
+    if (*len >= size) {
+        *len = size - 1;
+    }
+}
@@ -1,6 +1,21 @@
 /** @file  uwb_log.h
  *  @brief Logging system.
  *
+ *  In immediate mode, a log is formatted and output through the io function right away. In deferred mode, a log only
+ *  records its timestamp, its format string pointer and its raw arguments in a ring buffer, which does not depend on
+ *  the formatting, so it can be called from time critical contexts such as the radio and audio callbacks. The logs are
+ *  then formatted and output from the main loop with uwb_log_dump().
+ *
+ *  Deferred mode constraints:
+ *      The format string and the arguments of %s conversions are stored by pointer, they must stay valid until the
+ *      log is dumped (string literals and constant strings).
+ *      At most UWB_LOG_MAX_ARGS arguments are recorded per log, the conversions beyond are output verbatim.
+ *      Long double arguments (%Lf) are not supported.
+ *      Any context may log in deferred mode, at any interrupt priority: a log is built on the stack, then copied in
+ *      the ring buffer within a short critical section, the ring buffer being a single-producer queue. The log is
+ *      therefore recorded at the end of the call and the logs of preempted contexts may be out of timestamp order.
+ *      Only one context may dump, uwb_log_dump() being the single consumer of the ring buffer.
+ *
  *  @copyright Copyright (C) 2020-2021 SPARK Microsystems International Inc.
  *  @license   This source code is proprietary and subject to the SPARK Microsystems
  *             Software EULA found in this package in file EULA.txt.
@@ -10,9 +25,12 @@
 #define UWB_LOG_H_
 
 /* INCLUDES *******************************************************************/
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
-#include "uwb_circular_buffer.h"
+#include "spsc_queue.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,11 +41,21 @@ extern "C" {
 #define MAX_LOG_SIZE 128
 #endif
 
+/*! Maximum number of arguments recorded per log in deferred mode, a '*' width or precision counts as one. */
+#ifndef UWB_LOG_MAX_ARGS
+#define UWB_LOG_MAX_ARGS 6
+#endif
+
+/*! Size of the deferred mode buffer holding a given number of logs, the number of logs must be a power of two. */
+#define UWB_LOG_DEFERRED_BUFFER_SIZE(log_count) ((log_count) * sizeof(uwb_log_entry_t))
+
 /* TYPES **********************************************************************/
 typedef enum log_error {
     LOG_ERR_NONE = 0,
     LOG_ERR_BUFFER_ACCESS,
-    LOG_ERR_DEFERRED_DISABLED
+    LOG_ERR_DEFERRED_DISABLED,
+    /*! The deferred mode buffer is full, the log is dropped. */
+    LOG_ERR_BUFFER_FULL
 } log_error_t;
 
 typedef enum level {
@@ -48,13 +76,57 @@ typedef struct {
     uint16_t freq;
 } log_config_t;
 
+/** @brief Raw argument of a deferred log.
+ */
+typedef union uwb_log_arg {
+    /*! Argument of a conversion without length modifier, or with the hh or h modifier. */
+    unsigned int i;
+    /*! Argument of a conversion with the l modifier. */
+    unsigned long l;
+    /*! Argument of a conversion with the ll modifier. */
+    unsigned long long ll;
+    /*! Argument of a conversion with the j modifier. */
+    uintmax_t j;
+    /*! Argument of a conversion with the z modifier. */
+    size_t z;
+    /*! Argument of a conversion with the t modifier. */
+    ptrdiff_t t;
+    /*! Argument of a floating point conversion. */
+    double d;
+    /*! Argument of a %s or %p conversion. */
+    const void *p;
+} uwb_log_arg_t;
+
+/** @brief Deferred log, as stored in the deferred mode buffer.
+ */
+typedef struct uwb_log_entry {
+    /*! Format string. */
+    const char *fmt;
+    /*! Timestamp. */
+    uint32_t ts;
+    /*! Log level. */
+    uint8_t level;
+    /*! Number of recorded arguments. */
+    uint8_t arg_count;
+    /*! Raw arguments, in the order of the format string. */
+    uwb_log_arg_t args[UWB_LOG_MAX_ARGS];
+} uwb_log_entry_t;
+
 typedef struct {
     log_config_t config;
-    circ_buffer_t circ_buf;
-    char *buffer;
+    /*! Deferred logs ring buffer. */
+    spsc_queue_t queue;
+    /*! Deferred mode buffer, of UWB_LOG_DEFERRED_BUFFER_SIZE() bytes and aligned as a uwb_log_entry_t. */
+    void *buffer;
     uint16_t buf_size;
     uint32_t (*timestamp)(void);
     void (*io)(char *message);
+    /*! Number of deferred logs dropped because the buffer was full, written by the logging contexts in a critical
+     *  section.
+     */
+    volatile uint32_t dropped_count;
+    /*! Number of dropped logs already reported by uwb_log_dump(). */
+    uint32_t reported_dropped_count;
 } uwb_log_t;
 
 /* PUBLIC FUNCTION PROTOTYPES *************************************************/
@@ -62,6 +134,7 @@ void uwb_log_init(uwb_log_t *log, log_config_t config);
 void uwb_vlog(uwb_log_t *log, log_error_t *err, log_level_t level, const char *fmt, va_list args);
 void uwb_log(uwb_log_t *log, log_error_t *err, log_level_t level, const char *fmt, ...);
 bool uwb_log_dump(uwb_log_t *log, log_error_t *err);
+size_t uwb_log_format_entry(const uwb_log_t *log, const uwb_log_entry_t *entry, char *buffer, size_t size);
 void uwb_log_set_level(uwb_log_t *log, log_level_t level);
 
 #ifdef __cplusplus
@@ -18,34 +18,121 @@ void mem_pool_init(mem_pool_t *mem_pool, uint8_t *pool, size_t meme_pool_size)
     mem_pool->free_bytes = mem_pool->capacity;
     mem_pool->mem_pool_it = mem_pool->mem_pool_begin;
     mem_pool->mem_pool_end = mem_pool->mem_pool_begin + mem_pool->capacity;
+    mem_pool->name = NULL;
+    mem_pool->high_water_mark = 0;
+    mem_pool->padding_bytes = 0;
+    mem_pool->allocation_count = 0;
+    mem_pool->failed_allocation_count = 0;
+}
+
+void mem_pool_set_name(mem_pool_t *mem_pool, const char *name)
+{
+    mem_pool->name = name;
 }
 
 void *mem_pool_malloc(mem_pool_t *mem_pool, size_t wanted_size)
 {
-    void *ptr_ret = NULL;
+    return mem_pool_malloc_aligned(mem_pool, wanted_size, MEM_POOL_DEFAULT_ALIGNMENT, 0);
+}
+
+void *mem_pool_malloc_no_zero(mem_pool_t *mem_pool, size_t wanted_size)
+{
+    return mem_pool_malloc_aligned(mem_pool, wanted_size, MEM_POOL_DEFAULT_ALIGNMENT, MEM_POOL_FLAG_NO_ZERO);
+}
+
+void *mem_pool_malloc_aligned(mem_pool_t *mem_pool, size_t wanted_size, size_t alignment, uint32_t flags)
+{
+    uint8_t *ptr_ret;
+    size_t padding;
+    uint32_t allocated_bytes;
+
+    if ((alignment == 0) || ((alignment & (alignment - 1)) != 0)) {
+        mem_pool->failed_allocation_count++;
+        return NULL;
+    }
+
+    padding = (alignment - ((uintptr_t)mem_pool->mem_pool_it & (alignment - 1))) & (alignment - 1);
+    if ((padding > mem_pool->free_bytes) || (wanted_size > (mem_pool->free_bytes - padding))) {
+        mem_pool->failed_allocation_count++;
+        return NULL;
+    }
 
-    if (wanted_size & (sizeof(void *) - 1)) {
-        wanted_size += (sizeof(uint32_t) - (wanted_size & (sizeof(void *) - 1)));
+    ptr_ret = mem_pool->mem_pool_it + padding;
+    if ((flags & MEM_POOL_FLAG_NO_ZERO) == 0) {
+        memset(ptr_ret, 0, wanted_size);
     }
+    mem_pool->mem_pool_it = ptr_ret + wanted_size;
+    mem_pool->free_bytes -= (uint32_t)(padding + wanted_size);
+    mem_pool->padding_bytes += (uint32_t)padding;
+    mem_pool->allocation_count++;
 
-    if (wanted_size <= mem_pool->free_bytes) {
-        ptr_ret = mem_pool->mem_pool_it;
-        memset(mem_pool->mem_pool_it, 0, wanted_size);
-        mem_pool->mem_pool_it += wanted_size;
-        mem_pool->free_bytes -= wanted_size;
+    allocated_bytes = mem_pool->capacity - mem_pool->free_bytes;
+    if (allocated_bytes > mem_pool->high_water_mark) {
+        mem_pool->high_water_mark = allocated_bytes;
     }
 
     return ptr_ret;
 }
 
+mem_pool_t *mem_pool_create_arena(mem_pool_t *mem_pool, mem_pool_t *arena, const char *name, size_t arena_size)
+{
+    /* The arena zero-fills its own allocations. */
+    uint8_t *pool = mem_pool_malloc_no_zero(mem_pool, arena_size);
+
+    if (pool == NULL) {
+        return NULL;
+    }
+    mem_pool_init(arena, pool, arena_size);
+    mem_pool_set_name(arena, name);
+
+    return arena;
+}
+
 void mem_pool_free(mem_pool_t *mem_pool)
 {
     mem_pool->free_bytes = mem_pool->capacity;
     mem_pool->mem_pool_it = mem_pool->mem_pool_begin;
     mem_pool->mem_pool_end = mem_pool->mem_pool_begin + mem_pool->capacity;
+    mem_pool->padding_bytes = 0;
+    mem_pool->allocation_count = 0;
+}
+
+mem_pool_mark_t mem_pool_get_mark(const mem_pool_t *mem_pool)
+{
+    mem_pool_mark_t mark = {
+        .mem_pool_it = mem_pool->mem_pool_it,
+        .padding_bytes = mem_pool->padding_bytes,
+        .allocation_count = mem_pool->allocation_count,
+    };
+
+    return mark;
+}
+
+void mem_pool_rewind(mem_pool_t *mem_pool, mem_pool_mark_t mark)
+{
+    if ((mark.mem_pool_it < mem_pool->mem_pool_begin) || (mark.mem_pool_it > mem_pool->mem_pool_it)) {
+        return;
+    }
+
+    mem_pool->free_bytes = (uint32_t)(mem_pool->mem_pool_end - mark.mem_pool_it);
+    mem_pool->mem_pool_it = mark.mem_pool_it;
+    mem_pool->padding_bytes = mark.padding_bytes;
+    mem_pool->allocation_count = mark.allocation_count;
 }
 
 uint32_t mem_pool_get_allocated_bytes(mem_pool_t *mem_pool)
 {
     return (mem_pool->capacity - mem_pool->free_bytes);
 }
+
+void mem_pool_get_stats(const mem_pool_t *mem_pool, mem_pool_stats_t *stats)
+{
+    stats->name = mem_pool->name;
+    stats->capacity = mem_pool->capacity;
+    stats->allocated_bytes = mem_pool->capacity - mem_pool->free_bytes;
+    stats->free_bytes = mem_pool->free_bytes;
+    stats->high_water_mark = mem_pool->high_water_mark;
+    stats->padding_bytes = mem_pool->padding_bytes;
+    stats->allocation_count = mem_pool->allocation_count;
+    stats->failed_allocation_count = mem_pool->failed_allocation_count;
+}
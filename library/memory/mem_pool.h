@@ -1,6 +1,16 @@
 /** @file  mem_pool.h
  *  @brief Memory management for the SDK.
  *
+ *  The memory pool is a bump allocator over a static array. Memory is handed out in allocation order and is given back
+ *  either wholesale with mem_pool_free() or down to a checkpoint taken with mem_pool_get_mark() with
+ *  mem_pool_rewind().
+ *
+ *  A named child arena can be carved out of a pool with mem_pool_create_arena(). The arena is itself a memory pool, it
+ *  can be handed to a subsystem and freed or rewound independently of the other subsystems sharing the parent pool.
+ *
+ *  Every pool keeps its own usage statistics. The high-water mark survives mem_pool_free() and mem_pool_rewind(), so it
+ *  gives the pool size actually needed by an application across its reconfigurations.
+ *
  *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc.
  *  @license   This source code is proprietary and subject to the SPARK Microsystems
  *             Software EULA found in this package in file EULA.txt.
@@ -18,6 +28,20 @@
 extern "C" {
 #endif
 
+/* CONSTANTS ******************************************************************/
+/*! Alignment of the blocks returned by mem_pool_malloc(). */
+#define MEM_POOL_DEFAULT_ALIGNMENT sizeof(void *)
+
+/*! Allocation flag, the block is not zero-filled. */
+#define MEM_POOL_FLAG_NO_ZERO (1 << 0)
+
+/*! Number of pool bytes taken by a block of mem_pool_malloc() followed by other blocks, padding included. */
+#define MEM_POOL_BLOCK_SIZE(size) \
+    ((((size) + MEM_POOL_DEFAULT_ALIGNMENT - 1) / MEM_POOL_DEFAULT_ALIGNMENT) * MEM_POOL_DEFAULT_ALIGNMENT)
+
+/*! Pool size holding blocks of a given total size, the pool array start being aligned on a byte boundary only. */
+#define MEM_POOL_SIZE_NEEDED(total_block_size) ((total_block_size) + MEM_POOL_DEFAULT_ALIGNMENT - 1)
+
 /* TYPES **********************************************************************/
 typedef struct {
     uint8_t *mem_pool_begin;
@@ -25,8 +49,50 @@ typedef struct {
     uint32_t free_bytes;
     uint8_t *mem_pool_end;
     uint8_t *mem_pool_it;
+    /*! Pool name, used to tell apart the arenas in reports. */
+    const char *name;
+    /*! Highest number of bytes allocated since the initialization. */
+    uint32_t high_water_mark;
+    /*! Number of bytes lost to alignment padding by the current allocations. */
+    uint32_t padding_bytes;
+    /*! Number of current allocations. */
+    uint32_t allocation_count;
+    /*! Number of allocations that did not fit since the initialization. */
+    uint32_t failed_allocation_count;
 } mem_pool_t;
 
+/** @brief Memory pool checkpoint.
+ */
+typedef struct {
+    /*! Allocation pointer. */
+    uint8_t *mem_pool_it;
+    /*! Number of bytes lost to alignment padding. */
+    uint32_t padding_bytes;
+    /*! Number of allocations. */
+    uint32_t allocation_count;
+} mem_pool_mark_t;
+
+/** @brief Memory pool usage statistics.
+ */
+typedef struct {
+    /*! Pool name, NULL if it is not named. */
+    const char *name;
+    /*! Pool size, in bytes. */
+    uint32_t capacity;
+    /*! Number of bytes allocated, padding included. */
+    uint32_t allocated_bytes;
+    /*! Number of bytes left, they are contiguous. */
+    uint32_t free_bytes;
+    /*! Highest number of bytes allocated since the initialization. */
+    uint32_t high_water_mark;
+    /*! Number of allocated bytes lost to alignment padding, the only fragmentation of the pool. */
+    uint32_t padding_bytes;
+    /*! Number of current allocations. */
+    uint32_t allocation_count;
+    /*! Number of allocations that did not fit since the initialization. */
+    uint32_t failed_allocation_count;
+} mem_pool_stats_t;
+
 /* PUBLIC FUNCTIONS ***********************************************************/
 /** @brief Memory pool module initialization.
  *
@@ -36,7 +102,16 @@ typedef struct {
  */
 void mem_pool_init(mem_pool_t *mem_pool, uint8_t *pool, size_t meme_pool_size);
 
+/** @brief Set the name of a memory pool.
+ *
+ *  @param[in] mem_pool  Memory pool handler.
+ *  @param[in] name      Pool name, must stay valid for the pool lifetime.
+ */
+void mem_pool_set_name(mem_pool_t *mem_pool, const char *name);
+
 /** @brief Memory pool allocation.
+ *
+ *  The block is zero-filled and aligned on MEM_POOL_DEFAULT_ALIGNMENT.
  *
  *  @param[in] mem_pool     Memory pool handler.
  *  @param[in] wanted_size  User wanted size.
@@ -44,12 +119,61 @@ void mem_pool_init(mem_pool_t *mem_pool, uint8_t *pool, size_t meme_pool_size);
  */
 void *mem_pool_malloc(mem_pool_t *mem_pool, size_t wanted_size);
 
+/** @brief Memory pool allocation without zero-fill.
+ *
+ *  To be used for buffers that are fully written before being read.
+ *
+ *  @param[in] mem_pool     Memory pool handler.
+ *  @param[in] wanted_size  User wanted size.
+ *  @return Pointer to first element of asked memory, NULL if it does not fit.
+ */
+void *mem_pool_malloc_no_zero(mem_pool_t *mem_pool, size_t wanted_size);
+
+/** @brief Memory pool allocation with a given alignment.
+ *
+ *  @param[in] mem_pool     Memory pool handler.
+ *  @param[in] wanted_size  User wanted size.
+ *  @param[in] alignment    Block alignment, in bytes, must be a power of two.
+ *  @param[in] flags        Allocation flags, a combination of MEM_POOL_FLAG_* values.
+ *  @return Pointer to first element of asked memory, NULL if it does not fit or the alignment is invalid.
+ */
+void *mem_pool_malloc_aligned(mem_pool_t *mem_pool, size_t wanted_size, size_t alignment, uint32_t flags);
+
+/** @brief Carve a named child arena out of a memory pool.
+ *
+ *  The arena is initialized as an empty memory pool of arena_size bytes. It stays allocated in the parent pool until
+ *  the parent is freed or rewound before it, the arena must then not be used anymore.
+ *
+ *  @param[in]  mem_pool    Parent memory pool handler.
+ *  @param[out] arena       Arena handler.
+ *  @param[in]  name        Arena name, must stay valid for the arena lifetime.
+ *  @param[in]  arena_size  Arena size, in bytes.
+ *  @return Pointer to the arena handler, NULL if it does not fit in the parent pool.
+ */
+mem_pool_t *mem_pool_create_arena(mem_pool_t *mem_pool, mem_pool_t *arena, const char *name, size_t arena_size);
+
 /** @brief Free every bloc of memory previously allocated.
  *
  *  @param[in] mem_pool  Memory pool handler.
  */
 void mem_pool_free(mem_pool_t *mem_mang);
 
+/** @brief Get a checkpoint of the memory pool.
+ *
+ *  @param[in] mem_pool  Memory pool handler.
+ *  @return Checkpoint, to be given to mem_pool_rewind().
+ */
+mem_pool_mark_t mem_pool_get_mark(const mem_pool_t *mem_pool);
+
+/** @brief Free every bloc of memory allocated after a checkpoint.
+ *
+ *  @note A checkpoint beyond the current allocations, e.g. taken before a mem_pool_free(), is ignored.
+ *
+ *  @param[in] mem_pool  Memory pool handler.
+ *  @param[in] mark      Checkpoint taken with mem_pool_get_mark().
+ */
+void mem_pool_rewind(mem_pool_t *mem_pool, mem_pool_mark_t mark);
+
 /** @brief Get the number of bytes allocated from the pool.
  *
  *  @param[in] mem_pool  Memory pool handle.
@@ -57,6 +181,13 @@ void mem_pool_free(mem_pool_t *mem_mang);
  */
 uint32_t mem_pool_get_allocated_bytes(mem_pool_t *mem_pool);
 
+/** @brief Get the usage statistics of a memory pool.
+ *
+ *  @param[in]  mem_pool  Memory pool handle.
+ *  @param[out] stats     Usage statistics.
+ */
+void mem_pool_get_stats(const mem_pool_t *mem_pool, mem_pool_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,8 +21,8 @@ extern "C" {
 /* CONSTANTS ******************************************************************/
 /*! Calculate number of bytes required for the queue. */
 #define QUEUE_NB_BYTES_NEEDED(num_queues, num_nodes, data_size) \
-    ((num_nodes) *                                              \
-     (sizeof(queue_node_t) + data_size + (sizeof(queue_node_t *) * num_queues) + (sizeof(queue_t *) * num_queues)))
+    ((num_nodes) * (sizeof(queue_node_t) + (data_size) + (sizeof(queue_node_t *) * (num_queues)) + \
+                    (sizeof(queue_t *) * (num_queues))))
 
 /* TYPES **********************************************************************/
 /** @brief Node instance.
@@ -0,0 +1,176 @@
+/** @file spsc_queue.c
+ *  @brief Lock-free single-producer single-consumer circular queue.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "spsc_queue.h"
+#include <stddef.h>
+#if !defined(__ARM_ARCH_8M_MAIN__) && !defined(__ARM_ARCH_8M_BASE__) && !defined(__ARM_ARCH_8_1M_MAIN__)
+#include <stdatomic.h>
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Largest capacity returned by spsc_queue_round_capacity(). */
+#define SPSC_QUEUE_MAX_CAPACITY (1UL << 31)
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static inline uint32_t load_acquire(const volatile uint32_t *index);
+static inline void store_release(volatile uint32_t *index, uint32_t value);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+void spsc_queue_init(spsc_queue_t *queue, void *buffer, uint32_t capacity, uint32_t item_size)
+{
+    /* Keep the most significant bit only */
+    while ((capacity & (capacity - 1)) != 0) {
+        capacity &= capacity - 1;
+    }
+
+    queue->buffer = (uint8_t *)buffer;
+    queue->item_size = item_size;
+    queue->capacity = capacity;
+    queue->mask = capacity - 1;
+    queue->head = 0;
+    queue->tail = 0;
+}
+
+uint32_t spsc_queue_round_capacity(uint32_t item_count)
+{
+    uint32_t capacity = 1;
+
+    while ((capacity < item_count) && (capacity < SPSC_QUEUE_MAX_CAPACITY)) {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+void *spsc_queue_get_free_slot(spsc_queue_t *queue)
+{
+    uint32_t head = queue->head;
+
+    /* Acquire the tail so the consumer is done reading the slot before it is overwritten */
+    if ((head - load_acquire(&queue->tail)) >= queue->capacity) {
+        return NULL;
+    }
+
+    return &queue->buffer[(head & queue->mask) * queue->item_size];
+}
+
+bool spsc_queue_enqueue(spsc_queue_t *queue)
+{
+    uint32_t head = queue->head;
+
+    if ((head - load_acquire(&queue->tail)) >= queue->capacity) {
+        return false;
+    }
+
+    /* Release the head so the slot content is visible to the consumer before the slot itself */
+    store_release(&queue->head, head + 1);
+
+    return true;
+}
+
+void *spsc_queue_front(spsc_queue_t *queue)
+{
+    uint32_t tail = queue->tail;
+
+    /* Acquire the head so the slot content written by the producer is visible */
+    if (load_acquire(&queue->head) == tail) {
+        return NULL;
+    }
+
+    return &queue->buffer[(tail & queue->mask) * queue->item_size];
+}
+
+bool spsc_queue_dequeue(spsc_queue_t *queue)
+{
+    uint32_t tail = queue->tail;
+
+    if (load_acquire(&queue->head) == tail) {
+        return false;
+    }
+
+    /* Release the tail so the slot is read before the producer can reuse it */
+    store_release(&queue->tail, tail + 1);
+
+    return true;
+}
+
+uint32_t spsc_queue_size(spsc_queue_t *queue)
+{
+    uint32_t tail = load_acquire(&queue->tail);
+
+    return load_acquire(&queue->head) - tail;
+}
+
+uint32_t spsc_queue_capacity(spsc_queue_t *queue)
+{
+    return queue->capacity;
+}
+
+bool spsc_queue_is_empty(spsc_queue_t *queue)
+{
+    return (spsc_queue_size(queue) == 0);
+}
+
+bool spsc_queue_is_full(spsc_queue_t *queue)
+{
+    return (spsc_queue_size(queue) >= queue->capacity);
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+#if defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8M_BASE__) || defined(__ARM_ARCH_8_1M_MAIN__)
+/** @brief Load an index with acquire semantics.
+ *
+ *  ARMv8-M provides load-acquire and store-release instructions, which order the index access with the surrounding
+ *  memory accesses without the full DMB barrier a generic atomic access would emit.
+ *
+ *  @param[in] index  Index to load.
+ *  @return Index value.
+ */
+static inline uint32_t load_acquire(const volatile uint32_t *index)
+{
+    uint32_t value;
+
+    __asm volatile("lda %0, %1" : "=r"(value) : "Q"(*index) : "memory");
+
+    return value;
+}
+
+/** @brief Store an index with release semantics.
+ *
+ *  @param[in] index  Index to store.
+ *  @param[in] value  Index value.
+ */
+static inline void store_release(volatile uint32_t *index, uint32_t value)
+{
+    __asm volatile("stl %1, %0" : "=Q"(*index) : "r"(value) : "memory");
+}
+#else
+_Static_assert(sizeof(_Atomic uint32_t) == sizeof(uint32_t), "Atomic index must have the size of an index");
+
+/** @brief Load an index with acquire semantics.
+ *
+ *  @param[in] index  Index to load.
+ *  @return Index value.
+ */
+static inline uint32_t load_acquire(const volatile uint32_t *index)
+{
+    return atomic_load_explicit((const volatile _Atomic uint32_t *)index, memory_order_acquire);
+}
+
+/** @brief Store an index with release semantics.
+ *
+ *  @param[in] index  Index to store.
+ *  @param[in] value  Index value.
+ */
+static inline void store_release(volatile uint32_t *index, uint32_t value)
+{
+    atomic_store_explicit((volatile _Atomic uint32_t *)index, value, memory_order_release);
+}
+#endif
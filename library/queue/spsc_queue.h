@@ -0,0 +1,148 @@
+/** @file spsc_queue.h
+ *  @brief Lock-free single-producer single-consumer circular queue.
+ *
+ *  The queue holds fixed size items in a buffer of power-of-two capacity. The producer only writes the head index and
+ *  the consumer only writes the tail index, each side publishing its index with a release store and reading the other
+ *  one with an acquire load. Both sides can therefore run concurrently, for instance from an interrupt handler and from
+ *  the main loop, without masking interrupts.
+ *
+ *  How to use the module :
+ *      Producer side: fill the slot returned by spsc_queue_get_free_slot(), then publish it with spsc_queue_enqueue().
+ *      Consumer side: read the item returned by spsc_queue_front(), then release it with spsc_queue_dequeue().
+ *      Only one context may act as the producer and only one context may act as the consumer.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Constant expression form of spsc_queue_round_capacity(), for item counts up to 65536. */
+#define SPSC_QUEUE_ROUND_CAPACITY(item_count) \
+    (((item_count) <= 1) ? 1UL : (SPSC_QUEUE_SMEAR_16((uint32_t)(item_count) - 1) + 1))
+
+/*! Set every bit below the most significant one of a 16-bit value. */
+#define SPSC_QUEUE_SMEAR_16(x) (SPSC_QUEUE_SMEAR_8(x) | (SPSC_QUEUE_SMEAR_8(x) >> 8))
+#define SPSC_QUEUE_SMEAR_8(x)  (SPSC_QUEUE_SMEAR_4(x) | (SPSC_QUEUE_SMEAR_4(x) >> 4))
+#define SPSC_QUEUE_SMEAR_4(x)  (SPSC_QUEUE_SMEAR_2(x) | (SPSC_QUEUE_SMEAR_2(x) >> 2))
+#define SPSC_QUEUE_SMEAR_2(x)  ((x) | ((x) >> 1))
+
+/* TYPES **********************************************************************/
+/** @brief Structure for single-producer single-consumer circular queue.
+ */
+typedef struct spsc_queue {
+    /*! Items buffer. */
+    uint8_t *buffer;
+    /*! Size in bytes of an item. */
+    uint32_t item_size;
+    /*! Number of items the buffer can hold, a power of two. */
+    uint32_t capacity;
+    /*! Capacity minus one, used to wrap the indexes. */
+    uint32_t mask;
+    /*! Free-running index of the next slot to enqueue, only written by the producer. */
+    volatile uint32_t head;
+    /*! Free-running index of the next slot to dequeue, only written by the consumer. */
+    volatile uint32_t tail;
+} spsc_queue_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief SPSC queue initialization.
+ *
+ *  The capacity is rounded down to a power of two, use spsc_queue_round_capacity() to size the buffer.
+ *
+ *  @param[in] queue      SPSC queue instance.
+ *  @param[in] buffer     SPSC queue buffer, of at least capacity * item_size bytes.
+ *  @param[in] capacity   SPSC queue buffer size, in number of items.
+ *  @param[in] item_size  Size in bytes of the data element stored in the SPSC queue buffer.
+ */
+void spsc_queue_init(spsc_queue_t *queue, void *buffer, uint32_t capacity, uint32_t item_size);
+
+/** @brief Get the smallest power of two capacity holding a given number of items.
+ *
+ *  @param[in] item_count  Number of items the queue must hold.
+ *  @return Capacity to give to spsc_queue_init().
+ */
+uint32_t spsc_queue_round_capacity(uint32_t item_count);
+
+/** @brief SPSC queue free slot, producer side.
+ *
+ *  @param[in] queue  SPSC queue instance.
+ *  @return The next slot to be enqueued. If no slot is free, return NULL.
+ */
+void *spsc_queue_get_free_slot(spsc_queue_t *queue);
+
+/** @brief SPSC queue enqueue, producer side.
+ *
+ *  Publish the slot returned by spsc_queue_get_free_slot() to the consumer.
+ *
+ *  @param[in] queue  SPSC queue instance.
+ *  @retval True  Slot has been successfully enqueued.
+ *  @retval False Queue is full, slot has not been enqueued.
+ */
+bool spsc_queue_enqueue(spsc_queue_t *queue);
+
+/** @brief SPSC queue front, consumer side.
+ *
+ *  @param[in] queue  SPSC queue instance.
+ *  @return Buffer's front (oldest value). If queue is empty, return NULL.
+ */
+void *spsc_queue_front(spsc_queue_t *queue);
+
+/** @brief SPSC queue dequeue, consumer side.
+ *
+ *  Release the slot returned by spsc_queue_front() to the producer.
+ *
+ *  @param[in] queue  SPSC queue instance.
+ *  @retval True  Slot has been successfully dequeued.
+ *  @retval False Queue is empty, nothing to dequeue.
+ */
+bool spsc_queue_dequeue(spsc_queue_t *queue);
+
+/** @brief SPSC queue size.
+ *
+ *  The value is a snapshot, it may already be outdated when the other side is running.
+ *
+ *  @param[in] queue  SPSC queue instance.
+ *  @return Number of items in the queue.
+ */
+uint32_t spsc_queue_size(spsc_queue_t *queue);
+
+/** @brief SPSC queue capacity.
+ *
+ *  @param[in] queue  SPSC queue instance.
+ *  @return Queue capacity.
+ */
+uint32_t spsc_queue_capacity(spsc_queue_t *queue);
+
+/** @brief SPSC queue empty?
+ *
+ *  @param[in] queue  SPSC queue instance.
+ *  @retval true   Queue is empty.
+ *  @retval false  Queue is not empty.
+ */
+bool spsc_queue_is_empty(spsc_queue_t *queue);
+
+/** @brief SPSC queue full?
+ *
+ *  @param[in] queue  SPSC queue instance.
+ *  @retval true   Queue is full.
+ *  @retval false  Queue is not full.
+ */
+bool spsc_queue_is_full(spsc_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+#endif  // SPSC_QUEUE_H
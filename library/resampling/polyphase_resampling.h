@@ -0,0 +1,125 @@
+/** @file  polyphase_resampling.h
+ *  @brief Continuously variable ratio resampler using a windowed-sinc polyphase fractional delay filter.
+ *
+ *  The resampler is meant to correct small clock drifts between an audio source and an audio sink. Every output frame
+ *  is interpolated at a fractional position of the input stream with a 24-tap Kaiser windowed-sinc filter. The filter
+ *  coefficients are stored for 64 fractional positions and linearly interpolated in between, so the fractional position
+ *  has a resolution of 2^-32 input frame and the ratio can be changed on every call without any discontinuity.
+ *
+ *  How to use the module :
+ *      Initialize the instance once with polyphase_resampling_init() and a state buffer of
+ *      POLYPHASE_RESAMPLING_STATE_SIZE() samples.
+ *      Use polyphase_resampling_set_ratio_offset() whenever the conversion ratio must be corrected.
+ *      Use polyphase_resampling_process() to resample a block of interleaved frames. Every input frame is consumed and
+ *      the number of output frames produced depends on the current ratio, up to one frame more than the input.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef POLYPHASE_RESAMPLING_H_
+#define POLYPHASE_RESAMPLING_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdint.h>
+#include "resampling.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Number of taps of the fractional delay filter. The resampler introduces a delay of half this number of frames. */
+#define POLYPHASE_RESAMPLING_TAP_COUNT 24
+/*! Number of fractional positions for which the filter coefficients are stored. */
+#define POLYPHASE_RESAMPLING_PHASE_COUNT 64
+/*! Largest ratio offset accepted by the resampler, in parts per million. */
+#define POLYPHASE_RESAMPLING_MAX_RATIO_OFFSET_PPM 1000
+
+/*! Number of state samples required by the resampler: one history of (taps + max_frame_count) per channel. */
+#define POLYPHASE_RESAMPLING_STATE_SIZE(max_frame_count, channel_count) \
+    ((uint32_t)(channel_count) * ((uint32_t)POLYPHASE_RESAMPLING_TAP_COUNT + (uint32_t)(max_frame_count)))
+
+/* TYPES **********************************************************************/
+/** @brief Polyphase resampling configuration.
+ */
+typedef struct polyphase_resampling_config {
+    /*! Number of interleaved channels, up to RESAMPLING_CFG_MAX_NB_CHANNEL. */
+    uint8_t channel_count;
+    /*! Largest number of frames given to polyphase_resampling_process(). */
+    uint16_t max_frame_count;
+    /*! Size of a sample in the input and output buffers: 2, 3 or 4 bytes. */
+    uint8_t sample_size_byte;
+    /*! Number of significant bits of a sample, the output is saturated to this range. */
+    uint8_t bit_depth;
+} polyphase_resampling_config_t;
+
+/** @brief Polyphase resampling instance.
+ */
+typedef struct polyphase_resampling_instance {
+    /*! Number of interleaved channels. */
+    uint8_t channel_count;
+    /*! Largest number of frames given to polyphase_resampling_process(). */
+    uint16_t max_frame_count;
+    /*! Size of a sample in the input and output buffers. */
+    uint8_t sample_size_byte;
+    /*! Smallest output sample value. */
+    int32_t min_value;
+    /*! Largest output sample value. */
+    int32_t max_value;
+    /*! Points to the state array. The array is of length POLYPHASE_RESAMPLING_STATE_SIZE(max_frame_count,
+     *  channel_count), each channel owns a contiguous history of state_stride samples.
+     */
+    int32_t *p_state;
+    /*! Number of state samples per channel. */
+    uint32_t state_stride;
+    /*! Index of the first history sample used by the next output frame. */
+    uint32_t read_idx;
+    /*! Fractional part of the next output frame position, in 0.32 format. */
+    uint32_t fraction;
+    /*! Number of input frames consumed per output frame minus one, in units of 2^-32 frame. */
+    int32_t ratio_offset;
+} polyphase_resampling_instance_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize a polyphase resampling instance.
+ *
+ *  The ratio offset is cleared, the resampler then copies its input with a delay of
+ *  POLYPHASE_RESAMPLING_TAP_COUNT / 2 frames.
+ *
+ *  @param[in] instance  Polyphase resampling instance.
+ *  @param[in] config    Polyphase resampling configuration.
+ *  @param[in] p_state   State buffer of POLYPHASE_RESAMPLING_STATE_SIZE() samples.
+ *  @return Resampling error code.
+ */
+resampling_errors_t polyphase_resampling_init(polyphase_resampling_instance_t *instance,
+                                              const polyphase_resampling_config_t *config, int32_t *p_state);
+
+/** @brief Set the conversion ratio.
+ *
+ *  A positive offset consumes more input frames than output frames are produced, which lowers the number of frames
+ *  at the output of the resampler.
+ *
+ *  @param[in] instance      Polyphase resampling instance.
+ *  @param[in] ratio_offset  Number of input frames consumed per output frame minus one, in units of 2^-32 frame.
+ *                           The value is clamped to POLYPHASE_RESAMPLING_MAX_RATIO_OFFSET_PPM.
+ */
+void polyphase_resampling_set_ratio_offset(polyphase_resampling_instance_t *instance, int32_t ratio_offset);
+
+/** @brief Resample a block of interleaved frames.
+ *
+ *  @param[in]  instance     Polyphase resampling instance.
+ *  @param[in]  src          Input frames.
+ *  @param[out] dst          Output frames, must hold at least frame_count + 1 frames. May not overlap the input.
+ *  @param[in]  frame_count  Number of input frames, up to max_frame_count.
+ *  @return Number of output frames.
+ */
+uint16_t polyphase_resampling_process(polyphase_resampling_instance_t *instance, const uint8_t *src, uint8_t *dst,
+                                      uint16_t frame_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POLYPHASE_RESAMPLING_H_ */
@@ -38,6 +38,7 @@ typedef enum resampling_errors {
     RESAMPLING_NO_ERROR = 0,
     RESAMPLING_INVALID_TYPE = -1,
     RESAMPLING_INVALID_NB_CHANNEL = -2,
+    RESAMPLING_INVALID_FRAME_COUNT = -3,
 } resampling_errors_t;
 
 /** @brief Resampling Buffer Types.
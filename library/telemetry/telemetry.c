@@ -0,0 +1,136 @@
+/** @file  telemetry.c
+ *  @brief Binary telemetry frame encoder.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+
+/* INCLUDES *******************************************************************/
+#include "telemetry.h"
+#include <string.h>
+#include "crc16_ccitt.h"
+
+/* PRIVATE FUNCTION PROTOTYPES ************************************************/
+static inline void write_u16(uint8_t *buffer, uint16_t value);
+static inline void write_u32(uint8_t *buffer, uint32_t value);
+
+/* PUBLIC FUNCTIONS ***********************************************************/
+bool telemetry_init(telemetry_t *telemetry, uint8_t *buffer, uint16_t buffer_size)
+{
+    bool valid = (buffer != NULL) && (buffer_size >= TELEMETRY_FRAME_SIZE(0, 0));
+
+    /* An invalid buffer is recorded as empty, so no frame is ever started in it */
+    telemetry->buffer = valid ? buffer : NULL;
+    telemetry->buffer_size = valid ? buffer_size : 0;
+    telemetry->size = 0;
+    telemetry->record_count = 0;
+    telemetry->sequence = 0;
+    telemetry->dropped_record_count = 0;
+
+    return valid;
+}
+
+bool telemetry_start_frame(telemetry_t *telemetry, uint32_t timestamp)
+{
+    telemetry->size = 0;
+    telemetry->record_count = 0;
+    if (telemetry->buffer_size < TELEMETRY_FRAME_SIZE(0, 0)) {
+        return false;
+    }
+
+    write_u32(&telemetry->buffer[6], timestamp);
+    telemetry->size = TELEMETRY_FRAME_HEADER_SIZE;
+
+    return true;
+}
+
+bool telemetry_start_record(telemetry_t *telemetry, telemetry_record_type_t type, uint8_t version, uint8_t instance,
+                            uint16_t field_count)
+{
+    uint32_t value_size = (uint32_t)field_count * TELEMETRY_FIELD_SIZE;
+    uint8_t *record;
+
+    if ((telemetry->size < TELEMETRY_FRAME_HEADER_SIZE) ||
+        ((uint32_t)telemetry->size + TELEMETRY_RECORD_HEADER_SIZE + value_size + TELEMETRY_FRAME_CRC_SIZE >
+         telemetry->buffer_size) ||
+        (telemetry->record_count == UINT8_MAX)) {
+        telemetry->dropped_record_count++;
+        return false;
+    }
+
+    record = &telemetry->buffer[telemetry->size];
+    record[0] = (uint8_t)type;
+    record[1] = version;
+    record[2] = instance;
+    write_u16(&record[3], (uint16_t)value_size);
+    telemetry->size += TELEMETRY_RECORD_HEADER_SIZE;
+    telemetry->record_count++;
+
+    return true;
+}
+
+void telemetry_put_u32(telemetry_t *telemetry, uint32_t value)
+{
+    write_u32(&telemetry->buffer[telemetry->size], value);
+    telemetry->size += TELEMETRY_FIELD_SIZE;
+}
+
+void telemetry_put_float(telemetry_t *telemetry, float value)
+{
+    uint32_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    telemetry_put_u32(telemetry, bits);
+}
+
+uint16_t telemetry_end_frame(telemetry_t *telemetry)
+{
+    uint8_t *buffer = telemetry->buffer;
+    uint16_t crc;
+
+    /* Only a frame started and not ended yet can be completed, the buffer has room for its CRC */
+    if ((telemetry->size < TELEMETRY_FRAME_HEADER_SIZE) ||
+        ((uint32_t)telemetry->size + TELEMETRY_FRAME_CRC_SIZE > telemetry->buffer_size)) {
+        return 0;
+    }
+
+    write_u16(&buffer[0], TELEMETRY_SYNC_WORD);
+    buffer[2] = TELEMETRY_PROTOCOL_VERSION;
+    buffer[3] = telemetry->record_count;
+    write_u16(&buffer[4], telemetry->sequence++);
+    write_u16(&buffer[10], telemetry->size - TELEMETRY_FRAME_HEADER_SIZE);
+
+    /* The sync word is excluded so the CRC also detects a false sync */
+    crc = crc16_ccitt(CRC16_CCITT_INIT, &buffer[2], telemetry->size - 2);
+    write_u16(&buffer[telemetry->size], crc);
+    telemetry->size += TELEMETRY_FRAME_CRC_SIZE;
+
+    return telemetry->size;
+}
+
+/* PRIVATE FUNCTIONS **********************************************************/
+/** @brief Write a 16-bit value in little-endian.
+ *
+ *  @param[out] buffer  Destination.
+ *  @param[in]  value   Value.
+ */
+static inline void write_u16(uint8_t *buffer, uint16_t value)
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+}
+
+/** @brief Write a 32-bit value in little-endian.
+ *
+ *  @param[out] buffer  Destination.
+ *  @param[in]  value   Value.
+ */
+static inline void write_u32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+    buffer[2] = (uint8_t)(value >> 16);
+    buffer[3] = (uint8_t)(value >> 24);
+}
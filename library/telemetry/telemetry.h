@@ -0,0 +1,187 @@
+/** @file  telemetry.h
+ *  @brief Binary telemetry frame encoder.
+ *
+ *  Statistics are exported as binary frames instead of formatted text, so they can be sampled at a high rate over a
+ *  UART or a USB CDC link without the stack, flash and CPU cost of snprintf. The frames are rendered to text or CSV
+ *  on the host by the telemetry_decoder tool.
+ *
+ *  Frame format, all fields little-endian:
+ *      Offset  Size  Field
+ *      0       2     Sync word, TELEMETRY_SYNC_WORD.
+ *      2       1     Protocol version, TELEMETRY_PROTOCOL_VERSION.
+ *      3       1     Number of records.
+ *      4       2     Sequence number, incremented for every frame so the host can detect lost frames.
+ *      6       4     Timestamp, in a unit chosen by the application.
+ *      10      2     Size of the records, in bytes.
+ *      12      n     Records.
+ *      12 + n  2     CRC-16/CCITT-FALSE of the bytes from offset 2 to 12 + n - 1.
+ *
+ *  Record format:
+ *      Offset  Size  Field
+ *      0       1     Record type, see telemetry_record_type_t.
+ *      1       1     Record version, incremented when the fields of the record type change.
+ *      2       1     Instance, chosen by the application to tell apart the records of the same type.
+ *      3       2     Size of the record value, in bytes.
+ *      5       m     Record value, a sequence of 32-bit fields.
+ *
+ *  How to use the module :
+ *      Initialize the encoder once with telemetry_init() and a frame buffer.
+ *      For every frame, call telemetry_start_frame(), then the add_telemetry function of every statistics to export,
+ *      then telemetry_end_frame() and send the telemetry_get_frame() bytes.
+ *
+ *  @copyright Copyright (C) 2026 SPARK Microsystems International Inc. All rights reserved.
+ *  @license   This source code is proprietary and subject to the SPARK Microsystems
+ *             Software EULA found in this package in file EULA.txt.
+ *  @author    SPARK FW Team.
+ */
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+/* INCLUDES *******************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CONSTANTS ******************************************************************/
+/*! Frame sync word. */
+#define TELEMETRY_SYNC_WORD 0x5AA5
+/*! Version of the frame format. */
+#define TELEMETRY_PROTOCOL_VERSION 1
+/*! Size of the frame header. */
+#define TELEMETRY_FRAME_HEADER_SIZE 12
+/*! Size of the frame CRC. */
+#define TELEMETRY_FRAME_CRC_SIZE 2
+/*! Size of the record header. */
+#define TELEMETRY_RECORD_HEADER_SIZE 5
+/*! Size of a record field. */
+#define TELEMETRY_FIELD_SIZE 4
+
+/*! Size of a frame buffer holding records of a total value size. */
+#define TELEMETRY_FRAME_SIZE(record_count, value_size)                                                \
+    (TELEMETRY_FRAME_HEADER_SIZE + ((record_count) * TELEMETRY_RECORD_HEADER_SIZE) + (value_size) + \
+     TELEMETRY_FRAME_CRC_SIZE)
+
+/* TYPES **********************************************************************/
+/** @brief Telemetry record types.
+ *
+ *  The value of a type must never change once released, the host decoder relies on it.
+ */
+typedef enum telemetry_record_type {
+    /*! Wireless Core connection statistics, see swc_connection_add_stats_telemetry(). */
+    TELEMETRY_RECORD_SWC_CONNECTION_STATS = 0x01,
+    /*! Wireless Core connection latency statistics, see swc_connection_add_stats_telemetry(). */
+    TELEMETRY_RECORD_SWC_CONNECTION_LATENCY = 0x02,
+    /*! Audio Core pipeline statistics, see sac_pipeline_add_stats_telemetry(). */
+    TELEMETRY_RECORD_SAC_PIPELINE_STATS = 0x10,
+    /*! Audio Core CDC statistics, see sac_cdc_add_stats_telemetry(). */
+    TELEMETRY_RECORD_SAC_CDC_STATS = 0x11,
+    /*! Audio Core CDC ASRC statistics, see sac_cdc_asrc_add_stats_telemetry(). */
+    TELEMETRY_RECORD_SAC_CDC_ASRC_STATS = 0x12,
+    /*! Audio Core CDC PLL statistics, see sac_cdc_pll_add_stats_telemetry(). */
+    TELEMETRY_RECORD_SAC_CDC_PLL_STATS = 0x13,
+} telemetry_record_type_t;
+
+/** @brief Telemetry frame encoder.
+ */
+typedef struct telemetry {
+    /*! Frame buffer. */
+    uint8_t *buffer;
+    /*! Size of the frame buffer. */
+    uint16_t buffer_size;
+    /*! Number of bytes written in the frame buffer. */
+    uint16_t size;
+    /*! Number of records in the current frame. */
+    uint8_t record_count;
+    /*! Sequence number of the next frame. */
+    uint16_t sequence;
+    /*! Number of records that did not fit in their frame. */
+    uint32_t dropped_record_count;
+} telemetry_t;
+
+/* PUBLIC FUNCTION PROTOTYPES *************************************************/
+/** @brief Initialize the telemetry frame encoder.
+ *
+ *  @param[in] telemetry    Telemetry instance.
+ *  @param[in] buffer       Frame buffer, TELEMETRY_FRAME_SIZE() gives the size required by a set of records.
+ *  @param[in] buffer_size  Size of the frame buffer.
+ *  @retval true   Encoder is initialized.
+ *  @retval false  Buffer is NULL or smaller than TELEMETRY_FRAME_SIZE(0, 0), no frame can be started.
+ */
+bool telemetry_init(telemetry_t *telemetry, uint8_t *buffer, uint16_t buffer_size);
+
+/** @brief Start a new frame.
+ *
+ *  @param[in] telemetry  Telemetry instance.
+ *  @param[in] timestamp  Frame timestamp.
+ *  @retval true   Frame is started.
+ *  @retval false  Frame buffer cannot hold an empty frame, records are dropped until the next frame.
+ */
+bool telemetry_start_frame(telemetry_t *telemetry, uint32_t timestamp);
+
+/** @brief Start a new record in the current frame.
+ *
+ *  The record value must then be written with field_count calls to the telemetry_put functions.
+ *
+ *  @param[in] telemetry    Telemetry instance.
+ *  @param[in] type         Record type.
+ *  @param[in] version      Record version.
+ *  @param[in] instance     Record instance.
+ *  @param[in] field_count  Number of 32-bit fields of the record value.
+ *  @retval true   Record is started.
+ *  @retval false  No frame is started or the record does not fit in the frame buffer, the fields must not be
+ *                 written.
+ */
+bool telemetry_start_record(telemetry_t *telemetry, telemetry_record_type_t type, uint8_t version, uint8_t instance,
+                            uint16_t field_count);
+
+/** @brief Write an unsigned field of the current record.
+ *
+ *  @param[in] telemetry  Telemetry instance.
+ *  @param[in] value      Field value.
+ */
+void telemetry_put_u32(telemetry_t *telemetry, uint32_t value);
+
+/** @brief Write a signed field of the current record.
+ *
+ *  @param[in] telemetry  Telemetry instance.
+ *  @param[in] value      Field value.
+ */
+static inline void telemetry_put_i32(telemetry_t *telemetry, int32_t value)
+{
+    telemetry_put_u32(telemetry, (uint32_t)value);
+}
+
+/** @brief Write a floating point field of the current record.
+ *
+ *  @param[in] telemetry  Telemetry instance.
+ *  @param[in] value      Field value, written as an IEEE 754 single precision number.
+ */
+void telemetry_put_float(telemetry_t *telemetry, float value);
+
+/** @brief Complete the current frame.
+ *
+ *  The frame header and CRC are written, the frame is then ready to be sent.
+ *
+ *  @param[in] telemetry  Telemetry instance.
+ *  @return Frame size, in bytes, 0 when no frame is started.
+ */
+uint16_t telemetry_end_frame(telemetry_t *telemetry);
+
+/** @brief Get the current frame.
+ *
+ *  @param[in] telemetry  Telemetry instance.
+ *  @return Frame bytes.
+ */
+static inline const uint8_t *telemetry_get_frame(const telemetry_t *telemetry)
+{
+    return telemetry->buffer;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H_ */
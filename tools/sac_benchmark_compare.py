@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""SAC processing stage benchmark comparator.
+
+Purpose
+-------
+Compare the CSV output of two runs of the SAC benchmark (app/tool/sac_benchmark)
+and fail when a processing stage got slower than the allowed tolerance. Use it
+to gate changes to the audio core processing stages.
+
+The reference and the candidate must come from the same platform: host runs
+are in nanoseconds, target runs are in CPU cycles. The default metric,
+ticks_per_sample, is the most stable one on the target since it does not
+depend on the clock frequency. On the host, min_ticks is less sensitive to
+scheduling noise.
+
+Input files may be raw captures of the DUT log: every line that is not part of
+the CSV table (banner, comments starting with '#') is ignored.
+
+Usage
+-----
+  sac_benchmark_host 20000 > reference.csv
+  sac_benchmark_host 20000 > candidate.csv
+  python sac_benchmark_compare.py reference.csv candidate.csv
+  python sac_benchmark_compare.py reference.csv candidate.csv --tolerance 10
+  python sac_benchmark_compare.py reference.csv candidate.csv --metric load_percent
+
+Exit status is 1 when a case regressed or is missing from the candidate.
+"""
+import argparse
+import csv
+import sys
+
+HEADER_FIRST_COLUMN = "stage"
+
+
+def load(path):
+    """Return {(stage, variant): row} for the CSV table found in a log file."""
+    with open(path, newline="", encoding="utf-8", errors="replace") as f:
+        lines = [line.strip() for line in f]
+
+    try:
+        start = next(i for i, line in enumerate(lines)
+                     if line.startswith(HEADER_FIRST_COLUMN + ","))
+    except StopIteration:
+        sys.exit(f"{path}: no benchmark table found")
+
+    table = [line for line in lines[start:] if line and not line.startswith("#")]
+    results = {}
+    for row in csv.DictReader(table):
+        if row.get("variant") is None:
+            # Trailing log output after the table.
+            continue
+        results[(row["stage"], row["variant"])] = row
+    return results
+
+
+def main():
+    reference = load(args.reference)
+    candidate = load(args.candidate)
+
+    regressions = 0
+    missing = 0
+    print(f"{'stage':<20} {'variant':<30} {'reference':>12} {'candidate':>12} {'change':>9}")
+    print("-" * 87)
+    for key, ref_row in reference.items():
+        stage, variant = key
+        cand_row = candidate.get(key)
+        if cand_row is None:
+            print(f"{stage:<20} {variant:<30} {'':>12} {'missing':>12}")
+            missing += 1
+            continue
+
+        ref_value = float(ref_row[args.metric])
+        cand_value = float(cand_row[args.metric])
+        change = ((cand_value - ref_value) / ref_value * 100) if ref_value else 0.0
+        flag = ""
+        if change > args.tolerance:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{stage:<20} {variant:<30} {ref_value:>12.3f} {cand_value:>12.3f} {change:>8.1f}%{flag}")
+
+    for key in candidate.keys() - reference.keys():
+        print(f"{key[0]:<20} {key[1]:<30} {'new':>12}")
+
+    print("-" * 87)
+    print(f"{len(reference)} case(s), {regressions} regression(s) above {args.tolerance:.1f}%, "
+          f"{missing} missing")
+    sys.exit(1 if (regressions or missing) else 0)
+
+
+if __name__ == "__main__":
+    ap = argparse.ArgumentParser(
+        description="SAC processing stage benchmark comparator",
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    ap.add_argument("reference", help="CSV output of the reference run")
+    ap.add_argument("candidate", help="CSV output of the run to check")
+    ap.add_argument("--metric", default="ticks_per_sample",
+                    help="column to compare, lower is better")
+    ap.add_argument("--tolerance", type=float, default=5.0,
+                    help="allowed slowdown in percent")
+    args = ap.parse_args()
+    main()